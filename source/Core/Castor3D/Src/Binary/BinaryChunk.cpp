@@ -8,15 +8,26 @@ using namespace castor;
 
 namespace castor3d
 {
+	namespace
+	{
+		MemoryTag & doGetMemoryTag()
+		{
+			static MemoryTag & tag = MemoryAccounting::getTag( cuT( "Binary chunks" ) );
+			return tag;
+		}
+	}
+
 	BinaryChunk::BinaryChunk()
 		: m_type{ ChunkType::eUnknown }
 		, m_index{ 0 }
+		, m_memory{ doGetMemoryTag() }
 	{
 	}
 
 	BinaryChunk::BinaryChunk( ChunkType p_type )
 		:	m_type{ p_type }
 		,	m_index{ 0 }
+		,	m_memory{ doGetMemoryTag() }
 	{
 	}
 
@@ -34,12 +45,15 @@ namespace castor3d
 			std::memcpy( &m_data[index], array.data(), array.size() );
 			index += array.size();
 		}
+
+		doUpdateMemory();
 	}
 
 	void BinaryChunk::add( uint8_t * p_data, uint32_t p_size )
 	{
 		ByteArray buffer( p_data, p_data + p_size );
 		m_addedData.push_back( buffer );
+		doUpdateMemory();
 	}
 
 	void BinaryChunk::get( uint8_t * p_data, uint32_t p_size )
@@ -81,6 +95,7 @@ namespace castor3d
 			// Eventually we retrieve the chunk data
 			subchunk.m_data.insert( subchunk.m_data.end(), m_data.begin() + m_index, m_data.begin() + m_index + size );
 			subchunk.m_index = 0;
+			subchunk.doUpdateMemory();
 			m_index += size;
 			p_chunkDst = subchunk;
 		}
@@ -148,9 +163,21 @@ namespace castor3d
 		if ( result )
 		{
 			m_data.resize( size );
+			doUpdateMemory();
 			result = p_file.readArray( m_data.data(), m_data.size() ) == m_data.size();
 		}
 
 		return result;
 	}
+
+	void BinaryChunk::doUpdateMemory()
+	{
+		m_memory.setCpuSize( std::accumulate( m_addedData.begin()
+			, m_addedData.end()
+			, m_data.capacity()
+			, []( size_t p_value, ByteArray const & p_array )
+			{
+				return p_value + p_array.capacity();
+			} ) );
+	}
 }
@@ -7,6 +7,8 @@ See LICENSE file in root folder
 #include "Castor3DPrerequisites.hpp"
 #include "ChunkData.hpp"
 
+#include <Miscellaneous/MemoryAccounting.hpp>
+
 #include <cstring>
 
 namespace castor3d
@@ -100,6 +102,21 @@ namespace castor3d
 		eSkeletonAnimationKeyFrameObjectType = MAKE_CHUNK_ID( 'S', 'K', 'A', 'N', 'K', 'F', 'O', 'Y' ),
 		eSkeletonAnimationKeyFrameObjectName = MAKE_CHUNK_ID( 'S', 'K', 'A', 'N', 'K', 'F', 'O', 'N' ),
 		eSkeletonAnimationKeyFrameObjectTransform = MAKE_CHUNK_ID( 'S', 'K', 'A', 'N', 'K', 'F', 'O', 'T' ),
+		// Compiled scene file
+		eCscbFile = MAKE_CHUNK_ID( 'C', 'S', 'C', 'B', 'F', 'I', 'L', 'E' ),
+		eCscbHeader = MAKE_CHUNK_ID( 'C', 'S', 'C', 'B', 'H', 'D', 'E', 'R' ),
+		eCscbVersion = MAKE_CHUNK_ID( 'C', 'S', 'C', 'B', 'V', 'R', 'S', 'N' ),
+		eCscbArchive = MAKE_CHUNK_ID( 'C', 'S', 'C', 'B', 'A', 'R', 'C', 'H' ),
+		eCscbArchiveRoot = MAKE_CHUNK_ID( 'C', 'S', 'A', 'R', 'R', 'O', 'O', 'T' ),
+		eCscbArchivePath = MAKE_CHUNK_ID( 'C', 'S', 'A', 'R', 'P', 'A', 'T', 'H' ),
+		eCscbMainScript = MAKE_CHUNK_ID( 'C', 'S', 'C', 'B', 'M', 'A', 'I', 'N' ),
+		eCscbScript = MAKE_CHUNK_ID( 'C', 'S', 'C', 'B', 'S', 'C', 'P', 'T' ),
+		eCscbScriptPath = MAKE_CHUNK_ID( 'C', 'S', 'S', 'C', 'P', 'A', 'T', 'H' ),
+		eCscbDirective = MAKE_CHUNK_ID( 'C', 'S', 'S', 'C', 'D', 'R', 'C', 'T' ),
+		eCscbAction = MAKE_CHUNK_ID( 'C', 'S', 'S', 'C', 'A', 'C', 'T', 'N' ),
+		eCscbActionText = MAKE_CHUNK_ID( 'C', 'S', 'A', 'C', 'T', 'E', 'X', 'T' ),
+		eCscbParam = MAKE_CHUNK_ID( 'C', 'S', 'A', 'C', 'P', 'A', 'R', 'M' ),
+		eCscbMesh = MAKE_CHUNK_ID( 'C', 'S', 'C', 'B', 'M', 'E', 'S', 'H' ),
 	};
 	/**
 	 *\~english
@@ -307,6 +324,7 @@ namespace castor3d
 		inline void setData( uint8_t const * p_begin, uint8_t const * p_end )
 		{
 			m_data.assign( p_begin, p_end );
+			doUpdateMemory();
 		}
 		/**
 		 *\~english
@@ -330,6 +348,8 @@ namespace castor3d
 		}
 
 	private:
+		C3D_API void doUpdateMemory();
+
 		template< typename T >
 		inline bool doRead( T * p_values, uint32_t p_count )
 		{
@@ -364,6 +384,8 @@ namespace castor3d
 		uint32_t m_index;
 		//!\~english The chunk data	\~french Les données du chunk
 		std::list< castor::ByteArray > m_addedData;
+		//!\~english Accounts for the chunk data	\~french Comptabilise les données du chunk
+		castor::MemoryUsage m_memory;
 	};
 }
 
@@ -6,6 +6,8 @@ See LICENSE file in root folder
 
 #include "Castor3DPrerequisites.hpp"
 
+#include "Miscellaneous/ReferenceCounter.hpp"
+
 #include <Design/Collection.hpp>
 #include <Design/OwnedBy.hpp>
 #include <Design/Signal.hpp>
@@ -249,17 +251,19 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Applies a function to all the elements of this cache.
+		 *\remarks		The elements are taken from the latest snapshot, so the cache isn't locked during the calls.
 		 *\param[in]	func	The function.
 		 *\~french
 		 *\brief		Applique une fonction à tous les éléments de ce cache.
+		 *\remarks		Les éléments sont pris dans le dernier instantané, le cache n'est donc pas locké pendant les appels.
 		 *\param[in]	func	La fonction.
 		 */
 		template< typename FuncType >
 		inline void forEach( FuncType func )const
 		{
-			auto lock = castor::makeUniqueLock( m_elements );
+			auto snapshot = m_elements.getSnapshot();
 
-			for ( auto const & element : m_elements )
+			for ( auto const & element : *snapshot )
 			{
 				func( *element.second );
 			}
@@ -267,17 +271,19 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Applies a function to all the elements of this cache.
+		 *\remarks		The elements are taken from the latest snapshot, so the cache isn't locked during the calls.
 		 *\param[in]	func	The function.
 		 *\~french
 		 *\brief		Applique une fonction à tous les éléments de ce cache.
+		 *\remarks		Les éléments sont pris dans le dernier instantané, le cache n'est donc pas locké pendant les appels.
 		 *\param[in]	func	La fonction.
 		 */
 		template< typename FuncType >
 		inline void forEach( FuncType func )
 		{
-			auto lock = castor::makeUniqueLock( m_elements );
+			auto snapshot = m_elements.getSnapshot();
 
-			for ( auto & element : m_elements )
+			for ( auto const & element : *snapshot )
 			{
 				func( *element.second );
 			}
@@ -338,6 +344,17 @@ namespace castor3d
 		{
 			return m_elements.find( name );
 		}
+		/**
+		 *\~english
+		 *\return		The latest snapshot of the collection, to iterate it without locking it.
+		 *\~french
+		 *\return		Le dernier instantané de la collection, pour la parcourir sans la locker.
+		 */
+		inline typename Collection::SnapshotPtr getSnapshot()const
+		{
+			C3D_CountReference();
+			return m_elements.getSnapshot();
+		}
 		/**
 		 *\~english
 		 *\brief		Locks the collection mutex
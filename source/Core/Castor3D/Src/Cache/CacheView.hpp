@@ -198,6 +198,9 @@ namespace castor3d
 		//!\~english	The elements that are being cleaned.
 		//!\~french		Les éléments en cours de nettoyage.
 		std::vector< ResourcePtr > m_cleaning;
+		//!\~english	Protects the view, the importers running on the assets loading threads create elements.
+		//!\~french		Protège la vue, les importeurs exécutés sur les threads de chargement des ressources créent des éléments.
+		std::mutex m_mutex;
 	};
 }
 
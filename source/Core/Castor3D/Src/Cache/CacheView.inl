@@ -25,6 +25,7 @@ namespace castor3d
 	template< typename ... Params >
 	inline std::shared_ptr< ResourceType > CacheView< ResourceType, CacheType, EventType >::add( castor::String const & p_name, Params && ... p_params )
 	{
+		auto lock = castor::makeUniqueLock( m_mutex );
 		std::shared_ptr< ResourceType > result;
 
 		if ( m_cache.has( p_name ) )
@@ -45,6 +46,7 @@ namespace castor3d
 	template< typename ResourceType, typename CacheType, EventType EventType >
 	inline std::shared_ptr< ResourceType > CacheView< ResourceType, CacheType, EventType >::add( castor::String const & p_name, std::shared_ptr< ResourceType > p_element )
 	{
+		auto lock = castor::makeUniqueLock( m_mutex );
 		auto result = m_cache.add( p_name, p_element );
 
 		if ( result )
@@ -58,6 +60,8 @@ namespace castor3d
 	template< typename ResourceType, typename CacheType, EventType EventType >
 	inline void CacheView< ResourceType, CacheType, EventType >::clear()
 	{
+		auto lock = castor::makeUniqueLock( m_mutex );
+
 		for ( auto name : m_createdElements )
 		{
 			auto resource = m_cache.find( name );
@@ -92,6 +96,7 @@ namespace castor3d
 	template< typename ResourceType, typename CacheType, EventType EventType >
 	inline void CacheView< ResourceType, CacheType, EventType >::remove( castor::String const & p_name )
 	{
+		auto lock = castor::makeUniqueLock( m_mutex );
 		auto it = m_createdElements.find( p_name );
 
 		if ( it != m_createdElements.end() )
@@ -0,0 +1,142 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_HANDLE_REGISTRIES_H___
+#define ___C3D_HANDLE_REGISTRIES_H___
+
+#include "Castor3DPrerequisites.hpp"
+
+#include <Design/HandleRegistry.hpp>
+
+namespace castor3d
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/01/2018
+	\~english
+	\brief		Holds the handle registries of the objects used by the render paths (geometries, meshes, submeshes, materials, passes and scene nodes).
+	\remarks	The render queues, culling and animations store handles to these objects instead of smart pointers, and resolve them here without touching any reference count.
+	\~french
+	\brief		Contient les registres de poignées des objets utilisés par les chemins de rendu (géométries, maillages, sous-maillages, matériaux, passes et noeuds de scène).
+	\remarks	Les files de rendu, le culling et les animations stockent des poignées vers ces objets au lieu de pointeurs intelligents, et les résolvent ici sans toucher aux compteurs de références.
+	*/
+	class HandleRegistries
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Registers an object.
+		 *\param[in]	object	The object.
+		 *\return		The handle to the object.
+		 *\~french
+		 *\brief		Enregistre un objet.
+		 *\param[in]	object	L'objet.
+		 *\return		La poignée vers l'objet.
+		 */
+		template< typename T >
+		inline castor::Handle< T > add( T & object )
+		{
+			return doGetRegistry( static_cast< T * >( nullptr ) ).add( object );
+		}
+		/**
+		 *\~english
+		 *\brief		Unregisters an object.
+		 *\param[in]	handle	The object's handle.
+		 *\~french
+		 *\brief		Désenregistre un objet.
+		 *\param[in]	handle	La poignée de l'objet.
+		 */
+		template< typename T >
+		inline void remove( castor::Handle< T > const & handle )
+		{
+			doGetRegistry( static_cast< T * >( nullptr ) ).remove( handle );
+		}
+		/**
+		 *\~english
+		 *\brief		Retrieves the object referenced by a handle.
+		 *\param[in]	handle	The handle.
+		 *\return		The object, \p nullptr if it has been destroyed.
+		 *\~french
+		 *\brief		Récupère l'objet référencé par une poignée.
+		 *\param[in]	handle	La poignée.
+		 *\return		L'objet, \p nullptr s'il a été détruit.
+		 */
+		template< typename T >
+		inline T * resolve( castor::Handle< T > const & handle )const
+		{
+			return doGetRegistry( static_cast< T * >( nullptr ) ).resolve( handle );
+		}
+
+	private:
+		inline castor::HandleRegistry< Geometry > & doGetRegistry( Geometry * )
+		{
+			return m_geometries;
+		}
+
+		inline castor::HandleRegistry< Geometry > const & doGetRegistry( Geometry * )const
+		{
+			return m_geometries;
+		}
+
+		inline castor::HandleRegistry< Mesh > & doGetRegistry( Mesh * )
+		{
+			return m_meshes;
+		}
+
+		inline castor::HandleRegistry< Mesh > const & doGetRegistry( Mesh * )const
+		{
+			return m_meshes;
+		}
+
+		inline castor::HandleRegistry< Submesh > & doGetRegistry( Submesh * )
+		{
+			return m_submeshes;
+		}
+
+		inline castor::HandleRegistry< Submesh > const & doGetRegistry( Submesh * )const
+		{
+			return m_submeshes;
+		}
+
+		inline castor::HandleRegistry< Material > & doGetRegistry( Material * )
+		{
+			return m_materials;
+		}
+
+		inline castor::HandleRegistry< Material > const & doGetRegistry( Material * )const
+		{
+			return m_materials;
+		}
+
+		inline castor::HandleRegistry< Pass > & doGetRegistry( Pass * )
+		{
+			return m_passes;
+		}
+
+		inline castor::HandleRegistry< Pass > const & doGetRegistry( Pass * )const
+		{
+			return m_passes;
+		}
+
+		inline castor::HandleRegistry< SceneNode > & doGetRegistry( SceneNode * )
+		{
+			return m_nodes;
+		}
+
+		inline castor::HandleRegistry< SceneNode > const & doGetRegistry( SceneNode * )const
+		{
+			return m_nodes;
+		}
+
+	private:
+		castor::HandleRegistry< Geometry > m_geometries;
+		castor::HandleRegistry< Mesh > m_meshes;
+		castor::HandleRegistry< Submesh > m_submeshes;
+		castor::HandleRegistry< Material > m_materials;
+		castor::HandleRegistry< Pass > m_passes;
+		castor::HandleRegistry< SceneNode > m_nodes;
+	};
+}
+
+#endif
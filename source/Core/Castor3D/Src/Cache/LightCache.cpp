@@ -9,8 +9,11 @@
 #include "Render/RenderSystem.hpp"
 #include "Scene/Camera.hpp"
 #include "Scene/Scene.hpp"
+#include "Scene/Light/PointLight.hpp"
+#include "Scene/Light/SpotLight.hpp"
 #include "Shader/UniformBuffer.hpp"
 #include "Shader/ShaderProgram.hpp"
+#include "Technique/Opaque/LightPass.hpp"
 #include "Texture/TextureLayout.hpp"
 #include "Texture/TextureUnit.hpp"
 #include "Texture/TextureLayout.hpp"
@@ -26,6 +29,11 @@ namespace castor3d
 
 	namespace
 	{
+		// The two first texels of the clusters buffer hold the grid parameters.
+		uint32_t constexpr ClustersParamsCount = 2u;
+		uint32_t constexpr DefaultLightsTexels = 1000u;
+		uint32_t constexpr DefaultIndicesCount = 4096u;
+
 		class LightInitialiser
 		{
 		public:
@@ -100,6 +108,8 @@ namespace castor3d
 			, std::move( p_attach )
 			, std::move( p_detach ) )
 		, m_lightsTexture{ *getEngine() }
+		, m_clustersTexture{ *getEngine() }
+		, m_indicesTexture{ *getEngine() }
 	{
 	}
 
@@ -109,24 +119,32 @@ namespace castor3d
 
 	void ObjectCache< Light, castor::String >::initialise()
 	{
-		auto texture = getEngine()->getRenderSystem()->createTexture( TextureType::eBuffer
-			, AccessType::eWrite
-			, AccessType::eRead
+		auto & dimensions = m_lightGrid.getDimensions();
+		doCreateTexture( m_lightsTexture
+			, m_lightsBuffer
 			, PixelFormat::eRGBA32F
-			, Size( 1000, 1 ) );
-		texture->getImage().initialiseSource();
-		SamplerSPtr sampler = getEngine()->getLightsSampler();
-		m_lightsTexture.setAutoMipmaps( false );
-		m_lightsTexture.setSampler( sampler );
-		m_lightsTexture.setTexture( texture );
-		m_lightsTexture.setIndex( LightBufferIndex );
+			, DefaultLightsTexels
+			, LightBufferIndex );
+		doCreateTexture( m_clustersTexture
+			, m_clustersBuffer
+			, PixelFormat::eRGBA32F
+			, ClustersParamsCount + dimensions[0] * dimensions[1] * dimensions[2]
+			, LightClustersIndex );
+		doCreateTexture( m_indicesTexture
+			, m_indicesBuffer
+			, PixelFormat::eL32F
+			, DefaultIndicesCount
+			, LightIndicesIndex );
 		m_scene.getListener().postEvent( makeInitialiseEvent( m_lightsTexture ) );
-		m_lightsBuffer = texture->getImage().getBuffer();
+		m_scene.getListener().postEvent( makeInitialiseEvent( m_clustersTexture ) );
+		m_scene.getListener().postEvent( makeInitialiseEvent( m_indicesTexture ) );
 	}
 
 	void ObjectCache< Light, castor::String >::cleanup()
 	{
 		m_scene.getListener().postEvent( makeCleanupEvent( m_lightsTexture ) );
+		m_scene.getListener().postEvent( makeCleanupEvent( m_clustersTexture ) );
+		m_scene.getListener().postEvent( makeCleanupEvent( m_indicesTexture ) );
 		m_dirtyLights.clear();
 		m_connections.clear();
 		MyObjectCache::cleanup();
@@ -223,28 +241,73 @@ namespace castor3d
 		}
 	}
 
-	void ObjectCache< Light, castor::String >::updateLightsTexture( Camera const & camera )const
+	void ObjectCache< Light, castor::String >::updateLightsTexture( Camera const & camera )
 	{
-		auto layout = m_lightsTexture.getTexture();
-
-		if ( layout )
+		if ( m_lightsTexture.getTexture() )
 		{
-			auto const & image = layout->getImage();
-			int index = 0;
+			uint32_t count = 0u;
+
+			for ( auto & lights : m_typeSortedLights )
+			{
+				count += uint32_t( lights.size() );
+			}
 
-			for ( auto lights : m_typeSortedLights )
+			doReserve( m_lightsTexture
+				, m_lightsBuffer
+				, count * shader::MaxLightComponentsCount );
+			auto & viewport = camera.getViewport();
+			m_lightGrid.reset( camera.getView()
+				, viewport.getFovY()
+				, viewport.getRatio()
+				, viewport.getNear()
+				, viewport.getFar()
+				, viewport.getSize() );
+			uint32_t index = 0u;
+
+			// All lights are written, so that the indices match the lights counts given to the shaders.
+			// The visibility culling is done by the light clusters, with the distance at which
+			// the attenuated light falls under the cut-off intensity, as for the deferred light volumes.
+			for ( auto & lights : m_typeSortedLights )
 			{
-				for ( auto light : lights )
+				for ( auto & light : lights )
 				{
-					if ( light->getLightType() == LightType::eDirectional
-						|| camera.isVisible( light->getBoundingBox()
-							, light->getParent()->getDerivedTransformationMatrix() ) )
+					light->bind( *m_lightsBuffer, index );
+
+					switch ( light->getLightType() )
 					{
-						light->bind( *m_lightsBuffer, index++ );
+					case LightType::ePoint:
+						{
+							auto & point = *light->getPointLight();
+							m_lightGrid.addPointLight( index
+								, light->getParent()->getDerivedPosition()
+								, getMaxDistance( point, point.getAttenuation() ) );
+						}
+						break;
+
+					case LightType::eSpot:
+						{
+							auto & spot = *light->getSpotLight();
+							m_lightGrid.addSpotLight( index
+								, light->getParent()->getDerivedPosition()
+								, getMaxDistance( spot, spot.getAttenuation() ) );
+						}
+						break;
+
+					default:
+						break;
 					}
+
+					++index;
 				}
 			}
 
+			if ( viewport.getType() == ViewportType::ePerspective )
+			{
+				m_lightGrid.build();
+				doUpdateClusters();
+			}
+
+			auto layout = m_lightsTexture.getTexture();
 			auto locked = layout->lock( AccessType::eWrite );
 
 			if ( locked )
@@ -259,10 +322,14 @@ namespace castor3d
 	void ObjectCache< Light, castor::String >::bindLights()const
 	{
 		m_lightsTexture.bind();
+		m_clustersTexture.bind();
+		m_indicesTexture.bind();
 	}
 
 	void ObjectCache< Light, castor::String >::unbindLights()const
 	{
+		m_indicesTexture.unbind();
+		m_clustersTexture.unbind();
 		m_lightsTexture.unbind();
 	}
 
@@ -270,4 +337,97 @@ namespace castor3d
 	{
 		m_dirtyLights.emplace_back( &light );
 	}
+
+	void ObjectCache< Light, castor::String >::doCreateTexture( TextureUnit & unit
+		, PxBufferBaseSPtr & buffer
+		, PixelFormat format
+		, uint32_t size
+		, uint32_t index )
+	{
+		auto texture = getEngine()->getRenderSystem()->createTexture( TextureType::eBuffer
+			, AccessType::eWrite
+			, AccessType::eRead
+			, format
+			, Size( size, 1 ) );
+		texture->getImage().initialiseSource();
+		SamplerSPtr sampler = getEngine()->getLightsSampler();
+		unit.setAutoMipmaps( false );
+		unit.setSampler( sampler );
+		unit.setTexture( texture );
+		unit.setIndex( index );
+		buffer = texture->getImage().getBuffer();
+	}
+
+	void ObjectCache< Light, castor::String >::doReserve( TextureUnit & unit
+		, PxBufferBaseSPtr & buffer
+		, uint32_t size )
+	{
+		if ( size > buffer->count() )
+		{
+			// Called with an active context, so the texture is recreated immediately.
+			unit.cleanup();
+			doCreateTexture( unit
+				, buffer
+				, buffer->format()
+				, std::max( size, 2u * buffer->count() )
+				, unit.getIndex() );
+			unit.initialise();
+		}
+	}
+
+	void ObjectCache< Light, castor::String >::doUpdateClusters()
+	{
+		auto & dimensions = m_lightGrid.getDimensions();
+		auto & size = m_lightGrid.getSize();
+		auto & clusters = m_lightGrid.getClusters();
+		auto & indices = m_lightGrid.getIndices();
+		auto data = reinterpret_cast< float * >( m_clustersBuffer->ptr() );
+		*data++ = float( dimensions[0] );
+		*data++ = float( dimensions[1] );
+		*data++ = float( dimensions[2] );
+		*data++ = m_lightGrid.getSliceFactor();
+		*data++ = m_lightGrid.getNear();
+		*data++ = m_lightGrid.getFar();
+		*data++ = float( size.getWidth() );
+		*data++ = float( size.getHeight() );
+
+		for ( auto & cluster : clusters )
+		{
+			*data++ = float( cluster.m_offset );
+			*data++ = float( cluster.m_pointCount );
+			*data++ = float( cluster.m_spotCount );
+			*data++ = 0.0f;
+		}
+
+		doReserve( m_indicesTexture
+			, m_indicesBuffer
+			, uint32_t( indices.size() ) );
+		data = reinterpret_cast< float * >( m_indicesBuffer->ptr() );
+
+		for ( auto index : indices )
+		{
+			*data++ = float( index );
+		}
+
+		auto upload = []( TextureUnit const & unit
+			, PxBufferBase const & buffer
+			, uint32_t size )
+		{
+			auto layout = unit.getTexture();
+			auto locked = layout->lock( AccessType::eWrite );
+
+			if ( locked )
+			{
+				memcpy( locked, buffer.constPtr(), size );
+			}
+
+			layout->unlock( true );
+		};
+		upload( m_clustersTexture
+			, *m_clustersBuffer
+			, m_clustersBuffer->size() );
+		upload( m_indicesTexture
+			, *m_indicesBuffer
+			, uint32_t( indices.size() * sizeof( float ) ) );
+	}
 }
@@ -5,6 +5,7 @@ See LICENSE file in root folder
 #define ___C3D_LIGHT_CACHE_H___
 
 #include "Scene/Light/LightFactory.hpp"
+#include "Scene/Light/LightGrid.hpp"
 #include "Cache/ObjectCache.hpp"
 #include "Texture/TextureUnit.hpp"
 
@@ -167,25 +168,27 @@ namespace castor3d
 		C3D_API void update();
 		/**
 		 *\~english
-		 *\brief		Updates the lights texture.
-		 *\param[in]	camera	The camera used to tell if a light is applicable or not.
+		 *\brief		Updates the lights texture, and the light clusters.
+		 *\remarks		All lights are written, sorted by type, the clusters only reference the point and spot lights affecting them.
+		 *\param[in]	camera	The camera used to build the light clusters.
 		 *\~french
-		 *\brief		Met à jour la texture de sources lumineuses.
-		 *\param[in]	camera	La caméra utilisée pour déterminer si une source lumineuse est applicable ou pas.
+		 *\brief		Met à jour la texture de sources lumineuses, et les clusters de lumières.
+		 *\remarks		Toutes les sources sont écrites, triées par type, les clusters ne référencent que les sources omnidirectionnelles et projecteurs les affectant.
+		 *\param[in]	camera	La caméra utilisée pour construire les clusters de lumières.
 		 */
-		C3D_API void updateLightsTexture( Camera const & camera )const;
+		C3D_API void updateLightsTexture( Camera const & camera );
 		/**
 		 *\~english
-		 *\brief		Binds the lights texture.
+		 *\brief		Binds the lights texture, and the light clusters textures.
 		 *\~french
-		 *\brief		Active la texture de sources lumineuses.
+		 *\brief		Active la texture de sources lumineuses, et les textures des clusters de lumières.
 		 */
 		C3D_API void bindLights()const;
 		/**
 		 *\~english
-		 *\brief		Unbinds the lights texture.
+		 *\brief		Unbinds the lights texture, and the light clusters textures.
 		 *\~french
-		 *\brief		Désactive la texture de sources lumineuses.
+		 *\brief		Désactive la texture de sources lumineuses, et les textures des clusters de lumières.
 		 */
 		C3D_API void unbindLights()const;
 		/**
@@ -217,8 +220,28 @@ namespace castor3d
 			return m_typeSortedLights[size_t( p_type )];
 		}
 
+		/**
+		 *\~english
+		 *\return		The light clusters.
+		 *\~french
+		 *\return		Les clusters de lumières.
+		 */
+		inline LightGrid const & getLightGrid()const
+		{
+			return m_lightGrid;
+		}
+
 	private:
 		void onLightChanged( Light & light );
+		void doCreateTexture( TextureUnit & unit
+			, castor::PxBufferBaseSPtr & buffer
+			, castor::PixelFormat format
+			, uint32_t size
+			, uint32_t index );
+		void doReserve( TextureUnit & unit
+			, castor::PxBufferBaseSPtr & buffer
+			, uint32_t size );
+		void doUpdateClusters();
 
 	private:
 		//!\~english	The lights sorted by light type.
@@ -230,6 +253,21 @@ namespace castor3d
 		//!\~english	The lights texture buffer.
 		//!\~french		Le tampon de la texture contenant les lumières.
 		castor::PxBufferBaseSPtr m_lightsBuffer;
+		//!\~english	The light clusters.
+		//!\~french		Les clusters de lumières.
+		LightGrid m_lightGrid;
+		//!\~english	The light clusters texture.
+		//!\~french		La texture contenant les clusters de lumières.
+		TextureUnit m_clustersTexture;
+		//!\~english	The light clusters texture buffer.
+		//!\~french		Le tampon de la texture contenant les clusters de lumières.
+		castor::PxBufferBaseSPtr m_clustersBuffer;
+		//!\~english	The clusters light indices texture.
+		//!\~french		La texture contenant les indices de lumières des clusters.
+		TextureUnit m_indicesTexture;
+		//!\~english	The clusters light indices texture buffer.
+		//!\~french		Le tampon de la texture contenant les indices de lumières des clusters.
+		castor::PxBufferBaseSPtr m_indicesBuffer;
 		//!\~english	The light sources that need to be updated.
 		//!\~french		Les sources lumineuses ayant besoin d'être mises à jour.
 		LightsRefArray m_dirtyLights;
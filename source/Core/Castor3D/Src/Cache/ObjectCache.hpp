@@ -257,17 +257,19 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Applies a function to all the elements of this cache.
+		 *\remarks		The elements are taken from the latest snapshot, so the cache isn't locked during the calls.
 		 *\param[in]	p_func	The function.
 		 *\~french
 		 *\brief		Applique une fonction à tous les éléments de ce cache.
+		 *\remarks		Les éléments sont pris dans le dernier instantané, le cache n'est donc pas locké pendant les appels.
 		 *\param[in]	p_func	La fonction.
 		 */
 		template< typename FuncType >
 		inline void forEach( FuncType p_func )const
 		{
-			auto lock = castor::makeUniqueLock( m_elements );
+			auto snapshot = m_elements.getSnapshot();
 
-			for ( auto const & element : m_elements )
+			for ( auto const & element : *snapshot )
 			{
 				p_func( *element.second );
 			}
@@ -275,17 +277,19 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Applies a function to all the elements of this cache.
+		 *\remarks		The elements are taken from the latest snapshot, so the cache isn't locked during the calls.
 		 *\param[in]	p_func	The function.
 		 *\~french
 		 *\brief		Applique une fonction à tous les éléments de ce cache.
+		 *\remarks		Les éléments sont pris dans le dernier instantané, le cache n'est donc pas locké pendant les appels.
 		 *\param[in]	p_func	La fonction.
 		 */
 		template< typename FuncType >
 		inline void forEach( FuncType p_func )
 		{
-			auto lock = castor::makeUniqueLock( m_elements );
+			auto snapshot = m_elements.getSnapshot();
 
-			for ( auto & element : m_elements )
+			for ( auto const & element : *snapshot )
 			{
 				p_func( *element.second );
 			}
@@ -356,6 +360,16 @@ namespace castor3d
 		{
 			return m_elements.find( p_name );
 		}
+		/**
+		 *\~english
+		 *\return		The latest snapshot of the collection, to iterate it without locking it.
+		 *\~french
+		 *\return		Le dernier instantané de la collection, pour la parcourir sans la locker.
+		 */
+		inline typename Collection::SnapshotPtr getSnapshot()const
+		{
+			return m_elements.getSnapshot();
+		}
 		/**
 		 *\~english
 		 *\brief		Locks the collection mutex
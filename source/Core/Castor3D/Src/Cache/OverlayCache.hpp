@@ -78,8 +78,8 @@ namespace castor3d
 		using Producer = typename MyCacheType::Producer;
 		using Merger = typename MyCacheType::Merger;
 
-		typedef castor::Collection< Overlay, castor::String >::TObjPtrMapIt iterator;
-		typedef castor::Collection< Overlay, castor::String >::TObjPtrMapConstIt const_iterator;
+		typedef castor::Collection< Overlay, castor::String >::TObjPtrArrayIt iterator;
+		typedef castor::Collection< Overlay, castor::String >::TObjPtrArrayConstIt const_iterator;
 		DECLARE_MAP( castor::String, FontTextureSPtr, FontTextureStr );
 
 		struct OverlayInitialiser
@@ -75,8 +75,11 @@ namespace castor3d
 		, ProgramFlags const & programFlags
 		, SceneFlags const & sceneFlags
 		, ComparisonFunc alphaFunc
-		, bool invertNormals )
+		, bool invertNormals
+		, bool deferred )
 	{
+		// This function can be called concurrently from the pipelines preparation threads,
+		// so the lookup and the registration are locked, but not the shaders generation.
 		ShaderProgramSPtr result;
 
 		if ( checkFlag( programFlags, ProgramFlag::eBillboards ) )
@@ -87,13 +90,18 @@ namespace castor3d
 				, sceneFlags
 				, alphaFunc
 				, false );
-			auto const & it = m_mapBillboards.find( key );
 
-			if ( it != m_mapBillboards.end() )
 			{
-				result = it->second.lock();
+				auto lock = makeUniqueLock( m_mutex );
+				auto const & it = m_mapBillboards.find( key );
+
+				if ( it != m_mapBillboards.end() )
+				{
+					result = it->second.lock();
+				}
 			}
-			else
+
+			if ( !result )
 			{
 				result = doCreateBillboardProgram( renderPass
 					, passFlags
@@ -104,12 +112,14 @@ namespace castor3d
 
 				if ( result )
 				{
-					doAddBillboardProgram( result
+					auto lock = makeUniqueLock( m_mutex );
+					result = doAddBillboardProgram( result
 						, passFlags
 						, textureFlags
 						, programFlags
 						, sceneFlags
-						, alphaFunc );
+						, alphaFunc
+						, deferred );
 				}
 			}
 		}
@@ -121,13 +131,18 @@ namespace castor3d
 				, sceneFlags
 				, alphaFunc
 				, invertNormals );
-			ShaderProgramWPtrUInt64MapConstIt it = m_mapAutogenerated.find( key );
 
-			if ( it != m_mapAutogenerated.end() )
 			{
-				result = it->second.lock();
+				auto lock = makeUniqueLock( m_mutex );
+				ShaderProgramWPtrUInt64MapConstIt it = m_mapAutogenerated.find( key );
+
+				if ( it != m_mapAutogenerated.end() )
+				{
+					result = it->second.lock();
+				}
 			}
-			else
+
+			if ( !result )
 			{
 				result = doCreateAutomaticProgram( renderPass
 					, passFlags
@@ -139,13 +154,15 @@ namespace castor3d
 
 				if ( result )
 				{
-					doAddAutomaticProgram( result
+					auto lock = makeUniqueLock( m_mutex );
+					result = doAddAutomaticProgram( result
 						, passFlags
 						, textureFlags
 						, programFlags
 						, sceneFlags
 						, alphaFunc
-						, invertNormals );
+						, invertNormals
+						, deferred );
 				}
 			}
 		}
@@ -156,11 +173,18 @@ namespace castor3d
 	void ShaderProgramCache::createTextureVariables( ShaderProgram & shader
 		, PassFlags const & passFlags
 		, TextureChannels const & textureFlags
-		, ProgramFlags const & programFlags )const
+		, ProgramFlags const & programFlags
+		, SceneFlags const & sceneFlags )const
 	{
 		if ( checkFlag( programFlags, ProgramFlag::eLighting ) )
 		{
 			shader.createUniform< UniformType::eSampler >( ShaderProgram::Lights, ShaderType::ePixel )->setValue( LightBufferIndex );
+
+			if ( checkFlag( sceneFlags, SceneFlag::eLightClusters ) )
+			{
+				shader.createUniform< UniformType::eSampler >( ShaderProgram::LightClusters, ShaderType::ePixel )->setValue( LightClustersIndex );
+				shader.createUniform< UniformType::eSampler >( ShaderProgram::LightIndices, ShaderType::ePixel )->setValue( LightIndicesIndex );
+			}
 		}
 
 		if ( checkFlag( textureFlags, TextureChannel::eNormal ) )
@@ -262,11 +286,14 @@ namespace castor3d
 	}
 
 	void ShaderProgramCache::doAddProgram( ShaderProgramSPtr program
-		, bool initialise )
+		, bool initialise
+		, bool deferred )
 	{
 		m_arrayPrograms.push_back( program );
 
-		if ( initialise )
+		// A deferred program is initialised on the render thread, once updated by the passes, by the publication
+		// of its pipelines, so the current context is not queried from the preparation threads.
+		if ( initialise && !deferred )
 		{
 			if ( getEngine()->getRenderSystem()->getCurrentContext() )
 			{
@@ -321,19 +348,21 @@ namespace castor3d
 			createTextureVariables( *result
 				, passFlags
 				, textureFlags
-				, programFlags );
+				, programFlags
+				, sceneFlags );
 		}
 
 		return result;
 	}
 
-	void ShaderProgramCache::doAddAutomaticProgram( ShaderProgramSPtr program
+	ShaderProgramSPtr ShaderProgramCache::doAddAutomaticProgram( ShaderProgramSPtr program
 		, PassFlags const & passFlags
 		, TextureChannels const & textureFlags
 		, ProgramFlags const & programFlags
 		, SceneFlags const & sceneFlags
 		, ComparisonFunc alphaFunc
-		, bool invertNormals )
+		, bool invertNormals
+		, bool deferred )
 	{
 		uint64_t key = makeKey( passFlags
 			, textureFlags
@@ -341,13 +370,22 @@ namespace castor3d
 			, sceneFlags
 			, alphaFunc
 			, invertNormals );
-		auto const & it = m_mapAutogenerated.find( key );
+		auto it = m_mapAutogenerated.find( key );
+		ShaderProgramSPtr result;
+
+		if ( it != m_mapAutogenerated.end() )
+		{
+			result = it->second.lock();
+		}
 
-		if ( it == m_mapAutogenerated.end() )
+		if ( !result )
 		{
-			m_mapAutogenerated.insert( { key, program } );
-			doAddProgram( program, true );
+			m_mapAutogenerated[key] = program;
+			doAddProgram( program, true, deferred );
+			result = program;
 		}
+
+		return result;
 	}
 
 	ShaderProgramSPtr ShaderProgramCache::doCreateBillboardProgram( RenderPass const & renderPass
@@ -454,18 +492,20 @@ namespace castor3d
 			createTextureVariables( *result
 				, passFlags
 				, textureFlags
-				, programFlags );
+				, programFlags
+				, sceneFlags );
 		}
 
 		return result;
 	}
 
-	void ShaderProgramCache::doAddBillboardProgram( ShaderProgramSPtr p_program
+	ShaderProgramSPtr ShaderProgramCache::doAddBillboardProgram( ShaderProgramSPtr p_program
 		, PassFlags const & passFlags
 		, TextureChannels const & textureFlags
 		, ProgramFlags const & programFlags
 		, SceneFlags const & sceneFlags
-		, ComparisonFunc alphaFunc )
+		, ComparisonFunc alphaFunc
+		, bool deferred )
 	{
 		uint64_t key = makeKey( passFlags
 			, textureFlags
@@ -473,12 +513,21 @@ namespace castor3d
 			, sceneFlags
 			, alphaFunc
 			, false );
-		auto const & it = m_mapBillboards.find( key );
+		auto it = m_mapBillboards.find( key );
+		ShaderProgramSPtr result;
+
+		if ( it != m_mapBillboards.end() )
+		{
+			result = it->second.lock();
+		}
 
-		if ( it == m_mapBillboards.end() )
+		if ( !result )
 		{
-			m_mapBillboards.insert( { key, p_program } );
-			doAddProgram( p_program, true );
+			m_mapBillboards[key] = p_program;
+			doAddProgram( p_program, true, deferred );
+			result = p_program;
 		}
+
+		return result;
 	}
 }
@@ -72,6 +72,7 @@ namespace castor3d
 		 *\param[in]	sceneFlags		Scene related flags.
 		 *\param[in]	alphaFunc		The alpha test function.
 		 *\param[in]	invertNormals	Tells if the normals must be inverted, in the program.
+		 *\param[in]	deferred		Tells if the initialisation of a created program is left to the publication of its pipelines, on the render thread.
 		 *\return		The found or created program.
 		 *\~french
 		 *\brief		Cherche un programme automatiquement généré correspondant aux flags donnés.
@@ -82,6 +83,7 @@ namespace castor3d
 		 *\param[in]	sceneFlags		Les indicateurs relatifs à la scène.
 		 *\param[in]	alphaFunc		La fonction de test alpha.
 		 *\param[in]	invertNormals	Dit si les normales doivent être inversées, dans le programme.
+		 *\param[in]	deferred		Dit si l'initialisation d'un programme créé est laissée à la publication de ses pipelines, sur le thread de rendu.
 		 *\return		Le programme trouvé ou créé.
 		 */
 		C3D_API ShaderProgramSPtr getAutomaticProgram( RenderPass const & renderPass
@@ -90,7 +92,8 @@ namespace castor3d
 			, ProgramFlags const & programFlags
 			, SceneFlags const & sceneFlags
 			, ComparisonFunc alphaFunc
-			, bool invertNormals );
+			, bool invertNormals
+			, bool deferred = false );
 		/**
 		 *\~english
 		 *\brief		Creates the textures related frame variables.
@@ -98,17 +101,20 @@ namespace castor3d
 		 *\param[in]	passFlags		Bitwise ORed PassFlag.
 		 *\param[in]	textureFlags	TextureChannel combination.
 		 *\param[in]	programFlags	Bitwise ORed ProgramFlag.
+		 *\param[in]	sceneFlags		Scene related flags.
 		 *\~french
 		 *\brief		Crée les frame variables relatives aux textures.
 		 *\param[in]	program			Le programme auquel le buffer est lié.
 		 *\param[in]	passFlags		Une combinaison de PassFlag.
 		 *\param[in]	textureFlags	Une combinaison de TextureChannel.
 		 *\param[in]	programFlags	Une combinaison de ProgramFlag.
+		 *\param[in]	sceneFlags		Les indicateurs relatifs à la scène.
 		 */
 		C3D_API void createTextureVariables( ShaderProgram & program
 			, PassFlags const & passFlags
 			, TextureChannels const & textureFlags
-			, ProgramFlags const & programFlags )const;
+			, ProgramFlags const & programFlags
+			, SceneFlags const & sceneFlags )const;
 		/**
 		 *\~english
 		 *\brief		Locks the collection mutex
@@ -184,12 +190,16 @@ namespace castor3d
 		 *\brief		adds a program to the list.
 		 *\param[in]	initialise	Tells if we want the program to be initialised.
 		 *\param[in]	program		The program to add.
+		 *\param[in]	deferred	Tells if the initialisation is left to the publication of the program's pipelines, on the render thread.
 		 *\~french
 		 *\brief		Crée un nouveau programme.
 		 *\param[in]	initialise	Dit si on veut que le programme soit initialisé.
 		 *\param[in]	program		Le programme à ajouter.
+		 *\param[in]	deferred	Dit si l'initialisation est laissée à la publication des pipelines du programme, sur le thread de rendu.
 		 */
-		C3D_API void doAddProgram( ShaderProgramSPtr program, bool initialise );
+		C3D_API void doAddProgram( ShaderProgramSPtr program
+			, bool initialise
+			, bool deferred = false );
 		/**
 		 *\~english
 		 *\brief		Looks for an automatically generated program corresponding to given flags.
@@ -230,7 +240,8 @@ namespace castor3d
 		 *\param[in]	sceneFlags		The scene flags (fog, ...).
 		 *\param[in]	alphaFunc		The alpha test function.
 		 *\param[in]	invertNormals	Tells if the normals must be inverted, in the program.
-		 *\return		The found program.
+		 *\param[in]	deferred		Tells if the program initialisation is left to the publication of its pipelines.
+		 *\return		The registered program, the previously registered one if any.
 		 *\~french
 		 *\brief		Ajoute un programme automatiquement généré correspondant aux flags donnés.
 		 *\param[in]	program			Le programme à ajouter.
@@ -240,15 +251,17 @@ namespace castor3d
 		 *\param[in]	sceneFlags		Les indicateurs de la scène (brouillard, ...).
 		 *\param[in]	alphaFunc		La fonction de test alpha.
 		 *\param[in]	invertNormals	Dit si les normales doivent être inversées, dans le programme.
-		 *\return		Le programme trouvé.
+		 *\param[in]	deferred		Dit si l'initialisation du programme est laissée à la publication de ses pipelines.
+		 *\return		Le programme enregistré, celui précédemment enregistré s'il y en a un.
 		 */
-		C3D_API void doAddAutomaticProgram( ShaderProgramSPtr program
+		C3D_API ShaderProgramSPtr doAddAutomaticProgram( ShaderProgramSPtr program
 			, PassFlags const & passFlags
 			, TextureChannels const & textureFlags
 			, ProgramFlags const & programFlags
 			, SceneFlags const & sceneFlags
 			, ComparisonFunc alphaFunc
-			, bool invertNormals );
+			, bool invertNormals
+			, bool deferred );
 		/**
 		 *\~english
 		 *\brief		Creates a shader program for billboards rendering use.
@@ -283,7 +296,8 @@ namespace castor3d
 		 *\param[in]	textureFlags	TextureChannel combination.
 		 *\param[in]	programFlags	ProgramFlag combination.
 		 *\param[in]	alphaFunc		The alpha test function.
-		 *\return		The found program.
+		 *\param[in]	deferred		Tells if the program initialisation is left to the publication of its pipelines.
+		 *\return		The registered program, the previously registered one if any.
 		 *\~french
 		 *\brief		Ajoute un programme de billboards correspondant aux flags donnés.
 		 *\param[in]	program			Le programme à ajouter.
@@ -291,14 +305,16 @@ namespace castor3d
 		 *\param[in]	textureFlags	Une combinaison de TextureChannel.
 		 *\param[in]	programFlags	Une combinaison de ProgramFlag.
 		 *\param[in]	alphaFunc		La fonction de test alpha.
-		 *\return		Le programme trouvé.
+		 *\param[in]	deferred		Dit si l'initialisation du programme est laissée à la publication de ses pipelines.
+		 *\return		Le programme enregistré, celui précédemment enregistré s'il y en a un.
 		 */
-		C3D_API void doAddBillboardProgram( ShaderProgramSPtr program
+		C3D_API ShaderProgramSPtr doAddBillboardProgram( ShaderProgramSPtr program
 			, PassFlags const & passFlags
 			,TextureChannels const & textureFlags
 			, ProgramFlags const & programFlags
 			, SceneFlags const & sceneFlags
-			, ComparisonFunc alphaFunc );
+			, ComparisonFunc alphaFunc
+			, bool deferred );
 
 	private:
 		DECLARE_MAP( uint64_t, ShaderProgramWPtr, ShaderProgramWPtrUInt64 );
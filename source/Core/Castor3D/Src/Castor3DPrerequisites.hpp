@@ -22,6 +22,7 @@ See LICENSE file in root folder
 
 #include <Design/Collection.hpp>
 #include <Design/FlagCombination.hpp>
+#include <Design/Handle.hpp>
 #include <Design/OwnedBy.hpp>
 #include <Math/Point.hpp>
 #include <Graphics/Size.hpp>
@@ -490,9 +491,11 @@ namespace castor3d
 	class TextureAttachment;
 	class FrameBuffer;
 	class BackBuffers;
+	class ReadbackBuffer;
 	class IWindowHandle;
 	class DebugOverlays;
 	class Engine;
+	class HandleRegistries;
 	class Plugin;
 	class RendererPlugin;
 	class ImporterPlugin;
@@ -521,6 +524,7 @@ namespace castor3d
 	DECLARE_SMART_PTR( TextureAttachment );
 	DECLARE_SMART_PTR( FrameBuffer );
 	DECLARE_SMART_PTR( BackBuffers );
+	DECLARE_SMART_PTR( ReadbackBuffer );
 	DECLARE_SMART_PTR( Engine );
 	DECLARE_SMART_PTR( Plugin );
 	DECLARE_SMART_PTR( RendererPlugin );
@@ -19,6 +19,8 @@
 #include <Graphics/Image.hpp>
 #include <Pool/UniqueObjectPool.hpp>
 
+#include <fstream>
+
 using namespace castor;
 
 //*************************************************************************************************
@@ -393,6 +395,42 @@ namespace castor3d
 		m_additionalSections.erase( it );
 	}
 
+	castor::MemoryReport Engine::getMemoryReport()const
+	{
+		return MemoryAccounting::getReport();
+	}
+
+	void Engine::setMemoryReportFile( castor::Path const & file
+		, castor::Milliseconds const & period )
+	{
+		m_memoryReportFile = file;
+		m_memoryReportPeriod = period;
+		m_memoryReportTimer.getElapsed();
+		m_memoryReportTime = Nanoseconds{ 0 };
+		m_memoryReportNext = Nanoseconds{ 0 };
+
+		if ( !m_memoryReportFile.empty()
+			&& string::lowerCase( m_memoryReportFile.getExtension() ) != cuT( "json" ) )
+		{
+			std::ofstream stream{ string::stringCast< char >( m_memoryReportFile ) };
+			MemoryAccounting::writeCsvHeader( stream );
+		}
+	}
+
+	void Engine::updateMemoryReport()
+	{
+		if ( !m_memoryReportFile.empty() )
+		{
+			m_memoryReportTime += m_memoryReportTimer.getElapsed();
+
+			if ( m_memoryReportTime >= m_memoryReportNext )
+			{
+				m_memoryReportNext = m_memoryReportTime + m_memoryReportPeriod;
+				doWriteMemoryReport();
+			}
+		}
+	}
+
 	void Engine::doLoadCoreData()
 	{
 		Path path = Engine::getDataDirectory() / cuT( "Castor3D" );
@@ -407,4 +445,23 @@ namespace castor3d
 			}
 		}
 	}
+
+	void Engine::doWriteMemoryReport()
+	{
+		auto report = MemoryAccounting::getReport();
+		auto time = std::chrono::duration_cast< Milliseconds >( m_memoryReportTime );
+
+		if ( string::lowerCase( m_memoryReportFile.getExtension() ) == cuT( "json" ) )
+		{
+			std::ofstream stream{ string::stringCast< char >( m_memoryReportFile ) };
+			stream << "{\n\t\"time_ms\": " << time.count() << ",\n\t\"subsystems\": ";
+			MemoryAccounting::writeJson( stream, report, "\t\t" );
+			stream << "\n}\n";
+		}
+		else
+		{
+			std::ofstream stream{ string::stringCast< char >( m_memoryReportFile ), std::ios::app };
+			MemoryAccounting::writeCsv( stream, report, time );
+		}
+	}
 }
@@ -5,6 +5,7 @@ See LICENSE file in root folder
 #define ___C3D_ENGINE_H___
 
 #include "Cache/Cache.hpp"
+#include "Cache/HandleRegistries.hpp"
 #include "Cache/ListenerCache.hpp"
 #include "Cache/MaterialCache.hpp"
 #include "Cache/OverlayCache.hpp"
@@ -28,6 +29,8 @@ See LICENSE file in root folder
 #include <Graphics/ImageCache.hpp>
 #include <Design/Unique.hpp>
 #include <Miscellaneous/CpuInformations.hpp>
+#include <Miscellaneous/MemoryAccounting.hpp>
+#include <Miscellaneous/PreciseTimer.hpp>
 
 namespace castor3d
 {
@@ -171,6 +174,36 @@ namespace castor3d
 		 *\param[in]	p_name		Le nom d'enregistrement.
 		 */
 		C3D_API void unregisterSections( castor::String const & p_name );
+		/**
+		 *\~english
+		 *\return		A snapshot of the memory used by each subsystem.
+		 *\~french
+		 *\return		Un instantané de la mémoire utilisée par chaque sous-système.
+		 */
+		C3D_API castor::MemoryReport getMemoryReport()const;
+		/**
+		 *\~english
+		 *\brief		Sets the file into which the memory report is periodically dumped.
+		 *\remarks		A \p .json file is rewritten with the latest report, any other file receives the reports as CSV lines.
+		 *\param[in]	file	The file path, empty to stop the dumps.
+		 *\param[in]	period	The time between two dumps.
+		 *\~french
+		 *\brief		Définit le fichier dans lequel le rapport mémoire est écrit périodiquement.
+		 *\remarks		Un fichier \p .json est réécrit avec le dernier rapport, tout autre fichier reçoit les rapports sous forme de lignes CSV.
+		 *\param[in]	file	Le chemin du fichier, vide pour arrêter les écritures.
+		 *\param[in]	period	Le temps entre deux écritures.
+		 */
+		C3D_API void setMemoryReportFile( castor::Path const & file
+			, castor::Milliseconds const & period );
+		/**
+		 *\~english
+		 *\brief		Dumps the memory report, if the period has elapsed since the last dump.
+		 *\remarks		Called once per frame by the render loop.
+		 *\~french
+		 *\brief		Ecrit le rapport mémoire, si la période s'est écoulée depuis la dernière écriture.
+		 *\remarks		Appelée une fois par image par la boucle de rendu.
+		 */
+		C3D_API void updateMemoryReport();
 		/**
 		 *\~english
 		 *\brief		Retrieves plug-ins path
@@ -368,6 +401,26 @@ namespace castor3d
 		{
 			return *m_renderLoop;
 		}
+		/**
+		 *\~english
+		 *\return		The handle registries.
+		 *\~french
+		 *\return		Les registres de poignées.
+		 */
+		inline HandleRegistries const & getHandles()const
+		{
+			return m_handles;
+		}
+		/**
+		 *\~english
+		 *\return		The handle registries.
+		 *\~french
+		 *\return		Les registres de poignées.
+		 */
+		inline HandleRegistries & getHandles()
+		{
+			return m_handles;
+		}
 		/**
 		 *\~english
 		 *\brief		sets the need for per object lighting.
@@ -525,8 +578,12 @@ namespace castor3d
 
 	private:
 		void doLoadCoreData();
+		void doWriteMemoryReport();
 
 	private:
+		//!\~english	The handle registries, declared first so they outlive the objects registered in them.
+		//!\~french		Les registres de poignées, déclarés en premier afin qu'ils survivent aux objets qui y sont enregistrés.
+		HandleRegistries m_handles;
 		//!\~english	The mutex, to make the engine resources access thread-safe.
 		//!\~french		Le mutex utilisé pour que l'accès aux ressources du moteur soit thread-safe.
 		std::recursive_mutex m_mutexResources;
@@ -623,6 +680,21 @@ namespace castor3d
 		//!\~english	The materials type.
 		//!\~french		Le type des matériaux.
 		MaterialType m_materialType;
+		//!\~english	The memory report file.
+		//!\~french		Le fichier du rapport mémoire.
+		castor::Path m_memoryReportFile;
+		//!\~english	The time between two memory report dumps.
+		//!\~french		Le temps entre deux écritures du rapport mémoire.
+		castor::Milliseconds m_memoryReportPeriod{ 0 };
+		//!\~english	The timer used to dump the memory report.
+		//!\~french		Le timer utilisé pour écrire le rapport mémoire.
+		castor::PreciseTimer m_memoryReportTimer;
+		//!\~english	The time elapsed since the memory report file was set.
+		//!\~french		Le temps écoulé depuis que le fichier du rapport mémoire a été défini.
+		castor::Nanoseconds m_memoryReportTime{ 0 };
+		//!\~english	The time of the next memory report dump.
+		//!\~french		Le temps de la prochaine écriture du rapport mémoire.
+		castor::Nanoseconds m_memoryReportNext{ 0 };
 	};
 }
 
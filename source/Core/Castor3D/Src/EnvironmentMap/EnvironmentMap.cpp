@@ -7,8 +7,11 @@
 #include "FrameBuffer/FrameBuffer.hpp"
 #include "FrameBuffer/RenderBufferAttachment.hpp"
 #include "FrameBuffer/TextureAttachment.hpp"
+#include "Mesh/Mesh.hpp"
 #include "Render/RenderPipeline.hpp"
 #include "Scene/BillboardList.hpp"
+#include "Scene/Geometry.hpp"
+#include "Scene/Scene.hpp"
 #include "Scene/SceneNode.hpp"
 #include "Shader/ShaderProgram.hpp"
 #include "Texture/Sampler.hpp"
@@ -131,10 +134,33 @@ namespace castor3d
 		, m_index{ ++m_count }
 		, m_passes( doCreatePasses( *this, p_node ) )
 	{
+		m_dirtyFaces.fill( true );
+		m_pendingFaces.fill( false );
+		auto & scene = *p_node.getScene();
+		m_onNodeChanged = p_node.onChanged.connect( [this]( SceneNode const & )
+			{
+				m_nodeChanged = true;
+			} );
+		m_onSceneChanged = scene.onChanged.connect( [this]( Scene const & )
+			{
+				m_contentChanged = true;
+			} );
+		m_onNodesChanged = scene.getChanges().onSceneNodesChanged.connect( [this]( std::vector< SceneNode const * > const & nodes )
+			{
+				doOnNodesChanged( nodes );
+			} );
+		m_onMaterialsChanged = scene.getChanges().onMaterialsChanged.connect( [this]( std::vector< Material const * > const & materials )
+			{
+				doOnMaterialsChanged( materials );
+			} );
 	}
 
 	EnvironmentMap::~EnvironmentMap()
 	{
+		m_onMaterialsChanged.disconnect();
+		m_onNodesChanged.disconnect();
+		m_onSceneChanged.disconnect();
+		m_onNodeChanged.disconnect();
 	}
 
 	bool EnvironmentMap::initialise()
@@ -221,23 +247,78 @@ namespace castor3d
 		}
 	}
 	
+	void EnvironmentMap::prepare()
+	{
+		m_pendingFaces.fill( false );
+
+		if ( m_policy == EnvironmentMapUpdate::eOnChange )
+		{
+			if ( m_contentChanged )
+			{
+				doRebuildContent();
+			}
+
+			// Animated meshes change each frame, without their node moving.
+			if ( m_nodeChanged
+				|| m_contentDirty
+				|| m_animatedContent )
+			{
+				m_dirtyFaces.fill( true );
+			}
+		}
+
+		m_nodeChanged = false;
+		m_contentDirty = false;
+	}
+
+	void EnvironmentMap::selectFaces( uint32_t & facesBudget
+		, bool timeSliced )
+	{
+		if ( timeSliced
+			&& m_policy != EnvironmentMapUpdate::eTimeSliced )
+		{
+			return;
+		}
+
+		auto count = uint32_t( m_pendingFaces.size() );
+		uint32_t i = 0u;
+
+		for ( ; i < count && facesBudget > 0u; ++i )
+		{
+			auto face = ( m_nextFace + i ) % count;
+
+			if ( !m_pendingFaces[face]
+				&& ( timeSliced || m_dirtyFaces[face] ) )
+			{
+				m_pendingFaces[face] = true;
+				--facesBudget;
+			}
+		}
+
+		m_nextFace = ( m_nextFace + i ) % count;
+	}
+
 	void EnvironmentMap::update( RenderQueueArray & p_queues )
 	{
+		uint32_t face = 0u;
+
 		for ( auto & pass : m_passes )
 		{
-			pass->update( m_node, p_queues );
+			if ( m_pendingFaces[face++] )
+			{
+				pass->update( m_node, p_queues );
+			}
 		}
 	}
 
-	void EnvironmentMap::render()
+	uint32_t EnvironmentMap::render()
 	{
-		m_render++;
+		uint32_t result = 0u;
+		uint32_t face = 0u;
 
-		if ( m_render == 5u )
+		for ( auto & attach : m_colourAttachs )
 		{
-			uint32_t face = 0u;
-
-			for ( auto & attach : m_colourAttachs )
+			if ( m_pendingFaces[face] )
 			{
 				m_frameBuffer->bind( FrameBufferTarget::eDraw );
 				attach->attach( AttachmentPoint::eColour, 0u );
@@ -245,21 +326,31 @@ namespace castor3d
 				m_frameBuffer->clear( BufferComponent::eDepth | BufferComponent::eColour );
 				m_passes[face]->render();
 				m_frameBuffer->unbind();
-				face++;
+				m_pendingFaces[face] = false;
+				m_dirtyFaces[face] = false;
+				++result;
 			}
 
-			auto & scene = *m_node.getScene();
+			face++;
+		}
 
-			if ( scene.getMaterialsType() == MaterialType::ePbrMetallicRoughness
-				|| scene.getMaterialsType() == MaterialType::ePbrSpecularGlossiness )
-			{
-				m_environmentMap.getTexture()->bind( 0 );
-				m_environmentMap.getTexture()->generateMipmaps();
-				m_environmentMap.getTexture()->unbind( 0 );
-			}
+		auto & scene = *m_node.getScene();
 
-			m_render = 0u;
+		if ( result
+			&& ( scene.getMaterialsType() == MaterialType::ePbrMetallicRoughness
+				|| scene.getMaterialsType() == MaterialType::ePbrSpecularGlossiness ) )
+		{
+			m_environmentMap.getTexture()->bind( 0 );
+			m_environmentMap.getTexture()->generateMipmaps();
+			m_environmentMap.getTexture()->unbind( 0 );
 		}
+
+		return result;
+	}
+
+	void EnvironmentMap::invalidate()
+	{
+		m_dirtyFaces.fill( true );
 	}
 
 	void EnvironmentMap::debugDisplay( castor::Size const & size, uint32_t index )
@@ -270,4 +361,121 @@ namespace castor3d
 			, displaySize
 			, *m_environmentMap.getTexture() );
 	}
+
+	bool EnvironmentMap::doIsInside( Geometry const & geometry )const
+	{
+		auto node = geometry.getParent();
+		bool result = false;
+
+		if ( node
+			&& node.get() != &m_node
+			&& geometry.getMesh() )
+		{
+			auto scale = node->getDerivedScale();
+			auto & sphere = geometry.getBoundingSphere();
+			auto extent = real( sphere.getRadius() + point::length( sphere.getCenter() ) )
+				* std::max( std::abs( scale[0] ), std::max( std::abs( scale[1] ), std::abs( scale[2] ) ) );
+			result = point::length( node->getDerivedPosition() - m_node.getDerivedPosition() ) - extent <= m_radius;
+		}
+
+		return result;
+	}
+
+	bool EnvironmentMap::doIsInside( SceneNode const & node )const
+	{
+		bool result = false;
+
+		for ( auto & object : node.getObjects() )
+		{
+			if ( object.get().getType() == MovableType::eGeometry )
+			{
+				result = result
+					|| doIsInside( static_cast< Geometry const & >( object.get() ) );
+			}
+		}
+
+		return result;
+	}
+
+	void EnvironmentMap::doRebuildContent()
+	{
+		auto & scene = *m_node.getScene();
+		m_content.clear();
+		m_contentNodes.clear();
+		m_animatedContent = false;
+
+		{
+			auto geometries = scene.getGeometryCache().getSnapshot();
+
+			for ( auto & geometry : *geometries )
+			{
+				if ( doIsInside( *geometry.second ) )
+				{
+					auto mesh = geometry.second->getMesh();
+					m_content.push_back( geometry.second.get() );
+					m_contentNodes.insert( geometry.second->getParent().get() );
+					m_animatedContent = m_animatedContent
+						|| mesh->getSkeleton()
+						|| !mesh->getAnimations().empty();
+				}
+			}
+		}
+
+		m_contentChanged = false;
+		m_contentDirty = true;
+	}
+
+	void EnvironmentMap::doOnNodesChanged( std::vector< SceneNode const * > const & nodes )
+	{
+		// A pending rebuild will check the whole content anyway.
+		if ( m_policy != EnvironmentMapUpdate::eOnChange
+			|| m_contentChanged )
+		{
+			return;
+		}
+
+		for ( auto node : nodes )
+		{
+			if ( node != &m_node )
+			{
+				bool wasInside = m_contentNodes.find( node ) != m_contentNodes.end();
+				bool isInside = doIsInside( *node );
+
+				if ( wasInside != isInside )
+				{
+					// A geometry entered or left the probe volume.
+					m_contentChanged = true;
+				}
+				else if ( isInside )
+				{
+					m_contentDirty = true;
+				}
+			}
+		}
+	}
+
+	void EnvironmentMap::doOnMaterialsChanged( std::vector< Material const * > const & materials )
+	{
+		if ( m_policy != EnvironmentMapUpdate::eOnChange
+			|| m_contentChanged
+			|| m_contentDirty )
+		{
+			return;
+		}
+
+		for ( auto geometry : m_content )
+		{
+			for ( auto & submesh : *geometry->getMesh() )
+			{
+				auto material = geometry->getMaterial( *submesh );
+
+				if ( material
+					&& std::find( materials.begin(), materials.end(), material.get() ) != materials.end() )
+				{
+					m_contentDirty = true;
+					return;
+				}
+			}
+		}
+	}
 }
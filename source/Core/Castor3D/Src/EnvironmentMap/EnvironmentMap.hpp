@@ -5,6 +5,7 @@ See LICENSE file in root folder
 #define ___C3D_EnvironmentMap_H___
 
 #include "PBR/IblTextures.hpp"
+#include "Scene/ChangeJournal.hpp"
 #include "Scene/SceneNode.hpp"
 #include "Texture/TextureLayout.hpp"
 #include "Texture/TextureUnit.hpp"
@@ -68,22 +69,97 @@ namespace castor3d
 		C3D_API void cleanup();
 		/**
 		 *\~english
-		 *\brief		Updates the passes.
-		 *\remarks		Gather the render queues, for further update.
+		 *\brief		Clears the previous frame selection, and marks the faces dirty if the probe or its content changed.
+		 *\~french
+		 *\brief		Vide la sélection de la frame précédente, et invalide les faces si la sonde ou son contenu ont changé.
+		 */
+		C3D_API void prepare();
+		/**
+		 *\~english
+		 *\brief		Selects faces to render this frame, taking them from the budget.
+		 *\remarks		The dirty faces are selected first, for all the maps, then the time sliced maps take what remains.
+		 *\param[in,out]	facesBudget	The remaining faces budget, shared by all the maps, decremented by the selected faces.
+		 *\param[in]		timeSliced	\p false to select the dirty faces, \p true to select the faces refreshed by EnvironmentMapUpdate::eTimeSliced.
+		 *\~french
+		 *\brief		Sélectionne des faces à dessiner pour cette frame, en les prenant du budget.
+		 *\remarks		Les faces invalidées sont sélectionnées en premier, pour toutes les textures, puis les textures découpées dans le temps prennent ce qui reste.
+		 *\param[in,out]	facesBudget	Le budget de faces restant, partagé par toutes les textures, décrémenté des faces sélectionnées.
+		 *\param[in]		timeSliced	\p false pour sélectionner les faces invalidées, \p true pour sélectionner les faces rafraîchies par EnvironmentMapUpdate::eTimeSliced.
+		 */
+		C3D_API void selectFaces( uint32_t & facesBudget
+			, bool timeSliced );
+		/**
+		 *\~english
+		 *\brief		Updates the passes of the selected faces.
+		 *\remarks		Gather the render queues of the selected faces only, for further update.
 		 *\param[out]	p_queues	Receives the render queues needed for the rendering of the frame.
 		 *\~french
-		 *\brief		Met à jour les passes.
-		 *\remarks		Récupère les files de rendu, pour mise à jour ultérieure.
+		 *\brief		Met à jour les passes des faces sélectionnées.
+		 *\remarks		Récupère les files de rendu des faces sélectionnées uniquement, pour mise à jour ultérieure.
 		 *\param[out]	p_queues	Reçoit les files de rendu nécessaires pour le dessin de la frame.
 		 */
 		C3D_API void update( RenderQueueArray & p_queues );
 		/**
 		 *\~english
-		 *\brief		Renders the environment map.
+		 *\brief		Renders the faces selected by the last update.
+		 *\return		The rendered faces count.
+		 *\~french
+		 *\brief		Dessine les faces sélectionnées par la dernière mise à jour.
+		 *\return		Le nombre de faces dessinées.
+		 */
+		C3D_API uint32_t render();
+		/**
+		 *\~english
+		 *\brief		Invalidates all the faces, they will be rendered again whatever the policy.
+		 *\~french
+		 *\brief		Invalide toutes les faces, elles seront dessinées à nouveau quelle que soit la politique.
+		 */
+		C3D_API void invalidate();
+		/**
+		 *\~english
+		 *\brief		Sets the update policy.
+		 *\param[in]	policy	The new value.
+		 *\~french
+		 *\brief		Définit la politique de mise à jour.
+		 *\param[in]	policy	La nouvelle valeur.
+		 */
+		inline void setUpdatePolicy( EnvironmentMapUpdate policy )
+		{
+			m_policy = policy;
+			m_contentChanged = true;
+		}
+		/**
+		 *\~english
+		 *\return		The update policy.
+		 *\~french
+		 *\return		La politique de mise à jour.
+		 */
+		inline EnvironmentMapUpdate getUpdatePolicy()const
+		{
+			return m_policy;
+		}
+		/**
+		 *\~english
+		 *\brief		Sets the probe radius, the scene changes inside it trigger an update, for EnvironmentMapUpdate::eOnChange.
+		 *\param[in]	radius	The new value.
+		 *\~french
+		 *\brief		Définit le rayon de la sonde, les changements de la scène à l'intérieur déclenchent une mise à jour, pour EnvironmentMapUpdate::eOnChange.
+		 *\param[in]	radius	La nouvelle valeur.
+		 */
+		inline void setRadius( float radius )
+		{
+			m_radius = radius;
+		}
+		/**
+		 *\~english
+		 *\return		The probe radius.
 		 *\~french
-		 *\brief		Dessine la texture d'environnement.
+		 *\return		Le rayon de la sonde.
 		 */
-		C3D_API void render();
+		inline float getRadius()const
+		{
+			return m_radius;
+		}
 		/**
 		 *\~english
 		 *\brief		Dumps the environment map on screen.
@@ -136,6 +212,51 @@ namespace castor3d
 			return m_index;
 		}
 
+	private:
+		/**
+		 *\~english
+		 *\brief		Tells if a geometry is inside the probe radius.
+		 *\param[in]	geometry	The geometry.
+		 *\~french
+		 *\brief		Dit si une géométrie est dans le rayon de la sonde.
+		 *\param[in]	geometry	La géométrie.
+		 */
+		bool doIsInside( Geometry const & geometry )const;
+		/**
+		 *\~english
+		 *\brief		Tells if one of the geometries attached to a node is inside the probe radius.
+		 *\param[in]	node	The scene node.
+		 *\~french
+		 *\brief		Dit si l'une des géométries attachées à un noeud est dans le rayon de la sonde.
+		 *\param[in]	node	Le noeud de scène.
+		 */
+		bool doIsInside( SceneNode const & node )const;
+		/**
+		 *\~english
+		 *\brief		Lists the geometries inside the probe radius, after a change of the scene content.
+		 *\~french
+		 *\brief		Liste les géométries dans le rayon de la sonde, après un changement du contenu de la scène.
+		 */
+		void doRebuildContent();
+		/**
+		 *\~english
+		 *\brief		Checks the scene nodes changed during the frame against the probe volume.
+		 *\param[in]	nodes	The changed nodes.
+		 *\~french
+		 *\brief		Compare les noeuds de scène modifiés pendant la frame au volume de la sonde.
+		 *\param[in]	nodes	Les noeuds modifiés.
+		 */
+		void doOnNodesChanged( std::vector< SceneNode const * > const & nodes );
+		/**
+		 *\~english
+		 *\brief		Checks if the materials changed during the frame are used inside the probe volume.
+		 *\param[in]	materials	The changed materials.
+		 *\~french
+		 *\brief		Vérifie si les matériaux modifiés pendant la frame sont utilisés dans le volume de la sonde.
+		 *\param[in]	materials	Les matériaux modifiés.
+		 */
+		void doOnMaterialsChanged( std::vector< Material const * > const & materials );
+
 	private:
 		//!\~english	The target size.
 		//!\~french		Les dimensions de la cible.
@@ -161,6 +282,15 @@ namespace castor3d
 		//!\~english	The connection to node changed signal.
 		//!\~french		La connexion au signal de changement du noeud.
 		OnSceneNodeChangedConnection m_onNodeChanged;
+		//!\~english	The connection to the scene content changes.
+		//!\~french		La connexion aux changements du contenu de la scène.
+		OnSceneChangedConnection m_onSceneChanged;
+		//!\~english	The connection to the scene nodes changed during the frame, from the scene changes journal.
+		//!\~french		La connexion aux noeuds de scène modifiés pendant la frame, depuis le journal des changements de la scène.
+		OnSceneNodesChangedConnection m_onNodesChanged;
+		//!\~english	The connection to the materials changed during the frame, from the scene changes journal.
+		//!\~french		La connexion aux matériaux modifiés pendant la frame, depuis le journal des changements de la scène.
+		OnMaterialsChangedConnection m_onMaterialsChanged;
 		//!\~english	The view matrices for the render of each cube face.
 		//!\~french		Les matrices vue pour le dessin de chaque face du cube.
 		CubeMatrices m_matrices;
@@ -173,9 +303,39 @@ namespace castor3d
 		//!\~english	The render pass for each cube face.
 		//!\~french		La passe de rendu pour chaque face du cube.
 		EnvironmentMapPasses m_passes;
-		//!\~english	The render call count (1 of 5 triggers an actual render).
-		//!\~french		Le nombre d'appels à la fonction de rendu (1 sur 5 effectue réellement un rendu).
-		uint32_t m_render = 0u;
+		//!\~english	The update policy.
+		//!\~french		La politique de mise à jour.
+		EnvironmentMapUpdate m_policy{ EnvironmentMapUpdate::eTimeSliced };
+		//!\~english	The probe radius.
+		//!\~french		Le rayon de la sonde.
+		float m_radius{ 1000.0f };
+		//!\~english	The faces needing a render, whatever the policy.
+		//!\~french		Les faces ayant besoin d'un dessin, quelle que soit la politique.
+		std::array< bool, size_t( CubeMapFace::eCount ) > m_dirtyFaces;
+		//!\~english	The faces selected for the current frame.
+		//!\~french		Les faces sélectionnées pour la frame courante.
+		std::array< bool, size_t( CubeMapFace::eCount ) > m_pendingFaces;
+		//!\~english	The next face to consider for selection, so the faces left out by the budget come first next frame.
+		//!\~french		La prochaine face à considérer pour la sélection, afin que les faces écartées par le budget passent en premier à la frame suivante.
+		uint32_t m_nextFace{ 0u };
+		//!\~english	Tells if the probe node changed since the last update.
+		//!\~french		Dit si le noeud de la sonde a changé depuis la dernière mise à jour.
+		bool m_nodeChanged{ true };
+		//!\~english	Tells if the scene content changed, so the probe content must be listed again.
+		//!\~french		Dit si le contenu de la scène a changé, et donc si le contenu de la sonde doit être listé à nouveau.
+		bool m_contentChanged{ true };
+		//!\~english	Tells if a geometry inside the probe radius moved or had its material changed, since the last update.
+		//!\~french		Dit si une géométrie dans le rayon de la sonde a bougé ou a vu son matériau changer, depuis la dernière mise à jour.
+		bool m_contentDirty{ false };
+		//!\~english	Tells if a geometry inside the probe radius is animated.
+		//!\~french		Dit si une géométrie dans le rayon de la sonde est animée.
+		bool m_animatedContent{ false };
+		//!\~english	The geometries inside the probe radius.
+		//!\~french		Les géométries dans le rayon de la sonde.
+		std::vector< Geometry const * > m_content;
+		//!\~english	The nodes of the geometries inside the probe radius.
+		//!\~french		Les noeuds des géométries dans le rayon de la sonde.
+		std::set< SceneNode const * > m_contentNodes;
 	};
 }
 
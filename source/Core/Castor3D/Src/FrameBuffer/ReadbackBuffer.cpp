@@ -0,0 +1,56 @@
+#include "ReadbackBuffer.hpp"
+
+#include <Graphics/PixelBufferBase.hpp>
+
+using namespace castor;
+
+namespace castor3d
+{
+	ReadbackBuffer::ReadbackBuffer( RenderSystem & renderSystem
+		, PixelFormat format
+		, Size const & size )
+		: OwnedBy< RenderSystem >( renderSystem )
+		, m_format{ format }
+		, m_size{ size }
+	{
+	}
+
+	ReadbackBuffer::~ReadbackBuffer()
+	{
+	}
+
+	bool ReadbackBuffer::initialise()
+	{
+		m_pending = false;
+		return doInitialise();
+	}
+
+	void ReadbackBuffer::cleanup()
+	{
+		m_pending = false;
+		doCleanup();
+	}
+
+	void ReadbackBuffer::readback( FrameBuffer const & frameBuffer
+		, AttachmentPoint point
+		, uint8_t index )
+	{
+		doReadback( frameBuffer, point, index );
+		m_pending = true;
+	}
+
+	bool ReadbackBuffer::download( PxBufferBase & buffer )
+	{
+		bool result = m_pending;
+
+		if ( result )
+		{
+			REQUIRE( buffer.format() == m_format );
+			REQUIRE( buffer.dimensions() == m_size );
+			doDownload( buffer );
+			m_pending = false;
+		}
+
+		return result;
+	}
+}
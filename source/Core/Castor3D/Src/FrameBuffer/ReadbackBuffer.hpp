@@ -0,0 +1,169 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_READBACK_BUFFER_H___
+#define ___C3D_READBACK_BUFFER_H___
+
+#include "Castor3DPrerequisites.hpp"
+
+namespace castor3d
+{
+	/*!
+	\author 	Sylvain DOREMUS
+	\date		15/01/2018
+	\version	0.10.0
+	\~english
+	\brief		GPU side buffer receiving a frame buffer attachment's content, without waiting for the end of the transfer.
+	\remarks	The transfer is started by readback, and its result is retrieved later by download,
+				which only waits if the transfer is not over yet.
+	\~french
+	\brief		Tampon côté GPU recevant le contenu d'une attache de tampon d'image, sans attendre la fin du transfert.
+	\remarks	Le transfert est démarré par readback, et son résultat est récupéré plus tard par download,
+				qui n'attend que si le transfert n'est pas encore terminé.
+	*/
+	class ReadbackBuffer
+		: public castor::OwnedBy< RenderSystem >
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	renderSystem	The RenderSystem.
+		 *\param[in]	format			The pixels format.
+		 *\param[in]	size			The pixels dimensions.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	renderSystem	Le RenderSystem.
+		 *\param[in]	format			Le format des pixels.
+		 *\param[in]	size			Les dimensions en pixels.
+		 */
+		C3D_API ReadbackBuffer( RenderSystem & renderSystem
+			, castor::PixelFormat format
+			, castor::Size const & size );
+		/**
+		 *\~english
+		 *\brief		Destructor.
+		 *\~french
+		 *\brief		Destructeur.
+		 */
+		C3D_API virtual ~ReadbackBuffer();
+		/**
+		 *\~english
+		 *\brief		Creates the buffer on GPU.
+		 *\return		\p true if everything is OK.
+		 *\~french
+		 *\brief		Crée le tampon sur le GPU.
+		 *\return		\p true si tout s'est bien passé.
+		 */
+		C3D_API bool initialise();
+		/**
+		 *\~english
+		 *\brief		Destroys the buffer on GPU.
+		 *\~french
+		 *\brief		Détruit le tampon sur le GPU.
+		 */
+		C3D_API void cleanup();
+		/**
+		 *\~english
+		 *\brief		Starts the transfer of a frame buffer attachment's content into this buffer.
+		 *\param[in]	frameBuffer	The frame buffer.
+		 *\param[in]	point		The attachment point.
+		 *\param[in]	index		The attachment index.
+		 *\~french
+		 *\brief		Démarre le transfert du contenu d'une attache d'un tampon d'image dans ce tampon.
+		 *\param[in]	frameBuffer	Le tampon d'image.
+		 *\param[in]	point		Le point d'attache.
+		 *\param[in]	index		L'index d'attache.
+		 */
+		C3D_API void readback( FrameBuffer const & frameBuffer
+			, AttachmentPoint point
+			, uint8_t index );
+		/**
+		 *\~english
+		 *\brief		Retrieves the result of the last transfer, waiting for its end if needed.
+		 *\param[out]	buffer	Receives the pixels, must have this buffer's format and dimensions.
+		 *\return		\p false if no transfer was started.
+		 *\~french
+		 *\brief		Récupère le résultat du dernier transfert, en attendant sa fin si nécessaire.
+		 *\param[out]	buffer	Reçoit les pixels, doit avoir le format et les dimensions de ce tampon.
+		 *\return		\p false si aucun transfert n'a été démarré.
+		 */
+		C3D_API bool download( castor::PxBufferBase & buffer );
+		/**
+		 *\~english
+		 *\return		\p true if a transfer was started and its result has not been downloaded yet.
+		 *\~french
+		 *\return		\p true si un transfert a été démarré et son résultat n'a pas encore été récupéré.
+		 */
+		inline bool isPending()const
+		{
+			return m_pending;
+		}
+		/**
+		 *\~english
+		 *\return		The pixels format.
+		 *\~french
+		 *\return		Le format des pixels.
+		 */
+		inline castor::PixelFormat getPixelFormat()const
+		{
+			return m_format;
+		}
+		/**
+		 *\~english
+		 *\return		The pixels dimensions.
+		 *\~french
+		 *\return		Les dimensions en pixels.
+		 */
+		inline castor::Size const & getDimensions()const
+		{
+			return m_size;
+		}
+
+	protected:
+		/**
+		 *\~english
+		 *\brief		Creates the buffer on GPU.
+		 *\return		\p true if everything is OK.
+		 *\~french
+		 *\brief		Crée le tampon sur le GPU.
+		 *\return		\p true si tout s'est bien passé.
+		 */
+		C3D_API virtual bool doInitialise() = 0;
+		/**
+		 *\~english
+		 *\brief		Destroys the buffer on GPU.
+		 *\~french
+		 *\brief		Détruit le tampon sur le GPU.
+		 */
+		C3D_API virtual void doCleanup() = 0;
+		/**
+		 *\copydoc		castor3d::ReadbackBuffer::readback
+		 */
+		C3D_API virtual void doReadback( FrameBuffer const & frameBuffer
+			, AttachmentPoint point
+			, uint8_t index ) = 0;
+		/**
+		 *\~english
+		 *\brief		Retrieves the result of the last transfer, waiting for its end if needed.
+		 *\param[out]	buffer	Receives the pixels.
+		 *\~french
+		 *\brief		Récupère le résultat du dernier transfert, en attendant sa fin si nécessaire.
+		 *\param[out]	buffer	Reçoit les pixels.
+		 */
+		C3D_API virtual void doDownload( castor::PxBufferBase & buffer ) = 0;
+
+	protected:
+		//!\~english	The pixels format.
+		//!\~french		Le format des pixels.
+		castor::PixelFormat m_format;
+		//!\~english	The pixels dimensions.
+		//!\~french		Les dimensions en pixels.
+		castor::Size m_size;
+		//!\~english	Tells if a transfer was started and not downloaded yet.
+		//!\~french		Dit si un transfert a été démarré et pas encore récupéré.
+		bool m_pending{ false };
+	};
+}
+
+#endif
@@ -1,9 +1,12 @@
 ﻿#include "Material.hpp"
 
+#include "Engine.hpp"
+
 #include "LegacyPass.hpp"
 #include "MetallicRoughnessPbrPass.hpp"
 #include "SpecularGlossinessPbrPass.hpp"
 
+#include "Miscellaneous/ReferenceCounter.hpp"
 #include "Scene/SceneFileParser.hpp"
 
 using namespace castor;
@@ -72,10 +75,12 @@ namespace castor3d
 		, OwnedBy< Engine >( engine )
 		, m_type{ type }
 	{
+		m_handle = engine.getHandles().add( *this );
 	}
 
 	Material::~Material()
 	{
+		getEngine()->getHandles().remove( m_handle );
 	}
 
 	void Material::initialise()
@@ -143,6 +148,7 @@ namespace castor3d
 	PassSPtr Material::getPass( uint32_t index )const
 	{
 		REQUIRE( index < m_passes.size() );
+		C3D_CountReference();
 		return m_passes[index];
 	}
 
@@ -295,6 +295,16 @@ namespace castor3d
 			REQUIRE( m_type == Type );
 			return std::static_pointer_cast< typename PassTyper< Type >::Type >( pass );
 		}
+		/**
+		 *\~english
+		 *\return		The handle to the material.
+		 *\~french
+		 *\return		La poignée vers le matériau.
+		 */
+		inline MaterialHandle const & getHandle()const
+		{
+			return m_handle;
+		}
 
 	private:
 		void onPassChanged( Pass const & pass );
@@ -317,6 +327,9 @@ namespace castor3d
 		//!\~english	The connections to the pass changed signals.
 		//!\~french		Les connections aux signaux de passe changée.
 		std::map< PassSPtr, OnPassChangedConnection > m_passListeners;
+		//!\~english	The handle to the material.
+		//!\~french		La poignée vers le matériau.
+		MaterialHandle m_handle;
 	};
 }
 
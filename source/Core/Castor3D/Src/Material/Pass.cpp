@@ -170,12 +170,15 @@ namespace castor3d
 
 	Pass::Pass( Material & parent )
 		: OwnedBy< Material >{ parent }
+		, m_handles{ parent.getEngine()->getHandles() }
 	{
+		m_handle = m_handles.add( *this );
 	}
 
 	Pass::~Pass()
 	{
 		m_textureUnits.clear();
+		m_handles.remove( m_handle );
 	}
 
 	void Pass::initialise()
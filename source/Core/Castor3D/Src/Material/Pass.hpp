@@ -541,6 +541,16 @@ namespace castor3d
 			REQUIRE( m_subsurfaceScattering );
 			return *m_subsurfaceScattering;
 		}
+		/**
+		 *\~english
+		 *\return		The handle to the pass.
+		 *\~french
+		 *\return		La poignée vers la passe.
+		 */
+		inline PassHandle const & getHandle()const
+		{
+			return m_handle;
+		}
 
 	protected:
 		/**
@@ -628,6 +638,12 @@ namespace castor3d
 		//!\~english	Texture units.
 		//!\~french		Les textures.
 		TextureUnitPtrArray m_textureUnits;
+		//!\~english	The engine's handles registries.
+		//!\~french		Les registres de poignées du moteur.
+		HandleRegistries & m_handles;
+		//!\~english	The handle to the pass.
+		//!\~french		La poignée vers la passe.
+		PassHandle m_handle;
 		//!\~english	Bitwise ORed TextureChannel.
 		//!\~french		Combinaison des TextureChannel affectés à une texture pour cette passe.
 		TextureChannels m_textureFlags;
@@ -38,7 +38,7 @@ namespace castor3d
 		 */
 		inline explicit CpuBuffer( Engine & engine )
 			: castor::OwnedBy< Engine >( engine )
-
+			, m_memory{ doGetMemoryTag() }
 		{
 		}
 		/**
@@ -270,6 +270,7 @@ namespace castor3d
 		inline void addElement( T const & value )
 		{
 			m_data.push_back( value );
+			m_memory.setCpuSize( m_data.capacity() * sizeof( T ) );
 		}
 		/**
 		 *\~english
@@ -302,6 +303,7 @@ namespace castor3d
 		inline void resize( uint32_t value )
 		{
 			m_data.resize( value, T{} );
+			m_memory.setCpuSize( m_data.capacity() * sizeof( T ) );
 		}
 		/**
 		 *\~english
@@ -312,6 +314,7 @@ namespace castor3d
 		inline void clear()
 		{
 			m_data.clear();
+			m_memory.setCpuSize( m_data.capacity() * sizeof( T ) );
 		}
 		/**
 		 *\~english
@@ -384,6 +387,13 @@ namespace castor3d
 			return m_offset;
 		}
 
+	private:
+		static inline castor::MemoryTag & doGetMemoryTag()
+		{
+			static castor::MemoryTag & tag = castor::MemoryAccounting::getTag( cuT( "Geometry buffers" ) );
+			return tag;
+		}
+
 	protected:
 		inline void doInitialise( BufferAccessType accessType
 			, BufferAccessNature accessNature )
@@ -411,6 +421,11 @@ namespace castor3d
 		//!<\~english	Buffer access nature.
 		//!\~french		Nature d'accès du tampon.
 		BufferAccessNature m_accessNature{ BufferAccessNature( 0u ) };
+
+	private:
+		//!<\~english	Accounts for the buffer data.
+		//!\~french		Comptabilise les données du tampon.
+		castor::MemoryUsage m_memory;
 	};
 }
 
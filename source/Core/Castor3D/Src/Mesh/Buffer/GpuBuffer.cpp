@@ -4,8 +4,18 @@ using namespace castor;
 
 namespace castor3d
 {
+	namespace
+	{
+		MemoryTag & doGetMemoryTag()
+		{
+			static MemoryTag & tag = MemoryAccounting::getTag( cuT( "GPU buffers" ) );
+			return tag;
+		}
+	}
+
 	GpuBuffer::GpuBuffer( RenderSystem & renderSystem )
 		: OwnedBy< RenderSystem >( renderSystem )
+		, m_memory{ doGetMemoryTag() }
 	{
 	}
 
@@ -19,7 +29,7 @@ namespace castor3d
 		, BufferAccessNature nature )
 	{
 		m_allocator = std::make_unique< GpuBufferAllocator >( level, minBlockSize );
-		doInitialiseStorage( uint32_t( m_allocator->getSize() )
+		doAllocateStorage( uint32_t( m_allocator->getSize() )
 			, type
 			, nature );
 	}
@@ -38,4 +48,12 @@ namespace castor3d
 	{
 		m_allocator->deallocate( offset );
 	}
+
+	void GpuBuffer::doAllocateStorage( uint32_t size
+		, BufferAccessType type
+		, BufferAccessNature nature )
+	{
+		doInitialiseStorage( size, type, nature );
+		m_memory.setGpuSize( size );
+	}
 }
@@ -7,6 +7,7 @@ See LICENSE file in root folder
 #include "Castor3DPrerequisites.hpp"
 
 #include <Design/OwnedBy.hpp>
+#include <Miscellaneous/MemoryAccounting.hpp>
 #include <Pool/BuddyAllocator.hpp>
 
 #include <cstddef>
@@ -317,6 +318,21 @@ namespace castor3d
 			, uint8_t * buffer )const = 0;
 
 	private:
+		/**
+		 *\~english
+		 *\brief		Initialises the GPU buffer storage, and accounts for it.
+		 *\param[in]	size	The buffer size.
+		 *\param[in]	type	Buffer access type.
+		 *\param[in]	nature	Buffer access nature.
+		 *\~french
+		 *\brief		Initialise le stockage GPU du tampon, et le comptabilise.
+		 *\param[in]	size	La taille du tampon.
+		 *\param[in]	type	Type d'accès du tampon.
+		 *\param[in]	nature	Nature d'accès du tampon.
+		 */
+		C3D_API void doAllocateStorage( uint32_t size
+			, BufferAccessType type
+			, BufferAccessNature nature );
 		/**
 		 *\~english
 		 *\brief		Initialises the GPU buffer storage.
@@ -335,6 +351,7 @@ namespace castor3d
 
 	private:
 		GpuBufferAllocatorUPtr m_allocator;
+		castor::MemoryUsage m_memory;
 	};
 }
 
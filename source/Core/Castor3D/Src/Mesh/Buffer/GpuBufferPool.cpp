@@ -52,7 +52,7 @@ namespace castor3d
 		{
 			result.buffer = getRenderSystem()->doCreateBuffer( type );
 			result.buffer->create();
-			result.buffer->doInitialiseStorage( size
+			result.buffer->doAllocateStorage( size
 				, accessType
 				, accessNature );
 			result.offset = 0u;
@@ -6,6 +6,8 @@
 #include "Mesh/Skeleton/Skeleton.hpp"
 #include "Scene/Scene.hpp"
 
+#include <Data/VirtualFileSystem.hpp>
+
 using namespace castor;
 
 namespace castor3d
@@ -32,7 +34,7 @@ namespace castor3d
 		BinaryFile file{ m_fileName, File::OpenMode::eRead };
 		auto result = BinaryParser< Mesh >{}.parse( mesh, file );
 
-		if ( result && File::fileExists( m_fileName.getPath() / ( m_fileName.getFileName() + cuT( ".cskl" ) ) ) )
+		if ( result && VirtualFileSystem::fileExists( m_fileName.getPath() / ( m_fileName.getFileName() + cuT( ".cskl" ) ) ) )
 		{
 			auto skeleton = std::make_shared< Skeleton >( *mesh.getScene() );
 			BinaryFile file{ m_fileName.getPath() / ( m_fileName.getFileName() + cuT( ".cskl" ) )
@@ -14,6 +14,8 @@
 #include "Texture/TextureImage.hpp"
 #include "Texture/TextureLayout.hpp"
 
+#include <Data/VirtualFileSystem.hpp>
+
 using namespace castor;
 
 namespace castor3d
@@ -118,11 +120,11 @@ namespace castor3d
 		Path relative;
 		Path folder;
 
-		if ( File::fileExists( path ) )
+		if ( VirtualFileSystem::fileExists( path ) )
 		{
 			relative = path;
 		}
-		else if ( File::fileExists( m_filePath / path ) )
+		else if ( VirtualFileSystem::fileExists( m_filePath / path ) )
 		{
 			auto fullPath = m_filePath / path;
 			folder = fullPath.getPath();
@@ -132,7 +134,7 @@ namespace castor3d
 		{
 			PathArray files;
 			String fileName = path.getFileName( true );
-			File::listDirectoryFiles( m_filePath, files, true );
+			VirtualFileSystem::listDirectoryFiles( m_filePath, files, true );
 			auto it = std::find_if( files.begin()
 				, files.end()
 				, [&fileName]( Path const & p_file )
@@ -154,7 +156,7 @@ namespace castor3d
 			}
 		}
 
-		if ( File::fileExists( folder / relative ) )
+		if ( VirtualFileSystem::fileExists( folder / relative ) )
 		{
 			try
 			{
@@ -1,10 +1,12 @@
 #include "Mesh.hpp"
 
 #include "Engine.hpp"
+#include "Scene/Scene.hpp"
 
 #include "Animation/Mesh/MeshAnimation.hpp"
 #include "Mesh/Submesh.hpp"
 #include "Mesh/Skeleton/Skeleton.hpp"
+#include "Miscellaneous/ReferenceCounter.hpp"
 
 using namespace castor;
 
@@ -127,12 +129,15 @@ namespace castor3d
 		: Resource< Mesh >{ p_name }
 		, Animable{ p_scene }
 		, m_modified{ false }
+		, m_handles{ p_scene.getEngine()->getHandles() }
 	{
+		m_handle = m_handles.add( *this );
 	}
 
 	Mesh::~Mesh()
 	{
 		cleanup();
+		m_handles.remove( m_handle );
 	}
 
 	void Mesh::cleanup()
@@ -198,6 +203,7 @@ namespace castor3d
 
 	SubmeshSPtr Mesh::getSubmesh( uint32_t p_index )const
 	{
+		C3D_CountReference();
 		SubmeshSPtr result;
 
 		if ( p_index < m_submeshes.size() )
@@ -330,6 +330,16 @@ namespace castor3d
 		{
 			m_serialisable = value;
 		}
+		/**
+		 *\~english
+		 *\return		The handle to the mesh.
+		 *\~french
+		 *\return		La poignée vers le maillage.
+		 */
+		inline MeshHandle const & getHandle()const
+		{
+			return m_handle;
+		}
 
 	protected:
 		friend class MeshGenerator;
@@ -352,6 +362,12 @@ namespace castor3d
 		//!\~english	Tells that the mesh is serialisable.
 		//!\~french		Dit que le maillage est sérialisable.
 		bool m_serialisable{ true };
+		//!\~english	The handles registries, the scene may be gone when the mesh is destroyed.
+		//!\~french		Les registres de poignées, la scène peut avoir disparu quand le maillage est détruit.
+		HandleRegistries & m_handles;
+		//!\~english	The handle to the mesh.
+		//!\~french		La poignée vers le maillage.
+		MeshHandle m_handle;
 
 		friend class BinaryWriter< Mesh >;
 		friend class BinaryParser< Mesh >;
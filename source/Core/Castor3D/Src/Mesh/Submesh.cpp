@@ -217,6 +217,7 @@ namespace castor3d
 		: OwnedBy< Scene >( scene )
 		, m_defaultMaterial( scene.getEngine()->getMaterialCache().getDefaultMaterial() )
 		, m_id( id )
+		, m_handles{ scene.getEngine()->getHandles() }
 		, m_parentMesh( mesh )
 		, m_vertexBuffer
 		{
@@ -234,12 +235,14 @@ namespace castor3d
 		}
 		, m_indexBuffer{ *scene.getEngine() }
 	{
+		m_handle = m_handles.add( *this );
 		addComponent( std::make_shared< InstantiationComponent >( *this ) );
 	}
 
 	Submesh::~Submesh()
 	{
 		cleanup();
+		m_handles.remove( m_handle );
 	}
 
 	void Submesh::initialise()
@@ -514,6 +514,13 @@ namespace castor3d
 		 *\param[in]	value	La nouvelle valeur.
 		 */
 		inline void setTopology( Topology value );
+		/**
+		 *\~english
+		 *\return		The handle to the submesh.
+		 *\~french
+		 *\return		La poignée vers le sous-maillage.
+		 */
+		inline SubmeshHandle const & getHandle()const;
 
 	private:
 		void doGenerateVertexBuffer();
@@ -522,6 +529,12 @@ namespace castor3d
 		//!\~english	The submesh ID.
 		//!\~french		L'id du sbmesh.
 		uint32_t m_id{ 0 };
+		//!\~english	The registries the submesh handle is removed from, on destruction.
+		//!\~french		Les registres desquels la poignée du sous-maillage est retirée, à la destruction.
+		HandleRegistries & m_handles;
+		//!\~english	The handle to the submesh.
+		//!\~french		La poignée vers le sous-maillage.
+		SubmeshHandle m_handle;
 		//!\~english	The shader program flags.
 		//!\~french		Les indicateurs pour le shader.
 		ProgramFlags m_programFlags{ 0u };
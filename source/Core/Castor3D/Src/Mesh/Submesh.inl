@@ -294,5 +294,10 @@ namespace castor3d
 		m_topology = p_value;
 	}
 
+	inline SubmeshHandle const & Submesh::getHandle()const
+	{
+		return m_handle;
+	}
+
 	//*********************************************************************************************
 }
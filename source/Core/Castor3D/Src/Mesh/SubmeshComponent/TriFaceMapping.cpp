@@ -5,6 +5,7 @@
 #include "Mesh/Vertex.hpp"
 
 #include <Design/ArrayView.hpp>
+#include <Math/MathBatch.hpp>
 
 using namespace castor;
 
@@ -163,15 +164,19 @@ namespace castor3d
 
 						if ( vertex )
 						{
+							// The distances are computed once per vertex, instead of once per face using it.
+							std::vector< real > distances( vertices.getSize() / stride );
+							batch::squaredDistances( cameraPosition
+								, reinterpret_cast< real const * >( vertex )
+								, stride
+								, distances.data()
+								, distances.size() );
+
 							for ( uint32_t * it = index + 0; it < index + indexSize; it += 3 )
 							{
-								double dDistance = 0.0;
-								Coords3r vtx1( reinterpret_cast< real * >( &vertex[it[0] * stride] ) );
-								dDistance += point::lengthSquared( vtx1 - cameraPosition );
-								Coords3r vtx2( reinterpret_cast< real * >( &vertex[it[1] * stride] ) );
-								dDistance += point::lengthSquared( vtx2 - cameraPosition );
-								Coords3r vtx3( reinterpret_cast< real * >( &vertex[it[2] * stride] ) );
-								dDistance += point::lengthSquared( vtx3 - cameraPosition );
+								double dDistance = double( distances[it[0]] )
+									+ double( distances[it[1]] )
+									+ double( distances[it[2]] );
 								arraySorted.push_back( FaceDistance{ { it[0], it[1], it[2] }, dDistance } );
 							}
 
@@ -13,6 +13,21 @@ using namespace castor;
 
 namespace castor3d
 {
+	namespace
+	{
+		// Computes the plane from the last column of the view projection matrix, combined with the given one.
+		void setPlane( PlaneEquation & plane
+			, Matrix4x4r const & viewProjection
+			, uint32_t index
+			, real sign )
+		{
+			auto last = viewProjection[3];
+			auto col = viewProjection[index];
+			plane.set( Point3r{ last[0] + sign * col[0], last[1] + sign * col[1], last[2] + sign * col[2] }
+				, last[3] + sign * col[3] );
+		}
+	}
+
 	Frustum::Frustum( Viewport & viewport )
 		: m_viewport{ viewport }
 	{
@@ -21,19 +36,14 @@ namespace castor3d
 	void Frustum::update( Matrix4x4r const & projection
 		, Matrix4x4r const & view )
 	{
-		auto const viewProjection = projection * view;
-		auto near = viewProjection[3] + viewProjection[2];
-		auto far = viewProjection[3] - viewProjection[2];
-		auto left = viewProjection[3] + viewProjection[0];
-		auto right = viewProjection[3] - viewProjection[0];
-		auto bottom = viewProjection[3] + viewProjection[1];
-		auto top = viewProjection[3] - viewProjection[1];
-		m_planes[size_t( FrustumPlane::eNear )].set( Point3r{ near[0], near[1], near[2] }, near[3] );
-		m_planes[size_t( FrustumPlane::eFar )].set( Point3r{ far[0], far[1], far[2] }, far[3] );
-		m_planes[size_t( FrustumPlane::eLeft )].set( Point3r{ left[0], left[1], left[2] }, left[3] );
-		m_planes[size_t( FrustumPlane::eRight )].set( Point3r{ right[0], right[1], right[2] }, right[3] );
-		m_planes[size_t( FrustumPlane::eBottom )].set( Point3r{ bottom[0], bottom[1], bottom[2] }, bottom[3] );
-		m_planes[size_t( FrustumPlane::eTop )].set( Point3r{ top[0], top[1], top[2] }, top[3] );
+		Matrix4x4r viewProjection{ projection };
+		viewProjection *= view;
+		setPlane( m_planes[size_t( FrustumPlane::eNear )], viewProjection, 2u, 1.0_r );
+		setPlane( m_planes[size_t( FrustumPlane::eFar )], viewProjection, 2u, -1.0_r );
+		setPlane( m_planes[size_t( FrustumPlane::eLeft )], viewProjection, 0u, 1.0_r );
+		setPlane( m_planes[size_t( FrustumPlane::eRight )], viewProjection, 0u, -1.0_r );
+		setPlane( m_planes[size_t( FrustumPlane::eBottom )], viewProjection, 1u, 1.0_r );
+		setPlane( m_planes[size_t( FrustumPlane::eTop )], viewProjection, 1u, -1.0_r );
 	}
 
 	void Frustum::update( Point3r const & position
@@ -610,40 +610,41 @@ namespace castor3d
 	void PickingPass::doPrepareBackPipeline( ShaderProgram & program
 		, PipelineFlags const & flags )
 	{
-		if ( m_backPipelines.find( flags ) == m_backPipelines.end() )
-		{
-			RasteriserState rsState;
-			rsState.setCulledFaces( Culling::eBack );
-			DepthStencilState dsState;
-			dsState.setDepthTest( true );
-			auto & pipeline = *m_backPipelines.emplace( flags
-				, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
-					, std::move( rsState )
-					, BlendState{}
-					, MultisampleState{}
-					, program
-					, flags ) ).first->second;
-			pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
-			pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
-			pipeline.addUniformBuffer( m_sceneUbo.getUbo() );
-
-			if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
+		RasteriserState rsState;
+		rsState.setCulledFaces( Culling::eBack );
+		DepthStencilState dsState;
+		dsState.setDepthTest( true );
+		doPublishPipeline( m_backPipelines
+			, flags
+			, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
+				, std::move( rsState )
+				, BlendState{}
+				, MultisampleState{}
+				, program
+				, flags )
+			, [this, flags]( RenderPipeline & pipeline )
 			{
-				pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
-			}
+				pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
+				pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
+				pipeline.addUniformBuffer( m_sceneUbo.getUbo() );
 
-			if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
-				&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
-			{
-				pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
-			}
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
+				{
+					pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
+				}
 
-			if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
-			{
-				pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
-			}
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
+					&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
+				{
+					pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
+				}
 
-			pipeline.addUniformBuffer( m_pickingUbo );
-		}
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
+				{
+					pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
+				}
+
+				pipeline.addUniformBuffer( m_pickingUbo );
+			} );
 	}
 }
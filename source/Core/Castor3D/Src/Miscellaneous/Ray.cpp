@@ -10,6 +10,8 @@
 #include "Scene/Camera.hpp"
 #include "Scene/Geometry.hpp"
 
+#include <Math/MathBatch.hpp>
+
 using namespace castor;
 
 namespace castor3d
@@ -284,6 +286,21 @@ namespace castor3d
 
 				if ( intersects( sphere, p_distance ) != Intersection::eOut )
 				{
+					// The vertices are transformed once, instead of once per face using them.
+					auto & vertexBuffer = submesh->getVertexBuffer();
+					auto stride = vertexBuffer.getDeclaration().stride();
+					std::vector< Point3r > positions( vertexBuffer.getSize() / stride );
+
+					if ( !positions.empty() )
+					{
+						batch::transformPoints( transform
+							, reinterpret_cast< real const * >( vertexBuffer.getData() )
+							, stride
+							, positions.front().ptr()
+							, sizeof( Point3r )
+							, positions.size() );
+					}
+
 					for ( uint32_t k = 0u; k < submesh->getFaceCount(); k++ )
 					{
 						Face face
@@ -294,7 +311,7 @@ namespace castor3d
 						};
 						real curfaceDist = 0.0_r;
 
-						if ( intersects( face, transform, *submesh, curfaceDist ) != Intersection::eOut && curfaceDist < faceDist )
+						if ( intersects( positions[face[0]], positions[face[1]], positions[face[2]], curfaceDist ) != Intersection::eOut && curfaceDist < faceDist )
 						{
 							result = Intersection::eIn;
 							p_nearestFace = face;
@@ -0,0 +1,25 @@
+#include "ReferenceCounter.hpp"
+
+#include <atomic>
+
+namespace castor3d
+{
+	namespace
+	{
+		std::atomic< uint64_t > & doGetCounter()
+		{
+			static std::atomic< uint64_t > counter{ 0u };
+			return counter;
+		}
+	}
+
+	void ReferenceCounter::acquire()
+	{
+		doGetCounter().fetch_add( 1u, std::memory_order_relaxed );
+	}
+
+	uint64_t ReferenceCounter::getAcquisitions()
+	{
+		return doGetCounter().load( std::memory_order_relaxed );
+	}
+}
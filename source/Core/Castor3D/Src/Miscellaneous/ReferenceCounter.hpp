@@ -0,0 +1,58 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_ReferenceCounter_H___
+#define ___C3D_ReferenceCounter_H___
+
+#ifndef C3D_COUNT_REFERENCES
+#	ifndef NDEBUG
+#		define C3D_COUNT_REFERENCES 1
+#	else
+#		define C3D_COUNT_REFERENCES 0
+#	endif
+#endif
+
+#include "Castor3DPrerequisites.hpp"
+
+namespace castor3d
+{
+	/*!
+	\author 	Sylvain DOREMUS
+	\date 		19/10/2018
+	\version	0.10.0
+	\~english
+	\brief		Counts the shared pointers acquired through the scene objects accessors.
+	\remarks	Each acquisition costs two atomic operations on the reference count, one to acquire and one to release.
+				<br />Only counts when C3D_COUNT_REFERENCES is enabled, which it is by default in debug builds.
+	\~french
+	\brief		Compte les pointeurs partagés acquis via les accesseurs des objets de la scène.
+	\remarks	Chaque acquisition coûte deux opérations atomiques sur le compteur de références, une pour acquérir et une pour libérer.
+				<br />Ne compte que lorsque C3D_COUNT_REFERENCES est activé, ce qu'il est par défaut dans les builds debug.
+	*/
+	class ReferenceCounter
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Counts one acquisition.
+		 *\~french
+		 *\brief		Compte une acquisition.
+		 */
+		C3D_API static void acquire();
+		/**
+		 *\~english
+		 *\return		The acquisitions count since the program start.
+		 *\~french
+		 *\return		Le nombre d'acquisitions depuis le démarrage du programme.
+		 */
+		C3D_API static uint64_t getAcquisitions();
+	};
+}
+
+#if C3D_COUNT_REFERENCES
+#	define C3D_CountReference() castor3d::ReferenceCounter::acquire()
+#else
+#	define C3D_CountReference()
+#endif
+
+#endif
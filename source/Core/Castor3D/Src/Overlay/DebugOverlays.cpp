@@ -21,6 +21,31 @@ namespace castor3d
 				? timer.getCategory()
 				: timer.getCategory() + cuT( ": " ) + timer.getName();
 		}
+
+		String getMemoryString( int64_t bytes )
+		{
+			static std::array< xchar const *, 4u > const units
+			{
+				{
+					cuT( "B" ),
+					cuT( "KB" ),
+					cuT( "MB" ),
+					cuT( "GB" ),
+				}
+			};
+			auto value = double( bytes );
+			size_t unit = 0u;
+
+			while ( std::abs( value ) >= 1024.0 && unit + 1u < units.size() )
+			{
+				value /= 1024.0;
+				++unit;
+			}
+
+			StringStream stream;
+			stream << std::fixed << std::setprecision( unit ? 1 : 0 ) << value << cuT( " " ) << units[unit];
+			return stream.str();
+		}
 	}
 
 	//*********************************************************************************************
@@ -34,6 +59,7 @@ namespace castor3d
 		, m_times{ std::make_unique< DebugPanels< castor::Nanoseconds > >( cuT( "Times" ), m_panel, cache ) }
 		, m_fps{ std::make_unique< DebugPanels< float > >( cuT( "FPS" ), m_panel, cache ) }
 		, m_counts{ std::make_unique< DebugPanels< uint32_t > >( cuT( "Counts" ), m_panel, cache ) }
+		, m_memory{ std::make_unique< DebugPanels< castor::String > >( cuT( "Memory" ), m_panel, cache ) }
 	{
 		auto & materials = m_cache.getEngine()->getMaterialCache();
 		m_panel->setPixelPosition( Position{ 0, 0 } );
@@ -47,6 +73,7 @@ namespace castor3d
 		m_times.reset();
 		m_fps.reset();
 		m_counts.reset();
+		m_memory.reset();
 
 		if ( m_panel )
 		{
@@ -60,6 +87,8 @@ namespace castor3d
 		m_times->update();
 		m_fps->update();
 		m_counts->update();
+		doUpdateMemory();
+		m_memory->update();
 	}
 
 	void DebugOverlays::MainDebugPanel::setVisible( bool visible )
@@ -72,6 +101,7 @@ namespace castor3d
 		int y = m_times->updatePosition( 0 );
 		y = m_fps->updatePosition( y );
 		y = m_counts->updatePosition( y );
+		y = m_memory->updatePosition( y );
 		m_panel->setPixelSize( Size{ 320, uint32_t( y ) } );
 	}
 
@@ -102,6 +132,55 @@ namespace castor3d
 			, value );
 	}
 
+	void DebugOverlays::MainDebugPanel::doUpdateMemory()
+	{
+		auto report = MemoryAccounting::getReport();
+		int64_t cpuTotal = 0;
+		int64_t gpuTotal = 0;
+		bool added = false;
+		auto setValue = [this, &added]( String const & name
+			, String const & label
+			, String const & value )
+		{
+			auto it = m_memoryValues.find( name );
+
+			if ( it == m_memoryValues.end() )
+			{
+				// std::map nodes are stable, the panel can reference the value.
+				it = m_memoryValues.emplace( name, value ).first;
+				m_memory->add( cuT( "Memory-" ) + name
+					, label
+					, it->second );
+				added = true;
+			}
+			else
+			{
+				it->second = value;
+			}
+		};
+
+		for ( auto & entry : report )
+		{
+			cpuTotal += entry.cpuBytes;
+			gpuTotal += entry.gpuBytes;
+			setValue( entry.name
+				, entry.name + cuT( ":" )
+				, getMemoryString( entry.cpuBytes + entry.gpuBytes ) );
+		}
+
+		setValue( cuT( "TotalCPU" )
+			, cuT( "Total CPU:" )
+			, getMemoryString( cpuTotal ) );
+		setValue( cuT( "TotalGPU" )
+			, cuT( "Total GPU:" )
+			, getMemoryString( gpuTotal ) );
+
+		if ( added )
+		{
+			updatePosition();
+		}
+	}
+
 	//*********************************************************************************************
 
 	DebugOverlays::RenderPassOverlays::RenderPassOverlays( castor::String const & category
@@ -224,19 +303,19 @@ namespace castor3d
 
 	Nanoseconds DebugOverlays::RenderPassOverlays::update()
 	{
-		Nanoseconds cpu{ 0 };
-		Nanoseconds gpu{ 0 };
+		m_cpuTime = 0_ns;
+		m_gpuTime = 0_ns;
 
 		for ( auto & timer : m_timers )
 		{
-			cpu += timer.get().getCpuTime();
-			gpu += timer.get().getGpuTime();
+			m_cpuTime += timer.get().getCpuTime();
+			m_gpuTime += timer.get().getGpuTime();
 			timer.get().reset();
 		}
 
-		m_cpuValue->setCaption( StringStream{} << cpu );
-		m_gpuValue->setCaption( StringStream{} << gpu );
-		return gpu;
+		m_cpuValue->setCaption( StringStream{} << m_cpuTime );
+		m_gpuValue->setCaption( StringStream{} << m_gpuTime );
+		return m_gpuTime;
 	}
 
 	void DebugOverlays::RenderPassOverlays::setVisible( bool visible )
@@ -267,7 +346,7 @@ namespace castor3d
 
 	RenderInfo & DebugOverlays::beginFrame()
 	{
-		if ( m_visible )
+		if ( doIsActive() )
 		{
 			m_gpuTime = 0_ms;
 			m_cpuTime = 0_ms;
@@ -315,7 +394,7 @@ namespace castor3d
 	{
 		m_totalTime = m_frameTimer.getElapsed() + m_externalTime;
 
-		if ( m_visible )
+		if ( doIsActive() )
 		{
 			m_framesTimes[m_frameIndex] = m_totalTime;
 			m_averageTime = std::accumulate( m_framesTimes.begin(), m_framesTimes.end(), 0_ns ) / m_framesTimes.size();
@@ -329,32 +408,57 @@ namespace castor3d
 			}
 
 			m_gpuClientTime = m_gpuTime - m_gpuTotalTime;
-			m_debugPanel->update();
+
+			if ( m_visible )
+			{
+				m_debugPanel->update();
+			}
+
+			if ( m_collect )
+			{
+				m_timings.m_totalTime = m_totalTime;
+				m_timings.m_cpuTime = m_cpuTime;
+				m_timings.m_gpuTime = m_gpuTime;
+				m_timings.m_info = m_renderInfo;
+				m_timings.m_passes.clear();
+
+				for ( auto & pass : m_renderPasses )
+				{
+					m_timings.m_passes.push_back( { pass.first
+						, pass.second.getCpuTime()
+						, pass.second.getGpuTime() } );
+				}
+			}
+
 			getEngine()->getRenderSystem()->resetGpuTime();
 
 			m_frameIndex = ++m_frameIndex % FRAME_SAMPLES_COUNT;
 			m_frameTimer.getElapsed();
 		}
 
+		// When collecting the timings, the application reports them itself.
+		if ( !m_collect )
+		{
 #if defined( NDEBUG )
 
-		auto total = std::chrono::duration_cast< std::chrono::microseconds >( m_totalTime );
-		fprintf( stdout
-			, "\r%0.7f ms, %0.7f fps"
-			, total.count() / 1000.0f
-			, ( 1000000.0_r / total.count() ) );
+			auto total = std::chrono::duration_cast< std::chrono::microseconds >( m_totalTime );
+			fprintf( stdout
+				, "\r%0.7f ms, %0.7f fps"
+				, total.count() / 1000.0f
+				, ( 1000000.0_r / total.count() ) );
 
 #else
 
-		std::cout << "\rTime: " << std::setw( 7 ) << m_totalTime;
-		std::cout << " - FPS: " << std::setw( 7 ) << std::setprecision( 4 ) << ( 1000000.0_r / std::chrono::duration_cast< std::chrono::microseconds >( m_totalTime ).count() );
+			std::cout << "\rTime: " << std::setw( 7 ) << m_totalTime;
+			std::cout << " - FPS: " << std::setw( 7 ) << std::setprecision( 4 ) << ( 1000000.0_r / std::chrono::duration_cast< std::chrono::microseconds >( m_totalTime ).count() );
 
 #endif
+		}
 	}
 
 	void DebugOverlays::endGpuTask()
 	{
-		if ( m_visible )
+		if ( doIsActive() )
 		{
 			m_gpuTime += m_taskTimer.getElapsed();
 		}
@@ -362,7 +466,7 @@ namespace castor3d
 
 	void DebugOverlays::endCpuTask()
 	{
-		if ( m_visible )
+		if ( doIsActive() )
 		{
 			m_cpuTime += m_taskTimer.getElapsed();
 		}
@@ -379,6 +483,17 @@ namespace castor3d
 		}
 	}
 
+	void DebugOverlays::collectTimings( bool collect )
+	{
+		m_collect = collect;
+		m_timings = FrameTimings{};
+	}
+
+	bool DebugOverlays::doIsActive()const
+	{
+		return m_visible || m_collect;
+	}
+
 	void DebugOverlays::doCreateDebugPanel( OverlayCache & cache )
 	{
 		m_debugPanel = std::make_unique< MainDebugPanel >( cache );
@@ -436,6 +551,21 @@ namespace castor3d
 		m_debugPanel->addCountPanel( cuT( "DrawCalls" )
 			, cuT( "Draw calls:" )
 			, m_renderInfo.m_drawCalls );
+		m_debugPanel->addCountPanel( cuT( "OverlayDrawCalls" )
+			, cuT( "Overlay draw calls:" )
+			, m_renderInfo.m_overlayDrawCalls );
+		m_debugPanel->addCountPanel( cuT( "RenderedShadowPasses" )
+			, cuT( "Shadow passes rendered:" )
+			, m_renderInfo.m_renderedShadowPasses );
+		m_debugPanel->addCountPanel( cuT( "SkippedShadowPasses" )
+			, cuT( "Shadow passes skipped:" )
+			, m_renderInfo.m_skippedShadowPasses );
+		m_debugPanel->addCountPanel( cuT( "EnvironmentMaps" )
+			, cuT( "Environment maps:" )
+			, m_renderInfo.m_environmentMapsCount );
+		m_debugPanel->addCountPanel( cuT( "RenderedEnvironmentFaces" )
+			, cuT( "Environment faces rendered:" )
+			, m_renderInfo.m_renderedEnvironmentFaces );
 		m_debugPanel->updatePosition();
 		m_debugPanel->setVisible( m_visible );
 	}
@@ -7,6 +7,7 @@ See LICENSE file in root folder
 #include "Cache/OverlayCache.hpp"
 #include "Render/RenderInfo.hpp"
 
+#include <Miscellaneous/MemoryAccounting.hpp>
 #include <Miscellaneous/PreciseTimer.hpp>
 #include <Design/OwnedBy.hpp>
 
@@ -118,8 +119,28 @@ namespace castor3d
 		 *\param[in]	timer	Le timer à désenregistrer.
 		 */
 		void unregisterTimer( RenderPassTimer & timer );
+		/**
+		 *\~english
+		 *\brief		Enables or disables the frame timings collection, even if the overlays are hidden.
+		 *\param[in]	collect	The status.
+		 *\~french
+		 *\brief		Active ou désactive la collecte des temps d'image, même si les incrustations sont cachées.
+		 *\param[in]	collect	Le statut.
+		 */
+		void collectTimings( bool collect );
+		/**
+		 *\~english
+		 *\return		The timings of the last frame, filled if the timings collection is enabled.
+		 *\~french
+		 *\return		Les temps de la dernière image, remplis si la collecte des temps est activée.
+		 */
+		inline FrameTimings const & getTimings()const
+		{
+			return m_timings;
+		}
 
 	private:
+		bool doIsActive()const;
 		void doCreateDebugPanel( OverlayCache & cache );
 
 	private:
@@ -196,12 +217,17 @@ namespace castor3d
 				, castor::String const & label
 				, float const & value );
 
+		private:
+			void doUpdateMemory();
+
 		private:
 			OverlayCache & m_cache;
 			PanelOverlaySPtr m_panel;
 			DebugPanelsPtr< castor::Nanoseconds > m_times;
 			DebugPanelsPtr< float > m_fps;
 			DebugPanelsPtr< uint32_t > m_counts;
+			DebugPanelsPtr< castor::String > m_memory;
+			std::map< castor::String, castor::String > m_memoryValues;
 		};
 
 		class RenderPassOverlays
@@ -220,9 +246,21 @@ namespace castor3d
 			castor::Nanoseconds update();
 			void setVisible( bool visible );
 
+			inline castor::Nanoseconds getCpuTime()const
+			{
+				return m_cpuTime;
+			}
+
+			inline castor::Nanoseconds getGpuTime()const
+			{
+				return m_gpuTime;
+			}
+
 		private:
 			OverlayCache & m_cache;
 			std::vector< std::reference_wrapper< RenderPassTimer > > m_timers;
+			castor::Nanoseconds m_cpuTime{ 0 };
+			castor::Nanoseconds m_gpuTime{ 0 };
 			PanelOverlaySPtr m_panel;
 			PanelOverlaySPtr m_titlePanel;
 			TextOverlaySPtr m_titleText;
@@ -248,6 +286,7 @@ namespace castor3d
 		std::array< castor::Nanoseconds, FRAME_SAMPLES_COUNT > m_framesTimes;
 		uint32_t m_frameIndex{ 0 };
 		bool m_visible{ false };
+		bool m_collect{ false };
 		castor::Nanoseconds m_cpuTime{ 0 };
 		castor::Nanoseconds m_gpuClientTime{ 0 };
 		castor::Nanoseconds m_gpuTotalTime{ 0 };
@@ -259,6 +298,7 @@ namespace castor3d
 		castor::Nanoseconds m_averageTime{ 0 };
 		std::locale m_timesLocale;
 		RenderInfo m_renderInfo;
+		FrameTimings m_timings;
 	};
 }
 
@@ -12,13 +12,29 @@ using namespace castor;
 
 namespace castor3d
 {
+	namespace
+	{
+		//!\~english	The texture minimal dimension.
+		//!\~french		La dimension minimale de la texture.
+		static uint32_t constexpr MinSize = 256u;
+		//!\~english	The texture maximal dimension.
+		//!\~french		La dimension maximale de la texture.
+		static uint32_t constexpr MaxSize = 4096u;
+		//!\~english	The empty space kept after each glyph, to prevent bleeding when filtering.
+		//!\~french		L'espace vide gardé après chaque glyphe, pour éviter les débordements lors du filtrage.
+		static uint32_t constexpr Padding = 1u;
+	}
+
 	FontTexture::FontTexture( Engine & engine, FontSPtr p_font )
 		: OwnedBy< Engine >( engine )
 		, m_font( p_font )
 	{
-		uint32_t const maxWidth = p_font->getMaxWidth();
-		uint32_t const maxHeight = p_font->getMaxHeight();
-		uint32_t const count = uint32_t( std::ceil( std::distance( p_font->begin(), p_font->end() ) / 16.0 ) );
+		// Room for a few lines of 16 glyphs, the texture grows when needed.
+		Size const size
+		{
+			std::min( MaxSize, std::max( MinSize, getNext2Pow( p_font->getMaxWidth() * 16u ) ) ),
+			std::min( MaxSize, std::max( MinSize, getNext2Pow( p_font->getMaxHeight() * 4u ) ) ),
+		};
 
 		SamplerSPtr sampler = getEngine()->getSamplerCache().add( p_font->getName() );
 		sampler->setWrappingMode( TextureUVW::eU, WrapMode::eClampToEdge );
@@ -26,8 +42,8 @@ namespace castor3d
 		sampler->setInterpolationMode( InterpolationFilter::eMin, InterpolationMode::eLinear );
 		sampler->setInterpolationMode( InterpolationFilter::eMag, InterpolationMode::eLinear );
 		m_sampler = sampler;
-		m_texture = getEngine()->getRenderSystem()->createTexture( TextureType::eTwoDimensions, AccessType::eWrite, AccessType::eRead, PixelFormat::eL8, Size{ maxWidth * 16, maxHeight * count } );
-		m_texture->getImage().initialiseSource();
+		m_texture = getEngine()->getRenderSystem()->createTexture( TextureType::eTwoDimensions, AccessType::eWrite, AccessType::eRead, PixelFormat::eL8, size );
+		m_texture->getImage().initialiseSource( PxBufferBase::create( size, PixelFormat::eL8 ) );
 	}
 
 	FontTexture::~FontTexture()
@@ -36,10 +52,23 @@ namespace castor3d
 
 	void FontTexture::initialise()
 	{
-		m_texture->initialise();
-		m_texture->bind( MinTextureIndex );
-		m_texture->generateMipmaps();
-		m_texture->unbind( MinTextureIndex );
+		{
+			auto lock = makeUniqueLock( m_mutex );
+			m_resized = false;
+			m_texture->initialise();
+			m_texture->bind( MinTextureIndex );
+			m_texture->generateMipmaps();
+			m_texture->unbind( MinTextureIndex );
+
+			// The whole source buffer has been uploaded.
+			for ( auto & shelf : m_shelves )
+			{
+				shelf.m_dirtyLeft = shelf.m_dirtyRight;
+			}
+
+			doPublish();
+		}
+
 		onChanged( *this );
 	}
 
@@ -49,48 +78,66 @@ namespace castor3d
 
 		if ( font )
 		{
-			uint32_t const maxWidth = font->getMaxWidth();
-			uint32_t const maxHeight = font->getMaxHeight();
-			uint32_t const count = uint32_t( std::ceil( std::distance( font->begin(), font->end() ) / 16.0 ) );
-			Size size{ maxWidth * 16, maxHeight * count };
-			auto & image = m_texture->getImage();
-			image.initialiseSource( PxBufferBase::create( Size( maxWidth * 16, maxHeight * count ), PixelFormat::eL8 ) );
+			auto lock = makeUniqueLock( m_mutex );
+			size_t const count = size_t( std::distance( font->begin(), font->end() ) );
+			auto it = font->begin() + m_packedCount;
 
-			auto it = font->begin();
-			Size const & sizeImg = size;
-			uint32_t const uiTotalWidth = sizeImg.getWidth();
-			uint32_t uiOffY = sizeImg.getHeight() - maxHeight;
-			uint8_t * pBuffer = image.getBuffer()->ptr();
-			size_t const bufsize = image.getBuffer()->size();
+			// A glyph that didn't fit is retried on next call, the glyphs following it are not skipped.
+			while ( it != font->end() && doPack( *it ) )
+			{
+				++it;
+				++m_packedCount;
+			}
 
-			for ( uint32_t y = 0; y < count && it != font->end(); ++y )
+			if ( m_packedCount < count && m_failedCount != count )
 			{
-				uint32_t uiOffX = 0;
+				m_failedCount = count;
+				Logger::logError( cuT( "FontTexture: no more room in the texture for the glyphs of font " ) + font->getName() );
+			}
+		}
+	}
 
-				for ( uint32_t x = 0; x < 16 && it != font->end(); ++x )
-				{
-					Glyph const & glyph = *it;
-					Size const & size = glyph.getSize();
-					ByteArray const & buffer = glyph.getBitmap();
-					uint32_t const dstLineIndex = ( uiTotalWidth * uiOffY ) + uiOffX;
-					uint8_t * dstLineBuffer = &pBuffer[dstLineIndex];
+	void FontTexture::upload()
+	{
+		bool resized = false;
+		bool uploaded = false;
+		{
+			auto lock = makeUniqueLock( m_mutex );
+			resized = m_resized;
 
-					for ( uint32_t i = 0; i < size.getHeight(); ++i )
+			if ( !resized && m_texture->isInitialised() )
+			{
+				for ( auto & shelf : m_shelves )
+				{
+					if ( shelf.m_dirtyLeft < shelf.m_dirtyRight )
 					{
-						ENSURE( dstLineIndex + size.getWidth() <= bufsize );
-						std::memcpy( dstLineBuffer, &buffer[i * size.getWidth()], size.getWidth() );
-						dstLineBuffer += uiTotalWidth;
+						m_texture->uploadRegion( Rectangle
+						{
+							Position{ int32_t( shelf.m_dirtyLeft ), int32_t( shelf.m_top ) },
+							Size{ shelf.m_dirtyRight - shelf.m_dirtyLeft, shelf.m_height }
+						} );
+						shelf.m_dirtyLeft = shelf.m_dirtyRight;
+						uploaded = true;
 					}
-
-					m_glyphsPositions[glyph.getCharacter()] = Position( uiOffX, uiOffY );
-					uiOffX += maxWidth;
-					++it;
 				}
 
-				uiOffY -= maxHeight;
+				if ( uploaded )
+				{
+					doPublish();
+				}
 			}
 		}
 
+		if ( resized )
+		{
+			// The texture is recreated with the grown buffer, the new dimensions are published along with it.
+			cleanup();
+			initialise();
+		}
+		else if ( uploaded )
+		{
+			onChanged( *this );
+		}
 	}
 
 	void FontTexture::cleanup()
@@ -106,15 +153,143 @@ namespace castor3d
 		return getFont()->getName();
 	}
 
-	Position const & FontTexture::getGlyphPosition( char32_t p_char )const
+	Position FontTexture::getGlyphPosition( char32_t p_char )const
 	{
-		GlyphPositionMapConstIt it = m_glyphsPositions.find( p_char );
+		auto lock = makeUniqueLock( m_mutex );
+		GlyphPositionMapConstIt it = m_uploadedPositions.find( p_char );
 
-		if ( it == m_glyphsPositions.end() )
+		if ( it == m_uploadedPositions.end() )
 		{
 			CASTOR_EXCEPTION( std::string( "No loaded glyph for character " ) + string::stringCast< char >( string::toString( p_char ) ) );
 		}
 
 		return it->second;
 	}
+
+	bool FontTexture::hasGlyph( char32_t p_char )const
+	{
+		auto lock = makeUniqueLock( m_mutex );
+		return m_uploadedPositions.end() != m_uploadedPositions.find( p_char );
+	}
+
+	Size FontTexture::getDimensions()const
+	{
+		auto lock = makeUniqueLock( m_mutex );
+		return m_uploadedDimensions;
+	}
+
+	bool FontTexture::doPack( Glyph const & p_glyph )
+	{
+		Size const & size = p_glyph.getSize();
+		Shelf * shelf = doFindShelf( Size{ size.getWidth() + Padding, size.getHeight() + Padding } );
+
+		if ( !shelf )
+		{
+			return false;
+		}
+
+		auto buffer = m_texture->getImage().getBuffer();
+		uint32_t const totalWidth = buffer->dimensions().getWidth();
+		uint8_t * dst = buffer->ptr() + shelf->m_top * totalWidth + shelf->m_width;
+		ByteArray const & bitmap = p_glyph.getBitmap();
+
+		for ( uint32_t i = 0; i < size.getHeight(); ++i )
+		{
+			std::memcpy( dst, &bitmap[i * size.getWidth()], size.getWidth() );
+			dst += totalWidth;
+		}
+
+		m_glyphsPositions[p_glyph.getCharacter()] = Position( int32_t( shelf->m_width ), int32_t( shelf->m_top ) );
+		shelf->m_dirtyLeft = std::min( shelf->m_dirtyLeft, shelf->m_width );
+		shelf->m_width += size.getWidth() + Padding;
+		shelf->m_dirtyRight = shelf->m_width;
+		return true;
+	}
+
+	FontTexture::Shelf * FontTexture::doFindShelf( Size const & p_size )
+	{
+		Shelf * result = nullptr;
+
+		do
+		{
+			Size const dimensions = m_texture->getDimensions();
+			uint32_t waste = std::numeric_limits< uint32_t >::max();
+
+			// Best fit: the shelf wasting the fewest rows.
+			for ( auto & shelf : m_shelves )
+			{
+				if ( shelf.m_height >= p_size.getHeight()
+					&& shelf.m_width + p_size.getWidth() <= dimensions.getWidth()
+					&& shelf.m_height - p_size.getHeight() < waste )
+				{
+					result = &shelf;
+					waste = shelf.m_height - p_size.getHeight();
+				}
+			}
+
+			// Shelves much higher than the glyph are kept for bigger glyphs, while there is room for a new one.
+			if ( !result || waste > p_size.getHeight() / 2u )
+			{
+				uint32_t const top = m_shelves.empty()
+					? 0u
+					: m_shelves.back().m_top + m_shelves.back().m_height;
+
+				if ( top + p_size.getHeight() <= dimensions.getHeight()
+					&& p_size.getWidth() <= dimensions.getWidth() )
+				{
+					m_shelves.push_back( Shelf{ top, p_size.getHeight(), 0u, dimensions.getWidth(), 0u } );
+					result = &m_shelves.back();
+				}
+			}
+		}
+		while ( !result && doGrow() );
+
+		return result;
+	}
+
+	bool FontTexture::doGrow()
+	{
+		Size const dimensions = m_texture->getDimensions();
+		Size size{ dimensions };
+
+		if ( size.getHeight() < size.getWidth() || size.getWidth() >= MaxSize )
+		{
+			size.getHeight() = std::min( MaxSize, size.getHeight() * 2u );
+		}
+		else
+		{
+			size.getWidth() = std::min( MaxSize, size.getWidth() * 2u );
+		}
+
+		bool result = size != dimensions;
+
+		if ( result )
+		{
+			// The rows are copied at the same position, so the packed glyphs keep their position.
+			auto & image = m_texture->getImage();
+			auto source = image.getBuffer();
+			auto buffer = PxBufferBase::create( size, PixelFormat::eL8 );
+			uint32_t const srcWidth = source->dimensions().getWidth();
+			uint8_t const * src = source->constPtr();
+			uint8_t * dst = buffer->ptr();
+
+			for ( uint32_t i = 0; i < source->dimensions().getHeight(); ++i )
+			{
+				std::memcpy( dst, src, srcWidth );
+				src += srcWidth;
+				dst += size.getWidth();
+			}
+
+			image.initialiseSource( buffer );
+			m_resized = true;
+		}
+
+		return result;
+	}
+
+	void FontTexture::doPublish()
+	{
+		m_uploadedPositions = m_glyphsPositions;
+		m_uploadedDimensions = m_texture->getDimensions();
+	}
 }
@@ -17,8 +17,14 @@ namespace castor3d
 	\date 		04/10/2015
 	\~english
 	\brief		Contains the font and the texture assiated to this font.
+	\remarks	The texture is a glyph atlas, filled as the glyphs are loaded by the font.
+				<br />The glyphs are packed in shelves (rows of glyphs with a similar height), the texture size is doubled when it is full.
+				<br />Only the modified parts of the shelves are uploaded, unless the texture has been resized.
 	\~french
 	\brief		Contient la polica et la texture associée.
+	\remarks	La texture est un atlas de glyphes, rempli au fur et à mesure du chargement des glyphes par la police.
+				<br />Les glyphes sont rangées dans des étagères (lignes de glyphes de hauteur similaire), la taille de la texture est doublée lorsqu'elle est pleine.
+				<br />Seules les parties modifiées des étagères sont mises sur le GPU, sauf si la texture a été redimensionnée.
 	*/
 	class FontTexture
 		: public castor::OwnedBy< Engine >
@@ -63,11 +69,26 @@ namespace castor3d
 		C3D_API void cleanup();
 		/**
 		 *\~english
-		 *\brief		Updates the glyphs.
+		 *\brief		Packs the font glyphs loaded since the last call into the texture source buffer.
+		 *\remarks		The packed glyphs are only visible through getGlyphPosition() and getDimensions() once upload() has put them on the GPU.
 		 *\~french
-		 *\brief		Met à jour les glyphes.
+		 *\brief		Range les glyphes de la police chargées depuis le dernier appel dans le buffer source de la texture.
+		 *\remarks		Les glyphes rangées ne sont visibles via getGlyphPosition() et getDimensions() qu'une fois mises sur le GPU par upload().
 		 */
 		C3D_API void update();
+		/**
+		 *\~english
+		 *\brief		Uploads the modifications made by update() to the GPU.
+		 *\remarks		Must be called from the render thread.
+		 *				<br />Recreates the texture if it has been resized, else uploads the modified parts of the shelves.
+		 *				<br />The new glyphs positions and the texture dimensions are then published, and the onChanged signal is emitted.
+		 *\~french
+		 *\brief		Met sur le GPU les modifications faites par update().
+		 *\remarks		Doit être appelée depuis le thread de rendu.
+		 *				<br />Recrée la texture si elle a été redimensionnée, sinon met à jour les parties modifiées des étagères.
+		 *				<br />Les positions des nouvelles glyphes et les dimensions de la texture sont ensuite publiées, et le signal onChanged est émis.
+		 */
+		C3D_API void upload();
 		/**
 		 *\~english
 		 *\brief		Retrieves the font name.
@@ -79,15 +100,35 @@ namespace castor3d
 		C3D_API castor::String const & getFontName()const;
 		/**
 		 *\~english
-		 *\brief		Retrieves the wanted glyph position.
+		 *\brief		Retrieves the wanted glyph position, in the texture currently on the GPU.
 		 *\param[in]	p_char	The glyph index.
 		 *\return		The position.
 		 *\~french
-		 *\brief		Récupère la position de la glyphe voulue.
+		 *\brief		Récupère la position de la glyphe voulue, dans la texture actuellement sur le GPU.
 		 *\param[in]	p_char	L'indice de la glyphe.
 		 *\return		La position.
 		 */
-		C3D_API castor::Position const & getGlyphPosition( char32_t p_char )const;
+		C3D_API castor::Position getGlyphPosition( char32_t p_char )const;
+		/**
+		 *\~english
+		 *\brief		Tells if the wanted glyph is in the texture currently on the GPU.
+		 *\param[in]	p_char	The glyph index.
+		 *\return		\p false if it hasn't been uploaded yet.
+		 *\~french
+		 *\brief		Dit si la glyphe voulue est dans la texture actuellement sur le GPU.
+		 *\param[in]	p_char	L'indice de la glyphe.
+		 *\return		\p false si elle n'a pas encore été mise sur le GPU.
+		 */
+		C3D_API bool hasGlyph( char32_t p_char )const;
+		/**
+		 *\~english
+		 *\brief		Retrieves the dimensions of the texture currently on the GPU, to use when computing the glyphs UV.
+		 *\return		The dimensions.
+		 *\~french
+		 *\brief		Récupère les dimensions de la texture actuellement sur le GPU, à utiliser pour calculer les UV des glyphes.
+		 *\return		Les dimensions.
+		 */
+		C3D_API castor::Size getDimensions()const;
 		/**
 		 *\~english
 		 *\brief		Retrieves the font.
@@ -125,6 +166,74 @@ namespace castor3d
 			return m_sampler.lock();
 		}
 
+	private:
+		/*!
+		\~english
+		\brief		A row of glyphs in the texture.
+		\~french
+		\brief		Une ligne de glyphes dans la texture.
+		*/
+		struct Shelf
+		{
+			//!\~english	The shelf first row in the texture.
+			//!\~french		La première ligne de l'étagère dans la texture.
+			uint32_t m_top;
+			//!\~english	The shelf height.
+			//!\~french		La hauteur de l'étagère.
+			uint32_t m_height;
+			//!\~english	The used width.
+			//!\~french		La largeur utilisée.
+			uint32_t m_width;
+			//!\~english	The modified columns range, empty if m_dirtyLeft >= m_dirtyRight.
+			//!\~french		L'intervalle de colonnes modifiées, vide si m_dirtyLeft >= m_dirtyRight.
+			uint32_t m_dirtyLeft;
+			uint32_t m_dirtyRight;
+		};
+
+	private:
+		/**
+		 *\~english
+		 *\brief		Places a glyph in the texture source buffer, growing it if needed.
+		 *\param[in]	p_glyph	The glyph.
+		 *\return		\p false if the texture has reached its maximal size.
+		 *\~french
+		 *\brief		Place une glyphe dans le buffer source de la texture, en l'agrandissant si nécessaire.
+		 *\param[in]	p_glyph	La glyphe.
+		 *\return		\p false si la texture a atteint sa taille maximale.
+		 */
+		bool doPack( castor::Glyph const & p_glyph );
+		/**
+		 *\~english
+		 *\brief		Looks for a shelf able to hold a glyph of given size, creates one if none fits.
+		 *\param[in]	p_size	The glyph size, padding included.
+		 *\return		The shelf, \p nullptr if there is no more room in the texture.
+		 *\~french
+		 *\brief		Recherche une étagère pouvant contenir une glyphe de taille donnée, en crée une si aucune ne convient.
+		 *\param[in]	p_size	La taille de la glyphe, marge comprise.
+		 *\return		L'étagère, \p nullptr s'il n'y a plus de place dans la texture.
+		 */
+		Shelf * doFindShelf( castor::Size const & p_size );
+		/**
+		 *\~english
+		 *\brief		Doubles the texture height, or its width if it is not greater than its height.
+		 *\remarks		The already packed glyphs keep their position.
+		 *\return		\p false if the texture has reached its maximal size.
+		 *\~french
+		 *\brief		Double la hauteur de la texture, ou sa largeur si elle n'est pas plus grande que sa hauteur.
+		 *\remarks		Les glyphes déjà rangées gardent leur position.
+		 *\return		\p false si la texture a atteint sa taille maximale.
+		 */
+		bool doGrow();
+		/**
+		 *\~english
+		 *\brief		Makes the packed glyphs positions and the texture dimensions visible to the clients.
+		 *\remarks		Called with m_mutex locked, once the texture on the GPU matches the source buffer.
+		 *\~french
+		 *\brief		Rend les positions des glyphes rangées et les dimensions de la texture visibles aux clients.
+		 *\remarks		Appelée avec m_mutex verrouillé, une fois que la texture sur le GPU correspond au buffer source.
+		 */
+		void doPublish();
+
 	public:
 		//!\~english	The signal used to notify clients that this texture has changed.
 		//!\~french		Signal utilisé pour notifier les clients que cette texture a changé.
@@ -140,9 +249,30 @@ namespace castor3d
 		//!\~english	The texture that will receive the glyphs.
 		//!\~french		La texture qui recevra les glyphes.
 		TextureLayoutSPtr m_texture;
-		//!\~english	Glyphs positions in the texture.
-		//!\~french		Position des glyphes.
+		//!\~english	Glyphs positions in the texture source buffer.
+		//!\~french		Position des glyphes dans le buffer source de la texture.
 		GlyphPositionMap m_glyphsPositions;
+		//!\~english	Glyphs positions in the texture on the GPU.
+		//!\~french		Position des glyphes dans la texture sur le GPU.
+		GlyphPositionMap m_uploadedPositions;
+		//!\~english	The dimensions of the texture on the GPU.
+		//!\~french		Les dimensions de la texture sur le GPU.
+		castor::Size m_uploadedDimensions;
+		//!\~english	Protects the packing state, update() and upload() being called from different threads.
+		//!\~french		Protège l'état du rangement, update() et upload() étant appelées depuis des threads différents.
+		mutable std::mutex m_mutex;
+		//!\~english	The glyphs shelves.
+		//!\~french		Les étagères de glyphes.
+		std::vector< Shelf > m_shelves;
+		//!\~english	The number of font glyphs packed by update().
+		//!\~french		Le nombre de glyphes de la police rangées par update().
+		size_t m_packedCount{ 0u };
+		//!\~english	The font glyphs count when packing last failed, to report the failure only once.
+		//!\~french		Le nombre de glyphes de la police lors du dernier échec de rangement, pour ne signaler l'échec qu'une fois.
+		size_t m_failedCount{ 0u };
+		//!\~english	Tells if the texture has been resized since the last upload.
+		//!\~french		Dit si la texture a été redimensionnée depuis la dernière mise sur le GPU.
+		bool m_resized{ false };
 	};
 }
 
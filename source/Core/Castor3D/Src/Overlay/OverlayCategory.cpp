@@ -8,10 +8,17 @@
 
 #include "Material/Material.hpp"
 
+#include <atomic>
+
 using namespace castor;
 
 namespace castor3d
 {
+	namespace
+	{
+		std::atomic< uint64_t > g_nextId{ 0u };
+	}
+
 	OverlayCategory::TextWriter::TextWriter( String const & p_tabs )
 		: castor::TextWriter< OverlayCategory >{ p_tabs }
 	{
@@ -66,6 +73,7 @@ namespace castor3d
 
 	OverlayCategory::OverlayCategory( OverlayType p_type )
 		: m_type( p_type )
+		, m_id( ++g_nextId )
 	{
 	}
 
@@ -95,6 +103,7 @@ namespace castor3d
 				{
 					doUpdate();
 					doUpdateBuffer( renderer->getSize() );
+					++m_buffersVersion;
 				}
 
 				m_positionChanged = false;
@@ -403,6 +403,26 @@ namespace castor3d
 		{
 			return m_level;
 		}
+		/**
+		 *\~english
+		 *\return		The vertex buffers version, incremented each time they are regenerated.
+		 *\~french
+		 *\return		La version des tampons de sommets, incrémentée à chaque fois qu'ils sont regénérés.
+		 */
+		inline uint32_t getBuffersVersion()const
+		{
+			return m_buffersVersion;
+		}
+		/**
+		 *\~english
+		 *\return		The unique identifier of this overlay, never reused, unlike its address.
+		 *\~french
+		 *\return		L'identifiant unique de cette incrustation, jamais réutilisé, contrairement à son adresse.
+		 */
+		inline uint64_t getId()const
+		{
+			return m_id;
+		}
 		/**
 		 *\~english
 		 *\brief		Retrieves the overlay
@@ -608,6 +628,12 @@ namespace castor3d
 		//!\~english	Tells if this overlay's position has changed.
 		//!\~french		Dit si la position de cette incrustation a changé..
 		bool m_positionChanged{ true };
+		//!\~english	The vertex buffers version.
+		//!\~french		La version des tampons de sommets.
+		uint32_t m_buffersVersion{ 0u };
+		//!\~english	The unique identifier.
+		//!\~french		L'identifiant unique.
+		uint64_t const m_id;
 		//!\~english	The UV for the panel.
 		//!\~french		Les UV du panneau.
 		castor::Point4d m_uv{ 0.0, 0.0, 1.0, 1.0 };
@@ -18,6 +18,8 @@
 #include <GlslSource.hpp>
 #include "Shader/Shaders/GlslMaterial.hpp"
 
+#include <limits>
+
 using namespace castor;
 
 #if defined( drawText )
@@ -26,34 +28,32 @@ using namespace castor;
 
 namespace castor3d
 {
-	static const int32_t C3D_MAX_CHARS_PER_BUFFER = 6000;
-
 	namespace
 	{
-		uint32_t doFillBuffers( OverlayCategory::VertexArray::const_iterator begin
-			, uint32_t count
-			, VertexBuffer & vbo )
-		{
-			OverlayCategory::Vertex const & vertex = *begin;
-			auto size = count * sizeof( OverlayCategory::Vertex );
+		static uint32_t constexpr MinVertexCount = 6000u;
 
-			vbo.bind();
-			vbo.upload( 0, uint32_t( size ), reinterpret_cast< uint8_t const * >( &vertex ) );
-			vbo.unbind();
-			return count;
+		TextOverlay::Vertex doBakeVertex( OverlayCategory::Vertex const & vertex
+			, Point2d const & position
+			, Point2f const & ratio )
+		{
+			return TextOverlay::Vertex
+			{
+				{ float( ratio[0] * ( position[0] + vertex.coords[0] ) ), float( ratio[1] * ( position[1] + vertex.coords[1] ) ) },
+				{ 0.0f, 0.0f },
+				{ vertex.texture[0], vertex.texture[1] },
+			};
 		}
 
-		uint32_t doFillBuffers( TextOverlay::VertexArray::const_iterator begin
-			, uint32_t count
-			, VertexBuffer & vbo )
+		TextOverlay::Vertex doBakeVertex( TextOverlay::Vertex const & vertex
+			, Point2d const & position
+			, Point2f const & ratio )
 		{
-			TextOverlay::Vertex const & vertex = *begin;
-			auto size = count * sizeof( TextOverlay::Vertex );
-
-			vbo.bind();
-			vbo.upload( 0, uint32_t( size ), reinterpret_cast< uint8_t const * >( &vertex ) );
-			vbo.unbind();
-			return count;
+			return TextOverlay::Vertex
+			{
+				{ float( ratio[0] * ( position[0] + vertex.coords[0] ) ), float( ratio[1] * ( position[1] + vertex.coords[1] ) ) },
+				{ vertex.text[0], vertex.text[1] },
+				{ vertex.texture[0], vertex.texture[1] },
+			};
 		}
 	}
 
@@ -62,14 +62,7 @@ namespace castor3d
 		, m_declaration{
 			{
 				{
-					BufferElementDeclaration( ShaderProgram::Position, uint32_t( ElementUsage::ePosition ), ElementType::eIVec2 ),
-					BufferElementDeclaration( ShaderProgram::Texture, uint32_t( ElementUsage::eTexCoords ), ElementType::eVec2 )
-				}
-			} }
-		, m_textDeclaration{
-			{
-				{
-					BufferElementDeclaration( ShaderProgram::Position, uint32_t( ElementUsage::ePosition ), ElementType::eIVec2 ),
+					BufferElementDeclaration( ShaderProgram::Position, uint32_t( ElementUsage::ePosition ), ElementType::eVec2 ),
 					BufferElementDeclaration( ShaderProgram::Text, uint32_t( ElementUsage::eTexCoords ), ElementType::eVec2, 0 ),
 					BufferElementDeclaration( ShaderProgram::Texture, uint32_t( ElementUsage::eTexCoords ), ElementType::eVec2, 1 )
 				}
@@ -81,90 +74,19 @@ namespace castor3d
 
 	OverlayRenderer::~OverlayRenderer()
 	{
-		for ( auto & vertex : m_borderVertex )
-		{
-			vertex.reset();
-		}
-
-		for ( auto & vertex : m_panelVertex )
-		{
-			vertex.reset();
-		}
 	}
 
 	void OverlayRenderer::initialise()
 	{
-		if ( !m_panelVertexBuffer )
-		{
-			// Panel Overlays buffers
-			m_panelVertexBuffer = std::make_shared< VertexBuffer >( *getRenderSystem()->getEngine(), m_declaration );
-			uint32_t stride = m_declaration.stride();
-			m_panelVertexBuffer->resize( uint32_t( m_panelVertex.size() * stride ) );
-			uint8_t * buffer = m_panelVertexBuffer->getData();
-
-			for ( auto & vertex : m_panelVertex )
-			{
-				vertex = std::make_shared< BufferElementGroup >( buffer );
-				buffer += stride;
-			}
-
-			m_panelVertexBuffer->initialise( BufferAccessType::eDynamic, BufferAccessNature::eDraw );
-
-			{
-				auto & pipeline = doGetPanelPipeline( 0u );
-				m_panelGeometryBuffers.m_noTexture = getRenderSystem()->createGeometryBuffers( Topology::eTriangles, pipeline.getProgram() );
-				m_panelGeometryBuffers.m_noTexture->initialise( { *m_panelVertexBuffer }, nullptr );
-			}
-			{
-				auto & pipeline = doGetPanelPipeline( uint32_t( TextureChannel::eDiffuse ) );
-				m_panelGeometryBuffers.m_textured = getRenderSystem()->createGeometryBuffers( Topology::eTriangles, pipeline.getProgram() );
-				m_panelGeometryBuffers.m_textured->initialise( { *m_panelVertexBuffer }, nullptr );
-			}
-		}
-
-		if ( !m_borderVertexBuffer )
+		if ( !m_vertexBuffer )
 		{
-			// Border Overlays buffers
-			m_borderVertexBuffer = std::make_shared< VertexBuffer >( *getRenderSystem()->getEngine(), m_declaration );
-			uint32_t stride = m_declaration.stride();
-			m_borderVertexBuffer->resize( uint32_t( m_borderVertex.size() * stride ) );
-			uint8_t * buffer = m_borderVertexBuffer->getData();
-
-			for ( auto & vertex : m_borderVertex )
-			{
-				vertex = std::make_shared< BufferElementGroup >( buffer );
-				buffer += stride;
-			}
-
-			m_borderVertexBuffer->initialise( BufferAccessType::eDynamic, BufferAccessNature::eDraw );
-
-			{
-				auto & pipeline = doGetPanelPipeline( 0 );
-				m_borderGeometryBuffers.m_noTexture = getRenderSystem()->createGeometryBuffers( Topology::eTriangles, pipeline.getProgram() );
-				m_borderGeometryBuffers.m_noTexture->initialise( { *m_borderVertexBuffer }, nullptr );
-			}
-			{
-				auto & pipeline = doGetPanelPipeline( uint32_t( TextureChannel::eDiffuse ) );
-				m_borderGeometryBuffers.m_textured = getRenderSystem()->createGeometryBuffers( Topology::eTriangles, pipeline.getProgram() );
-				m_borderGeometryBuffers.m_textured->initialise( { *m_borderVertexBuffer }, nullptr );
-			}
+			doCreateVertexBuffer( MinVertexCount );
 		}
-
-		// create one text overlays buffer
-		doCreateTextGeometryBuffers();
 	}
 
 	void OverlayRenderer::cleanup()
 	{
-		for ( auto & vertex : m_borderVertex )
-		{
-			vertex.reset();
-		}
-
-		for ( auto & vertex : m_panelVertex )
-		{
-			vertex.reset();
-		}
+		doDestroyVertexBuffer();
 
 		for ( auto & pair : m_pipelines )
 		{
@@ -176,41 +98,10 @@ namespace castor3d
 		m_pipelines.clear();
 		m_mapPanelNodes.clear();
 		m_mapTextNodes.clear();
-
-		if ( m_panelVertexBuffer )
-		{
-			m_panelGeometryBuffers.m_noTexture->cleanup();
-			m_panelGeometryBuffers.m_textured->cleanup();
-			m_panelGeometryBuffers.m_noTexture.reset();
-			m_panelGeometryBuffers.m_textured.reset();
-			m_panelVertexBuffer->cleanup();
-			m_panelVertexBuffer.reset();
-		}
-
-		if ( m_borderVertexBuffer )
-		{
-			m_borderGeometryBuffers.m_noTexture->cleanup();
-			m_borderGeometryBuffers.m_textured->cleanup();
-			m_borderGeometryBuffers.m_noTexture.reset();
-			m_borderGeometryBuffers.m_textured.reset();
-			m_borderVertexBuffer->cleanup();
-			m_borderVertexBuffer.reset();
-		}
-
-		for ( auto & buffer : m_textsGeometryBuffers )
-		{
-			buffer.m_noTexture->cleanup();
-			buffer.m_textured->cleanup();
-		}
-
-		m_textsGeometryBuffers.clear();
-
-		for ( auto buffer : m_textsVertexBuffers )
-		{
-			buffer->cleanup();
-		}
-
-		m_textsVertexBuffers.clear();
+		m_overlaysVertices.clear();
+		m_queue.clear();
+		m_batches.clear();
+		m_vertex.clear();
 	}
 
 	void OverlayRenderer::drawPanel( PanelOverlay & overlay )
@@ -219,15 +110,11 @@ namespace castor3d
 
 		if ( material )
 		{
-			m_overlayUbo.setPosition( overlay.getAbsolutePosition()
-				, m_size
-				, overlay.getRenderRatio( m_size ) );
-			doDrawItem( *material
-				, *m_panelVertexBuffer
-				, m_panelGeometryBuffers
-				, doFillBuffers( overlay.getPanelVertex().begin()
-					, uint32_t( overlay.getPanelVertex().size() )
-					, *m_panelVertexBuffer ) );
+			doQueue( overlay
+				, 0u
+				, *material
+				, nullptr
+				, overlay.getPanelVertex() );
 		}
 	}
 
@@ -238,15 +125,11 @@ namespace castor3d
 
 			if ( material )
 			{
-				m_overlayUbo.setPosition( overlay.getAbsolutePosition()
-					, m_size
-					, overlay.getRenderRatio( m_size ) );
-				doDrawItem( *material
-					, *m_panelVertexBuffer
-					, m_panelGeometryBuffers
-					, doFillBuffers( overlay.getPanelVertex().begin()
-						, uint32_t( overlay.getPanelVertex().size() )
-						, *m_panelVertexBuffer ) );
+				doQueue( overlay
+					, 0u
+					, *material
+					, nullptr
+					, overlay.getPanelVertex() );
 			}
 		}
 		{
@@ -254,90 +137,30 @@ namespace castor3d
 
 			if ( material )
 			{
-				m_overlayUbo.setPosition( overlay.getAbsolutePosition()
-					, m_size
-					, overlay.getRenderRatio( m_size ) );
-				doDrawItem( *material
-					, *m_borderVertexBuffer
-					, m_borderGeometryBuffers
-					, doFillBuffers( overlay.getBorderVertex().begin()
-						, uint32_t( overlay.getBorderVertex().size() )
-						, *m_borderVertexBuffer ) );
+				doQueue( overlay
+					, 1u
+					, *material
+					, nullptr
+					, overlay.getBorderVertex() );
 			}
 		}
 	}
 
 	void OverlayRenderer::drawText( TextOverlay & overlay )
 	{
-		FontSPtr pFont = overlay.getFontTexture()->getFont();
+		auto fontTexture = overlay.getFontTexture();
 
-		if ( pFont )
+		if ( fontTexture && fontTexture->getFont() )
 		{
 			MaterialSPtr material = overlay.getMaterial();
 
 			if ( material )
 			{
-				TextOverlay::VertexArray arrayVtx = overlay.getTextVertex();
-				int32_t count = uint32_t( arrayVtx.size() );
-				uint32_t index = 0;
-				std::vector< OverlayGeometryBuffers > geometryBuffers;
-				std::vector< VertexBufferSPtr > vertexBuffers;
-				TextOverlay::VertexArray::const_iterator it = arrayVtx.begin();
-
-				while ( count > C3D_MAX_CHARS_PER_BUFFER )
-				{
-					geometryBuffers.push_back( doFillTextPart( count, it, index ) );
-					vertexBuffers.push_back( m_textsVertexBuffers[index] );
-					++index;
-					count -= C3D_MAX_CHARS_PER_BUFFER;
-				}
-
-				if ( count > 0 )
-				{
-					geometryBuffers.push_back( doFillTextPart( count, it, index ) );
-					vertexBuffers.push_back( m_textsVertexBuffers[index] );
-				}
-
-				auto texture = overlay.getFontTexture()->getTexture();
-				auto sampler = overlay.getFontTexture()->getSampler();
-				count = uint32_t( arrayVtx.size() );
-				m_overlayUbo.setPosition( overlay.getAbsolutePosition()
-					, m_size
-					, overlay.getRenderRatio( m_size ) );
-
-				for ( auto pass : *material )
-				{
-					auto itV = vertexBuffers.begin();
-
-					if ( checkFlag( pass->getTextureFlags(), TextureChannel::eDiffuse ) )
-					{
-						for ( auto geoBuffers : geometryBuffers )
-						{
-							doDrawItem( *pass
-								, *( *itV )
-								, *geoBuffers.m_textured
-								, *texture
-								, *sampler
-								, std::min( count, C3D_MAX_CHARS_PER_BUFFER ) );
-							count -= C3D_MAX_CHARS_PER_BUFFER;
-							++itV;
-						}
-					}
-					else
-					{
-						for ( auto geoBuffers : geometryBuffers )
-						{
-							doDrawItem( *pass
-								, *( *itV )
-								, *geoBuffers.m_noTexture
-								, *texture
-								, *sampler
-								, std::min( count, C3D_MAX_CHARS_PER_BUFFER ) );
-							count -= C3D_MAX_CHARS_PER_BUFFER;
-							++itV;
-						}
-					}
-				}
+				doQueue( overlay
+					, 0u
+					, *material
+					, fontTexture.get()
+					, overlay.getTextVertex() );
 			}
 		}
 	}
@@ -353,10 +176,40 @@ namespace castor3d
 		}
 
 		m_matrixUbo.update( viewport.getProjection() );
+		m_queue.clear();
+		m_drawCalls = 0u;
 	}
 
 	void OverlayRenderer::endRender()
 	{
+		doFillVertexBuffer();
+
+		// The overlays positions and ratios are already applied to the vertices.
+		m_overlayUbo.setPosition( Point2d{}
+			, m_size
+			, Point2f{ 1.0f, 1.0f } );
+
+		for ( auto & batch : m_batches )
+		{
+			doDrawBatch( batch );
+		}
+
+		// Forget the overlays that were not drawn this frame.
+		auto it = m_overlaysVertices.begin();
+
+		while ( it != m_overlaysVertices.end() )
+		{
+			if ( it->second.m_used )
+			{
+				it->second.m_used = false;
+				++it;
+			}
+			else
+			{
+				it = m_overlaysVertices.erase( it );
+			}
+		}
+
 		m_sizeChanged = false;
 	}
 
@@ -479,118 +332,289 @@ namespace castor3d
 		return *it->second;
 	}
 
-	OverlayRenderer::OverlayGeometryBuffers OverlayRenderer::doCreateTextGeometryBuffers()
+	void OverlayRenderer::doCreateVertexBuffer( uint32_t count )
 	{
-		auto vertexBuffer = std::make_shared< VertexBuffer >( *getRenderSystem()->getEngine(), m_textDeclaration );
-		vertexBuffer->resize( C3D_MAX_CHARS_PER_BUFFER * m_textDeclaration.stride() );
-		vertexBuffer->initialise( BufferAccessType::eDynamic, BufferAccessNature::eDraw );
+		m_vertexBuffer = std::make_shared< VertexBuffer >( *getRenderSystem()->getEngine(), m_declaration );
+		m_vertexBuffer->resize( count * m_declaration.stride() );
+		m_vertexBuffer->initialise( BufferAccessType::eDynamic, BufferAccessNature::eDraw );
+		m_vertex.resize( count );
 
-		OverlayGeometryBuffers geometryBuffers;
+		auto create = [this]( RenderPipeline & pipeline )
 		{
-			auto & pipeline = doGetTextPipeline( 0 );
-			geometryBuffers.m_noTexture = getRenderSystem()->createGeometryBuffers( Topology::eTriangles, pipeline.getProgram() );
-			geometryBuffers.m_noTexture->initialise( { *vertexBuffer }, nullptr );
-		}
+			auto result = getRenderSystem()->createGeometryBuffers( Topology::eTriangles, pipeline.getProgram() );
+			result->initialise( { *m_vertexBuffer }, nullptr );
+			return result;
+		};
+		m_panelGeometryBuffers.m_noTexture = create( doGetPanelPipeline( 0u ) );
+		m_panelGeometryBuffers.m_textured = create( doGetPanelPipeline( uint32_t( TextureChannel::eDiffuse ) ) );
+		m_textGeometryBuffers.m_noTexture = create( doGetTextPipeline( 0u ) );
+		m_textGeometryBuffers.m_textured = create( doGetTextPipeline( uint32_t( TextureChannel::eDiffuse ) ) );
+
+		// The new buffer content is undefined, every overlay must be uploaded again.
+		for ( auto & pair : m_overlaysVertices )
 		{
-			auto & pipeline = doGetTextPipeline( uint32_t( TextureChannel::eDiffuse ) );
-			geometryBuffers.m_textured = getRenderSystem()->createGeometryBuffers( Topology::eTriangles, pipeline.getProgram() );
-			geometryBuffers.m_textured->initialise( { *vertexBuffer }, nullptr );
+			pair.second.m_first = ~( 0u );
 		}
-
-		m_textsVertexBuffers.push_back( std::move( vertexBuffer ) );
-		m_textsGeometryBuffers.push_back( geometryBuffers );
-		return geometryBuffers;
 	}
 
-	void OverlayRenderer::doDrawItem( Pass & pass
-		, VertexBuffer const & vertexBuffer
-		, GeometryBuffers const & geometryBuffers
-		, uint32_t count )
+	void OverlayRenderer::doDestroyVertexBuffer()
 	{
-		auto & node = doGetPanelNode( pass );
-		m_overlayUbo.update( pass.getId() );
-		node.m_pipeline.apply();
-		pass.bindTextures();
-		geometryBuffers.draw( count, 0u );
-		pass.unbindTextures();
+		if ( m_vertexBuffer )
+		{
+			for ( auto buffers : { &m_panelGeometryBuffers, &m_textGeometryBuffers } )
+			{
+				buffers->m_noTexture->cleanup();
+				buffers->m_textured->cleanup();
+				buffers->m_noTexture.reset();
+				buffers->m_textured.reset();
+			}
+
+			m_vertexBuffer->cleanup();
+			m_vertexBuffer.reset();
+		}
 	}
 
-	void OverlayRenderer::doDrawItem( Pass & pass
-		, VertexBuffer const & vertexBuffer
-		, GeometryBuffers const & geometryBuffers
-		, TextureLayout const & texture
-		, Sampler const & sampler
-		, uint32_t count )
+	template< typename VertexT >
+	void OverlayRenderer::doQueue( OverlayCategory const & overlay
+		, uint32_t part
+		, Material & material
+		, FontTexture * fontTexture
+		, std::vector< VertexT > const & vertex )
 	{
-		auto & node = doGetTextNode( pass );
+		// Keyed on the overlay id, since a destroyed overlay's address can be reused by a new one.
+		auto & vertices = m_overlaysVertices[OverlayVerticesKey{ overlay.getId(), part }];
+		auto position = overlay.getAbsolutePosition();
+		auto ratio = overlay.getRenderRatio( m_size );
+
+		if ( vertices.m_vertex.empty()
+			|| vertices.m_version != overlay.getBuffersVersion()
+			|| vertices.m_position != position
+			|| vertices.m_ratio != ratio )
+		{
+			vertices.m_version = overlay.getBuffersVersion();
+			vertices.m_position = position;
+			vertices.m_ratio = ratio;
+			vertices.m_vertex.clear();
+			vertices.m_vertex.reserve( vertex.size() );
+
+			vertices.m_min = Point2f{ std::numeric_limits< float >::max(), std::numeric_limits< float >::max() };
+			vertices.m_max = Point2f{ std::numeric_limits< float >::lowest(), std::numeric_limits< float >::lowest() };
+
+			for ( auto & v : vertex )
+			{
+				vertices.m_vertex.push_back( doBakeVertex( v, position, ratio ) );
+				auto & coords = vertices.m_vertex.back().coords;
+				vertices.m_min[0] = std::min( vertices.m_min[0], coords[0] );
+				vertices.m_min[1] = std::min( vertices.m_min[1], coords[1] );
+				vertices.m_max[0] = std::max( vertices.m_max[0], coords[0] );
+				vertices.m_max[1] = std::max( vertices.m_max[1], coords[1] );
+			}
+
+			vertices.m_changed = true;
+		}
 
-		auto textureVariable = node.m_pipeline.getProgram().findUniform< UniformType::eSampler >( ShaderProgram::MapText, ShaderType::ePixel );
+		vertices.m_used = true;
 
-		if ( textureVariable )
+		if ( !vertices.m_vertex.empty() )
 		{
-			textureVariable->setValue( LightBufferIndex );
+			m_queue.push_back( OverlayDrawItem{ overlay.getLevel()
+				, uint32_t( m_queue.size() )
+				, &material
+				, fontTexture
+				, &vertices
+				, 0u } );
 		}
-
-		m_overlayUbo.update( pass.getId() );
-		node.m_pipeline.apply();
-		pass.bindTextures();
-		texture.bind( LightBufferIndex );
-		sampler.bind( LightBufferIndex );
-		geometryBuffers.draw( count, 0u );
-		sampler.unbind( LightBufferIndex );
-		texture.unbind( LightBufferIndex );
-		pass.unbindTextures();
 	}
 
-	void OverlayRenderer::doDrawItem( Material & material
-		, VertexBuffer const & vertexBuffer
-		, OverlayRenderer::OverlayGeometryBuffers const & geometryBuffers
-		, uint32_t count )
+	void OverlayRenderer::doGroupQueue()
 	{
-		for ( auto pass : material )
+		// Children are drawn over their parents, so the levels are never mixed.
+		std::sort( m_queue.begin()
+			, m_queue.end()
+			, []( OverlayDrawItem const & lhs, OverlayDrawItem const & rhs )
+			{
+				return lhs.m_level < rhs.m_level
+					|| ( lhs.m_level == rhs.m_level
+						&& lhs.m_index < rhs.m_index );
+			} );
+		auto overlaps = []( OverlayGroup const & group, OverlayVertices const & vertices )
+		{
+			return group.m_min[0] < vertices.m_max[0] && vertices.m_min[0] < group.m_max[0]
+				&& group.m_min[1] < vertices.m_max[1] && vertices.m_min[1] < group.m_max[1];
+		};
+		uint32_t levelBegin = 0u;
+
+		for ( auto & item : m_queue )
 		{
-			if ( checkFlag( pass->getTextureFlags(), TextureChannel::eDiffuse ) )
+			if ( item.m_level != m_queue[levelBegin].m_level )
+			{
+				levelBegin = uint32_t( &item - m_queue.data() );
+				m_groups.clear();
+			}
+
+			// The groups are created in queue order, so the result never depends on the materials or fonts addresses.
+			auto & vertices = *item.m_vertices;
+			auto it = m_groups.rbegin();
+
+			while ( it != m_groups.rend()
+				&& ( it->m_material != item.m_material || it->m_fontTexture != item.m_fontTexture )
+				&& !overlaps( *it, vertices ) )
 			{
-				doDrawItem( *pass
-					, vertexBuffer
-					, *geometryBuffers.m_textured
-					, count );
+				++it;
+			}
+
+			if ( it != m_groups.rend()
+				&& it->m_material == item.m_material
+				&& it->m_fontTexture == item.m_fontTexture )
+			{
+				it->m_min[0] = std::min( it->m_min[0], vertices.m_min[0] );
+				it->m_min[1] = std::min( it->m_min[1], vertices.m_min[1] );
+				it->m_max[0] = std::max( it->m_max[0], vertices.m_max[0] );
+				it->m_max[1] = std::max( it->m_max[1], vertices.m_max[1] );
+				item.m_group = levelBegin + uint32_t( std::distance( it, m_groups.rend() ) - 1 );
 			}
 			else
 			{
-				doDrawItem( *pass
-					, vertexBuffer
-					, *geometryBuffers.m_noTexture
-					, count );
+				item.m_group = levelBegin + uint32_t( m_groups.size() );
+				m_groups.push_back( OverlayGroup{ item.m_material
+					, item.m_fontTexture
+					, vertices.m_min
+					, vertices.m_max } );
 			}
 		}
+
+		m_groups.clear();
+		// The group indices are offset by their level's first item, so they also sort the levels.
+		std::sort( m_queue.begin()
+			, m_queue.end()
+			, []( OverlayDrawItem const & lhs, OverlayDrawItem const & rhs )
+			{
+				return lhs.m_group < rhs.m_group
+					|| ( lhs.m_group == rhs.m_group
+						&& lhs.m_index < rhs.m_index );
+			} );
 	}
 
-	OverlayRenderer::OverlayGeometryBuffers OverlayRenderer::doFillTextPart( int32_t count
-		, TextOverlay::VertexArray::const_iterator & it
-		, uint32_t index )
+	void OverlayRenderer::doFillVertexBuffer()
 	{
-		OverlayGeometryBuffers geometryBuffers;
+		doGroupQueue();
+		uint32_t count = 0u;
 
-		if ( m_textsGeometryBuffers.size() <= index )
+		for ( auto & item : m_queue )
 		{
-			doCreateTextGeometryBuffers();
+			count += uint32_t( item.m_vertices->m_vertex.size() );
 		}
 
-		if ( m_textsGeometryBuffers.size() > index )
+		if ( m_vertex.size() < count )
 		{
-			geometryBuffers = m_textsGeometryBuffers[index];
-			auto & vertexBuffer = m_textsVertexBuffers[index];
-			count = std::min( count, C3D_MAX_CHARS_PER_BUFFER );
-			doFillBuffers( it, count, *vertexBuffer );
-			it += count;
+			auto capacity = std::max( MinVertexCount, uint32_t( m_vertex.size() ) );
+
+			while ( capacity < count )
+			{
+				capacity *= 2u;
+			}
+
+			doDestroyVertexBuffer();
+			doCreateVertexBuffer( capacity );
 		}
-		else
+
+		// Only the overlays that changed or moved in the buffer are written, in a single upload.
+		m_batches.clear();
+		uint32_t first = 0u;
+		uint32_t dirtyBegin = count;
+		uint32_t dirtyEnd = 0u;
+
+		for ( auto & item : m_queue )
 		{
-			CASTOR_EXCEPTION( "Bad index for geometry buffers" );
+			auto & vertices = *item.m_vertices;
+			auto size = uint32_t( vertices.m_vertex.size() );
+
+			if ( vertices.m_changed || vertices.m_first != first )
+			{
+				std::copy( vertices.m_vertex.begin()
+					, vertices.m_vertex.end()
+					, m_vertex.begin() + first );
+				dirtyBegin = std::min( dirtyBegin, first );
+				dirtyEnd = std::max( dirtyEnd, first + size );
+				vertices.m_first = first;
+				vertices.m_changed = false;
+			}
+
+			// The items of a group are adjacent once sorted, each group gives one batch.
+			if ( !m_batches.empty()
+				&& m_batches.back().m_material == item.m_material
+				&& m_batches.back().m_fontTexture == item.m_fontTexture )
+			{
+				m_batches.back().m_count += size;
+			}
+			else
+			{
+				m_batches.push_back( OverlayBatch{ item.m_material
+					, item.m_fontTexture
+					, first
+					, size } );
+			}
+
+			first += size;
 		}
 
-		return geometryBuffers;
+		if ( dirtyBegin < dirtyEnd )
+		{
+			auto stride = uint32_t( sizeof( TextOverlay::Vertex ) );
+			m_vertexBuffer->bind();
+			m_vertexBuffer->upload( dirtyBegin * stride
+				, ( dirtyEnd - dirtyBegin ) * stride
+				, reinterpret_cast< uint8_t const * >( m_vertex.data() + dirtyBegin ) );
+			m_vertexBuffer->unbind();
+		}
+	}
+
+	void OverlayRenderer::doDrawBatch( OverlayBatch const & batch )
+	{
+		for ( auto pass : *batch.m_material )
+		{
+			bool textured = checkFlag( pass->getTextureFlags(), TextureChannel::eDiffuse );
+
+			if ( batch.m_fontTexture )
+			{
+				auto & node = doGetTextNode( *pass );
+				auto & geometryBuffers = textured
+					? *m_textGeometryBuffers.m_textured
+					: *m_textGeometryBuffers.m_noTexture;
+				auto & texture = *batch.m_fontTexture->getTexture();
+				auto & sampler = *batch.m_fontTexture->getSampler();
+				auto textureVariable = node.m_pipeline.getProgram().findUniform< UniformType::eSampler >( ShaderProgram::MapText, ShaderType::ePixel );
+
+				if ( textureVariable )
+				{
+					textureVariable->setValue( LightBufferIndex );
+				}
+
+				m_overlayUbo.update( pass->getId() );
+				node.m_pipeline.apply();
+				pass->bindTextures();
+				texture.bind( LightBufferIndex );
+				sampler.bind( LightBufferIndex );
+				geometryBuffers.draw( batch.m_count, batch.m_first );
+				sampler.unbind( LightBufferIndex );
+				texture.unbind( LightBufferIndex );
+				pass->unbindTextures();
+			}
+			else
+			{
+				auto & node = doGetPanelNode( *pass );
+				auto & geometryBuffers = textured
+					? *m_panelGeometryBuffers.m_textured
+					: *m_panelGeometryBuffers.m_noTexture;
+				m_overlayUbo.update( pass->getId() );
+				node.m_pipeline.apply();
+				pass->bindTextures();
+				geometryBuffers.draw( batch.m_count, batch.m_first );
+				pass->unbindTextures();
+			}
+
+			++m_drawCalls;
+		}
 	}
 
 	ShaderProgramSPtr OverlayRenderer::doCreateOverlayProgram( TextureChannels const & textureFlags )
@@ -62,28 +62,28 @@ namespace castor3d
 		C3D_API void cleanup();
 		/**
 		 *\~english
-		 *\brief		Function to draw a PanelOverlay.
+		 *\brief		Queues a PanelOverlay for the current frame.
 		 *\param[in]	overlay	The overlay to draw.
 		 *\~french
-		 *\brief		Fonction de dessin d'un PanelOverlay.
+		 *\brief		Ajoute un PanelOverlay à la file de l'image courante.
 		 *\param[in]	overlay	L'incrustation à dessiner.
 		 */
 		C3D_API void drawPanel( PanelOverlay & overlay );
 		/**
 		 *\~english
-		 *\brief		Function to draw a BorderPanelOverlay.
+		 *\brief		Queues a BorderPanelOverlay for the current frame.
 		 *\param[in]	overlay	The overlay to draw.
 		 *\~french
-		 *\brief		Fonction de dessin d'un BorderPanelOverlay.
+		 *\brief		Ajoute un BorderPanelOverlay à la file de l'image courante.
 		 *\param[in]	overlay	L'incrustation à dessiner.
 		 */
 		C3D_API void drawBorderPanel( BorderPanelOverlay & overlay );
 		/**
 		 *\~english
-		 *\brief		Function to draw a TextOverlay.
+		 *\brief		Queues a TextOverlay for the current frame.
 		 *\param[in]	overlay	The overlay to draw.
 		 *\~french
-		 *\brief		Fonction de dessin d'un TextOverlay.
+		 *\brief		Ajoute un TextOverlay à la file de l'image courante.
 		 *\param[in]	overlay	L'incrustation à dessiner.
 		 */
 		C3D_API void drawText( TextOverlay & overlay );
@@ -99,8 +99,12 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Ends the overlays rendering.
+		 *\remarks		The queued overlays are sorted by level, then by queue order,
+		 *				their vertices are written in the frame vertex buffer, and the adjacent ones sharing material and font are drawn as one batch.
 		 *\~french
 		 *\brief		Termine le rendu des incrustations.
+		 *\remarks		Les incrustations en file sont triées par niveau, puis par ordre d'ajout,
+		 *				leurs sommets sont écrits dans le tampon de sommets de l'image, et celles adjacentes partageant matériau et police sont dessinées en un lot.
 		 */
 		C3D_API void endRender();
 		/**
@@ -123,6 +127,16 @@ namespace castor3d
 		{
 			return m_sizeChanged;
 		}
+		/**
+		 *\~english
+		 *\return		The draw calls count for the last rendered frame.
+		 *\~french
+		 *\return		Le nombre d'appels de dessin pour la dernière image rendue.
+		 */
+		uint32_t getDrawCalls()const
+		{
+			return m_drawCalls;
+		}
 
 	protected:
 		/*!
@@ -154,6 +168,82 @@ namespace castor3d
 			GeometryBuffersSPtr m_noTexture;
 			GeometryBuffersSPtr m_textured;
 		};
+		/*!
+		\author 	Sylvain DOREMUS
+		\date 		22/12/2017
+		\version	0.10.0
+		\~english
+		\brief		An overlay vertices, with the overlay position and render ratio applied.
+		\remarks		They are regenerated only when the overlay's buffers version, position or ratio change,
+					and uploaded only when regenerated or moved in the frame vertex buffer.
+		\~french
+		\brief		Les sommets d'une incrustation, avec la position et le ratio de rendu de l'incrustation appliqués.
+		\remarks		Ils ne sont regénérés que lorsque la version des tampons, la position ou le ratio de l'incrustation changent,
+					et transférés que lorsqu'ils sont regénérés ou déplacés dans le tampon de sommets de l'image.
+		*/
+		struct OverlayVertices
+		{
+			uint32_t m_version{ 0u };
+			castor::Point2d m_position;
+			castor::Point2f m_ratio;
+			TextOverlay::VertexArray m_vertex;
+			castor::Point2f m_min;
+			castor::Point2f m_max;
+			uint32_t m_first{ ~( 0u ) };
+			bool m_changed{ true };
+			bool m_used{ false };
+		};
+		/*!
+		\author 	Sylvain DOREMUS
+		\date 		22/12/2017
+		\version	0.10.0
+		\~english
+		\brief		An overlay part queued for the current frame.
+		\~french
+		\brief		Une partie d'incrustation dans la file de l'image courante.
+		*/
+		struct OverlayDrawItem
+		{
+			int m_level;
+			uint32_t m_index;
+			Material * m_material;
+			FontTexture * m_fontTexture;
+			OverlayVertices * m_vertices;
+			uint32_t m_group;
+		};
+		/*!
+		\author 	Sylvain DOREMUS
+		\date 		22/12/2017
+		\version	0.10.0
+		\~english
+		\brief		The overlay parts of a level drawn with the same material and font, and the screen area they cover.
+		\~french
+		\brief		Les parties d'incrustations d'un niveau dessinées avec les mêmes matériau et police, et la zone d'écran qu'elles couvrent.
+		*/
+		struct OverlayGroup
+		{
+			Material * m_material;
+			FontTexture * m_fontTexture;
+			castor::Point2f m_min;
+			castor::Point2f m_max;
+		};
+		/*!
+		\author 	Sylvain DOREMUS
+		\date 		22/12/2017
+		\version	0.10.0
+		\~english
+		\brief		A range of the frame vertex buffer drawn with the same material and font.
+		\~french
+		\brief		Un intervalle du tampon de sommets de l'image, dessiné avec les mêmes matériau et police.
+		*/
+		struct OverlayBatch
+		{
+			Material * m_material;
+			FontTexture * m_fontTexture;
+			uint32_t m_first;
+			uint32_t m_count;
+		};
+		using OverlayVerticesKey = std::pair< uint64_t, uint32_t >;
 		/**
 		 *\~english
 		 *\brief		Retrieves a panel program compiled using given pass.
@@ -211,92 +301,69 @@ namespace castor3d
 		C3D_API RenderPipeline & doGetPipeline( TextureChannels const & textureFlags );
 		/**
 		 *\~english
-		 *\brief		Creates a GeometryBuffers that can contain 1000 characters.
-		 *\remarks		adds this GeometryBuffers to the text GeometryBuffers array.
-		 *\return		The created GeometryBuffers.
+		 *\brief		Creates the frame vertex buffer, and the geometry buffers using it.
+		 *\param[in]	count	The vertex buffer capacity, in vertices.
+		 *\~french
+		 *\brief		Crée le tampon de sommets de l'image, et les geometry buffers l'utilisant.
+		 *\param[in]	count	La capacité du tampon de sommets, en sommets.
+		 */
+		C3D_API void doCreateVertexBuffer( uint32_t count );
+		/**
+		 *\~english
+		 *\brief		Destroys the frame vertex buffer, and the geometry buffers using it.
 		 *\~french
-		 *\brief		Crée un GeometryBuffers pouvant contenir 1000 caractères.
-		 *\remarks		Ajoute de GeometryBuffers au tableau de GeometryBuffers de texte.
-		 *\return		Le GeometryBuffers créé.
+		 *\brief		Détruit le tampon de sommets de l'image, et les geometry buffers l'utilisant.
 		 */
-		C3D_API OverlayGeometryBuffers doCreateTextGeometryBuffers();
+		C3D_API void doDestroyVertexBuffer();
 		/**
 		 *\~english
-		 *\brief		Function to draw an overlay.
-		 *\param[in]	material		The material.
-		 *\param[in]	vertexBuffer	The overlay vertex buffers.
-		 *\param[in]	geometryBuffers	The overlay geometry buffers.
-		 *\param[in]	count			The vertex count.
+		 *\brief		Queues an overlay part, regenerating its vertices if needed.
+		 *\param[in]	overlay		The overlay.
+		 *\param[in]	part		The overlay part index (a border panel has two parts).
+		 *\param[in]	material	The part material.
+		 *\param[in]	fontTexture	The font texture, \p nullptr for panels.
+		 *\param[in]	vertex		The part vertices, relative to the overlay.
 		 *\~french
-		 *\brief		Fonction de dessin d'une incrustation.
-		 *\param[in]	material		Le matériau.
-		 *\param[in]	vertexBuffer	Le tampon de sommets de l'incrustation.
-		 *\param[in]	geometryBuffers	Les buffer de la géométrie de l'incrustation.
-		 *\param[in]	count			Le nombre de sommets.
+		 *\brief		Ajoute une partie d'incrustation à la file, en regénérant ses sommets si nécessaire.
+		 *\param[in]	overlay		L'incrustation.
+		 *\param[in]	part		L'indice de la partie de l'incrustation (un panneau bordé a deux parties).
+		 *\param[in]	material	Le matériau de la partie.
+		 *\param[in]	fontTexture	La texture de police, \p nullptr pour les panneaux.
+		 *\param[in]	vertex		Les sommets de la partie, relatifs à l'incrustation.
 		 */
-		C3D_API void doDrawItem( Material & material
-			, VertexBuffer const & vertexBuffer
-			, OverlayGeometryBuffers const & geometryBuffers
-			, uint32_t count );
+		template< typename VertexT >
+		void doQueue( OverlayCategory const & overlay
+			, uint32_t part
+			, Material & material
+			, FontTexture * fontTexture
+			, std::vector< VertexT > const & vertex );
 		/**
 		 *\~english
-		 *\brief		Function to draw an overlay.
-		 *\param[in]	pass			The pass.
-		 *\param[in]	vertexBuffer	The overlay vertex buffers.
-		 *\param[in]	geometryBuffers	The overlay geometry buffers.
-		 *\param[in]	count			The vertex count.
+		 *\brief		Groups the queued overlays of each level by material and font.
+		 *\remarks		An overlay joins an earlier group only if it doesn't overlap the groups drawn in between, so the visible result is unchanged.
 		 *\~french
-		 *\brief		Fonction de dessin d'une incrustation.
-		 *\param[in]	pass			La passe.
-		 *\param[in]	vertexBuffer	Le tampon de sommets de l'incrustation.
-		 *\param[in]	geometryBuffers	Les buffer de la géométrie de l'incrustation.
-		 *\param[in]	count			Le nombre de sommets.
+		 *\brief		Regroupe les incrustations en file de chaque niveau par matériau et police.
+		 *\remarks		Une incrustation ne rejoint un groupe précédent que si elle ne recouvre pas les groupes dessinés entre les deux, le résultat visible est donc inchangé.
 		 */
-		C3D_API void doDrawItem( Pass & pass
-			, VertexBuffer const & vertexBuffer
-			, GeometryBuffers const & geometryBuffers
-			, uint32_t count );
+		C3D_API void doGroupQueue();
 		/**
 		 *\~english
-		 *\brief		Function to draw a text overlay.
-		 *\param[in]	pass			The pass.
-		 *\param[in]	vertexBuffer	The overlay vertex buffers.
-		 *\param[in]	geometryBuffers	The overlay geometry buffers.
-		 *\param[in]	texture			The font texture.
-		 *\param[in]	sampler			The texture sampler.
-		 *\param[in]	count			The vertex count.
+		 *\brief		Writes the queued overlays vertices in the frame vertex buffer, and builds the batches.
+		 *\remarks		Only the ranges that changed since previous frame are uploaded.
 		 *\~french
-		 *\brief		Fonction de dessin d'une incrustation texte.
-		 *\param[in]	pass			La passe.
-		 *\param[in]	vertexBuffer	Le tampon de sommets de l'incrustation.
-		 *\param[in]	geometryBuffers	Les buffer de la géométrie de l'incrustation.
-		 *\param[in]	texture			La texture de polices.
-		 *\param[in]	sampler			L'échantillonneur de la texture.
-		 *\param[in]	count			Le nombre de sommets.
+		 *\brief		Ecrit les sommets des incrustations en file dans le tampon de sommets de l'image, et construit les lots.
+		 *\remarks		Seuls les intervalles ayant changé depuis l'image précédente sont transférés.
 		 */
-		C3D_API void doDrawItem( Pass & pass
-			, VertexBuffer const & vertexBuffer
-			, GeometryBuffers const & geometryBuffers
-			, TextureLayout const & texture
-			, Sampler const & sampler
-			, uint32_t count );
+		C3D_API void doFillVertexBuffer();
 		/**
 		 *\~english
-		 *\brief		Fills a GeometryBuffers from a part of a text vertex array
-		 *\param[in]	count	The number of vertex to copy in the GeometryBuffers
-		 *\param[in]	it		The beginning of the vertex array
-		 *\param[in]	index	The current index in the text GeometryBuffers array
-		 *\return		The used GeometryBuffers.
+		 *\brief		Draws a batch, once per material pass.
+		 *\param[in]	batch	The batch.
 		 *\~french
-		 *\brief		Remplit un GeometryBuffers d'une partie d'un tableau de sommets pour texte
-		 *\param[in]	count	Le nombre de sommets à copier dans le GeometryBuffers
-		 *\param[in]	it		Le début du tableau de sommets
-		 *\param[in]	index	L'indice courant dans le tableau de GeometryBuffers de texte
-		 *\return		Le GeometryBuffers utilisé.
+		 *\brief		Dessine un lot, une fois par passe du matériau.
+		 *\param[in]	batch	Le lot.
 		 */
-		C3D_API OverlayGeometryBuffers doFillTextPart( int32_t count
-			, TextOverlay::VertexArray::const_iterator & it
-			, uint32_t index );
+		C3D_API void doDrawBatch( OverlayBatch const & batch );
 		/**
 		 *\~english
 		 *\brief		Creates a shader program for overlays rendering use.
@@ -310,30 +377,36 @@ namespace castor3d
 		C3D_API ShaderProgramSPtr doCreateOverlayProgram( TextureChannels const & textureFlags );
 
 	protected:
-		//!\~english	Vertex buffers for panels.
-		//!\~french		Tampons de sommets pour les panneaux.
-		VertexBufferSPtr m_panelVertexBuffer;
-		//!\~english	Vertex buffers for borders.
-		//!\~french		Tampons de sommets pour les bordures.
-		VertexBufferSPtr m_borderVertexBuffer;
-		//!\~english	The Vertex buffers used to render texts.
-		//!\~french		Les tampons de sommets utilisés pour rendre les textes.
-		std::vector< VertexBufferSPtr > m_textsVertexBuffers;
-		//!\~english	Geometry buffers for panels.
-		//!\~french		Tampons de géometrie pour les panneaux.
+		//!\~english	The vertex buffer holding all the overlays vertices for a frame.
+		//!\~french		Le tampon de sommets contenant tous les sommets des incrustations pour une image.
+		VertexBufferSPtr m_vertexBuffer;
+		//!\~english	The geometry buffers used to render panels and borders.
+		//!\~french		Les geometry buffers utilisés pour dessiner les panneaux et les bordures.
 		OverlayGeometryBuffers m_panelGeometryBuffers;
-		//!\~english	Geometry buffers for borders.
-		//!\~french		Tampons de géometrie pour les bordures.
-		OverlayGeometryBuffers m_borderGeometryBuffers;
-		//!\~english	The GeometryBuffers used to render texts.
-		//!\~french		Les GeometryBuffers utilisé pour rendre les textes.
-		std::vector< OverlayGeometryBuffers > m_textsGeometryBuffers;
+		//!\~english	The geometry buffers used to render texts.
+		//!\~french		Les geometry buffers utilisés pour dessiner les textes.
+		OverlayGeometryBuffers m_textGeometryBuffers;
 		//!\~english	The buffer elements declaration.
 		//!\~french		La déclaration des éléments du tampon.
 		BufferDeclaration m_declaration;
-		//!\~english	The text overlay buffer elements declaration.
-		//!\~french		La déclaration des éléments du tampon, pour les textes.
-		BufferDeclaration m_textDeclaration;
+		//!\~english	The CPU copy of the frame vertex buffer.
+		//!\~french		La copie CPU du tampon de sommets de l'image.
+		TextOverlay::VertexArray m_vertex;
+		//!\~english	The overlays vertices, per overlay part.
+		//!\~french		Les sommets des incrustations, par partie d'incrustation.
+		std::map< OverlayVerticesKey, OverlayVertices > m_overlaysVertices;
+		//!\~english	The overlay parts queued for the current frame.
+		//!\~french		Les parties d'incrustations en file pour l'image courante.
+		std::vector< OverlayDrawItem > m_queue;
+		//!\~english	The groups of the level being sorted, kept to avoid reallocating them each frame.
+		//!\~french		Les groupes du niveau en cours de tri, gardés pour éviter de les réallouer à chaque image.
+		std::vector< OverlayGroup > m_groups;
+		//!\~english	The batches of the current frame.
+		//!\~french		Les lots de l'image courante.
+		std::vector< OverlayBatch > m_batches;
+		//!\~english	The draw calls count for the current frame.
+		//!\~french		Le nombre d'appels de dessin pour l'image courante.
+		uint32_t m_drawCalls{ 0u };
 		//!\~english	The current render target size.
 		//!\~french		Les dimensions de la cible du rendu courant.
 		castor::Size m_size;
@@ -361,12 +434,6 @@ namespace castor3d
 		//!\~english	The previously rendered text.
 		//!\~french		Le texte rendu précédemment.
 		castor::String m_previousCaption;
-		//!\~english	Panel overlays vertex array (quad definition).
-		//!\~french		Tableau de vertex (définition du quad) pour les incrustations panneau.
-		std::array< castor3d::BufferElementGroupSPtr, 6 > m_panelVertex;
-		//!\~english	Border panel overlays vertex array (quad definition).
-		//!\~french		Tableau de vertex (définition du quad) pour les incrustations bordure.
-		std::array< castor3d::BufferElementGroupSPtr, 8 * 6 > m_borderVertex;
 		//!\~english	Tells if the render size has changed.
 		//!\~french		Dit si les dimension du rendu ont changé.
 		bool m_sizeChanged{ true };
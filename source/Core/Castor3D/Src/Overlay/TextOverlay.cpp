@@ -206,8 +206,7 @@ namespace castor3d
 
 			getOverlay().getEngine()->postEvent( makeFunctorEvent( EventType::ePreRender, [fontTexture]()
 			{
-				fontTexture->cleanup();
-				fontTexture->initialise();
+				fontTexture->upload();
 			} ) );
 		}
 	}
@@ -243,7 +242,9 @@ namespace castor3d
 					m_arrayVtx.reserve( m_previousCaption.size() * 6 );
 
 					DisplayableLineArray lines = doPrepareText( p_size, size );
-					Size const & texDim = fontTexture->getTexture()->getDimensions();
+					// The UV are computed against the texture on the GPU, the glyphs not uploaded yet are added when the font texture notifies its upload.
+					Size const texDim = fontTexture->getDimensions();
+					bool complete = true;
 
 					for ( auto const & line : lines )
 					{
@@ -262,7 +263,11 @@ namespace castor3d
 								double const leftCrop = std::max( 0.0, -leftUncropped );
 								double const rightCrop = std::max( 0.0, leftUncropped + c.m_size[0] - size[0] );
 
-								if ( leftCrop + rightCrop < c.m_size[0] )
+								if ( !fontTexture->hasGlyph( c.m_glyph.getCharacter() ) )
+								{
+									complete = false;
+								}
+								else if ( leftCrop + rightCrop < c.m_size[0] )
 								{
 									//
 									// Compute Letter's Position.
@@ -322,7 +327,7 @@ namespace castor3d
 						}
 					}
 
-					m_textChanged = false;
+					m_textChanged = !complete;
 				}
 			}
 		}
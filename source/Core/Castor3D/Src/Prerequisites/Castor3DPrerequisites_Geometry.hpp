@@ -115,6 +115,10 @@ namespace castor3d
 	class MeshFactory;
 	DECLARE_SMART_PTR( MeshFactory );
 
+	using MeshHandle = castor::Handle< Mesh >;
+	using SubmeshHandle = castor::Handle< Submesh >;
+	using GeometryHandle = castor::Handle< Geometry >;
+
 	//! Vertex array
 	DECLARE_VECTOR( Vertex, Vertex );
 	//! Vertex pointer array
@@ -530,6 +530,9 @@ namespace castor3d
 	DECLARE_SMART_PTR( Sampler );
 	DECLARE_SMART_PTR( SubsurfaceScattering );
 
+	using MaterialHandle = castor::Handle< Material >;
+	using PassHandle = castor::Handle< Pass >;
+
 	//! Material pointer array
 	DECLARE_VECTOR( MaterialSPtr, MaterialPtr );
 	//! TextureUnit array
@@ -460,6 +460,52 @@ namespace castor3d
 		//!\~french		Tampon stockage pour shader.
 		eShaderStorage,
 	};
+	/*!
+	\author 	Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/12/2017
+	\~english
+	\brief		Shadow casters layers enumeration.
+	\~french
+	\brief		Enumération des couches de projeteurs d'ombres.
+	*/
+	enum class ShadowCaster
+		: uint8_t
+	{
+		//!\~english	Non animated submeshes, cached between frames.
+		//!\~french		Sous-maillages non animés, mis en cache entre les frames.
+		eStatic = 1 << 0,
+		//!\~english	Skinned and morphed submeshes, and billboards, rendered each frame.
+		//!\~french		Sous-maillages animés par squelette ou par sommets, et billboards, dessinés à chaque frame.
+		eDynamic = 1 << 1,
+		//!\~english	All casters.
+		//!\~french		Tous les projeteurs.
+		eAll = eStatic | eDynamic,
+	};
+	IMPLEMENT_FLAGS( ShadowCaster )
+	/*!
+	\author 	Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/12/2017
+	\~english
+	\brief		Environment maps update policies enumeration.
+	\~french
+	\brief		Enumération des politiques de mise à jour des textures d'environnement.
+	*/
+	enum class EnvironmentMapUpdate
+		: uint8_t
+	{
+		//!\~english	Rendered once, then only when explicitly invalidated.
+		//!\~french		Dessinée une fois, puis seulement lorsqu'explicitement invalidée.
+		eStatic,
+		//!\~english	Rendered when the probe moves, or when the scene changes inside the probe radius.
+		//!\~french		Dessinée lorsque la sonde bouge, ou lorsque la scène change dans le rayon de la sonde.
+		eOnChange,
+		//!\~english	A few faces rendered each frame, under the technique's global faces budget.
+		//!\~french		Quelques faces dessinées à chaque frame, selon le budget global de faces de la technique.
+		eTimeSliced,
+		CASTOR_SCOPED_ENUM_BOUNDS( eStatic )
+	};
 	/**
 	 *\~english
 	 *\brief		gets the name of the given element type.
@@ -499,6 +545,7 @@ namespace castor3d
 	class DepthStencilState;
 	class EnvironmentMap;
 	class EnvironmentMapPass;
+	class FrameCapture;
 	class GeometryBuffers;
 	class GpuBuffer;
 	class GpuInformations;
@@ -552,6 +599,7 @@ namespace castor3d
 	DECLARE_SMART_PTR( DepthStencilState );
 	DECLARE_SMART_PTR( EnvironmentMap );
 	DECLARE_SMART_PTR( EnvironmentMapPass );
+	DECLARE_SMART_PTR( FrameCapture );
 	DECLARE_SMART_PTR( GeometryBuffers );
 	DECLARE_SMART_PTR( GpuBuffer );
 	DECLARE_SMART_PTR( IblTextures );
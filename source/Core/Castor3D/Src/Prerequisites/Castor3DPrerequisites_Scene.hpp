@@ -81,6 +81,9 @@ namespace castor3d
 		//!\~english	PCF filtering.
 		//!\~french		Filtrage PCF.
 		eShadowFilterPcf = 0x004,
+		//!\~english	Point and spot lights are read from the light clusters.
+		//!\~french		Les sources omnidirectionnelles et projecteurs sont lus depuis les clusters de lumières.
+		eLightClusters = 0x008,
 		CASTOR_SCOPED_ENUM_BOUNDS( eNone )
 	};
 	IMPLEMENT_FLAGS( SceneFlag )
@@ -146,8 +149,10 @@ namespace castor3d
 	};
 
 	class Scene;
+	class ChangeJournal;
 	class SceneLoader;
 	class SceneNode;
+	class SceneNodePool;
 	class SceneFileContext;
 	class SceneFileParser;
 	class Skybox;
@@ -173,6 +178,9 @@ namespace castor3d
 	class BillboardList;
 
 	DECLARE_SMART_PTR( SceneNode );
+	using SceneNodeHandle = castor::Handle< SceneNode >;
+	DECLARE_SMART_PTR( SceneNodePool );
+	DECLARE_SMART_PTR( ChangeJournal );
 	DECLARE_SMART_PTR( Scene );
 	DECLARE_SMART_PTR( SceneFileContext );
 	DECLARE_SMART_PTR( SceneFileParser );
@@ -236,6 +244,7 @@ namespace castor3d
 	using SubmeshBoundingBoxMap = std::map< Submesh const *, castor::BoundingBox >;
 	using SubmeshBoundingSphereMap = std::map< Submesh const *, castor::BoundingSphere >;
 	using SubmeshMaterialMap = std::map< Submesh const *, MaterialWPtr >;
+	using SubmeshMaterialHandleMap = std::map< Submesh const *, MaterialHandle >;
 
 	//@}
 }
@@ -8,7 +8,9 @@ namespace castor3d
 {
 	static uint32_t constexpr PassBufferIndex = 0u;
 	static uint32_t constexpr LightBufferIndex = 1u;
-	static uint32_t constexpr MinTextureIndex = 2u;
+	static uint32_t constexpr LightClustersIndex = 2u;
+	static uint32_t constexpr LightIndicesIndex = 3u;
+	static uint32_t constexpr MinTextureIndex = 4u;
 
 	/**@name Shader */
 	//@{
@@ -728,6 +730,7 @@ namespace castor3d
 
 		static constexpr uint32_t SpotShadowMapCount = 10u;
 		static constexpr uint32_t PointShadowMapCount = 6u;
+		static constexpr uint32_t DirectionalCascadesCount = 4u;
 		static constexpr int BaseLightComponentsCount = 2;
 		static constexpr int MaxLightComponentsCount = 14;
 		static constexpr float LightComponentsOffset = MaxLightComponentsCount * 0.001f;
@@ -0,0 +1,220 @@
+#include "FrameCapture.hpp"
+
+#include "FrameBuffer/ReadbackBuffer.hpp"
+#include "Render/RenderSystem.hpp"
+
+#include <Graphics/PixelBufferBase.hpp>
+
+using namespace castor;
+
+namespace castor3d
+{
+	uint32_t constexpr FrameCapture::DefaultDepth;
+
+	FrameCapture::FrameCapture( RenderSystem & renderSystem
+		, PixelFormat format
+		, Size const & size
+		, OnFrame onFrame
+		, uint32_t depth )
+		: OwnedBy< RenderSystem >{ renderSystem }
+		, m_format{ format }
+		, m_size{ size }
+		, m_onFrame{ std::move( onFrame ) }
+		, m_slots( std::max( 1u, depth ) )
+	{
+	}
+
+	FrameCapture::~FrameCapture()
+	{
+		{
+			auto lock = makeUniqueLock( m_mutex );
+			m_stopped = true;
+		}
+
+		m_queueCondition.notify_all();
+
+		if ( m_writer.joinable() )
+		{
+			m_writer.join();
+		}
+	}
+
+	void FrameCapture::cleanup()
+	{
+		if ( m_initialised )
+		{
+			flush();
+
+			for ( auto & slot : m_slots )
+			{
+				slot.buffer->cleanup();
+				slot.buffer.reset();
+			}
+
+			m_initialised = false;
+		}
+	}
+
+	void FrameCapture::capture( FrameBuffer const & frameBuffer
+		, AttachmentPoint point
+		, uint8_t index )
+	{
+		if ( !m_initialised )
+		{
+			m_initialised = doInitialise();
+		}
+
+		if ( m_initialised )
+		{
+			auto & slot = m_slots[m_current];
+
+			if ( slot.buffer->isPending() )
+			{
+				doRetrieve( slot );
+			}
+
+			slot.frame = m_captured++;
+			slot.buffer->readback( frameBuffer, point, index );
+			m_current = ( m_current + 1u ) % uint32_t( m_slots.size() );
+		}
+	}
+
+	void FrameCapture::flush()
+	{
+		if ( m_initialised )
+		{
+			// The current slot holds the oldest pending frame.
+			for ( size_t i = 0u; i < m_slots.size(); ++i )
+			{
+				auto & slot = m_slots[( m_current + i ) % m_slots.size()];
+
+				if ( slot.buffer->isPending() )
+				{
+					doRetrieve( slot );
+				}
+			}
+
+			auto lock = makeUniqueLock( m_mutex );
+			m_freeCondition.wait( lock, [this]()
+			{
+				return m_free.size() == m_buffersCount;
+			} );
+		}
+	}
+
+	bool FrameCapture::doInitialise()
+	{
+		bool result = true;
+
+		for ( auto & slot : m_slots )
+		{
+			slot.buffer = getRenderSystem()->createReadbackBuffer( m_format, m_size );
+			result = slot.buffer && slot.buffer->initialise();
+
+			if ( !result )
+			{
+				Logger::logError( cuT( "FrameCapture - Couldn't create the readback buffers" ) );
+				break;
+			}
+		}
+
+		if ( result )
+		{
+			auto lock = makeUniqueLock( m_mutex );
+
+			// One buffer more than the readback buffers, so the writer thread can process a frame
+			// while the whole ring is retrieved.
+			while ( m_buffersCount <= m_slots.size() )
+			{
+				m_free.push_back( PxBufferBase::create( m_size, m_format ) );
+				++m_buffersCount;
+			}
+
+			if ( !m_writer.joinable() )
+			{
+				m_writer = std::thread{ [this]()
+				{
+					doWrite();
+				} };
+			}
+		}
+		else
+		{
+			for ( auto & slot : m_slots )
+			{
+				if ( slot.buffer )
+				{
+					slot.buffer->cleanup();
+					slot.buffer.reset();
+				}
+			}
+		}
+
+		return result;
+	}
+
+	void FrameCapture::doRetrieve( Slot & slot )
+	{
+		PxBufferBaseSPtr buffer;
+
+		{
+			// Waits for the writer thread to release a pixel buffer, if it lags behind.
+			auto lock = makeUniqueLock( m_mutex );
+			m_freeCondition.wait( lock, [this]()
+			{
+				return !m_free.empty();
+			} );
+			buffer = m_free.back();
+			m_free.pop_back();
+		}
+
+		slot.buffer->download( *buffer );
+
+		{
+			auto lock = makeUniqueLock( m_mutex );
+			m_queue.push_back( { buffer, slot.frame } );
+		}
+
+		m_queueCondition.notify_one();
+	}
+
+	void FrameCapture::doWrite()
+	{
+		auto lock = makeUniqueLock( m_mutex );
+
+		while ( true )
+		{
+			m_queueCondition.wait( lock, [this]()
+			{
+				return m_stopped || !m_queue.empty();
+			} );
+
+			if ( m_queue.empty() )
+			{
+				break;
+			}
+
+			auto frame = m_queue.front();
+			m_queue.pop_front();
+			lock.unlock();
+
+			try
+			{
+				m_onFrame( frame.buffer, frame.index );
+			}
+			catch ( std::exception & exc )
+			{
+				Logger::logError( StringStream() << cuT( "FrameCapture - Frame " ) << frame.index << cuT( ": " ) << string::stringCast< xchar >( exc.what() ) );
+			}
+			catch ( ... )
+			{
+				Logger::logError( StringStream() << cuT( "FrameCapture - Frame " ) << frame.index << cuT( ": Unknown exception" ) );
+			}
+
+			++m_written;
+			lock.lock();
+			m_free.push_back( frame.buffer );
+			m_freeCondition.notify_all();
+		}
+	}
+}
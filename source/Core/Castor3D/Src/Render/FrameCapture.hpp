@@ -0,0 +1,196 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_FRAME_CAPTURE_H___
+#define ___C3D_FRAME_CAPTURE_H___
+
+#include "Castor3DPrerequisites.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+namespace castor3d
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		15/01/2018
+	\~english
+	\brief		Captures the frames rendered into a frame buffer, without stalling the rendering.
+	\remarks	The frames are transferred into a ring of readback buffers: the content of a frame is only retrieved
+				when its readback buffer is reused, some frames later, so the transfer overlaps the following frames rendering.
+				<br />The retrieved frames are then given to the frame callback on a writer thread, in the capture order,
+				so their encoding or writing doesn't stall the rendering either.
+	\~french
+	\brief		Capture les images rendues dans un tampon d'image, sans bloquer le rendu.
+	\remarks	Les images sont transférées dans un anneau de tampons de récupération : le contenu d'une image n'est récupéré
+				que lorsque son tampon de récupération est réutilisé, quelques images plus tard, le transfert chevauche donc le rendu des images suivantes.
+				<br />Les images récupérées sont ensuite données à la fonction de traitement sur un thread d'écriture, dans l'ordre de capture,
+				leur encodage ou écriture ne bloque donc pas non plus le rendu.
+	*/
+	class FrameCapture
+		: public castor::OwnedBy< RenderSystem >
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		The frame callback, called on the writer thread with the frame's pixels and its index.
+		 *\remarks		The pixel buffer is reused for later frames once the callback has returned.
+		 *\~french
+		 *\brief		La fonction de traitement des images, appelée sur le thread d'écriture avec les pixels de l'image et son indice.
+		 *\remarks		Le tampon de pixels est réutilisé pour des images ultérieures une fois la fonction terminée.
+		 */
+		using OnFrame = std::function< void( castor::PxBufferBaseSPtr, uint32_t ) >;
+
+	private:
+		struct Slot
+		{
+			ReadbackBufferUPtr buffer;
+			uint32_t frame{ 0u };
+		};
+
+		struct Frame
+		{
+			castor::PxBufferBaseSPtr buffer;
+			uint32_t index;
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	renderSystem	The RenderSystem.
+		 *\param[in]	format			The captured frames pixel format.
+		 *\param[in]	size			The captured frames dimensions.
+		 *\param[in]	onFrame			The frame callback.
+		 *\param[in]	depth			The readback buffers count, hence the number of frames a transfer can overlap.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	renderSystem	Le RenderSystem.
+		 *\param[in]	format			Le format des pixels des images capturées.
+		 *\param[in]	size			Les dimensions des images capturées.
+		 *\param[in]	onFrame			La fonction de traitement des images.
+		 *\param[in]	depth			Le nombre de tampons de récupération, donc le nombre d'images qu'un transfert peut chevaucher.
+		 */
+		C3D_API FrameCapture( RenderSystem & renderSystem
+			, castor::PixelFormat format
+			, castor::Size const & size
+			, OnFrame onFrame
+			, uint32_t depth = DefaultDepth );
+		/**
+		 *\~english
+		 *\brief		Destructor, lets the writer thread process the retrieved frames.
+		 *\~french
+		 *\brief		Destructeur, laisse le thread d'écriture traiter les images récupérées.
+		 */
+		C3D_API ~FrameCapture();
+		/**
+		 *\~english
+		 *\brief		Flushes the pending frames and destroys the readback buffers.
+		 *\remarks		Must be called from the rendering thread.
+		 *\~french
+		 *\brief		Vide les images en attente et détruit les tampons de récupération.
+		 *\remarks		Doit être appelée depuis le thread de rendu.
+		 */
+		C3D_API void cleanup();
+		/**
+		 *\~english
+		 *\brief		Starts the capture of a frame.
+		 *\remarks		Must be called from the rendering thread, the readback buffers are created on the first call.
+		 *				<br />Retrieves the oldest pending frame if all the readback buffers are in use.
+		 *\param[in]	frameBuffer	The frame buffer holding the frame.
+		 *\param[in]	point		The attachment point.
+		 *\param[in]	index		The attachment index.
+		 *\~french
+		 *\brief		Démarre la capture d'une image.
+		 *\remarks		Doit être appelée depuis le thread de rendu, les tampons de récupération sont créés au premier appel.
+		 *				<br />Récupère l'image en attente la plus ancienne si tous les tampons de récupération sont utilisés.
+		 *\param[in]	frameBuffer	Le tampon d'image contenant l'image.
+		 *\param[in]	point		Le point d'attache.
+		 *\param[in]	index		L'index d'attache.
+		 */
+		C3D_API void capture( FrameBuffer const & frameBuffer
+			, AttachmentPoint point = AttachmentPoint::eColour
+			, uint8_t index = 0u );
+		/**
+		 *\~english
+		 *\brief		Retrieves all the pending frames, and waits for the writer thread to process them.
+		 *\remarks		Must be called from the rendering thread.
+		 *\~french
+		 *\brief		Récupère toutes les images en attente, et attend que le thread d'écriture les ait traitées.
+		 *\remarks		Doit être appelée depuis le thread de rendu.
+		 */
+		C3D_API void flush();
+		/**
+		 *\~english
+		 *\return		The number of captured frames.
+		 *\~french
+		 *\return		Le nombre d'images capturées.
+		 */
+		inline uint32_t getCapturedCount()const
+		{
+			return m_captured;
+		}
+		/**
+		 *\~english
+		 *\return		The number of frames processed by the writer thread.
+		 *\~french
+		 *\return		Le nombre d'images traitées par le thread d'écriture.
+		 */
+		inline uint32_t getWrittenCount()const
+		{
+			return m_written;
+		}
+		/**
+		 *\~english
+		 *\return		The captured frames pixel format.
+		 *\~french
+		 *\return		Le format des pixels des images capturées.
+		 */
+		inline castor::PixelFormat getPixelFormat()const
+		{
+			return m_format;
+		}
+		/**
+		 *\~english
+		 *\return		The captured frames dimensions.
+		 *\~french
+		 *\return		Les dimensions des images capturées.
+		 */
+		inline castor::Size const & getDimensions()const
+		{
+			return m_size;
+		}
+
+	private:
+		bool doInitialise();
+		void doRetrieve( Slot & slot );
+		void doWrite();
+
+	public:
+		//!\~english	The default readback buffers count.
+		//!\~french		Le nombre par défaut de tampons de récupération.
+		static uint32_t constexpr DefaultDepth = 3u;
+
+	private:
+		castor::PixelFormat const m_format;
+		castor::Size const m_size;
+		OnFrame m_onFrame;
+		std::vector< Slot > m_slots;
+		uint32_t m_current{ 0u };
+		std::atomic< uint32_t > m_captured{ 0u };
+		std::atomic< uint32_t > m_written{ 0u };
+		bool m_initialised{ false };
+		std::mutex m_mutex;
+		std::condition_variable m_queueCondition;
+		std::condition_variable m_freeCondition;
+		std::deque< Frame > m_queue;
+		std::vector< castor::PxBufferBaseSPtr > m_free;
+		uint32_t m_buffersCount{ 0u };
+		bool m_stopped{ false };
+		std::thread m_writer;
+	};
+}
+
+#endif
@@ -50,6 +50,69 @@ namespace castor3d
 		//!\~english	The draw calls count.
 		//!\~french		Le nombre d'appels aux fonctions de dessin.
 		uint32_t m_drawCalls{ 0u };
+		//!\~english	The shadow map passes rendered.
+		//!\~french		Le nombre de passes d'ombres dessinées.
+		uint32_t m_renderedShadowPasses{ 0u };
+		//!\~english	The shadow map passes skipped, their content being up to date.
+		//!\~french		Le nombre de passes d'ombres ignorées, leur contenu étant à jour.
+		uint32_t m_skippedShadowPasses{ 0u };
+		//!\~english	The environment maps count.
+		//!\~french		Le nombre de textures d'environnement.
+		uint32_t m_environmentMapsCount{ 0u };
+		//!\~english	The environment maps faces rendered.
+		//!\~french		Le nombre de faces de textures d'environnement dessinées.
+		uint32_t m_renderedEnvironmentFaces{ 0u };
+		//!\~english	The overlays draw calls count.
+		//!\~french		Le nombre d'appels de dessin des incrustations.
+		uint32_t m_overlayDrawCalls{ 0u };
+	};
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		15/01/2018
+	\~english
+	\brief		Holds the times spent by a render pass category during a frame.
+	\~french
+	\brief		Contient les temps passés par une catégorie de passes de rendu pendant une image.
+	*/
+	struct RenderPassTimings
+	{
+		//!\~english	The render pass category full name.
+		//!\~french		Le nom complet de la catégorie de passes de rendu.
+		castor::String m_name;
+		//!\~english	The CPU time.
+		//!\~french		Le temps CPU.
+		castor::Nanoseconds m_cpuTime{ 0 };
+		//!\~english	The GPU time.
+		//!\~french		Le temps GPU.
+		castor::Nanoseconds m_gpuTime{ 0 };
+	};
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		15/01/2018
+	\~english
+	\brief		Holds the times and render informations of a frame.
+	\~french
+	\brief		Contient les temps et informations de rendu d'une image.
+	*/
+	struct FrameTimings
+	{
+		//!\~english	The whole frame time, including the time spent outside of the render loop.
+		//!\~french		Le temps total de l'image, incluant le temps passé hors de la boucle de rendu.
+		castor::Nanoseconds m_totalTime{ 0 };
+		//!\~english	The CPU step time.
+		//!\~french		Le temps de l'étape CPU.
+		castor::Nanoseconds m_cpuTime{ 0 };
+		//!\~english	The GPU step time.
+		//!\~french		Le temps de l'étape GPU.
+		castor::Nanoseconds m_gpuTime{ 0 };
+		//!\~english	The render informations.
+		//!\~french		Les informations de rendu.
+		RenderInfo m_info;
+		//!\~english	The times per render pass category.
+		//!\~french		Les temps par catégorie de passes de rendu.
+		std::vector< RenderPassTimings > m_passes;
 	};
 }
 
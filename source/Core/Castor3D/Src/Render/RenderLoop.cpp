@@ -3,10 +3,13 @@
 #include "Engine.hpp"
 
 #include "Overlay/DebugOverlays.hpp"
+#include "Render/RenderQueue.hpp"
 #include "Render/RenderWindow.hpp"
+#include "ShadowMap/ShadowMapPass.hpp"
 #include "Technique/RenderTechnique.hpp"
 
 #include <Design/BlockGuard.hpp>
+#include <Miscellaneous/Profiler.hpp>
 
 #include <future>
 
@@ -21,6 +24,7 @@ namespace castor3d
 		, m_renderSystem{ *engine.getRenderSystem() }
 		, m_debugOverlays{ std::make_unique< DebugOverlays >( engine ) }
 		, m_queueUpdater{ std::max( 2u, engine.getCpuInformations().getCoreCount() - ( p_isAsync ? 2u : 1u ) ) }
+		, m_pipelinePreparer{ std::max( 1u, engine.getCpuInformations().getCoreCount() / 2u ) }
 	{
 		m_debugOverlays->initialise( getEngine()->getOverlayCache() );
 	}
@@ -78,6 +82,16 @@ namespace castor3d
 		m_debugOverlays->show( p_show );
 	}
 
+	void RenderLoop::collectTimings( bool collect )
+	{
+		m_debugOverlays->collectTimings( collect );
+	}
+
+	FrameTimings const & RenderLoop::getLastFrameTimings()const
+	{
+		return m_debugOverlays->getTimings();
+	}
+
 	void RenderLoop::updateVSync( bool p_enable )
 	{
 	}
@@ -137,10 +151,13 @@ namespace castor3d
 	{
 		if ( m_renderSystem.getMainContext() )
 		{
+			CASTOR_PROFILE_FRAME();
+			CASTOR_PROFILE_ZONE( "RenderLoop::doRenderFrame" );
 			RenderInfo & info = m_debugOverlays->beginFrame();
 			doGpuStep( info );
 			doCpuStep();
 			m_debugOverlays->endFrame();
+			getEngine()->updateMemoryReport();
 		}
 	}
 
@@ -154,6 +171,7 @@ namespace castor3d
 
 	void RenderLoop::doGpuStep( RenderInfo & p_info )
 	{
+		CASTOR_PROFILE_ZONE( "RenderLoop::doGpuStep" );
 		{
 			auto guard = makeBlockGuard(
 				[this]()
@@ -184,6 +202,7 @@ namespace castor3d
 
 	void RenderLoop::doCpuStep()
 	{
+		CASTOR_PROFILE_ZONE( "RenderLoop::doCpuStep" );
 		doProcessEvents( EventType::ePostRender );
 		getEngine()->getSceneCache().forEach( []( Scene & p_scene )
 		{
@@ -194,6 +213,11 @@ namespace castor3d
 		{
 			p_technique.update( queues );
 		} );
+		// The techniques update the cameras of their passes, their changes must reach the queues before these are updated.
+		getEngine()->getSceneCache().forEach( []( Scene & p_scene )
+		{
+			p_scene.getChanges().flush();
+		} );
 		doUpdateQueues( queues );
 		getEngine()->getOverlayCache().update();
 		m_debugOverlays->endCpuTask();
@@ -207,6 +231,7 @@ namespace castor3d
 			{
 				m_queueUpdater.pushJob( [&queue]()
 				{
+					CASTOR_PROFILE_ZONE( "RenderQueue::update" );
 					queue.get().update();
 				} );
 			}
@@ -215,10 +240,50 @@ namespace castor3d
 		}
 		else
 		{
+			// Directional shadow cascades push one queue each, with the same casters,
+			// hence they are worth being updated in parallel even when they are few.
+			// The other queues are updated on this thread meanwhile.
+			RenderQueueArray shadowQueues;
+			RenderQueueArray otherQueues;
+
 			for ( auto & queue : p_queues )
+			{
+				if ( dynamic_cast< ShadowMapPass const * >( queue.get().getOwner() ) )
+				{
+					shadowQueues.push_back( queue );
+				}
+				else
+				{
+					otherQueues.push_back( queue );
+				}
+			}
+
+			if ( shadowQueues.size() > 1u )
+			{
+				for ( auto & queue : shadowQueues )
+				{
+					m_queueUpdater.pushJob( [&queue]()
+					{
+						CASTOR_PROFILE_ZONE( "RenderQueue::update" );
+						queue.get().update();
+					} );
+				}
+			}
+			else
+			{
+				otherQueues.insert( otherQueues.end(), shadowQueues.begin(), shadowQueues.end() );
+				shadowQueues.clear();
+			}
+
+			for ( auto & queue : otherQueues )
 			{
 				queue.get().update();
 			}
+
+			if ( !shadowQueues.empty() )
+			{
+				m_queueUpdater.waitAll( Milliseconds::max() );
+			}
 		}
 	}
 }
@@ -75,6 +75,24 @@ namespace castor3d
 		 *\param[in]	p_show	Le statut.
 		 */
 		C3D_API void showDebugOverlays( bool p_show );
+		/**
+		 *\~english
+		 *\brief		Enables or disables the frame timings collection, whether the debug overlays are shown or not.
+		 *\remarks		While enabled, the frame times are no more printed on the standard output.
+		 *\param[in]	collect	The status.
+		 *\~french
+		 *\brief		Active ou désactive la collecte des temps d'image, que les incrustations de débogage soient affichées ou non.
+		 *\remarks		Tant qu'elle est activée, les temps d'image ne sont plus affichés sur la sortie standard.
+		 *\param[in]	collect	Le statut.
+		 */
+		C3D_API void collectTimings( bool collect );
+		/**
+		 *\~english
+		 *\return		The timings of the last rendered frame, filled if the timings collection is enabled.
+		 *\~french
+		 *\return		Les temps de la dernière image rendue, remplis si la collecte des temps est activée.
+		 */
+		C3D_API FrameTimings const & getLastFrameTimings()const;
 		/**
 		 *\~english
 		 *\brief		Updates the V-Sync status.
@@ -176,6 +194,16 @@ namespace castor3d
 		{
 			return m_debugOverlays != nullptr;
 		}
+		/**
+		 *\~english
+		 *\return		The pool used to prepare the render pipelines.
+		 *\~french
+		 *\return		Le pool de préparation des pipelines de rendu.
+		 */
+		inline castor::ThreadPool & getPipelinePreparer()
+		{
+			return m_pipelinePreparer;
+		}
 
 	protected:
 		/**
@@ -228,6 +256,9 @@ namespace castor3d
 		//!\~english	The pool used to update the render queues.
 		//!\~french		Le pool de mise à jour des files de rendu.
 		castor::ThreadPool m_queueUpdater;
+		//!\~english	The pool used to prepare the render pipelines.
+		//!\~french		Le pool de préparation des pipelines de rendu.
+		castor::ThreadPool m_pipelinePreparer;
 	};
 }
 
@@ -2,10 +2,12 @@
 
 #include "Engine.hpp"
 
+#include "Event/Frame/FunctorEvent.hpp"
 #include "Material/Pass.hpp"
 #include "Mesh/Submesh.hpp"
 #include "Mesh/Buffer/GeometryBuffers.hpp"
 #include "Mesh/Buffer/VertexBuffer.hpp"
+#include "Render/RenderLoop.hpp"
 #include "Render/RenderPassTimer.hpp"
 #include "Render/RenderPipeline.hpp"
 #include "Render/RenderNode/RenderNode_Render.hpp"
@@ -29,6 +31,40 @@ namespace castor3d
 
 	namespace
 	{
+		/**
+		 *\~english
+		 *\brief		Decrements the running preparations count when leaving its scope, even through an exception, and signals the last one's end.
+		 *\~french
+		 *\brief		Décrémente le nombre de préparations en cours en quittant sa portée, même via une exception, et signale la fin de la dernière.
+		 */
+		class RunningPreparation
+		{
+		public:
+			RunningPreparation( std::atomic< uint32_t > & count
+				, std::mutex & mutex
+				, std::condition_variable & ended )
+				: m_count{ count }
+				, m_mutex{ mutex }
+				, m_ended{ ended }
+			{
+			}
+
+			~RunningPreparation()
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+
+				if ( --m_count == 0u )
+				{
+					m_ended.notify_all();
+				}
+			}
+
+		private:
+			std::atomic< uint32_t > & m_count;
+			std::mutex & m_mutex;
+			std::condition_variable & m_ended;
+		};
+
 		template< typename MapType, typename FuncType >
 		inline void doTraverseNodes( RenderPass const & pass
 			, MapType & nodes
@@ -365,6 +401,7 @@ namespace castor3d
 		, m_billboardUbo{ engine }
 		, m_skinningUbo{ engine }
 		, m_morphingUbo{ engine }
+		, m_preparationsAlive{ std::make_shared< std::atomic_bool >( true ) }
 	{
 	}
 
@@ -385,6 +422,7 @@ namespace castor3d
 		, m_billboardUbo{ engine }
 		, m_skinningUbo{ engine }
 		, m_morphingUbo{ engine }
+		, m_preparationsAlive{ std::make_shared< std::atomic_bool >( true ) }
 	{
 	}
 
@@ -395,11 +433,37 @@ namespace castor3d
 	bool RenderPass::initialise( Size const & size )
 	{
 		m_timer = std::make_shared< RenderPassTimer >( *getEngine(), getName(), getName() );
+
+		if ( !*m_preparationsAlive )
+		{
+			// The previous token has been cancelled by cleanup(), and no preparation job is running anymore.
+			m_preparationsAlive = std::make_shared< std::atomic_bool >( true );
+		}
+
 		return doInitialise( size );
 	}
 
 	void RenderPass::cleanup()
 	{
+		// Cancels the queued jobs and the publication events, then waits for the running jobs.
+		*m_preparationsAlive = false;
+
+		{
+			std::unique_lock< std::mutex > lock{ m_preparationsMutex };
+			m_preparationsEnded.wait( lock, [this]()
+				{
+					return !hasPendingPipelines();
+				} );
+		}
+
+		{
+			auto lock = makeUniqueLock( m_pipelinesMutex );
+			m_pipelineRequests.clear();
+			m_pendingPipelines.clear();
+			m_failedPipelines.clear();
+			m_preparedPipelines.clear();
+		}
+
 		m_skinningUbo.getUbo().cleanup();
 		m_morphingUbo.getUbo().cleanup();
 		m_billboardUbo.getUbo().cleanup();
@@ -506,55 +570,101 @@ namespace castor3d
 				alphaBlendMode = BlendMode::eNoBlend;
 			}
 
-			auto backProgram = doGetProgram( passFlags
-				, textureFlags
-				, programFlags
-				, sceneFlags
-				, alphaFunc
-				, false );
-
-			if ( !m_opaque )
+			PipelineRequest request
 			{
-				auto frontProgram = doGetProgram( passFlags
-					, textureFlags
-					, programFlags
-					, sceneFlags
-					, alphaFunc
-					, true );
-				auto flags = PipelineFlags{ colourBlendMode
+				PipelineFlags{ colourBlendMode
 					, alphaBlendMode
 					, passFlags
 					, textureFlags
 					, programFlags
-					, sceneFlags };
-				doPrepareFrontPipeline( *frontProgram, flags );
-				doPrepareBackPipeline( *backProgram, flags );
+					, sceneFlags },
+				alphaFunc,
+				!m_opaque
+					|| twoSided
+					|| checkFlag( textureFlags, TextureChannel::eOpacity ),
+			};
+
+			if ( getEngine()->hasRenderLoop() )
+			{
+				auto lock = makeUniqueLock( m_pipelinesMutex );
+				auto it = m_preparedPipelines.find( request.m_flags );
+				bool ready = it != m_preparedPipelines.end()
+					&& ( !request.m_front || it->second );
+
+				if ( !ready
+					&& m_failedPipelines.find( request.m_flags ) == m_failedPipelines.end()
+					&& m_pendingPipelines.insert( request.m_flags ).second )
+				{
+					m_pipelineRequests.push_back( request );
+				}
 			}
 			else
 			{
-				auto flags = PipelineFlags{ colourBlendMode
-					, alphaBlendMode
-					, passFlags
-					, textureFlags
-					, programFlags
-					, sceneFlags };
+				// No render loop, hence no preparation pool, so we prepare the pipelines immediately.
+				++m_runningPreparations;
+				RunningPreparation running{ m_runningPreparations, m_preparationsMutex, m_preparationsEnded };
+				doPreparePipeline( request, false );
+			}
+		}
+	}
 
-				if ( twoSided || checkFlag( textureFlags, TextureChannel::eOpacity ) )
-				{
-					auto frontProgram = doGetProgram( passFlags
-						, textureFlags
-						, programFlags
-						, sceneFlags
-						, alphaFunc
-						, true );
-					doPrepareFrontPipeline( *frontProgram, flags );
-				}
+	void RenderPass::preparePendingPipelines()
+	{
+		std::vector< PipelineRequest > requests;
 
-				doPrepareBackPipeline( *backProgram, flags );
+		{
+			auto lock = makeUniqueLock( m_pipelinesMutex );
+			std::swap( requests, m_pipelineRequests );
+		}
+
+		if ( !requests.empty() )
+		{
+			auto & pool = getEngine()->getRenderLoop().getPipelinePreparer();
+			auto it = requests.begin();
+
+			while ( it != requests.end() && !pool.isEmpty() )
+			{
+				auto request = *it;
+				auto alive = m_preparationsAlive;
+				++m_runningPreparations;
+				pool.pushJob( [this, request, alive]()
+					{
+						RunningPreparation running{ m_runningPreparations, m_preparationsMutex, m_preparationsEnded };
+
+						if ( *alive )
+						{
+							try
+							{
+								// Deferred, since the current context must not be queried from this thread.
+								doPreparePipeline( request, true );
+							}
+							catch ( std::exception & exc )
+							{
+								// Not requested again until the materials change, so a failing generation isn't repeated each frame.
+								Logger::logError( StringStream() << cuT( "Pipeline preparation failed: " ) << string::stringCast< xchar >( exc.what() ) );
+								auto lock = makeUniqueLock( m_pipelinesMutex );
+								m_pendingPipelines.erase( request.m_flags );
+								m_failedPipelines.insert( request.m_flags );
+							}
+						}
+					} );
+				++it;
+			}
+
+			if ( it != requests.end() )
+			{
+				auto lock = makeUniqueLock( m_pipelinesMutex );
+				m_pipelineRequests.insert( m_pipelineRequests.end(), it, requests.end() );
 			}
 		}
 	}
 
+	void RenderPass::resetFailedPipelines()
+	{
+		auto lock = makeUniqueLock( m_pipelinesMutex );
+		m_failedPipelines.clear();
+	}
+
 	RenderPipeline * RenderPass::getPipelineFront( BlendMode colourBlendMode
 		, BlendMode alphaBlendMode
 		, ComparisonFunc alphaFunc
@@ -568,13 +678,19 @@ namespace castor3d
 			alphaBlendMode = BlendMode::eNoBlend;
 		}
 
-		auto it = m_frontPipelines.find( { colourBlendMode, alphaBlendMode, passFlags, textureFlags, programFlags, sceneFlags } );
+		PipelineFlags flags{ colourBlendMode, alphaBlendMode, passFlags, textureFlags, programFlags, sceneFlags };
+		auto lock = makeUniqueLock( m_pipelinesMutex );
+		auto it = m_frontPipelines.find( flags );
 		RenderPipeline * result{ nullptr };
 
 		if ( it != m_frontPipelines.end() )
 		{
 			result = it->second.get();
 		}
+		else if ( m_pendingPipelines.find( flags ) != m_pendingPipelines.end() )
+		{
+			result = doFindFallbackPipeline( m_frontPipelines, flags );
+		}
 
 		return result;
 	}
@@ -592,13 +708,19 @@ namespace castor3d
 			alphaBlendMode = BlendMode::eNoBlend;
 		}
 
-		auto it = m_backPipelines.find( { colourBlendMode, alphaBlendMode, passFlags, textureFlags, programFlags, sceneFlags } );
+		PipelineFlags flags{ colourBlendMode, alphaBlendMode, passFlags, textureFlags, programFlags, sceneFlags };
+		auto lock = makeUniqueLock( m_pipelinesMutex );
+		auto it = m_backPipelines.find( flags );
 		RenderPipeline * result{ nullptr };
 
 		if ( it != m_backPipelines.end() )
 		{
 			result = it->second.get();
 		}
+		else if ( m_pendingPipelines.find( flags ) != m_pendingPipelines.end() )
+		{
+			result = doFindFallbackPipeline( m_backPipelines, flags );
+		}
 
 		return result;
 	}
@@ -708,6 +830,163 @@ namespace castor3d
 			, sceneFlags );
 	}
 
+	void RenderPass::doPreparePipeline( PipelineRequest const & request
+		, bool deferred )
+	{
+		auto & flags = request.m_flags;
+		bool front{ false };
+		bool back{ false };
+
+		{
+			auto lock = makeUniqueLock( m_pipelinesMutex );
+			front = request.m_front
+				&& m_frontPipelines.find( flags ) == m_frontPipelines.end();
+			back = m_backPipelines.find( flags ) == m_backPipelines.end();
+		}
+
+		// CPU stage: shaders source generation, outside of any lock.
+		ShaderProgramSPtr backProgram;
+		ShaderProgramSPtr frontProgram;
+
+		if ( back )
+		{
+			backProgram = doGetProgram( flags.m_passFlags
+				, flags.m_textureFlags
+				, flags.m_programFlags
+				, flags.m_sceneFlags
+				, request.m_alphaFunc
+				, false
+				, deferred );
+		}
+
+		if ( front )
+		{
+			frontProgram = doGetProgram( flags.m_passFlags
+				, flags.m_textureFlags
+				, flags.m_programFlags
+				, flags.m_sceneFlags
+				, request.m_alphaFunc
+				, true
+				, deferred );
+		}
+
+		{
+			// The programs are shared between the passes, through the cache, so their use
+			// is serialised at the cache level.
+			// The pipelines are then published by the pass, through doPublishPipeline.
+			auto lock = makeUniqueLock( getEngine()->getShaderProgramCache() );
+
+			if ( frontProgram )
+			{
+				doPrepareFrontPipeline( *frontProgram, flags );
+			}
+
+			if ( backProgram )
+			{
+				doPrepareBackPipeline( *backProgram, flags );
+			}
+		}
+
+		if ( getEngine()->hasRenderLoop() )
+		{
+			// Posted after the pipelines publication events,
+			// so the queues will be sorted again once the pipelines are usable.
+			auto alive = m_preparationsAlive;
+			getEngine()->postEvent( makeFunctorEvent( EventType::ePreRender
+				, [this, alive, request]()
+				{
+					if ( *alive )
+					{
+						auto lock = makeUniqueLock( m_pipelinesMutex );
+						m_pendingPipelines.erase( request.m_flags );
+						doSetPrepared( request );
+						++m_pipelinesGeneration;
+					}
+				} ) );
+		}
+		else
+		{
+			auto lock = makeUniqueLock( m_pipelinesMutex );
+			m_pendingPipelines.erase( flags );
+			doSetPrepared( request );
+		}
+	}
+
+	void RenderPass::doSetPrepared( PipelineRequest const & request )
+	{
+		auto & front = m_preparedPipelines[request.m_flags];
+		front = front || request.m_front;
+	}
+
+	void RenderPass::doPublishPipeline( std::map< PipelineFlags, RenderPipelineUPtr > & pipelines
+		, PipelineFlags const & flags
+		, RenderPipelineUPtr pipeline
+		, std::function< void( RenderPipeline & ) > complete )
+	{
+		if ( getEngine()->hasRenderLoop() )
+		{
+			// FunctorEvent copies its functor, hence the shared holder.
+			auto holder = std::make_shared< RenderPipelineUPtr >( std::move( pipeline ) );
+			auto alive = m_preparationsAlive;
+			getEngine()->postEvent( makeFunctorEvent( EventType::ePreRender
+				, [this, &pipelines, flags, holder, alive, complete]()
+				{
+					if ( *alive )
+					{
+						{
+							// The program may be shared with other passes, hence the cache lock.
+							auto programsLock = makeUniqueLock( getEngine()->getShaderProgramCache() );
+							complete( **holder );
+							auto & program = ( *holder )->getProgram();
+
+							if ( program.getStatus() == ProgramStatus::eNotLinked )
+							{
+								program.initialise();
+							}
+						}
+
+						auto lock = makeUniqueLock( m_pipelinesMutex );
+						pipelines.emplace( flags, std::move( *holder ) );
+					}
+				} ) );
+		}
+		else
+		{
+			complete( *pipeline );
+			auto lock = makeUniqueLock( m_pipelinesMutex );
+			pipelines.emplace( flags, std::move( pipeline ) );
+		}
+	}
+
+	RenderPipeline * RenderPass::doFindFallbackPipeline( std::map< PipelineFlags, RenderPipelineUPtr > const & pipelines
+		, PipelineFlags const & flags )const
+	{
+		RenderPipeline * result{ nullptr };
+		uint16_t bestTextures{ 0u };
+
+		auto wantedTextures = uint16_t( flags.m_textureFlags );
+
+		for ( auto & it : pipelines )
+		{
+			auto & candidate = it.first;
+			auto textures = uint16_t( candidate.m_textureFlags );
+
+			if ( candidate.m_colourBlendMode == flags.m_colourBlendMode
+				&& candidate.m_alphaBlendMode == flags.m_alphaBlendMode
+				&& candidate.m_passFlags == flags.m_passFlags
+				&& candidate.m_programFlags == flags.m_programFlags
+				&& candidate.m_sceneFlags == flags.m_sceneFlags
+				&& ( textures & wantedTextures ) == textures
+				&& ( !result || textures > bestTextures ) )
+			{
+				result = it.second.get();
+				bestTextures = textures;
+			}
+		}
+
+		return result;
+	}
+
 	PassRenderNode RenderPass::doCreatePassRenderNode( Pass & pass
 		, RenderPipeline & pipeline )
 	{
@@ -729,7 +1008,8 @@ namespace castor3d
 		, ProgramFlags const & programFlags
 		, SceneFlags const & sceneFlags
 		, ComparisonFunc alphaFunc
-		, bool invertNormals )const
+		, bool invertNormals
+		, bool deferred )const
 	{
 		return getEngine()->getShaderProgramCache().getAutomaticProgram( *this
 			, passFlags
@@ -737,7 +1017,8 @@ namespace castor3d
 			, programFlags
 			, sceneFlags
 			, alphaFunc
-			, invertNormals );
+			, invertNormals
+			, deferred );
 	}
 
 	uint32_t RenderPass::doCopyNodesMatrices( StaticRenderNodeArray const & renderNodes
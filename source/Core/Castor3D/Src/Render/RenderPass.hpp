@@ -17,6 +17,9 @@ See LICENSE file in root folder
 #include "Shader/Ubos/SceneUbo.hpp"
 #include "Shader/Ubos/SkinningUbo.hpp"
 
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <unordered_map>
 
 namespace castor3d
@@ -186,6 +189,8 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Prepares the pipeline matching the given flags.
+		 *\remarks		The flags are resolved immediately, but if the pipeline doesn't exist yet,
+		 *				its shaders generation is only queued, see preparePendingPipelines.
 		 *\param[in]	colourBlendMode	The colour blend mode.
 		 *\param[in]	alphaBlendMode	The alpha blend mode.
 		 *\param[in]	alphaFunc		The alpha test function.
@@ -196,6 +201,8 @@ namespace castor3d
 		 *\param[in]	twoSided		Tells if the pass is two sided.
 		 *\~french
 		 *\brief		Prépare le pipeline qui correspond aux indicateurs donnés.
+		 *\remarks		Les indicateurs sont résolus immédiatement, mais si le pipeline n'existe pas encore,
+		 *				la génération de ses shaders est seulement mise en attente, voir preparePendingPipelines.
 		 *\param[in]	colourBlendMode	Le mode de mélange de couleurs.
 		 *\param[in]	alphaBlendMode	Le mode de mélange alpha.
 		 *\param[in]	alphaFunc		La fonction de test alpha.
@@ -213,6 +220,26 @@ namespace castor3d
 			, ProgramFlags & programFlags
 			, SceneFlags & sceneFlags
 			, bool twoSided );
+		/**
+		 *\~english
+		 *\brief		Launches the CPU preparation (shaders generation, states creation) of the queued pipelines.
+		 *\remarks		The preparations are run on the render loop's pipeline preparation pool,
+		 *				the backend part (program compilation) is then batched on the render thread.
+		 *				If no worker is available, the remaining pipelines stay queued for next call.
+		 *\~french
+		 *\brief		Lance la préparation CPU (génération des shaders, création des états) des pipelines en attente.
+		 *\remarks		Les préparations sont lancées sur le pool de préparation des pipelines de la boucle de rendu,
+		 *				la partie backend (compilation des programmes) est ensuite groupée sur le thread de rendu.
+		 *				Si aucun thread n'est disponible, les pipelines restants sont gardés pour le prochain appel.
+		 */
+		C3D_API void preparePendingPipelines();
+		/**
+		 *\~english
+		 *\brief		Allows the pipelines whose preparation failed to be requested again, when the materials changed.
+		 *\~french
+		 *\brief		Permet aux pipelines dont la préparation a échoué d'être demandés à nouveau, lorsque les matériaux ont changé.
+		 */
+		C3D_API void resetFailedPipelines();
 		/**
 		 *\~english
 		 *\brief		Retrieves the pipeline matching the given flags, for front face culling.
@@ -401,6 +428,26 @@ namespace castor3d
 		{
 			return m_sceneUbo;
 		}
+		/**
+		 *\~english
+		 *\return		The pipelines generation, incremented each time prepared pipelines are ready to use.
+		 *\~french
+		 *\return		La génération des pipelines, incrémentée à chaque fois que des pipelines préparés sont utilisables.
+		 */
+		inline uint32_t getPipelinesGeneration()const
+		{
+			return m_pipelinesGeneration;
+		}
+		/**
+		 *\~english
+		 *\return		\p true if some pipelines are still being prepared.
+		 *\~french
+		 *\return		\p true si des pipelines sont encore en cours de préparation.
+		 */
+		inline bool hasPendingPipelines()const
+		{
+			return m_runningPreparations > 0u;
+		}
 
 	protected:
 		/**
@@ -440,6 +487,7 @@ namespace castor3d
 		 *\param[in]	sceneFlags		Scene related flags.
 		 *\param[in]	alphaFunc		The alpha test function.
 		 *\param[in]	invertNormals	Tells if the normals must be inverted, in the program.
+		 *\param[in]	deferred		Tells if a created program's initialisation is left to the publication of its pipelines.
 		 *\~french
 		 *\brief		Récupère le programme shader correspondant aux flags donnés.
 		 *\param[in]	passFlags		Une combinaison de PassFlag.
@@ -448,13 +496,37 @@ namespace castor3d
 		 *\param[in]	sceneFlags		Les indicateurs relatifs à la scène.
 		 *\param[in]	alphaFunc		La fonction de test alpha.
 		 *\param[in]	invertNormals	Dit si les normales doivent être inversées, dans le programme.
+		 *\param[in]	deferred		Dit si l'initialisation d'un programme créé est laissée à la publication de ses pipelines.
 		 */
 		C3D_API ShaderProgramSPtr doGetProgram( PassFlags const & passFlags
 			, TextureChannels const & textureFlags
 			, ProgramFlags const & programFlags
 			, SceneFlags const & sceneFlags
 			, ComparisonFunc alphaFunc
-			, bool invertNormals )const;
+			, bool invertNormals
+			, bool deferred = false )const;
+		/**
+		 *\~english
+		 *\brief		Makes a prepared pipeline usable by the render nodes.
+		 *\remarks		When a render loop exists, this is done in a pre-render event, so \p complete (which adds the UBOs,
+		 *				updates the program, ...) runs on the render thread, before the program initialisation.
+		 *\param[in]	pipelines	The pipelines map receiving the pipeline.
+		 *\param[in]	flags		The pipeline flags.
+		 *\param[in]	pipeline	The pipeline.
+		 *\param[in]	complete	The function completing the pipeline before its publication.
+		 *\~french
+		 *\brief		Rend un pipeline préparé utilisable par les noeuds de rendu.
+		 *\remarks		Quand une boucle de rendu existe, cela est fait dans un évènement de pré-rendu, ainsi \p complete (qui ajoute les UBOs,
+		 *				met à jour le programme, ...) est exécutée sur le thread de rendu, avant l'initialisation du programme.
+		 *\param[in]	pipelines	La map de pipelines recevant le pipeline.
+		 *\param[in]	flags		Les indicateurs du pipeline.
+		 *\param[in]	pipeline	Le pipeline.
+		 *\param[in]	complete	La fonction complétant le pipeline avant sa publication.
+		 */
+		C3D_API void doPublishPipeline( std::map< PipelineFlags, RenderPipelineUPtr > & pipelines
+			, PipelineFlags const & flags
+			, RenderPipelineUPtr pipeline
+			, std::function< void( RenderPipeline & ) > complete );
 		/**
 		 *\~english
 		 *\brief		Copies the instanced nodes model matrices into given matrix buffer.
@@ -1010,6 +1082,63 @@ namespace castor3d
 			, RenderInfo & info )const;
 
 	private:
+		/**
+		 *\~english
+		 *\brief		A pipeline preparation request.
+		 *\~french
+		 *\brief		Une demande de préparation de pipeline.
+		 */
+		struct PipelineRequest
+		{
+			//!\~english	The pipeline flags.
+			//!\~french		Les indicateurs du pipeline.
+			PipelineFlags m_flags;
+			//!\~english	The alpha test function.
+			//!\~french		La fonction de test alpha.
+			ComparisonFunc m_alphaFunc;
+			//!\~english	Tells if the front faces culling pipeline is needed.
+			//!\~french		Dit si le pipeline supprimant les faces avant est nécessaire.
+			bool m_front;
+		};
+		/**
+		 *\~english
+		 *\brief		Prepares the pipelines described by given request.
+		 *\remarks		Can be called from any thread.
+		 *\param[in]	request		The request.
+		 *\param[in]	deferred	Tells if the programs initialisation is left to the publication of the pipelines.
+		 *\~french
+		 *\brief		Prépare les pipelines décrits par la demande donnée.
+		 *\remarks		Peut être appelée depuis n'importe quel thread.
+		 *\param[in]	request		La demande.
+		 *\param[in]	deferred	Dit si l'initialisation des programmes est laissée à la publication des pipelines.
+		 */
+		void doPreparePipeline( PipelineRequest const & request
+			, bool deferred );
+		/**
+		 *\~english
+		 *\brief		Records that the pipelines described by given request have been prepared.
+		 *\remarks		Must be called with m_pipelinesMutex locked.
+		 *\param[in]	request	The request.
+		 *\~french
+		 *\brief		Enregistre que les pipelines décrits par la demande donnée ont été préparés.
+		 *\remarks		Doit être appelée avec m_pipelinesMutex verrouillé.
+		 *\param[in]	request	La demande.
+		 */
+		void doSetPrepared( PipelineRequest const & request );
+		/**
+		 *\~english
+		 *\brief		Looks for a ready pipeline, with a subset of the given texture flags, to use while the wanted one is prepared.
+		 *\param[in]	pipelines	The pipelines to look into.
+		 *\param[in]	flags		The wanted pipeline flags.
+		 *\return		\p nullptr if no compatible pipeline was found.
+		 *\~french
+		 *\brief		Recherche un pipeline prêt, avec un sous-ensemble des indicateurs de texture, à utiliser pendant la préparation de celui voulu.
+		 *\param[in]	pipelines	Les pipelines dans lesquels chercher.
+		 *\param[in]	flags		Les indicateurs du pipeline voulu.
+		 *\return		\p nullptr si aucun pipeline compatible n'a été trouvé.
+		 */
+		RenderPipeline * doFindFallbackPipeline( std::map< PipelineFlags, RenderPipelineUPtr > const & pipelines
+			, PipelineFlags const & flags )const;
 		/**
 		 *\~english
 		 *\brief		Initialises the pass.
@@ -1209,6 +1338,34 @@ namespace castor3d
 		//!\~english	The pipelines used to render nodes' front faces.
 		//!\~french		Les pipelines de rendu utilisés pour dessiner les faces avant noeuds.
 		std::map< PipelineFlags, RenderPipelineUPtr > m_backPipelines;
+		//!\~english	Protects the pipelines maps, which are filled on the render thread and read by the queues update.
+		//!\~french		Protège les maps de pipelines, qui sont remplies sur le thread de rendu et lues par la mise à jour des files.
+		mutable std::mutex m_pipelinesMutex;
+		//!\~english	The queued pipeline preparation requests.
+		//!\~french		Les demandes de préparation de pipeline en attente.
+		std::vector< PipelineRequest > m_pipelineRequests;
+		//!\~english	The flags of the pipelines queued or being prepared.
+		//!\~french		Les indicateurs des pipelines en attente ou en cours de préparation.
+		std::set< PipelineFlags > m_pendingPipelines;
+		//!\~english	The flags of the pipelines whose preparation failed, they are not requested again until resetFailedPipelines.
+		//!\~french		Les indicateurs des pipelines dont la préparation a échoué, ils ne sont plus demandés jusqu'à resetFailedPipelines.
+		std::set< PipelineFlags > m_failedPipelines;
+		//!\~english	The flags of the prepared pipelines, associated to \p true if the front faces culling one was prepared too.
+		//!\~french		Les indicateurs des pipelines préparés, associés à \p true si celui supprimant les faces avant a été préparé aussi.
+		std::map< PipelineFlags, bool > m_preparedPipelines;
+		//!\~english	The count of preparations currently running.
+		//!\~french		Le nombre de préparations en cours.
+		std::atomic< uint32_t > m_runningPreparations{ 0u };
+		//!\~english	Signalled when the last running preparation ends, cleanup() waits on it.
+		//!\~french		Signalée lorsque la dernière préparation en cours se termine, cleanup() l'attend.
+		std::mutex m_preparationsMutex;
+		std::condition_variable m_preparationsEnded;
+		//!\~english	Shared with the preparation jobs and events, set to \p false by cleanup() to cancel them.
+		//!\~french		Partagé avec les tâches et évènements de préparation, mis à \p false par cleanup() pour les annuler.
+		std::shared_ptr< std::atomic_bool > m_preparationsAlive;
+		//!\~english	Incremented each time prepared pipelines are ready to use.
+		//!\~french		Incrémenté à chaque fois que des pipelines préparés sont utilisables.
+		std::atomic< uint32_t > m_pipelinesGeneration{ 0u };
 		//!\~english	The geometries buffers.
 		//!\~french		Les tampons de géométries.
 		std::set< GeometryBuffersSPtr > m_geometryBuffers;
@@ -5,6 +5,8 @@
 #include "Render/RenderSystem.hpp"
 #include "Miscellaneous/GpuQuery.hpp"
 
+#include <Miscellaneous/Profiler.hpp>
+
 using namespace castor;
 
 namespace castor3d
@@ -15,6 +17,7 @@ namespace castor3d
 		: Named{ name }
 		, m_engine{ engine }
 		, m_category{ category }
+		, m_profileZone{ Profiler::intern( string::stringCast< char >( name ), string::stringCast< char >( category ) ) }
 		, m_timerQuery
 		{
 			{
@@ -48,6 +51,13 @@ namespace castor3d
 	void RenderPassTimer::start()
 	{
 		m_cpuTimer.getElapsed();
+		// Stamped only while capturing, the timestamps are relative to the capture start.
+		m_captureIndex[m_queryIndex] = Profiler::isCapturing()
+			? Profiler::getCaptureIndex()
+			: 0u;
+		m_gpuBegin[m_queryIndex] = m_captureIndex[m_queryIndex]
+			? Profiler::getTimestamp()
+			: 0u;
 		m_timerQuery[m_queryIndex]->begin();
 	}
 
@@ -55,10 +65,26 @@ namespace castor3d
 	{
 		m_cpuTime = m_cpuTimer.getElapsed();
 		m_timerQuery[m_queryIndex]->end();
+		uint32_t const capture = Profiler::isCapturing()
+			? Profiler::getCaptureIndex()
+			: 0u;
+
+		if ( capture && m_captureIndex[m_queryIndex] == capture )
+		{
+			Profiler::recordCpuSpan( m_profileZone, m_gpuBegin[m_queryIndex], Profiler::getTimestamp() );
+		}
+
 		m_queryIndex = 1 - m_queryIndex;
 		uint64_t time = 0;
 		m_timerQuery[m_queryIndex]->getInfos( QueryInfo::eResult, time );
 		m_gpuTime = Nanoseconds( time );
+
+		// The retrieved query was issued on the previous frame, the GPU span is placed at its submission time.
+		// It is dropped if it was submitted before the running capture started.
+		if ( capture && m_captureIndex[m_queryIndex] == capture )
+		{
+			Profiler::recordGpuSpan( m_profileZone, m_gpuBegin[m_queryIndex], m_gpuTime );
+		}
 	}
 
 	void RenderPassTimer::reset()
@@ -107,6 +107,9 @@ namespace castor3d
 		//!\~english	The render pass category.
 		//!\~french		La categorie de la passe de rendu.
 		castor::String m_category;
+		//!\~english	The profiler zone of the pass.
+		//!\~french		La zone de profilage de la passe.
+		castor::ProfileZone const & m_profileZone;
 		//!\~english	The CPU timer.
 		//!\~french		Le timer CPU.
 		castor::PreciseTimer m_cpuTimer;
@@ -122,6 +125,12 @@ namespace castor3d
 		//!\~english	The active query index.
 		//!\~french		L'index de la requête active.
 		uint32_t m_queryIndex = 0;
+		//!\~english	The profiler timestamps of the queries submission, also used as the CPU span begin.
+		//!\~french		Les horodatages profileur de la soumission des requêtes, utilisés aussi comme début de l'intervalle CPU.
+		std::array< uint64_t, 2 > m_gpuBegin{ { 0u, 0u } };
+		//!\~english	The profiler capture during which each query was submitted, 0 if none was running.
+		//!\~french		La capture du profileur pendant laquelle chaque requête a été soumise, 0 si aucune n'était en cours.
+		std::array< uint32_t, 2 > m_captureIndex{ { 0u, 0u } };
 	};
 }
 
@@ -31,15 +31,80 @@ namespace castor3d
 {
 	namespace
 	{
+		MemoryTag & doGetMemoryTag()
+		{
+			static MemoryTag & tag = MemoryAccounting::getTag( cuT( "Render nodes" ) );
+			return tag;
+		}
+
+		template< typename NodeType >
+		size_t doGetNodesSize( std::vector< NodeType > const & nodes );
+
+		template< typename KeyType, typename ValueType >
+		size_t doGetNodesSize( std::map< KeyType, ValueType > const & nodes );
+
+		template< typename MapType >
+		size_t doGetNodesSize( TypeRenderNodesByPassMap< MapType > const & nodes );
+
+		template< typename NodeType >
+		size_t doGetNodesSize( std::vector< NodeType > const & nodes )
+		{
+			return nodes.capacity() * sizeof( NodeType );
+		}
+
+		template< typename KeyType, typename ValueType >
+		size_t doGetNodesSize( std::map< KeyType, ValueType > const & nodes )
+		{
+			// Each tree node holds its value, its colour and three links.
+			size_t result = nodes.size() * ( sizeof( typename std::map< KeyType, ValueType >::value_type ) + 4u * sizeof( void * ) );
+
+			for ( auto & node : nodes )
+			{
+				result += doGetNodesSize( node.second );
+			}
+
+			return result;
+		}
+
+		template< typename MapType >
+		size_t doGetNodesSize( TypeRenderNodesByPassMap< MapType > const & nodes )
+		{
+			size_t result = nodes.size() * ( sizeof( typename TypeRenderNodesByPassMap< MapType >::value_type ) + 4u * sizeof( void * ) );
+
+			for ( auto & node : nodes )
+			{
+				result += doGetNodesSize( node.second );
+			}
+
+			return result;
+		}
+
+		template< typename NodeType, typename MapType >
+		size_t doGetNodesSize( RenderNodesT< NodeType, MapType > const & nodes )
+		{
+			return doGetNodesSize( nodes.m_frontCulled )
+				+ doGetNodesSize( nodes.m_backCulled );
+		}
+
+		size_t doGetNodesSize( SceneRenderNodes const & nodes )
+		{
+			return doGetNodesSize( nodes.m_staticNodes )
+				+ doGetNodesSize( nodes.m_skinnedNodes )
+				+ doGetNodesSize( nodes.m_instantiatedStaticNodes )
+				+ doGetNodesSize( nodes.m_instantiatedSkinnedNodes )
+				+ doGetNodesSize( nodes.m_morphingNodes )
+				+ doGetNodesSize( nodes.m_billboardNodes );
+		}
+
 		template< typename MapType, typename FuncType >
 		void doTraverseNodes( MapType & nodes
 			, FuncType function )
 		{
-			for ( auto itPipelines : nodes )
+			for ( auto & itPipelines : nodes )
 			{
-				for ( auto itPass : itPipelines.second )
+				for ( auto & itPass : itPipelines.second )
 				{
-					for ( auto itSubmeshes : itPass.second )
+					for ( auto & itSubmeshes : itPass.second )
 					{
 						function( *itPipelines.first
 							, *itPass.first
@@ -81,10 +146,9 @@ namespace castor3d
 			, String const & name )
 		{
 			AnimatedObjectSPtr result;
-			auto & cache = scene.getAnimatedObjectGroupCache();
-			auto lock = makeUniqueLock( cache );
+			auto groups = scene.getAnimatedObjectGroupCache().getSnapshot();
 
-			for ( auto group : cache )
+			for ( auto & group : *groups )
 			{
 				if ( !result )
 				{
@@ -92,6 +156,7 @@ namespace castor3d
 
 					if ( it != group.second->getObjects().end() )
 					{
+						C3D_CountReference();
 						result = it->second;
 					}
 				}
@@ -343,56 +408,64 @@ namespace castor3d
 			morphing.m_backCulled.clear();
 
 			bool shadows{ scene.hasShadows() };
+			auto shadowedSceneFlags = scene.getFlags();
+			auto unshadowedSceneFlags = shadowedSceneFlags;
+			remFlag( unshadowedSceneFlags, SceneFlag::eShadowFilterPcf );
+			bool instancing = renderPass.getEngine()->getRenderSystem()->getGpuInformations().hasInstancing();
+			// The nodes, meshes and materials are reached through their handles, without touching their reference counts.
+			auto & handles = renderPass.getEngine()->getHandles();
 
-			auto lock = makeUniqueLock( scene.getGeometryCache() );
+			// The nodes are built from a snapshot of the geometries, so the loading threads can still add some meanwhile.
+			auto primitives = scene.getGeometryCache().getSnapshot();
 
-			for ( auto primitive : scene.getGeometryCache() )
+			for ( auto & primitive : *primitives )
 			{
-				if ( ignored != primitive.second->getParent().get()
-					&& primitive.second->getParent()->isVisible()
-					&& primitive.second->getMesh() )
+				auto & geometry = *primitive.second;
+				auto node = handles.resolve( geometry.getParentHandle() );
+				auto mesh = handles.resolve( geometry.getMeshHandle() );
+
+				if ( node
+					&& ignored != node
+					&& node->isVisible()
+					&& mesh )
 				{
-					MeshSPtr mesh = primitive.second->getMesh();
+					auto skeleton = std::static_pointer_cast< AnimatedSkeleton >( doFindAnimatedObject( scene, primitive.first + cuT( "_Skeleton" ) ) );
+					auto animatedMesh = std::static_pointer_cast< AnimatedMesh >( doFindAnimatedObject( scene, primitive.first + cuT( "_Mesh" ) ) );
+					auto & geometrySceneFlags = ( shadows && geometry.isShadowReceiver() )
+						? shadowedSceneFlags
+						: unshadowedSceneFlags;
 
-					for ( auto submesh : *mesh )
+					for ( auto & submesh : *mesh )
 					{
-						MaterialSPtr material( primitive.second->getMaterial( *submesh ) );
+						auto material = handles.resolve( geometry.getMaterialHandle( *submesh ) );
 
 						if ( material )
 						{
-							for ( auto pass : *material )
+							for ( auto & pass : *material )
 							{
 								auto programFlags = submesh->getProgramFlags();
-								auto sceneFlags = scene.getFlags();
+								auto sceneFlags = geometrySceneFlags;
 								auto passFlags = pass->getPassFlags();
 								auto submeshFlags = submesh->getProgramFlags();
 								remFlag( programFlags, ProgramFlag::eSkinning );
 								remFlag( programFlags, ProgramFlag::eMorphing );
-								auto skeleton = std::static_pointer_cast< AnimatedSkeleton >( doFindAnimatedObject( scene, primitive.first + cuT( "_Skeleton" ) ) );
-								auto mesh = std::static_pointer_cast< AnimatedMesh >( doFindAnimatedObject( scene, primitive.first + cuT( "_Mesh" ) ) );
 
 								if ( skeleton && checkFlag( submeshFlags, ProgramFlag::eSkinning ) )
 								{
 									addFlag( programFlags, ProgramFlag::eSkinning );
 								}
 
-								if ( mesh )
+								if ( animatedMesh )
 								{
 									addFlag( programFlags, ProgramFlag::eMorphing );
 								}
 
-								if ( !shadows
-									|| !primitive.second->isShadowReceiver() )
-								{
-									remFlag( sceneFlags, SceneFlag::eShadowFilterPcf );
-								}
-
 								pass->prepareTextures();
 
 								if ( checkFlag( submeshFlags, ProgramFlag::eInstantiation )
 									&& !checkFlag( programFlags, ProgramFlag::eMorphing )
 									&& ( !pass->hasAlphaBlending() || renderPass.isOrderIndependent() )
-									&& renderPass.getEngine()->getRenderSystem()->getGpuInformations().hasInstancing()
+									&& instancing
 									&& !pass->hasEnvironmentMapping() )
 								{
 									addFlag( programFlags, ProgramFlag::eInstantiation );
@@ -415,7 +488,7 @@ namespace castor3d
 								if ( checkFlag( passFlags, PassFlag::eAlphaBlending ) != opaque )
 								{
 									if ( !isShadowMapProgram( programFlags )
-										|| primitive.second->isShadowCaster() )
+										|| geometry.isShadowCaster() )
 									{
 										if ( checkFlag( programFlags, ProgramFlag::eSkinning ) )
 										{
@@ -426,7 +499,7 @@ namespace castor3d
 												, sceneFlags
 												, *pass
 												, *submesh
-												, *primitive.second
+												, geometry
 												, *skeleton
 												, skinning
 												, instancedSkinning );
@@ -440,8 +513,8 @@ namespace castor3d
 												, sceneFlags
 												, *pass
 												, *submesh
-												, *primitive.second
-												, *mesh
+												, geometry
+												, *animatedMesh
 												, morphing );
 										}
 										else
@@ -453,7 +526,7 @@ namespace castor3d
 												, sceneFlags
 												, *pass
 												, *submesh
-												, *primitive.second
+												, geometry
 												, statics
 												, instanced );
 										}
@@ -513,9 +586,9 @@ namespace castor3d
 			nodes.m_frontCulled.clear();
 			nodes.m_backCulled.clear();
 			{
-				auto lock = makeUniqueLock( scene.getBillboardListCache() );
+				auto billboards = scene.getBillboardListCache().getSnapshot();
 
-				for ( auto billboard : scene.getBillboardListCache() )
+				for ( auto & billboard : *billboards )
 				{
 					MaterialSPtr material( billboard.second->getMaterial() );
 					REQUIRE( material );
@@ -527,9 +600,9 @@ namespace castor3d
 				}
 			}
 			{
-				auto lock = makeUniqueLock( scene.getParticleSystemCache() );
+				auto particleSystems = scene.getParticleSystemCache().getSnapshot();
 
-				for ( auto particleSystem : scene.getParticleSystemCache() )
+				for ( auto & particleSystem : *particleSystems )
 				{
 					MaterialSPtr material( particleSystem.second->getMaterial() );
 					REQUIRE( material );
@@ -607,6 +680,7 @@ namespace castor3d
 		: OwnedBy< RenderPass >{ renderPass }
 		, m_opaque{ opaque }
 		, m_ignored{ ignored }
+		, m_memory{ doGetMemoryTag() }
 	{
 	}
 
@@ -627,12 +701,26 @@ namespace castor3d
 		m_sceneChanged = scene.onChanged.connect( std::bind( &RenderQueue::onSceneChanged
 			, this
 			, std::placeholders::_1 ) );
+		m_materialsChanged = scene.getChanges().onMaterialsChanged.connect( [this]( std::vector< Material const * > const & )
+			{
+				getOwner()->resetFailedPipelines();
+			} );
 		onSceneChanged( scene );
 		m_renderNodes = std::make_unique< SceneRenderNodes >( scene );
 	}
 
 	void RenderQueue::update()
 	{
+		auto & renderPass = *getOwner();
+		auto generation = renderPass.getPipelinesGeneration();
+
+		if ( m_pipelinesGeneration != generation )
+		{
+			// Some pipelines became ready, the nodes using fallback ones must be rebuilt.
+			m_pipelinesGeneration = generation;
+			m_isSceneChanged = true;
+		}
+
 		if ( m_isSceneChanged )
 		{
 			doSortRenderNodes();
@@ -647,8 +735,17 @@ namespace castor3d
 				doPrepareRenderNodes();
 			}
 
+			++m_generation;
 			m_changed = false;
+			m_memory.setCpuSize( ( m_renderNodes
+					? doGetNodesSize( *m_renderNodes )
+					: 0u )
+				+ ( m_preparedRenderNodes
+					? doGetNodesSize( *m_preparedRenderNodes )
+					: 0u ) );
 		}
+
+		renderPass.preparePendingPipelines();
 	}
 	
 	SceneRenderNodes & RenderQueue::getRenderNodes()const
@@ -9,6 +9,7 @@ See LICENSE file in root folder
 #include "Scene/Scene.hpp"
 
 #include <Design/OwnedBy.hpp>
+#include <Miscellaneous/MemoryAccounting.hpp>
 
 #if defined( CASTOR_COMPILER_MSVC )
 #	pragma warning( push )
@@ -170,6 +171,16 @@ namespace castor3d
 		 *\return		Les noeuds de rendu
 		 */
 		C3D_API SceneRenderNodes & getRenderNodes()const;
+		/**
+		 *\~english
+		 *\return		The render nodes generation, incremented each time they are rebuilt.
+		 *\~french
+		 *\return		La génération des noeuds de rendu, incrémentée à chaque fois qu'ils sont reconstruits.
+		 */
+		inline uint32_t getGeneration()const
+		{
+			return m_generation;
+		}
 
 	private:
 		/**
@@ -238,9 +249,23 @@ namespace castor3d
 		//!\~english	The connection to the camera change notification.
 		//!\~french		Les conenction à la notification de caméra changée.
 		OnCameraChangedConnection m_cameraChanged;
+		//!\~english	The connection to the materials change notification, which lets the failed pipelines be requested again.
+		//!\~french		La connexion à la notification de matériaux changés, qui permet de demander à nouveau les pipelines ayant échoué.
+		OnMaterialsChangedConnection m_materialsChanged;
 		//!\~english	The optional camera.
 		//!\~french		La camera optionnelle.
 		Camera * m_camera{ nullptr };
+		//!\~english	The render pass pipelines generation used for the last sort.
+		//!\~french		La génération des pipelines de la passe de rendu, utilisée lors du dernier tri.
+		uint32_t m_pipelinesGeneration{ 0u };
+		//!\~english	The render nodes generation.
+		//!\~french		La génération des noeuds de rendu.
+		uint32_t m_generation{ 0u };
+
+	private:
+		//!\~english	Accounts for the render nodes.
+		//!\~french		Comptabilise les noeuds de rendu.
+		castor::MemoryUsage m_memory;
 	};
 }
 
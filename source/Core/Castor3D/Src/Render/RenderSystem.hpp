@@ -481,6 +481,20 @@ namespace castor3d
 		 *\return		Les tampons d'image créés.
 		 */
 		C3D_API virtual BackBuffersSPtr createBackBuffers() = 0;
+		/**
+		 *\~english
+		 *\brief		Creates a buffer receiving frame buffer attachments contents asynchronously.
+		 *\param[in]	format	The pixels format.
+		 *\param[in]	size	The pixels dimensions.
+		 *\return		The created readback buffer.
+		 *\~french
+		 *\brief		Crée un tampon recevant le contenu d'attaches de tampons d'image de manière asynchrone.
+		 *\param[in]	format	Le format des pixels.
+		 *\param[in]	size	Les dimensions en pixels.
+		 *\return		Le tampon de récupération créé.
+		 */
+		C3D_API virtual ReadbackBufferUPtr createReadbackBuffer( castor::PixelFormat format
+			, castor::Size const & size ) = 0;
 		/**
 		 *\~english
 		 *\brief		Creates a GPU query.
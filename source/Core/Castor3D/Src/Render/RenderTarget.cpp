@@ -6,6 +6,8 @@
 #include "FrameBuffer/FrameBuffer.hpp"
 #include "FrameBuffer/TextureAttachment.hpp"
 #include "HDR/ToneMapping.hpp"
+#include "Overlay/OverlayRenderer.hpp"
+#include "Render/FrameCapture.hpp"
 #include "Render/RenderPassTimer.hpp"
 #include "Scene/Camera.hpp"
 #include "Scene/Scene.hpp"
@@ -235,6 +237,11 @@ namespace castor3d
 		{
 			m_initialised = false;
 
+			if ( m_frameCapture )
+			{
+				m_frameCapture->cleanup();
+			}
+
 			for ( auto effect : m_postPostEffects )
 			{
 				effect->cleanup();
@@ -278,6 +285,11 @@ namespace castor3d
 				{
 					scene->getGeometryCache().fillInfo( info );
 					doRender( info, m_frameBuffer, getCamera() );
+
+					if ( m_frameCapture )
+					{
+						m_frameCapture->capture( *m_frameBuffer.m_frameBuffer );
+					}
 				}
 			}
 		}
@@ -330,6 +342,16 @@ namespace castor3d
 		}
 	}
 
+	void RenderTarget::setFrameCapture( FrameCaptureSPtr capture )
+	{
+		if ( m_frameCapture && m_frameCapture != capture )
+		{
+			m_frameCapture->cleanup();
+		}
+
+		m_frameCapture = capture;
+	}
+
 	void RenderTarget::setSize( Size const & size )
 	{
 		m_size = size;
@@ -377,6 +399,11 @@ namespace castor3d
 		getEngine()->getOverlayCache().render( *scene, m_size );
 		m_overlaysTimer->stop();
 
+		if ( auto renderer = getEngine()->getOverlayCache().getRenderer() )
+		{
+			info.m_overlayDrawCalls += renderer->getDrawCalls();
+		}
+
 #if DISPLAY_DEBUG
 
 		camera->apply();
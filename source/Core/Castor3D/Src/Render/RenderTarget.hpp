@@ -216,6 +216,19 @@ namespace castor3d
 		 *\param[in]	effect	L'effet.
 		 */
 		C3D_API void addPostEffect( PostEffectSPtr effect );
+		/**
+		 *\~english
+		 *\brief		Sets the frame capture, which captures each frame rendered by this target.
+		 *\remarks		Must be called from the rendering thread (in a frame event, for example).
+		 *				<br />The previous capture, if any, is flushed and cleaned up.
+		 *\param[in]	capture	The frame capture, \p nullptr to stop capturing.
+		 *\~french
+		 *\brief		Définit la capture d'images, qui capture chaque image rendue par cette cible.
+		 *\remarks		Doit être appelée depuis le thread de rendu (dans un évènement de frame, par exemple).
+		 *				<br />La capture précédente, s'il y en a une, est vidée et nettoyée.
+		 *\param[in]	capture	La capture d'images, \p nullptr pour arrêter la capture.
+		 */
+		C3D_API void setFrameCapture( FrameCaptureSPtr capture );
 		/**
 		 *\~english
 		 *\return		The intialisation status.
@@ -406,6 +419,16 @@ namespace castor3d
 		{
 			m_jitter = value;
 		}
+		/**
+		 *\~english
+		 *\return		The frame capture, if any.
+		 *\~french
+		 *\return		La capture d'images, s'il y en a une.
+		 */
+		inline FrameCaptureSPtr getFrameCapture()const
+		{
+			return m_frameCapture;
+		}
 
 	private:
 		C3D_API void doRender( RenderInfo & info
@@ -474,6 +497,9 @@ namespace castor3d
 		//!\~english	The texture receiving the velocity render.
 		//!\~french		La texture recevant le rendu vélocité.
 		TextureUnit m_velocityTexture;
+		//!\~english	The capture of the rendered frames.
+		//!\~french		La capture des images rendues.
+		FrameCaptureSPtr m_frameCapture;
 	};
 }
 
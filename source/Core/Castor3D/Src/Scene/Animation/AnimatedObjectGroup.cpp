@@ -172,7 +172,7 @@ namespace castor3d
 		{
 			m_animations.insert( { name, { AnimationState::eStopped, false, 1.0f } } );
 
-			for ( auto it : m_objects )
+			for ( auto & it : m_objects )
 			{
 				it.second->addAnimation( name );
 			}
@@ -186,7 +186,7 @@ namespace castor3d
 
 		if ( itAnim != m_animations.end() )
 		{
-			for ( auto it : m_objects )
+			for ( auto & it : m_objects )
 			{
 				if ( it.second->hasAnimation( name ) )
 				{
@@ -206,7 +206,7 @@ namespace castor3d
 
 		if ( itAnim != m_animations.end() )
 		{
-			for ( auto it : m_objects )
+			for ( auto & it : m_objects )
 			{
 				if ( it.second->hasAnimation( name ) )
 				{
@@ -231,7 +231,7 @@ namespace castor3d
 
 #endif
 
-		for ( auto it : m_objects )
+		for ( auto & it : m_objects )
 		{
 			it.second->update( tslf );
 		}
@@ -243,7 +243,7 @@ namespace castor3d
 
 		if ( itAnim != m_animations.end() )
 		{
-			for ( auto it : m_objects )
+			for ( auto & it : m_objects )
 			{
 				it.second->startAnimation( name );
 			}
@@ -258,7 +258,7 @@ namespace castor3d
 
 		if ( itAnim != m_animations.end() )
 		{
-			for ( auto it : m_objects )
+			for ( auto & it : m_objects )
 			{
 				it.second->stopAnimation( name );
 			}
@@ -273,7 +273,7 @@ namespace castor3d
 
 		if ( itAnim != m_animations.end() )
 		{
-			for ( auto it : m_objects )
+			for ( auto & it : m_objects )
 			{
 				it.second->pauseAnimation( name );
 			}
@@ -284,7 +284,7 @@ namespace castor3d
 
 	void AnimatedObjectGroup::startAllAnimations()
 	{
-		for ( auto it : m_objects )
+		for ( auto & it : m_objects )
 		{
 			it.second->startAllAnimations();
 		}
@@ -297,7 +297,7 @@ namespace castor3d
 
 	void AnimatedObjectGroup::stopAllAnimations()
 	{
-		for ( auto it : m_objects )
+		for ( auto & it : m_objects )
 		{
 			it.second->stopAllAnimations();
 		}
@@ -310,7 +310,7 @@ namespace castor3d
 
 	void AnimatedObjectGroup::pauseAllAnimations()
 	{
-		for ( auto it : m_objects )
+		for ( auto & it : m_objects )
 		{
 			it.second->pauseAllAnimations();
 		}
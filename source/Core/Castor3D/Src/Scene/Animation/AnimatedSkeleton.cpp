@@ -42,14 +42,14 @@ namespace castor3d
 
 		if ( m_playingAnimations.empty() )
 		{
-			for ( auto bone : skeleton )
+			for ( auto & bone : skeleton )
 			{
 				variable.setValue( skeleton.getGlobalInverseTransform(), i++ );
 			}
 		}
 		else
 		{
-			for ( auto bone : skeleton )
+			for ( auto & bone : skeleton )
 			{
 				Matrix4x4r final{ 1.0_r };
 
@@ -75,7 +75,7 @@ namespace castor3d
 
 		if ( m_playingAnimations.empty() )
 		{
-			for ( auto bone : skeleton )
+			for ( auto & bone : skeleton )
 			{
 				std::memcpy( buffer, skeleton.getGlobalInverseTransform().constPtr(), stride );
 				buffer += stride;
@@ -83,7 +83,7 @@ namespace castor3d
 		}
 		else
 		{
-			for ( auto bone : skeleton )
+			for ( auto & bone : skeleton )
 			{
 				Matrix4x4r final{ 1.0_r };
 
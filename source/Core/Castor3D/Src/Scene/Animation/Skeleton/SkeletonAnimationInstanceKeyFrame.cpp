@@ -13,6 +13,8 @@
 #include "Scene/Animation/Skeleton/SkeletonAnimationInstance.hpp"
 #include "Scene/Animation/Skeleton/SkeletonAnimationInstanceObject.hpp"
 
+#include <Math/MathBatch.hpp>
+
 using namespace castor;
 
 namespace castor3d
@@ -35,43 +37,72 @@ namespace castor3d
 			}
 			else
 			{
+				// The bones final matrices are computed once, instead of once per vertex.
+				std::vector< Matrix4x4r > keyFrameTransforms( skeleton.getBonesCount(), Matrix4x4r{ 1.0_r } );
+				std::vector< Matrix4x4r > offsets( skeleton.getBonesCount(), Matrix4x4r{ 1.0_r } );
+				std::vector< Matrix4x4r > bones( skeleton.getBonesCount(), Matrix4x4r{ NoInit{} } );
+				std::vector< bool > animated( skeleton.getBonesCount(), false );
+				size_t boneIndex = 0u;
+
+				for ( auto & bone : skeleton )
+				{
+					auto it = keyFrame.find( *bone );
+
+					if ( it != keyFrame.end() )
+					{
+						keyFrameTransforms[boneIndex] = it->second;
+						offsets[boneIndex] = bone->getOffsetMatrix();
+						animated[boneIndex] = true;
+					}
+
+					++boneIndex;
+				}
+
+				batch::multiply( keyFrameTransforms.data(), offsets.data(), bones.data(), bones.size() );
 				auto component = submesh.getComponent< BonesComponent >();
 				uint32_t index = 0u;
 
 				for ( auto & data : component->getBonesData() )
 				{
 					auto boneData = BonedVertex::getBones( data );
-					Matrix4x4r transform{ 1.0_r };
+					// Weighted sum of the bones matrices, identity when the vertex has no bone.
+					real transform[16] =
+					{
+						1.0_r, 0.0_r, 0.0_r, 0.0_r,
+						0.0_r, 1.0_r, 0.0_r, 0.0_r,
+						0.0_r, 0.0_r, 1.0_r, 0.0_r,
+						0.0_r, 0.0_r, 0.0_r, 1.0_r,
+					};
 
 					if ( boneData.m_weights[0] > 0 )
 					{
-						auto bone = *( skeleton.begin() + boneData.m_ids[0] );
-						auto it = keyFrame.find( *bone );
-						REQUIRE( it != keyFrame.end() );
-						transform = Matrix4x4r{ it->second * bone->getOffsetMatrix() * boneData.m_weights[0] };
+						std::fill( std::begin( transform ), std::end( transform ), 0.0_r );
 					}
 
-					for ( uint32_t i = 1; i < boneData.m_ids.size(); ++i )
+					for ( uint32_t i = 0; i < boneData.m_ids.size(); ++i )
 					{
 						if ( boneData.m_weights[i] > 0 )
 						{
-							auto bone = *( skeleton.begin() + boneData.m_ids[i] );
-							auto it = keyFrame.find( *bone );
-							REQUIRE( it != keyFrame.end() );
-							transform += Matrix4x4r{ it->second * bone->getOffsetMatrix() * boneData.m_weights[i] };
+							REQUIRE( animated[boneData.m_ids[i]] );
+							auto bone = bones[boneData.m_ids[i]].constPtr();
+							auto weight = boneData.m_weights[i];
+
+							for ( uint32_t j = 0u; j < 16u; ++j )
+							{
+								transform[j] += bone[j] * weight;
+							}
 						}
 					}
 
-					Coords3r cposition;
-					Vertex::getPosition( submesh.getPoint( index ), cposition );
-					Point4r position{ cposition[0], cposition[1], cposition[2], 1.0_r };
-					position = transform * position;
-					min[0] = std::min( min[0], position[0] );
-					min[1] = std::min( min[1], position[1] );
-					min[2] = std::min( min[2], position[2] );
-					max[0] = std::max( max[0], position[0] );
-					max[1] = std::max( max[1], position[1] );
-					max[2] = std::max( max[2], position[2] );
+					Coords3r position;
+					Vertex::getPosition( submesh.getPoint( index ), position );
+
+					for ( uint32_t i = 0u; i < 3u; ++i )
+					{
+						auto value = transform[i] * position[0] + transform[i + 4] * position[1] + transform[i + 8] * position[2] + transform[i + 12];
+						min[i] = std::min( min[i], value );
+						max[i] = std::max( max[i], value );
+					}
 
 					++index;
 				}
@@ -120,7 +151,7 @@ namespace castor3d
 
 	void SkeletonAnimationInstanceKeyFrame::apply()
 	{
-		for ( auto object : m_objects )
+		for ( auto & object : m_objects )
 		{
 			object.first->update( object.second );
 		}
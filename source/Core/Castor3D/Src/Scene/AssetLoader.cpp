@@ -0,0 +1,323 @@
+#include "AssetLoader.hpp"
+
+#include <iomanip>
+
+using namespace castor;
+
+namespace castor3d
+{
+	namespace
+	{
+		using Milliseconds = std::chrono::duration< double, std::milli >;
+
+		template< typename FuncT >
+		bool doExecute( String const & name
+			, FuncT const & function )
+		{
+			bool result = false;
+
+			try
+			{
+				result = function();
+			}
+			catch ( std::exception & exc )
+			{
+				Logger::logError( StringStream() << cuT( "AssetLoader - " ) << name << cuT( ": " ) << string::stringCast< xchar >( exc.what() ) );
+			}
+			catch ( ... )
+			{
+				Logger::logError( StringStream() << cuT( "AssetLoader - " ) << name << cuT( ": Unknown exception" ) );
+			}
+
+			return result;
+		}
+	}
+
+	AssetLoader::AssetLoader( uint32_t threadsCount )
+		: m_threadsCount{ std::max( 1u, threadsCount ) }
+	{
+	}
+
+	AssetLoader::~AssetLoader()
+	{
+		{
+			auto lock = makeUniqueLock( m_mutex );
+			m_stopped = true;
+		}
+
+		m_readyCondition.notify_all();
+
+		for ( auto & thread : m_threads )
+		{
+			thread.join();
+		}
+	}
+
+	void AssetLoader::pushJob( void const * resource
+		, String const & name
+		, Task task
+		, Dependencies const & dependencies )
+	{
+		auto lock = makeUniqueLock( m_mutex );
+
+		if ( m_threads.empty() )
+		{
+			for ( uint32_t i = 0u; i < m_threadsCount; ++i )
+			{
+				m_threads.emplace_back( [this]()
+				{
+					doRun();
+				} );
+			}
+		}
+
+		auto & job = doPush( resource, dependencies );
+		job.name = name;
+		job.task = std::move( task );
+
+		if ( !job.dependencies )
+		{
+			m_ready.push_back( &job );
+			m_readyCondition.notify_one();
+		}
+	}
+
+	void AssetLoader::pushContinuation( void const * resource
+		, Continuation continuation
+		, Dependencies const & dependencies )
+	{
+		auto lock = makeUniqueLock( m_mutex );
+		auto & job = doPush( resource, dependencies );
+
+		if ( !job.dependencies )
+		{
+			// Nothing to wait for, the continuation can't be run out of order.
+			lock.unlock();
+			bool result = doExecute( cuT( "Continuation" )
+				, [&continuation]()
+				{
+					continuation();
+					return true;
+				} );
+			lock.lock();
+			doComplete( job, result );
+		}
+		else
+		{
+			job.continuation = std::move( continuation );
+			m_continuations.push_back( &job );
+		}
+	}
+
+	bool AssetLoader::isPending( void const * resource )const
+	{
+		auto lock = makeUniqueLock( m_mutex );
+		auto it = m_lastJobs.find( resource );
+		return it != m_lastJobs.end()
+			&& !it->second->done;
+	}
+
+	void AssetLoader::wait( void const * resource )
+	{
+		auto lock = makeUniqueLock( m_mutex );
+		auto it = m_lastJobs.find( resource );
+
+		if ( it != m_lastJobs.end() )
+		{
+			Job const & last = *it->second;
+			doRunContinuations( last, lock );
+			m_doneCondition.wait( lock, [&last]()
+			{
+				return last.done;
+			} );
+		}
+	}
+
+	bool AssetLoader::join()
+	{
+		auto lock = makeUniqueLock( m_mutex );
+		bool result = true;
+
+		if ( !m_jobs.empty() )
+		{
+			doRunContinuations( *m_jobs.back(), lock );
+			m_doneCondition.wait( lock, [this]()
+			{
+				return m_pending == 0u;
+			} );
+
+			for ( auto & job : m_jobs )
+			{
+				result &= job->result;
+			}
+
+			doReport();
+			m_lastJobs.clear();
+			m_jobs.clear();
+		}
+
+		return result;
+	}
+
+	AssetLoader::Job & AssetLoader::doPush( void const * resource
+		, Dependencies const & dependencies )
+	{
+		auto now = Clock::now();
+
+		if ( m_jobs.empty() )
+		{
+			m_begin = now;
+		}
+
+		m_jobs.push_back( std::make_unique< Job >() );
+		auto & job = *m_jobs.back();
+		job.index = uint32_t( m_jobs.size() - 1u );
+		job.queued = now;
+		++m_pending;
+		auto link = [this, &job]( void const * lookup )
+		{
+			auto it = m_lastJobs.find( lookup );
+
+			if ( it != m_lastJobs.end()
+				&& !it->second->done
+				&& ( it->second->dependents.empty() || it->second->dependents.back() != &job ) )
+			{
+				it->second->dependents.push_back( &job );
+				++job.dependencies;
+			}
+		};
+
+		link( resource );
+
+		for ( auto dependency : dependencies )
+		{
+			link( dependency );
+		}
+
+		m_lastJobs[resource] = &job;
+		return job;
+	}
+
+	void AssetLoader::doRunContinuations( Job const & last
+		, std::unique_lock< std::mutex > & lock )
+	{
+		while ( !m_continuations.empty()
+			&& m_continuations.front()->index <= last.index )
+		{
+			auto & job = *m_continuations.front();
+			m_continuations.pop_front();
+			m_doneCondition.wait( lock, [&job]()
+			{
+				return job.dependencies == 0u;
+			} );
+			lock.unlock();
+			bool result = doExecute( cuT( "Continuation" )
+				, [&job]()
+				{
+					job.continuation();
+					return true;
+				} );
+			lock.lock();
+			doComplete( job, result );
+		}
+	}
+
+	void AssetLoader::doComplete( Job & job
+		, bool result )
+	{
+		job.done = true;
+		job.result = result;
+		job.end = Clock::now();
+		--m_pending;
+
+		for ( auto dependent : job.dependents )
+		{
+			if ( !--dependent->dependencies
+				&& dependent->task )
+			{
+				m_ready.push_back( dependent );
+				m_readyCondition.notify_one();
+			}
+		}
+
+		m_doneCondition.notify_all();
+	}
+
+	void AssetLoader::doRun()
+	{
+		auto lock = makeUniqueLock( m_mutex );
+
+		while ( true )
+		{
+			m_readyCondition.wait( lock, [this]()
+			{
+				return m_stopped || !m_ready.empty();
+			} );
+
+			if ( m_ready.empty() )
+			{
+				break;
+			}
+
+			auto & job = *m_ready.front();
+			m_ready.pop_front();
+			job.start = Clock::now();
+			lock.unlock();
+			bool result = doExecute( job.name, job.task );
+
+			if ( !result )
+			{
+				Logger::logError( StringStream() << cuT( "AssetLoader - " ) << job.name << cuT( ": Loading failed" ) );
+			}
+
+			lock.lock();
+			doComplete( job, result );
+		}
+	}
+
+	void AssetLoader::doReport()const
+	{
+		std::vector< Job const * > jobs;
+
+		for ( auto & job : m_jobs )
+		{
+			if ( job->task )
+			{
+				jobs.push_back( job.get() );
+			}
+		}
+
+		if ( !jobs.empty() )
+		{
+			std::sort( jobs.begin()
+				, jobs.end()
+				, []( Job const * lhs, Job const * rhs )
+				{
+					return ( lhs->end - lhs->start ) > ( rhs->end - rhs->start );
+				} );
+			Milliseconds total{ 0 };
+
+			for ( auto job : jobs )
+			{
+				total += job->end - job->start;
+			}
+
+			StringStream stream;
+			stream << std::fixed << std::setprecision( 2 );
+			stream << cuT( "AssetLoader - " ) << jobs.size() << cuT( " assets loaded in " )
+				<< Milliseconds{ Clock::now() - m_begin }.count() << cuT( " ms (" )
+				<< total.count() << cuT( " ms of loading time, on " )
+				<< m_threadsCount << cuT( " threads)" );
+
+			for ( auto job : jobs )
+			{
+				stream << cuT( "\n    " ) << std::setw( 10 ) << Milliseconds{ job->end - job->start }.count() << cuT( " ms" )
+					<< cuT( " (waited " ) << std::setw( 10 ) << Milliseconds{ job->start - job->queued }.count() << cuT( " ms)" )
+					<< ( job->result ? cuT( "  " ) : cuT( " !" ) )
+					<< job->name;
+			}
+
+			Logger::logInfo( stream );
+		}
+	}
+}
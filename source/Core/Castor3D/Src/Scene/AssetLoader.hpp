@@ -0,0 +1,171 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_ASSET_LOADER_H___
+#define ___C3D_ASSET_LOADER_H___
+
+#include "Castor3DPrerequisites.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+namespace castor3d
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		12/01/2018
+	\~english
+	\brief		Runs the assets loading jobs (meshes import, images decoding) of a scene file on worker threads,
+				while the scene file parsing goes on.
+	\remarks	The jobs are identified by the resource they load (a mesh, a texture, ...).
+				<br />A job waits for the jobs previously pushed for its resource, and for the ones of its dependencies.
+				<br />The continuations are the parser thread counterpart of the jobs: they are run on the parser thread,
+				in the order they have been pushed, once their dependencies are over.
+				<br />All the jobs are over when join returns, it then logs the loading time of each asset.
+	\~french
+	\brief		Exécute les tâches de chargement des ressources (import de maillages, décodage d'images) d'un fichier de scène
+				sur des threads de travail, pendant que l'analyse du fichier de scène continue.
+	\remarks	Les tâches sont identifiées par la ressource qu'elles chargent (un maillage, une texture, ...).
+				<br />Une tâche attend les tâches ajoutées précédemment pour sa ressource, ainsi que celles de ses dépendances.
+				<br />Les continuations sont l'équivalent des tâches sur le thread d'analyse : elles sont exécutées sur le thread d'analyse,
+				dans l'ordre où elles ont été ajoutées, une fois leurs dépendances terminées.
+				<br />Toutes les tâches sont terminées au retour de join, qui journalise alors le temps de chargement de chaque ressource.
+	*/
+	class AssetLoader
+	{
+	public:
+		using Task = std::function< bool() >;
+		using Continuation = std::function< void() >;
+		using Dependencies = std::vector< void const * >;
+
+	private:
+		using Clock = std::chrono::high_resolution_clock;
+
+		struct Job
+		{
+			uint32_t index;
+			castor::String name;
+			Task task;
+			Continuation continuation;
+			std::vector< Job * > dependents;
+			uint32_t dependencies{ 0u };
+			bool done{ false };
+			bool result{ true };
+			Clock::time_point queued;
+			Clock::time_point start;
+			Clock::time_point end;
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	threadsCount	The worker threads count, the threads are only created when the first job is pushed.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	threadsCount	Le nombre de threads de travail, les threads ne sont créés qu'à l'ajout de la première tâche.
+		 */
+		C3D_API explicit AssetLoader( uint32_t threadsCount );
+		/**
+		 *\~english
+		 *\brief		Destructor, lets the worker threads end the ready jobs.
+		 *\~french
+		 *\brief		Destructeur, laisse les threads de travail terminer les tâches prêtes.
+		 */
+		C3D_API ~AssetLoader();
+		/**
+		 *\~english
+		 *\brief		Pushes a job, run on a worker thread.
+		 *\remarks		The job waits for the jobs previously pushed for its resource, and for the ones of its dependencies.
+		 *				<br />A job returning \p false, or throwing, is reported as failed.
+		 *\param[in]	resource		The loaded resource.
+		 *\param[in]	name			The job name, used in the report.
+		 *\param[in]	task			The job.
+		 *\param[in]	dependencies	The resources the job depends on.
+		 *\~french
+		 *\brief		Ajoute une tâche, exécutée sur un thread de travail.
+		 *\remarks		La tâche attend les tâches ajoutées précédemment pour sa ressource, ainsi que celles de ses dépendances.
+		 *				<br />Une tâche retournant \p false, ou lançant une exception, est signalée comme échouée.
+		 *\param[in]	resource		La ressource chargée.
+		 *\param[in]	name			Le nom de la tâche, utilisé dans le rapport.
+		 *\param[in]	task			La tâche.
+		 *\param[in]	dependencies	Les ressources dont la tâche dépend.
+		 */
+		C3D_API void pushJob( void const * resource
+			, castor::String const & name
+			, Task task
+			, Dependencies const & dependencies = Dependencies{} );
+		/**
+		 *\~english
+		 *\brief		Pushes a continuation, run on the parser thread.
+		 *\remarks		If neither the resource nor its dependencies have pending jobs, the continuation is run immediately.
+		 *\param[in]	resource		The resource modified by the continuation.
+		 *\param[in]	continuation	The continuation.
+		 *\param[in]	dependencies	The resources the continuation depends on.
+		 *\~french
+		 *\brief		Ajoute une continuation, exécutée sur le thread d'analyse.
+		 *\remarks		Si ni la ressource ni ses dépendances n'ont de tâches en attente, la continuation est exécutée immédiatement.
+		 *\param[in]	resource		La ressource modifiée par la continuation.
+		 *\param[in]	continuation	La continuation.
+		 *\param[in]	dependencies	Les ressources dont la continuation dépend.
+		 */
+		C3D_API void pushContinuation( void const * resource
+			, Continuation continuation
+			, Dependencies const & dependencies = Dependencies{} );
+		/**
+		 *\~english
+		 *\param[in]	resource	A resource.
+		 *\return		\p true if the resource has jobs or continuations that are not over.
+		 *\~french
+		 *\param[in]	resource	Une ressource.
+		 *\return		\p true si la ressource a des tâches ou continuations qui ne sont pas terminées.
+		 */
+		C3D_API bool isPending( void const * resource )const;
+		/**
+		 *\~english
+		 *\brief		Waits for the jobs of a resource, running the continuations pushed before its last one.
+		 *\param[in]	resource	The resource.
+		 *\~french
+		 *\brief		Attend les tâches d'une ressource, en exécutant les continuations ajoutées avant sa dernière.
+		 *\param[in]	resource	La ressource.
+		 */
+		C3D_API void wait( void const * resource );
+		/**
+		 *\~english
+		 *\brief		Waits for all the jobs, runs all the continuations, and logs the loading report.
+		 *\return		\p false if a job has failed.
+		 *\~french
+		 *\brief		Attend toutes les tâches, exécute toutes les continuations, et journalise le rapport de chargement.
+		 *\return		\p false si une tâche a échoué.
+		 */
+		C3D_API bool join();
+
+	private:
+		Job & doPush( void const * resource
+			, Dependencies const & dependencies );
+		void doRunContinuations( Job const & last
+			, std::unique_lock< std::mutex > & lock );
+		void doComplete( Job & job
+			, bool result );
+		void doRun();
+		void doReport()const;
+
+	private:
+		uint32_t const m_threadsCount;
+		mutable std::mutex m_mutex;
+		std::condition_variable m_readyCondition;
+		std::condition_variable m_doneCondition;
+		std::vector< std::unique_ptr< Job > > m_jobs;
+		std::map< void const *, Job * > m_lastJobs;
+		std::deque< Job * > m_ready;
+		std::deque< Job * > m_continuations;
+		uint32_t m_pending{ 0u };
+		bool m_stopped{ false };
+		std::vector< std::thread > m_threads;
+		Clock::time_point m_begin;
+	};
+}
+
+#endif
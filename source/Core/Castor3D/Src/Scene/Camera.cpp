@@ -87,6 +87,7 @@ namespace castor3d
 	Camera::~Camera()
 	{
 		m_notifyIndex.disconnect();
+		getScene()->getChanges().forget( this );
 	}
 
 	void Camera::attachTo( SceneNodeSPtr node )
@@ -136,6 +137,23 @@ namespace castor3d
 		}
 	}
 
+	void Camera::update( Point3r const & position
+		, Point3r const & right
+		, Point3r const & up )
+	{
+		bool modified = m_viewport.update();
+		Point3r front{ point::cross( right, up ) };
+		Matrix4x4r view;
+		matrix::lookAt( view, position, position + front, up );
+
+		if ( modified || view != m_view )
+		{
+			m_view = view;
+			m_frustum.update( position, right, up, front );
+			getScene()->getChanges().record( *this );
+		}
+	}
+
 	void Camera::apply()const
 	{
 		m_viewport.apply();
@@ -173,12 +191,13 @@ namespace castor3d
 
 	bool Camera::isVisible( Geometry const & geometry, Submesh const & submesh )const
 	{
-		auto & sceneNode = *geometry.getParent();
-		return m_frustum.isVisible( geometry.getBoundingSphere( submesh )
-				, sceneNode.getDerivedTransformationMatrix()
-				, sceneNode.getDerivedScale() )
+		auto sceneNode = getScene()->getEngine()->getHandles().resolve( geometry.getParentHandle() );
+		return sceneNode
+			&& m_frustum.isVisible( geometry.getBoundingSphere( submesh )
+				, sceneNode->getDerivedTransformationMatrix()
+				, sceneNode->getDerivedScale() )
 			&& m_frustum.isVisible( geometry.getBoundingBox( submesh )
-				, sceneNode.getDerivedTransformationMatrix() );
+				, sceneNode->getDerivedTransformationMatrix() );
 	}
 
 	bool Camera::isVisible( BoundingBox const & box
@@ -205,6 +224,6 @@ namespace castor3d
 	void Camera::onNodeChanged( SceneNode const & node )
 	{
 		m_nodeChanged = true;
-		onChanged( *this );
+		getScene()->getChanges().record( *this );
 	}
 }
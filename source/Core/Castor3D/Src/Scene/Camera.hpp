@@ -125,6 +125,25 @@ namespace castor3d
 		 *\brief		Met à jour le viewport, frustum...
 		 */
 		C3D_API void update();
+		/**
+		 *\~english
+		 *\brief		Updates the viewport, the view matrix and the frustum, from the given view basis.
+		 *\remarks		Meant for cameras without parent node, placed by their owner.
+		 *				<br />The change is notified only if the view or the viewport changed.
+		 *\param[in]	position	The view position.
+		 *\param[in]	right		The X vector.
+		 *\param[in]	up			The Y vector.
+		 *\~french
+		 *\brief		Met à jour le viewport, la matrice de vue et le frustum, à partir de la base de vue donnée.
+		 *\remarks		Destinée aux caméras sans noeud parent, placées par leur propriétaire.
+		 *				<br />Le changement n'est notifié que si la vue ou le viewport ont changé.
+		 *\param[in]	position	La position de la vue.
+		 *\param[in]	right		Le vecteur X.
+		 *\param[in]	up			Le vecteur Y.
+		 */
+		C3D_API void update( castor::Point3r const & position
+			, castor::Point3r const & right
+			, castor::Point3r const & up );
 		/**
 		 *\~english
 		 *\brief		Applies the viewport.
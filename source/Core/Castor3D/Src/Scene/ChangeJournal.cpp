@@ -0,0 +1,192 @@
+#include "ChangeJournal.hpp"
+
+#include "Camera.hpp"
+#include "Scene.hpp"
+#include "SceneNode.hpp"
+
+using namespace castor;
+
+namespace castor3d
+{
+	size_t constexpr ChangeJournal::QueueSize;
+	uint32_t constexpr ChangeJournal::MaxRounds;
+
+	ChangeJournal::ChangeJournal( Scene & scene )
+		: OwnedBy< Scene >{ scene }
+		, m_queue{ QueueSize }
+	{
+	}
+
+	void ChangeJournal::record( std::vector< SceneNode * > const & nodes
+		, bool notified )
+	{
+		auto type = notified
+			? ChangeType::eNotifiedSceneNode
+			: ChangeType::eSceneNode;
+
+		for ( auto node : nodes )
+		{
+			doRecord( type, node );
+		}
+	}
+
+	void ChangeJournal::record( Camera const & camera )
+	{
+		doRecord( ChangeType::eCamera, &camera );
+	}
+
+	void ChangeJournal::record( Material const & material )
+	{
+		doRecord( ChangeType::eMaterial, &material );
+	}
+
+	void ChangeJournal::forget( void const * object )
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		// The records made from now on have a sequence at least equal to this one, so they are kept.
+		m_forgotten[object] = m_sequence.fetch_add( 1u, std::memory_order_acq_rel ) + 1u;
+	}
+
+	void ChangeJournal::flush()
+	{
+		// Dispatching the changes may record new ones (a camera following its node, for example),
+		// they are processed in the same flush, with a bounded rounds count.
+		for ( uint32_t round = 0u; round < MaxRounds && doCollect(); ++round )
+		{
+			doDispatch();
+		}
+
+		// The objects forgotten after the last collect started may still have records in the queue.
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		for ( auto it = m_forgotten.begin(); it != m_forgotten.end(); )
+		{
+			if ( it->second <= m_collectSequence )
+			{
+				it = m_forgotten.erase( it );
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	void ChangeJournal::doRecord( ChangeType type, void const * object )
+	{
+		Record record{ type, object, m_sequence.load( std::memory_order_acquire ) };
+
+		if ( !m_queue.tryPush( std::move( record ) ) )
+		{
+			// The queue is full, the record is kept aside until the next flush.
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_overflow.push_back( record );
+		}
+	}
+
+	bool ChangeJournal::doCollect()
+	{
+		m_seen.clear();
+		m_seenNotify.clear();
+		m_nodes.clear();
+		m_nodesToNotify.clear();
+		m_cameras.clear();
+		m_materials.clear();
+		// The forgotten records are filtered before coalescing, so a stale record can't hide a newer one for the same address.
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		m_collectSequence = m_sequence.load( std::memory_order_acquire );
+		Record record;
+
+		while ( m_queue.tryPop( record ) )
+		{
+			if ( !doIsForgotten( record ) )
+			{
+				doAdd( record );
+			}
+		}
+
+		for ( auto & overflow : m_overflow )
+		{
+			if ( !doIsForgotten( overflow ) )
+			{
+				doAdd( overflow );
+			}
+		}
+
+		m_overflow.clear();
+
+		return m_sceneChanged.load( std::memory_order_acquire )
+			|| !m_nodes.empty()
+			|| !m_cameras.empty()
+			|| !m_materials.empty();
+	}
+
+	bool ChangeJournal::doIsForgotten( Record const & record )const
+	{
+		auto it = m_forgotten.find( record.object );
+		return it != m_forgotten.end()
+			&& record.sequence < it->second;
+	}
+
+	void ChangeJournal::doAdd( Record const & record )
+	{
+		if ( record.type == ChangeType::eSceneNode
+			&& m_seenNotify.insert( record.object ).second )
+		{
+			m_nodesToNotify.push_back( static_cast< SceneNode const * >( record.object ) );
+		}
+
+		if ( m_seen.insert( record.object ).second )
+		{
+			switch ( record.type )
+			{
+			case ChangeType::eSceneNode:
+			case ChangeType::eNotifiedSceneNode:
+				m_nodes.push_back( static_cast< SceneNode const * >( record.object ) );
+				break;
+
+			case ChangeType::eCamera:
+				m_cameras.push_back( static_cast< Camera const * >( record.object ) );
+				break;
+
+			case ChangeType::eMaterial:
+				m_materials.push_back( static_cast< Material const * >( record.object ) );
+				break;
+			}
+		}
+	}
+
+	void ChangeJournal::doDispatch()
+	{
+		if ( m_sceneChanged.exchange( false, std::memory_order_acq_rel ) )
+		{
+			auto & scene = *getScene();
+			scene.onChanged( scene );
+		}
+
+		for ( auto node : m_nodesToNotify )
+		{
+			node->onChanged( *node );
+		}
+
+		if ( !m_nodes.empty() )
+		{
+			onSceneNodesChanged( m_nodes );
+		}
+
+		if ( !m_cameras.empty() )
+		{
+			for ( auto camera : m_cameras )
+			{
+				camera->onChanged( *camera );
+			}
+
+			onCamerasChanged( m_cameras );
+		}
+
+		if ( !m_materials.empty() )
+		{
+			onMaterialsChanged( m_materials );
+		}
+	}
+}
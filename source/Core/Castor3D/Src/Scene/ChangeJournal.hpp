@@ -0,0 +1,190 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_CHANGE_JOURNAL_H___
+#define ___C3D_CHANGE_JOURNAL_H___
+
+#include "Castor3DPrerequisites.hpp"
+
+#include <Design/OwnedBy.hpp>
+#include <Design/Signal.hpp>
+#include <Multithreading/MpscQueue.hpp>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <unordered_set>
+
+namespace castor3d
+{
+	using OnSceneNodesChangedFunction = std::function< void( std::vector< SceneNode const * > const & ) >;
+	using OnSceneNodesChanged = castor::Signal< OnSceneNodesChangedFunction >;
+	using OnSceneNodesChangedConnection = OnSceneNodesChanged::connection;
+
+	using OnCamerasChangedFunction = std::function< void( std::vector< Camera const * > const & ) >;
+	using OnCamerasChanged = castor::Signal< OnCamerasChangedFunction >;
+	using OnCamerasChangedConnection = OnCamerasChanged::connection;
+
+	using OnMaterialsChangedFunction = std::function< void( std::vector< Material const * > const & ) >;
+	using OnMaterialsChanged = castor::Signal< OnMaterialsChangedFunction >;
+	using OnMaterialsChangedConnection = OnMaterialsChanged::connection;
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/01/2018
+	\~english
+	\brief		Frame scoped journal of the changes in a scene.
+	\remarks	The producers record their changes from any thread, without locking.
+				<br />The journal is flushed once per frame, from Scene::update: the records are coalesced, so each changed object is notified once, through its own signal, then through the batched signals of the journal.
+	\~french
+	\brief		Journal des changements d'une scène, à l'échelle de l'image.
+	\remarks	Les producteurs enregistrent leurs changements depuis n'importe quel thread, sans verrou.
+				<br />Le journal est vidé une fois par image, depuis Scene::update : les enregistrements sont fusionnés, afin que chaque objet modifié soit notifié une fois, via son propre signal, puis via les signaux groupés du journal.
+	*/
+	class ChangeJournal
+		: public castor::OwnedBy< Scene >
+	{
+	public:
+		//!\~english	The records count the journal can hold without locking.
+		//!\~french		Le nombre d'enregistrements que le journal peut contenir sans verrou.
+		static size_t constexpr QueueSize = 16384u;
+		//!\~english	The maximum number of rounds in a flush, dispatching changes may record new ones.
+		//!\~french		Le nombre maximal de passes lors d'un vidage, la distribution de changements pouvant en enregistrer de nouveaux.
+		static uint32_t constexpr MaxRounds = 4u;
+
+	private:
+		enum class ChangeType
+			: uint8_t
+		{
+			eSceneNode,
+			eNotifiedSceneNode,
+			eCamera,
+			eMaterial,
+		};
+
+		struct Record
+		{
+			ChangeType type;
+			void const * object;
+			//!\~english	The forgets count when the record was made.
+			//!\~french		Le nombre d'oublis lorsque l'enregistrement a été fait.
+			uint64_t sequence;
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	scene	The parent scene.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	scene	La scène parente.
+		 */
+		C3D_API explicit ChangeJournal( Scene & scene );
+		/**
+		 *\~english
+		 *\brief		Records scene nodes changes.
+		 *\param[in]	nodes		The changed nodes.
+		 *\param[in]	notified	Tells if the nodes have already raised their own signal, in which case they are only given to the batched signal.
+		 *\~french
+		 *\brief		Enregistre des changements de noeuds de scène.
+		 *\param[in]	nodes		Les noeuds modifiés.
+		 *\param[in]	notified	Dit si les noeuds ont déjà levé leur propre signal, auquel cas ils ne sont donnés qu'au signal groupé.
+		 */
+		C3D_API void record( std::vector< SceneNode * > const & nodes
+			, bool notified = false );
+		/**
+		 *\~english
+		 *\brief		Records a camera change.
+		 *\param[in]	camera	The changed camera.
+		 *\~french
+		 *\brief		Enregistre un changement de caméra.
+		 *\param[in]	camera	La caméra modifiée.
+		 */
+		C3D_API void record( Camera const & camera );
+		/**
+		 *\~english
+		 *\brief		Records a material change.
+		 *\param[in]	material	The changed material.
+		 *\~french
+		 *\brief		Enregistre un changement de matériau.
+		 *\param[in]	material	Le matériau modifié.
+		 */
+		C3D_API void record( Material const & material );
+		/**
+		 *\~english
+		 *\brief		Records a change of the scene content.
+		 *\~french
+		 *\brief		Enregistre un changement du contenu de la scène.
+		 */
+		inline void recordSceneChange()
+		{
+			m_sceneChanged.store( true, std::memory_order_release );
+		}
+		/**
+		 *\~english
+		 *\brief		Discards the pending records of an object which is being destroyed.
+		 *\remarks		Only the records made before this call are discarded, those of a new object allocated at the same address are kept.
+		 *\param[in]	object	The object.
+		 *\~french
+		 *\brief		Ignore les enregistrements en attente d'un objet en cours de destruction.
+		 *\remarks		Seuls les enregistrements faits avant cet appel sont ignorés, ceux d'un nouvel objet alloué à la même adresse sont gardés.
+		 *\param[in]	object	L'objet.
+		 */
+		C3D_API void forget( void const * object );
+		/**
+		 *\~english
+		 *\brief		Coalesces the pending records, and notifies the changes.
+		 *\remarks		Must be called from the thread updating the scene.
+		 *\~french
+		 *\brief		Fusionne les enregistrements en attente, et notifie les changements.
+		 *\remarks		Doit être appelée depuis le thread mettant la scène à jour.
+		 */
+		C3D_API void flush();
+
+	private:
+		void doRecord( ChangeType type, void const * object );
+		bool doCollect();
+		bool doIsForgotten( Record const & record )const;
+		void doAdd( Record const & record );
+		void doDispatch();
+
+	public:
+		//!\~english	The signal raised with the scene nodes changed since the last flush.
+		//!\~french		Le signal levé avec les noeuds de scène modifiés depuis le dernier vidage.
+		OnSceneNodesChanged onSceneNodesChanged;
+		//!\~english	The signal raised with the cameras changed since the last flush.
+		//!\~french		Le signal levé avec les caméras modifiées depuis le dernier vidage.
+		OnCamerasChanged onCamerasChanged;
+		//!\~english	The signal raised with the materials changed since the last flush.
+		//!\~french		Le signal levé avec les matériaux modifiés depuis le dernier vidage.
+		OnMaterialsChanged onMaterialsChanged;
+
+	private:
+		castor::MpscQueue< Record > m_queue;
+		std::atomic_bool m_sceneChanged{ false };
+		//!\~english	The records which didn't fit in the queue, and the objects destroyed since the last flush.
+		//!\~french		Les enregistrements qui n'ont pas tenu dans la file, et les objets détruits depuis le dernier vidage.
+		std::mutex m_mutex;
+		std::vector< Record > m_overflow;
+		//!\~english	The destroyed objects, with the sequence their records were forgotten at.
+		//!\~french		Les objets détruits, avec la séquence à laquelle leurs enregistrements ont été oubliés.
+		std::map< void const *, uint64_t > m_forgotten;
+		//!\~english	Incremented by each forget, stamps the records so a reused address doesn't discard the new object's records.
+		//!\~french		Incrémentée par chaque oubli, estampille les enregistrements afin qu'une adresse réutilisée n'ignore pas les enregistrements du nouvel objet.
+		std::atomic< uint64_t > m_sequence{ 0u };
+		//!\~english	The sequence when the last collect started, the objects forgotten before it have no pending record left.
+		//!\~french		La séquence au début de la dernière collecte, les objets oubliés avant elle n'ont plus d'enregistrement en attente.
+		uint64_t m_collectSequence{ 0u };
+		//!\~english	The coalesced changes, reused between flushes.
+		//!\~french		Les changements fusionnés, réutilisés entre les vidages.
+		std::unordered_set< void const * > m_seen;
+		std::unordered_set< void const * > m_seenNotify;
+		std::vector< SceneNode const * > m_nodes;
+		std::vector< SceneNode const * > m_nodesToNotify;
+		std::vector< Camera const * > m_cameras;
+		std::vector< Material const * > m_materials;
+	};
+}
+
+#endif
@@ -0,0 +1,840 @@
+#include "CompiledSceneFile.hpp"
+
+#include "Engine.hpp"
+#include "Binary/ChunkParser.hpp"
+#include "Binary/ChunkWriter.hpp"
+#include "Mesh/Mesh.hpp"
+#include "Miscellaneous/Version.hpp"
+
+#include <Data/BinaryFile.hpp>
+#include <Data/File.hpp>
+#include <Data/VirtualFileSystem.hpp>
+
+using namespace castor;
+
+namespace castor3d
+{
+	namespace
+	{
+		thread_local CompiledSceneFile * g_active = nullptr;
+
+		//*****************************************************************************************
+
+		bool doIsAbsolute( Path const & path )
+		{
+			return ( !path.empty() && path[0] == Path::Separator )
+				|| ( path.size() > 1u && path[1] == cuT( ':' ) );
+		}
+
+		Path doGetAbsolute( Path const & path )
+		{
+			return doIsAbsolute( path )
+				? path
+				: File::getCurrentDirectory() / path;
+		}
+
+		bool doIsInside( Path const & path, Path const & folder )
+		{
+			return path.size() > folder.size()
+				&& path.find( folder ) == 0u
+				&& path[folder.size()] == Path::Separator;
+		}
+
+		/**
+		 *\~english
+		 *\brief		Computes the path of a file, relative to a folder.
+		 *\remarks		The path is kept as is if they have no common root (different drives).
+		 *\~french
+		 *\brief		Calcule le chemin d'un fichier, relativement à un dossier.
+		 *\remarks		Le chemin est gardé tel quel s'ils n'ont pas de racine commune (lecteurs différents).
+		 */
+		Path doGetRelative( Path const & path, Path const & folder )
+		{
+			String const separator( 1u, Path::Separator );
+			auto const pathParts = string::split( path, separator, 1000u, false );
+			auto const folderParts = string::split( folder, separator, 1000u, false );
+			size_t common = 0u;
+
+			while ( common < pathParts.size()
+				&& common < folderParts.size()
+				&& pathParts[common] == folderParts[common] )
+			{
+				++common;
+			}
+
+			if ( !common )
+			{
+				return path;
+			}
+
+			StringArray parts( folderParts.size() - common, cuT( ".." ) );
+			parts.insert( parts.end(), pathParts.begin() + common, pathParts.end() );
+			String result;
+
+			for ( auto & part : parts )
+			{
+				result += ( result.empty() ? String{} : separator ) + part;
+			}
+
+			return Path{ result };
+		}
+
+		Path doResolve( Path const & path, Path const & folder )
+		{
+			return doIsAbsolute( path )
+				? path
+				: folder / path;
+		}
+
+		//*****************************************************************************************
+
+		template< typename T >
+		void doAdd( BinaryChunk & chunk, T value )
+		{
+			prepareChunkData( value );
+			chunk.add( getBuffer( value ), uint32_t( getDataSize( value ) ) );
+		}
+
+		void doAdd( BinaryChunk & chunk, String const & value )
+		{
+			auto buffer = string::stringCast< char >( value );
+			chunk.add( reinterpret_cast< uint8_t * >( &buffer[0] ), uint32_t( buffer.size() ) );
+		}
+
+		void doAdd( BinaryChunk & chunk, Path const & value )
+		{
+			doAdd( chunk, static_cast< String const & >( value ) );
+		}
+
+		void doAdd( BinaryChunk & chunk, PixelFormat const & value )
+		{
+			doAdd( chunk, uint32_t( value ) );
+		}
+
+		void doAdd( BinaryChunk & chunk, Size const & value )
+		{
+			doAdd( chunk, value.getWidth() );
+			doAdd( chunk, value.getHeight() );
+		}
+
+		void doAdd( BinaryChunk & chunk, Position const & value )
+		{
+			doAdd( chunk, value.x() );
+			doAdd( chunk, value.y() );
+		}
+
+		void doAdd( BinaryChunk & chunk, castor::Rectangle const & value )
+		{
+			doAdd( chunk, int32_t( value.left() ) );
+			doAdd( chunk, int32_t( value.top() ) );
+			doAdd( chunk, int32_t( value.right() ) );
+			doAdd( chunk, int32_t( value.bottom() ) );
+		}
+
+		void doAdd( BinaryChunk & chunk, RgbColour const & value )
+		{
+			doAdd( chunk, toRGBFloat( value ) );
+		}
+
+		void doAdd( BinaryChunk & chunk, RgbaColour const & value )
+		{
+			doAdd( chunk, toRGBAFloat( value ) );
+		}
+
+		void doAdd( BinaryChunk & chunk, HdrRgbColour const & value )
+		{
+			doAdd( chunk, toRGBFloat( value ) );
+		}
+
+		void doAdd( BinaryChunk & chunk, HdrRgbaColour const & value )
+		{
+			doAdd( chunk, toRGBAFloat( value ) );
+		}
+
+		//*****************************************************************************************
+
+		template< typename T >
+		bool doGet( BinaryChunk & chunk, T & value )
+		{
+			return ChunkParser< T >::parse( value, chunk );
+		}
+
+		bool doGet( BinaryChunk & chunk, String & value )
+		{
+			// The strings are always the last value of their chunk, and may be empty.
+			value.clear();
+			return !chunk.checkAvailable( 1 )
+				|| ChunkParser< String >::parse( value, chunk );
+		}
+
+		bool doGet( BinaryChunk & chunk, Path & value )
+		{
+			String text;
+			bool result = doGet( chunk, text );
+			value = Path{ text };
+			return result;
+		}
+
+		bool doGet( BinaryChunk & chunk, PixelFormat & value )
+		{
+			uint32_t format;
+			bool result = doGet( chunk, format );
+			value = PixelFormat( format );
+			return result;
+		}
+
+		bool doGet( BinaryChunk & chunk, Size & value )
+		{
+			return doGet( chunk, value.getWidth() )
+				&& doGet( chunk, value.getHeight() );
+		}
+
+		bool doGet( BinaryChunk & chunk, Position & value )
+		{
+			return doGet( chunk, value.x() )
+				&& doGet( chunk, value.y() );
+		}
+
+		bool doGet( BinaryChunk & chunk, castor::Rectangle & value )
+		{
+			int32_t left, top, right, bottom;
+			bool result = doGet( chunk, left )
+				&& doGet( chunk, top )
+				&& doGet( chunk, right )
+				&& doGet( chunk, bottom );
+			value.set( left, top, right, bottom );
+			return result;
+		}
+
+		template< typename ComponentT >
+		bool doGet( BinaryChunk & chunk, RgbColourT< ComponentT > & value )
+		{
+			Point3f components;
+			bool result = doGet( chunk, components );
+			value = RgbColourT< ComponentT >::fromRGB( components );
+			return result;
+		}
+
+		template< typename ComponentT >
+		bool doGet( BinaryChunk & chunk, RgbaColourT< ComponentT > & value )
+		{
+			Point4f components;
+			bool result = doGet( chunk, components );
+			value = RgbaColourT< ComponentT >::fromRGBA( components );
+			return result;
+		}
+
+		//*****************************************************************************************
+
+		template< ParameterType Type >
+		using ParameterTypeT = std::integral_constant< ParameterType, Type >;
+
+		/**
+		 *\~english
+		 *\brief		Calls the given function with the compile time value of a parameter base type.
+		 *\~french
+		 *\brief		Appelle la fonction donnée avec la valeur compile time d'un type de base de paramètre.
+		 */
+		template< typename FuncT >
+		bool doVisit( ParameterType type, FuncT function )
+		{
+			switch ( type )
+			{
+			case ParameterType::eText:
+				return function( ParameterTypeT< ParameterType::eText >{} );
+			case ParameterType::ePath:
+				return function( ParameterTypeT< ParameterType::ePath >{} );
+			case ParameterType::eBool:
+				return function( ParameterTypeT< ParameterType::eBool >{} );
+			case ParameterType::eInt8:
+				return function( ParameterTypeT< ParameterType::eInt8 >{} );
+			case ParameterType::eInt16:
+				return function( ParameterTypeT< ParameterType::eInt16 >{} );
+			case ParameterType::eInt32:
+				return function( ParameterTypeT< ParameterType::eInt32 >{} );
+			case ParameterType::eInt64:
+				return function( ParameterTypeT< ParameterType::eInt64 >{} );
+			case ParameterType::eUInt8:
+				return function( ParameterTypeT< ParameterType::eUInt8 >{} );
+			case ParameterType::eUInt16:
+				return function( ParameterTypeT< ParameterType::eUInt16 >{} );
+			case ParameterType::eUInt32:
+				return function( ParameterTypeT< ParameterType::eUInt32 >{} );
+			case ParameterType::eUInt64:
+				return function( ParameterTypeT< ParameterType::eUInt64 >{} );
+			case ParameterType::eFloat:
+				return function( ParameterTypeT< ParameterType::eFloat >{} );
+			case ParameterType::eDouble:
+				return function( ParameterTypeT< ParameterType::eDouble >{} );
+			case ParameterType::eLongDouble:
+				return function( ParameterTypeT< ParameterType::eLongDouble >{} );
+			case ParameterType::ePixelFormat:
+				return function( ParameterTypeT< ParameterType::ePixelFormat >{} );
+			case ParameterType::ePoint2I:
+				return function( ParameterTypeT< ParameterType::ePoint2I >{} );
+			case ParameterType::ePoint3I:
+				return function( ParameterTypeT< ParameterType::ePoint3I >{} );
+			case ParameterType::ePoint4I:
+				return function( ParameterTypeT< ParameterType::ePoint4I >{} );
+			case ParameterType::ePoint2F:
+				return function( ParameterTypeT< ParameterType::ePoint2F >{} );
+			case ParameterType::ePoint3F:
+				return function( ParameterTypeT< ParameterType::ePoint3F >{} );
+			case ParameterType::ePoint4F:
+				return function( ParameterTypeT< ParameterType::ePoint4F >{} );
+			case ParameterType::ePoint2D:
+				return function( ParameterTypeT< ParameterType::ePoint2D >{} );
+			case ParameterType::ePoint3D:
+				return function( ParameterTypeT< ParameterType::ePoint3D >{} );
+			case ParameterType::ePoint4D:
+				return function( ParameterTypeT< ParameterType::ePoint4D >{} );
+			case ParameterType::eSize:
+				return function( ParameterTypeT< ParameterType::eSize >{} );
+			case ParameterType::ePosition:
+				return function( ParameterTypeT< ParameterType::ePosition >{} );
+			case ParameterType::eRectangle:
+				return function( ParameterTypeT< ParameterType::eRectangle >{} );
+			case ParameterType::eRgbColour:
+				return function( ParameterTypeT< ParameterType::eRgbColour >{} );
+			case ParameterType::eRgbaColour:
+				return function( ParameterTypeT< ParameterType::eRgbaColour >{} );
+			case ParameterType::eHdrRgbColour:
+				return function( ParameterTypeT< ParameterType::eHdrRgbColour >{} );
+			case ParameterType::eHdrRgbaColour:
+				return function( ParameterTypeT< ParameterType::eHdrRgbaColour >{} );
+			default:
+				// Only base types are recorded.
+				return false;
+			}
+		}
+
+		bool doWriteParam( ParserParameterBase & param, BinaryChunk & chunk )
+		{
+			auto type = param.getBaseType();
+			doAdd( chunk, uint8_t( type ) );
+			return doVisit( type, [&param, &chunk]( auto tag )
+				{
+					using ParameterT = ParserParameter< decltype( tag )::value >;
+					doAdd( chunk, static_cast< ParameterT & >( param ).m_value );
+					return true;
+				} );
+		}
+
+		bool doReadParam( BinaryChunk & chunk, ParserParameterBaseSPtr & param )
+		{
+			uint8_t type;
+			return doGet( chunk, type )
+				&& doVisit( ParameterType( type ), [&param, &chunk]( auto tag )
+					{
+						using ParameterT = ParserParameter< decltype( tag )::value >;
+						auto result = std::make_shared< ParameterT >();
+						param = result;
+						return doGet( chunk, result->m_value );
+					} );
+		}
+	}
+
+	//*********************************************************************************************
+
+	CompiledSceneFile::Scope::Scope( CompiledSceneFile & file )
+		: m_previous{ g_active }
+	{
+		g_active = &file;
+	}
+
+	CompiledSceneFile::Scope::~Scope()
+	{
+		g_active = m_previous;
+	}
+
+	//*********************************************************************************************
+
+	CompiledSceneFile::CompiledSceneFile( Mode mode )
+		: m_mode{ mode }
+	{
+	}
+
+	CompiledSceneFile * CompiledSceneFile::getActive()
+	{
+		return g_active;
+	}
+
+	void CompiledSceneFile::addScript( Path const & path
+		, FileParser::Script script )
+	{
+		m_scripts[path] = std::move( script );
+	}
+
+	FileParser::Script const * CompiledSceneFile::findScript( Path const & path )const
+	{
+		FileParser::Script const * result = nullptr;
+		auto it = m_scripts.find( path );
+
+		if ( it != m_scripts.end() )
+		{
+			result = &it->second;
+		}
+
+		return result;
+	}
+
+	void CompiledSceneFile::addArchive( Path const & root
+		, Path const & archive )
+	{
+		m_archives.emplace_back( root, archive );
+	}
+
+	void CompiledSceneFile::mountArchives()const
+	{
+		for ( auto & archive : m_archives )
+		{
+			VirtualFileSystem::mountArchive( archive.first, archive.second );
+		}
+	}
+
+	bool CompiledSceneFile::addMesh( String const & key
+		, Mesh const & mesh )
+	{
+		BinaryChunk chunk{ ChunkType::eCscbMesh };
+		bool result = ChunkWriter< String >::write( key, ChunkType::eName, chunk )
+			&& BinaryWriter< Mesh >{}.write( mesh, chunk );
+
+		if ( result )
+		{
+			chunk.finalise();
+			m_meshes[key] = chunk;
+		}
+
+		return result;
+	}
+
+	bool CompiledSceneFile::loadMesh( String const & key
+		, Mesh & mesh )const
+	{
+		bool result = false;
+		auto it = m_meshes.find( key );
+
+		if ( it != m_meshes.end() )
+		{
+			// The chunk is copied, since parsing it modifies its read index.
+			BinaryChunk chunk{ it->second };
+			BinaryChunk name;
+			BinaryChunk data;
+			result = chunk.getSubChunk( name )
+				&& chunk.getSubChunk( data )
+				&& BinaryParser< Mesh >{}.parse( mesh, data );
+		}
+
+		return result;
+	}
+
+	bool CompiledSceneFile::write( Path const & path )const
+	{
+		// The paths are stored relative to the compiled file, so that its folder can be moved.
+		Path const folder = doGetAbsolute( path ).getPath();
+		BinaryChunk file{ ChunkType::eCscbFile };
+		BinaryChunk header{ ChunkType::eCscbHeader };
+		StringStream stream;
+		stream << cuT( "Castor 3D - Version " ) << Version{};
+		bool result = ChunkWriter< uint32_t >::write( CSCB_VERSION, ChunkType::eCscbVersion, header )
+			&& ChunkWriter< String >::write( stream.str(), ChunkType::eName, header );
+
+		if ( result )
+		{
+			header.finalise();
+			result = file.addSubChunk( header );
+		}
+
+		for ( auto it = m_archives.begin(); result && it != m_archives.end(); ++it )
+		{
+			BinaryChunk archive{ ChunkType::eCscbArchive };
+			result = ChunkWriter< Path >::write( doGetRelative( doGetAbsolute( it->first ), Engine::getEngineDirectory() ), ChunkType::eCscbArchiveRoot, archive )
+				&& ChunkWriter< Path >::write( doGetRelative( doGetAbsolute( it->second ), folder ), ChunkType::eCscbArchivePath, archive );
+
+			if ( result )
+			{
+				archive.finalise();
+				result = file.addSubChunk( archive );
+			}
+		}
+
+		if ( result )
+		{
+			result = ChunkWriter< Path >::write( doMakePortable( m_mainScript, folder ), ChunkType::eCscbMainScript, file );
+		}
+
+		for ( auto it = m_scripts.begin(); result && it != m_scripts.end(); ++it )
+		{
+			result = doWriteScript( doMakePortable( it->first, folder ), it->second, file );
+		}
+
+		for ( auto it = m_meshes.begin(); result && it != m_meshes.end(); ++it )
+		{
+			result = doWriteMesh( doMakePortableKey( it->first, folder ), it->second, file );
+		}
+
+		if ( result )
+		{
+			BinaryFile binary{ path, File::OpenMode::eWrite };
+			result = file.write( binary );
+		}
+
+		return result;
+	}
+
+	bool CompiledSceneFile::read( Path const & path )
+	{
+		Path const folder = doGetAbsolute( path ).getPath();
+		BinaryChunk file;
+		bool result = false;
+
+		{
+			BinaryFile binary{ path, File::OpenMode::eRead };
+			result = file.read( binary );
+		}
+
+		if ( result && file.getChunkType() != ChunkType::eCscbFile )
+		{
+			Logger::logError( cuT( "Not a valid CSCB file." ) );
+			result = false;
+		}
+
+		BinaryChunk chunk;
+
+		if ( result )
+		{
+			result = file.getSubChunk( chunk )
+				&& doReadHeader( chunk );
+		}
+
+		while ( result && file.checkAvailable( 1 ) )
+		{
+			result = file.getSubChunk( chunk );
+
+			if ( result )
+			{
+				switch ( chunk.getChunkType() )
+				{
+				case ChunkType::eCscbArchive:
+					result = doReadArchive( chunk, folder );
+					break;
+
+				case ChunkType::eCscbMainScript:
+					result = ChunkParser< Path >::parse( m_mainScript, chunk );
+					m_mainScript = doMakeLocal( m_mainScript, folder );
+					break;
+
+				case ChunkType::eCscbScript:
+					result = doReadScript( chunk, folder );
+					break;
+
+				case ChunkType::eCscbMesh:
+					result = doReadMesh( chunk, folder );
+					break;
+
+				default:
+					break;
+				}
+			}
+		}
+
+		if ( !result )
+		{
+			Logger::logError( cuT( "Couldn't read compiled scene file [" ) + path + cuT( "]." ) );
+		}
+
+		return result;
+	}
+
+	bool CompiledSceneFile::doWriteScript( Path const & path
+		, FileParser::Script const & script
+		, BinaryChunk & chunk )const
+	{
+		BinaryChunk result{ ChunkType::eCscbScript };
+		bool ok = ChunkWriter< Path >::write( path, ChunkType::eCscbScriptPath, result );
+
+		for ( auto it = script.directives.begin(); ok && it != script.directives.end(); ++it )
+		{
+			BinaryChunk directive{ ChunkType::eCscbDirective };
+			doAdd( directive, it->section );
+			doAdd( directive, it->name );
+			directive.finalise();
+			ok = result.addSubChunk( directive );
+		}
+
+		for ( auto it = script.actions.begin(); ok && it != script.actions.end(); ++it )
+		{
+			BinaryChunk action{ ChunkType::eCscbAction };
+			doAdd( action, uint8_t( it->type ) );
+			doAdd( action, it->line );
+			doAdd( action, it->directive );
+			doAdd( action, it->valid );
+
+			if ( !it->text.empty() )
+			{
+				ok = ChunkWriter< String >::write( it->text, ChunkType::eCscbActionText, action );
+			}
+
+			for ( auto paramIt = it->params.begin(); ok && paramIt != it->params.end(); ++paramIt )
+			{
+				BinaryChunk param{ ChunkType::eCscbParam };
+				ok = doWriteParam( **paramIt, param );
+
+				if ( ok )
+				{
+					param.finalise();
+					ok = action.addSubChunk( param );
+				}
+				else
+				{
+					Logger::logError( cuT( "Unsupported parser parameter type." ) );
+				}
+			}
+
+			if ( ok )
+			{
+				action.finalise();
+				ok = result.addSubChunk( action );
+			}
+		}
+
+		if ( ok )
+		{
+			result.finalise();
+			ok = chunk.addSubChunk( result );
+		}
+
+		return ok;
+	}
+
+	bool CompiledSceneFile::doWriteMesh( String const & key
+		, BinaryChunk const & mesh
+		, BinaryChunk & chunk )const
+	{
+		// The mesh chunk is rebuilt, since its name holds the import key.
+		BinaryChunk source{ mesh };
+		BinaryChunk name;
+		BinaryChunk data;
+		BinaryChunk result{ ChunkType::eCscbMesh };
+		bool ok = source.getSubChunk( name )
+			&& source.getSubChunk( data )
+			&& ChunkWriter< String >::write( key, ChunkType::eName, result )
+			&& result.addSubChunk( data );
+
+		if ( ok )
+		{
+			result.finalise();
+			ok = chunk.addSubChunk( result );
+		}
+
+		return ok;
+	}
+
+	bool CompiledSceneFile::doReadHeader( BinaryChunk & chunk )const
+	{
+		bool result = chunk.getChunkType() == ChunkType::eCscbHeader;
+		uint32_t version{ 0u };
+
+		while ( result && chunk.checkAvailable( 1 ) )
+		{
+			BinaryChunk subchunk;
+			result = chunk.getSubChunk( subchunk );
+
+			if ( result && subchunk.getChunkType() == ChunkType::eCscbVersion )
+			{
+				result = ChunkParser< uint32_t >::parse( version, subchunk );
+			}
+		}
+
+		// The recorded actions depend on the parsers, hence a compiled file is only valid for its own version.
+		if ( result && version != CSCB_VERSION )
+		{
+			Logger::logError( StringStream{} << cuT( "This file is using version " )
+				<< Version{ int( CMSH_VERSION_MAJOR( version ) ), int( CMSH_VERSION_MINOR( version ) ), int( CMSH_VERSION_REVISION( version ) ) }
+				<< cuT( ", it must be compiled again." ) );
+			result = false;
+		}
+
+		return result;
+	}
+
+	bool CompiledSceneFile::doReadArchive( BinaryChunk & chunk
+		, Path const & folder )
+	{
+		Path root;
+		Path archive;
+		BinaryChunk subchunk;
+		bool result = true;
+
+		while ( result && chunk.checkAvailable( 1 ) )
+		{
+			result = chunk.getSubChunk( subchunk );
+
+			if ( result )
+			{
+				switch ( subchunk.getChunkType() )
+				{
+				case ChunkType::eCscbArchiveRoot:
+					result = ChunkParser< Path >::parse( root, subchunk );
+					break;
+
+				case ChunkType::eCscbArchivePath:
+					result = ChunkParser< Path >::parse( archive, subchunk );
+					break;
+
+				default:
+					break;
+				}
+			}
+		}
+
+		if ( result )
+		{
+			addArchive( doResolve( root, Engine::getEngineDirectory() )
+				, doResolve( archive, folder ) );
+		}
+
+		return result;
+	}
+
+	bool CompiledSceneFile::doReadScript( BinaryChunk & chunk
+		, Path const & folder )
+	{
+		Path path;
+		FileParser::Script script;
+		BinaryChunk subchunk;
+		bool result = true;
+
+		while ( result && chunk.checkAvailable( 1 ) )
+		{
+			result = chunk.getSubChunk( subchunk );
+
+			if ( result )
+			{
+				switch ( subchunk.getChunkType() )
+				{
+				case ChunkType::eCscbScriptPath:
+					result = ChunkParser< Path >::parse( path, subchunk );
+					break;
+
+				case ChunkType::eCscbDirective:
+					script.directives.emplace_back();
+					result = doGet( subchunk, script.directives.back().section )
+						&& doGet( subchunk, script.directives.back().name );
+					break;
+
+				case ChunkType::eCscbAction:
+					{
+						script.actions.emplace_back();
+						auto & action = script.actions.back();
+						uint8_t type;
+						result = doGet( subchunk, type )
+							&& doGet( subchunk, action.line )
+							&& doGet( subchunk, action.directive )
+							&& doGet( subchunk, action.valid );
+						action.type = FileParser::Script::Action::Type( type );
+						BinaryChunk data;
+
+						while ( result && subchunk.checkAvailable( 1 ) )
+						{
+							result = subchunk.getSubChunk( data );
+
+							if ( result && data.getChunkType() == ChunkType::eCscbActionText )
+							{
+								result = doGet( data, action.text );
+							}
+							else if ( result && data.getChunkType() == ChunkType::eCscbParam )
+							{
+								ParserParameterBaseSPtr param;
+								result = doReadParam( data, param );
+								action.params.push_back( param );
+							}
+						}
+					}
+					break;
+
+				default:
+					break;
+				}
+			}
+		}
+
+		if ( result )
+		{
+			addScript( doMakeLocal( path, folder ), std::move( script ) );
+		}
+
+		return result;
+	}
+
+	bool CompiledSceneFile::doReadMesh( BinaryChunk & chunk
+		, Path const & folder )
+	{
+		String key;
+		BinaryChunk name;
+		bool result = chunk.getSubChunk( name )
+			&& name.getChunkType() == ChunkType::eName
+			&& ChunkParser< String >::parse( key, name );
+
+		if ( result )
+		{
+			chunk.resetParse();
+			m_meshes[doMakeLocalKey( key, folder )] = chunk;
+		}
+
+		return result;
+	}
+
+	Path CompiledSceneFile::doMakePortable( Path const & path
+		, Path const & folder )const
+	{
+		Path result = doGetAbsolute( path );
+
+		// The files read from a mounted archive are referenced from the archive file itself.
+		for ( auto & archive : m_archives )
+		{
+			Path const root = doGetAbsolute( archive.first );
+
+			if ( doIsInside( result, root ) )
+			{
+				result = Path{ doGetAbsolute( archive.second ) + result.substr( root.size() ) };
+				break;
+			}
+		}
+
+		return doGetRelative( result, folder );
+	}
+
+	Path CompiledSceneFile::doMakeLocal( Path const & path
+		, Path const & folder )const
+	{
+		Path result = doResolve( path, folder );
+
+		for ( auto & archive : m_archives )
+		{
+			if ( doIsInside( result, archive.second ) )
+			{
+				result = Path{ archive.first + result.substr( archive.second.size() ) };
+				break;
+			}
+		}
+
+		return result;
+	}
+
+	String CompiledSceneFile::doMakePortableKey( String const & key
+		, Path const & folder )const
+	{
+		auto index = key.find( cuT( '|' ) );
+		return doMakePortable( Path{ key.substr( 0u, index ) }, folder )
+			+ ( index == String::npos ? String{} : key.substr( index ) );
+	}
+
+	String CompiledSceneFile::doMakeLocalKey( String const & key
+		, Path const & folder )const
+	{
+		auto index = key.find( cuT( '|' ) );
+		return doMakeLocal( Path{ key.substr( 0u, index ) }, folder )
+			+ ( index == String::npos ? String{} : key.substr( index ) );
+	}
+}
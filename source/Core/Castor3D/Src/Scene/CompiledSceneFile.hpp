@@ -0,0 +1,277 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_COMPILED_SCENE_FILE_H___
+#define ___C3D_COMPILED_SCENE_FILE_H___
+
+#include "Castor3DPrerequisites.hpp"
+
+#include "Binary/BinaryChunk.hpp"
+
+#include <FileParser/FileParser.hpp>
+
+namespace castor3d
+{
+	//!\~english	The current compiled scene file format version number.
+	//!\~french		La version actuelle du format de fichier de scène compilé.
+	uint32_t const CSCB_VERSION = MAKE_CMSH_VERSION( 0x01, 0x00, 0x0000 );
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		10/01/2018
+	\~english
+	\brief		Compiled scene file (CSCB).
+	\remarks	Holds the parsing actions recorded while parsing a scene file and the files it references
+				(materials files, included scene files), so that the scene can be rebuilt by replaying them,
+				without any text parsing.
+				<br />The replay invokes the same parsers, with the same parameters, hence rebuilds the same scene.
+				<br />The imported meshes that only hold geometry (no skeleton, no animation, no material created
+				by the importer) are embedded too, the other ones, as well as the textures, are loaded from their source paths.
+				<br />The paths are stored relative to the compiled file, which can hence be moved along with the files it references.
+	\~french
+	\brief		Fichier de scène compilé (CSCB).
+	\remarks	Contient les actions d'analyse enregistrées lors de l'analyse d'un fichier de scène et des fichiers qu'il référence
+				(fichiers de matériaux, fichiers de scène inclus), afin que la scène puisse être reconstruite en les rejouant,
+				sans aucune analyse de texte.
+				<br />Le rejeu invoque les mêmes analyseurs, avec les mêmes paramètres, et reconstruit donc la même scène.
+				<br />Les maillages importés ne contenant que de la géométrie (pas de squelette, pas d'animation, pas de matériau
+				créé par l'importeur) sont aussi embarqués, les autres, ainsi que les textures, sont chargés depuis leur chemin source.
+				<br />Les chemins sont stockés relativement au fichier compilé, qui peut donc être déplacé avec les fichiers qu'il référence.
+	*/
+	class CompiledSceneFile
+	{
+	public:
+		/*!
+		\~english
+		\brief		The way the file is used.
+		\~french
+		\brief		La manière dont le fichier est utilisé.
+		*/
+		enum class Mode
+		{
+			//!\~english	The parsed files are recorded into the compiled file.
+			//!\~french		Les fichiers analysés sont enregistrés dans le fichier compilé.
+			eCompile,
+			//!\~english	The parsed files are replayed from the compiled file.
+			//!\~french		Les fichiers analysés sont rejoués depuis le fichier compilé.
+			eLoad,
+		};
+		/*!
+		\~english
+		\brief		Makes a compiled file the active one, for the current thread, during its lifetime.
+		\remarks	The scene file parsers, including the ones created by the parsers themselves,
+					use the active compiled file.
+		\~french
+		\brief		Rend un fichier compilé actif, pour le thread courant, pendant sa durée de vie.
+		\remarks	Les analyseurs de fichier de scène, y compris ceux créés par les analyseurs eux-mêmes,
+					utilisent le fichier compilé actif.
+		*/
+		class Scope
+		{
+		public:
+			C3D_API explicit Scope( CompiledSceneFile & file );
+			C3D_API ~Scope();
+
+		private:
+			CompiledSceneFile * m_previous;
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	mode	The way the file is used.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	mode	La manière dont le fichier est utilisé.
+		 */
+		C3D_API explicit CompiledSceneFile( Mode mode );
+		/**
+		 *\~english
+		 *\return		The compiled file active for the current thread, \p nullptr if none.
+		 *\~french
+		 *\return		Le fichier compilé actif pour le thread courant, \p nullptr s'il n'y en a pas.
+		 */
+		C3D_API static CompiledSceneFile * getActive();
+		/**
+		 *\~english
+		 *\brief		Adds the actions recorded for a file.
+		 *\param[in]	path	The file path.
+		 *\param[in]	script	The recorded actions.
+		 *\~french
+		 *\brief		Ajoute les actions enregistrées pour un fichier.
+		 *\param[in]	path	Le chemin du fichier.
+		 *\param[in]	script	Les actions enregistrées.
+		 */
+		C3D_API void addScript( castor::Path const & path
+			, castor::FileParser::Script script );
+		/**
+		 *\~english
+		 *\param[in]	path	A file path.
+		 *\return		The actions recorded for this file, \p nullptr if none.
+		 *\~french
+		 *\param[in]	path	Un chemin de fichier.
+		 *\return		Les actions enregistrées pour ce fichier, \p nullptr s'il n'y en a pas.
+		 */
+		C3D_API castor::FileParser::Script const * findScript( castor::Path const & path )const;
+		/**
+		 *\~english
+		 *\brief		Registers an archive mounted while compiling, it will be mounted again when loading.
+		 *\param[in]	root	The virtual root path.
+		 *\param[in]	archive	The archive path.
+		 *\~french
+		 *\brief		Enregistre une archive montée lors de la compilation, elle sera de nouveau montée lors du chargement.
+		 *\param[in]	root	Le chemin racine virtuel.
+		 *\param[in]	archive	Le chemin de l'archive.
+		 */
+		C3D_API void addArchive( castor::Path const & root
+			, castor::Path const & archive );
+		/**
+		 *\~english
+		 *\brief		Mounts the registered archives.
+		 *\~french
+		 *\brief		Monte les archives enregistrées.
+		 */
+		C3D_API void mountArchives()const;
+		/**
+		 *\~english
+		 *\brief		Embeds an imported mesh.
+		 *\param[in]	key		The import key (file path and import parameters).
+		 *\param[in]	mesh	The mesh.
+		 *\return		\p false if the mesh could not be written.
+		 *\~french
+		 *\brief		Embarque un maillage importé.
+		 *\param[in]	key		La clef d'import (chemin du fichier et paramètres d'import).
+		 *\param[in]	mesh	Le maillage.
+		 *\return		\p false si le maillage n'a pas pu être écrit.
+		 */
+		C3D_API bool addMesh( castor::String const & key
+			, Mesh const & mesh );
+		/**
+		 *\~english
+		 *\brief		Loads an embedded mesh.
+		 *\param[in]	key		The import key (file path and import parameters).
+		 *\param[out]	mesh	Receives the mesh data.
+		 *\return		\p false if the mesh is not embedded, or could not be read.
+		 *\~french
+		 *\brief		Charge un maillage embarqué.
+		 *\param[in]	key		La clef d'import (chemin du fichier et paramètres d'import).
+		 *\param[out]	mesh	Reçoit les données du maillage.
+		 *\return		\p false si le maillage n'est pas embarqué, ou n'a pas pu être lu.
+		 */
+		C3D_API bool loadMesh( castor::String const & key
+			, Mesh & mesh )const;
+		/**
+		 *\~english
+		 *\brief		Writes the compiled file.
+		 *\param[in]	path	The file path.
+		 *\return		\p false if any error occured.
+		 *\~french
+		 *\brief		Ecrit le fichier compilé.
+		 *\param[in]	path	Le chemin du fichier.
+		 *\return		\p false si une erreur quelconque est arrivée.
+		 */
+		C3D_API bool write( castor::Path const & path )const;
+		/**
+		 *\~english
+		 *\brief		Reads a compiled file.
+		 *\param[in]	path	The file path.
+		 *\return		\p false if any error occured.
+		 *\~french
+		 *\brief		Lit un fichier compilé.
+		 *\param[in]	path	Le chemin du fichier.
+		 *\return		\p false si une erreur quelconque est arrivée.
+		 */
+		C3D_API bool read( castor::Path const & path );
+		/**
+		 *\~english
+		 *\return		The way the file is used.
+		 *\~french
+		 *\return		La manière dont le fichier est utilisé.
+		 */
+		inline Mode getMode()const
+		{
+			return m_mode;
+		}
+		/**
+		 *\~english
+		 *\return		The path of the compiled scene file.
+		 *\~french
+		 *\return		Le chemin du fichier de scène compilé.
+		 */
+		inline castor::Path const & getMainScript()const
+		{
+			return m_mainScript;
+		}
+		/**
+		 *\~english
+		 *\brief		Sets the path of the compiled scene file.
+		 *\param[in]	path	The new value.
+		 *\~french
+		 *\brief		Définit le chemin du fichier de scène compilé.
+		 *\param[in]	path	La nouvelle valeur.
+		 */
+		inline void setMainScript( castor::Path const & path )
+		{
+			m_mainScript = path;
+		}
+
+	private:
+		bool doWriteScript( castor::Path const & path
+			, castor::FileParser::Script const & script
+			, BinaryChunk & chunk )const;
+		bool doWriteMesh( castor::String const & key
+			, BinaryChunk const & mesh
+			, BinaryChunk & chunk )const;
+		bool doReadHeader( BinaryChunk & chunk )const;
+		bool doReadArchive( BinaryChunk & chunk
+			, castor::Path const & folder );
+		bool doReadScript( BinaryChunk & chunk
+			, castor::Path const & folder );
+		bool doReadMesh( BinaryChunk & chunk
+			, castor::Path const & folder );
+		/**
+		 *\~english
+		 *\brief		Converts a path recorded while compiling to its stored form.
+		 *\remarks		The stored path is relative to the compiled file folder, a file read from a mounted archive being referenced from the archive file.
+		 *\param[in]	path	The recorded path.
+		 *\param[in]	folder	The compiled file folder.
+		 *\return		The stored path.
+		 *\~french
+		 *\brief		Convertit un chemin enregistré lors de la compilation en sa forme stockée.
+		 *\remarks		Le chemin stocké est relatif au dossier du fichier compilé, un fichier lu depuis une archive montée étant référencé depuis le fichier de l'archive.
+		 *\param[in]	path	Le chemin enregistré.
+		 *\param[in]	folder	Le dossier du fichier compilé.
+		 *\return		Le chemin stocké.
+		 */
+		castor::Path doMakePortable( castor::Path const & path
+			, castor::Path const & folder )const;
+		/**
+		 *\~english
+		 *\brief		Converts a stored path back to the path the parsers will use when loading.
+		 *\param[in]	path	The stored path.
+		 *\param[in]	folder	The compiled file folder.
+		 *\return		The absolute path, in the mounted archive if it comes from one.
+		 *\~french
+		 *\brief		Reconvertit un chemin stocké en le chemin que les analyseurs utiliseront lors du chargement.
+		 *\param[in]	path	Le chemin stocké.
+		 *\param[in]	folder	Le dossier du fichier compilé.
+		 *\return		Le chemin absolu, dans l'archive montée s'il en provient.
+		 */
+		castor::Path doMakeLocal( castor::Path const & path
+			, castor::Path const & folder )const;
+		castor::String doMakePortableKey( castor::String const & key
+			, castor::Path const & folder )const;
+		castor::String doMakeLocalKey( castor::String const & key
+			, castor::Path const & folder )const;
+
+	private:
+		Mode m_mode;
+		castor::Path m_mainScript;
+		std::map< castor::Path, castor::FileParser::Script > m_scripts;
+		std::vector< std::pair< castor::Path, castor::Path > > m_archives;
+		std::map< castor::String, BinaryChunk > m_meshes;
+	};
+}
+
+#endif
@@ -85,10 +85,17 @@ namespace castor3d
 		, MeshSPtr mesh )
 		: MovableObject{ name, scene, MovableType::eGeometry, node }
 		, m_mesh{ mesh }
+		, m_handles{ scene.getEngine()->getHandles() }
 	{
+		m_handle = m_handles.add( *this );
 		doUpdateMesh();
 	}
 
+	Geometry::~Geometry()
+	{
+		m_handles.remove( m_handle );
+	}
+
 	void Geometry::prepare( uint32_t & faceCount
 		, uint32_t & vertexCount )
 	{
@@ -115,6 +122,7 @@ namespace castor3d
 	void Geometry::setMesh( MeshSPtr mesh )
 	{
 		m_submeshesMaterials.clear();
+		m_submeshesMaterialHandles.clear();
 		m_mesh = mesh;
 		doUpdateMesh();
 		doUpdateContainers();
@@ -158,6 +166,9 @@ namespace castor3d
 
 			if ( changed )
 			{
+				m_submeshesMaterialHandles[&submesh] = material
+					? material->getHandle()
+					: MaterialHandle{};
 				submesh.setMaterial( oldMaterial, material, updateSubmesh );
 
 				if ( material->hasEnvironmentMapping() )
@@ -174,6 +185,7 @@ namespace castor3d
 
 	MaterialSPtr Geometry::getMaterial( Submesh const & submesh )const
 	{
+		C3D_CountReference();
 		MaterialSPtr result;
 		auto it = m_submeshesMaterials.find( &submesh );
 
@@ -189,6 +201,19 @@ namespace castor3d
 		return result;
 	}
 
+	MaterialHandle Geometry::getMaterialHandle( Submesh const & submesh )const
+	{
+		MaterialHandle result;
+		auto it = m_submeshesMaterialHandles.find( &submesh );
+
+		if ( it != m_submeshesMaterialHandles.end() )
+		{
+			result = it->second;
+		}
+
+		return result;
+	}
+
 	void Geometry::updateContainers( SubmeshBoundingBoxList const & boxes )
 	{
 		m_submeshesBoxes.clear();
@@ -250,10 +275,15 @@ namespace castor3d
 		if ( mesh )
 		{
 			m_meshName = mesh->getName();
+			m_meshHandle = mesh->getHandle();
 
-			for ( auto submesh : *mesh )
+			for ( auto & submesh : *mesh )
 			{
-				m_submeshesMaterials[submesh.get()] = submesh->getDefaultMaterial();
+				auto material = submesh->getDefaultMaterial();
+				m_submeshesMaterials[submesh.get()] = material;
+				m_submeshesMaterialHandles[submesh.get()] = material
+					? material->getHandle()
+					: MaterialHandle{};
 				m_submeshesBoxes.emplace( submesh.get(), submesh->getBoundingBox() );
 				m_submeshesSpheres.emplace( submesh.get(), submesh->getBoundingSphere() );
 			}
@@ -261,6 +291,7 @@ namespace castor3d
 		else
 		{
 			m_meshName = cuEmptyString;
+			m_meshHandle = MeshHandle{};
 		}
 	}
 
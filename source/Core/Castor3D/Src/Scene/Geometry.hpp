@@ -81,6 +81,13 @@ namespace castor3d
 			, Scene & scene
 			, SceneNodeSPtr node
 			, MeshSPtr mesh = nullptr );
+		/**
+		 *\~english
+		 *\brief		Destructor.
+		 *\~french
+		 *\brief		Destructeur.
+		 */
+		C3D_API ~Geometry();
 		/**
 		 *\~english
 		 *brief			Creates the mesh buffers
@@ -112,6 +119,17 @@ namespace castor3d
 		 *\return		Le matériau.
 		 */
 		C3D_API MaterialSPtr getMaterial( Submesh const & submesh )const;
+		/**
+		 *\~english
+		 *\brief		Retrieves the handle to the submesh material, to be resolved through the engine's handle registries.
+		 *\param[in]	submesh	The submesh.
+		 *\return		The handle, invalid if the submesh has no material.
+		 *\~french
+		 *\brief		Récupère la poignée vers le matériau du sous-maillage, à résoudre via les registres de poignées du moteur.
+		 *\param[in]	submesh	Le sous-maillage.
+		 *\return		La poignée, invalide si le sous-maillage n'a pas de matériau.
+		 */
+		C3D_API MaterialHandle getMaterialHandle( Submesh const & submesh )const;
 		/**
 		 *\~english
 		 *\brief		Defines a submesh material.
@@ -174,8 +192,29 @@ namespace castor3d
 		 */
 		inline MeshSPtr getMesh()const
 		{
+			C3D_CountReference();
 			return m_mesh.lock();
 		}
+		/**
+		 *\~english
+		 *\return		The handle to the mesh.
+		 *\~french
+		 *\return		La poignée vers le maillage.
+		 */
+		inline MeshHandle const & getMeshHandle()const
+		{
+			return m_meshHandle;
+		}
+		/**
+		 *\~english
+		 *\return		The handle to the geometry.
+		 *\~french
+		 *\return		La poignée vers la géométrie.
+		 */
+		inline GeometryHandle const & getHandle()const
+		{
+			return m_handle;
+		}
 		/**
 		 *\~english
 		 *\brief		Retrieves the collision box
@@ -209,6 +248,15 @@ namespace castor3d
 		//!\~english	The mesh.
 		//!\~french		Le maillage.
 		MeshWPtr m_mesh;
+		//!\~english	The handle to the mesh.
+		//!\~french		La poignée vers le maillage.
+		MeshHandle m_meshHandle;
+		//!\~english	The engine's handles registries.
+		//!\~french		Les registres de poignées du moteur.
+		HandleRegistries & m_handles;
+		//!\~english	The handle to the geometry.
+		//!\~french		La poignée vers la géométrie.
+		GeometryHandle m_handle;
 		//!\~english	The mesh name
 		//!\~french		Le nom du maillage.
 		castor::String m_meshName;
@@ -221,6 +269,9 @@ namespace castor3d
 		//!\~english	The submeshes materials.
 		//!\~french		Les matériaux des sous maillages.
 		SubmeshMaterialMap m_submeshesMaterials;
+		//!\~english	The handles to the submeshes materials.
+		//!\~french		Les poignées vers les matériaux des sous maillages.
+		SubmeshMaterialHandleMap m_submeshesMaterialHandles;
 		//!\~english	The submeshes bounding boxes.
 		//!\~french		Les bounding box des sous-maillages.
 		SubmeshBoundingBoxMap m_submeshesBoxes;
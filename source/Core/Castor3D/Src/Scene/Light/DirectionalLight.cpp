@@ -6,6 +6,23 @@ using namespace castor;
 
 namespace castor3d
 {
+	namespace
+	{
+		Matrix4x4r const & doGetBiasTransform()
+		{
+			static const Matrix4x4r biasTransform{ []()
+			{
+				Matrix4x4r result;
+				matrix::setTransform( result
+					, Point3r{ 0.5, 0.5, 0.5 }
+					, Point3r{ 0.5, 0.5, 0.5 }
+				, Quaternion::identity() );
+				return result;
+			}( ) };
+			return biasTransform;
+		}
+	}
+
 	DirectionalLight::TextWriter::TextWriter( String const & p_tabs, DirectionalLight const * p_category )
 		: LightCategory::TextWriter{ p_tabs }
 		, m_category{ p_category }
@@ -53,15 +70,6 @@ namespace castor3d
 		, Viewport & p_viewport
 		, int32_t p_index )
 	{
-		static const Matrix4x4r biasTransform{ []()
-		{
-			Matrix4x4r result;
-			matrix::setTransform( result
-				, Point3r{ 0.5, 0.5, 0.5 }
-				, Point3r{ 0.5, 0.5, 0.5 }
-			, Quaternion::identity() );
-			return result;
-		}( ) };
 		auto node = getLight().getParent();
 		node->update();
 		auto orientation = node->getDerivedOrientation();
@@ -69,10 +77,48 @@ namespace castor3d
 		Point3f up{ 0, 1, 0 };
 		orientation.transform( up, up );
 		matrix::lookAt( m_lightSpace, position, position + m_direction, up );
-		m_lightSpace = biasTransform * p_viewport.getProjection() * m_lightSpace;
+		m_lightSpace = doGetBiasTransform() * p_viewport.getProjection() * m_lightSpace;
 		m_farPlane = p_viewport.getFar() - p_viewport.getNear();
 	}
 
+	void DirectionalLight::updateCascades( std::vector< Matrix4x4r > const & cascades
+		, float farPlane )
+	{
+		REQUIRE( !cascades.empty() );
+		auto & bias = doGetBiasTransform();
+		m_lightSpace = bias * cascades[0];
+		m_cascadesCount = std::min( uint32_t( cascades.size() ), shader::DirectionalCascadesCount );
+		m_farPlane = farPlane;
+
+		for ( uint32_t i = 0u; i < m_cascadesCount; ++i )
+		{
+			Matrix4x4r transform = bias * cascades[i];
+			Point4f & cascade = m_cascades[i];
+
+			Point4f & depth = m_cascadesDepths[i / 2u];
+
+			// Orthographic projections with the same orientation: each texture coordinate, and the depth, is an affine function of the first cascade's one.
+			for ( uint32_t axis = 0u; axis < 3u; ++axis )
+			{
+				Point3r reference{ m_lightSpace[0][axis], m_lightSpace[1][axis], m_lightSpace[2][axis] };
+				Point3r current{ transform[0][axis], transform[1][axis], transform[2][axis] };
+				auto scale = point::dot( current, reference ) / point::dot( reference, reference );
+				auto offset = transform[3][axis] - scale * m_lightSpace[3][axis];
+
+				if ( axis < 2u )
+				{
+					cascade[axis] = float( scale );
+					cascade[axis + 2u] = float( offset );
+				}
+				else
+				{
+					depth[( i % 2u ) * 2u] = float( scale );
+					depth[( i % 2u ) * 2u + 1u] = float( offset );
+				}
+			}
+		}
+	}
+
 	void DirectionalLight::updateNode( SceneNode const & p_node )
 	{
 		m_direction = Point3f{ 0, 0, 1 };
@@ -81,7 +127,17 @@ namespace castor3d
 
 	void DirectionalLight::doBind( castor::PxBufferBase & p_texture, uint32_t p_index, uint32_t & p_offset )const
 	{
-		doCopyComponent( m_direction, p_index, p_offset, p_texture );
+		doCopyComponent( m_direction, float( m_cascadesCount ), p_index, p_offset, p_texture );
 		doCopyComponent( m_lightSpace, p_index, p_offset, p_texture );
+
+		for ( auto & cascade : m_cascades )
+		{
+			doCopyComponent( cascade, p_index, p_offset, p_texture );
+		}
+
+		for ( auto & depth : m_cascadesDepths )
+		{
+			doCopyComponent( depth, p_index, p_offset, p_texture );
+		}
 	}
 }
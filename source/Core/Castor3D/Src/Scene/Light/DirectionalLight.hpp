@@ -103,6 +103,22 @@ namespace castor3d
 		C3D_API void updateShadow( castor::Point3r const & target
 			, Viewport & viewport
 			, int32_t index = -1 )override;
+		/**
+		 *\~english
+		 *\brief		Updates the shadow cascades.
+		 *\remarks		The cascades share the light's orientation, only their extent, position and depth range differ.
+		 *				<br />The first one becomes the light space transform, the others are stored as scale and offset applied to it.
+		 *\param[in]	cascades	The cascades projection and view matrices, from the tightest to the widest.
+		 *\param[in]	farPlane	The cascades far plane.
+		 *\~french
+		 *\brief		Met à jour les cascades d'ombres.
+		 *\remarks		Les cascades partagent l'orientation de la source, seules leur étendue, leur position et leur intervalle de profondeur diffèrent.
+		 *				<br />La première devient la transformation vers l'espace de la source, les autres sont stockées en tant qu'échelle et décalage appliqués à celle-ci.
+		 *\param[in]	cascades	Les matrices de projection et de vue des cascades, de la plus serrée à la plus large.
+		 *\param[in]	farPlane	Le plan lointain des cascades.
+		 */
+		C3D_API void updateCascades( std::vector< castor::Matrix4x4r > const & cascades
+			, float farPlane );
 		/**
 		 *\copydoc		castor3d::LightCategory::createTextWriter
 		 */
@@ -130,6 +146,36 @@ namespace castor3d
 		{
 			return m_lightSpace;
 		}
+		/**
+		 *\~english
+		 *\return		The shadow cascades count.
+		 *\~french
+		 *\return		Le nombre de cascades d'ombres.
+		 */
+		inline uint32_t getCascadesCount()const
+		{
+			return m_cascadesCount;
+		}
+		/**
+		 *\~english
+		 *\return		The shadow cascades scale (xy) and offset (zw), from the light space transform.
+		 *\~french
+		 *\return		L'échelle (xy) et le décalage (zw) des cascades d'ombres, depuis la transformation vers l'espace de la source.
+		 */
+		inline std::array< castor::Point4f, shader::DirectionalCascadesCount > const & getCascades()const
+		{
+			return m_cascades;
+		}
+		/**
+		 *\~english
+		 *\return		The shadow cascades depth scale and offset, from the light space transform, two cascades per component.
+		 *\~french
+		 *\return		L'échelle et le décalage de profondeur des cascades d'ombres, depuis la transformation vers l'espace de la source, deux cascades par composante.
+		 */
+		inline std::array< castor::Point4f, shader::DirectionalCascadesCount / 2u > const & getCascadesDepths()const
+		{
+			return m_cascadesDepths;
+		}
 
 	private:
 		/**
@@ -150,6 +196,15 @@ namespace castor3d
 		//!\~english	The light source space transformation matrix.
 		//!\~french		La matrice de transformation vers l'espace de la source lumineuse.
 		mutable castor::Matrix4x4f m_lightSpace;
+		//!\~english	The shadow cascades count.
+		//!\~french		Le nombre de cascades d'ombres.
+		uint32_t m_cascadesCount{ 0u };
+		//!\~english	The shadow cascades scale and offset, from the light space transform.
+		//!\~french		L'échelle et le décalage des cascades d'ombres, depuis la transformation vers l'espace de la source.
+		std::array< castor::Point4f, shader::DirectionalCascadesCount > m_cascades;
+		//!\~english	The shadow cascades depth scale and offset, from the light space transform.
+		//!\~french		L'échelle et le décalage de profondeur des cascades d'ombres, depuis la transformation vers l'espace de la source.
+		std::array< castor::Point4f, shader::DirectionalCascadesCount / 2u > m_cascadesDepths;
 	};
 }
 
@@ -0,0 +1,246 @@
+#include "LightGrid.hpp"
+
+#include <thread>
+
+using namespace castor;
+
+namespace castor3d
+{
+	namespace
+	{
+		// Under this lights count, the jobs dispatch costs more than the build itself.
+		uint32_t constexpr MinParallelLightsCount = 64u;
+
+		uint32_t doGetTile( float ndc, uint32_t count )
+		{
+			auto tile = int32_t( std::floor( ( ndc * 0.5f + 0.5f ) * float( count ) ) );
+			return uint32_t( std::max( 0, std::min( int32_t( count ) - 1, tile ) ) );
+		}
+	}
+
+	LightGrid::LightGrid( Point3ui const & dimensions
+		, uint32_t threadsCount )
+		: m_dimensions{ std::max( 1u, dimensions[0] ), std::max( 1u, dimensions[1] ), std::max( 1u, dimensions[2] ) }
+		, m_clustersLights( m_dimensions[0] * m_dimensions[1] * m_dimensions[2] )
+		, m_clusters( m_clustersLights.size(), Cluster{ 0u, 0u, 0u } )
+	{
+		if ( !threadsCount )
+		{
+			threadsCount = std::thread::hardware_concurrency();
+		}
+
+		threadsCount = std::min( threadsCount, m_dimensions[2] );
+
+		if ( threadsCount > 1u )
+		{
+			m_pool = std::make_unique< ThreadPool >( threadsCount );
+		}
+	}
+
+	LightGrid::~LightGrid()
+	{
+	}
+
+	void LightGrid::reset( Matrix4x4r const & view
+		, Angle const & fovY
+		, float aspect
+		, float nearZ
+		, float farZ
+		, Size const & size )
+	{
+		m_view = view;
+		m_tanHalfFovY = float( ( fovY * 0.5f ).tan() );
+		m_tanHalfFovX = m_tanHalfFovY * aspect;
+		m_near = std::max( nearZ, std::numeric_limits< float >::epsilon() );
+		m_far = std::max( farZ, m_near * 1.01f );
+		m_sliceFactor = float( m_dimensions[2] ) / std::log( m_far / m_near );
+		m_size = size;
+		m_pointLights.clear();
+		m_spotLights.clear();
+	}
+
+	void LightGrid::addPointLight( uint32_t index
+		, Point3r const & position
+		, float radius )
+	{
+		doAddLight( m_pointLights, index, position, radius );
+	}
+
+	void LightGrid::addSpotLight( uint32_t index
+		, Point3r const & position
+		, float radius )
+	{
+		doAddLight( m_spotLights, index, position, radius );
+	}
+
+	void LightGrid::build()
+	{
+		auto const slices = m_dimensions[2];
+
+		if ( m_pool && m_pointLights.size() + m_spotLights.size() >= MinParallelLightsCount )
+		{
+			auto const jobs = uint32_t( m_pool->getCount() );
+			auto const perJob = ( slices + jobs - 1u ) / jobs;
+
+			for ( uint32_t begin = 0u; begin < slices; begin += perJob )
+			{
+				auto end = std::min( slices, begin + perJob );
+				m_pool->pushJob( [this, begin, end]()
+				{
+					doBuildSlices( begin, end );
+				} );
+			}
+
+			m_pool->waitAll( Milliseconds( 0xFFFFFFFF ) );
+		}
+		else
+		{
+			doBuildSlices( 0u, slices );
+		}
+
+		uint32_t offset = 0u;
+		m_indices.clear();
+
+		for ( size_t i = 0u; i < m_clusters.size(); ++i )
+		{
+			auto & lights = m_clustersLights[i];
+			m_clusters[i].m_offset = offset;
+			m_indices.insert( m_indices.end(), lights.begin(), lights.end() );
+			offset += uint32_t( lights.size() );
+		}
+	}
+
+	uint32_t LightGrid::getSlice( float depth )const
+	{
+		auto slice = int32_t( std::floor( std::log( std::max( depth, m_near ) / m_near ) * m_sliceFactor ) );
+		return uint32_t( std::max( 0, std::min( int32_t( m_dimensions[2] ) - 1, slice ) ) );
+	}
+
+	float LightGrid::getSliceNear( uint32_t slice )const
+	{
+		return m_near * std::pow( m_far / m_near, float( slice ) / float( m_dimensions[2] ) );
+	}
+
+	void LightGrid::doAddLight( std::vector< CulledLight > & lights
+		, uint32_t index
+		, Point3r const & position
+		, float radius )
+	{
+		// Column major view matrix, only the depth is needed to reject lights at this point.
+		auto x = m_view[0][0] * position[0] + m_view[1][0] * position[1] + m_view[2][0] * position[2] + m_view[3][0];
+		auto y = m_view[0][1] * position[0] + m_view[1][1] * position[1] + m_view[2][1] * position[2] + m_view[3][1];
+		auto z = m_view[0][2] * position[0] + m_view[1][2] * position[1] + m_view[2][2] * position[2] + m_view[3][2];
+		auto depth = -float( z );
+		// A light reaching further than the whole frustum from its position is bounded to it,
+		// so unattenuated lights keep finite slices.
+		auto frustumRadius = m_far * std::sqrt( 1.0f + m_tanHalfFovX * m_tanHalfFovX + m_tanHalfFovY * m_tanHalfFovY );
+		radius = std::min( radius
+			, float( std::sqrt( x * x + y * y + z * z ) ) + frustumRadius );
+
+		if ( depth + radius >= m_near
+			&& depth - radius <= m_far )
+		{
+			lights.push_back( CulledLight
+			{
+				float( x ),
+				float( y ),
+				depth,
+				radius,
+				index,
+				getSlice( depth - radius ),
+				getSlice( depth + radius ),
+			} );
+		}
+	}
+
+	void LightGrid::doBuildSlices( uint32_t begin
+		, uint32_t end )
+	{
+		for ( uint32_t z = begin; z < end; ++z )
+		{
+			auto sliceNear = getSliceNear( z );
+			auto sliceFar = getSliceNear( z + 1u );
+
+			for ( uint32_t y = 0u; y < m_dimensions[1]; ++y )
+			{
+				for ( uint32_t x = 0u; x < m_dimensions[0]; ++x )
+				{
+					auto index = getClusterIndex( x, y, z );
+					m_clustersLights[index].clear();
+					m_clusters[index] = Cluster{ 0u, 0u, 0u };
+				}
+			}
+
+			auto process = [this, z, sliceNear, sliceFar]( std::vector< CulledLight > const & lights
+				, uint32_t Cluster::* count )
+			{
+				Point2ui minTile;
+				Point2ui maxTile;
+
+				for ( auto & light : lights )
+				{
+					if ( z >= light.m_minSlice
+						&& z <= light.m_maxSlice
+						&& doGetTiles( light, sliceNear, sliceFar, minTile, maxTile ) )
+					{
+						for ( uint32_t y = minTile[1]; y <= maxTile[1]; ++y )
+						{
+							for ( uint32_t x = minTile[0]; x <= maxTile[0]; ++x )
+							{
+								auto index = getClusterIndex( x, y, z );
+								m_clustersLights[index].push_back( light.m_index );
+								++( m_clusters[index].*count );
+							}
+						}
+					}
+				}
+			};
+
+			// Point lights first, then spot lights, as expected by the shaders.
+			process( m_pointLights, &Cluster::m_pointCount );
+			process( m_spotLights, &Cluster::m_spotCount );
+		}
+	}
+
+	bool LightGrid::doGetTiles( CulledLight const & light
+		, float sliceNear
+		, float sliceFar
+		, Point2ui & minTile
+		, Point2ui & maxTile )const
+	{
+		// Depth range of the light's bounding box, inside the slice.
+		auto z0 = std::max( sliceNear, light.m_depth - light.m_radius );
+		auto z1 = std::min( sliceFar, light.m_depth + light.m_radius );
+
+		if ( z0 > z1 )
+		{
+			return false;
+		}
+
+		// The projection x / ( z * tan ) is monotonic on each axis, for z > 0,
+		// so its extrema on the bounding box are reached at the box corners.
+		auto project = [z0, z1]( float min, float max, float tan
+			, float & ndcMin, float & ndcMax )
+		{
+			auto a = min / ( z0 * tan );
+			auto b = min / ( z1 * tan );
+			auto c = max / ( z0 * tan );
+			auto d = max / ( z1 * tan );
+			ndcMin = std::min( std::min( a, b ), std::min( c, d ) );
+			ndcMax = std::max( std::max( a, b ), std::max( c, d ) );
+			return ndcMax >= -1.0f && ndcMin <= 1.0f;
+		};
+
+		float minX, maxX, minY, maxY;
+		auto result = project( light.m_x - light.m_radius, light.m_x + light.m_radius, m_tanHalfFovX, minX, maxX )
+			&& project( light.m_y - light.m_radius, light.m_y + light.m_radius, m_tanHalfFovY, minY, maxY );
+
+		if ( result )
+		{
+			minTile = Point2ui{ doGetTile( minX, m_dimensions[0] ), doGetTile( minY, m_dimensions[1] ) };
+			maxTile = Point2ui{ doGetTile( maxX, m_dimensions[0] ), doGetTile( maxY, m_dimensions[1] ) };
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,304 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_LightGrid_H___
+#define ___C3D_LightGrid_H___
+
+#include "Castor3DPrerequisites.hpp"
+
+#include <Math/Angle.hpp>
+#include <Multithreading/ThreadPool.hpp>
+
+namespace castor3d
+{
+	/*!
+	\author 	Sylvain DOREMUS
+	\date 		20/12/2017
+	\version	0.10.0
+	\~english
+	\brief		Clustered light assignment.
+	\remarks	Splits the view frustum in a 3D grid of clusters (tiles in screen space, exponential slices in depth),
+				and computes, for each cluster, the list of point and spot lights that may affect it.
+				<br />The build is done on CPU, in parallel over the depth slices.
+	\~french
+	\brief		Assignation des lumières par clusters.
+	\remarks	Découpe le frustum de vue en une grille 3D de clusters (tuiles en espace écran, tranches exponentielles en profondeur),
+				et calcule, pour chaque cluster, la liste des sources lumineuses omnidirectionnelles et projecteurs pouvant l'affecter.
+				<br />La construction est faite sur le CPU, en parallèle sur les tranches de profondeur.
+	*/
+	class LightGrid
+	{
+	public:
+		/*!
+		\~english
+		\brief		A cluster's lights range, in the indices list.
+		\~french
+		\brief		L'intervalle des lumières d'un cluster, dans la liste d'indices.
+		*/
+		struct Cluster
+		{
+			//!\~english	The offset of the cluster's first light index.
+			//!\~french		La position du premier indice de lumière du cluster.
+			uint32_t m_offset;
+			//!\~english	The point lights count (their indices come first).
+			//!\~french		Le nombre de sources omnidirectionnelles (leurs indices viennent en premier).
+			uint32_t m_pointCount;
+			//!\~english	The spot lights count (their indices follow the point lights ones).
+			//!\~french		Le nombre de projecteurs (leurs indices suivent ceux des sources omnidirectionnelles).
+			uint32_t m_spotCount;
+		};
+
+	private:
+		struct CulledLight
+		{
+			float m_x;
+			float m_y;
+			float m_depth;
+			float m_radius;
+			uint32_t m_index;
+			uint32_t m_minSlice;
+			uint32_t m_maxSlice;
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	dimensions		The grid dimensions (tiles along X and Y, slices along Z).
+		 *\param[in]	threadsCount	The number of threads used to build the grid, 0 to use the hardware concurrency.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	dimensions		Les dimensions de la grille (tuiles en X et Y, tranches en Z).
+		 *\param[in]	threadsCount	Le nombre de threads utilisés pour construire la grille, 0 pour utiliser la concurrence matérielle.
+		 */
+		C3D_API explicit LightGrid( castor::Point3ui const & dimensions = castor::Point3ui{ 16u, 8u, 24u }
+			, uint32_t threadsCount = 0u );
+		/**
+		 *\~english
+		 *\brief		Destructor.
+		 *\~french
+		 *\brief		Destructeur.
+		 */
+		C3D_API ~LightGrid();
+		/**
+		 *\~english
+		 *\brief		Removes the registered lights and sets the frustum used for the next build.
+		 *\param[in]	view	The camera view matrix.
+		 *\param[in]	fovY	The vertical field of view.
+		 *\param[in]	aspect	The width / height ratio.
+		 *\param[in]	nearZ	The near plane distance.
+		 *\param[in]	farZ	The far plane distance.
+		 *\param[in]	size	The render size, in pixels.
+		 *\~french
+		 *\brief		Supprime les lumières enregistrées, et définit le frustum utilisé pour la prochaine construction.
+		 *\param[in]	view	La matrice de vue de la caméra.
+		 *\param[in]	fovY	L'angle d'ouverture verticale.
+		 *\param[in]	aspect	Le ratio largeur / hauteur.
+		 *\param[in]	nearZ	La distance du plan proche.
+		 *\param[in]	farZ	La distance du plan lointain.
+		 *\param[in]	size	Les dimensions du rendu, en pixels.
+		 */
+		C3D_API void reset( castor::Matrix4x4r const & view
+			, castor::Angle const & fovY
+			, float aspect
+			, float nearZ
+			, float farZ
+			, castor::Size const & size );
+		/**
+		 *\~english
+		 *\brief		Registers a point light.
+		 *\param[in]	index		The light index, in the lights buffer.
+		 *\param[in]	position	The light world position.
+		 *\param[in]	radius		The light influence radius.
+		 *\~french
+		 *\brief		Enregistre une source lumineuse omnidirectionnelle.
+		 *\param[in]	index		L'indice de la source, dans le tampon de sources lumineuses.
+		 *\param[in]	position	La position de la source, dans le monde.
+		 *\param[in]	radius		Le rayon d'influence de la source.
+		 */
+		C3D_API void addPointLight( uint32_t index
+			, castor::Point3r const & position
+			, float radius );
+		/**
+		 *\~english
+		 *\brief		Registers a spot light.
+		 *\remarks		The spot light is bounded by a sphere centered on its position.
+		 *\param[in]	index		The light index, in the lights buffer.
+		 *\param[in]	position	The light world position.
+		 *\param[in]	radius		The light influence radius.
+		 *\~french
+		 *\brief		Enregistre un projecteur.
+		 *\remarks		Le projecteur est englobé dans une sphère centrée sur sa position.
+		 *\param[in]	index		L'indice de la source, dans le tampon de sources lumineuses.
+		 *\param[in]	position	La position de la source, dans le monde.
+		 *\param[in]	radius		Le rayon d'influence de la source.
+		 */
+		C3D_API void addSpotLight( uint32_t index
+			, castor::Point3r const & position
+			, float radius );
+		/**
+		 *\~english
+		 *\brief		Builds the clusters lights lists, from the registered lights.
+		 *\~french
+		 *\brief		Construit les listes de lumières des clusters, à partir des lumières enregistrées.
+		 */
+		C3D_API void build();
+		/**
+		 *\~english
+		 *\param[in]	depth	A view space depth (positive).
+		 *\return		The depth slice containing it.
+		 *\~french
+		 *\param[in]	depth	Une profondeur en espace vue (positive).
+		 *\return		La tranche de profondeur la contenant.
+		 */
+		C3D_API uint32_t getSlice( float depth )const;
+		/**
+		 *\~english
+		 *\param[in]	slice	A depth slice.
+		 *\return		The view space depth of its near bound.
+		 *\~french
+		 *\param[in]	slice	Une tranche de profondeur.
+		 *\return		La profondeur en espace vue de sa limite proche.
+		 */
+		C3D_API float getSliceNear( uint32_t slice )const;
+		/**
+		 *\~english
+		 *\return		The factor used to compute a slice from a depth: slice = log( depth / near ) * factor.
+		 *\~french
+		 *\return		Le facteur utilisé pour calculer une tranche depuis une profondeur : tranche = log( profondeur / proche ) * facteur.
+		 */
+		inline float getSliceFactor()const
+		{
+			return m_sliceFactor;
+		}
+		/**
+		 *\~english
+		 *\return		The cluster index for given coordinates.
+		 *\~french
+		 *\return		L'indice du cluster pour les coordonnées données.
+		 */
+		inline uint32_t getClusterIndex( uint32_t x, uint32_t y, uint32_t z )const
+		{
+			return x + m_dimensions[0] * ( y + m_dimensions[1] * z );
+		}
+		/**
+		 *\~english
+		 *\return		The grid dimensions.
+		 *\~french
+		 *\return		Les dimensions de la grille.
+		 */
+		inline castor::Point3ui const & getDimensions()const
+		{
+			return m_dimensions;
+		}
+		/**
+		 *\~english
+		 *\return		The clusters.
+		 *\~french
+		 *\return		Les clusters.
+		 */
+		inline std::vector< Cluster > const & getClusters()const
+		{
+			return m_clusters;
+		}
+		/**
+		 *\~english
+		 *\return		The lights indices, for all clusters.
+		 *\~french
+		 *\return		Les indices des lumières, pour tous les clusters.
+		 */
+		inline std::vector< uint32_t > const & getIndices()const
+		{
+			return m_indices;
+		}
+		/**
+		 *\~english
+		 *\return		The near plane distance.
+		 *\~french
+		 *\return		La distance du plan proche.
+		 */
+		inline float getNear()const
+		{
+			return m_near;
+		}
+		/**
+		 *\~english
+		 *\return		The far plane distance.
+		 *\~french
+		 *\return		La distance du plan lointain.
+		 */
+		inline float getFar()const
+		{
+			return m_far;
+		}
+		/**
+		 *\~english
+		 *\return		The render size.
+		 *\~french
+		 *\return		Les dimensions du rendu.
+		 */
+		inline castor::Size const & getSize()const
+		{
+			return m_size;
+		}
+
+	private:
+		void doAddLight( std::vector< CulledLight > & lights
+			, uint32_t index
+			, castor::Point3r const & position
+			, float radius );
+		void doBuildSlices( uint32_t begin
+			, uint32_t end );
+		bool doGetTiles( CulledLight const & light
+			, float sliceNear
+			, float sliceFar
+			, castor::Point2ui & minTile
+			, castor::Point2ui & maxTile )const;
+
+	private:
+		//!\~english	The grid dimensions.
+		//!\~french		Les dimensions de la grille.
+		castor::Point3ui m_dimensions;
+		//!\~english	The camera view matrix.
+		//!\~french		La matrice de vue de la caméra.
+		castor::Matrix4x4r m_view;
+		//!\~english	The tangent of the half horizontal field of view.
+		//!\~french		La tangente de la moitié de l'angle d'ouverture horizontal.
+		float m_tanHalfFovX{ 1.0f };
+		//!\~english	The tangent of the half vertical field of view.
+		//!\~french		La tangente de la moitié de l'angle d'ouverture vertical.
+		float m_tanHalfFovY{ 1.0f };
+		//!\~english	The near plane distance.
+		//!\~french		La distance du plan proche.
+		float m_near{ 0.1f };
+		//!\~english	The far plane distance.
+		//!\~french		La distance du plan lointain.
+		float m_far{ 1000.0f };
+		//!\~english	The depth slice factor.
+		//!\~french		Le facteur de tranche de profondeur.
+		float m_sliceFactor{ 1.0f };
+		//!\~english	The render size.
+		//!\~french		Les dimensions du rendu.
+		castor::Size m_size;
+		//!\~english	The registered point lights, in view space.
+		//!\~french		Les sources omnidirectionnelles enregistrées, en espace vue.
+		std::vector< CulledLight > m_pointLights;
+		//!\~english	The registered spot lights, in view space.
+		//!\~french		Les projecteurs enregistrés, en espace vue.
+		std::vector< CulledLight > m_spotLights;
+		//!\~english	The per cluster lights indices, filled by the slices jobs.
+		//!\~french		Les indices des lumières par cluster, remplis par les tâches de tranches.
+		std::vector< std::vector< uint32_t > > m_clustersLights;
+		//!\~english	The clusters.
+		//!\~french		Les clusters.
+		std::vector< Cluster > m_clusters;
+		//!\~english	The lights indices, for all clusters.
+		//!\~french		Les indices des lumières, pour tous les clusters.
+		std::vector< uint32_t > m_indices;
+		//!\~english	The pool used to build the slices in parallel.
+		//!\~french		Le pool utilisé pour construire les tranches en parallèle.
+		std::unique_ptr< castor::ThreadPool > m_pool;
+	};
+}
+
+#endif
@@ -24,6 +24,7 @@ namespace castor3d
 		, Named( p_name )
 		, m_type( p_type )
 		, m_sceneNode( p_sn )
+		, m_sceneNodeHandle( p_sn ? p_sn->getHandle() : SceneNodeHandle{} )
 	{
 	}
 
@@ -42,6 +43,7 @@ namespace castor3d
 			m_notifyIndex.disconnect();
 			node->detachObject( *this );
 			m_sceneNode.reset();
+			m_sceneNodeHandle = SceneNodeHandle{};
 		}
 	}
 
@@ -52,10 +54,12 @@ namespace castor3d
 		if ( p_node )
 		{
 			m_strNodeName = p_node->getName();
+			m_sceneNodeHandle = p_node->getHandle();
 		}
 		else
 		{
 			m_strNodeName.clear();
+			m_sceneNodeHandle = SceneNodeHandle{};
 		}
 	}
 }
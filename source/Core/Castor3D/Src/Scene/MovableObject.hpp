@@ -7,6 +7,7 @@ See LICENSE file in root folder
 #include "SceneNode.hpp"
 
 #include "Animation/Animable.hpp"
+#include "Miscellaneous/ReferenceCounter.hpp"
 
 #include <Design/Named.hpp>
 #include <Design/OwnedBy.hpp>
@@ -106,8 +107,19 @@ namespace castor3d
 		 */
 		inline SceneNodeSPtr getParent()const
 		{
+			C3D_CountReference();
 			return m_sceneNode.lock();
 		}
+		/**
+		 *\~english
+		 *\return		The handle to the parent node, to be used in the render paths instead of getParent.
+		 *\~french
+		 *\return		La poignée vers le noeud parent, à utiliser dans les chemins de rendu au lieu de getParent.
+		 */
+		inline SceneNodeHandle const & getParentHandle()const
+		{
+			return m_sceneNodeHandle;
+		}
 		/**
 		 *\~english
 		 *\brief		Retrieves the object type
@@ -131,6 +143,9 @@ namespace castor3d
 		//!\~english	The parent scene node.
 		//!\~french		Le noeud parent.
 		SceneNodeWPtr m_sceneNode;
+		//!\~english	The handle to the parent scene node.
+		//!\~french		La poignée vers le noeud parent.
+		SceneNodeHandle m_sceneNodeHandle;
 		//!\~english	The node change notification index.
 		//!\~french		L'indice de notifcation des changements du noeud.
 		OnSceneNodeChangedConnection m_notifyIndex;
@@ -4,6 +4,7 @@
 #include "BillboardList.hpp"
 #include "ColourSkybox.hpp"
 #include "Geometry.hpp"
+#include "SceneNodePool.hpp"
 #include "Skybox.hpp"
 
 #include "Animation/AnimatedObjectGroup.hpp"
@@ -447,6 +448,8 @@ namespace castor3d
 	Scene::Scene( String const & name, Engine & engine )
 		: OwnedBy< Engine >{ engine }
 		, Named{ name }
+		, m_changes{ std::make_shared< ChangeJournal >( *this ) }
+		, m_sceneNodePool{ std::make_shared< SceneNodePool >( m_changes ) }
 		, m_listener{ engine.getFrameListenerCache().add( cuT( "Scene_" ) + name + string::toString( (size_t)this ) ) }
 		, m_animationUpdater{ std::max( 2u, engine.getCpuInformations().getCoreCount() - ( engine.isThreaded() ? 2u : 1u ) ) }
 		, m_backgroundColourSkybox{ engine }
@@ -740,6 +743,10 @@ namespace castor3d
 		m_onBillboardListChanged = m_billboardCache->onChanged.connect( std::bind( &Scene::setChanged, this ) );
 		m_onGeometryChanged = m_geometryCache->onChanged.connect( std::bind( &Scene::setChanged, this ) );
 		m_onSceneNodeChanged = m_sceneNodeCache->onChanged.connect( std::bind( &Scene::setChanged, this ) );
+		m_onMaterialsChanged = m_changes->onMaterialsChanged.connect( [this]( std::vector< Material const * > const & )
+		{
+			m_dirtyMaterials = true;
+		} );
 		m_backgroundColourSkybox.setScene( *this );
 		m_backgroundColourSkybox.setColour( m_backgroundColour );
 	}
@@ -750,6 +757,7 @@ namespace castor3d
 		m_onGeometryChanged.disconnect();
 		m_onBillboardListChanged.disconnect();
 		m_onParticleSystemChanged.disconnect();
+		m_onMaterialsChanged.disconnect();
 
 		m_meshCache->clear();
 
@@ -902,8 +910,9 @@ namespace castor3d
 
 	void Scene::update()
 	{
-		m_rootNode->update();
+		m_sceneNodePool->update( &m_animationUpdater );
 		doUpdateAnimations();
+		m_changes->flush();
 		doUpdateNoSkybox();
 		doUpdateMaterials();
 		getLightCache().update();
@@ -974,9 +983,9 @@ namespace castor3d
 	uint32_t Scene::getVertexCount()const
 	{
 		uint32_t result = 0;
-		auto lock = makeUniqueLock( *m_geometryCache );
+		auto geometries = m_geometryCache->getSnapshot();
 
-		for ( auto pair : *m_geometryCache )
+		for ( auto & pair : *geometries )
 		{
 			auto mesh = pair.second->getMesh();
 
@@ -992,9 +1001,9 @@ namespace castor3d
 	uint32_t Scene::getFaceCount()const
 	{
 		uint32_t result = 0;
-		auto lock = makeUniqueLock( *m_geometryCache );
+		auto geometries = m_geometryCache->getSnapshot();
 
-		for ( auto pair : *m_geometryCache )
+		for ( auto & pair : *geometries )
 		{
 			auto mesh = pair.second->getMesh();
 
@@ -1041,9 +1050,9 @@ namespace castor3d
 
 	bool Scene::hasShadows()const
 	{
-		auto lock = makeUniqueLock( getLightCache() );
+		auto lights = getLightCache().getSnapshot();
 
-		return getLightCache().end() != std::find_if( getLightCache().begin(), getLightCache().end(), []( std::pair< String, LightSPtr > const & p_it )
+		return lights->end() != std::find_if( lights->begin(), lights->end(), []( std::pair< String, LightSPtr > const & p_it )
 		{
 			return p_it.second->isShadowProducer();
 		} );
@@ -1189,6 +1198,6 @@ namespace castor3d
 
 	void Scene::onMaterialChanged( Material const & material )
 	{
-		m_dirtyMaterials = true;
+		m_changes->record( material );
 	}
 }
@@ -20,6 +20,7 @@ See LICENSE file in root folder
 
 #include "HDR/HdrConfig.hpp"
 #include "RenderToTexture/TextureProjection.hpp"
+#include "Scene/ChangeJournal.hpp"
 #include "Scene/ColourSkybox.hpp"
 #include "Scene/Fog.hpp"
 #include "Scene/Shadow.hpp"
@@ -305,6 +306,26 @@ namespace castor3d
 		{
 			return m_rootNode;
 		}
+		/**
+		 *\~english
+		 *\return		The pool holding the scene nodes transform data.
+		 *\~french
+		 *\return		Le pool contenant les données de transformation des noeuds de la scène.
+		 */
+		inline SceneNodePoolSPtr getSceneNodePool()const
+		{
+			return m_sceneNodePool;
+		}
+		/**
+		 *\~english
+		 *\return		The journal of the changes in the scene, flushed in update().
+		 *\~french
+		 *\return		Le journal des changements dans la scène, vidé dans update().
+		 */
+		inline ChangeJournal & getChanges()const
+		{
+			return *m_changes;
+		}
 		/**
 		 *\~english
 		 *\return		The cameras root node.
@@ -354,7 +375,7 @@ namespace castor3d
 		inline void setChanged()
 		{
 			m_changed = true;
-			onChanged( *this );
+			m_changes->recordSceneChange();
 		}
 		/**
 		 *\~english
@@ -565,6 +586,12 @@ namespace castor3d
 		//!\~english	Tells if the scene is initialised.
 		//!\~french		Dit si la scène est initialisée.
 		bool m_initialised{ false };
+		//!\~english	The journal of the changes in the scene.
+		//!\~french		Le journal des changements dans la scène.
+		ChangeJournalSPtr m_changes;
+		//!\~english	The pool holding the scene nodes transform data.
+		//!\~french		Le pool contenant les données de transformation des noeuds de la scène.
+		SceneNodePoolSPtr m_sceneNodePool;
 		//!\~english	The root node
 		//!\~french		Le noeud père de tous les noeuds de la scène
 		SceneNodeSPtr m_rootNode;
@@ -670,6 +697,9 @@ namespace castor3d
 		//!\~english	Tells if the materials hav changed since last update.
 		//!\~french		Dit si les matériaux ont changé depuis la dernière mise à jour.
 		bool m_dirtyMaterials{ true };
+		//!\~english	The connection to the materials changes, from the journal.
+		//!\~french		La connexion aux changements de matériaux, depuis le journal.
+		OnMaterialsChangedConnection m_onMaterialsChanged;
 
 	public:
 		//!\~english	The cameras root node name.
@@ -2,9 +2,10 @@
 
 #include "Engine.hpp"
 
+#include "Scene/CompiledSceneFile.hpp"
 #include "Scene/SceneFileParser_Parsers.hpp"
 
-#include <Data/ZipArchive.hpp>
+#include <Data/VirtualFileSystem.hpp>
 
 using namespace castor3d;
 using namespace castor;
@@ -44,6 +45,7 @@ SceneFileContext::SceneFileContext( Path const & path, SceneFileParser * parser
 	, m_pGeneralParentMaterial( nullptr )
 	, mapScenes()
 	, m_pParser( parser )
+	, loader( nullptr )
 {
 }
 
@@ -344,53 +346,58 @@ bool SceneFileParser::parseFile( Path const & pathFile )
 {
 	Path path = pathFile;
 
+	if ( path.getExtension() == cuT( "cscb" ) )
+	{
+		return doLoadCompiled( path );
+	}
+
 	if ( path.getExtension() == cuT( "zip" ) )
 	{
-		castor::ZipArchive archive( path, File::OpenMode::eRead );
+		// The archive is mounted, instead of being inflated on the disk,
+		// its files are then read directly from it.
 		path = Engine::getEngineDirectory() / pathFile.getFileName();
+		VirtualFileSystem::mountArchive( path, pathFile );
+		auto compiled = CompiledSceneFile::getActive();
 
-		if ( File::directoryExists( path ) )
+		if ( compiled && compiled->getMode() == CompiledSceneFile::Mode::eCompile )
 		{
-			File::directoryDelete( path );
+			compiled->addArchive( path, pathFile );
 		}
 
-		if ( archive.inflate( path ) )
+		PathArray files;
+
+		if ( VirtualFileSystem::listDirectoryFiles( path, files, true ) )
 		{
-			PathArray files;
+			auto it = std::find_if( files.begin()
+				, files.end()
+				, [pathFile]( Path const & lookup )
+				{
+					auto fileName = lookup.getFileName( true );
+					return fileName == cuT( "main.cscn" )
+						|| fileName == cuT( "scene.cscn" )
+						|| fileName == pathFile.getFileName() + cuT( ".cscn" );
+				} );
 
-			if ( File::listDirectoryFiles( path, files, true ) )
+			if ( it != files.end() )
+			{
+				path = *it;
+			}
+			else
 			{
-				auto it = std::find_if( files.begin()
-					, files.end()
-					, [pathFile]( Path const & lookup )
-					{
-						auto fileName = lookup.getFileName( true );
-						return fileName == cuT( "main.cscn" )
-							|| fileName == cuT( "scene.cscn" )
-							|| fileName == pathFile.getFileName() + cuT( ".cscn" );
-					} );
+				auto it = std::find_if( files.begin(), files.end(), []( Path const & p_path )
+				{
+					return p_path.getExtension() == cuT( "cscn" );
+				} );
 
 				if ( it != files.end() )
 				{
 					path = *it;
 				}
-				else
-				{
-					auto it = std::find_if( files.begin(), files.end(), []( Path const & p_path )
-					{
-						return p_path.getExtension() == cuT( "cscn" );
-					} );
-
-					if ( it != files.end() )
-					{
-						path = *it;
-					}
-				}
 			}
 		}
 	}
 
-	return FileParser::parseFile( path );
+	return doParseFile( path );
 }
 
 bool SceneFileParser::parseFile( castor::Path const & pathFile, SceneFileContextSPtr context )
@@ -399,11 +406,33 @@ bool SceneFileParser::parseFile( castor::Path const & pathFile, SceneFileContext
 	return parseFile( pathFile );
 }
 
+bool SceneFileParser::compileFile( Path const & source
+	, Path const & target )
+{
+	CompiledSceneFile compiled{ CompiledSceneFile::Mode::eCompile };
+	bool result = false;
+
+	{
+		CompiledSceneFile::Scope scope{ compiled };
+		result = parseFile( source );
+	}
+
+	if ( result )
+	{
+		result = compiled.write( target );
+	}
+
+	return result;
+}
+
 void SceneFileParser::doInitialiseParser( Path const & path )
 {
 	if ( !m_context )
 	{
 		SceneFileContextSPtr context = std::make_shared< SceneFileContext >( path, this );
+		// The files parsed with this context (included files) share its assets loader.
+		m_loader = std::make_unique< AssetLoader >( getEngine()->getCpuInformations().getCoreCount() );
+		context->loader = m_loader.get();
 		m_context = context;
 	}
 
@@ -715,6 +744,18 @@ void SceneFileParser::doCleanupParser()
 	SceneFileContextSPtr context = std::static_pointer_cast< SceneFileContext >( m_context );
 	m_context.reset();
 
+	if ( m_loader )
+	{
+		// The assets must be loaded before the scenes initialisation.
+		if ( !m_loader->join() )
+		{
+			Logger::logWarning( cuT( "Some assets of the scene file couldn't be loaded" ) );
+		}
+
+		context->loader = nullptr;
+		m_loader.reset();
+	}
+
 	for ( ScenePtrStrMap::iterator it = context->mapScenes.begin(); it != context->mapScenes.end(); ++it )
 	{
 		m_mapScenes.insert( std::make_pair( it->first,  it->second ) );
@@ -733,6 +774,55 @@ void SceneFileParser::doValidate()
 {
 }
 
+bool SceneFileParser::doParseFile( Path const & path )
+{
+	bool result = false;
+	auto compiled = CompiledSceneFile::getActive();
+	FileParser::Script const * script = nullptr;
+
+	if ( compiled && compiled->getMode() == CompiledSceneFile::Mode::eLoad )
+	{
+		script = compiled->findScript( path );
+	}
+
+	if ( script )
+	{
+		result = replay( path, *script );
+	}
+	else if ( compiled && compiled->getMode() == CompiledSceneFile::Mode::eCompile )
+	{
+		if ( compiled->getMainScript().empty() )
+		{
+			compiled->setMainScript( path );
+		}
+
+		startRecording();
+		result = FileParser::parseFile( path );
+		compiled->addScript( path, stopRecording() );
+	}
+	else
+	{
+		result = FileParser::parseFile( path );
+	}
+
+	return result;
+}
+
+bool SceneFileParser::doLoadCompiled( Path const & path )
+{
+	CompiledSceneFile compiled{ CompiledSceneFile::Mode::eLoad };
+	bool result = compiled.read( path );
+
+	if ( result )
+	{
+		compiled.mountArchives();
+		CompiledSceneFile::Scope scope{ compiled };
+		result = doParseFile( compiled.getMainScript() );
+	}
+
+	return result;
+}
+
 String SceneFileParser::doGetSectionName( uint32_t section )
 {
 	String result;
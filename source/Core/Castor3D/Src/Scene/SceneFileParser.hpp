@@ -10,6 +10,7 @@ See LICENSE file in root folder
 #include <FileParser/FileParserContext.hpp>
 
 #include "Mesh/Submesh.hpp"
+#include "Scene/AssetLoader.hpp"
 #include "Scene/Skybox.hpp"
 #include "Technique/Opaque/Ssao/SsaoConfig.hpp"
 #include "Material/SubsurfaceScattering.hpp"
@@ -155,6 +156,7 @@ namespace castor3d
 		ParticleSystemSPtr particleSystem;
 		SsaoConfig ssaoConfig;
 		SubsurfaceScatteringUPtr subsurfaceScattering;
+		AssetLoader * loader;
 	};
 	/*!
 	\author		Sylvain DOREMUS
@@ -219,6 +221,22 @@ namespace castor3d
 		 *\return		\p false si un problème est survenu.
 		 */
 		C3D_API bool parseFile( castor::Path const & path, SceneFileContextSPtr context );
+		/**
+		 *\~english
+		 *\brief		Compiles the given scene file into a compiled scene file (CSCB), loading the scene.
+		 *\remarks		The compiled file can then be given to parseFile, to load the scene without text parsing.
+		 *\param[in]	source	The scene file (CSCN file, or zip archive).
+		 *\param[in]	target	The compiled scene file.
+		 *\return		\p false if any problem occured.
+		 *\~french
+		 *\brief		Compile le fichier de scène donné en un fichier de scène compilé (CSCB), en chargeant la scène.
+		 *\remarks		Le fichier compilé peut ensuite être donné à parseFile, pour charger la scène sans analyse de texte.
+		 *\param[in]	source	Le fichier de scène (fichier CSCN, ou archive zip).
+		 *\param[in]	target	Le fichier de scène compilé.
+		 *\return		\p false si un problème est survenu.
+		 */
+		C3D_API bool compileFile( castor::Path const & source
+			, castor::Path const & target );
 
 		inline ScenePtrStrMap::iterator scenesBegin()
 		{
@@ -243,11 +261,14 @@ namespace castor3d
 		C3D_API bool doDiscardParser( castor::String const & line )override;
 		C3D_API void doValidate()override;
 		C3D_API castor::String doGetSectionName( uint32_t section )override;
+		bool doParseFile( castor::Path const & path );
+		bool doLoadCompiled( castor::Path const & path );
 
 	private:
 		castor::String m_strSceneFilePath;
 		ScenePtrStrMap m_mapScenes;
 		RenderWindowSPtr m_renderWindow;
+		std::unique_ptr< AssetLoader > m_loader;
 
 		UIntStrMap m_mapBlendFactors;
 		UIntStrMap m_mapTypes;
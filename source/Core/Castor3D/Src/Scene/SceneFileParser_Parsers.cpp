@@ -37,6 +37,7 @@
 #include "Render/RenderTarget.hpp"
 #include "Render/RenderWindow.hpp"
 #include "Scene/BillboardList.hpp"
+#include "Scene/CompiledSceneFile.hpp"
 #include "Scene/ParticleSystem/ParticleSystem.hpp"
 #include "Scene/Animation/AnimatedObjectGroup.hpp"
 #include "Scene/Light/PointLight.hpp"
@@ -45,6 +46,7 @@
 #include "Texture/Sampler.hpp"
 #include "Texture/TextureLayout.hpp"
 
+#include <Data/VirtualFileSystem.hpp>
 #include <Graphics/Font.hpp>
 #include <Graphics/Image.hpp>
 
@@ -72,6 +74,59 @@ namespace castor3d
 
 			return result;
 		}
+
+		void doSelectChannels( TextureLayout & texture
+			, Path const & relative
+			, String const & channels )
+		{
+			if ( texture.getImage().getBaked() )
+			{
+				Logger::logWarning( cuT( "Channels selection is ignored for baked texture [" ) + relative + cuT( "]" ) );
+				return;
+			}
+
+			auto buffer = texture.getImage().getBuffer();
+
+			if ( channels == cuT( "rgb" ) )
+			{
+				buffer = PxBufferBase::create( buffer->dimensions()
+					, PF::getPFWithoutAlpha( buffer->format() )
+					, buffer->constPtr()
+					, buffer->format() );
+			}
+			else if ( channels == cuT( "r" ) )
+			{
+				auto format = ( buffer->format() == PixelFormat::eR8G8B8
+					|| buffer->format() == PixelFormat::eB8G8R8
+					|| buffer->format() == PixelFormat::eR8G8B8_SRGB
+					|| buffer->format() == PixelFormat::eB8G8R8_SRGB
+					|| buffer->format() == PixelFormat::eA8R8G8B8
+					|| buffer->format() == PixelFormat::eA8B8G8R8
+					|| buffer->format() == PixelFormat::eA8R8G8B8_SRGB
+					|| buffer->format() == PixelFormat::eA8B8G8R8_SRGB )
+					? PixelFormat::eL8
+					: ( buffer->format() == PixelFormat::eRGB16F
+						|| buffer->format() == PixelFormat::eRGBA16F
+						|| buffer->format() == PixelFormat::eRGB16F32F
+						|| buffer->format() == PixelFormat::eRGBA16F32F )
+						? PixelFormat::eL16F32F
+						: ( buffer->format() == PixelFormat::eRGB32F
+							|| buffer->format() == PixelFormat::eRGBA32F )
+							? PixelFormat::eL32F
+							: buffer->format();
+				buffer = PxBufferBase::create( buffer->dimensions()
+					, format
+					, buffer->constPtr()
+					, buffer->format() );
+			}
+			else if ( channels == cuT( "a" ) )
+			{
+				auto tmp = PF::extractAlpha( buffer );
+				buffer = tmp;
+			}
+
+			texture.getImage().setBuffer( buffer );
+		}
 	}
 
 	IMPLEMENT_ATTRIBUTE_PARSER( parserRootMtlFile )
@@ -87,7 +142,7 @@ namespace castor3d
 			Path path;
 			path = p_context->m_file.getPath() / p_params[0]->get( path );
 
-			if ( File::fileExists( path ) )
+			if ( VirtualFileSystem::fileExists( path ) )
 			{
 				Logger::logInfo( cuT( "Loading materials file : " ) + path );
 
@@ -1786,28 +1841,33 @@ namespace castor3d
 		}
 		else if ( !p_params.empty() )
 		{
-			if ( parsingContext->pGeometry->getMesh() )
-			{
-				auto & cache = parsingContext->m_pParser->getEngine()->getMaterialCache();
-				String name;
-				p_params[0]->get( name );
+			auto & cache = parsingContext->m_pParser->getEngine()->getMaterialCache();
+			String name;
+			p_params[0]->get( name );
 
-				if ( cache.has( name ) )
-				{
-					for ( auto submesh : *parsingContext->pGeometry->getMesh() )
+			if ( cache.has( name ) )
+			{
+				auto geometry = parsingContext->pGeometry;
+				MaterialSPtr material = cache.find( name );
+				parsingContext->loader->pushContinuation( geometry.get()
+					, [geometry, material]()
 					{
-						MaterialSPtr material = cache.find( name );
-						parsingContext->pGeometry->setMaterial( *submesh, material );
-					}
-				}
-				else
-				{
-					PARSING_ERROR( cuT( "Material " ) + name + cuT( " does not exist" ) );
-				}
+						if ( geometry->getMesh() )
+						{
+							for ( auto submesh : *geometry->getMesh() )
+							{
+								geometry->setMaterial( *submesh, material );
+							}
+						}
+						else
+						{
+							Logger::logError( cuT( "Geometry " ) + geometry->getName() + cuT( ": Geometry's mesh not initialised" ) );
+						}
+					} );
 			}
 			else
 			{
-				PARSING_ERROR( cuT( "Geometry's mesh not initialised" ) );
+				PARSING_ERROR( cuT( "Material " ) + name + cuT( " does not exist" ) );
 			}
 		}
 	}
@@ -1869,35 +1929,37 @@ namespace castor3d
 		}
 		else if ( !p_params.empty() )
 		{
-			if ( parsingContext->pGeometry->getMesh() )
-			{
-				auto & cache = parsingContext->m_pParser->getEngine()->getMaterialCache();
-				String name;
-				uint16_t index;
-				p_params[0]->get( index );
-				p_params[1]->get( name );
+			auto & cache = parsingContext->m_pParser->getEngine()->getMaterialCache();
+			String name;
+			uint16_t index;
+			p_params[0]->get( index );
+			p_params[1]->get( name );
 
-				if ( cache.has( name ) )
-				{
-					if ( parsingContext->pGeometry->getMesh()->getSubmeshCount() > index )
-					{
-						SubmeshSPtr submesh = parsingContext->pGeometry->getMesh()->getSubmesh( index );
-						MaterialSPtr material = cache.find( name );
-						parsingContext->pGeometry->setMaterial( *submesh, material );
-					}
-					else
+			if ( cache.has( name ) )
+			{
+				auto geometry = parsingContext->pGeometry;
+				MaterialSPtr material = cache.find( name );
+				parsingContext->loader->pushContinuation( geometry.get()
+					, [geometry, material, index]()
 					{
-						PARSING_ERROR( cuT( "Submesh index is too high" ) );
-					}
-				}
-				else
-				{
-					PARSING_ERROR( cuT( "Material " ) + name + cuT( " does not exist" ) );
-				}
+						if ( !geometry->getMesh() )
+						{
+							Logger::logError( cuT( "Geometry " ) + geometry->getName() + cuT( ": Geometry's mesh not initialised" ) );
+						}
+						else if ( geometry->getMesh()->getSubmeshCount() > index )
+						{
+							SubmeshSPtr submesh = geometry->getMesh()->getSubmesh( index );
+							geometry->setMaterial( *submesh, material );
+						}
+						else
+						{
+							Logger::logError( cuT( "Geometry " ) + geometry->getName() + cuT( ": Submesh index is too high" ) );
+						}
+					} );
 			}
 			else
 			{
-				PARSING_ERROR( cuT( "Geometry's mesh not initialised" ) );
+				PARSING_ERROR( cuT( "Material " ) + name + cuT( " does not exist" ) );
 			}
 		}
 	}
@@ -1955,6 +2017,7 @@ namespace castor3d
 		}
 		else
 		{
+			parsingContext->loader->wait( parsingContext->pMesh.get() );
 			parsingContext->pSubmesh = parsingContext->pMesh->createSubmesh();
 		}
 	}
@@ -1973,10 +2036,10 @@ namespace castor3d
 			Path path;
 			Path pathFile = p_context->m_file.getPath() / p_params[0]->get( path );
 			Parameters parameters;
+			String params;
 
 			if ( p_params.size() > 1 )
 			{
-				String params;
 				StringArray paramArray = string::split( p_params[1]->get( params ), cuT( "-" ), 20, false );
 
 				for ( auto param : paramArray )
@@ -2027,11 +2090,56 @@ namespace castor3d
 			else
 			{
 				parsingContext->pMesh = parsingContext->pScene->getMeshCache().add( parsingContext->strName2 );
-				auto importer = engine->getImporterFactory().create( extension, *engine );
+				auto mesh = parsingContext->pMesh;
+				auto & loader = *parsingContext->loader;
+				auto compiled = CompiledSceneFile::getActive();
+				ImporterSPtr importer = engine->getImporterFactory().create( extension, *engine );
+				String const key = pathFile + cuT( "|" ) + params;
+				// A mesh already imported, or being imported, only gets its default materials back.
+				bool const imported = !mesh->getSubmeshCount()
+					&& !loader.isPending( mesh.get() );
+				loader.pushJob( mesh.get()
+					, cuT( "Mesh " ) + mesh->getName() + cuT( " [" ) + pathFile + cuT( "]" )
+					, [mesh, importer, compiled, key, pathFile, parameters]()
+					{
+						if ( compiled
+							&& compiled->getMode() == CompiledSceneFile::Mode::eLoad
+							&& !mesh->getSubmeshCount()
+							&& compiled->loadMesh( key, *mesh ) )
+						{
+							for ( auto submesh : *mesh )
+							{
+								mesh->getScene()->getListener().postEvent( makeInitialiseEvent( *submesh ) );
+							}
+
+							return true;
+						}
 
-				if ( !importer->importMesh( *parsingContext->pMesh, pathFile, parameters, true ) )
+						return importer->importMesh( *mesh, pathFile, parameters, true );
+					} );
+
+				if ( imported
+					&& compiled
+					&& compiled->getMode() == CompiledSceneFile::Mode::eCompile
+					&& extension != cuT( "cmsh" ) )
 				{
-					PARSING_ERROR( cuT( "Mesh Import failed" ) );
+					loader.pushContinuation( mesh.get()
+						, [mesh, compiled, key, engine]()
+						{
+							// Only the geometry is embedded, the meshes referencing other resources are imported again when loading.
+							if ( mesh->getSubmeshCount()
+								&& !mesh->getSkeleton()
+								&& mesh->getAnimations().empty()
+								&& std::all_of( mesh->begin()
+									, mesh->end()
+									, [engine]( SubmeshSPtr submesh )
+									{
+										return submesh->getDefaultMaterial() == engine->getMaterialCache().getDefaultMaterial();
+									} ) )
+							{
+								compiled->addMesh( key, *mesh );
+							}
+						} );
 				}
 			}
 		}
@@ -2090,52 +2198,57 @@ namespace castor3d
 			}
 			else
 			{
-				auto importer = engine->getImporterFactory().create( extension, *engine );
-				Mesh mesh{ cuT( "MorphImport" ), *parsingContext->pScene };
-
-				if ( !importer->importMesh( mesh, pathFile, parameters, false ) )
-				{
-					PARSING_ERROR( cuT( "Mesh Import failed" ) );
-				}
-				else if ( mesh.getSubmeshCount() == parsingContext->pMesh->getSubmeshCount() )
-				{
-					String animName{ "Morph" };
-
-					if ( !parsingContext->pMesh->hasAnimation( animName ) )
+				ImporterSPtr importer = engine->getImporterFactory().create( extension, *engine );
+				auto target = parsingContext->pMesh;
+				parsingContext->loader->pushJob( target.get()
+					, cuT( "Morph " ) + target->getName() + cuT( " [" ) + pathFile + cuT( "]" )
+					, [target, importer, pathFile, parameters, timeIndex]()
 					{
-						auto & animation = parsingContext->pMesh->createAnimation( animName );
+						Mesh mesh{ cuT( "MorphImport" ), *target->getScene() };
 
-						for ( auto submesh : *parsingContext->pMesh )
+						if ( !importer->importMesh( mesh, pathFile, parameters, false ) )
 						{
-							animation.addChild( MeshAnimationSubmesh{ animation, *submesh } );
+							return false;
 						}
-					}
-
-					MeshAnimation & animation{ static_cast< MeshAnimation & >( parsingContext->pMesh->getAnimation( animName ) ) };
-					uint32_t index = 0u;
-					MeshAnimationKeyFrameUPtr keyFrame = std::make_unique< MeshAnimationKeyFrame >( animation
-						, Milliseconds{ int64_t( timeIndex * 1000 ) } );
 
-					for ( auto & submesh : mesh )
-					{
-						auto & submeshAnim = animation.getSubmesh( index );
-						std::clog << "Source: " << submeshAnim.getSubmesh().getPointsCount() << " - Anim: " << submesh->getPointsCount() << std::endl;
+						if ( mesh.getSubmeshCount() != target->getSubmeshCount() )
+						{
+							Logger::logError( cuT( "Morph import [" ) + pathFile + cuT( "]: The new mesh doesn't match the original mesh" ) );
+							return false;
+						}
 
+						String animName{ "Morph" };
 
-						if ( submesh->getPointsCount() == submeshAnim.getSubmesh().getPointsCount() )
+						if ( !target->hasAnimation( animName ) )
 						{
-							keyFrame->addSubmeshBuffer( *submesh, convert( submesh->getPoints() ) );
+							auto & animation = target->createAnimation( animName );
+
+							for ( auto submesh : *target )
+							{
+								animation.addChild( MeshAnimationSubmesh{ animation, *submesh } );
+							}
 						}
 
-						++index;
-					}
+						MeshAnimation & animation{ static_cast< MeshAnimation & >( target->getAnimation( animName ) ) };
+						uint32_t index = 0u;
+						MeshAnimationKeyFrameUPtr keyFrame = std::make_unique< MeshAnimationKeyFrame >( animation
+							, Milliseconds{ int64_t( timeIndex * 1000 ) } );
 
-					animation.addKeyFrame( std::move( keyFrame ) );
-				}
-				else
-				{
-					PARSING_ERROR( cuT( "The new mesh doesn't match the original mesh" ) );
-				}
+						for ( auto & submesh : mesh )
+						{
+							auto & submeshAnim = animation.getSubmesh( index );
+
+							if ( submesh->getPointsCount() == submeshAnim.getSubmesh().getPointsCount() )
+							{
+								keyFrame->addSubmeshBuffer( *submesh, convert( submesh->getPoints() ) );
+							}
+
+							++index;
+						}
+
+						animation.addKeyFrame( std::move( keyFrame ) );
+						return true;
+					} );
 			}
 		}
 	}
@@ -2163,14 +2276,21 @@ namespace castor3d
 			}
 			else
 			{
-				auto divider = engine->getSubdividerFactory().create( name );
-				parsingContext->pMesh->computeContainers();
-				Point3r ptCenter = parsingContext->pMesh->getBoundingBox().getCenter();
+				SubdividerSPtr divider = engine->getSubdividerFactory().create( name );
+				auto mesh = parsingContext->pMesh;
+				parsingContext->loader->pushJob( mesh.get()
+					, cuT( "Subdivision " ) + mesh->getName() + cuT( " [" ) + name + cuT( "]" )
+					, [mesh, divider, count]()
+					{
+						mesh->computeContainers();
 
-				for ( auto submesh : *parsingContext->pMesh )
-				{
-					divider->subdivide( submesh, count, false );
-				}
+						for ( auto submesh : *mesh )
+						{
+							divider->subdivide( submesh, count, false );
+						}
+
+						return true;
+					} );
 			}
 		}
 	}
@@ -2184,7 +2304,15 @@ namespace castor3d
 		{
 			if ( parsingContext->pGeometry )
 			{
-				parsingContext->pGeometry->setMesh( parsingContext->pMesh );
+				// Delayed until the mesh is loaded, the geometry's following settings are delayed too.
+				auto geometry = parsingContext->pGeometry;
+				auto mesh = parsingContext->pMesh;
+				parsingContext->loader->pushContinuation( geometry.get()
+					, [geometry, mesh]()
+					{
+						geometry->setMesh( mesh );
+					}
+					, { mesh.get() } );
 			}
 
 			parsingContext->pMesh.reset();
@@ -3010,11 +3138,11 @@ namespace castor3d
 			Path relative;
 			p_params[0]->get( relative );
 
-			if ( File::fileExists( p_context->m_file.getPath() / relative ) )
+			if ( VirtualFileSystem::fileExists( p_context->m_file.getPath() / relative ) )
 			{
 				folder = p_context->m_file.getPath();
 			}
-			else if ( !File::fileExists( relative ) )
+			else if ( !VirtualFileSystem::fileExists( relative ) )
 			{
 				PARSING_ERROR( cuT( "File [" ) + relative + cuT( "] not found, check the relativeness of the path" ) );
 				relative.clear();
@@ -3024,56 +3152,28 @@ namespace castor3d
 			{
 				parsingContext->pTextureUnit->setAutoMipmaps( true );
 				auto texture = parsingContext->m_pParser->getEngine()->getRenderSystem()->createTexture( TextureType::eTwoDimensions, AccessType::eRead, AccessType::eRead );
-				texture->setSource( folder, relative );
+				String channels;
 
 				if ( p_params.size() >= 2 )
 				{
-					String channels;
 					p_params[1]->get( channels );
-					auto buffer = texture->getImage().getBuffer();
+				}
 
-					if ( channels == cuT( "rgb" ) )
-					{
-						buffer = PxBufferBase::create( buffer->dimensions()
-							, PF::getPFWithoutAlpha( buffer->format() )
-							, buffer->constPtr()
-							, buffer->format() );
-					}
-					else if ( channels == cuT( "r" ) )
-					{
-						auto format = ( buffer->format() == PixelFormat::eR8G8B8
-							|| buffer->format() == PixelFormat::eB8G8R8
-							|| buffer->format() == PixelFormat::eR8G8B8_SRGB
-							|| buffer->format() == PixelFormat::eB8G8R8_SRGB
-							|| buffer->format() == PixelFormat::eA8R8G8B8
-							|| buffer->format() == PixelFormat::eA8B8G8R8
-							|| buffer->format() == PixelFormat::eA8R8G8B8_SRGB
-							|| buffer->format() == PixelFormat::eA8B8G8R8_SRGB )
-							? PixelFormat::eL8
-							: ( buffer->format() == PixelFormat::eRGB16F
-								|| buffer->format() == PixelFormat::eRGBA16F
-								|| buffer->format() == PixelFormat::eRGB16F32F
-								|| buffer->format() == PixelFormat::eRGBA16F32F )
-								? PixelFormat::eL16F32F
-								: ( buffer->format() == PixelFormat::eRGB32F
-									|| buffer->format() == PixelFormat::eRGBA32F )
-									? PixelFormat::eL32F
-									: buffer->format();
-						buffer = PxBufferBase::create( buffer->dimensions()
-							, format
-							, buffer->constPtr()
-							, buffer->format() );
-					}
-					else if ( channels == cuT( "a" ) )
+				parsingContext->pTextureUnit->setTexture( texture );
+				// The image is decoded while the parsing goes on, the texture is only read at the scene initialisation.
+				parsingContext->loader->pushJob( texture.get()
+					, cuT( "Texture " ) + relative
+					, [texture, folder, relative, channels]()
 					{
-						auto tmp = PF::extractAlpha( buffer );
-						buffer = tmp;
-					}
+						texture->setSource( folder, relative );
 
-					texture->getImage().setBuffer( buffer );
-				}
+						if ( !channels.empty() )
+						{
+							doSelectChannels( *texture, relative, channels );
+						}
 
-				parsingContext->pTextureUnit->setTexture( texture );
+						return true;
+					} );
 			}
 		}
 	}
@@ -4292,6 +4392,14 @@ namespace castor3d
 
 			if ( geometry )
 			{
+				// The animations come with the loaded meshes.
+				parsingContext->loader->wait( geometry.get() );
+
+				if ( geometry->getMesh() )
+				{
+					parsingContext->loader->wait( geometry->getMesh().get() );
+				}
+
 				if ( !geometry->getAnimations().empty() )
 				{
 					parsingContext->pAnimMovable = parsingContext->pAnimGroup->addObject( *geometry
@@ -4457,7 +4565,7 @@ namespace castor3d
 			Path filePath = p_context->m_file.getPath();
 			p_params[0]->get( path );
 
-			if ( File::fileExists( filePath / path ) )
+			if ( VirtualFileSystem::fileExists( filePath / path ) )
 			{
 				Size size;
 				p_params[1]->get( size );
@@ -101,6 +101,10 @@ namespace castor3d
 		: OwnedBy< Scene >{ scene }
 		, Named{ name }
 		, m_displayable{ name == cuT( "RootNode" ) }
+		, m_pool{ scene.getSceneNodePool() }
+		, m_index{ m_pool->allocate( *this ) }
+		, m_handles{ scene.getEngine()->getHandles() }
+		, m_handle{ m_handles.add( *this ) }
 	{
 		if ( m_name.empty() )
 		{
@@ -122,21 +126,13 @@ namespace castor3d
 		}
 
 		detachChildren();
+		m_pool->release( m_index );
+		m_handles.remove( m_handle );
 	}
 
 	void SceneNode::update()
 	{
-		doComputeMatrix();
-
-		for ( auto it : m_children )
-		{
-			auto child = it.second.lock();
-
-			if ( child )
-			{
-				child->update();
-			}
-		}
+		m_pool->updateSubtree( m_index );
 	}
 
 	void SceneNode::attachObject( MovableObject & object )
@@ -175,9 +171,14 @@ namespace castor3d
 
 		if ( parent )
 		{
+			if ( parent->m_pool != m_pool )
+			{
+				doMoveTo( parent->m_pool );
+			}
+
 			m_displayable = parent->m_displayable;
 			parent->addChild( shared_from_this() );
-			m_mtxChanged = true;
+			m_pool->setParent( m_index, parent->m_index );
 		}
 	}
 
@@ -190,7 +191,7 @@ namespace castor3d
 			m_displayable = false;
 			m_parent.reset();
 			parent->detachChild( shared_from_this() );
-			m_mtxChanged = true;
+			m_pool->setParent( m_index, SceneNodePool::InvalidIndex );
 		}
 	}
 
@@ -268,7 +269,18 @@ namespace castor3d
 
 			if ( current )
 			{
-				current->detach();
+				if ( current->getParent() )
+				{
+					current->detach();
+				}
+				else
+				{
+					// This node is being destroyed, the child's parent pointer has already expired,
+					// the child is detached from the pool slot which is about to be released.
+					current->m_displayable = false;
+					current->m_parent.reset();
+					current->m_pool->setParent( current->m_index, SceneNodePool::InvalidIndex );
+				}
 			}
 		}
 	}
@@ -290,54 +302,48 @@ namespace castor3d
 
 	void SceneNode::rotate( Quaternion const & orientation )
 	{
-		m_orientation *= orientation;
-		doUpdateChildsDerivedTransform();
-		m_mtxChanged = true;
+		m_pool->getOrientation( m_index ) *= orientation;
+		m_pool->setLocalChanged( m_index );
 	}
 
 	void SceneNode::translate( Point3r const & position )
 	{
-		m_position += position;
-		doUpdateChildsDerivedTransform();
-		m_mtxChanged = true;
+		m_pool->getPosition( m_index ) += position;
+		m_pool->setLocalChanged( m_index );
 	}
 
 	void SceneNode::scale( Point3r const & scale )
 	{
-		m_scale *= scale;
-		doUpdateChildsDerivedTransform();
-		m_mtxChanged = true;
+		m_pool->getScale( m_index ) *= scale;
+		m_pool->setLocalChanged( m_index );
 	}
 
 	void SceneNode::setOrientation( Quaternion const & orientation )
 	{
-		m_orientation = orientation;
-		doUpdateChildsDerivedTransform();
-		m_mtxChanged = true;
+		m_pool->getOrientation( m_index ) = orientation;
+		m_pool->setLocalChanged( m_index );
 	}
 
 	void SceneNode::setPosition( Point3r const & position )
 	{
-		m_position = position;
-		doUpdateChildsDerivedTransform();
-		m_mtxChanged = true;
+		m_pool->getPosition( m_index ) = position;
+		m_pool->setLocalChanged( m_index );
 	}
 
 	void SceneNode::setScale( Point3r const & scale )
 	{
-		m_scale = scale;
-		doUpdateChildsDerivedTransform();
-		m_mtxChanged = true;
+		m_pool->getScale( m_index ) = scale;
+		m_pool->setLocalChanged( m_index );
 	}
 
 	Point3r SceneNode::getDerivedPosition()const
 	{
-		Point3r result( m_position );
+		Point3r result( getPosition() );
 		auto parent = getParent();
 
 		if ( parent )
 		{
-			result = matrix::getTransformed( parent->getDerivedTransformationMatrix(), m_position );
+			result = matrix::getTransformed( parent->getDerivedTransformationMatrix(), getPosition() );
 		}
 
 		return result;
@@ -345,7 +351,7 @@ namespace castor3d
 
 	Quaternion SceneNode::getDerivedOrientation()const
 	{
-		Quaternion result( m_orientation );
+		Quaternion result( getOrientation() );
 		auto parent = getParent();
 
 		if ( parent )
@@ -358,7 +364,7 @@ namespace castor3d
 
 	Point3r SceneNode::getDerivedScale()const
 	{
-		Point3r result( m_scale );
+		Point3r result( getScale() );
 		auto parent = getParent();
 
 		if ( parent )
@@ -371,12 +377,12 @@ namespace castor3d
 
 	Matrix4x4r const & SceneNode::getTransformationMatrix()const
 	{
-		return m_transform;
+		return m_transformationMatrix;
 	}
 
 	Matrix4x4r const & SceneNode::getDerivedTransformationMatrix()const
 	{
-		return m_derivedTransform;
+		return m_derivedTransformationMatrix;
 	}
 
 	void SceneNode::setVisible( bool visible )
@@ -394,44 +400,31 @@ namespace castor3d
 		return m_visible && ( parent ? parent->isVisible() : true );
 	}
 
-	void SceneNode::doComputeMatrix()
+	void SceneNode::doMoveTo( SceneNodePoolSPtr pool )
 	{
-		if ( m_mtxChanged )
-		{
-			m_derivedMtxChanged = true;
-			matrix::setTransform( m_transform, m_position, m_scale, m_orientation );
-			m_mtxChanged = false;
-		}
-
-		if ( m_derivedMtxChanged )
-		{
-			SceneNodeSPtr parent = getParent();
-
-			if ( parent )
-			{
-				m_derivedTransform = parent->getDerivedTransformationMatrix() * m_transform;
-			}
-			else
-			{
-				m_derivedTransform = m_transform;
-			}
+		auto index = pool->allocate( *this );
+		pool->getPosition( index ) = getPosition();
+		pool->getOrientation( index ) = getOrientation();
+		pool->getScale( index ) = getScale();
+		m_pool->release( m_index );
+		m_pool = pool;
+		m_index = index;
 
-			m_derivedMtxChanged = false;
-			onChanged( *this );
-		}
-	}
-
-	void SceneNode::doUpdateChildsDerivedTransform()
-	{
 		for ( auto it : m_children )
 		{
 			SceneNodeSPtr current = it.second.lock();
 
 			if ( current )
 			{
-				current->doUpdateChildsDerivedTransform();
-				current->m_derivedMtxChanged = true;
+				current->doMoveTo( pool );
+				pool->setParent( current->m_index, m_index );
 			}
 		}
 	}
+
+	void SceneNode::doSyncMatrices()
+	{
+		m_pool->getLocalMatrix( m_index ).toMatrix( m_transformationMatrix );
+		m_pool->getWorldMatrix( m_index ).toMatrix( m_derivedTransformationMatrix );
+	}
 }
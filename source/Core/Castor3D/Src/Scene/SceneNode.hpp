@@ -4,7 +4,7 @@ See LICENSE file in root folder
 #ifndef ___C3D_SCENE_NODE_H___
 #define ___C3D_SCENE_NODE_H___
 
-#include "Castor3DPrerequisites.hpp"
+#include "SceneNodePool.hpp"
 
 #include <Design/Named.hpp>
 #include <Design/OwnedBy.hpp>
@@ -28,6 +28,8 @@ namespace castor3d
 		, public castor::OwnedBy< Scene >
 		, public castor::Named
 	{
+		friend class SceneNodePool;
+
 	public:
 		//!\~english The total number of scene nodes	\~french Le nombre total de noeuds de scène
 		static uint64_t Count;
@@ -335,7 +337,7 @@ namespace castor3d
 		 */
 		inline castor::Point3r const & getPosition()const
 		{
-			return m_position;
+			return m_pool->getPosition( m_index );
 		}
 		/**
 		 *\~english
@@ -347,7 +349,7 @@ namespace castor3d
 		 */
 		inline castor::Quaternion const & getOrientation()const
 		{
-			return m_orientation;
+			return m_pool->getOrientation( m_index );
 		}
 		/**
 		 *\~english
@@ -359,7 +361,7 @@ namespace castor3d
 		 */
 		inline castor::Point3r const & getScale()const
 		{
-			return m_scale;
+			return m_pool->getScale( m_index );
 		}
 		/**
 		 *\~english
@@ -373,7 +375,7 @@ namespace castor3d
 		 */
 		inline void getAxisAngle( castor::Point3r & p_axis, castor::Angle & p_angle )const
 		{
-			m_orientation.toAxisAngle( p_axis, p_angle );
+			getOrientation().toAxisAngle( p_axis, p_angle );
 		}
 		/**
 		 *\~english
@@ -543,18 +545,36 @@ namespace castor3d
 		 */
 		inline bool isModified()const
 		{
-			return m_mtxChanged || m_derivedMtxChanged;
+			return m_pool->isChanged( m_index );
+		}
+		/**
+		 *\~english
+		 *\return		The handle to the node.
+		 *\~french
+		 *\return		La poignée vers le noeud.
+		 */
+		inline SceneNodeHandle const & getHandle()const
+		{
+			return m_handle;
 		}
 
 	private:
-		void doComputeMatrix();
 		/**
 		 *\~english
-		 *\brief		sets this node's children's absolute transformation matrix to be recalculated
+		 *\brief		Moves this node's transform data, and its children's, into another pool.
+		 *\param[in]	pool	The new pool.
+		 *\~french
+		 *\brief		Déplace les données de transformation de ce noeud, et celles de ses enfants, dans un autre pool.
+		 *\param[in]	pool	Le nouveau pool.
+		 */
+		void doMoveTo( SceneNodePoolSPtr pool );
+		/**
+		 *\~english
+		 *\brief		Copies the pool's matrices into this node's, called by the pool for the changed nodes.
 		 *\~french
-		 *\brief		Fait que la matrice de transfomation des enfants de ce noeud doit être recalculée
+		 *\brief		Copie les matrices du pool dans celles de ce noeud, appelée par le pool pour les noeuds modifiés.
 		 */
-		void doUpdateChildsDerivedTransform();
+		void doSyncMatrices();
 
 	public:
 		//!\~english	Signal used to notify attached objects that the node has changed.
@@ -568,27 +588,18 @@ namespace castor3d
 		//!\~english	The visible status. If a node is hidden, all objects attached to it are hidden.
 		//!\~french		Le statut de visibilité. Si un noeud est caché, tous les objets qui y sont attachés sont cachés aussi.
 		bool m_visible{ true };
-		//!\~english  T	he relative orientation of the node.
-		//!\~french		L'orientation du noeud, relative au parent.
-		castor::Quaternion m_orientation;
-		//!\~english	The relative position of the node.
-		//!\~french		La position du noeud, relative au parent.
-		castor::Point3r m_position{ 0.0_r, 0.0_r, 0.0_r };
-		//!\~english	The relative scale transform value of the node.
-		//!\~french		La mise à l'échelle du noeud, relative au parent.
-		castor::Point3r m_scale{ 1.0_r, 1.0_r, 1.0_r };
-		//!\~english	The reative transformation matrix.
-		//!\~french		La matrice de transformation, relative au parent.
-		castor::Matrix4x4r m_transform{ 1.0_r };
-		//!\~english	Tells the relative transformation matrix needs recomputation.
-		//!\~french		Dit si la matrice de transformation relative doit être recalculée.
-		bool m_mtxChanged{ true };
-		//!\~english	The absolute transformation matrix.
-		//!\~french		la matrice de transformation absolue.
-		castor::Matrix4x4r m_derivedTransform{ 1.0_r };
-		//!\~english	Tells the absolute transformation matrix needs recomputation.
-		//!\~french		Dit si la matrice de transformation absolue doit être recalculée.
-		bool m_derivedMtxChanged{ true };
+		//!\~english	The pool holding the transform data.
+		//!\~french		Le pool contenant les données de transformation.
+		SceneNodePoolSPtr m_pool;
+		//!\~english	The node's index in the pool.
+		//!\~french		L'indice du noeud dans le pool.
+		uint32_t m_index;
+		//!\~english	The handles registries, kept so the destructor doesn't go through the scene.
+		//!\~french		Les registres de poignées, gardés pour que le destructeur ne passe pas par la scène.
+		HandleRegistries & m_handles;
+		//!\~english	The handle to the node.
+		//!\~french		La poignée vers le noeud.
+		SceneNodeHandle m_handle;
 		//!\~english	This node's parent.
 		//!\~french		Le noeud parent.
 		SceneNodeWPtr m_parent;
@@ -598,6 +609,12 @@ namespace castor3d
 		//!\~english	This node's attached objects.
 		//!\~french		Les objets attachés à ce noeud.
 		MovableObjectArray m_objects;
+		//!\~english	The relative transformation matrix, copied from the pool.
+		//!\~french		La matrice de transformation relative, copiée depuis le pool.
+		castor::Matrix4x4r m_transformationMatrix{ 1.0_r };
+		//!\~english	The absolute transformation matrix, copied from the pool.
+		//!\~french		La matrice de transformation absolue, copiée depuis le pool.
+		castor::Matrix4x4r m_derivedTransformationMatrix{ 1.0_r };
 	};
 }
 
@@ -0,0 +1,385 @@
+#include "SceneNodePool.hpp"
+
+#include "ChangeJournal.hpp"
+#include "SceneNode.hpp"
+
+using namespace castor;
+
+namespace castor3d
+{
+	namespace
+	{
+		void doSetTransform( Float4x4 & matrix
+			, Point3r const & position
+			, Point3r const & scale
+			, Quaternion const & orientation )
+		{
+			// Same ordering as matrix::setTransform: scale, rotate, then translate.
+			orientation.toMatrix( matrix );
+			float * data = matrix.ptr();
+
+			for ( uint32_t i = 0u; i < 3u; ++i )
+			{
+				data[i * 4u + 0u] *= float( scale[i] );
+				data[i * 4u + 1u] *= float( scale[i] );
+				data[i * 4u + 2u] *= float( scale[i] );
+				data[12u + i] = float( position[i] );
+			}
+		}
+	}
+
+	//*********************************************************************************************
+
+	uint32_t constexpr SceneNodePool::ChunkSize;
+	uint32_t constexpr SceneNodePool::MaxChunks;
+	uint32_t constexpr SceneNodePool::InvalidIndex;
+	uint32_t constexpr SceneNodePool::ParallelThreshold;
+
+	SceneNodePool::SceneNodePool( ChangeJournalSPtr changes )
+		: m_changes{ changes }
+		, m_chunks( MaxChunks )
+	{
+	}
+
+	SceneNodePool::~SceneNodePool()
+	{
+		for ( auto & chunk : m_chunks )
+		{
+			delete chunk.load( std::memory_order_relaxed );
+		}
+	}
+
+	uint32_t SceneNodePool::allocate( SceneNode & node )
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		uint32_t result;
+
+		if ( m_free.empty() )
+		{
+			result = m_count++;
+
+			if ( result % ChunkSize == 0u )
+			{
+				if ( result / ChunkSize >= MaxChunks )
+				{
+					--m_count;
+					CASTOR_EXCEPTION( "SceneNodePool - Too many nodes" );
+				}
+
+				m_chunks[result / ChunkSize].store( new Chunk, std::memory_order_release );
+			}
+		}
+		else
+		{
+			result = m_free.back();
+			m_free.pop_back();
+		}
+
+		auto & chunk = doGetChunk( result );
+		auto i = result % ChunkSize;
+		chunk.positions[i] = Point3r{ 0.0_r, 0.0_r, 0.0_r };
+		chunk.orientations[i] = Quaternion{};
+		chunk.scales[i] = Point3r{ 1.0_r, 1.0_r, 1.0_r };
+		chunk.locals[i] = Float4x4{};
+		chunk.worlds[i] = Float4x4{};
+		chunk.flags[i] = eLocalChanged;
+		chunk.parents[i] = InvalidIndex;
+		chunk.nodes[i] = &node;
+		m_hierarchyChanged = true;
+		return result;
+	}
+
+	void SceneNodePool::release( uint32_t index )
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		auto & chunk = doGetChunk( index );
+		auto i = index % ChunkSize;
+		m_changes->forget( chunk.nodes[i] );
+		chunk.flags[i] = 0u;
+		chunk.parents[i] = InvalidIndex;
+		chunk.nodes[i] = nullptr;
+		m_free.push_back( index );
+		m_hierarchyChanged = true;
+	}
+
+	void SceneNodePool::setParent( uint32_t index, uint32_t parent )
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		auto & chunk = doGetChunk( index );
+		auto i = index % ChunkSize;
+		chunk.parents[i] = parent;
+		chunk.flags[i] |= eWorldChanged;
+		m_hierarchyChanged = true;
+	}
+
+	void SceneNodePool::update( ThreadPool * threadPool )
+	{
+		std::vector< SceneNode * > changed;
+
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+
+			if ( m_hierarchyChanged )
+			{
+				doSortNodes();
+			}
+
+			++m_pass;
+			auto count = uint32_t( m_order.size() );
+
+			if ( threadPool
+				&& threadPool->getCount() > 1u
+				&& count >= ParallelThreshold )
+			{
+				std::deque< std::vector< SceneNode * > > jobsChanged;
+				auto jobSize = std::max( ChunkSize
+					, uint32_t( count / ( threadPool->getCount() * 4u ) ) );
+				doUpdateSubtrees( *threadPool, 0u, count, jobSize, changed, jobsChanged );
+				threadPool->waitAll( Milliseconds::max() );
+
+				for ( auto & jobChanged : jobsChanged )
+				{
+					changed.insert( changed.end(), jobChanged.begin(), jobChanged.end() );
+				}
+			}
+			else
+			{
+				doUpdateRange( 0u, count, changed );
+			}
+
+			doSyncNodes( changed );
+		}
+
+		m_changes->record( changed );
+	}
+
+	void SceneNodePool::updateSubtree( uint32_t index )
+	{
+		std::vector< SceneNode * > changed;
+
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+
+			if ( m_hierarchyChanged )
+			{
+				doSortNodes();
+			}
+
+			++m_pass;
+			auto pos = m_orderPositions[index];
+
+			if ( pos != InvalidIndex )
+			{
+				doUpdateRange( pos, m_subtreeEnds[pos], changed );
+			}
+
+			doSyncNodes( changed );
+		}
+
+		// The explicit updates are notified right away, since their callers use the node's state immediately.
+		for ( auto node : changed )
+		{
+			node->onChanged( *node );
+		}
+
+		m_changes->record( changed, true );
+	}
+
+	void SceneNodePool::doSyncNodes( std::vector< SceneNode * > const & changed )
+	{
+		for ( auto node : changed )
+		{
+			node->doSyncMatrices();
+		}
+	}
+
+	void SceneNodePool::doSortNodes()
+	{
+		// Children lists, built with a counting sort on the parent index, to keep the allocation order among siblings.
+		std::vector< uint32_t > childrenBegins( m_count + 1u, 0u );
+		std::vector< uint32_t > roots;
+
+		for ( uint32_t index = 0u; index < m_count; ++index )
+		{
+			auto & chunk = doGetChunk( index );
+			auto i = index % ChunkSize;
+
+			if ( chunk.nodes[i] )
+			{
+				auto parent = chunk.parents[i];
+
+				if ( parent == InvalidIndex )
+				{
+					roots.push_back( index );
+				}
+				else
+				{
+					++childrenBegins[parent + 1u];
+				}
+			}
+		}
+
+		for ( uint32_t index = 0u; index < m_count; ++index )
+		{
+			childrenBegins[index + 1u] += childrenBegins[index];
+		}
+
+		std::vector< uint32_t > children( childrenBegins.back() );
+		std::vector< uint32_t > inserted( childrenBegins.begin(), childrenBegins.end() - 1u );
+
+		for ( uint32_t index = 0u; index < m_count; ++index )
+		{
+			auto & chunk = doGetChunk( index );
+			auto i = index % ChunkSize;
+
+			if ( chunk.nodes[i] && chunk.parents[i] != InvalidIndex )
+			{
+				children[inserted[chunk.parents[i]]++] = index;
+			}
+		}
+
+		// Depth first traversal, the explicit stack avoids recursing on deep hierarchies.
+		m_order.clear();
+		m_orderParents.clear();
+		m_subtreeEnds.clear();
+		m_orderPositions.assign( m_count, InvalidIndex );
+		std::vector< uint32_t > stack;
+
+		for ( auto root : roots )
+		{
+			stack.push_back( root );
+
+			while ( !stack.empty() )
+			{
+				auto index = stack.back();
+				stack.pop_back();
+				auto parent = getParent( index );
+				m_orderPositions[index] = uint32_t( m_order.size() );
+				m_order.push_back( index );
+				m_orderParents.push_back( parent == InvalidIndex
+					? InvalidIndex
+					: m_orderPositions[parent] );
+
+				for ( auto it = childrenBegins[index + 1u]; it > childrenBegins[index]; --it )
+				{
+					stack.push_back( children[it - 1u] );
+				}
+			}
+		}
+
+		// The subtree ends, computed backwards: each node extends its parent's subtree.
+		auto count = uint32_t( m_order.size() );
+		m_subtreeEnds.resize( count );
+
+		for ( uint32_t pos = 0u; pos < count; ++pos )
+		{
+			m_subtreeEnds[pos] = pos + 1u;
+		}
+
+		for ( uint32_t pos = count; pos > 0u; --pos )
+		{
+			auto parentPos = m_orderParents[pos - 1u];
+
+			if ( parentPos != InvalidIndex )
+			{
+				m_subtreeEnds[parentPos] = std::max( m_subtreeEnds[parentPos], m_subtreeEnds[pos - 1u] );
+			}
+		}
+
+		m_changedPasses.assign( count, 0u );
+		m_pass = 0u;
+		m_hierarchyChanged = false;
+	}
+
+	void SceneNodePool::doUpdateRange( uint32_t begin
+		, uint32_t end
+		, std::vector< SceneNode * > & changed )
+	{
+		for ( auto pos = begin; pos < end; ++pos )
+		{
+			auto index = m_order[pos];
+			auto & chunk = doGetChunk( index );
+			auto i = index % ChunkSize;
+			auto parentPos = m_orderParents[pos];
+			bool parentChanged = parentPos != InvalidIndex
+				&& m_changedPasses[parentPos] == m_pass;
+
+			if ( chunk.flags[i] & eLocalChanged )
+			{
+				doSetTransform( chunk.locals[i]
+					, chunk.positions[i]
+					, chunk.scales[i]
+					, chunk.orientations[i] );
+			}
+
+			if ( chunk.flags[i] || parentChanged )
+			{
+				if ( parentPos != InvalidIndex )
+				{
+					Float4x4::multiply( getWorldMatrix( m_order[parentPos] ).constPtr()
+						, chunk.locals[i].constPtr()
+						, chunk.worlds[i].ptr() );
+				}
+				else
+				{
+					chunk.worlds[i] = chunk.locals[i];
+				}
+
+				chunk.flags[i] = 0u;
+				m_changedPasses[pos] = m_pass;
+				changed.push_back( chunk.nodes[i] );
+			}
+		}
+	}
+
+	void SceneNodePool::doUpdateSubtrees( ThreadPool & threadPool
+		, uint32_t begin
+		, uint32_t end
+		, uint32_t jobSize
+		, std::vector< SceneNode * > & changed
+		, std::deque< std::vector< SceneNode * > > & jobsChanged )
+	{
+		// The range holds sibling subtrees, the small ones are grouped into jobs,
+		// the big ones are split again once their root has been updated.
+		auto pushJob = [this, &threadPool, &jobsChanged]( uint32_t jobBegin, uint32_t jobEnd )
+		{
+			jobsChanged.emplace_back();
+			auto & jobChanged = jobsChanged.back();
+			threadPool.pushJob( [this, jobBegin, jobEnd, &jobChanged]()
+			{
+				doUpdateRange( jobBegin, jobEnd, jobChanged );
+			} );
+		};
+		auto groupBegin = begin;
+		auto pos = begin;
+
+		while ( pos < end )
+		{
+			auto subtreeEnd = m_subtreeEnds[pos];
+
+			if ( subtreeEnd - pos > jobSize )
+			{
+				if ( groupBegin < pos )
+				{
+					pushJob( groupBegin, pos );
+				}
+
+				doUpdateRange( pos, pos + 1u, changed );
+				doUpdateSubtrees( threadPool, pos + 1u, subtreeEnd, jobSize, changed, jobsChanged );
+				groupBegin = subtreeEnd;
+			}
+			else if ( subtreeEnd - groupBegin >= jobSize )
+			{
+				pushJob( groupBegin, subtreeEnd );
+				groupBegin = subtreeEnd;
+			}
+
+			pos = subtreeEnd;
+		}
+
+		if ( groupBegin < end )
+		{
+			pushJob( groupBegin, end );
+		}
+	}
+}
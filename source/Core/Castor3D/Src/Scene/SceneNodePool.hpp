@@ -0,0 +1,267 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_SCENE_NODE_POOL_H___
+#define ___C3D_SCENE_NODE_POOL_H___
+
+#include "Castor3DPrerequisites.hpp"
+
+#include <Math/Float4x4.hpp>
+#include <Math/Quaternion.hpp>
+#include <Math/SquareMatrix.hpp>
+#include <Multithreading/ThreadPool.hpp>
+
+#include <atomic>
+#include <mutex>
+
+namespace castor3d
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/01/2018
+	\~english
+	\brief		Holds the transform data of the scene nodes, SceneNode being a handle to one of its slots.
+	\remarks	The data is stored per component (positions, orientations, matrices, ...), in fixed size chunks, so the addresses are stable.
+				<br />The chunks table has a fixed capacity, so the getters can read it while another thread allocates a node.
+				<br />The matrices are stored inline, SceneNode only converts the changed ones to its own matrices.
+				<br />The nodes are also sorted in depth first order, where each subtree is contiguous.
+				<br />The world matrices are thus updated in one linear pass, which can be split by subtree between threads.
+				<br />The changed nodes are recorded in the scene's change journal once the pass is done.
+	\~french
+	\brief		Contient les données de transformation des noeuds de scène, SceneNode étant une poignée vers un de ses emplacements.
+	\remarks	Les données sont stockées par composante (positions, orientations, matrices, ...), dans des blocs de taille fixe, afin que les adresses soient stables.
+				<br />La table des blocs a une capacité fixe, afin que les accesseurs puissent la lire pendant qu'un autre thread alloue un noeud.
+				<br />Les matrices sont stockées en ligne, SceneNode ne convertit que celles qui ont changé vers ses propres matrices.
+				<br />Les noeuds sont aussi triés en profondeur d'abord, chaque sous-arbre étant contigu.
+				<br />Les matrices monde sont donc mises à jour en une passe linéaire, qui peut être répartie par sous-arbre entre des threads.
+				<br />Les noeuds modifiés sont enregistrés dans le journal des changements de la scène une fois la passe terminée.
+	*/
+	class SceneNodePool
+	{
+	public:
+		//!\~english	The number of nodes per chunk.
+		//!\~french		Le nombre de noeuds par bloc.
+		static uint32_t constexpr ChunkSize = 256u;
+		//!\~english	The maximum number of chunks.
+		//!\~french		Le nombre maximal de blocs.
+		static uint32_t constexpr MaxChunks = 4096u;
+		//!\~english	The index of an invalid node.
+		//!\~french		L'indice d'un noeud invalide.
+		static uint32_t constexpr InvalidIndex = ~0u;
+		//!\~english	The minimal nodes count for the update to be split between threads.
+		//!\~french		Le nombre minimal de noeuds pour que la mise à jour soit répartie entre des threads.
+		static uint32_t constexpr ParallelThreshold = 16384u;
+
+	private:
+		enum Flag : uint8_t
+		{
+			eLocalChanged = 0x01,
+			eWorldChanged = 0x02,
+		};
+
+		struct Chunk
+		{
+			std::array< castor::Point3r, ChunkSize > positions;
+			std::array< castor::Quaternion, ChunkSize > orientations;
+			std::array< castor::Point3r, ChunkSize > scales;
+			std::array< castor::Float4x4, ChunkSize > locals;
+			std::array< castor::Float4x4, ChunkSize > worlds;
+			std::array< uint8_t, ChunkSize > flags;
+			std::array< uint32_t, ChunkSize > parents;
+			std::array< SceneNode *, ChunkSize > nodes;
+		};
+
+	public:
+		SceneNodePool( SceneNodePool const & ) = delete;
+		SceneNodePool & operator=( SceneNodePool const & ) = delete;
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	changes	The journal receiving the changed nodes.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	changes	Le journal recevant les noeuds modifiés.
+		 */
+		C3D_API explicit SceneNodePool( ChangeJournalSPtr changes );
+		/**
+		 *\~english
+		 *\brief		Destructor.
+		 *\~french
+		 *\brief		Destructeur.
+		 */
+		C3D_API ~SceneNodePool();
+		/**
+		 *\~english
+		 *\brief		Reserves a slot for the given node, with an identity transform.
+		 *\param[in]	node	The node.
+		 *\return		The slot index.
+		 *\~french
+		 *\brief		Réserve un emplacement pour le noeud donné, avec une transformation identité.
+		 *\param[in]	node	Le noeud.
+		 *\return		L'indice de l'emplacement.
+		 */
+		C3D_API uint32_t allocate( SceneNode & node );
+		/**
+		 *\~english
+		 *\brief		Releases a slot, and discards the pending changes of its node.
+		 *\param[in]	index	The slot index.
+		 *\~french
+		 *\brief		Libère un emplacement, et ignore les changements en attente de son noeud.
+		 *\param[in]	index	L'indice de l'emplacement.
+		 */
+		C3D_API void release( uint32_t index );
+		/**
+		 *\~english
+		 *\brief		Sets the parent of a node.
+		 *\param[in]	index	The node index.
+		 *\param[in]	parent	The parent index, InvalidIndex to detach the node.
+		 *\~french
+		 *\brief		Définit le parent d'un noeud.
+		 *\param[in]	index	L'indice du noeud.
+		 *\param[in]	parent	L'indice du parent, InvalidIndex pour détacher le noeud.
+		 */
+		C3D_API void setParent( uint32_t index, uint32_t parent );
+		/**
+		 *\~english
+		 *\brief		Updates the world matrices of every node, and records the changed ones in the journal.
+		 *\param[in]	threadPool	If not null, and if there are enough nodes, the subtrees are updated in parallel by this pool.
+		 *\~french
+		 *\brief		Met à jour les matrices monde de tous les noeuds, et enregistre ceux qui ont changé dans le journal.
+		 *\param[in]	threadPool	Si non nul, et s'il y a assez de noeuds, les sous-arbres sont mis à jour en parallèle par ce pool.
+		 */
+		C3D_API void update( castor::ThreadPool * threadPool = nullptr );
+		/**
+		 *\~english
+		 *\brief		Updates the world matrices of the given node and its descendants, and records the changed ones in the journal.
+		 *\remarks		The parent's world matrix is used as is, and the changed nodes raise their signal immediately.
+		 *\param[in]	index	The node index.
+		 *\~french
+		 *\brief		Met à jour les matrices monde du noeud donné et de ses descendants, et enregistre ceux qui ont changé dans le journal.
+		 *\remarks		La matrice monde du parent est utilisée telle quelle, et les noeuds modifiés lèvent leur signal immédiatement.
+		 *\param[in]	index	L'indice du noeud.
+		 */
+		C3D_API void updateSubtree( uint32_t index );
+		/**
+		 *\~english
+		 *\brief		Flags the local transform of a node as changed.
+		 *\param[in]	index	The node index.
+		 *\~french
+		 *\brief		Marque la transformation locale d'un noeud comme modifiée.
+		 *\param[in]	index	L'indice du noeud.
+		 */
+		inline void setLocalChanged( uint32_t index )
+		{
+			doGetChunk( index ).flags[index % ChunkSize] |= eLocalChanged;
+		}
+		/**
+		 *\~english
+		 *\param[in]	index	The node index.
+		 *\return		\p true if the node's matrices need to be updated.
+		 *\~french
+		 *\param[in]	index	L'indice du noeud.
+		 *\return		\p true si les matrices du noeud doivent être mises à jour.
+		 */
+		inline bool isChanged( uint32_t index )const
+		{
+			return doGetChunk( index ).flags[index % ChunkSize] != 0u;
+		}
+		/**
+		 *\~english
+		 *\name Getters.
+		 *\~french
+		 *\name Accesseurs.
+		 */
+		/**@{*/
+		inline castor::Point3r & getPosition( uint32_t index )
+		{
+			return doGetChunk( index ).positions[index % ChunkSize];
+		}
+
+		inline castor::Quaternion & getOrientation( uint32_t index )
+		{
+			return doGetChunk( index ).orientations[index % ChunkSize];
+		}
+
+		inline castor::Point3r & getScale( uint32_t index )
+		{
+			return doGetChunk( index ).scales[index % ChunkSize];
+		}
+
+		inline castor::Float4x4 const & getLocalMatrix( uint32_t index )const
+		{
+			return doGetChunk( index ).locals[index % ChunkSize];
+		}
+
+		inline castor::Float4x4 const & getWorldMatrix( uint32_t index )const
+		{
+			return doGetChunk( index ).worlds[index % ChunkSize];
+		}
+
+		inline uint32_t getParent( uint32_t index )const
+		{
+			return doGetChunk( index ).parents[index % ChunkSize];
+		}
+
+		inline uint32_t getCount()const
+		{
+			return m_count - uint32_t( m_free.size() );
+		}
+		/**@}*/
+
+	private:
+		inline Chunk & doGetChunk( uint32_t index )
+		{
+			return *m_chunks[index / ChunkSize].load( std::memory_order_acquire );
+		}
+
+		inline Chunk const & doGetChunk( uint32_t index )const
+		{
+			return *m_chunks[index / ChunkSize].load( std::memory_order_acquire );
+		}
+
+		void doSyncNodes( std::vector< SceneNode * > const & changed );
+		void doSortNodes();
+		void doUpdateRange( uint32_t begin
+			, uint32_t end
+			, std::vector< SceneNode * > & changed );
+		void doUpdateSubtrees( castor::ThreadPool & threadPool
+			, uint32_t begin
+			, uint32_t end
+			, uint32_t jobSize
+			, std::vector< SceneNode * > & changed
+			, std::deque< std::vector< SceneNode * > > & jobsChanged );
+
+	private:
+		ChangeJournalSPtr m_changes;
+		std::mutex m_mutex;
+		//!\~english	The chunks table, never resized, the chunks are published once allocated.
+		//!\~french		La table des blocs, jamais redimensionnée, les blocs sont publiés une fois alloués.
+		std::vector< std::atomic< Chunk * > > m_chunks;
+		std::vector< uint32_t > m_free;
+		uint32_t m_count{ 0u };
+		//!\~english	Tells if the depth first order must be rebuilt.
+		//!\~french		Dit si l'ordre en profondeur d'abord doit être reconstruit.
+		bool m_hierarchyChanged{ true };
+		//!\~english	The nodes indices, in depth first order.
+		//!\~french		Les indices des noeuds, en profondeur d'abord.
+		std::vector< uint32_t > m_order;
+		//!\~english	The position of each node in m_order, indexed by node index.
+		//!\~french		La position de chaque noeud dans m_order, indexée par indice de noeud.
+		std::vector< uint32_t > m_orderPositions;
+		//!\~english	The position of each node's parent in m_order, InvalidIndex for the roots.
+		//!\~french		La position du parent de chaque noeud dans m_order, InvalidIndex pour les racines.
+		std::vector< uint32_t > m_orderParents;
+		//!\~english	The end of each node's subtree in m_order.
+		//!\~french		La fin du sous-arbre de chaque noeud dans m_order.
+		std::vector< uint32_t > m_subtreeEnds;
+		//!\~english	The last update pass each node's world matrix changed in, indexed by position in m_order.
+		//!\~french		La dernière passe de mise à jour dans laquelle la matrice monde de chaque noeud a changé, indexée par position dans m_order.
+		std::vector< uint32_t > m_changedPasses;
+		//!\~english	The current update pass.
+		//!\~french		La passe de mise à jour courante.
+		uint32_t m_pass{ 0u };
+	};
+}
+
+#endif
@@ -2,6 +2,7 @@
 #include "ShaderProgram.hpp"
 #include "UniformBuffer.hpp"
 
+#include <Data/VirtualFileSystem.hpp>
 #include <Stream/StreamPrefixManipulators.hpp>
 #include <GlslShader.hpp>
 
@@ -11,6 +12,12 @@ namespace castor3d
 {
 	namespace
 	{
+		MemoryTag & doGetMemoryTag()
+		{
+			static MemoryTag & tag = MemoryAccounting::getTag( cuT( "Shaders" ) );
+			return tag;
+		}
+
 		template< typename CharType, typename PrefixType >
 		inline std::basic_ostream< CharType > & operator<<( std::basic_ostream< CharType > & stream, format::BasePrefixer< CharType, PrefixType > const & Prefix )
 		{
@@ -231,6 +238,7 @@ namespace castor3d
 	ShaderObject::ShaderObject( ShaderProgram & p_parent, ShaderType p_type )
 		: m_type( p_type )
 		, m_parent( p_parent )
+		, m_memory( doGetMemoryTag() )
 	{
 	}
 
@@ -261,7 +269,7 @@ namespace castor3d
 		m_file.clear();
 		m_source = glsl::Shader{};
 
-		if ( !p_filename.empty() && File::fileExists( p_filename ) )
+		if ( !p_filename.empty() && VirtualFileSystem::fileExists( p_filename ) )
 		{
 			TextFile file( p_filename, File::OpenMode::eRead );
 
@@ -276,6 +284,8 @@ namespace castor3d
 				}
 			}
 		}
+
+		m_memory.setCpuSize( m_source.getSource().capacity() * sizeof( xchar ) );
 	}
 
 	bool ShaderObject::hasFile()const
@@ -287,11 +297,13 @@ namespace castor3d
 	{
 		m_status = ShaderStatus::eNotCompiled;
 		m_source.setSource( p_source );
+		m_memory.setCpuSize( m_source.getSource().capacity() * sizeof( xchar ) );
 	}
 
 	void ShaderObject::setSource( glsl::Shader const & p_source )
 	{
 		m_source = p_source;
+		m_memory.setCpuSize( m_source.getSource().capacity() * sizeof( xchar ) );
 		doFillVariables();
 	}
 
@@ -7,6 +7,7 @@ See LICENSE file in root folder
 #include "Castor3DPrerequisites.hpp"
 
 #include <GlslShader.hpp>
+#include <Miscellaneous/MemoryAccounting.hpp>
 
 namespace castor3d
 {
@@ -481,6 +482,11 @@ namespace castor3d
 		//!\~english	The frame variables map.
 		//!\~french		La liste des variables de frame.
 		PushUniformList m_listUniforms;
+
+	private:
+		//!\~english	Accounts for the shader source.
+		//!\~french		Comptabilise le source du shader.
+		castor::MemoryUsage m_memory;
 	};
 }
 
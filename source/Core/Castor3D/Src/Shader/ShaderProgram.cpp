@@ -118,6 +118,8 @@ namespace castor3d
 	const String ShaderProgram::Material = cuT( "material" );
 
 	const String ShaderProgram::Lights = cuT( "c3d_sLights" );
+	const String ShaderProgram::LightClusters = cuT( "c3d_sLightClusters" );
+	const String ShaderProgram::LightIndices = cuT( "c3d_sLightIndices" );
 	const String ShaderProgram::MapDiffuse = cuT ("c3d_mapDiffuse");
 	const String ShaderProgram::MapAlbedo = cuT( "c3d_mapAlbedo" );
 	const String ShaderProgram::MapSpecular = cuT ("c3d_mapSpecular");
@@ -601,6 +601,12 @@ namespace castor3d
 		//!\~english	Name of the lights frame variable.
 		//!\~french		Nom de la frame variable contenant les lumières.
 		C3D_API static const castor::String Lights;
+		//!\~english	Name of the light clusters frame variable.
+		//!\~french		Nom de la frame variable contenant les clusters de lumières.
+		C3D_API static const castor::String LightClusters;
+		//!\~english	Name of the clusters light indices frame variable.
+		//!\~french		Nom de la frame variable contenant les indices de lumières des clusters.
+		C3D_API static const castor::String LightIndices;
 
 		//@}
 		/**@name Textures */
@@ -86,11 +86,26 @@ namespace castor3d
 			return Vec3( m_writer, String( *this ) + cuT( ".m_direction" ) );
 		}
 
+		Int DirectionalLight::m_cascadesCount()const
+		{
+			return Int( m_writer, String( *this ) + cuT( ".m_cascadesCount" ) );
+		}
+
 		Mat4 DirectionalLight::m_transform()const
 		{
 			return Mat4( m_writer, String( *this ) + cuT( ".m_transform" ) );
 		}
 
+		Array< Vec4 > DirectionalLight::m_cascades()const
+		{
+			return Array< Vec4 >( m_writer, String( *this ) + cuT( ".m_cascades" ), DirectionalCascadesCount );
+		}
+
+		Array< Vec4 > DirectionalLight::m_cascadesDepths()const
+		{
+			return Array< Vec4 >( m_writer, String( *this ) + cuT( ".m_cascadesDepths" ), DirectionalCascadesCount / 2u );
+		}
+
 		//*********************************************************************************************
 
 		PointLight::PointLight()
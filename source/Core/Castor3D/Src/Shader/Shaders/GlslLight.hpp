@@ -6,6 +6,7 @@ See LICENSE file in root folder
 
 #include "Castor3DPrerequisites.hpp"
 
+#include <GlslArray.hpp>
 #include <GlslMat.hpp>
 
 namespace castor3d
@@ -41,7 +42,10 @@ namespace castor3d
 			C3D_API DirectionalLight & operator=( DirectionalLight const & rhs );
 			C3D_API Light m_lightBase()const;
 			C3D_API glsl::Vec3 m_direction()const;
+			C3D_API glsl::Int m_cascadesCount()const;
 			C3D_API glsl::Mat4 m_transform()const;
+			C3D_API glsl::Array< glsl::Vec4 > m_cascades()const;
+			C3D_API glsl::Array< glsl::Vec4 > m_cascadesDepths()const;
 
 			template< typename T >
 			inline DirectionalLight & operator=( T const & rhs )
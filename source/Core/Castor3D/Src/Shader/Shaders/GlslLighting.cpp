@@ -4,6 +4,8 @@
 #include "GlslShadow.hpp"
 #include "GlslLight.hpp"
 
+#include "Shader/ShaderProgram.hpp"
+
 using namespace castor;
 using namespace glsl;
 
@@ -144,6 +146,78 @@ namespace castor3d
 			doDeclareComputeOneSpotLight();
 		}
 
+		void LightingModel::declareClusters()
+		{
+			m_clustered = true;
+
+			if ( m_writer.hasTextureBuffers() )
+			{
+				auto c3d_sLightClusters = m_writer.declSampler< SamplerBuffer >( ShaderProgram::LightClusters, LightClustersIndex );
+				auto c3d_sLightIndices = m_writer.declSampler< SamplerBuffer >( ShaderProgram::LightIndices, LightIndicesIndex );
+			}
+			else
+			{
+				auto c3d_sLightClusters = m_writer.declSampler< Sampler1D >( ShaderProgram::LightClusters, LightClustersIndex );
+				auto c3d_sLightIndices = m_writer.declSampler< Sampler1D >( ShaderProgram::LightIndices, LightIndicesIndex );
+			}
+
+			auto fetch = [this]( String const & name, Int const & offset )
+			{
+				if ( m_writer.hasTextureBuffers() )
+				{
+					return texelFetch( m_writer.getBuiltin< SamplerBuffer >( name ), offset );
+				}
+
+				return texelFetch( m_writer.getBuiltin< Sampler1D >( name ), offset, 0_i );
+			};
+
+			// The clusters buffer starts with the grid parameters:
+			// [0] = ( dimensions.x, dimensions.y, dimensions.z, slice factor )
+			// [1] = ( near, far, render width, render height )
+			// Then comes, for each cluster, ( offset, point lights count, spot lights count, 0 ).
+			m_getCluster = m_writer.implementFunction< IVec3 >( cuT( "getCluster" )
+				, [this, fetch]( Vec3 const & position
+					, Vec2 const & fragCoord )
+				{
+					auto c3d_curView = m_writer.getBuiltin< Mat4 >( cuT( "c3d_curView" ) );
+					auto grid = m_writer.declLocale( cuT( "grid" )
+						, fetch( ShaderProgram::LightClusters, 0_i ) );
+					auto frustum = m_writer.declLocale( cuT( "frustum" )
+						, fetch( ShaderProgram::LightClusters, 1_i ) );
+					auto dimensions = m_writer.declLocale( cuT( "dimensions" )
+						, ivec3( m_writer.cast< Int >( grid.x() )
+							, m_writer.cast< Int >( grid.y() )
+							, m_writer.cast< Int >( grid.z() ) ) );
+					auto viewPosition = m_writer.declLocale( cuT( "viewPosition" )
+						, c3d_curView * vec4( position, 1.0_f ) );
+					auto depth = m_writer.declLocale( cuT( "depth" )
+						, max( frustum.x(), 0.0_f - viewPosition.z() ) );
+					auto cluster = m_writer.declLocale( cuT( "cluster" )
+						, ivec3( m_writer.cast< Int >( fragCoord.x() * grid.x() / frustum.z() )
+							, m_writer.cast< Int >( fragCoord.y() * grid.y() / frustum.w() )
+							, m_writer.cast< Int >( floor( log( depth / frustum.x() ) * grid.w() ) ) ) );
+					cluster = clamp( cluster
+						, ivec3( 0_i )
+						, dimensions - ivec3( 1_i ) );
+					auto index = m_writer.declLocale( cuT( "index" )
+						, cluster.x() + dimensions.x() * m_writer.paren( cluster.y() + dimensions.y() * cluster.z() ) );
+					auto ranges = m_writer.declLocale( cuT( "ranges" )
+						, fetch( ShaderProgram::LightClusters, 2_i + index ) );
+					m_writer.returnStmt( ivec3( m_writer.cast< Int >( ranges.x() )
+						, m_writer.cast< Int >( ranges.y() )
+						, m_writer.cast< Int >( ranges.z() ) ) );
+				}
+				, InVec3{ &m_writer, cuT( "position" ) }
+				, InVec2{ &m_writer, cuT( "fragCoord" ) } );
+
+			m_getClusterLight = m_writer.implementFunction< Int >( cuT( "getClusterLight" )
+				, [this, fetch]( Int const & index )
+				{
+					m_writer.returnStmt( m_writer.cast< Int >( fetch( ShaderProgram::LightIndices, index ).x() ) );
+				}
+				, InInt{ &m_writer, cuT( "index" ) } );
+		}
+
 		DirectionalLight LightingModel::getDirectionalLight( Int const & index )const
 		{
 			return m_getDirectionalLight( index );
@@ -173,7 +247,10 @@ namespace castor3d
 			Struct lightDecl = m_writer.getStruct( cuT( "DirectionalLight" ) );
 			lightDecl.declMember< Light >( cuT( "m_lightBase" ) );
 			lightDecl.declMember< Vec3 >( cuT( "m_direction" ) );
+			lightDecl.declMember< Int >( cuT( "m_cascadesCount" ) );
 			lightDecl.declMember< Mat4 >( cuT( "m_transform" ) );
+			lightDecl.declMember< Vec4 >( cuT( "m_cascades" ), DirectionalCascadesCount );
+			lightDecl.declMember< Vec4 >( cuT( "m_cascadesDepths" ), DirectionalCascadesCount / 2u );
 			lightDecl.end();
 		}
 
@@ -252,23 +329,47 @@ namespace castor3d
 						{
 							auto c3d_sLights = m_writer.getBuiltin< SamplerBuffer >( cuT( "c3d_sLights" ) );
 							auto offset = m_writer.declLocale( cuT( "offset" ), index * Int( MaxLightComponentsCount ) + Int( BaseLightComponentsCount ) );
-							result.m_direction() = texelFetch( c3d_sLights, offset++ ).rgb();
+							auto v4DirCount = m_writer.declLocale( cuT( "v4DirCount" ), texelFetch( c3d_sLights, offset++ ) );
+							result.m_direction() = v4DirCount.rgb();
+							result.m_cascadesCount() = m_writer.cast< Int >( v4DirCount.a() );
 							auto v4MtxCol1 = m_writer.declLocale( cuT( "v4MtxCol1" ), texelFetch( c3d_sLights, offset++ ) );
 							auto v4MtxCol2 = m_writer.declLocale( cuT( "v4MtxCol2" ), texelFetch( c3d_sLights, offset++ ) );
 							auto v4MtxCol3 = m_writer.declLocale( cuT( "v4MtxCol3" ), texelFetch( c3d_sLights, offset++ ) );
 							auto v4MtxCol4 = m_writer.declLocale( cuT( "v4MtxCol4" ), texelFetch( c3d_sLights, offset++ ) );
 							result.m_transform() = mat4( v4MtxCol1, v4MtxCol2, v4MtxCol3, v4MtxCol4 );
+
+							for ( uint32_t i = 0u; i < DirectionalCascadesCount; ++i )
+							{
+								result.m_cascades()[i] = texelFetch( c3d_sLights, offset++ );
+							}
+
+							for ( uint32_t i = 0u; i < DirectionalCascadesCount / 2u; ++i )
+							{
+								result.m_cascadesDepths()[i] = texelFetch( c3d_sLights, offset++ );
+							}
 						}
 						else
 						{
 							auto c3d_sLights = m_writer.getBuiltin< Sampler1D >( cuT( "c3d_sLights" ) );
 							auto offset = m_writer.declLocale( cuT( "offset" ), index * Int( MaxLightComponentsCount ) + Int( BaseLightComponentsCount ) );
-							result.m_direction() = texelFetch( c3d_sLights, offset++, 0 ).rgb();
+							auto v4DirCount = m_writer.declLocale( cuT( "v4DirCount" ), texelFetch( c3d_sLights, offset++, 0 ) );
+							result.m_direction() = v4DirCount.rgb();
+							result.m_cascadesCount() = m_writer.cast< Int >( v4DirCount.a() );
 							auto v4MtxCol1 = m_writer.declLocale( cuT( "v4MtxCol1" ), texelFetch( c3d_sLights, offset++, 0 ) );
 							auto v4MtxCol2 = m_writer.declLocale( cuT( "v4MtxCol2" ), texelFetch( c3d_sLights, offset++, 0 ) );
 							auto v4MtxCol3 = m_writer.declLocale( cuT( "v4MtxCol3" ), texelFetch( c3d_sLights, offset++, 0 ) );
 							auto v4MtxCol4 = m_writer.declLocale( cuT( "v4MtxCol4" ), texelFetch( c3d_sLights, offset++, 0 ) );
 							result.m_transform() = mat4( v4MtxCol1, v4MtxCol2, v4MtxCol3, v4MtxCol4 );
+
+							for ( uint32_t i = 0u; i < DirectionalCascadesCount; ++i )
+							{
+								result.m_cascades()[i] = texelFetch( c3d_sLights, offset++, 0 );
+							}
+
+							for ( uint32_t i = 0u; i < DirectionalCascadesCount / 2u; ++i )
+							{
+								result.m_cascadesDepths()[i] = texelFetch( c3d_sLights, offset++, 0 );
+							}
 						}
 					}
 					else
@@ -378,6 +479,70 @@ namespace castor3d
 				, InInt{ &m_writer, cuT( "index" ) } );
 		}
 
+		void LightingModel::doComputeCombined( FragmentInput const & fragmentIn
+			, LightCall const & directional
+			, LightCall const & point
+			, LightCall const & spot )const
+		{
+			auto c3d_lightsCount = m_writer.getBuiltin< Vec3 >( cuT( "c3d_lightsCount" ) );
+			auto begin = m_writer.declLocale( cuT( "begin" )
+				, 0_i );
+			auto end = m_writer.declLocale( cuT( "end" )
+				, m_writer.cast< Int >( c3d_lightsCount.x() ) );
+
+			FOR( m_writer, Int, i, begin, cuT( "i < end" ), cuT( "++i" ) )
+			{
+				directional( i );
+			}
+			ROF;
+
+			if ( m_clustered )
+			{
+				// Only the point and spot lights from the fragment's cluster are processed,
+				// the lights indices are stored in the clusters lists.
+				auto gl_FragCoord = m_writer.getBuiltin< Vec4 >( cuT( "gl_FragCoord" ) );
+				auto cluster = m_writer.declLocale( cuT( "cluster" )
+					, m_getCluster( InVec3{ fragmentIn.m_vertex }, gl_FragCoord.xy() ) );
+				begin = cluster.x();
+				end = begin + cluster.y();
+
+				FOR( m_writer, Int, i, begin, cuT( "i < end" ), cuT( "++i" ) )
+				{
+					point( m_getClusterLight( i ) );
+				}
+				ROF;
+
+				begin = end;
+				end += cluster.z();
+
+				FOR( m_writer, Int, i, begin, cuT( "i < end" ), cuT( "++i" ) )
+				{
+					spot( m_getClusterLight( i ) );
+				}
+				ROF;
+			}
+			else
+			{
+				begin = end;
+				end += m_writer.cast< Int >( c3d_lightsCount.y() );
+
+				FOR( m_writer, Int, i, begin, cuT( "i < end" ), cuT( "++i" ) )
+				{
+					point( i );
+				}
+				ROF;
+
+				begin = end;
+				end += m_writer.cast< Int >( c3d_lightsCount.z() );
+
+				FOR( m_writer, Int, i, begin, cuT( "i < end" ), cuT( "++i" ) )
+				{
+					spot( i );
+				}
+				ROF;
+			}
+		}
+
 		Light LightingModel::getBaseLight( Type const & p_value )const
 		{
 			return writeFunctionCall< Light >( &m_writer, cuT( "getBaseLight" ), p_value );
@@ -47,12 +47,18 @@ namespace castor3d
 			C3D_API void declareDirectionalModel( uint32_t & index );
 			C3D_API void declarePointModel( uint32_t & index );
 			C3D_API void declareSpotModel( uint32_t & index );
+			C3D_API void declareClusters();
 			// Calls
 			C3D_API DirectionalLight getDirectionalLight( glsl::Int const & index )const;
 			C3D_API PointLight getPointLight( glsl::Int const & index )const;
 			C3D_API SpotLight getSpotLight( glsl::Int const & index )const;
 
 		protected:
+			using LightCall = std::function< void( glsl::Int const & ) >;
+			C3D_API void doComputeCombined( FragmentInput const & fragmentIn
+				, LightCall const & directional
+				, LightCall const & point
+				, LightCall const & spot )const;
 			C3D_API Light getBaseLight( glsl::Type const & value )const;
 			C3D_API void doDeclareLight();
 			C3D_API void doDeclareDirectionalLight();
@@ -80,6 +86,12 @@ namespace castor3d
 				, glsl::InInt > m_getPointLight;
 			glsl::Function< shader::SpotLight
 				, glsl::InInt > m_getSpotLight;
+			bool m_clustered{ false };
+			glsl::Function< glsl::IVec3
+				, glsl::InVec3
+				, glsl::InVec2 > m_getCluster;
+			glsl::Function< glsl::Int
+				, glsl::InInt > m_getClusterLight;
 		};
 	}
 }
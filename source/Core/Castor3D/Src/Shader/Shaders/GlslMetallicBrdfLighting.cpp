@@ -26,59 +26,43 @@ namespace castor3d
 			, FragmentInput const & fragmentIn
 			, OutputComponents & parentOutput )const
 		{
-			auto c3d_lightsCount = m_writer.getBuiltin< Vec3 >( cuT( "c3d_lightsCount" ) );
-			auto begin = m_writer.declLocale( cuT( "begin" )
-				, 0_i );
-			auto end = m_writer.declLocale( cuT( "end" )
-				, m_writer.cast< Int >( c3d_lightsCount.x() ) );
-
-			FOR( m_writer, Int, i, begin, cuT( "i < end" ), cuT( "++i" ) )
-			{
-				m_writer << m_computeDirectional( getDirectionalLight( i )
-					, worldEye
-					, albedo
-					, metallic
-					, roughness
-					, receivesShadows
-					, FragmentInput{ fragmentIn }
-					, parentOutput );
-				m_writer << endi;
-			}
-			ROF;
-
-			begin = end;
-			end += m_writer.cast< Int >( c3d_lightsCount.y() );
-
-			FOR( m_writer, Int, i, begin, cuT( "i < end" ), cuT( "++i" ) )
-			{
-				m_writer << m_computePoint( getPointLight( i )
-					, worldEye
-					, albedo
-					, metallic
-					, roughness
-					, receivesShadows
-					, FragmentInput{ fragmentIn }
-					, parentOutput );
-				m_writer << endi;
-			}
-			ROF;
-
-			begin = end;
-			end += m_writer.cast< Int >( c3d_lightsCount.z() );
-
-			FOR( m_writer, Int, i, begin, cuT( "i < end" ), cuT( "++i" ) )
-			{
-				m_writer << m_computeSpot( getSpotLight( i )
-					, worldEye
-					, albedo
-					, metallic
-					, roughness
-					, receivesShadows
-					, FragmentInput{ fragmentIn }
-					, parentOutput );
-				m_writer << endi;
-			}
-			ROF;
+			doComputeCombined( fragmentIn
+				, [&]( Int const & index )
+				{
+					m_writer << m_computeDirectional( getDirectionalLight( index )
+						, worldEye
+						, albedo
+						, metallic
+						, roughness
+						, receivesShadows
+						, FragmentInput{ fragmentIn }
+						, parentOutput );
+					m_writer << endi;
+				}
+				, [&]( Int const & index )
+				{
+					m_writer << m_computePoint( getPointLight( index )
+						, worldEye
+						, albedo
+						, metallic
+						, roughness
+						, receivesShadows
+						, FragmentInput{ fragmentIn }
+						, parentOutput );
+					m_writer << endi;
+				}
+				, [&]( Int const & index )
+				{
+					m_writer << m_computeSpot( getSpotLight( index )
+						, worldEye
+						, albedo
+						, metallic
+						, roughness
+						, receivesShadows
+						, FragmentInput{ fragmentIn }
+						, parentOutput );
+					m_writer << endi;
+				} );
 		}
 
 		void MetallicBrdfLightingModel::compute( DirectionalLight const & light
@@ -177,6 +161,9 @@ namespace castor3d
 					{
 						shadowFactor = 1.0_f - min( m_writer.cast< Float >( receivesShadows )
 							, m_shadowModel->computeDirectionalShadow( light.m_transform()
+								, light.m_cascades()
+								, light.m_cascadesDepths()
+								, light.m_cascadesCount()
 								, fragmentIn.m_vertex
 								, -lightDirection
 								, fragmentIn.m_normal ) );
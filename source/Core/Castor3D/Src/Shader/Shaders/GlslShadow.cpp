@@ -31,6 +31,7 @@ namespace castor3d
 			doDeclareGetShadowOffset();
 			doDeclareChebyshevUpperBound();
 			doDeclareGetLightSpacePosition();
+			doDeclareGetDirectionalCascadePosition();
 			doDeclareComputeDirectionalShadow();
 			doDeclareComputeSpotShadow();
 			doDeclareComputePointShadow();
@@ -45,6 +46,7 @@ namespace castor3d
 			doDeclareGetShadowOffset();
 			doDeclareChebyshevUpperBound();
 			doDeclareGetLightSpacePosition();
+			doDeclareGetDirectionalCascadePosition();
 			doDeclareComputeDirectionalShadow();
 		}
 
@@ -72,11 +74,17 @@ namespace castor3d
 		}
 
 		Float Shadow::computeDirectionalShadow( Mat4 const & lightMatrix
+			, Array< Vec4 > const & cascades
+			, Array< Vec4 > const & cascadesDepths
+			, Int const & cascadesCount
 			, Vec3 const & worldSpacePosition
 			, Vec3 const & lightDirection
 			, Vec3 const & normal )
 		{
 			return m_computeDirectional( lightMatrix
+				, cascades
+				, cascadesDepths
+				, cascadesCount
 				, worldSpacePosition
 				, lightDirection
 				, normal );
@@ -197,17 +205,85 @@ namespace castor3d
 				, InVec3( &m_writer, cuT( "worldSpacePosition" ) ) );
 		}
 
+		void Shadow::doDeclareGetDirectionalCascadePosition()
+		{
+			m_getDirectionalCascadePosition = m_writer.implementFunction< Vec3 >( cuT( "getDirectionalCascadePosition" )
+				, [this]( Mat4 const & lightMatrix
+					, Array< Vec4 > const & cascades
+					, Array< Vec4 > const & cascadesDepths
+					, Int const & cascadesCount
+					, Vec3 const & worldSpacePosition )
+				{
+					auto lightSpacePosition = m_writer.declLocale( cuT( "lightSpacePosition" )
+						, m_getLightSpacePosition( lightMatrix, worldSpacePosition ) );
+					// Outside of all cascades, the position falls in the texture border, which is unshadowed.
+					auto result = m_writer.declLocale( cuT( "result" )
+						, vec3( -1.0_f, -1.0_f, lightSpacePosition.z() ) );
+					// The cascades are laid out in a 2x2 grid, as soon as there are more than one.
+					auto grid = m_writer.declLocale( cuT( "grid" )
+						, 1.0_f );
+
+					IF( m_writer, cascadesCount > 1_i )
+					{
+						grid = 2.0_f;
+					}
+					FI;
+
+					// From the widest cascade to the tightest one, so the tightest one containing the position wins.
+					// The loop is unrolled, so each cascade reads its depth scale and offset from constant components.
+					for ( uint32_t i = DirectionalCascadesCount; i > 0u; --i )
+					{
+						auto cascade = i - 1u;
+						auto suffix = string::toString( cascade );
+
+						IF( m_writer, cascadesCount > Int( int( cascade ) ) )
+						{
+							auto cascadePosition = m_writer.declLocale( cuT( "cascadePosition" ) + suffix
+								, lightSpacePosition.xy() * cascades[cascade].xy() + cascades[cascade].zw() );
+
+							// The margin keeps the blurred borders of the neighbour cascades away.
+							IF( m_writer, cascadePosition.x() >= 0.002_f
+								&& cascadePosition.x() <= 0.998_f
+								&& cascadePosition.y() >= 0.002_f
+								&& cascadePosition.y() <= 0.998_f )
+							{
+								auto depth = m_writer.declLocale( cuT( "depth" ) + suffix
+									, ( cascade % 2u )
+										? cascadesDepths[cascade / 2u].zw()
+										: cascadesDepths[cascade / 2u].xy() );
+								auto tile = m_writer.declLocale( cuT( "tile" ) + suffix
+									, vec2( Float( float( cascade % 2u ) ), Float( float( cascade / 2u ) ) ) );
+								result.xy() = m_writer.paren( cascadePosition + tile ) / grid;
+								result.z() = lightSpacePosition.z() * depth.x() + depth.y();
+							}
+							FI;
+						}
+						FI;
+					}
+
+					m_writer.returnStmt( result );
+				}
+				, InMat4( &m_writer, cuT( "lightMatrix" ) )
+				, InArrayParam< Vec4 >( &m_writer, cuT( "cascades" ), DirectionalCascadesCount )
+				, InArrayParam< Vec4 >( &m_writer, cuT( "cascadesDepths" ), DirectionalCascadesCount / 2u )
+				, InInt( &m_writer, cuT( "cascadesCount" ) )
+				, InVec3( &m_writer, cuT( "worldSpacePosition" ) ) );
+		}
+
 		void Shadow::doDeclareComputeDirectionalShadow()
 		{
 			m_computeDirectional = m_writer.implementFunction< Float >( cuT( "computeDirectionalShadow" )
 				, [this]( Mat4 const & lightMatrix
+					, Array< Vec4 > const & cascades
+					, Array< Vec4 > const & cascadesDepths
+					, Int const & cascadesCount
 					, Vec3 const & worldSpacePosition
 					, Vec3 const & lightDirection
 					, Vec3 const & normal )
 				{
 					auto c3d_mapShadowDirectional = m_writer.getBuiltin< Sampler2D >( Shadow::MapShadowDirectional );
 					auto lightSpacePosition = m_writer.declLocale( cuT( "lightSpacePosition" )
-						, m_getLightSpacePosition( lightMatrix, worldSpacePosition ) );
+						, m_getDirectionalCascadePosition( lightMatrix, cascades, cascadesDepths, cascadesCount, worldSpacePosition ) );
 					auto moments = m_writer.declLocale( cuT( "moments" )
 						, texture( c3d_mapShadowDirectional, lightSpacePosition.xy() ).xy() );
 
@@ -223,6 +299,9 @@ namespace castor3d
 						, 0.02_f ) );
 				}
 				, InParam< Mat4 >( &m_writer, cuT( "lightMatrix" ) )
+				, InArrayParam< Vec4 >( &m_writer, cuT( "cascades" ), DirectionalCascadesCount )
+				, InArrayParam< Vec4 >( &m_writer, cuT( "cascadesDepths" ), DirectionalCascadesCount / 2u )
+				, InInt( &m_writer, cuT( "cascadesCount" ) )
 				, InVec3( &m_writer, cuT( "worldSpacePosition" ) )
 				, InVec3( &m_writer, cuT( "lightDirection" ) )
 				, InVec3( &m_writer, cuT( "normal" ) ) );
@@ -33,6 +33,9 @@ namespace castor3d
 			C3D_API void declareSpot( ShadowType type
 				, uint32_t & index );
 			C3D_API glsl::Float computeDirectionalShadow( glsl::Mat4 const & lightMatrix
+				, glsl::Array< glsl::Vec4 > const & cascades
+				, glsl::Array< glsl::Vec4 > const & cascadesDepths
+				, glsl::Int const & cascadesCount
 				, glsl::Vec3 const & worldSpacePosition
 				, glsl::Vec3 const & lightDirection
 				, glsl::Vec3 const & normal );
@@ -60,6 +63,7 @@ namespace castor3d
 			void doDeclareGetShadowOffset();
 			void doDeclareChebyshevUpperBound();
 			void doDeclareGetLightSpacePosition();
+			void doDeclareGetDirectionalCascadePosition();
 			void doDeclareComputeDirectionalShadow();
 			void doDeclareComputeSpotShadow();
 			void doDeclareComputePointShadow();
@@ -81,8 +85,17 @@ namespace castor3d
 			glsl::Function< glsl::Vec3
 				, glsl::InMat4
 				, glsl::InVec3 > m_getLightSpacePosition;
+			glsl::Function< glsl::Vec3
+				, glsl::InMat4
+				, glsl::InArrayParam< glsl::Vec4 >
+				, glsl::InArrayParam< glsl::Vec4 >
+				, glsl::InInt
+				, glsl::InVec3 > m_getDirectionalCascadePosition;
 			glsl::Function< glsl::Float
 				, glsl::InMat4
+				, glsl::InArrayParam< glsl::Vec4 >
+				, glsl::InArrayParam< glsl::Vec4 >
+				, glsl::InInt
 				, glsl::InVec3
 				, glsl::InVec3
 				, glsl::InVec3 > m_computeDirectional;
@@ -57,8 +57,11 @@ namespace castor3d
 					auto shrinkedPos = m_writer.declLocale( cuT( "shrinkedPos" )
 						, position - normal * 0.005 );
 					auto lightSpacePosition = m_writer.declLocale( cuT( "lightSpacePosition" )
-						, writeFunctionCall< Vec3 >( &m_writer, cuT( "getLightSpacePosition" )
+						, writeFunctionCall< Vec3 >( &m_writer, cuT( "getDirectionalCascadePosition" )
 							, light.m_transform()
+							, light.m_cascades()
+							, light.m_cascadesDepths()
+							, light.m_cascadesCount()
 							, shrinkedPos ) );
 					auto shadowDepth = m_writer.declLocale( cuT( "d1" )
 						, texture( c3d_mapDepthDirectional, lightSpacePosition.xy() ).r() );
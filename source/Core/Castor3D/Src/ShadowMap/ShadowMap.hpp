@@ -86,8 +86,10 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Renders the given light's shadow map.
+		 *\remarks		Only the parts that changed since the previous render are redrawn.
 		 *\~french
 		 *\brief		Dessine la shadow map de la lumière donnée.
+		 *\remarks		Seules les parties ayant changé depuis le dessin précédent sont redessinées.
 		 */
 		C3D_API virtual void render() = 0;
 		/**
@@ -171,6 +173,26 @@ namespace castor3d
 		{
 			return m_linearMap;
 		}
+		/**
+		 *\~english
+		 *\return		The number of shadow passes rendered by the last render.
+		 *\~french
+		 *\return		Le nombre de passes d'ombres dessinées lors du dernier dessin.
+		 */
+		inline uint32_t getRenderedPasses()const
+		{
+			return m_renderedPasses;
+		}
+		/**
+		 *\~english
+		 *\return		The number of shadow passes skipped by the last render, their content being up to date.
+		 *\~french
+		 *\return		Le nombre de passes d'ombres ignorées lors du dernier dessin, leur contenu étant à jour.
+		 */
+		inline uint32_t getSkippedPasses()const
+		{
+			return m_skippedPasses;
+		}
 
 	private:
 		/**
@@ -259,6 +281,12 @@ namespace castor3d
 		//!\~english	The linear depth texture.
 		//!\~french		La texture de profondeur linéaire.
 		TextureUnit m_linearMap;
+		//!\~english	The number of shadow passes rendered by the last render.
+		//!\~french		Le nombre de passes d'ombres dessinées lors du dernier dessin.
+		uint32_t m_renderedPasses{ 0u };
+		//!\~english	The number of shadow passes skipped by the last render.
+		//!\~french		Le nombre de passes d'ombres ignorées lors du dernier dessin.
+		uint32_t m_skippedPasses{ 0u };
 	};
 }
 
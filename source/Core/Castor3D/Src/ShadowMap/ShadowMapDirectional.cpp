@@ -9,8 +9,11 @@
 #include "Miscellaneous/GaussianBlur.hpp"
 #include "Render/RenderPipeline.hpp"
 #include "Render/RenderSystem.hpp"
+#include "Scene/Geometry.hpp"
 #include "Scene/Light/Light.hpp"
 #include "Scene/Light/DirectionalLight.hpp"
+#include "Scene/Scene.hpp"
+#include "Scene/SceneNode.hpp"
 #include "Shader/ShaderProgram.hpp"
 #include "Shader/Shaders/GlslMaterial.hpp"
 #include "Shader/UniformBuffer.hpp"
@@ -103,19 +106,68 @@ namespace castor3d
 
 			return unit;
 		}
+
+		void doGetCasterBounds( SceneNode const & node
+			, Geometry const & geometry
+			, Point3r & position
+			, real & extent )
+		{
+			auto scale = node.getDerivedScale();
+			auto & sphere = geometry.getBoundingSphere();
+			position = node.getDerivedPosition();
+			extent = real( sphere.getRadius() + point::length( sphere.getCenter() ) )
+				* std::max( std::abs( scale[0] ), std::max( std::abs( scale[1] ), std::abs( scale[2] ) ) );
+		}
 	}
 
 	ShadowMapDirectional::ShadowMapDirectional( Engine & engine
-		, Scene & scene )
+		, Scene & scene
+		, uint32_t cascades
+		, float splitLambda )
 		: ShadowMap{ engine
 			, doInitialiseVariance( engine, Size{ ShadowMapPassDirectional::TextureSize, ShadowMapPassDirectional::TextureSize } )
 			, doInitialiseDepth( engine, Size{ ShadowMapPassDirectional::TextureSize, ShadowMapPassDirectional::TextureSize } )
-			, std::make_shared< ShadowMapPassDirectional >( engine, scene, *this ) }
+			, std::make_shared< ShadowMapPassDirectional >( engine
+				, scene
+				, *this
+				, 0u
+				, std::max( 1u, std::min( cascades, shader::DirectionalCascadesCount ) )
+				, splitLambda ) }
+		, m_scene{ scene }
 	{
+		cascades = std::max( 1u, std::min( cascades, shader::DirectionalCascadesCount ) );
+		m_cascades.resize( cascades );
+		m_cascades[0].m_pass = std::static_pointer_cast< ShadowMapPassDirectional >( m_pass );
+
+		for ( uint32_t i = 1u; i < cascades; ++i )
+		{
+			m_cascades[i].m_pass = std::make_shared< ShadowMapPassDirectional >( engine
+				, scene
+				, *this
+				, i
+				, cascades
+				, splitLambda );
+		}
+
+		for ( auto & cascade : m_cascades )
+		{
+			cascade.m_staticLayer = std::make_unique< ShadowMapStaticLayer >( engine );
+		}
+
+		m_onSceneChanged = scene.onChanged.connect( [this]( Scene const & )
+			{
+				m_castersChanged = true;
+			} );
+		m_onNodesChanged = scene.getChanges().onSceneNodesChanged.connect( [this]( std::vector< SceneNode const * > const & nodes )
+			{
+				doOnNodesChanged( nodes );
+			} );
 	}
 
 	ShadowMapDirectional::~ShadowMapDirectional()
 	{
+		m_onNodesChanged.disconnect();
+		m_onSceneChanged.disconnect();
 	}
 
 	void ShadowMapDirectional::update( Camera const & camera
@@ -123,16 +175,92 @@ namespace castor3d
 		, Light & light
 		, uint32_t index )
 	{
-		m_pass->update( camera, queues, light, index );
+		std::vector< Matrix4x4r > transforms;
+		transforms.reserve( m_cascades.size() );
+		auto node = light.getParent();
+		node->update();
+		Point3r front{ 0.0_r, 0.0_r, 1.0_r };
+		node->getDerivedOrientation().transform( front, front );
+		auto castersNear = doGetCastersNear( node->getDerivedPosition()
+			, front );
+
+		// Each cascade pushes its own queue, so they are culled and built in parallel.
+		for ( auto & cascade : m_cascades )
+		{
+			cascade.m_pass->setCastersNear( castersNear );
+			cascade.m_pass->update( camera, queues, light, index );
+			transforms.push_back( cascade.m_pass->getTransform() );
+		}
+
+		light.getDirectionalLight()->updateCascades( transforms
+			, m_cascades[0].m_pass->getFarPlane() );
 	}
 
 	void ShadowMapDirectional::render()
 	{
+		bool render = false;
+
+		for ( auto & cascade : m_cascades )
+		{
+			cascade.m_pass->updateCasters();
+			render = render
+				|| cascade.m_pass->isStaticDirty()
+				|| cascade.m_pass->hasDynamicCasters()
+				|| cascade.m_hasDynamicCasters;
+		}
+
+		// Without dynamic casters, now or in the previous render, the map is still valid.
+		if ( !render )
+		{
+			m_renderedPasses = 0u;
+			m_skippedPasses = uint32_t( m_cascades.size() );
+			return;
+		}
+
 		m_pass->startTimer();
-		m_frameBuffer->bind( FrameBufferTarget::eDraw );
-		m_frameBuffer->clear( BufferComponent::eDepth | BufferComponent::eColour );
-		m_pass->render( 0u );
-		m_frameBuffer->unbind();
+		m_renderedPasses = 0u;
+		m_skippedPasses = 0u;
+
+		// The blur runs on the whole map, so every tile is restored from its static layer before it.
+		for ( auto & cascade : m_cascades )
+		{
+			auto & pass = *cascade.m_pass;
+			auto & viewport = pass.getCamera()->getViewport();
+			auto renderStatic = pass.isStaticDirty();
+			auto renderDynamic = pass.hasDynamicCasters();
+
+			if ( renderStatic )
+			{
+				viewport.setPosition( Position{} );
+				cascade.m_staticLayer->bind();
+				pass.render( 0u, ShadowCaster::eStatic );
+				cascade.m_staticLayer->unbind();
+				pass.setStaticUpToDate();
+			}
+
+			cascade.m_staticLayer->copyTo( *m_frameBuffer
+				, { m_varianceAttach }
+				, pass.getTilePosition() );
+
+			if ( renderDynamic )
+			{
+				viewport.setPosition( pass.getTilePosition() );
+				m_frameBuffer->bind( FrameBufferTarget::eDraw );
+				pass.render( 0u, ShadowCaster::eDynamic );
+				m_frameBuffer->unbind();
+			}
+
+			if ( renderStatic || renderDynamic || cascade.m_hasDynamicCasters )
+			{
+				++m_renderedPasses;
+			}
+			else
+			{
+				++m_skippedPasses;
+			}
+
+			cascade.m_hasDynamicCasters = renderDynamic;
+		}
 
 		m_blur->blur( m_shadowMap.getTexture() );
 		m_pass->stopTimer();
@@ -168,10 +296,34 @@ namespace castor3d
 			, m_shadowMap.getTexture()->getDimensions()
 			, m_shadowMap.getTexture()->getPixelFormat()
 			, 5u );
+		auto size = m_shadowMap.getTexture()->getDimensions();
+
+		for ( auto & cascade : m_cascades )
+		{
+			if ( cascade.m_pass != m_pass )
+			{
+				cascade.m_pass->initialise( size );
+			}
+
+			cascade.m_staticLayer->initialise( cascade.m_pass->getTileSize()
+				, PixelFormat::eD32F
+				, { PixelFormat::eAL32F }
+				, RgbaColour::fromPredefined( PredefinedRgbaColour::eOpaqueBlack ) );
+		}
 	}
 
 	void ShadowMapDirectional::doCleanup()
 	{
+		for ( auto & cascade : m_cascades )
+		{
+			cascade.m_staticLayer->cleanup();
+
+			if ( cascade.m_pass != m_pass )
+			{
+				cascade.m_pass->cleanup();
+			}
+		}
+
 		m_blur.reset();
 		m_linearAttach.reset();
 		m_varianceAttach.reset();
@@ -236,4 +388,96 @@ namespace castor3d
 
 		return writer.finalise();
 	}
+
+	void ShadowMapDirectional::doUpdateCasters()
+	{
+		auto & handles = getEngine()->getHandles();
+		auto geometries = m_scene.getGeometryCache().getSnapshot();
+		m_casters.clear();
+
+		for ( auto & pair : *geometries )
+		{
+			auto & geometry = *pair.second;
+			auto node = handles.resolve( geometry.getParentHandle() );
+
+			if ( node
+				&& geometry.isShadowCaster()
+				&& handles.resolve( geometry.getMeshHandle() ) )
+			{
+				Caster caster{ node, geometry.getHandle() };
+				doGetCasterBounds( *node, geometry, caster.m_position, caster.m_extent );
+				m_casters.push_back( caster );
+			}
+		}
+
+		std::sort( m_casters.begin()
+			, m_casters.end()
+			, []( Caster const & lhs, Caster const & rhs )
+			{
+				return lhs.m_node < rhs.m_node;
+			} );
+		m_castersChanged = false;
+		m_castersMoved = true;
+	}
+
+	void ShadowMapDirectional::doOnNodesChanged( std::vector< SceneNode const * > const & nodes )
+	{
+		// Rebuilt anyway.
+		if ( m_castersChanged )
+		{
+			return;
+		}
+
+		auto & handles = getEngine()->getHandles();
+
+		for ( auto node : nodes )
+		{
+			auto range = std::equal_range( m_casters.begin()
+				, m_casters.end()
+				, Caster{ node }
+				, []( Caster const & lhs, Caster const & rhs )
+				{
+					return lhs.m_node < rhs.m_node;
+				} );
+
+			for ( auto it = range.first; it != range.second; ++it )
+			{
+				auto geometry = handles.resolve( it->m_geometry );
+
+				if ( geometry )
+				{
+					doGetCasterBounds( *node, *geometry, it->m_position, it->m_extent );
+					m_castersMoved = true;
+				}
+			}
+		}
+	}
+
+	real ShadowMapDirectional::doGetCastersNear( Point3r const & origin
+		, Point3r const & front )
+	{
+		if ( m_castersChanged )
+		{
+			doUpdateCasters();
+		}
+
+		if ( m_castersMoved
+			|| m_castersOrigin != origin
+			|| m_castersFront != front )
+		{
+			m_castersNear = std::numeric_limits< real >::max();
+
+			for ( auto & caster : m_casters )
+			{
+				m_castersNear = std::min( m_castersNear
+					, real( point::dot( caster.m_position - origin, front ) ) - caster.m_extent );
+			}
+
+			m_castersOrigin = origin;
+			m_castersFront = front;
+			m_castersMoved = false;
+		}
+
+		return m_castersNear;
+	}
 }
@@ -5,7 +5,10 @@ See LICENSE file in root folder
 #define ___C3D_ShadowMapDirectional_H___
 
 #include "Miscellaneous/GaussianBlur.hpp"
+#include "Scene/ChangeJournal.hpp"
 #include "ShadowMap/ShadowMap.hpp"
+#include "ShadowMap/ShadowMapPassDirectional.hpp"
+#include "ShadowMap/ShadowMapStaticLayer.hpp"
 
 namespace castor3d
 {
@@ -14,9 +17,11 @@ namespace castor3d
 	\version	0.9.0
 	\date		30/08/2016
 	\~english
-	\brief		Shadow mapping implementation for spot lights.
+	\brief		Shadow mapping implementation for directional lights.
+	\remarks	The view frustum is split in cascades, each one rendered in its own tile of the map.
 	\~french
-	\brief		Implémentation du mappage d'ombres pour les lumières spot.
+	\brief		Implémentation du mappage d'ombres pour les lumières directionnelles.
+	\remarks	Le frustum de vue est découpé en cascades, chacune étant dessinée dans sa propre tuile de la texture.
 	*/
 	class ShadowMapDirectional
 		: public ShadowMap
@@ -25,15 +30,21 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Constructor.
-		 *\param[in]	engine	The engine.
-		 *\param[in]	scene	The scene.
+		 *\param[in]	engine		The engine.
+		 *\param[in]	scene		The scene.
+		 *\param[in]	cascades	The cascades count, from 1 to shader::DirectionalCascadesCount.
+		 *\param[in]	splitLambda	The blend between the uniform (0) and the logarithmic (1) cascades split schemes.
 		 *\~french
 		 *\brief		Constructeur.
-		 *\param[in]	engine	Le moteur.
-		 *\param[in]	scene	La scène.
+		 *\param[in]	engine		Le moteur.
+		 *\param[in]	scene		La scène.
+		 *\param[in]	cascades	Le nombre de cascades, de 1 à shader::DirectionalCascadesCount.
+		 *\param[in]	splitLambda	Le mélange entre les schémas de découpe uniforme (0) et logarithmique (1) des cascades.
 		 */
 		ShadowMapDirectional( Engine & engine
-			, Scene & scene );
+			, Scene & scene
+			, uint32_t cascades = shader::DirectionalCascadesCount
+			, float splitLambda = 0.75f );
 		/**
 		 *\~english
 		 *\brief		Destructor.
@@ -81,8 +92,65 @@ namespace castor3d
 			, ProgramFlags const & programFlags
 			, SceneFlags const & sceneFlags
 			, ComparisonFunc alphaFunc )const override;
+		/**
+		 *\~english
+		 *\brief		Rebuilds the shadow casters list from the scene's geometries.
+		 *\~french
+		 *\brief		Reconstruit la liste des projeteurs d'ombres depuis les géométries de la scène.
+		 */
+		void doUpdateCasters();
+		/**
+		 *\~english
+		 *\brief		Updates the bounds of the casters attached to the given nodes.
+		 *\param[in]	nodes	The scene nodes changed since the last frame.
+		 *\~french
+		 *\brief		Met à jour les limites des projeteurs attachés aux noeuds donnés.
+		 *\param[in]	nodes	Les noeuds de scène modifiés depuis la dernière frame.
+		 */
+		void doOnNodesChanged( std::vector< SceneNode const * > const & nodes );
+		/**
+		 *\~english
+		 *\return		The distance from the light origin to the nearest caster, along the light direction.
+		 *\param[in]	origin	The light origin.
+		 *\param[in]	front	The light direction.
+		 *\~french
+		 *\return		La distance entre l'origine de la lumière et le projeteur le plus proche, selon la direction de la lumière.
+		 *\param[in]	origin	L'origine de la lumière.
+		 *\param[in]	front	La direction de la lumière.
+		 */
+		castor::real doGetCastersNear( castor::Point3r const & origin
+			, castor::Point3r const & front );
+
+	private:
+		struct Caster
+		{
+			//!\~english	The caster's node, sorts the casters, it is never dereferenced.
+			//!\~french		Le noeud du projeteur, trie les projeteurs, il n'est jamais déréférencé.
+			SceneNode const * m_node;
+			GeometryHandle m_geometry;
+			//!\~english	The caster's bounding sphere, in world space.
+			//!\~french		La sphère englobante du projeteur, dans l'espace monde.
+			castor::Point3r m_position;
+			castor::real m_extent;
+		};
+
+		struct Cascade
+		{
+			//!\~english	The cascade's pass.
+			//!\~french		La passe de la cascade.
+			std::shared_ptr< ShadowMapPassDirectional > m_pass;
+			//!\~english	The cascade's static casters layer.
+			//!\~french		La couche des projeteurs statiques de la cascade.
+			std::unique_ptr< ShadowMapStaticLayer > m_staticLayer;
+			//!\~english	Tells if the cascade holds dynamic casters, from the previous render.
+			//!\~french		Dit si la cascade contient des projeteurs dynamiques, depuis le dessin précédent.
+			bool m_hasDynamicCasters{ false };
+		};
 
 	private:
+		//!\~english	The cascades, the first one uses the shadow map's pass.
+		//!\~french		Les cascades, la première utilise la passe de la shadow map.
+		std::vector< Cascade > m_cascades;
 		//!\~english	The attach between variance map and main frame buffer.
 		//!\~french		L'attache entre la texture de variance et le tampon principal.
 		TextureAttachmentSPtr m_varianceAttach;
@@ -92,6 +160,29 @@ namespace castor3d
 		//!\~english	The Gaussian blur pass.
 		//!\~french		La passe de flou Gaussien.
 		std::unique_ptr< GaussianBlur > m_blur;
+		//!\~english	The scene.
+		//!\~french		La scène.
+		Scene & m_scene;
+		//!\~english	The shadow casters, sorted by node, with their bounds updated when their node changes.
+		//!\~french		Les projeteurs d'ombres, triés par noeud, dont les limites sont mises à jour lorsque leur noeud change.
+		std::vector< Caster > m_casters;
+		//!\~english	Tells if the scene content changed, the casters list must then be rebuilt.
+		//!\~french		Dit si le contenu de la scène a changé, la liste des projeteurs doit alors être reconstruite.
+		bool m_castersChanged{ true };
+		//!\~english	Tells if a caster moved since the near distance was computed.
+		//!\~french		Dit si un projeteur a bougé depuis le calcul de la distance proche.
+		bool m_castersMoved{ true };
+		//!\~english	The casters near distance, and the light origin and direction it was computed for.
+		//!\~french		La distance proche des projeteurs, et l'origine et la direction de la lumière pour lesquelles elle a été calculée.
+		castor::real m_castersNear{ std::numeric_limits< castor::real >::max() };
+		castor::Point3r m_castersOrigin;
+		castor::Point3r m_castersFront;
+		//!\~english	The connection to the scene content changes.
+		//!\~french		La connexion aux changements du contenu de la scène.
+		OnSceneChangedConnection m_onSceneChanged;
+		//!\~english	The connection to the scene nodes changed during the frame, from the scene changes journal.
+		//!\~french		La connexion aux noeuds de scène modifiés pendant la frame, depuis le journal des changements de la scène.
+		OnSceneNodesChangedConnection m_onNodesChanged;
 	};
 }
 
@@ -4,7 +4,12 @@
 #include "Mesh/Buffer/GeometryBuffers.hpp"
 #include "Render/RenderPassTimer.hpp"
 #include "Render/RenderPipeline.hpp"
+#include "Material/Material.hpp"
+#include "Material/Pass.hpp"
+#include "Render/RenderNode/StaticRenderNode.hpp"
 #include "Scene/BillboardList.hpp"
+#include "Scene/Scene.hpp"
+#include "Scene/SceneNode.hpp"
 #include "Shader/ShaderProgram.hpp"
 #include "ShadowMap/ShadowMap.hpp"
 #include "Texture/TextureLayout.hpp"
@@ -15,6 +20,46 @@ using namespace castor;
 
 namespace castor3d
 {
+	namespace
+	{
+		SceneNode const * doGetSceneNode( SceneNode const * node )
+		{
+			return node;
+		}
+
+		SceneNode const * doGetSceneNode( StaticRenderNode const * node )
+		{
+			return &node->m_sceneNode;
+		}
+
+		template< typename MapType >
+		bool doHasNodes( MapType const & nodes )
+		{
+			return std::any_of( nodes.begin()
+				, nodes.end()
+				, []( auto const & pair )
+				{
+					return !pair.second.empty();
+				} );
+		}
+
+		template< typename MapType >
+		bool doHasInstantiatedNodes( MapType const & nodes )
+		{
+			return std::any_of( nodes.begin()
+				, nodes.end()
+				, []( auto const & pipelinePair )
+				{
+					return std::any_of( pipelinePair.second.begin()
+						, pipelinePair.second.end()
+						, []( auto const & passPair )
+						{
+							return doHasNodes( passPair.second );
+						} );
+				} );
+		}
+	}
+
 	ShadowMapPass::ShadowMapPass( Engine & engine
 		, Scene & scene
 		, ShadowMap const & shadowMap )
@@ -22,10 +67,20 @@ namespace castor3d
 		, m_scene{ scene }
 		, m_shadowMap{ shadowMap }
 	{
+		m_onMaterialsChanged = scene.getChanges().onMaterialsChanged.connect( [this]( std::vector< Material const * > const & materials )
+			{
+				doOnMaterialsChanged( materials );
+			} );
+		m_onNodesChanged = scene.getChanges().onSceneNodesChanged.connect( [this]( std::vector< SceneNode const * > const & nodes )
+			{
+				m_changedNodes.insert( m_changedNodes.end(), nodes.begin(), nodes.end() );
+			} );
 	}
 
 	ShadowMapPass::~ShadowMapPass()
 	{
+		m_onNodesChanged.disconnect();
+		m_onMaterialsChanged.disconnect();
 	}
 
 	void ShadowMapPass::startTimer()
@@ -38,15 +93,184 @@ namespace castor3d
 		m_timer->stop();
 	}
 
+	void ShadowMapPass::updateCasters()
+	{
+		auto & nodes = m_renderQueue.getRenderNodes();
+		auto generation = m_renderQueue.getGeneration();
+
+		// The casters are only gathered again when the queue was rebuilt or the light volume changed,
+		// otherwise only the moved ones are tested.
+		if ( m_castersChanged
+			|| m_queueGeneration != generation )
+		{
+			m_queueGeneration = generation;
+			m_castersChanged = false;
+			doGatherCasters( nodes );
+		}
+
+		doUpdateChangedCasters();
+		m_changedNodes.clear();
+		m_hasDynamicCasters = doHasNodes( nodes.m_skinnedNodes.m_backCulled )
+			|| doHasInstantiatedNodes( nodes.m_instantiatedSkinnedNodes.m_backCulled )
+			|| doHasNodes( nodes.m_morphingNodes.m_backCulled )
+			|| doHasNodes( nodes.m_billboardNodes.m_backCulled );
+	}
+
 	void ShadowMapPass::doRenderNodes( SceneRenderNodes & nodes
-		, Camera const & camera )
+		, Camera const & camera
+		, ShadowCasters const & casters )
+	{
+		if ( checkFlag( casters, ShadowCaster::eStatic ) )
+		{
+			RenderPass::doRender( nodes.m_instantiatedStaticNodes.m_backCulled, camera );
+			RenderPass::doRender( nodes.m_staticNodes.m_backCulled, camera );
+		}
+
+		if ( checkFlag( casters, ShadowCaster::eDynamic ) )
+		{
+			RenderPass::doRender( nodes.m_skinnedNodes.m_backCulled, camera );
+			RenderPass::doRender( nodes.m_instantiatedSkinnedNodes.m_backCulled, camera );
+			RenderPass::doRender( nodes.m_morphingNodes.m_backCulled, camera );
+			RenderPass::doRender( nodes.m_billboardNodes.m_backCulled, camera );
+		}
+	}
+
+	void ShadowMapPass::doUpdateLight( Light const & light
+		, Matrix4x4r const & transform
+		, float farPlane )
+	{
+		if ( m_light != &light
+			|| m_lightFarPlane != farPlane
+			|| m_lightTransform != transform )
+		{
+			m_light = &light;
+			m_lightFarPlane = farPlane;
+			m_lightTransform = transform;
+			m_staticDirty = true;
+			m_castersChanged = true;
+		}
+	}
+
+	void ShadowMapPass::doGatherCasters( SceneRenderNodes & nodes )
+	{
+		m_candidates.clear();
+
+		for ( auto & pipelines : nodes.m_instantiatedStaticNodes.m_backCulled )
+		{
+			for ( auto & passes : pipelines.second )
+			{
+				for ( auto & submeshes : passes.second )
+				{
+					doAddCandidates( submeshes.second );
+				}
+			}
+		}
+
+		for ( auto & pipelines : nodes.m_staticNodes.m_backCulled )
+		{
+			doAddCandidates( pipelines.second );
+		}
+
+		std::sort( m_candidates.begin()
+			, m_candidates.end()
+			, []( StaticRenderNode const * lhs, StaticRenderNode const * rhs )
+			{
+				return &lhs->m_sceneNode < &rhs->m_sceneNode;
+			} );
+		m_currentCasters.clear();
+
+		for ( auto node : m_candidates )
+		{
+			if ( doIsInVolume( *node ) )
+			{
+				m_currentCasters.push_back( CasterState
+				{
+					&node->m_sceneNode,
+					&node->m_data,
+					&node->m_passNode.m_pass,
+				} );
+			}
+		}
+
+		// The same scene node appears once per submesh, sorting makes the comparison order independant.
+		std::sort( m_currentCasters.begin(), m_currentCasters.end() );
+
+		// A material swap changes the casters passes, the alpha test may then give another shadow.
+		if ( m_currentCasters != m_staticCasters )
+		{
+			m_staticDirty = true;
+			std::swap( m_staticCasters, m_currentCasters );
+		}
+	}
+
+	void ShadowMapPass::doAddCandidates( StaticRenderNodeArray const & nodes )
+	{
+		for ( auto & node : nodes )
+		{
+			m_candidates.push_back( &node );
+		}
+	}
+
+	void ShadowMapPass::doUpdateChangedCasters()
+	{
+		for ( auto sceneNode : m_changedNodes )
+		{
+			auto range = std::equal_range( m_candidates.begin()
+				, m_candidates.end()
+				, sceneNode
+				, []( auto const & lhs, auto const & rhs )
+				{
+					return doGetSceneNode( lhs ) < doGetSceneNode( rhs );
+				} );
+
+			for ( auto it = range.first; it != range.second; ++it )
+			{
+				auto & node = **it;
+				CasterState state
+				{
+					sceneNode,
+					&node.m_data,
+					&node.m_passNode.m_pass,
+				};
+				auto caster = std::lower_bound( m_staticCasters.begin()
+					, m_staticCasters.end()
+					, state );
+				bool wasInVolume = caster != m_staticCasters.end()
+					&& *caster == state;
+				bool isInVolume = doIsInVolume( node );
+
+				if ( isInVolume && !wasInVolume )
+				{
+					m_staticCasters.insert( caster, state );
+				}
+				else if ( wasInVolume && !isInVolume )
+				{
+					m_staticCasters.erase( caster );
+				}
+
+				m_staticDirty = m_staticDirty
+					|| isInVolume
+					|| wasInVolume;
+			}
+		}
+	}
+
+	void ShadowMapPass::doOnMaterialsChanged( std::vector< Material const * > const & materials )
 	{
-		RenderPass::doRender( nodes.m_instantiatedStaticNodes.m_backCulled, camera );
-		RenderPass::doRender( nodes.m_staticNodes.m_backCulled, camera );
-		RenderPass::doRender( nodes.m_skinnedNodes.m_backCulled, camera );
-		RenderPass::doRender( nodes.m_instantiatedSkinnedNodes.m_backCulled, camera );
-		RenderPass::doRender( nodes.m_morphingNodes.m_backCulled, camera );
-		RenderPass::doRender( nodes.m_billboardNodes.m_backCulled, camera );
+		if ( m_staticDirty )
+		{
+			return;
+		}
+
+		// The opacity, its map or the alpha function change which fragments are discarded.
+		m_staticDirty = std::any_of( m_staticCasters.begin()
+			, m_staticCasters.end()
+			, [&materials]( CasterState const & caster )
+			{
+				return std::find( materials.begin()
+					, materials.end()
+					, caster.m_pass->getOwner() ) != materials.end();
+			} );
 	}
 
 	void ShadowMapPass::doUpdateFlags( PassFlags & passFlags
@@ -63,46 +287,42 @@ namespace castor3d
 	void ShadowMapPass::doPreparePipeline( ShaderProgram & program
 		, PipelineFlags const & flags )
 	{
-		if ( m_backPipelines.find( flags ) == m_backPipelines.end() )
-		{
-			RasteriserState rsState;
-			rsState.setCulledFaces( Culling::eNone );
-			DepthStencilState dsState;
-			dsState.setDepthTest( true );
-			auto & pipeline = *m_backPipelines.emplace( flags
-				, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
-					, std::move( rsState )
-					, BlendState{}
-					, MultisampleState{}
-					, program
-					, flags ) ).first->second;
-
-			getEngine()->postEvent( makeFunctorEvent( EventType::ePreRender
-				, [this, &pipeline, flags]()
+		RasteriserState rsState;
+		rsState.setCulledFaces( Culling::eNone );
+		DepthStencilState dsState;
+		dsState.setDepthTest( true );
+		doPublishPipeline( m_backPipelines
+			, flags
+			, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
+				, std::move( rsState )
+				, BlendState{}
+				, MultisampleState{}
+				, program
+				, flags )
+			, [this, flags]( RenderPipeline & pipeline )
+			{
+				pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
+				pipeline.addUniformBuffer( m_modelUbo.getUbo() );
+				pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
+
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
 				{
-					pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
-					pipeline.addUniformBuffer( m_modelUbo.getUbo() );
-					pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
-					{
-						pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
-					}
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
-						&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
-					{
-						pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
-					}
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
-					{
-						pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
-					}
-
-					m_initialised = true;
-				} ) );
-		}
+					pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
+				}
+
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
+					&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
+				{
+					pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
+				}
+
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
+				{
+					pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
+				}
+
+				m_initialised = true;
+			} );
 	}
 
 	void ShadowMapPass::doUpdatePipeline( RenderPipeline & p_pipeline )const
@@ -112,7 +332,7 @@ namespace castor3d
 	void ShadowMapPass::doPrepareFrontPipeline( ShaderProgram & program
 		, PipelineFlags const & flags )
 	{
-		doPreparePipeline( program, flags );
+		// The back pipeline doesn't cull any face, it is prepared in doPrepareBackPipeline.
 	}
 
 	void ShadowMapPass::doPrepareBackPipeline( ShaderProgram & program
@@ -8,6 +8,7 @@ See LICENSE file in root folder
 #include "Render/RenderPass.hpp"
 #include "Render/Viewport.hpp"
 #include "Scene/Camera.hpp"
+#include "Scene/ChangeJournal.hpp"
 #include "Scene/Geometry.hpp"
 #include "Texture/TextureUnit.hpp"
 
@@ -87,11 +88,57 @@ namespace castor3d
 		 *\~english
 		 *\brief		Render function.
 		 *\param[in]	index	The render index.
+		 *\param[in]	casters	The casters layers to render.
 		 *\~french
 		 *\brief		Fonction de rendu.
 		 *\param[in]	index	L'indice du rendu.
+		 *\param[in]	casters	Les couches de projeteurs à dessiner.
 		 */
-		C3D_API virtual void render( uint32_t index = 0 ) = 0;
+		C3D_API virtual void render( uint32_t index = 0
+			, ShadowCasters const & casters = ShadowCaster::eAll ) = 0;
+		/**
+		 *\~english
+		 *\brief		Updates the casters state, from the render queue's nodes.
+		 *\remarks		To call once the render queue is updated, before the render.
+		 *				<br />The static layer becomes dirty if one of its casters was added, removed or moved.
+		 *\~french
+		 *\brief		Met à jour l'état des projeteurs, à partir des noeuds de la file de rendu.
+		 *\remarks		A appeler une fois la file de rendu mise à jour, avant le dessin.
+		 *				<br />La couche statique devient sale si un de ses projeteurs a été ajouté, supprimé ou déplacé.
+		 */
+		C3D_API void updateCasters();
+		/**
+		 *\~english
+		 *\brief		Tells the static layer has been redrawn.
+		 *\remarks		It stays dirty until the pass is initialised, since nothing is drawn before.
+		 *\~french
+		 *\brief		Dit que la couche statique a été redessinée.
+		 *\remarks		Elle reste sale jusqu'à ce que la passe soit initialisée, puisque rien n'est dessiné avant.
+		 */
+		inline void setStaticUpToDate()
+		{
+			m_staticDirty = !m_initialised;
+		}
+		/**
+		 *\~english
+		 *\return		\p true if the static layer needs to be redrawn.
+		 *\~french
+		 *\return		\p true si la couche statique doit être redessinée.
+		 */
+		inline bool isStaticDirty()const
+		{
+			return m_staticDirty;
+		}
+		/**
+		 *\~english
+		 *\return		\p true if the render queue holds dynamic casters.
+		 *\~french
+		 *\return		\p true si la file de rendu contient des projeteurs dynamiques.
+		 */
+		inline bool hasDynamicCasters()const
+		{
+			return m_hasDynamicCasters;
+		}
 
 	protected:
 		/**
@@ -99,13 +146,82 @@ namespace castor3d
 		 *\brief		Renders the given nodes.
 		 *\param		nodes	The nodes to render.
 		 *\param		camera	The viewing camera.
+		 *\param		casters	The casters layers to render.
 		 *\~french
 		 *\brief		Dessine les noeuds donnés.
 		 *\param		nodes	Les noeuds à dessiner.
 		 *\param		camera	La caméra regardant la scène.
+		 *\param		casters	Les couches de projeteurs à dessiner.
 		 */
 		void doRenderNodes( SceneRenderNodes & nodes
-			, Camera const & camera );
+			, Camera const & camera
+			, ShadowCasters const & casters );
+		/**
+		 *\~english
+		 *\brief		Checks if the light's projection changed since the last update.
+		 *\remarks		If it did, the static layer becomes dirty.
+		 *\param		light		The light source.
+		 *\param		transform	The matrix holding the light's projection (view and projection, or position).
+		 *\param		farPlane	The light's far plane.
+		 *\~french
+		 *\brief		Vérifie si la projection de la source lumineuse a changé depuis la dernière mise à jour.
+		 *\remarks		Si c'est le cas, la couche statique devient sale.
+		 *\param		light		La source lumineuse.
+		 *\param		transform	La matrice contenant la projection de la source (vue et projection, ou position).
+		 *\param		farPlane	Le plan lointain de la source.
+		 */
+		void doUpdateLight( Light const & light
+			, castor::Matrix4x4r const & transform
+			, float farPlane );
+
+	private:
+		/**
+		 *\~english
+		 *\brief		Tells if a static caster lies in the light volume.
+		 *\remarks		Only those casters are tracked to decide whether the static layer must be redrawn.
+		 *\param		node	The caster's render node.
+		 *\~french
+		 *\brief		Dit si un projeteur statique se trouve dans le volume de la source lumineuse.
+		 *\remarks		Seuls ces projeteurs sont suivis pour décider si la couche statique doit être redessinée.
+		 *\param		node	Le noeud de rendu du projeteur.
+		 */
+		virtual bool doIsInVolume( StaticRenderNode const & node )const = 0;
+		/**
+		 *\~english
+		 *\brief		Gathers the static casters from the render queue's nodes.
+		 *\param		nodes	The render queue's nodes.
+		 *\~french
+		 *\brief		Récupère les projeteurs statiques depuis les noeuds de la file de rendu.
+		 *\param		nodes	Les noeuds de la file de rendu.
+		 */
+		void doGatherCasters( SceneRenderNodes & nodes );
+		/**
+		 *\~english
+		 *\brief		Adds the static render nodes to the candidate casters list.
+		 *\param		nodes	The render nodes.
+		 *\~french
+		 *\brief		Ajoute les noeuds de rendu statiques à la liste des projeteurs candidats.
+		 *\param		nodes	Les noeuds de rendu.
+		 */
+		void doAddCandidates( StaticRenderNodeArray const & nodes );
+		/**
+		 *\~english
+		 *\brief		Tests the candidates attached to the changed scene nodes against the light volume.
+		 *\remarks		The static layer becomes dirty if one of them entered, left or moved in the volume.
+		 *\~french
+		 *\brief		Teste les candidats attachés aux noeuds de scène modifiés avec le volume de la source lumineuse.
+		 *\remarks		La couche statique devient sale si l'un d'eux est entré, sorti ou a bougé dans le volume.
+		 */
+		void doUpdateChangedCasters();
+		/**
+		 *\~english
+		 *\brief		Marks the static layer as dirty if one of its casters uses a changed material.
+		 *\param		materials	The changed materials.
+		 *\~french
+		 *\brief		Marque la couche statique comme sale si l'un de ses projeteurs utilise un matériau modifié.
+		 *\param		materials	Les matériaux modifiés.
+		 */
+		void doOnMaterialsChanged( std::vector< Material const * > const & materials );
 
 	private:
 		/**
@@ -194,6 +310,68 @@ namespace castor3d
 		//!\~english	Tells if the pass is initialised.
 		//!\~french		Dit si la passe est initialisée.
 		bool m_initialised{ false };
+
+	private:
+		struct CasterState
+		{
+			SceneNode const * m_node;
+			Submesh const * m_submesh;
+			Pass const * m_pass;
+
+			inline bool operator<( CasterState const & rhs )const
+			{
+				return m_node < rhs.m_node
+					|| ( m_node == rhs.m_node
+						&& ( m_submesh < rhs.m_submesh
+							|| ( m_submesh == rhs.m_submesh && m_pass < rhs.m_pass ) ) );
+			}
+
+			inline bool operator==( CasterState const & rhs )const
+			{
+				return m_node == rhs.m_node
+					&& m_submesh == rhs.m_submesh
+					&& m_pass == rhs.m_pass;
+			}
+		};
+		//!\~english	The light for which the static layer was rendered.
+		//!\~french		La source lumineuse pour laquelle la couche statique a été dessinée.
+		Light const * m_light{ nullptr };
+		//!\~english	The light's projection, when the static layer was rendered.
+		//!\~french		La projection de la source lumineuse, lorsque la couche statique a été dessinée.
+		castor::Matrix4x4r m_lightTransform;
+		//!\~english	The light's far plane, when the static layer was rendered.
+		//!\~french		Le plan lointain de la source lumineuse, lorsque la couche statique a été dessinée.
+		float m_lightFarPlane{ 0.0f };
+		//!\~english	The static casters in the light volume, sorted.
+		//!\~french		Les projeteurs statiques dans le volume de la source lumineuse, triés.
+		std::vector< CasterState > m_staticCasters;
+		//!\~english	The current static casters, kept to avoid reallocations.
+		//!\~french		Les projeteurs statiques courants, gardés pour éviter les réallocations.
+		std::vector< CasterState > m_currentCasters;
+		//!\~english	The render queue's static nodes, in or out of the light volume, sorted by scene node.
+		//!\~french		Les noeuds statiques de la file de rendu, dans le volume de la source lumineuse ou non, triés par noeud de scène.
+		std::vector< StaticRenderNode const * > m_candidates;
+		//!\~english	The scene nodes changed since the last casters update.
+		//!\~french		Les noeuds de scène modifiés depuis la dernière mise à jour des projeteurs.
+		std::vector< SceneNode const * > m_changedNodes;
+		//!\~english	The render queue's generation the candidates were gathered from.
+		//!\~french		La génération de la file de rendu depuis laquelle les candidats ont été récupérés.
+		uint32_t m_queueGeneration{ 0u };
+		//!\~english	Tells if the candidates must be gathered again, the light volume having changed.
+		//!\~french		Dit si les candidats doivent être récupérés à nouveau, le volume de la source lumineuse ayant changé.
+		bool m_castersChanged{ true };
+		//!\~english	Tells if the static layer needs to be redrawn.
+		//!\~french		Dit si la couche statique doit être redessinée.
+		bool m_staticDirty{ true };
+		//!\~english	Tells if the render queue holds dynamic casters.
+		//!\~french		Dit si la file de rendu contient des projeteurs dynamiques.
+		bool m_hasDynamicCasters{ false };
+		//!\~english	The connection to the scene's materials changes notification.
+		//!\~french		La connexion à la notification de changement des matériaux de la scène.
+		OnMaterialsChangedConnection m_onMaterialsChanged;
+		//!\~english	The connection to the scene nodes changed during the frame, from the scene changes journal.
+		//!\~french		La connexion aux noeuds de scène modifiés pendant la frame, depuis le journal des changements de la scène.
+		OnSceneNodesChangedConnection m_onNodesChanged;
 	};
 }
 
@@ -4,6 +4,7 @@
 #include "Texture/TextureImage.hpp"
 #include "Render/RenderPipeline.hpp"
 #include "Scene/Light/DirectionalLight.hpp"
+#include "Scene/SceneNode.hpp"
 
 #include <Graphics/Image.hpp>
 
@@ -16,34 +17,72 @@ namespace castor3d
 
 	ShadowMapPassDirectional::ShadowMapPassDirectional( Engine & engine
 		, Scene & scene
-		, ShadowMap const & shadowMap )
+		, ShadowMap const & shadowMap
+		, uint32_t cascade
+		, uint32_t cascades
+		, float splitLambda )
 		: ShadowMapPass{ engine, scene, shadowMap }
 		, m_shadowConfig{ ShadowMapUbo
 			, *engine.getRenderSystem()
 			, UboBindingPoint }
 		, m_farPlane{ *m_shadowConfig.createUniform< UniformType::eFloat >( FarPlane ) }
+		, m_cascade{ cascade }
+		, m_cascades{ std::max( 1u, cascades ) }
+		, m_splitLambda{ std::max( 0.0f, std::min( 1.0f, splitLambda ) ) }
 	{
+		REQUIRE( m_cascade < m_cascades );
 	}
 
 	ShadowMapPassDirectional::~ShadowMapPassDirectional()
 	{
 	}
 
+	float ShadowMapPassDirectional::getSplitDistance( float nearZ
+		, float farZ
+		, uint32_t split
+		, uint32_t cascades
+		, float lambda )
+	{
+		nearZ = std::max( nearZ, std::numeric_limits< float >::epsilon() );
+		farZ = std::max( farZ, nearZ );
+		auto ratio = float( split ) / float( std::max( 1u, cascades ) );
+		auto logarithmic = nearZ * std::pow( farZ / nearZ, ratio );
+		auto uniform = nearZ + ( farZ - nearZ ) * ratio;
+		return lambda * logarithmic + ( 1.0f - lambda ) * uniform;
+	}
+
 	void ShadowMapPassDirectional::update( Camera const & camera
 		, RenderQueueArray & queues
 		, Light & light
 		, uint32_t index )
 	{
-		light.updateShadow( light.getParent()->getDerivedPosition()
-			, m_camera->getViewport()
-			, index );
-		m_camera->attachTo( light.getParent() );
-		m_camera->update();
-		m_farPlane.setValue( light.getDirectionalLight()->getFarPlane() );
+		auto node = light.getParent();
+		node->update();
+		auto origin = node->getDerivedPosition();
+		auto const & orientation = node->getDerivedOrientation();
+		Point3r right{ 1.0_r, 0.0_r, 0.0_r };
+		Point3r up{ 0.0_r, 1.0_r, 0.0_r };
+		orientation.transform( right, right );
+		orientation.transform( up, up );
+		Point3r front{ point::cross( right, up ) };
+		up = point::cross( front, right );
+
+		Point3r position;
+		real nearZ;
+		real farZ;
+		auto radius = doFitCascade( camera, origin, right, up, front, position, nearZ, farZ );
+		m_camera->getViewport().setOrtho( -radius, radius, radius, -radius, nearZ, farZ );
+		m_camera->update( position, right, up );
+		m_transform = m_camera->getViewport().getProjection() * m_camera->getView();
+		m_farPlane.setValue( float( m_camera->getViewport().getFar() - m_camera->getViewport().getNear() ) );
+		doUpdateLight( light
+			, m_transform
+			, m_farPlane.getValue() );
 		doUpdate( queues );
 	}
 
-	void ShadowMapPassDirectional::render( uint32_t index )
+	void ShadowMapPassDirectional::render( uint32_t index
+		, ShadowCasters const & casters )
 	{
 		if ( m_camera && m_initialised )
 		{
@@ -52,22 +91,28 @@ namespace castor3d
 			m_camera->apply();
 			m_matrixUbo.update( m_camera->getView()
 				, m_camera->getViewport().getProjection() );
-			doRenderNodes( m_renderQueue.getRenderNodes(), *m_camera );
+			doRenderNodes( m_renderQueue.getRenderNodes(), *m_camera, casters );
 		}
 	}
 
 	bool ShadowMapPassDirectional::doInitialise( Size const & size )
 	{
+		// The cascades share the map, as tiles of a square grid.
+		uint32_t grid = m_cascades > 1u ? 2u : 1u;
+		m_tileSize = Size{ size.getWidth() / grid, size.getHeight() / grid };
+		m_tilePosition = Position{ int32_t( ( m_cascade % grid ) * m_tileSize.getWidth() )
+			, int32_t( ( m_cascade / grid ) * m_tileSize.getHeight() ) };
 		Viewport viewport{ *getEngine() };
-		real w = real( size.getWidth() );
-		real h = real( size.getHeight() );
+		real w = real( m_tileSize.getWidth() );
+		real h = real( m_tileSize.getHeight() );
 		viewport.setOrtho( -w / 2, w / 2, h / 2, -h / 2, -5120.0_r, 5120.0_r );
 		viewport.update();
-		m_camera = std::make_shared< Camera >( cuT( "ShadowMapDirectional" )
+		m_camera = std::make_shared< Camera >( cuT( "ShadowMapDirectional" ) + string::toString( m_cascade )
 			, m_scene
-			, m_scene.getCameraRootNode()
+			, nullptr
 			, std::move( viewport ) );
-		m_camera->resize( size );
+		m_camera->resize( m_tileSize );
+		m_camera->getViewport().setPosition( m_tilePosition );
 
 		m_renderQueue.initialise( m_scene, *m_camera );
 		return true;
@@ -76,7 +121,6 @@ namespace castor3d
 	void ShadowMapPassDirectional::doCleanup()
 	{
 		m_shadowConfig.cleanup();
-		m_camera->detach();
 		m_camera.reset();
 	}
 
@@ -85,49 +129,143 @@ namespace castor3d
 		queues.push_back( m_renderQueue );
 	}
 
-	void ShadowMapPassDirectional::doPreparePipeline( ShaderProgram & program
-		, PipelineFlags const & flags )
+	bool ShadowMapPassDirectional::doIsInVolume( StaticRenderNode const & node )const
 	{
-		if ( m_backPipelines.find( flags ) == m_backPipelines.end() )
+		return m_camera->isVisible( node.m_instance, node.m_data );
+	}
+
+	real ShadowMapPassDirectional::doFitCascade( Camera const & camera
+		, Point3r const & origin
+		, Point3r const & right
+		, Point3r const & up
+		, Point3r const & front
+		, Point3r & position
+		, real & nearZ
+		, real & farZ )const
+	{
+		auto const & viewport = camera.getViewport();
+		auto viewNear = float( viewport.getNear() );
+		auto viewFar = float( viewport.getFar() );
+		auto sliceNear = getSplitDistance( viewNear, viewFar, m_cascade, m_cascades, m_splitLambda );
+		auto sliceFar = getSplitDistance( viewNear, viewFar, m_cascade + 1u, m_cascades, m_splitLambda );
+
+		// The viewer's frustum slice corners, in world space.
+		Point3r eye;
+		Point3r eyeRight{ 1.0_r, 0.0_r, 0.0_r };
+		Point3r eyeUp{ 0.0_r, 1.0_r, 0.0_r };
+		auto node = camera.getParent();
+
+		if ( node )
 		{
-			RasteriserState rsState;
-			rsState.setCulledFaces( Culling::eNone );
-			DepthStencilState dsState;
-			dsState.setDepthTest( true );
-			auto & pipeline = *m_backPipelines.emplace( flags
-				, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
-					, std::move( rsState )
-					, BlendState{}
-					, MultisampleState{}
-					, program
-					, flags ) ).first->second;
-
-			getEngine()->postEvent( makeFunctorEvent( EventType::ePreRender
-				, [this, &pipeline, flags]()
+			eye = node->getDerivedPosition();
+			auto const & orientation = node->getDerivedOrientation();
+			orientation.transform( eyeRight, eyeRight );
+			orientation.transform( eyeUp, eyeUp );
+		}
+
+		Point3r eyeFront{ point::cross( eyeRight, eyeUp ) };
+		eyeUp = point::cross( eyeFront, eyeRight );
+		std::array< Point3r, 8u > corners;
+		uint32_t index = 0u;
+
+		for ( auto distance : { sliceNear, sliceFar } )
+		{
+			real halfWidth;
+			real halfHeight;
+
+			if ( viewport.getType() == ViewportType::eOrtho )
+			{
+				halfWidth = std::abs( viewport.getRight() - viewport.getLeft() ) / 2;
+				halfHeight = std::abs( viewport.getTop() - viewport.getBottom() ) / 2;
+			}
+			else
 			{
-				pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
-				pipeline.addUniformBuffer( m_modelUbo.getUbo() );
-				pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
-				pipeline.addUniformBuffer( m_shadowConfig );
+				halfHeight = real( ( viewport.getFovY() * 0.5_r ).tan() ) * distance;
+				halfWidth = halfHeight * viewport.getRatio();
+			}
 
-				if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
-				{
-					pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
-				}
+			auto centre = eye + eyeFront * real( distance );
 
-				if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
-					&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
+			for ( auto x : { -halfWidth, halfWidth } )
+			{
+				for ( auto y : { -halfHeight, halfHeight } )
 				{
-					pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
+					corners[index++] = centre + eyeRight * x + eyeUp * y;
 				}
+			}
+		}
 
-				if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
-				{
-					pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
-				}
+		// A bounding sphere keeps the cascade extent stable while the viewer rotates.
+		Point3r centre;
+
+		for ( auto & corner : corners )
+		{
+			centre += corner;
+		}
+
+		centre /= real( corners.size() );
+		real radius = 0.0_r;
 
-				m_initialised = true;
-			} ) );
+		for ( auto & corner : corners )
+		{
+			radius = std::max( radius, real( point::length( corner - centre ) ) );
 		}
+
+		radius = std::max( std::ceil( radius * 16.0_r ) / 16.0_r, 1.0_r / 16.0_r );
+
+		// Snap the cascade position to the map texels, in light space, to avoid shimmering edges.
+		auto texel = 2.0_r * radius / real( m_tileSize.getWidth() );
+		auto x = std::floor( point::dot( centre - origin, right ) / texel ) * texel;
+		auto y = std::floor( point::dot( centre - origin, up ) / texel ) * texel;
+		position = origin + right * x + up * y;
+
+		// The depth range encloses the bounding sphere, and reaches back to the casters lying between the light and the slice.
+		// It is snapped to whole units, so it doesn't change with each small move of the viewer.
+		auto depth = real( point::dot( centre - origin, front ) );
+		nearZ = std::floor( std::min( depth - radius, m_castersNear ) );
+		farZ = std::ceil( depth + radius );
+		return radius;
+	}
+
+	void ShadowMapPassDirectional::doPreparePipeline( ShaderProgram & program
+		, PipelineFlags const & flags )
+	{
+		RasteriserState rsState;
+		rsState.setCulledFaces( Culling::eNone );
+		DepthStencilState dsState;
+		dsState.setDepthTest( true );
+		doPublishPipeline( m_backPipelines
+			, flags
+			, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
+				, std::move( rsState )
+				, BlendState{}
+				, MultisampleState{}
+				, program
+				, flags )
+			, [this, flags]( RenderPipeline & pipeline )
+		{
+			pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
+			pipeline.addUniformBuffer( m_modelUbo.getUbo() );
+			pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
+			pipeline.addUniformBuffer( m_shadowConfig );
+
+			if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
+			{
+				pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
+			}
+
+			if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
+				&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
+			{
+				pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
+			}
+
+			if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
+			{
+				pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
+			}
+
+			m_initialised = true;
+			} );
 	}
 }
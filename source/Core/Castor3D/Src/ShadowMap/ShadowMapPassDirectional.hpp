@@ -13,9 +13,11 @@ namespace castor3d
 	\version	0.9.0
 	\date		30/08/2016
 	\~english
-	\brief		Shadow mapping implementation for spot lights.
+	\brief		Shadow mapping implementation for one cascade of a directional light.
+	\remarks	Each cascade has its own camera and render queue, so the queues are culled and built in parallel.
 	\~french
-	\brief		Implémentation du mappage d'ombres pour les lumières spot.
+	\brief		Implémentation du mappage d'ombres pour une cascade d'une lumière directionnelle.
+	\remarks	Chaque cascade a sa propre caméra et sa propre file de rendu, afin que les files soient filtrées et construites en parallèle.
 	*/
 	class ShadowMapPassDirectional
 		: public ShadowMapPass
@@ -27,15 +29,24 @@ namespace castor3d
 		 *\param[in]	engine		The engine.
 		 *\param[in]	scene		The scene.
 		 *\param[in]	shadowMap	The parent shadow map.
+		 *\param[in]	cascade		The cascade rendered by this pass.
+		 *\param[in]	cascades	The cascades count.
+		 *\param[in]	splitLambda	The blend between the uniform (0) and the logarithmic (1) cascades split schemes.
 		 *\~french
 		 *\brief		Constructeur.
 		 *\param[in]	engine		Le moteur.
 		 *\param[in]	scene		La scène.
 		 *\param[in]	shadowMap	La shadow map parente.
+		 *\param[in]	cascade		La cascade dessinée par cette passe.
+		 *\param[in]	cascades	Le nombre de cascades.
+		 *\param[in]	splitLambda	Le mélange entre les schémas de découpe uniforme (0) et logarithmique (1) des cascades.
 		 */
 		C3D_API ShadowMapPassDirectional( Engine & engine
 			, Scene & scene
-			, ShadowMap const & shadowMap );
+			, ShadowMap const & shadowMap
+			, uint32_t cascade = 0u
+			, uint32_t cascades = 1u
+			, float splitLambda = 0.75f );
 		/**
 		 *\~english
 		 *\brief		Destructor.
@@ -53,7 +64,8 @@ namespace castor3d
 		/**
 		 *\copydoc		castor3d::ShadowMapPass::render
 		 */
-		void render( uint32_t index )override;
+		void render( uint32_t index
+			, ShadowCasters const & casters )override;
 		/**
 		 *\~english
 		 *\return		The camera.
@@ -64,6 +76,85 @@ namespace castor3d
 		{
 			return m_camera;
 		}
+		/**
+		 *\~english
+		 *\return		The cascade's projection and view matrix.
+		 *\~french
+		 *\return		La matrice de projection et de vue de la cascade.
+		 */
+		inline castor::Matrix4x4r const & getTransform()const
+		{
+			return m_transform;
+		}
+		/**
+		 *\~english
+		 *\brief		Sets the distance from the light's plane to the nearest shadow caster, along the light direction.
+		 *\remarks		The cascade's near plane is pulled back to it, so the casters outside of the viewer's frustum still throw their shadows.
+		 *\param[in]	value	The distance.
+		 *\~french
+		 *\brief		Définit la distance entre le plan de la source lumineuse et la plus proche source d'ombres, le long de la direction de la lumière.
+		 *\remarks		Le plan proche de la cascade y est reculé, afin que les sources d'ombres hors du frustum de l'observateur projettent tout de même leurs ombres.
+		 *\param[in]	value	La distance.
+		 */
+		inline void setCastersNear( castor::real value )
+		{
+			m_castersNear = value;
+		}
+		/**
+		 *\~english
+		 *\return		The cascade's tile position, in the shadow map.
+		 *\~french
+		 *\return		La position de la tuile de la cascade, dans la shadow map.
+		 */
+		inline castor::Position const & getTilePosition()const
+		{
+			return m_tilePosition;
+		}
+		/**
+		 *\~english
+		 *\return		The cascade's tile dimensions, in the shadow map.
+		 *\~french
+		 *\return		Les dimensions de la tuile de la cascade, dans la shadow map.
+		 */
+		inline castor::Size const & getTileSize()const
+		{
+			return m_tileSize;
+		}
+		/**
+		 *\~english
+		 *\return		The cascade's depth range.
+		 *\~french
+		 *\return		L'intervalle de profondeur de la cascade.
+		 */
+		inline float getFarPlane()const
+		{
+			return m_farPlane.getValue();
+		}
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Computes a cascade split distance, blending the uniform and logarithmic schemes.
+		 *\param[in]	nearZ		The viewer's near plane.
+		 *\param[in]	farZ		The viewer's far plane.
+		 *\param[in]	split		The split index, from 0 (near plane) to cascades (far plane).
+		 *\param[in]	cascades	The cascades count.
+		 *\param[in]	lambda		The blend factor, 0 for uniform, 1 for logarithmic.
+		 *\return		The split distance.
+		 *\~french
+		 *\brief		Calcule une distance de découpe de cascade, en mélangeant les schémas uniforme et logarithmique.
+		 *\param[in]	nearZ		Le plan proche de l'observateur.
+		 *\param[in]	farZ		Le plan lointain de l'observateur.
+		 *\param[in]	split		L'indice de découpe, de 0 (plan proche) à cascades (plan lointain).
+		 *\param[in]	cascades	Le nombre de cascades.
+		 *\param[in]	lambda		Le facteur de mélange, 0 pour uniforme, 1 pour logarithmique.
+		 *\return		La distance de découpe.
+		 */
+		C3D_API static float getSplitDistance( float nearZ
+			, float farZ
+			, uint32_t split
+			, uint32_t cascades
+			, float lambda );
 
 	private:
 		/**
@@ -83,6 +174,42 @@ namespace castor3d
 		 */
 		void doPreparePipeline( ShaderProgram & p_program
 			, PipelineFlags const & p_flags )override;
+		/**
+		 *\copydoc		castor3d::ShadowMapPass::doIsInVolume
+		 */
+		bool doIsInVolume( StaticRenderNode const & node )const override;
+		/**
+		 *\~english
+		 *\brief		Fits the cascade to the viewer's frustum slice.
+		 *\param[in]	camera		The viewer camera.
+		 *\param[in]	origin		The light's position.
+		 *\param[in]	right		The light's X vector.
+		 *\param[in]	up			The light's Y vector.
+		 *\param[in]	front		The light's Z vector.
+		 *\param[out]	position	Receives the cascade's view position.
+		 *\param[out]	nearZ		Receives the cascade's near plane.
+		 *\param[out]	farZ		Receives the cascade's far plane.
+		 *\return		The cascade's half extent.
+		 *\~french
+		 *\brief		Ajuste la cascade à la tranche du frustum de l'observateur.
+		 *\param[in]	camera		La caméra de l'observateur.
+		 *\param[in]	origin		La position de la source lumineuse.
+		 *\param[in]	right		Le vecteur X de la source lumineuse.
+		 *\param[in]	up			Le vecteur Y de la source lumineuse.
+		 *\param[in]	front		Le vecteur Z de la source lumineuse.
+		 *\param[out]	position	Reçoit la position de la vue de la cascade.
+		 *\param[out]	nearZ		Reçoit le plan proche de la cascade.
+		 *\param[out]	farZ		Reçoit le plan lointain de la cascade.
+		 *\return		La demi étendue de la cascade.
+		 */
+		real doFitCascade( Camera const & camera
+			, castor::Point3r const & origin
+			, castor::Point3r const & right
+			, castor::Point3r const & up
+			, castor::Point3r const & front
+			, castor::Point3r & position
+			, castor::real & nearZ
+			, castor::real & farZ )const;
 
 	public:
 		static castor::String const ShadowMapUbo;
@@ -100,9 +227,27 @@ namespace castor3d
 		//!\~english	The variable holding the camera's far plane.
 		//!\~french		La variable contenant la position du plan éloigné de la caméra.
 		Uniform1f & m_farPlane;
-		//!\~english	The view matrix.
-		//!\~french		La matrice vue.
-		castor::Matrix4x4r m_view;
+		//!\~english	The cascade's projection and view matrix.
+		//!\~french		La matrice de projection et de vue de la cascade.
+		castor::Matrix4x4r m_transform;
+		//!\~english	The cascade rendered by this pass.
+		//!\~french		La cascade dessinée par cette passe.
+		uint32_t m_cascade;
+		//!\~english	The cascades count.
+		//!\~french		Le nombre de cascades.
+		uint32_t m_cascades;
+		//!\~english	The blend between the uniform and the logarithmic split schemes.
+		//!\~french		Le mélange entre les schémas de découpe uniforme et logarithmique.
+		float m_splitLambda;
+		//!\~english	The cascade's tile position, in the shadow map.
+		//!\~french		La position de la tuile de la cascade, dans la shadow map.
+		castor::Position m_tilePosition;
+		//!\~english	The cascade's tile dimensions, in the shadow map.
+		//!\~french		Les dimensions de la tuile de la cascade, dans la shadow map.
+		castor::Size m_tileSize;
+		//!\~english	The distance from the light's plane to the nearest shadow caster.
+		//!\~french		La distance entre le plan de la source lumineuse et la plus proche source d'ombres.
+		castor::real m_castersNear{ std::numeric_limits< castor::real >::max() };
 	};
 }
 
@@ -3,6 +3,8 @@
 #include "Mesh/Submesh.hpp"
 #include "Mesh/Buffer/VertexBuffer.hpp"
 #include "Render/RenderPipeline.hpp"
+#include "Render/RenderNode/StaticRenderNode.hpp"
+#include "Scene/Geometry.hpp"
 #include "Scene/Light/PointLight.hpp"
 #include "Shader/ShaderProgram.hpp"
 #include "Texture/TextureImage.hpp"
@@ -66,10 +68,16 @@ namespace castor3d
 		doUpdateShadowMatrices( position, m_matrices );
 		m_worldLightPosition.setValue( position );
 		m_farPlane.setValue( m_viewport.getFar() );
+		Matrix4x4r translate{ 1.0_r };
+		matrix::setTranslate( translate, position );
+		doUpdateLight( light
+			, translate
+			, m_farPlane.getValue() );
 		doUpdate( queues );
 	}
 
-	void ShadowMapPassPoint::render( uint32_t index )
+	void ShadowMapPassPoint::render( uint32_t index
+		, ShadowCasters const & casters )
 	{
 		if ( m_initialised )
 		{
@@ -77,18 +85,39 @@ namespace castor3d
 			m_shadowConfig.bindTo( UboBindingPoint );
 			m_viewport.apply();
 			m_matrixUbo.update( m_matrices[index], m_projection );
-			doRenderNodes( m_renderQueue.getRenderNodes() );
+			doRenderNodes( m_renderQueue.getRenderNodes(), casters );
 		}
 	}
 
-	void ShadowMapPassPoint::doRenderNodes( SceneRenderNodes & p_nodes )
+	void ShadowMapPassPoint::doRenderNodes( SceneRenderNodes & nodes
+		, ShadowCasters const & casters )
 	{
-		RenderPass::doRender( p_nodes.m_instantiatedStaticNodes.m_backCulled );
-		RenderPass::doRender( p_nodes.m_staticNodes.m_backCulled );
-		RenderPass::doRender( p_nodes.m_skinnedNodes.m_backCulled );
-		RenderPass::doRender( p_nodes.m_instantiatedSkinnedNodes.m_backCulled );
-		RenderPass::doRender( p_nodes.m_morphingNodes.m_backCulled );
-		RenderPass::doRender( p_nodes.m_billboardNodes.m_backCulled );
+		if ( checkFlag( casters, ShadowCaster::eStatic ) )
+		{
+			RenderPass::doRender( nodes.m_instantiatedStaticNodes.m_backCulled );
+			RenderPass::doRender( nodes.m_staticNodes.m_backCulled );
+		}
+
+		if ( checkFlag( casters, ShadowCaster::eDynamic ) )
+		{
+			RenderPass::doRender( nodes.m_skinnedNodes.m_backCulled );
+			RenderPass::doRender( nodes.m_instantiatedSkinnedNodes.m_backCulled );
+			RenderPass::doRender( nodes.m_morphingNodes.m_backCulled );
+			RenderPass::doRender( nodes.m_billboardNodes.m_backCulled );
+		}
+	}
+
+	bool ShadowMapPassPoint::doIsInVolume( StaticRenderNode const & node )const
+	{
+		// The point light's queue is not culled, so the casters out of the light range are ignored here.
+		auto & sphere = node.m_instance.getBoundingSphere( node.m_data );
+		auto & center = sphere.getCenter();
+		auto scale = node.m_sceneNode.getDerivedScale();
+		auto position = node.m_sceneNode.getDerivedTransformationMatrix() * Point4r{ center[0], center[1], center[2], 1.0_r };
+		auto radius = sphere.getRadius() * std::max( std::abs( scale[0] ), std::max( std::abs( scale[1] ), std::abs( scale[2] ) ) );
+		auto range = radius + m_farPlane.getValue();
+		return point::distanceSquared( Point3r{ position[0], position[1], position[2] }
+			, Point3r{ m_worldLightPosition.getValue() } ) <= range * range;
 	}
 
 	bool ShadowMapPassPoint::doInitialise( Size const & p_size )
@@ -119,46 +148,42 @@ namespace castor3d
 	void ShadowMapPassPoint::doPreparePipeline( ShaderProgram & program
 		, PipelineFlags const & flags )
 	{
-		if ( m_backPipelines.find( flags ) == m_backPipelines.end() )
-		{
-			RasteriserState rsState;
-			rsState.setCulledFaces( Culling::eNone );
-			DepthStencilState dsState;
-			dsState.setDepthTest( true );
-			auto & pipeline = *m_backPipelines.emplace( flags
-				, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
-					, std::move( rsState )
-					, BlendState{}
-					, MultisampleState{}
-					, program
-					, flags ) ).first->second;
-
-			getEngine()->postEvent( makeFunctorEvent( EventType::ePreRender
-				, [this, &pipeline, flags]()
+		RasteriserState rsState;
+		rsState.setCulledFaces( Culling::eNone );
+		DepthStencilState dsState;
+		dsState.setDepthTest( true );
+		doPublishPipeline( m_backPipelines
+			, flags
+			, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
+				, std::move( rsState )
+				, BlendState{}
+				, MultisampleState{}
+				, program
+				, flags )
+			, [this, flags]( RenderPipeline & pipeline )
+			{
+				pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
+				pipeline.addUniformBuffer( m_modelUbo.getUbo() );
+				pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
+				pipeline.addUniformBuffer( m_shadowConfig );
+
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
 				{
-					pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
-					pipeline.addUniformBuffer( m_modelUbo.getUbo() );
-					pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
-					pipeline.addUniformBuffer( m_shadowConfig );
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
-					{
-						pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
-					}
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
-						&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
-					{
-						pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
-					}
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
-					{
-						pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
-					}
-
-					m_initialised = true;
-				} ) );
-		}
+					pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
+				}
+
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
+					&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
+				{
+					pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
+				}
+
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
+				{
+					pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
+				}
+
+				m_initialised = true;
+			} );
 	}
 }
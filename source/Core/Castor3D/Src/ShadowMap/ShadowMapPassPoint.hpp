@@ -54,10 +54,22 @@ namespace castor3d
 		/**
 		 *\copydoc		castor3d::ShadowMapPass::render
 		 */
-		void render( uint32_t index )override;
+		void render( uint32_t index
+			, ShadowCasters const & casters )override;
 
 	protected:
-		void doRenderNodes( SceneRenderNodes & p_nodes );
+		/**
+		 *\~english
+		 *\brief		Renders the given nodes.
+		 *\param		nodes	The nodes to render.
+		 *\param		casters	The casters layers to render.
+		 *\~french
+		 *\brief		Dessine les noeuds donnés.
+		 *\param		nodes	Les noeuds à dessiner.
+		 *\param		casters	Les couches de projeteurs à dessiner.
+		 */
+		void doRenderNodes( SceneRenderNodes & nodes
+			, ShadowCasters const & casters );
 
 	private:
 		/**
@@ -77,6 +89,10 @@ namespace castor3d
 		 */
 		void doPreparePipeline( ShaderProgram & p_program
 			, PipelineFlags const & p_flags )override;
+		/**
+		 *\copydoc		castor3d::ShadowMapPass::doIsInVolume
+		 */
+		bool doIsInVolume( StaticRenderNode const & node )const override;
 
 	public:
 		static castor::String const ShadowMapUbo;
@@ -36,10 +36,14 @@ namespace castor3d
 		m_camera->attachTo( light.getParent() );
 		m_camera->update();
 		m_farPlane.setValue( light.getSpotLight()->getFarPlane() );
+		doUpdateLight( light
+			, m_camera->getViewport().getProjection() * m_camera->getView()
+			, m_farPlane.getValue() );
 		queues.emplace_back( m_renderQueue );
 	}
 
-	void ShadowMapPassSpot::render( uint32_t index )
+	void ShadowMapPassSpot::render( uint32_t index
+		, ShadowCasters const & casters )
 	{
 		if ( m_camera && m_initialised )
 		{
@@ -48,7 +52,7 @@ namespace castor3d
 			m_camera->apply();
 			m_matrixUbo.update( m_camera->getView()
 				, m_camera->getViewport().getProjection() );
-			doRenderNodes( m_renderQueue.getRenderNodes(), *m_camera );
+			doRenderNodes( m_renderQueue.getRenderNodes(), *m_camera, casters );
 		}
 	}
 
@@ -77,49 +81,50 @@ namespace castor3d
 		queues.emplace_back( m_renderQueue );
 	}
 
+	bool ShadowMapPassSpot::doIsInVolume( StaticRenderNode const & node )const
+	{
+		return m_camera->isVisible( node.m_instance, node.m_data );
+	}
+
 	void ShadowMapPassSpot::doPreparePipeline( ShaderProgram & program
 		, PipelineFlags const & flags )
 	{
-		if ( m_backPipelines.find( flags ) == m_backPipelines.end() )
+		RasteriserState rsState;
+		rsState.setCulledFaces( Culling::eNone );
+		DepthStencilState dsState;
+		dsState.setDepthTest( true );
+		doPublishPipeline( m_backPipelines
+			, flags
+			, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
+				, std::move( rsState )
+				, BlendState{}
+				, MultisampleState{}
+				, program
+				, flags )
+			, [this, flags]( RenderPipeline & pipeline )
 		{
-			RasteriserState rsState;
-			rsState.setCulledFaces( Culling::eNone );
-			DepthStencilState dsState;
-			dsState.setDepthTest( true );
-			auto & pipeline = *m_backPipelines.emplace( flags
-				, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
-					, std::move( rsState )
-					, BlendState{}
-					, MultisampleState{}
-					, program
-					, flags ) ).first->second;
-
-			getEngine()->postEvent( makeFunctorEvent( EventType::ePreRender
-				, [this, &pipeline, flags]()
+			pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
+			pipeline.addUniformBuffer( m_modelUbo.getUbo() );
+			pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
+			pipeline.addUniformBuffer( m_shadowConfig );
+
+			if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
 			{
-				pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
-				pipeline.addUniformBuffer( m_modelUbo.getUbo() );
-				pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
-				pipeline.addUniformBuffer( m_shadowConfig );
-
-				if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
-				{
-					pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
-				}
-
-				if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
-					&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
-				{
-					pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
-				}
-
-				if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
-				{
-					pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
-				}
-
-				m_initialised = true;
-			} ) );
-		}
+				pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
+			}
+
+			if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
+				&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
+			{
+				pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
+			}
+
+			if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
+			{
+				pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
+			}
+
+			m_initialised = true;
+			} );
 	}
 }
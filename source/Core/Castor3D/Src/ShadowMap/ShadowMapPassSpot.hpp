@@ -53,7 +53,8 @@ namespace castor3d
 		/**
 		 *\copydoc		castor3d::ShadowMapPass::render
 		 */
-		void render( uint32_t index )override;
+		void render( uint32_t index
+			, ShadowCasters const & casters )override;
 		/**
 		 *\~english
 		 *\return		The camera.
@@ -83,6 +84,10 @@ namespace castor3d
 		 */
 		void doPreparePipeline( ShaderProgram & p_program
 			, PipelineFlags const & p_flags )override;
+		/**
+		 *\copydoc		castor3d::ShadowMapPass::doIsInVolume
+		 */
+		bool doIsInVolume( StaticRenderNode const & node )const override;
 
 	public:
 		static castor::String const ShadowMapUbo;
@@ -111,11 +111,13 @@ namespace castor3d
 	}
 
 	ShadowMapPoint::ShadowMapPoint( Engine & engine
-		, Scene & scene )
+		, Scene & scene
+		, uint32_t facesBudget )
 		: ShadowMap{ engine
 			, doInitialisePointShadow( engine, Size{ ShadowMapPassPoint::TextureSize, ShadowMapPassPoint::TextureSize } )
 			, doInitialisePointDepth( engine, Size{ ShadowMapPassPoint::TextureSize, ShadowMapPassPoint::TextureSize } )
 			, std::make_shared< ShadowMapPassPoint >( engine, scene, *this ) }
+		, m_facesBudget{ std::max( 1u, std::min( facesBudget, uint32_t( CubeMapFace::eCount ) ) ) }
 	{
 	}
 
@@ -133,21 +135,49 @@ namespace castor3d
 
 	void ShadowMapPoint::render()
 	{
-		m_pass->startTimer();
+		static uint32_t constexpr FacesCount = uint32_t( CubeMapFace::eCount );
+		static uint32_t constexpr AllFaces = ( 1u << FacesCount ) - 1u;
+		m_pass->updateCasters();
 
-		for ( uint32_t face = 0u; face < 6u; ++face )
+		// The faces are not split in static and dynamic layers, any change dirties them all,
+		// and they are then redrawn round-robin, within the budget.
+		if ( m_pass->isStaticDirty() || m_pass->hasDynamicCasters() )
 		{
-			m_frameBuffer->bind( FrameBufferTarget::eDraw );
-			m_colourAttach[face]->attach( AttachmentPoint::eColour, 0u );
-			m_linearAttach[face]->attach( AttachmentPoint::eColour, 1u );
-			REQUIRE( m_frameBuffer->isComplete() );
-			m_frameBuffer->setDrawBuffers( { m_colourAttach[face], m_linearAttach[face] } );
-			m_frameBuffer->clear( BufferComponent::eDepth | BufferComponent::eColour );
-			m_pass->render( face );
-			m_frameBuffer->unbind();
+			m_dirtyFaces = AllFaces;
+			m_pass->setStaticUpToDate();
 		}
 
-		m_pass->stopTimer();
+		m_renderedPasses = 0u;
+
+		if ( m_dirtyFaces )
+		{
+			m_pass->startTimer();
+			auto start = m_nextFace;
+
+			for ( uint32_t i = 0u; i < FacesCount && m_renderedPasses < m_facesBudget; ++i )
+			{
+				auto face = ( start + i ) % FacesCount;
+
+				if ( m_dirtyFaces & ( 1u << face ) )
+				{
+					m_frameBuffer->bind( FrameBufferTarget::eDraw );
+					m_colourAttach[face]->attach( AttachmentPoint::eColour, 0u );
+					m_linearAttach[face]->attach( AttachmentPoint::eColour, 1u );
+					REQUIRE( m_frameBuffer->isComplete() );
+					m_frameBuffer->setDrawBuffers( { m_colourAttach[face], m_linearAttach[face] } );
+					m_frameBuffer->clear( BufferComponent::eDepth | BufferComponent::eColour );
+					m_pass->render( face );
+					m_frameBuffer->unbind();
+					m_dirtyFaces &= ~( 1u << face );
+					m_nextFace = ( face + 1u ) % FacesCount;
+					++m_renderedPasses;
+				}
+			}
+
+			m_pass->stopTimer();
+		}
+
+		m_skippedPasses = FacesCount - m_renderedPasses;
 	}
 
 	void ShadowMapPoint::debugDisplay( castor::Size const & size, uint32_t index )
@@ -25,15 +25,18 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Constructor.
-		 *\param[in]	engine	The engine.
-		 *\param[in]	scene	The scene.
+		 *\param[in]	engine		The engine.
+		 *\param[in]	scene		The scene.
+		 *\param[in]	facesBudget	The maximum number of cube faces rendered per frame.
 		 *\~french
 		 *\brief		Constructeur.
-		 *\param[in]	engine	Le moteur.
-		 *\param[in]	scene	La scène.
+		 *\param[in]	engine		Le moteur.
+		 *\param[in]	scene		La scène.
+		 *\param[in]	facesBudget	Le nombre maximal de faces du cube dessinées par frame.
 		 */
 		ShadowMapPoint( Engine & engine
-			, Scene & scene );
+			, Scene & scene
+			, uint32_t facesBudget = uint32_t( CubeMapFace::eCount ) );
 		/**
 		 *\~english
 		 *\brief		Destructor.
@@ -110,6 +113,15 @@ namespace castor3d
 		//!\~english	The attach between colour buffer and main frame buffer.
 		//!\~french		L'attache entre le tampon de couleur et le tampon principal.
 		CubeAttachment m_colourAttach;
+		//!\~english	The maximum number of cube faces rendered per frame.
+		//!\~french		Le nombre maximal de faces du cube dessinées par frame.
+		uint32_t m_facesBudget;
+		//!\~english	The faces needing to be redrawn, one bit per face.
+		//!\~french		Les faces devant être redessinées, un bit par face.
+		uint32_t m_dirtyFaces{ 0u };
+		//!\~english	The face from which the next render starts, for the round-robin update.
+		//!\~french		La face à partir de laquelle le prochain dessin commence, pour la mise à jour tournante.
+		uint32_t m_nextFace{ 0u };
 	};
 }
 
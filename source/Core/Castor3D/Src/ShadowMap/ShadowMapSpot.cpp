@@ -110,6 +110,7 @@ namespace castor3d
 			, doInitialiseVariance( engine, Size{ ShadowMapPassSpot::TextureSize, ShadowMapPassSpot::TextureSize } )
 			, doInitialiseLinearDepth( engine, Size{ ShadowMapPassSpot::TextureSize, ShadowMapPassSpot::TextureSize } )
 			, std::make_shared< ShadowMapPassSpot >( engine, scene, *this ) }
+		, m_staticLayer{ engine }
 	{
 	}
 
@@ -127,14 +128,42 @@ namespace castor3d
 
 	void ShadowMapSpot::render()
 	{
+		m_pass->updateCasters();
+		auto renderStatic = m_pass->isStaticDirty();
+		auto renderDynamic = m_pass->hasDynamicCasters();
+
+		// Without dynamic casters, now or in the previous render, the map is still valid.
+		if ( !renderStatic && !renderDynamic && !m_hasDynamicCasters )
+		{
+			m_renderedPasses = 0u;
+			m_skippedPasses = 1u;
+			return;
+		}
+
 		m_pass->startTimer();
-		m_frameBuffer->bind( FrameBufferTarget::eDraw );
-		m_frameBuffer->clear( BufferComponent::eDepth | BufferComponent::eColour );
-		m_pass->render();
-		m_frameBuffer->unbind();
+
+		if ( renderStatic )
+		{
+			m_staticLayer.bind();
+			m_pass->render( 0u, ShadowCaster::eStatic );
+			m_staticLayer.unbind();
+			m_pass->setStaticUpToDate();
+		}
+
+		m_staticLayer.copyTo( *m_frameBuffer, { m_varianceAttach, m_linearAttach } );
+
+		if ( renderDynamic )
+		{
+			m_frameBuffer->bind( FrameBufferTarget::eDraw );
+			m_pass->render( 0u, ShadowCaster::eDynamic );
+			m_frameBuffer->unbind();
+		}
 
 		m_blur->blur( m_shadowMap.getTexture() );
 		m_pass->stopTimer();
+		m_hasDynamicCasters = renderDynamic;
+		m_renderedPasses = 1u;
+		m_skippedPasses = 0u;
 	}
 
 	void ShadowMapSpot::debugDisplay( castor::Size const & size, uint32_t index )
@@ -173,10 +202,15 @@ namespace castor3d
 			, m_shadowMap.getTexture()->getDimensions()
 			, m_shadowMap.getTexture()->getPixelFormat()
 			, 5u );
+		m_staticLayer.initialise( m_shadowMap.getTexture()->getDimensions()
+			, PixelFormat::eD24
+			, { PixelFormat::eAL32F, PixelFormat::eL32F }
+			, RgbaColour::fromPredefined( PredefinedRgbaColour::eOpaqueBlack ) );
 	}
 
 	void ShadowMapSpot::doCleanup()
 	{
+		m_staticLayer.cleanup();
 		m_blur.reset();
 		m_depthAttach.reset();
 		m_linearAttach.reset();
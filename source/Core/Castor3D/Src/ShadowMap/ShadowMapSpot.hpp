@@ -6,6 +6,7 @@ See LICENSE file in root folder
 
 #include "Miscellaneous/GaussianBlur.hpp"
 #include "ShadowMap/ShadowMap.hpp"
+#include "ShadowMap/ShadowMapStaticLayer.hpp"
 
 namespace castor3d
 {
@@ -98,6 +99,12 @@ namespace castor3d
 		//!\~english	The Gaussian blur pass.
 		//!\~french		La passe de flou Gaussien.
 		std::unique_ptr< GaussianBlur > m_blur;
+		//!\~english	The static casters layer.
+		//!\~french		La couche des projeteurs statiques.
+		ShadowMapStaticLayer m_staticLayer;
+		//!\~english	Tells if the map holds dynamic casters, from the previous render.
+		//!\~french		Dit si la texture contient des projeteurs dynamiques, depuis le dessin précédent.
+		bool m_hasDynamicCasters{ false };
 	};
 }
 
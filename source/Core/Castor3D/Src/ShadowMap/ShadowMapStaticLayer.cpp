@@ -0,0 +1,157 @@
+#include "ShadowMapStaticLayer.hpp"
+
+#include "Engine.hpp"
+
+#include "FrameBuffer/DepthStencilRenderBuffer.hpp"
+#include "FrameBuffer/FrameBuffer.hpp"
+#include "FrameBuffer/RenderBufferAttachment.hpp"
+#include "FrameBuffer/TextureAttachment.hpp"
+#include "Render/RenderSystem.hpp"
+#include "Texture/TextureImage.hpp"
+#include "Texture/TextureLayout.hpp"
+
+using namespace castor;
+
+namespace castor3d
+{
+	ShadowMapStaticLayer::ShadowMapStaticLayer( Engine & engine )
+		: OwnedBy< Engine >{ engine }
+	{
+	}
+
+	ShadowMapStaticLayer::~ShadowMapStaticLayer()
+	{
+	}
+
+	bool ShadowMapStaticLayer::initialise( Size const & size
+		, PixelFormat depthFormat
+		, std::vector< PixelFormat > const & colourFormats
+		, RgbaColour const & clearColour )
+	{
+		auto & renderSystem = *getEngine()->getRenderSystem();
+		m_size = size;
+		m_frameBuffer = renderSystem.createFrameBuffer();
+		bool result = m_frameBuffer->initialise();
+
+		if ( result )
+		{
+			m_frameBuffer->setClearColour( clearColour );
+			m_depthBuffer = m_frameBuffer->createDepthStencilRenderBuffer( depthFormat );
+			m_depthBuffer->create();
+			m_depthBuffer->initialise( size );
+			m_depthAttach = m_frameBuffer->createAttachment( m_depthBuffer );
+
+			for ( auto format : colourFormats )
+			{
+				auto texture = renderSystem.createTexture( TextureType::eTwoDimensions
+					, AccessType::eNone
+					, AccessType::eRead | AccessType::eWrite
+					, format
+					, size );
+				texture->getImage().initialiseSource();
+				texture->initialise();
+				m_colourAttaches.push_back( m_frameBuffer->createAttachment( texture ) );
+				m_colours.push_back( texture );
+			}
+
+			m_frameBuffer->bind();
+			m_frameBuffer->attach( AttachmentPoint::eDepth, m_depthAttach );
+			uint8_t index = 0u;
+
+			for ( auto & attach : m_colourAttaches )
+			{
+				m_frameBuffer->attach( AttachmentPoint::eColour
+					, index++
+					, attach
+					, TextureType::eTwoDimensions );
+			}
+
+			ENSURE( m_frameBuffer->isComplete() );
+			m_frameBuffer->setDrawBuffers();
+			m_frameBuffer->unbind();
+		}
+
+		return result;
+	}
+
+	void ShadowMapStaticLayer::cleanup()
+	{
+		if ( m_frameBuffer )
+		{
+			m_frameBuffer->bind();
+			m_frameBuffer->detachAll();
+			m_frameBuffer->unbind();
+			m_frameBuffer->cleanup();
+			m_frameBuffer.reset();
+		}
+
+		m_colourAttaches.clear();
+
+		for ( auto & texture : m_colours )
+		{
+			texture->cleanup();
+		}
+
+		m_colours.clear();
+		m_depthAttach.reset();
+
+		if ( m_depthBuffer )
+		{
+			m_depthBuffer->cleanup();
+			m_depthBuffer->destroy();
+			m_depthBuffer.reset();
+		}
+	}
+
+	void ShadowMapStaticLayer::bind()const
+	{
+		m_frameBuffer->bind( FrameBufferTarget::eDraw );
+		m_frameBuffer->clear( BufferComponent::eDepth | BufferComponent::eColour );
+	}
+
+	void ShadowMapStaticLayer::unbind()const
+	{
+		m_frameBuffer->unbind();
+	}
+
+	void ShadowMapStaticLayer::copyTo( FrameBuffer const & target
+		, std::vector< FrameBufferAttachmentSPtr > const & colourAttaches
+		, Position const & position )const
+	{
+		REQUIRE( colourAttaches.size() == m_colourAttaches.size() );
+		Rectangle const rect{ Position{}, m_size };
+		Rectangle const targetRect{ position, m_size };
+		BufferComponents components = BufferComponent::eDepth;
+		uint8_t index = 0u;
+
+		// A blit copies the read buffer into all the draw buffers, so each colour attachment is copied on its own.
+		for ( auto & attach : colourAttaches )
+		{
+			m_frameBuffer->bind( FrameBufferTarget::eRead );
+			m_frameBuffer->setReadBuffer( AttachmentPoint::eColour, index++ );
+			m_frameBuffer->unbind();
+			target.bind( FrameBufferTarget::eDraw );
+			target.setDrawBuffer( attach );
+			target.unbind();
+			m_frameBuffer->stretchInto( target
+				, rect
+				, targetRect
+				, components | BufferComponent::eColour
+				, InterpolationMode::eNearest );
+			components = BufferComponents{};
+		}
+
+		if ( colourAttaches.empty() )
+		{
+			m_frameBuffer->stretchInto( target
+				, rect
+				, targetRect
+				, components
+				, InterpolationMode::eNearest );
+		}
+
+		target.bind( FrameBufferTarget::eDraw );
+		target.setDrawBuffers();
+		target.unbind();
+	}
+}
@@ -0,0 +1,126 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_ShadowMapStaticLayer_H___
+#define ___C3D_ShadowMapStaticLayer_H___
+
+#include "Castor3DPrerequisites.hpp"
+
+#include <Design/OwnedBy.hpp>
+#include <Graphics/Colour.hpp>
+#include <Graphics/Position.hpp>
+#include <Graphics/Size.hpp>
+
+namespace castor3d
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/12/2017
+	\~english
+	\brief		Holds the static casters render of a shadow map, kept between frames.
+	\remarks	Its attachments mirror the shadow map's frame buffer ones, so it can be copied into it,
+				before the dynamic casters are drawn on top.
+	\~french
+	\brief		Contient le dessin des projeteurs statiques d'une shadow map, gardé entre les frames.
+	\remarks	Ses attaches reflètent celles du tampon d'image de la shadow map, afin de pouvoir y être copié,
+				avant que les projeteurs dynamiques ne soient dessinés par dessus.
+	*/
+	class ShadowMapStaticLayer
+		: public castor::OwnedBy< Engine >
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	engine	The engine.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	engine	Le moteur.
+		 */
+		C3D_API explicit ShadowMapStaticLayer( Engine & engine );
+		/**
+		 *\~english
+		 *\brief		Destructor.
+		 *\~french
+		 *\brief		Destructeur.
+		 */
+		C3D_API ~ShadowMapStaticLayer();
+		/**
+		 *\~english
+		 *\brief		Initialises the frame buffer and its attachments.
+		 *\param[in]	size			The layer dimensions.
+		 *\param[in]	depthFormat		The depth buffer pixel format.
+		 *\param[in]	colourFormats	The colour attachments pixel formats, in attachment index order.
+		 *\param[in]	clearColour		The colour used to clear the layer.
+		 *\~french
+		 *\brief		Initialise le tampon d'image et ses attaches.
+		 *\param[in]	size			Les dimensions de la couche.
+		 *\param[in]	depthFormat		Le format des pixels du tampon de profondeur.
+		 *\param[in]	colourFormats	Les formats des pixels des attaches de couleur, dans l'ordre des indices d'attache.
+		 *\param[in]	clearColour		La couleur utilisée pour vider la couche.
+		 */
+		C3D_API bool initialise( castor::Size const & size
+			, castor::PixelFormat depthFormat
+			, std::vector< castor::PixelFormat > const & colourFormats
+			, castor::RgbaColour const & clearColour );
+		/**
+		 *\~english
+		 *\brief		Cleans up the frame buffer and its attachments.
+		 *\~french
+		 *\brief		Nettoie le tampon d'image et ses attaches.
+		 */
+		C3D_API void cleanup();
+		/**
+		 *\~english
+		 *\brief		Binds and clears the layer, before the static casters render.
+		 *\~french
+		 *\brief		Active et vide la couche, avant le dessin des projeteurs statiques.
+		 */
+		C3D_API void bind()const;
+		/**
+		 *\~english
+		 *\brief		Unbinds the layer, after the static casters render.
+		 *\~french
+		 *\brief		Désactive la couche, après le dessin des projeteurs statiques.
+		 */
+		C3D_API void unbind()const;
+		/**
+		 *\~english
+		 *\brief		Copies the layer into the given frame buffer.
+		 *\param[in]	target			The frame buffer receiving the layer.
+		 *\param[in]	colourAttaches	The target's colour attachments, matching the layer's colour formats.
+		 *\param[in]	position		The layer's position in the target, used when the layer is a tile of it.
+		 *\~french
+		 *\brief		Copie la couche dans le tampon d'image donné.
+		 *\param[in]	target			Le tampon d'image recevant la couche.
+		 *\param[in]	colourAttaches	Les attaches de couleur de la cible, correspondant aux formats de couleur de la couche.
+		 *\param[in]	position		La position de la couche dans la cible, utilisée lorsque la couche en est une tuile.
+		 */
+		C3D_API void copyTo( FrameBuffer const & target
+			, std::vector< FrameBufferAttachmentSPtr > const & colourAttaches
+			, castor::Position const & position = castor::Position{} )const;
+
+	private:
+		//!\~english	The layer dimensions.
+		//!\~french		Les dimensions de la couche.
+		castor::Size m_size;
+		//!\~english	The frame buffer.
+		//!\~french		Le tampon d'image.
+		FrameBufferSPtr m_frameBuffer;
+		//!\~english	The colour textures.
+		//!\~french		Les textures de couleur.
+		std::vector< TextureLayoutSPtr > m_colours;
+		//!\~english	The colour attachments.
+		//!\~french		Les attaches de couleur.
+		std::vector< TextureAttachmentSPtr > m_colourAttaches;
+		//!\~english	The depth buffer.
+		//!\~french		Le tampon de profondeur.
+		DepthStencilRenderBufferSPtr m_depthBuffer;
+		//!\~english	The depth buffer attachment.
+		//!\~french		L'attache du tampon de profondeur.
+		RenderBufferAttachmentSPtr m_depthAttach;
+	};
+}
+
+#endif
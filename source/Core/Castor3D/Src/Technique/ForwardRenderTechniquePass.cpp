@@ -306,6 +306,12 @@ namespace castor3d
 		auto lighting = shader::legacy::createLightingModel( writer
 			, getShadowType( sceneFlags )
 			, index );
+
+		if ( checkFlag( sceneFlags, SceneFlag::eLightClusters ) )
+		{
+			lighting->declareClusters();
+		}
+
 		shader::PhongReflectionModel reflections{ writer };
 		shader::Fog fog{ getFogType( sceneFlags ), writer };
 		glsl::Utils utils{ writer };
@@ -557,6 +563,12 @@ namespace castor3d
 		auto lighting = shader::pbr::mr::createLightingModel( writer
 			, getShadowType( sceneFlags )
 			, index );
+
+		if ( checkFlag( sceneFlags, SceneFlag::eLightClusters ) )
+		{
+			lighting->declareClusters();
+		}
+
 		shader::Fog fog{ getFogType( sceneFlags ), writer };
 		glsl::Utils utils{ writer };
 		utils.declareApplyGamma();
@@ -783,6 +795,12 @@ namespace castor3d
 		auto lighting = shader::pbr::sg::createLightingModel( writer
 			, getShadowType( sceneFlags )
 			, index );
+
+		if ( checkFlag( sceneFlags, SceneFlag::eLightClusters ) )
+		{
+			lighting->declareClusters();
+		}
+
 		shader::Fog fog{ getFogType( sceneFlags ), writer };
 		glsl::Utils utils{ writer };
 		utils.declareApplyGamma();
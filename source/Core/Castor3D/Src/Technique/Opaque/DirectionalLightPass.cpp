@@ -35,6 +35,9 @@ namespace castor3d
 		: LightPass::Program{ engine, vtx, pxl }
 		, m_lightDirection{ m_program->createUniform< UniformType::eVec3f >( cuT( "light.m_direction" ), ShaderType::ePixel ) }
 		, m_lightTransform{ m_program->createUniform< UniformType::eMat4x4f >( cuT( "light.m_transform" ), ShaderType::ePixel ) }
+		, m_lightCascadesCount{ m_program->createUniform< UniformType::eInt >( cuT( "light.m_cascadesCount" ), ShaderType::ePixel ) }
+		, m_lightCascades{ m_program->createUniform< UniformType::eVec4f >( cuT( "light.m_cascades" ), ShaderType::ePixel, shader::DirectionalCascadesCount ) }
+		, m_lightCascadesDepths{ m_program->createUniform< UniformType::eVec4f >( cuT( "light.m_cascadesDepths" ), ShaderType::ePixel, shader::DirectionalCascadesCount / 2u ) }
 	{
 	}
 
@@ -70,6 +73,9 @@ namespace castor3d
 		auto & directionalLight = *light.getDirectionalLight();
 		m_lightDirection->setValue( directionalLight.getDirection() );
 		m_lightTransform->setValue( directionalLight.getLightSpaceTransform() );
+		m_lightCascadesCount->setValue( int( directionalLight.getCascadesCount() ) );
+		m_lightCascades->setValues( directionalLight.getCascades() );
+		m_lightCascadesDepths->setValues( directionalLight.getCascadesDepths() );
 	}
 
 	//*********************************************************************************************
@@ -74,6 +74,15 @@ namespace castor3d
 			//!\~english	The variable containing the light space transformation matrix.
 			//!\~french		La variable contenant la matrice de transformation de la lumière.
 			PushUniform4x4fSPtr m_lightTransform;
+			//!\~english	The variable containing the light shadow cascades count.
+			//!\~french		La variable contenant le nombre de cascades d'ombres de la lumière.
+			PushUniform1iSPtr m_lightCascadesCount;
+			//!\~english	The variable containing the light shadow cascades scale and offset.
+			//!\~french		La variable contenant l'échelle et le décalage des cascades d'ombres de la lumière.
+			PushUniform4fSPtr m_lightCascades;
+			//!\~english	The variable containing the light shadow cascades depth scale and offset.
+			//!\~french		La variable contenant l'échelle et le décalage de profondeur des cascades d'ombres de la lumière.
+			PushUniform4fSPtr m_lightCascadesDepths;
 		};
 
 	public:
@@ -840,94 +840,82 @@ namespace castor3d
 	void OpaquePass::doPrepareFrontPipeline( ShaderProgram & program
 		, PipelineFlags const & flags )
 	{
-		auto it = m_frontPipelines.find( flags );
+		DepthStencilState dsState;
+		dsState.setDepthTest( true );
+		dsState.setDepthMask( WritingMask::eAll );
+		RasteriserState rsState;
+		rsState.setCulledFaces( Culling::eFront );
+		doPublishPipeline( m_frontPipelines
+			, flags
+			, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
+				, std::move( rsState )
+				, doCreateBlendState( flags.m_colourBlendMode, flags.m_alphaBlendMode )
+				, MultisampleState{}
+				, program
+				, flags )
+			, [this, flags]( RenderPipeline & pipeline )
+			{
+				pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
+				pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
+				pipeline.addUniformBuffer( m_sceneUbo.getUbo() );
+				pipeline.addUniformBuffer( m_modelUbo.getUbo() );
 
-		if ( it == m_frontPipelines.end() )
-		{
-			DepthStencilState dsState;
-			dsState.setDepthTest( true );
-			dsState.setDepthMask( WritingMask::eAll );
-			RasteriserState rsState;
-			rsState.setCulledFaces( Culling::eFront );
-			auto & pipeline = *m_frontPipelines.emplace( flags
-				, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
-					, std::move( rsState )
-					, doCreateBlendState( flags.m_colourBlendMode, flags.m_alphaBlendMode )
-					, MultisampleState{}
-					, program
-					, flags ) ).first->second;
-
-			getEngine()->postEvent( makeFunctorEvent( EventType::ePreRender
-				, [this, &pipeline, flags]()
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
 				{
-					pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
-					pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
-					pipeline.addUniformBuffer( m_sceneUbo.getUbo() );
-					pipeline.addUniformBuffer( m_modelUbo.getUbo() );
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
-					{
-						pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
-					}
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
-						&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
-					{
-						pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
-					}
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
-					{
-						pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
-					}
-				} ) );
-		}
+					pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
+				}
+
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
+					&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
+				{
+					pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
+				}
+
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
+				{
+					pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
+				}
+			} );
 	}
 
 	void OpaquePass::doPrepareBackPipeline( ShaderProgram & program
 		, PipelineFlags const & flags )
 	{
-		auto it = m_backPipelines.find( flags );
+		DepthStencilState dsState;
+		dsState.setDepthTest( true );
+		dsState.setDepthMask( WritingMask::eAll );
+		RasteriserState rsState;
+		rsState.setCulledFaces( Culling::eBack );
+		doPublishPipeline( m_backPipelines
+			, flags
+			, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
+			, std::move( rsState )
+			, doCreateBlendState( flags.m_colourBlendMode, flags.m_alphaBlendMode )
+				, MultisampleState{}
+			, program
+			, flags )
+			, [this, flags]( RenderPipeline & pipeline )
+			{
+				pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
+				pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
+				pipeline.addUniformBuffer( m_sceneUbo.getUbo() );
+				pipeline.addUniformBuffer( m_modelUbo.getUbo() );
 
-		if ( it == m_backPipelines.end() )
-		{
-			DepthStencilState dsState;
-			dsState.setDepthTest( true );
-			dsState.setDepthMask( WritingMask::eAll );
-			RasteriserState rsState;
-			rsState.setCulledFaces( Culling::eBack );
-			auto & pipeline = *m_backPipelines.emplace( flags
-				, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
-				, std::move( rsState )
-				, doCreateBlendState( flags.m_colourBlendMode, flags.m_alphaBlendMode )
-					, MultisampleState{}
-				, program
-				, flags ) ).first->second;
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
+				{
+					pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
+				}
 
-			getEngine()->postEvent( makeFunctorEvent( EventType::ePreRender
-				, [this, &pipeline, flags]()
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
+					&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
 				{
-					pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
-					pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
-					pipeline.addUniformBuffer( m_sceneUbo.getUbo() );
-					pipeline.addUniformBuffer( m_modelUbo.getUbo() );
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
-					{
-						pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
-					}
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
-						&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
-					{
-						pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
-					}
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
-					{
-						pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
-					}
-				} ) );
-		}
+					pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
+				}
+
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
+				{
+					pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
+				}
+			} );
 	}
 }
@@ -134,17 +134,45 @@ namespace castor3d
 		m_directionalShadowMaps.resize( 1u );
 		m_pointShadowMaps.resize( shader::PointShadowMapCount );
 		m_spotShadowMaps.resize( shader::SpotShadowMapCount );
+		uint32_t pointFacesBudget = uint32_t( CubeMapFace::eCount );
+		String param;
+
+		if ( parameters.get( cuT( "point_shadow_faces" ), param ) )
+		{
+			pointFacesBudget = string::toUInt( param );
+		}
+
+		if ( parameters.get( cuT( "environment_faces" ), param ) )
+		{
+			m_environmentFacesBudget = string::toUInt( param );
+		}
+
+		uint32_t cascades = shader::DirectionalCascadesCount;
+		float cascadesLambda = 0.75f;
+
+		if ( parameters.get( cuT( "shadow_cascades" ), param ) )
+		{
+			cascades = string::toUInt( param );
+		}
+
+		if ( parameters.get( cuT( "shadow_cascades_lambda" ), param ) )
+		{
+			cascadesLambda = string::toFloat( param );
+		}
 
 		for ( auto & shadowMap : m_directionalShadowMaps )
 		{
 			shadowMap = std::make_unique< ShadowMapDirectional >( *renderTarget.getEngine()
-				, *renderTarget.getScene() );
+				, *renderTarget.getScene()
+				, cascades
+				, cascadesLambda );
 		}
 
 		for ( auto & shadowMap : m_pointShadowMaps )
 		{
 			shadowMap = std::make_unique< ShadowMapPoint >( *renderTarget.getEngine()
-				, *renderTarget.getScene() );
+				, *renderTarget.getScene()
+				, pointFacesBudget );
 		}
 
 		for ( auto & shadowMap : m_spotShadowMaps )
@@ -222,11 +250,35 @@ namespace castor3d
 		m_transparentPass->update( queues );
 		doUpdateShadowMaps( queues );
 		auto & maps = m_renderTarget.getScene()->getEnvironmentMaps();
+		auto count = uint32_t( maps.size() );
+		// By default, each map costs as much as its whole cube every fifth frame.
+		auto facesBudget = m_environmentFacesBudget
+			? m_environmentFacesBudget
+			: ( uint32_t( CubeMapFace::eCount ) * count + 4u ) / 5u;
+
+		for ( auto & map : maps )
+		{
+			map.get().prepare();
+		}
+
+		// The dirty faces are served before the time sliced ones,
+		// and the start map rotates, so the maps share the faces budget.
+		for ( auto timeSliced : { false, true } )
+		{
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				maps[( m_environmentMapsStart + i ) % count].get().selectFaces( facesBudget, timeSliced );
+			}
+		}
 
 		for ( auto & map : maps )
 		{
 			map.get().update( queues );
 		}
+
+		m_environmentMapsStart = count
+			? ( m_environmentMapsStart + 1u ) % count
+			: 0u;
 	}
 
 	void RenderTechnique::render( Point2r const & jitter
@@ -235,14 +287,14 @@ namespace castor3d
 	{
 		auto & scene = *m_renderTarget.getScene();
 		auto & camera = *m_renderTarget.getCamera();
-		scene.getLightCache().updateLightsTexture( camera );
 		m_renderSystem.pushScene( &scene );
 		camera.resize( m_size );
 		camera.update();
+		scene.getLightCache().updateLightsTexture( camera );
 
 		// Update part
-		doRenderEnvironmentMaps();
-		doRenderShadowMaps();
+		doRenderEnvironmentMaps( info );
+		doRenderShadowMaps( info );
 		doUpdateParticles( info );
 
 		// Render part
@@ -384,7 +436,7 @@ namespace castor3d
 			, queues );
 	}
 
-	void RenderTechnique::doRenderShadowMaps()
+	void RenderTechnique::doRenderShadowMaps( RenderInfo & info )
 	{
 		getEngine()->getMaterialCache().getPassBuffer().bind();
 
@@ -393,19 +445,22 @@ namespace castor3d
 			for ( auto & shadowMap : array )
 			{
 				shadowMap.get().render();
+				info.m_renderedShadowPasses += shadowMap.get().getRenderedPasses();
+				info.m_skippedShadowPasses += shadowMap.get().getSkippedPasses();
 			}
 		}
 	}
 
-	void RenderTechnique::doRenderEnvironmentMaps()
+	void RenderTechnique::doRenderEnvironmentMaps( RenderInfo & info )
 	{
 		auto & scene = *m_renderTarget.getScene();
 		auto & maps = scene.getEnvironmentMaps();
 		getEngine()->getMaterialCache().getPassBuffer().bind();
+		info.m_environmentMapsCount += uint32_t( maps.size() );
 
 		for ( auto & map : maps )
 		{
-			map.get().render();
+			info.m_renderedEnvironmentFaces += map.get().render();
 		}
 	}
 
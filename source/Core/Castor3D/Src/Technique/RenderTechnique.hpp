@@ -199,8 +199,8 @@ namespace castor3d
 		void doInitialiseShadowMaps();
 		void doCleanupShadowMaps();
 		void doUpdateShadowMaps( RenderQueueArray & queues );
-		void doRenderShadowMaps();
-		void doRenderEnvironmentMaps();
+		void doRenderShadowMaps( RenderInfo & info );
+		void doRenderEnvironmentMaps( RenderInfo & info );
 		void doRenderOpaque( castor::Point2r const & jitter
 			, TextureUnit const & velocity
 			, RenderInfo & info );
@@ -259,6 +259,12 @@ namespace castor3d
 		//!\~english	The active shadow maps.
 		//!\~french		Les textures d'ombres actives.
 		ShadowMapLightTypeArray m_activeShadowMaps;
+		//!\~english	The environment maps faces rendered per frame, dirty ones included, 0 to scale it with the maps count.
+		//!\~french		Le nombre de faces de textures d'environnement dessinées par frame, faces invalidées comprises, 0 pour l'adapter au nombre de textures.
+		uint32_t m_environmentFacesBudget{ 0u };
+		//!\~english	The first environment map to update, rotated each frame so the budget is shared.
+		//!\~french		La première texture d'environnement à mettre à jour, tournant à chaque frame afin que le budget soit partagé.
+		uint32_t m_environmentMapsStart{ 0u };
 	};
 }
 
@@ -272,6 +272,12 @@ namespace castor3d
 		{
 			addFlag( programFlags, ProgramFlag::eEnvironmentMapping );
 		}
+		else if ( m_camera
+			&& m_camera->getViewportType() == ViewportType::ePerspective )
+		{
+			// The light clusters are built for the main camera only.
+			addFlag( sceneFlags, SceneFlag::eLightClusters );
+		}
 	}
 
 	glsl::Shader RenderTechniquePass::doGetGeometryShaderSource( PassFlags const & passFlags
@@ -290,114 +296,104 @@ namespace castor3d
 	void RenderTechniquePass::doPrepareFrontPipeline( ShaderProgram & program
 		, PipelineFlags const & flags )
 	{
-		auto it = m_frontPipelines.find( flags );
+		DepthStencilState dsState;
+		dsState.setDepthTest( true );
 
-		if ( it == m_frontPipelines.end() )
+		if ( !m_opaque )
 		{
-			doUpdateProgram( program
-				, flags.m_passFlags
-				, flags.m_textureFlags
-				, flags.m_programFlags
-				, flags.m_sceneFlags );
-			DepthStencilState dsState;
-			dsState.setDepthTest( true );
-
-			if ( !m_opaque )
+			dsState.setDepthMask( WritingMask::eZero );
+		}
+
+		RasteriserState rsState;
+		rsState.setCulledFaces( Culling::eFront );
+		doPublishPipeline( m_frontPipelines
+			, flags
+			, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
+				, std::move( rsState )
+				, doCreateBlendState( flags.m_colourBlendMode, flags.m_alphaBlendMode )
+				, MultisampleState{}
+				, program
+				, flags )
+			, [this, flags]( RenderPipeline & pipeline )
 			{
-				dsState.setDepthMask( WritingMask::eZero );
-			}
+				// Done before the program initialisation, on the render thread.
+				doUpdateProgram( pipeline.getProgram()
+					, flags.m_passFlags
+					, flags.m_textureFlags
+					, flags.m_programFlags
+					, flags.m_sceneFlags );
+				pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
+				pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
+				pipeline.addUniformBuffer( m_sceneUbo.getUbo() );
+				pipeline.addUniformBuffer( m_modelUbo.getUbo() );
+
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
+				{
+					pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
+				}
 
-			RasteriserState rsState;
-			rsState.setCulledFaces( Culling::eFront );
-			auto & pipeline = *m_frontPipelines.emplace( flags
-				, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
-					, std::move( rsState )
-					, doCreateBlendState( flags.m_colourBlendMode, flags.m_alphaBlendMode )
-					, MultisampleState{}
-					, program
-					, flags ) ).first->second;
-
-			getEngine()->postEvent( makeFunctorEvent( EventType::ePreRender
-				, [this, &pipeline, flags]()
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
+					&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
 				{
-					pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
-					pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
-					pipeline.addUniformBuffer( m_sceneUbo.getUbo() );
-					pipeline.addUniformBuffer( m_modelUbo.getUbo() );
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
-					{
-						pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
-					}
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
-						&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
-					{
-						pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
-					}
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
-					{
-						pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
-					}
-				} ) );
-		}
+					pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
+				}
+
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
+				{
+					pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
+				}
+			} );
 	}
 
 	void RenderTechniquePass::doPrepareBackPipeline( ShaderProgram & program
 		, PipelineFlags const & flags )
 	{
-		auto it = m_backPipelines.find( flags );
+		DepthStencilState dsState;
+		dsState.setDepthTest( true );
 
-		if ( it == m_backPipelines.end() )
+		if ( !m_opaque )
 		{
-			doUpdateProgram( program
-				, flags.m_passFlags
-				, flags.m_textureFlags
-				, flags.m_programFlags
-				, flags.m_sceneFlags );
-			DepthStencilState dsState;
-			dsState.setDepthTest( true );
-
-			if ( !m_opaque )
+			dsState.setDepthMask( WritingMask::eZero );
+		}
+
+		RasteriserState rsState;
+		rsState.setCulledFaces( Culling::eBack );
+		doPublishPipeline( m_backPipelines
+			, flags
+			, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
+			, std::move( rsState )
+			, doCreateBlendState( flags.m_colourBlendMode, flags.m_alphaBlendMode )
+				, MultisampleState{}
+			, program
+			, flags )
+			, [this, flags]( RenderPipeline & pipeline )
 			{
-				dsState.setDepthMask( WritingMask::eZero );
-			}
+				// Done before the program initialisation, on the render thread.
+				doUpdateProgram( pipeline.getProgram()
+					, flags.m_passFlags
+					, flags.m_textureFlags
+					, flags.m_programFlags
+					, flags.m_sceneFlags );
+				pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
+				pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
+				pipeline.addUniformBuffer( m_sceneUbo.getUbo() );
+				pipeline.addUniformBuffer( m_modelUbo.getUbo() );
+
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
+				{
+					pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
+				}
 
-			RasteriserState rsState;
-			rsState.setCulledFaces( Culling::eBack );
-			auto & pipeline = *m_backPipelines.emplace( flags
-				, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
-				, std::move( rsState )
-				, doCreateBlendState( flags.m_colourBlendMode, flags.m_alphaBlendMode )
-					, MultisampleState{}
-				, program
-				, flags ) ).first->second;
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
+					&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
+				{
+					pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
+				}
 
-			getEngine()->postEvent( makeFunctorEvent( EventType::ePreRender
-				, [this, &pipeline, flags]()
+				if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
 				{
-					pipeline.addUniformBuffer( m_matrixUbo.getUbo() );
-					pipeline.addUniformBuffer( m_modelMatrixUbo.getUbo() );
-					pipeline.addUniformBuffer( m_sceneUbo.getUbo() );
-					pipeline.addUniformBuffer( m_modelUbo.getUbo() );
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eBillboards ) )
-					{
-						pipeline.addUniformBuffer( m_billboardUbo.getUbo() );
-					}
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eSkinning )
-						&& !checkFlag( flags.m_programFlags, ProgramFlag::eInstantiation ) )
-					{
-						pipeline.addUniformBuffer( m_skinningUbo.getUbo() );
-					}
-
-					if ( checkFlag( flags.m_programFlags, ProgramFlag::eMorphing ) )
-					{
-						pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
-					}
-				} ) );
-		}
+					pipeline.addUniformBuffer( m_morphingUbo.getUbo() );
+				}
+			} );
 	}
 }
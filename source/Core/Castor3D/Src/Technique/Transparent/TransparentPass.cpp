@@ -136,57 +136,45 @@ namespace castor3d
 	void TransparentPass::doPrepareFrontPipeline( ShaderProgram & program
 		, PipelineFlags const & flags )
 	{
-		auto it = m_frontPipelines.find( flags );
-
-		if ( it == m_frontPipelines.end() )
-		{
-			DepthStencilState dsState;
-			dsState.setDepthTest( true );
-			dsState.setDepthMask( WritingMask::eZero );
-			RasteriserState rsState;
-			rsState.setCulledFaces( Culling::eFront );
-			auto & pipeline = *m_frontPipelines.emplace( flags
-				, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
-					, std::move( rsState )
-					, doCreateBlendState()
-					, MultisampleState{}
-					, program
-					, flags ) ).first->second;
-
-			getEngine()->postEvent( makeFunctorEvent( EventType::ePreRender
-				, [this, &pipeline, flags]()
+		DepthStencilState dsState;
+		dsState.setDepthTest( true );
+		dsState.setDepthMask( WritingMask::eZero );
+		RasteriserState rsState;
+		rsState.setCulledFaces( Culling::eFront );
+		doPublishPipeline( m_frontPipelines
+			, flags
+			, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
+				, std::move( rsState )
+				, doCreateBlendState()
+				, MultisampleState{}
+				, program
+				, flags )
+			, [this, flags]( RenderPipeline & pipeline )
 			{
 				doCompletePipeline( flags, pipeline );
-			} ) );
-		}
+			} );
 	}
 
 	void TransparentPass::doPrepareBackPipeline( ShaderProgram & program
 		, PipelineFlags const & flags )
 	{
-		auto it = m_backPipelines.find( flags );
-
-		if ( it == m_backPipelines.end() )
-		{
-			DepthStencilState dsState;
-			dsState.setDepthTest( true );
-			dsState.setDepthMask( WritingMask::eZero );
-			RasteriserState rsState;
-			rsState.setCulledFaces( Culling::eBack );
-			auto & pipeline = *m_backPipelines.emplace( flags
-				, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
-					, std::move( rsState )
-					, doCreateBlendState()
-					, MultisampleState{}
-					, program
-					, flags ) ).first->second;
-
-			getEngine()->postEvent( makeFunctorEvent( EventType::ePreRender
-				, [this, &pipeline, flags]()
+		DepthStencilState dsState;
+		dsState.setDepthTest( true );
+		dsState.setDepthMask( WritingMask::eZero );
+		RasteriserState rsState;
+		rsState.setCulledFaces( Culling::eBack );
+		doPublishPipeline( m_backPipelines
+			, flags
+			, getEngine()->getRenderSystem()->createRenderPipeline( std::move( dsState )
+				, std::move( rsState )
+				, doCreateBlendState()
+				, MultisampleState{}
+				, program
+				, flags )
+			, [this, flags]( RenderPipeline & pipeline )
 			{
 				doCompletePipeline( flags, pipeline );
-			} ) );
-		}
+			} );
 	}
 
 	glsl::Shader TransparentPass::doGetVertexShaderSource( PassFlags const & passFlags
@@ -428,6 +416,12 @@ namespace castor3d
 		auto lighting = shader::legacy::createLightingModel( writer
 			, getShadowType( sceneFlags )
 			, index );
+
+		if ( checkFlag( sceneFlags, SceneFlag::eLightClusters ) )
+		{
+			lighting->declareClusters();
+		}
+
 		shader::PhongReflectionModel reflections{ writer };
 		shader::Fog fog{ getFogType( sceneFlags ), writer };
 		glsl::Utils utils{ writer };
@@ -689,6 +683,12 @@ namespace castor3d
 		auto lighting = shader::pbr::mr::createLightingModel( writer
 			, getShadowType( sceneFlags )
 			, index );
+
+		if ( checkFlag( sceneFlags, SceneFlag::eLightClusters ) )
+		{
+			lighting->declareClusters();
+		}
+
 		glsl::Utils utils{ writer };
 		utils.declareApplyGamma();
 		utils.declareRemoveGamma();
@@ -926,6 +926,12 @@ namespace castor3d
 		auto lighting = shader::pbr::sg::createLightingModel( writer
 			, getShadowType( sceneFlags )
 			, index );
+
+		if ( checkFlag( sceneFlags, SceneFlag::eLightClusters ) )
+		{
+			lighting->declareClusters();
+		}
+
 		glsl::Utils utils{ writer };
 		utils.declareApplyGamma();
 		utils.declareRemoveGamma();
@@ -3,6 +3,7 @@
 #include "Engine.hpp"
 #include "TextureLayout.hpp"
 
+#include <Data/VirtualFileSystem.hpp>
 #include <Graphics/Image.hpp>
 
 using namespace castor;
@@ -99,7 +100,7 @@ namespace castor3d
 				, m_folder{ folder }
 				, m_relative{ relative }
 			{
-				if ( File::fileExists( folder / relative ) )
+				if ( VirtualFileSystem::fileExists( folder / relative ) )
 				{
 					String name{ relative.getFileName() };
 
@@ -159,6 +160,51 @@ namespace castor3d
 
 		//*********************************************************************************************
 
+		class BakedFileTextureSource
+			: public StaticTextureSource
+		{
+		public:
+			BakedFileTextureSource( Engine & engine
+				, Path const & folder
+				, Path const & relative )
+				: StaticTextureSource{ engine }
+				, m_folder{ folder }
+				, m_relative{ relative }
+				, m_baked{ std::make_unique< BakedTexture >( folder / relative ) }
+			{
+				m_format = m_baked->getFormat();
+				m_size = m_baked->getDimensions();
+			}
+
+			virtual uint32_t getDepth()const
+			{
+				return 1u;
+			}
+
+			virtual String toString()const
+			{
+				return m_folder / m_relative;
+			}
+
+			BakedTexture const * getBaked()const override
+			{
+				return m_baked.get();
+			}
+
+			void setBuffer( PxBufferBaseSPtr )override
+			{
+				// The levels are read from the mapped file, there is no pixel buffer to replace.
+				FAILURE( "Can't call setBuffer on a baked texture source." );
+			}
+
+		private:
+			Path m_folder;
+			Path m_relative;
+			std::unique_ptr< BakedTexture > m_baked;
+		};
+
+		//*********************************************************************************************
+
 		class Static3DTextureSource
 			: public StaticTextureSource
 		{
@@ -354,9 +400,19 @@ namespace castor3d
 	void TextureImage::initialiseSource( Path const & folder
 		, Path const & relative )
 	{
-		m_source = std::make_unique< StaticFileTextureSource >( *getOwner()->getRenderSystem()->getEngine()
-			, folder
-			, relative );
+		if ( string::lowerCase( relative.getExtension() ) == BakedTexture::Extension )
+		{
+			m_source = std::make_unique< BakedFileTextureSource >( *getOwner()->getRenderSystem()->getEngine()
+				, folder
+				, relative );
+		}
+		else
+		{
+			m_source = std::make_unique< StaticFileTextureSource >( *getOwner()->getRenderSystem()->getEngine()
+				, folder
+				, relative );
+		}
+
 		getOwner()->doUpdateFromFirstImage( m_source->getDimensions(), m_source->getPixelFormat() );
 	}
 
@@ -6,6 +6,7 @@ See LICENSE file in root folder
 
 #include "TextureStorage.hpp"
 
+#include <Graphics/BakedTexture.hpp>
 #include <Graphics/PixelBufferBase.hpp>
 
 namespace castor3d
@@ -85,6 +86,16 @@ namespace castor3d
 		 *\return		La source en chaîne de caractères.
 		 */
 		C3D_API virtual castor::String toString()const = 0;
+		/**
+		 *\~english
+		 *\return		The baked texture, if the source is a GPU ready container.
+		 *\~french
+		 *\return		La texture préparée, si la source est un conteneur prêt pour le GPU.
+		 */
+		C3D_API virtual castor::BakedTexture const * getBaked()const
+		{
+			return nullptr;
+		}
 		/**
 		 *\~english
 		 *\return		The source's dimensions.
@@ -194,10 +205,12 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Defines the texture buffer from an image file.
+		 *\remarks		Files with the castor::BakedTexture::Extension extension are mapped as GPU ready containers.
 		 *\param[in]	p_folder	The folder containing the image.
 		 *\param[in]	p_relative	The image file path, relative to p_folder.
 		 *\~french
 		 *\brief		Définit le tampon de la texture depuis un fichier image.
+		 *\remarks		Les fichiers ayant l'extension castor::BakedTexture::Extension sont projetés en tant que conteneurs prêts pour le GPU.
 		 *\param[in]	p_folder	Le dossier contenant l'image.
 		 *\param[in]	p_relative	Le chemin d'accès à l'image, relatif à p_folder.
 		 */
@@ -265,6 +278,16 @@ namespace castor3d
 		{
 			return m_source->getBuffer();
 		}
+		/**
+		 *\~english
+		 *\return		The baked texture, \p nullptr if the source is not a GPU ready container.
+		 *\~french
+		 *\return		La texture préparée, \p nullptr si la source n'est pas un conteneur prêt pour le GPU.
+		 */
+		inline castor::BakedTexture const * getBaked()const
+		{
+			return m_source->getBaked();
+		}
 		/**
 		 *\~english
 		 *\return		The static source status.
@@ -10,6 +10,12 @@ namespace castor3d
 
 	namespace
 	{
+		MemoryTag & doGetMemoryTag()
+		{
+			static MemoryTag & tag = MemoryAccounting::getTag( cuT( "Textures" ) );
+			return tag;
+		}
+
 		size_t getImagesCount( TextureType type, uint32_t depth )
 		{
 			size_t result = depth;
@@ -85,6 +91,7 @@ namespace castor3d
 		, m_images{ getImagesCount( type, 1 ) }
 		, m_cpuAccess{ cpuAccess }
 		, m_gpuAccess{ gpuAccess }
+		, m_memory{ doGetMemoryTag() }
 	{
 		uint32_t index = 0u;
 
@@ -105,6 +112,7 @@ namespace castor3d
 		, m_cpuAccess{ cpuAccess }
 		, m_gpuAccess{ gpuAccess }
 		, m_mipmapCount{ mipmapCount }
+		, m_memory{ doGetMemoryTag() }
 	{
 		uint32_t index = 0u;
 
@@ -127,6 +135,7 @@ namespace castor3d
 		, m_gpuAccess{ gpuAccess }
 		, m_format{ format }
 		, m_size{ size }
+		, m_memory{ doGetMemoryTag() }
 	{
 		REQUIRE( m_type != TextureType::eThreeDimensions
 				 && m_type != TextureType::eOneDimensionArray
@@ -155,6 +164,7 @@ namespace castor3d
 		, m_format{ format }
 		, m_size{ size[0], size[1] }
 		, m_depth{ size[2] }
+		, m_memory{ doGetMemoryTag() }
 	{
 		REQUIRE( m_type == TextureType::eThreeDimensions
 				 || m_type == TextureType::eOneDimensionArray
@@ -187,6 +197,11 @@ namespace castor3d
 			}
 
 			m_initialised = result;
+
+			if ( m_initialised )
+			{
+				doUpdateMemory();
+			}
 		}
 
 		return m_initialised;
@@ -198,11 +213,29 @@ namespace castor3d
 		{
 			m_storage.reset();
 			doCleanup();
+			m_memory.setGpuSize( 0u );
 		}
 
 		m_initialised = false;
 	}
 
+	void TextureLayout::doUpdateMemory()
+	{
+		// Estimation: the driver's padding and alignment are unknown.
+		size_t size = size_t( getWidth() )
+			* getHeight()
+			* m_images.size()
+			* PF::getBytesPerPixel( getPixelFormat() );
+
+		if ( m_mipmapCount > 1u )
+		{
+			// The full mipmaps chain adds a third of the base level.
+			size = size * 4u / 3u;
+		}
+
+		m_memory.setGpuSize( size );
+	}
+
 	void TextureLayout::bind( uint32_t index )const
 	{
 		REQUIRE( m_initialised );
@@ -233,6 +266,11 @@ namespace castor3d
 		{
 			image->resize( size );
 		}
+
+		if ( m_initialised )
+		{
+			doUpdateMemory();
+		}
 	}
 
 	void TextureLayout::resize( Point3ui const & size )
@@ -249,6 +287,11 @@ namespace castor3d
 		{
 			image->resize( size );
 		}
+
+		if ( m_initialised )
+		{
+			doUpdateMemory();
+		}
 	}
 
 	uint8_t * TextureLayout::lock( AccessTypes const & lock )
@@ -279,17 +322,25 @@ namespace castor3d
 		m_storage->unlock( modified, index );
 	}
 
+	void TextureLayout::uploadRegion( Rectangle const & region )
+	{
+		REQUIRE( m_storage );
+		auto buffer = m_images[0]->getBuffer();
+		REQUIRE( buffer );
+		doBind( 0u );
+		m_storage->uploadRegion( region, *buffer );
+		doUnbind( 0u );
+	}
+
 	void TextureLayout::setSource( Path const & folder
 		, Path const & relative )
 	{
 		m_images[0]->initialiseSource( folder, relative );
-		auto buffer = m_images[0]->getBuffer();
+		auto baked = m_images[0]->getBaked();
 
-		if ( m_size != buffer->dimensions()
-			 || m_format != buffer->format() )
+		if ( baked )
 		{
-			m_size = buffer->dimensions();
-			m_format = buffer->format();
+			m_mipmapCount = baked->getLevelsCount();
 		}
 	}
 
@@ -6,6 +6,8 @@ See LICENSE file in root folder
 
 #include "TextureImage.hpp"
 
+#include <Miscellaneous/MemoryAccounting.hpp>
+
 namespace castor3d
 {
 	/*!
@@ -204,13 +206,26 @@ namespace castor3d
 		 *\param[in]	index		L'index de l'image.
 		 */
 		C3D_API void unlock( bool modified, uint32_t index );
+		/**
+		 *\~english
+		 *\brief		Uploads a region of the first image to GPU, from its source buffer.
+		 *\remarks		Binds the texture.
+		 *\param[in]	region	The region to upload.
+		 *\~french
+		 *\brief		Met une région de la première image sur le GPU, depuis son buffer source.
+		 *\remarks		Active la texture.
+		 *\param[in]	region	La région à mettre sur le GPU.
+		 */
+		C3D_API void uploadRegion( castor::Rectangle const & region );
 		/**
 		 *\~english
 		 *\brief		Defines the texture buffer from an image file.
+		 *\remarks		For baked textures, the mipmaps count is the one stored in the file.
 		 *\param[in]	folder	The folder containing the image.
 		 *\param[in]	relative	The image file path, relative to folder.
 		 *\~french
 		 *\brief		Définit le tampon de la texture depuis un fichier image.
+		 *\remarks		Pour les textures préparées, le nombre de mipmaps est celui stocké dans le fichier.
 		 *\param[in]	folder	Le dossier contenant l'image.
 		 *\param[in]	relative	Le chemin d'accès à l'image, relatif à folder.
 		 */
@@ -443,6 +458,13 @@ namespace castor3d
 		 *\return		\p true si tout s'est bien passé.
 		 */
 		bool doCreateStorage( TextureStorageType type );
+		/**
+		 *\~english
+		 *\brief		Updates the accounted GPU memory, from the texture dimensions and format.
+		 *\~french
+		 *\brief		Met à jour la mémoire GPU comptabilisée, à partir des dimensions et du format de la texture.
+		 */
+		void doUpdateMemory();
 
 	private:
 		/**
@@ -507,6 +529,11 @@ namespace castor3d
 		//!\~english	The texture's mipmap count.
 		//!\~french		Le nombre de mipmaps de la texture.
 		uint32_t m_mipmapCount{ ~( 0u ) };
+
+	private:
+		//!\~english	Accounts for the texture GPU storage.
+		//!\~french		Comptabilise le stockage GPU de la texture.
+		castor::MemoryUsage m_memory;
 	};
 }
 
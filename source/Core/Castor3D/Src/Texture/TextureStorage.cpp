@@ -2,6 +2,9 @@
 
 #include "Engine.hpp"
 
+#include <Graphics/PixelBufferBase.hpp>
+#include <Graphics/Rectangle.hpp>
+
 using namespace castor;
 
 namespace castor3d
@@ -21,4 +24,16 @@ namespace castor3d
 	TextureStorage::~TextureStorage()
 	{
 	}
+
+	void TextureStorage::uploadRegion( Rectangle const & p_region
+		, PxBufferBase const & p_buffer )
+	{
+		auto data = lock( AccessType::eWrite );
+
+		if ( data )
+		{
+			std::memcpy( data, p_buffer.constPtr(), p_buffer.size() );
+			unlock( true );
+		}
+	}
 }
@@ -119,6 +119,22 @@ namespace castor3d
 		 *\param[in]	p_index		L'indice du stockage de l'image.
 		 */
 		C3D_API virtual void unlock( bool p_modified, uint32_t p_index ) = 0;
+		/**
+		 *\~english
+		 *\brief		Uploads a region of the image to GPU.
+		 *\remarks		The parent texture must be bound.
+		 *				<br />The default implementation uploads the whole image.
+		 *\param[in]	p_region	The region to upload.
+		 *\param[in]	p_buffer	The whole image buffer.
+		 *\~french
+		 *\brief		Met une région de l'image sur le GPU.
+		 *\remarks		La texture parente doit être activée.
+		 *				<br />L'implémentation par défaut met toute l'image sur le GPU.
+		 *\param[in]	p_region	La région à mettre sur le GPU.
+		 *\param[in]	p_buffer	Le buffer de l'image entière.
+		 */
+		C3D_API virtual void uploadRegion( castor::Rectangle const & p_region
+			, castor::PxBufferBase const & p_buffer );
 		/**
 		 *\~english
 		 *\return		The CPU access rights.
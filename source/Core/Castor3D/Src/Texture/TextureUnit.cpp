@@ -196,7 +196,8 @@ namespace castor3d
 
 			if ( result
 				&& sampler
-				&& sampler->getInterpolationMode( InterpolationFilter::eMip ) != InterpolationMode::eNearest )
+				&& sampler->getInterpolationMode( InterpolationFilter::eMip ) != InterpolationMode::eNearest
+				&& !m_texture->getImage().getBaked() )
 			{
 				m_texture->bind( MinTextureIndex );
 				m_texture->generateMipmaps();
@@ -230,7 +231,8 @@ namespace castor3d
 
 			if ( m_changed
 				&& m_autoMipmaps
-				&& m_texture->getType() != TextureType::eBuffer )
+				&& m_texture->getType() != TextureType::eBuffer
+				&& !m_texture->getImage().getBaked() )
 			{
 				m_texture->generateMipmaps();
 				m_changed = false;
@@ -0,0 +1,145 @@
+#include "AssetLoaderTest.hpp"
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace
+	{
+		class Log
+		{
+		public:
+			void add( std::string const & entry )
+			{
+				auto lock = makeUniqueLock( m_mutex );
+				m_entries.push_back( entry );
+			}
+
+			size_t indexOf( std::string const & entry )const
+			{
+				auto lock = makeUniqueLock( m_mutex );
+				return size_t( std::distance( m_entries.begin()
+					, std::find( m_entries.begin(), m_entries.end(), entry ) ) );
+			}
+
+			size_t size()const
+			{
+				auto lock = makeUniqueLock( m_mutex );
+				return m_entries.size();
+			}
+
+		private:
+			mutable std::mutex m_mutex;
+			std::vector< std::string > m_entries;
+		};
+	}
+
+	//*********************************************************************************************
+
+	AssetLoaderTest::AssetLoaderTest()
+		: TestCase( "AssetLoaderTest" )
+	{
+	}
+
+	AssetLoaderTest::~AssetLoaderTest()
+	{
+	}
+
+	void AssetLoaderTest::doRegisterTests()
+	{
+		doRegisterTest( "AssetLoaderTest::ResourceOrder", std::bind( &AssetLoaderTest::ResourceOrder, this ) );
+		doRegisterTest( "AssetLoaderTest::Continuations", std::bind( &AssetLoaderTest::Continuations, this ) );
+		doRegisterTest( "AssetLoaderTest::Failures", std::bind( &AssetLoaderTest::Failures, this ) );
+	}
+
+	void AssetLoaderTest::ResourceOrder()
+	{
+		Log log;
+		int mesh;
+		int texture;
+		AssetLoader loader{ 4u };
+		loader.pushJob( &mesh, cuT( "Import" ), [&log]()
+		{
+			std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+			log.add( "import" );
+			return true;
+		} );
+		loader.pushJob( &texture, cuT( "Decode" ), [&log]()
+		{
+			log.add( "decode" );
+			return true;
+		} );
+		loader.pushJob( &mesh, cuT( "Subdivide" ), [&log]()
+		{
+			log.add( "subdivide" );
+			return true;
+		} );
+		CT_CHECK( loader.isPending( &mesh ) );
+		loader.wait( &mesh );
+		CT_CHECK( !loader.isPending( &mesh ) );
+		CT_CHECK( log.indexOf( "import" ) < log.indexOf( "subdivide" ) );
+		CT_CHECK( loader.join() );
+		CT_EQUAL( log.size(), 3u );
+	}
+
+	void AssetLoaderTest::Continuations()
+	{
+		Log log;
+		int mesh;
+		int geometry;
+		AssetLoader loader{ 2u };
+		loader.pushContinuation( &geometry, [&log]()
+		{
+			log.add( "immediate" );
+		} );
+		CT_EQUAL( log.size(), 1u );
+		loader.pushJob( &mesh, cuT( "Import" ), [&log]()
+		{
+			std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+			log.add( "import" );
+			return true;
+		} );
+		loader.pushContinuation( &geometry, [&log]()
+		{
+			log.add( "setMesh" );
+		}
+		, { &mesh } );
+		loader.pushContinuation( &geometry, [&log]()
+		{
+			log.add( "setMaterial" );
+		} );
+		CT_CHECK( loader.isPending( &geometry ) );
+		loader.pushJob( &mesh, cuT( "Morph" ), [&log]()
+		{
+			log.add( "morph" );
+			return true;
+		}
+		, { &geometry } );
+		CT_CHECK( loader.join() );
+		CT_EQUAL( log.size(), 5u );
+		CT_CHECK( log.indexOf( "import" ) < log.indexOf( "setMesh" ) );
+		CT_CHECK( log.indexOf( "setMesh" ) < log.indexOf( "setMaterial" ) );
+		CT_CHECK( log.indexOf( "setMaterial" ) < log.indexOf( "morph" ) );
+	}
+
+	void AssetLoaderTest::Failures()
+	{
+		Log log;
+		int mesh;
+		AssetLoader loader{ 2u };
+		loader.pushJob( &mesh, cuT( "Import" ), []()
+		{
+			return false;
+		} );
+		loader.pushJob( &mesh, cuT( "Subdivide" ), [&log]()
+		{
+			log.add( "subdivide" );
+			throw std::runtime_error{ "Subdivision failed" };
+			return true;
+		} );
+		CT_CHECK( !loader.join() );
+		CT_EQUAL( log.size(), 1u );
+		CT_CHECK( loader.join() );
+	}
+}
@@ -0,0 +1,28 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_ASSET_LOADER_TEST_H___
+#define ___C3DT_ASSET_LOADER_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+#include <Scene/AssetLoader.hpp>
+
+namespace Testing
+{
+	class AssetLoaderTest
+		: public TestCase
+	{
+	public:
+		AssetLoaderTest();
+		virtual ~AssetLoaderTest();
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void ResourceOrder();
+		void Continuations();
+		void Failures();
+	};
+}
+
+#endif
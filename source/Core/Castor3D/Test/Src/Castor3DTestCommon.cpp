@@ -69,108 +69,54 @@ namespace Testing
 
 	bool C3DTestCase::compare( Scene const & p_a, Scene const & p_b )
 	{
-		auto lockA = makeUniqueLock( p_a.getSceneNodeCache() );
-		auto lockB = makeUniqueLock( p_b.getSceneNodeCache() );
-		auto itA = p_a.getSceneNodeCache().begin();
-		auto endItA =  p_a.getSceneNodeCache().end();
-		auto itB = p_b.getSceneNodeCache().begin();
-		auto endItB = p_b.getSceneNodeCache().end();
-		bool result = true;
-
-		while ( result && itA != endItA && itB != endItB )
+		// The caches don't sort their elements, so they are matched by name.
+		auto compareCaches = [this]( auto const & cacheA, auto const & cacheB, bool skipEyes )
 		{
-			if ( result
-					&& itA->first.find( cuT( "_REye" ) ) == String::npos
-					&& itA->first.find( cuT( "_LEye" ) ) == String::npos )
+			auto elementsA = cacheA.getSnapshot();
+			auto elementsB = cacheB.getSnapshot();
+			bool result = true;
+			auto itA = elementsA->begin();
+
+			while ( result && itA != elementsA->end() )
 			{
-				result = CT_EQUAL( itA->first, itB->first );
-				result &= CT_EQUAL( *itA->second, *itB->second );
+				if ( !skipEyes
+					|| ( itA->first.find( cuT( "_REye" ) ) == String::npos
+						&& itA->first.find( cuT( "_LEye" ) ) == String::npos ) )
+				{
+					auto elementB = elementsB->find( itA->first );
+					result = CT_CHECK( elementB != nullptr );
+
+					if ( result )
+					{
+						result = CT_EQUAL( *itA->second, *elementB );
+					}
+				}
+
+				++itA;
 			}
 
-			++itA;
-			++itB;
-		}
+			return result;
+		};
+		bool result = compareCaches( p_a.getSceneNodeCache(), p_b.getSceneNodeCache(), true );
 
 		if ( result )
 		{
-			auto lockA = makeUniqueLock( p_a.getGeometryCache() );
-			auto lockB = makeUniqueLock( p_b.getGeometryCache() );
-			auto itA = p_a.getGeometryCache().begin();
-			auto endItA =  p_a.getGeometryCache().end();
-			auto itB = p_b.getGeometryCache().begin();
-			auto endItB = p_b.getGeometryCache().end();
-
-			while ( result && itA != endItA && itB != endItB )
-			{
-				result = CT_EQUAL( itA->first, itB->first );
-				result &= CT_EQUAL( *itA->second, *itB->second );
-				++itA;
-				++itB;
-			}
+			result = compareCaches( p_a.getGeometryCache(), p_b.getGeometryCache(), false );
 		}
 
 		if ( result )
 		{
-			auto lockA = makeUniqueLock( p_a.getLightCache() );
-			auto lockB = makeUniqueLock( p_b.getLightCache() );
-			auto itA = p_a.getLightCache().begin();
-			auto endItA =  p_a.getLightCache().end();
-			auto itB = p_b.getLightCache().begin();
-			auto endItB = p_b.getLightCache().end();
-
-			while ( result && itA != endItA && itB != endItB )
-			{
-				result = CT_EQUAL( itA->first, itB->first );
-				result &= CT_EQUAL( *itA->second, *itB->second );
-				++itA;
-				++itB;
-			}
+			result = compareCaches( p_a.getLightCache(), p_b.getLightCache(), false );
 		}
 
 		if ( result )
 		{
-			auto lockA = makeUniqueLock( p_a.getCameraCache() );
-			auto lockB = makeUniqueLock( p_b.getCameraCache() );
-			auto itA = p_a.getCameraCache().begin();
-			auto endItA =  p_a.getCameraCache().end();
-			auto itB = p_b.getCameraCache().begin();
-			auto endItB = p_b.getCameraCache().end();
-
-			while ( result && itA != endItA && itB != endItB )
-			{
-				if ( result
-					 && itA->first.find( cuT( "_REye" ) ) == String::npos
-					 && itA->first.find( cuT( "_LEye" ) ) == String::npos )
-				{
-					result = CT_EQUAL( itA->first, itB->first );
-					result &= CT_EQUAL( *itA->second, *itB->second );
-				}
-
-				++itA;
-				++itB;
-			}
+			result = compareCaches( p_a.getCameraCache(), p_b.getCameraCache(), true );
 		}
 
 		if ( result )
 		{
-			auto lockA = makeUniqueLock( p_a.getAnimatedObjectGroupCache() );
-			auto lockB = makeUniqueLock( p_b.getAnimatedObjectGroupCache() );
-			auto itA = p_a.getAnimatedObjectGroupCache().begin();
-			auto endItA =  p_a.getAnimatedObjectGroupCache().end();
-			auto itB = p_b.getAnimatedObjectGroupCache().begin();
-			auto endItB = p_b.getAnimatedObjectGroupCache().end();
-
-			while ( result && itA != endItA && itB != endItB )
-			{
-				if ( result )
-				{
-					result = CT_EQUAL( itA->first, itB->first );
-					result &= CT_EQUAL( *itA->second, *itB->second );
-				}
-
-				++itA;
-				++itB;
-			}
+			result = compareCaches( p_a.getAnimatedObjectGroupCache(), p_b.getAnimatedObjectGroupCache(), false );
 		}
 
 		return result;
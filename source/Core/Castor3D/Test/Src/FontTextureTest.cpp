@@ -0,0 +1,171 @@
+#include "FontTextureTest.hpp"
+
+#include <Engine.hpp>
+#include <Overlay/FontTexture.hpp>
+
+#include <Graphics/Font.hpp>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace
+	{
+		// Rasterises every character as a plain square, so the atlas layout is predictable.
+		class SquareGlyphLoader
+			: public Font::SFontImpl
+		{
+		public:
+			explicit SquareGlyphLoader( uint32_t size )
+				: m_size{ size }
+			{
+			}
+
+			void initialise()override
+			{
+			}
+
+			void cleanup()override
+			{
+			}
+
+			Glyph loadGlyph( char32_t p_char )override
+			{
+				return Glyph{ p_char
+					, Size{ m_size, m_size }
+					, Position{}
+					, m_size
+					, ByteArray( m_size * m_size, uint8_t( 0xFF ) ) };
+			}
+
+			Size getMaxSize()override
+			{
+				return Size{ m_size, m_size };
+			}
+
+		private:
+			uint32_t m_size;
+		};
+
+		FontSPtr doCreateFont( String const & name, uint32_t size )
+		{
+			auto result = std::make_shared< Font >( name, size );
+			result->setGlyphLoader( std::make_unique< SquareGlyphLoader >( size ) );
+			result->setMaxHeight( size );
+			result->setMaxWidth( size );
+			return result;
+		}
+
+		void doLoadGlyphs( Font & font, char32_t first, uint32_t count )
+		{
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				font.loadGlyph( char32_t( first + i ) );
+			}
+		}
+	}
+
+	FontTextureTest::FontTextureTest( Engine & engine )
+		: C3DTestCase{ "FontTextureTest", engine }
+	{
+	}
+
+	FontTextureTest::~FontTextureTest()
+	{
+	}
+
+	void FontTextureTest::doRegisterTests()
+	{
+		doRegisterTest( "FontTextureTest::Packing", std::bind( &FontTextureTest::Packing, this ) );
+		doRegisterTest( "FontTextureTest::Growth", std::bind( &FontTextureTest::Growth, this ) );
+		doRegisterTest( "FontTextureTest::Lookup", std::bind( &FontTextureTest::Lookup, this ) );
+	}
+
+	void FontTextureTest::Packing()
+	{
+		auto font = doCreateFont( cuT( "FontTextureTest::Packing" ), 16u );
+		FontTexture texture{ m_engine, font };
+		texture.initialise();
+		doLoadGlyphs( *font, U'a', 3u );
+		texture.update();
+
+		// Packed, but not uploaded yet.
+		CT_CHECK( !texture.hasGlyph( U'a' ) );
+		uint32_t changes = 0u;
+		auto connection = texture.onChanged.connect( [&changes]( FontTexture const & )
+		{
+			++changes;
+		} );
+		texture.upload();
+		CT_EQUAL( changes, 1u );
+
+		// Same shelf, separated by the glyph width and its padding.
+		Position const a = texture.getGlyphPosition( U'a' );
+		Position const b = texture.getGlyphPosition( U'b' );
+		Position const c = texture.getGlyphPosition( U'c' );
+		CT_EQUAL( a.y(), 0 );
+		CT_EQUAL( b.y(), 0 );
+		CT_EQUAL( c.y(), 0 );
+		CT_EQUAL( b.x() - a.x(), 17 );
+		CT_EQUAL( c.x() - b.x(), 17 );
+
+		// Nothing new to pack: no upload, no notification.
+		texture.update();
+		texture.upload();
+		CT_EQUAL( changes, 1u );
+		texture.cleanup();
+	}
+
+	void FontTextureTest::Growth()
+	{
+		auto font = doCreateFont( cuT( "FontTextureTest::Growth" ), 16u );
+		FontTexture texture{ m_engine, font };
+		texture.initialise();
+		Size const initial = texture.getDimensions();
+		CT_EQUAL( initial.getWidth(), 256u );
+		CT_EQUAL( initial.getHeight(), 256u );
+
+		doLoadGlyphs( *font, U'a', 1u );
+		texture.update();
+		texture.upload();
+		Position const first = texture.getGlyphPosition( U'a' );
+
+		// 15 rows of 15 glyphs fit in 256x256, the next ones need a bigger texture.
+		doLoadGlyphs( *font, U'a' + 1u, 299u );
+		texture.update();
+
+		// The clients keep the dimensions and positions of the texture on the GPU until it is recreated.
+		CT_EQUAL( texture.getDimensions().getWidth(), initial.getWidth() );
+		CT_EQUAL( texture.getDimensions().getHeight(), initial.getHeight() );
+		CT_CHECK( !texture.hasGlyph( char32_t( U'a' + 299u ) ) );
+
+		texture.upload();
+		CT_EQUAL( texture.getDimensions().getWidth(), 512u );
+		CT_EQUAL( texture.getDimensions().getHeight(), 256u );
+		CT_EQUAL( texture.getGlyphPosition( U'a' ).x(), first.x() );
+		CT_EQUAL( texture.getGlyphPosition( U'a' ).y(), first.y() );
+
+		for ( uint32_t i = 0u; i < 300u; ++i )
+		{
+			CT_CHECK( texture.hasGlyph( char32_t( U'a' + i ) ) );
+		}
+
+		texture.cleanup();
+	}
+
+	void FontTextureTest::Lookup()
+	{
+		auto font = doCreateFont( cuT( "FontTextureTest::Lookup" ), 16u );
+		FontTexture texture{ m_engine, font };
+		texture.initialise();
+		doLoadGlyphs( *font, U'a', 1u );
+		texture.update();
+		texture.upload();
+		CT_CHECK( texture.hasGlyph( U'a' ) );
+		CT_CHECK_NOTHROW( texture.getGlyphPosition( U'a' ) );
+		CT_CHECK( !texture.hasGlyph( U'z' ) );
+		CT_CHECK_THROW( texture.getGlyphPosition( U'z' ) );
+		texture.cleanup();
+	}
+}
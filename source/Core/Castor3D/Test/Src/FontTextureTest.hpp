@@ -0,0 +1,26 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_FONT_TEXTURE_TEST_H___
+#define ___C3DT_FONT_TEXTURE_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class FontTextureTest
+		: public C3DTestCase
+	{
+	public:
+		explicit FontTextureTest( castor3d::Engine & engine );
+		virtual ~FontTextureTest();
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void Packing();
+		void Growth();
+		void Lookup();
+	};
+}
+
+#endif
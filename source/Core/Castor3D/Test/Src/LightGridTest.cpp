@@ -0,0 +1,220 @@
+#include "LightGridTest.hpp"
+
+#include <random>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace
+	{
+		void doReset( LightGrid & grid )
+		{
+			Matrix4x4r view;
+			view.setIdentity();
+			grid.reset( view
+				, Angle::fromDegrees( 90.0f )
+				, 16.0f / 9.0f
+				, 0.1f
+				, 100.0f
+				, Size{ 1280u, 720u } );
+		}
+
+		std::vector< uint32_t > doGetLights( LightGrid const & grid
+			, uint32_t x
+			, uint32_t y
+			, uint32_t z )
+		{
+			auto & cluster = grid.getClusters()[grid.getClusterIndex( x, y, z )];
+			auto begin = grid.getIndices().begin() + cluster.m_offset;
+			return std::vector< uint32_t >( begin, begin + cluster.m_pointCount + cluster.m_spotCount );
+		}
+
+		void doFillRandom( std::vector< Point3r > & positions
+			, std::vector< float > & radii
+			, size_t count )
+		{
+			std::mt19937 engine{ 42u };
+			std::uniform_real_distribution< float > xy{ -50.0f, 50.0f };
+			std::uniform_real_distribution< float > z{ -100.0f, 10.0f };
+			std::uniform_real_distribution< float > radius{ 0.5f, 5.0f };
+			positions.resize( count );
+			radii.resize( count );
+
+			for ( size_t i = 0u; i < count; ++i )
+			{
+				positions[i] = Point3r{ xy( engine ), xy( engine ), z( engine ) };
+				radii[i] = radius( engine );
+			}
+		}
+
+		void doAddLights( LightGrid & grid
+			, std::vector< Point3r > const & positions
+			, std::vector< float > const & radii
+			, size_t count )
+		{
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				if ( i % 4u )
+				{
+					grid.addPointLight( i, positions[i], radii[i] );
+				}
+				else
+				{
+					grid.addSpotLight( i, positions[i], radii[i] );
+				}
+			}
+		}
+	}
+
+	//*********************************************************************************************
+
+	LightGridTest::LightGridTest()
+		: TestCase( "LightGridTest" )
+	{
+	}
+
+	LightGridTest::~LightGridTest()
+	{
+	}
+
+	void LightGridTest::doRegisterTests()
+	{
+		doRegisterTest( "LightGridTest::SingleLight", std::bind( &LightGridTest::SingleLight, this ) );
+		doRegisterTest( "LightGridTest::OutsideLights", std::bind( &LightGridTest::OutsideLights, this ) );
+		doRegisterTest( "LightGridTest::LightsOrder", std::bind( &LightGridTest::LightsOrder, this ) );
+		doRegisterTest( "LightGridTest::UnboundedLight", std::bind( &LightGridTest::UnboundedLight, this ) );
+		doRegisterTest( "LightGridTest::ParallelBuild", std::bind( &LightGridTest::ParallelBuild, this ) );
+	}
+
+	void LightGridTest::SingleLight()
+	{
+		LightGrid grid{ Point3ui{ 16u, 8u, 24u }, 1u };
+		doReset( grid );
+		grid.addPointLight( 5u, Point3r{ 0.0f, 0.0f, -10.0f }, 1.0f );
+		grid.build();
+
+		auto slice = grid.getSlice( 10.0f );
+		auto lights = doGetLights( grid, 7u, 3u, slice );
+		CT_EQUAL( lights.size(), 1u );
+		CT_EQUAL( lights[0], 5u );
+		CT_EQUAL( doGetLights( grid, 8u, 4u, slice ).size(), 1u );
+		CT_CHECK( doGetLights( grid, 0u, 0u, slice ).empty() );
+		CT_CHECK( doGetLights( grid, 7u, 3u, 0u ).empty() );
+		CT_CHECK( doGetLights( grid, 7u, 3u, grid.getDimensions()[2] - 1u ).empty() );
+		CT_EQUAL( grid.getSlice( 0.1f ), 0u );
+		CT_EQUAL( grid.getSlice( 100.0f ), grid.getDimensions()[2] - 1u );
+	}
+
+	void LightGridTest::OutsideLights()
+	{
+		LightGrid grid{ Point3ui{ 16u, 8u, 24u }, 1u };
+		doReset( grid );
+		// Behind the camera.
+		grid.addPointLight( 0u, Point3r{ 0.0f, 0.0f, 10.0f }, 1.0f );
+		// Beyond the far plane.
+		grid.addPointLight( 1u, Point3r{ 0.0f, 0.0f, -200.0f }, 1.0f );
+		// Out of the left side of the frustum.
+		grid.addSpotLight( 2u, Point3r{ -100.0f, 0.0f, -10.0f }, 1.0f );
+		grid.build();
+
+		CT_CHECK( grid.getIndices().empty() );
+	}
+
+	void LightGridTest::LightsOrder()
+	{
+		LightGrid grid{ Point3ui{ 16u, 8u, 24u }, 1u };
+		doReset( grid );
+		grid.addSpotLight( 3u, Point3r{ 0.0f, 0.0f, -10.0f }, 2.0f );
+		grid.addPointLight( 1u, Point3r{ 0.5f, 0.0f, -10.0f }, 2.0f );
+		grid.addPointLight( 2u, Point3r{ -0.5f, 0.0f, -10.0f }, 2.0f );
+		grid.build();
+
+		auto index = grid.getClusterIndex( 7u, 3u, grid.getSlice( 10.0f ) );
+		auto & cluster = grid.getClusters()[index];
+		CT_EQUAL( cluster.m_pointCount, 2u );
+		CT_EQUAL( cluster.m_spotCount, 1u );
+		auto lights = doGetLights( grid, 7u, 3u, grid.getSlice( 10.0f ) );
+		CT_REQUIRE( lights.size() == 3u );
+		CT_EQUAL( lights[0], 1u );
+		CT_EQUAL( lights[1], 2u );
+		CT_EQUAL( lights[2], 3u );
+	}
+
+	void LightGridTest::UnboundedLight()
+	{
+		LightGrid grid{ Point3ui{ 16u, 8u, 24u }, 1u };
+		doReset( grid );
+		// Without attenuation, the light reaches the whole frustum, even from behind the camera.
+		grid.addPointLight( 0u, Point3r{ 0.0f, 0.0f, 10.0f }, std::numeric_limits< float >::max() );
+		grid.build();
+
+		auto & dimensions = grid.getDimensions();
+		CT_EQUAL( grid.getIndices().size(), size_t( dimensions[0] * dimensions[1] * dimensions[2] ) );
+		CT_EQUAL( doGetLights( grid, 0u, 0u, 0u ).size(), 1u );
+		CT_EQUAL( doGetLights( grid, dimensions[0] - 1u, dimensions[1] - 1u, dimensions[2] - 1u ).size(), 1u );
+	}
+
+	void LightGridTest::ParallelBuild()
+	{
+		std::vector< Point3r > positions;
+		std::vector< float > radii;
+		doFillRandom( positions, radii, 1000u );
+		LightGrid serial{ Point3ui{ 16u, 8u, 24u }, 1u };
+		LightGrid parallel{ Point3ui{ 16u, 8u, 24u }, 4u };
+		doReset( serial );
+		doReset( parallel );
+		doAddLights( serial, positions, radii, positions.size() );
+		doAddLights( parallel, positions, radii, positions.size() );
+		serial.build();
+		parallel.build();
+
+		CT_CHECK( !serial.getIndices().empty() );
+		CT_CHECK( serial.getIndices() == parallel.getIndices() );
+		CT_REQUIRE( serial.getClusters().size() == parallel.getClusters().size() );
+
+		for ( size_t i = 0u; i < serial.getClusters().size(); ++i )
+		{
+			auto & lhs = serial.getClusters()[i];
+			auto & rhs = parallel.getClusters()[i];
+			CT_EQUAL( lhs.m_offset, rhs.m_offset );
+			CT_EQUAL( lhs.m_pointCount, rhs.m_pointCount );
+			CT_EQUAL( lhs.m_spotCount, rhs.m_spotCount );
+		}
+	}
+
+	//*********************************************************************************************
+
+	LightGridBench::LightGridBench()
+		: BenchCase( "LightGridBench" )
+	{
+		doFillRandom( m_positions, m_radii, 10000u );
+	}
+
+	LightGridBench::~LightGridBench()
+	{
+	}
+
+	void LightGridBench::Execute()
+	{
+		BENCHMARK( BuildGrid1k, 100 );
+		BENCHMARK( BuildGrid10k, 100 );
+	}
+
+	void LightGridBench::BuildGrid1k()
+	{
+		doReset( m_grid );
+		doAddLights( m_grid, m_positions, m_radii, 1000u );
+		m_grid.build();
+		doNotOptimizeAway( m_grid.getIndices().size() );
+	}
+
+	void LightGridBench::BuildGrid10k()
+	{
+		doReset( m_grid );
+		doAddLights( m_grid, m_positions, m_radii, m_positions.size() );
+		m_grid.build();
+		doNotOptimizeAway( m_grid.getIndices().size() );
+	}
+}
@@ -0,0 +1,48 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_LIGHT_GRID_TEST_H___
+#define ___C3DT_LIGHT_GRID_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+#include <Scene/Light/LightGrid.hpp>
+
+namespace Testing
+{
+	class LightGridTest
+		: public TestCase
+	{
+	public:
+		LightGridTest();
+		virtual ~LightGridTest();
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void SingleLight();
+		void OutsideLights();
+		void LightsOrder();
+		void UnboundedLight();
+		void ParallelBuild();
+	};
+
+	class LightGridBench
+		: public BenchCase
+	{
+	public:
+		LightGridBench();
+		virtual ~LightGridBench();
+		void Execute()override;
+
+	private:
+		void BuildGrid1k();
+		void BuildGrid10k();
+
+	private:
+		castor3d::LightGrid m_grid;
+		std::vector< castor::Point3r > m_positions;
+		std::vector< float > m_radii;
+	};
+}
+
+#endif
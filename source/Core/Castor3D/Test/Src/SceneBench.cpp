@@ -0,0 +1,222 @@
+#include "SceneBench.hpp"
+
+#include <Engine.hpp>
+#include <Cache/AnimatedObjectGroupCache.hpp>
+#include <Cache/GeometryCache.hpp>
+#include <Cache/SceneCache.hpp>
+#include <Cache/WindowCache.hpp>
+#include <Render/RenderLoop.hpp>
+#include <Render/RenderQueue.hpp>
+#include <Render/RenderTarget.hpp>
+#include <Material/Material.hpp>
+#include <Material/Pass.hpp>
+#include <Mesh/Mesh.hpp>
+#include <Mesh/Submesh.hpp>
+#include <Miscellaneous/ReferenceCounter.hpp>
+#include <Render/RenderWindow.hpp>
+#include <Scene/Geometry.hpp>
+#include <Scene/SceneFileParser.hpp>
+#include <Scene/SceneNode.hpp>
+#include <Technique/RenderTechnique.hpp>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace
+	{
+		uint64_t constexpr FrameCount = 200u;
+		uint64_t constexpr WarmupCount = 10u;
+
+		RenderWindowSPtr doGetWindow( Engine & engine
+			, Scene const & scene )
+		{
+			auto & windows = engine.getRenderWindowCache();
+			auto lock = makeUniqueLock( windows );
+			auto it = std::find_if( windows.begin()
+				, windows.end()
+				, [&scene]( auto & pair )
+				{
+					return pair.second->getScene().get() == &scene;
+				} );
+			return it == windows.end()
+				? nullptr
+				: it->second;
+		}
+	}
+
+	SceneBench::SceneBench( Engine & engine )
+		: BenchCase{ "SceneBench" }
+		, m_engine{ engine }
+		, m_testDataFolder{ Engine::getDataDirectory() / cuT( "Castor3DTest" ) / cuT( "data" ) }
+	{
+	}
+
+	SceneBench::~SceneBench()
+	{
+	}
+
+	void SceneBench::Execute()
+	{
+		doBenchScene( cuT( "light_directional.cscn" ) );
+		doBenchScene( cuT( "instancing.cscn" ) );
+		doBenchScene( cuT( "Anim.zip" ) );
+		m_engine.cleanup();
+		m_engine.initialise( 1, false );
+	}
+
+	void SceneBench::doBenchScene( String const & name )
+	{
+		SceneSPtr scene;
+
+		{
+			SceneFileParser parser{ m_engine };
+
+			if ( parser.parseFile( m_testDataFolder / name )
+				&& parser.scenesBegin() != parser.scenesEnd() )
+			{
+				scene = parser.scenesBegin()->second;
+			}
+		}
+
+		auto window = scene
+			? doGetWindow( m_engine, *scene )
+			: nullptr;
+
+		if ( !window )
+		{
+			std::cout << "*	Couldn't load the scene " << string::stringCast< char >( name ) << std::endl;
+			return;
+		}
+
+		window->initialise( Size{ 800, 600 }, WindowHandle{ std::make_shared< TestWindowHandle >() } );
+		m_engine.getRenderLoop().renderSyncFrame();
+		auto technique = window->getRenderTarget()->getTechnique();
+		auto camera = window->getCamera();
+		auto prefix = string::stringCast< char >( name ) + ": ";
+
+		auto updateQueues = [&technique]()
+		{
+			RenderQueueArray queues;
+			technique->update( queues );
+
+			for ( auto & queue : queues )
+			{
+				queue.get().update();
+			}
+		};
+
+		doBench( prefix + "scene update"
+			, [&scene]()
+			{
+				scene->update();
+			}
+			, FrameCount
+			, WarmupCount );
+		doBench( prefix + "animations update"
+			, [&scene]()
+			{
+				scene->getAnimatedObjectGroupCache().forEach( []( AnimatedObjectGroup & group )
+				{
+					group.update();
+				} );
+			}
+			, FrameCount
+			, WarmupCount );
+		doBench( prefix + "render queues update"
+			, updateQueues
+			, FrameCount
+			, WarmupCount );
+		doBenchTraversal( prefix, *scene, updateQueues );
+
+		if ( camera && camera->getParent() )
+		{
+			// Moving the camera invalidates the prepared render nodes, so the queues update runs the culling.
+			auto node = camera->getParent();
+			doBenchReferences( prefix + "culling"
+				, [&node, &camera, &updateQueues]()
+				{
+					node->yaw( Angle::fromDegrees( 1.0_r ) );
+					node->update();
+					camera->update();
+					updateQueues();
+				} );
+		}
+
+		scene->cleanup();
+		window->cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+		m_engine.getSceneCache().remove( scene->getName() );
+		m_engine.getRenderWindowCache().remove( window->getName() );
+	}
+
+	void SceneBench::doBenchTraversal( std::string const & prefix
+		, Scene const & scene
+		, std::function< void() > const & updateQueues )
+	{
+		// The render queues sort walks the geometries, their nodes, meshes, submeshes, materials and passes through handles.
+		// The same walk through the shared pointer accessors gives the cost of the reference counting they avoid.
+		doBenchReferences( prefix + "objects traversal (shared pointers)"
+			, [&scene]()
+			{
+				auto primitives = scene.getGeometryCache().getSnapshot();
+
+				for ( auto & primitive : *primitives )
+				{
+					auto & geometry = *primitive.second;
+					auto node = geometry.getParent();
+					auto mesh = geometry.getMesh();
+
+					if ( node && node->isVisible() && mesh )
+					{
+						for ( uint32_t i = 0u; i < mesh->getSubmeshCount(); ++i )
+						{
+							auto submesh = mesh->getSubmesh( i );
+							auto material = geometry.getMaterial( *submesh );
+
+							if ( material )
+							{
+								for ( uint32_t j = 0u; j < material->getPassCount(); ++j )
+								{
+									auto pass = material->getPass( j );
+									pass->hasAlphaBlending();
+								}
+							}
+						}
+					}
+				}
+			} );
+		doBenchReferences( prefix + "render queues sort"
+			, [&scene, &updateQueues]()
+			{
+				// Forces the render queues to sort their nodes again.
+				scene.onChanged( scene );
+				updateQueues();
+			} );
+	}
+
+	void SceneBench::doBenchReferences( std::string const & name
+		, std::function< void() > const & bench )
+	{
+		doBench( name
+			, bench
+			, FrameCount
+			, WarmupCount );
+
+#if C3D_COUNT_REFERENCES
+
+		auto acquisitions = ReferenceCounter::getAcquisitions();
+		bench();
+		acquisitions = ReferenceCounter::getAcquisitions() - acquisitions;
+		std::cout << "*	" << name << ": "
+			<< acquisitions << " shared pointers acquisitions per frame ("
+			<< 2u * acquisitions << " reference count operations)" << std::endl;
+
+#else
+
+		std::cout << "*	" << name << ": shared pointers acquisitions not counted, C3D_COUNT_REFERENCES is disabled" << std::endl;
+
+#endif
+	}
+}
@@ -0,0 +1,31 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_SCENE_BENCH_H___
+#define ___C3DT_SCENE_BENCH_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class SceneBench
+		: public BenchCase
+	{
+	public:
+		explicit SceneBench( castor3d::Engine & engine );
+		virtual ~SceneBench();
+		void Execute()override;
+
+	private:
+		void doBenchScene( castor::String const & name );
+		void doBenchTraversal( std::string const & prefix
+			, castor3d::Scene const & scene
+			, std::function< void() > const & updateQueues );
+		void doBenchReferences( std::string const & name
+			, std::function< void() > const & bench );
+
+	private:
+		castor3d::Engine & m_engine;
+		castor::Path m_testDataFolder;
+	};
+}
+
+#endif
@@ -145,6 +145,8 @@ namespace Testing
 		doRegisterTest( "SceneExportTest::InstancedScene", std::bind( &SceneExportTest::InstancedScene, this ) );
 		doRegisterTest( "SceneExportTest::AlphaScene", std::bind( &SceneExportTest::AlphaScene, this ) );
 		doRegisterTest( "SceneExportTest::AnimatedScene", std::bind( &SceneExportTest::AnimatedScene, this ) );
+		doRegisterTest( "SceneExportTest::CompiledScene", std::bind( &SceneExportTest::CompiledScene, this ) );
+		doRegisterTest( "SceneExportTest::RelocatedCompiledScene", std::bind( &SceneExportTest::RelocatedCompiledScene, this ) );
 	}
 
 	void SceneExportTest::SimpleScene()
@@ -167,6 +169,95 @@ namespace Testing
 		doTestScene( cuT( "Anim.zip" ) );
 	}
 
+	void SceneExportTest::CompiledScene()
+	{
+		Path path{ cuT( "TestScene.cscb" ) };
+		SceneSPtr src;
+
+		{
+			SceneFileParser srcParser{ m_engine };
+			CT_REQUIRE( srcParser.compileFile( m_testDataFolder / cuT( "light_directional.cscn" ), path ) );
+			CT_REQUIRE( srcParser.scenesBegin() != srcParser.scenesEnd() );
+			src = srcParser.scenesBegin()->second;
+		}
+
+		RenameObject( src, m_engine.getSceneCache() );
+		auto srcWindow = getWindow( m_engine, src->getName(), true );
+		CT_CHECK( srcWindow != nullptr );
+		srcWindow->initialise( Size{ 800, 600 }, WindowHandle{ std::make_shared< TestWindowHandle >() } );
+		m_engine.getRenderLoop().renderSyncFrame();
+
+		SceneSPtr dst{ doParseScene( path ) };
+		CT_EQUAL( *src, *dst );
+		auto dstWindow = getWindow( m_engine, dst->getName(), false );
+		CT_CHECK( dstWindow != nullptr );
+		File::deleteFile( path );
+		src->cleanup();
+		srcWindow->cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+		m_engine.getSceneCache().remove( src->getName() );
+		m_engine.getRenderWindowCache().remove( srcWindow->getName() );
+		srcWindow.reset();
+		src.reset();
+		dst->cleanup();
+		dstWindow->cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+		m_engine.getSceneCache().remove( dst->getName() );
+		m_engine.getRenderWindowCache().remove( dstWindow->getName() );
+		dstWindow.reset();
+		dst.reset();
+		DeCleanupEngine();
+	}
+
+	void SceneExportTest::RelocatedCompiledScene()
+	{
+		// The archive is compiled from a folder that is then removed, the compiled file is loaded from a copy of it.
+		Path const source{ cuT( "CompiledSource" ) };
+		Path const target{ cuT( "CompiledTarget" ) };
+		CT_REQUIRE( File::directoryCreate( source ) );
+		CT_REQUIRE( File::directoryCreate( target ) );
+		CT_REQUIRE( File::copyFile( m_testDataFolder / cuT( "Anim.zip" ), source ) );
+		SceneSPtr src;
+
+		{
+			SceneFileParser srcParser{ m_engine };
+			CT_REQUIRE( srcParser.compileFile( source / cuT( "Anim.zip" ), source / cuT( "TestScene.cscb" ) ) );
+			CT_REQUIRE( srcParser.scenesBegin() != srcParser.scenesEnd() );
+			src = srcParser.scenesBegin()->second;
+		}
+
+		CT_REQUIRE( File::copyFile( source / cuT( "Anim.zip" ), target ) );
+		CT_REQUIRE( File::copyFile( source / cuT( "TestScene.cscb" ), target ) );
+		File::directoryDelete( source );
+
+		RenameObject( src, m_engine.getSceneCache() );
+		auto srcWindow = getWindow( m_engine, src->getName(), true );
+		CT_CHECK( srcWindow != nullptr );
+		srcWindow->initialise( Size{ 800, 600 }, WindowHandle{ std::make_shared< TestWindowHandle >() } );
+		m_engine.getRenderLoop().renderSyncFrame();
+
+		SceneSPtr dst{ doParseScene( target / cuT( "TestScene.cscb" ) ) };
+		CT_EQUAL( *src, *dst );
+		auto dstWindow = getWindow( m_engine, dst->getName(), false );
+		CT_CHECK( dstWindow != nullptr );
+		File::directoryDelete( target );
+		src->cleanup();
+		srcWindow->cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+		m_engine.getSceneCache().remove( src->getName() );
+		m_engine.getRenderWindowCache().remove( srcWindow->getName() );
+		srcWindow.reset();
+		src.reset();
+		dst->cleanup();
+		dstWindow->cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+		m_engine.getSceneCache().remove( dst->getName() );
+		m_engine.getRenderWindowCache().remove( dstWindow->getName() );
+		dstWindow.reset();
+		dst.reset();
+		DeCleanupEngine();
+	}
+
 	SceneSPtr SceneExportTest::doParseScene( Path const & p_path )
 	{
 		SceneFileParser dstParser{ m_engine };
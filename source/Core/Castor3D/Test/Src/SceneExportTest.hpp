@@ -23,6 +23,8 @@ namespace Testing
 		void InstancedScene();
 		void AlphaScene();
 		void AnimatedScene();
+		void CompiledScene();
+		void RelocatedCompiledScene();
 
 	private:
 		castor3d::SceneSPtr doParseScene( castor::Path const & p_path );
@@ -0,0 +1,256 @@
+#include "SceneNodeTest.hpp"
+
+#include <Engine.hpp>
+#include <Scene/Scene.hpp>
+#include <Scene/SceneNode.hpp>
+#include <Scene/SceneNodePool.hpp>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace
+	{
+		bool doIsNear( Point3r const & lhs, Point3r const & rhs )
+		{
+			return std::abs( lhs[0] - rhs[0] ) < 0.0001_r
+				&& std::abs( lhs[1] - rhs[1] ) < 0.0001_r
+				&& std::abs( lhs[2] - rhs[2] ) < 0.0001_r;
+		}
+
+		Point3r doGetWorldPosition( SceneNode const & node )
+		{
+			return matrix::getTransformed( node.getDerivedTransformationMatrix(), Point3r{} );
+		}
+
+		SceneNodeSPtr doCreateNode( Scene & scene
+			, String const & name
+			, SceneNodeSPtr parent )
+		{
+			auto result = std::make_shared< SceneNode >( name, scene );
+			result->attachTo( parent );
+			return result;
+		}
+	}
+
+	SceneNodeTest::SceneNodeTest( Engine & engine )
+		: C3DTestCase{ "SceneNodeTest", engine }
+	{
+	}
+
+	SceneNodeTest::~SceneNodeTest()
+	{
+	}
+
+	void SceneNodeTest::doRegisterTests()
+	{
+		doRegisterTest( "SceneNodeTest::Hierarchy", std::bind( &SceneNodeTest::Hierarchy, this ) );
+		doRegisterTest( "SceneNodeTest::Notifications", std::bind( &SceneNodeTest::Notifications, this ) );
+		doRegisterTest( "SceneNodeTest::SubtreeUpdate", std::bind( &SceneNodeTest::SubtreeUpdate, this ) );
+		doRegisterTest( "SceneNodeTest::Reparent", std::bind( &SceneNodeTest::Reparent, this ) );
+		doRegisterTest( "SceneNodeTest::ParentDestruction", std::bind( &SceneNodeTest::ParentDestruction, this ) );
+		doRegisterTest( "SceneNodeTest::ReusedAddress", std::bind( &SceneNodeTest::ReusedAddress, this ) );
+	}
+
+	void SceneNodeTest::Hierarchy()
+	{
+		Scene scene{ cuT( "TestScene" ), m_engine };
+		auto parent = doCreateNode( scene, cuT( "Parent" ), scene.getObjectRootNode() );
+		auto child = doCreateNode( scene, cuT( "Child" ), parent );
+		auto leaf = doCreateNode( scene, cuT( "Leaf" ), child );
+		parent->setPosition( Point3r{ 1.0_r, 0.0_r, 0.0_r } );
+		child->setPosition( Point3r{ 0.0_r, 2.0_r, 0.0_r } );
+		child->setScale( Point3r{ 2.0_r, 2.0_r, 2.0_r } );
+		leaf->setPosition( Point3r{ 0.0_r, 0.0_r, 3.0_r } );
+		scene.getSceneNodePool()->update();
+
+		CT_CHECK( !leaf->isModified() );
+		CT_CHECK( doIsNear( doGetWorldPosition( *child ), Point3r{ 1.0_r, 2.0_r, 0.0_r } ) );
+		CT_CHECK( doIsNear( doGetWorldPosition( *leaf ), Point3r{ 1.0_r, 2.0_r, 6.0_r } ) );
+		CT_CHECK( doIsNear( leaf->getDerivedPosition(), doGetWorldPosition( *leaf ) ) );
+
+		parent->translate( Point3r{ 0.0_r, 0.0_r, -1.0_r } );
+		CT_CHECK( parent->isModified() );
+		scene.getSceneNodePool()->update();
+		CT_CHECK( doIsNear( doGetWorldPosition( *leaf ), Point3r{ 1.0_r, 2.0_r, 5.0_r } ) );
+
+		leaf->detach();
+		child->detach();
+		parent->detach();
+	}
+
+	void SceneNodeTest::Notifications()
+	{
+		Scene scene{ cuT( "TestScene" ), m_engine };
+		auto parent = doCreateNode( scene, cuT( "Parent" ), scene.getObjectRootNode() );
+		auto child = doCreateNode( scene, cuT( "Child" ), parent );
+		auto sibling = doCreateNode( scene, cuT( "Sibling" ), scene.getObjectRootNode() );
+		std::map< String, uint32_t > notified;
+		auto onChanged = [&notified]( SceneNode const & node )
+		{
+			++notified[node.getName()];
+		};
+		auto parentConnection = parent->onChanged.connect( onChanged );
+		auto childConnection = child->onChanged.connect( onChanged );
+		auto siblingConnection = sibling->onChanged.connect( onChanged );
+		size_t batched = 0u;
+		auto batchConnection = scene.getChanges().onSceneNodesChanged.connect( [&batched]( std::vector< SceneNode const * > const & nodes )
+		{
+			batched += nodes.size();
+		} );
+		scene.getSceneNodePool()->update();
+		scene.getChanges().flush();
+		CT_EQUAL( notified[cuT( "Parent" )], 1u );
+		CT_EQUAL( notified[cuT( "Child" )], 1u );
+		CT_EQUAL( notified[cuT( "Sibling" )], 1u );
+
+		// The changes are notified when the journal is flushed, once per node,
+		// and only for the modified node and its descendants.
+		notified.clear();
+		batched = 0u;
+		parent->yaw( Angle::fromDegrees( 90.0_r ) );
+		scene.getSceneNodePool()->update();
+		parent->translate( Point3r{ 1.0_r, 0.0_r, 0.0_r } );
+		scene.getSceneNodePool()->update();
+		CT_CHECK( notified.empty() );
+		scene.getChanges().flush();
+		CT_EQUAL( notified[cuT( "Parent" )], 1u );
+		CT_EQUAL( notified[cuT( "Child" )], 1u );
+		CT_EQUAL( notified[cuT( "Sibling" )], 0u );
+		CT_EQUAL( batched, 2u );
+
+		notified.clear();
+		batched = 0u;
+		scene.getSceneNodePool()->update();
+		scene.getChanges().flush();
+		CT_CHECK( notified.empty() );
+		CT_EQUAL( batched, 0u );
+
+		// An explicit node update notifies the node right away, the journal only gives it to the batched signal.
+		sibling->translate( Point3r{ 1.0_r, 0.0_r, 0.0_r } );
+		sibling->update();
+		CT_EQUAL( notified[cuT( "Sibling" )], 1u );
+		scene.getChanges().flush();
+		CT_EQUAL( notified[cuT( "Sibling" )], 1u );
+		CT_EQUAL( batched, 1u );
+
+		child->detach();
+		parent->detach();
+		sibling->detach();
+	}
+
+	void SceneNodeTest::SubtreeUpdate()
+	{
+		Scene scene{ cuT( "TestScene" ), m_engine };
+		auto first = doCreateNode( scene, cuT( "First" ), scene.getObjectRootNode() );
+		auto firstChild = doCreateNode( scene, cuT( "FirstChild" ), first );
+		auto second = doCreateNode( scene, cuT( "Second" ), scene.getObjectRootNode() );
+		scene.getSceneNodePool()->update();
+
+		first->setPosition( Point3r{ 1.0_r, 0.0_r, 0.0_r } );
+		second->setPosition( Point3r{ 2.0_r, 0.0_r, 0.0_r } );
+		first->update();
+		CT_CHECK( !first->isModified() );
+		CT_CHECK( doIsNear( doGetWorldPosition( *firstChild ), Point3r{ 1.0_r, 0.0_r, 0.0_r } ) );
+		CT_CHECK( second->isModified() );
+		CT_CHECK( doIsNear( doGetWorldPosition( *second ), Point3r{} ) );
+
+		firstChild->detach();
+		first->detach();
+		second->detach();
+	}
+
+	void SceneNodeTest::Reparent()
+	{
+		Scene scene{ cuT( "TestScene" ), m_engine };
+		auto first = doCreateNode( scene, cuT( "First" ), scene.getObjectRootNode() );
+		auto second = doCreateNode( scene, cuT( "Second" ), scene.getObjectRootNode() );
+		auto child = doCreateNode( scene, cuT( "Child" ), first );
+		first->setPosition( Point3r{ 1.0_r, 0.0_r, 0.0_r } );
+		second->setPosition( Point3r{ 0.0_r, 1.0_r, 0.0_r } );
+		child->setPosition( Point3r{ 0.0_r, 0.0_r, 1.0_r } );
+		scene.getSceneNodePool()->update();
+		CT_CHECK( doIsNear( doGetWorldPosition( *child ), Point3r{ 1.0_r, 0.0_r, 1.0_r } ) );
+
+		child->attachTo( second );
+		scene.getSceneNodePool()->update();
+		CT_CHECK( doIsNear( doGetWorldPosition( *child ), Point3r{ 0.0_r, 1.0_r, 1.0_r } ) );
+
+		// Moving a node into another scene moves its subtree's transform data into that scene's pool.
+		Scene other{ cuT( "OtherScene" ), m_engine };
+		auto otherRoot = doCreateNode( other, cuT( "OtherRoot" ), other.getObjectRootNode() );
+		otherRoot->setPosition( Point3r{ 5.0_r, 0.0_r, 0.0_r } );
+		second->attachTo( otherRoot );
+		other.getSceneNodePool()->update();
+		CT_CHECK( doIsNear( doGetWorldPosition( *child ), Point3r{ 5.0_r, 1.0_r, 1.0_r } ) );
+
+		child->detach();
+		first->detach();
+		second->detach();
+		otherRoot->detach();
+	}
+
+	void SceneNodeTest::ParentDestruction()
+	{
+		Scene scene{ cuT( "TestScene" ), m_engine };
+		auto parent = doCreateNode( scene, cuT( "Parent" ), scene.getObjectRootNode() );
+		auto child = doCreateNode( scene, cuT( "Child" ), parent );
+		auto leaf = doCreateNode( scene, cuT( "Leaf" ), child );
+		parent->setPosition( Point3r{ 1.0_r, 0.0_r, 0.0_r } );
+		child->setPosition( Point3r{ 0.0_r, 2.0_r, 0.0_r } );
+		leaf->setPosition( Point3r{ 0.0_r, 0.0_r, 3.0_r } );
+		scene.getSceneNodePool()->update();
+		CT_CHECK( doIsNear( doGetWorldPosition( *leaf ), Point3r{ 1.0_r, 2.0_r, 3.0_r } ) );
+
+		// The destroyed parent's children become roots, and keep being updated.
+		parent->detach();
+		parent.reset();
+		CT_CHECK( !child->getParent() );
+		scene.getSceneNodePool()->update();
+		CT_CHECK( doIsNear( doGetWorldPosition( *child ), Point3r{ 0.0_r, 2.0_r, 0.0_r } ) );
+		CT_CHECK( doIsNear( doGetWorldPosition( *leaf ), Point3r{ 0.0_r, 2.0_r, 3.0_r } ) );
+
+		child->translate( Point3r{ 1.0_r, 0.0_r, 0.0_r } );
+		child->update();
+		CT_CHECK( doIsNear( doGetWorldPosition( *leaf ), Point3r{ 1.0_r, 2.0_r, 3.0_r } ) );
+
+		// The released slot is reused, the orphans must not follow the new node.
+		auto other = doCreateNode( scene, cuT( "Other" ), scene.getObjectRootNode() );
+		other->setPosition( Point3r{ 0.0_r, 0.0_r, 10.0_r } );
+		scene.getSceneNodePool()->update();
+		CT_CHECK( doIsNear( doGetWorldPosition( *leaf ), Point3r{ 1.0_r, 2.0_r, 3.0_r } ) );
+
+		leaf->detach();
+		child->detach();
+		other->detach();
+	}
+	void SceneNodeTest::ReusedAddress()
+	{
+		Scene scene{ cuT( "TestScene" ), m_engine };
+		auto node = doCreateNode( scene, cuT( "Node" ), scene.getObjectRootNode() );
+		scene.getSceneNodePool()->update();
+		scene.getChanges().flush();
+		std::vector< SceneNode const * > batched;
+		auto batchConnection = scene.getChanges().onSceneNodesChanged.connect( [&batched]( std::vector< SceneNode const * > const & nodes )
+		{
+			batched.insert( batched.end(), nodes.begin(), nodes.end() );
+		} );
+
+		// A destroyed node's records are dropped, but a new node allocated at the same address
+		// before the flush must still be notified, which is simulated by recording the address again.
+		auto & changes = scene.getChanges();
+		changes.record( { node.get() } );
+		changes.forget( node.get() );
+		changes.flush();
+		CT_CHECK( batched.empty() );
+		changes.record( { node.get() } );
+		changes.forget( node.get() );
+		changes.record( { node.get() } );
+		changes.flush();
+		CT_EQUAL( batched.size(), 1u );
+		CT_CHECK( !batched.empty() && batched.front() == node.get() );
+
+		node->detach();
+	}
+}
@@ -0,0 +1,29 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_SCENE_NODE_TEST_H___
+#define ___C3DT_SCENE_NODE_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class SceneNodeTest
+		: public C3DTestCase
+	{
+	public:
+		explicit SceneNodeTest( castor3d::Engine & engine );
+		virtual ~SceneNodeTest();
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void Hierarchy();
+		void Notifications();
+		void SubtreeUpdate();
+		void Reparent();
+		void ParentDestruction();
+		void ReusedAddress();
+	};
+}
+
+#endif
@@ -8,8 +8,13 @@
 
 #include <BenchManager.hpp>
 
+#include "AssetLoaderTest.hpp"
 #include "BinaryExportTest.hpp"
+#include "FontTextureTest.hpp"
+#include "LightGridTest.hpp"
+#include "SceneBench.hpp"
 #include "SceneExportTest.hpp"
+#include "SceneNodeTest.hpp"
 
 using namespace castor;
 using namespace castor3d;
@@ -120,12 +125,7 @@ namespace
 int main( int argc, char const * argv[] )
 {
 	int result = EXIT_SUCCESS;
-	int count = 1;
-
-	if ( argc == 2 )
-	{
-		count = std::max< int >( 1, atoi( argv[2] ) );
-	}
+	int count = Testing::BenchManager::parseArguments( argc, argv );
 
 #if defined( NDEBUG )
 	castor::Logger::initialise( castor::LogType::eInfo );
@@ -140,6 +140,14 @@ int main( int argc, char const * argv[] )
 		// Test cases.
 		Testing::registerType( std::make_unique< Testing::BinaryExportTest >( *engine ) );
 		Testing::registerType( std::make_unique< Testing::SceneExportTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::SceneNodeTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::FontTextureTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::LightGridTest >() );
+		Testing::registerType( std::make_unique< Testing::LightGridBench >() );
+		Testing::registerType( std::make_unique< Testing::AssetLoaderTest >() );
+
+		// Scenario benchmarks.
+		Testing::registerType( std::make_unique< Testing::SceneBench >( *engine ) );
 
 		// Tests loop.
 		BENCHLOOP( count, result );
@@ -3,11 +3,80 @@
 #include "UnitTest.hpp"
 
 #include <algorithm>
+#include <cctype>
+#include <fstream>
 
 namespace Testing
 {
+	namespace
+	{
+		std::string doEscape( std::string const & text )
+		{
+			std::string result;
+
+			for ( auto c : text )
+			{
+				if ( c == '"' || c == '\\' )
+				{
+					result += '\\';
+				}
+
+				result += c;
+			}
+
+			return result;
+		}
+
+		bool doFindString( std::string const & line
+			, std::string const & key
+			, std::string & value )
+		{
+			auto prefix = "\"" + key + "\": \"";
+			auto index = line.find( prefix );
+
+			if ( index == std::string::npos )
+			{
+				return false;
+			}
+
+			value.clear();
+			index += prefix.size();
+
+			while ( index < line.size() && line[index] != '"' )
+			{
+				if ( line[index] == '\\' && index + 1 < line.size() )
+				{
+					++index;
+				}
+
+				value += line[index++];
+			}
+
+			return index < line.size();
+		}
+
+		template< typename ValueT >
+		bool doFindNumber( std::string const & line
+			, std::string const & key
+			, ValueT & value )
+		{
+			auto prefix = "\"" + key + "\": ";
+			auto index = line.find( prefix );
+
+			if ( index == std::string::npos )
+			{
+				return false;
+			}
+
+			std::stringstream stream{ line.substr( index + prefix.size() ) };
+			stream >> value;
+			return !stream.fail();
+		}
+	}
+
 	std::vector< BenchCaseUPtr > BenchManager::m_benchs;
 	std::vector< TestCaseUPtr > BenchManager::m_cases;
+	BenchOptions BenchManager::m_options;
 
 	BenchManager::BenchManager()
 	{
@@ -30,8 +99,57 @@ namespace Testing
 		m_cases.push_back( std::move( p_case ) );
 	}
 
-	void BenchManager::ExecuteBenchs()
+	int BenchManager::parseArguments( int argc, char const * const argv[] )
+	{
+		int result = 1;
+
+		for ( int i = 1; i < argc; ++i )
+		{
+			std::string arg = argv[i];
+			bool hasValue = i + 1 < argc;
+
+			if ( arg == "--warmup" && hasValue )
+			{
+				m_options.warmups = std::max< int64_t >( 0, std::stoll( argv[++i] ) );
+			}
+			else if ( arg == "--iterations" && hasValue )
+			{
+				m_options.iterations = std::max< int64_t >( 1, std::stoll( argv[++i] ) );
+			}
+			else if ( arg == "--json" && hasValue )
+			{
+				m_options.jsonFile = argv[++i];
+			}
+			else if ( arg == "--baseline" && hasValue )
+			{
+				m_options.baselineFile = argv[++i];
+			}
+			else if ( arg == "--tolerance" && hasValue )
+			{
+				m_options.tolerance = std::max( 0.0, std::stod( argv[++i] ) );
+			}
+			else if ( !arg.empty() && std::all_of( arg.begin(), arg.end(), ::isdigit ) )
+			{
+				result = std::max< int >( 1, atoi( arg.c_str() ) );
+			}
+			else
+			{
+				std::cerr << "Unknown or incomplete option: " << arg << std::endl;
+			}
+		}
+
+		return result;
+	}
+
+	BenchOptions const & BenchManager::getOptions()
+	{
+		return m_options;
+	}
+
+	uint32_t BenchManager::ExecuteBenchs()
 	{
+		uint32_t result = 0u;
+		std::vector< BenchResult > results;
 		std::cout << "*********************************************************************************************" << std::endl;
 		std::stringstream benchSep;
 		benchSep.width( BENCH_TITLE_WIDTH );
@@ -46,7 +164,9 @@ namespace Testing
 
 			for ( auto & bench : m_benchs )
 			{
+				bench->m_results.clear();
 				bench->Execute();
+				results.insert( results.end(), bench->getResults().begin(), bench->getResults().end() );
 			}
 
 			std::cout << std::endl;
@@ -58,7 +178,37 @@ namespace Testing
 			std::cout << "No bench" << std::endl;
 		}
 
+		if ( !m_options.jsonFile.empty() )
+		{
+			std::ofstream file{ m_options.jsonFile };
+
+			if ( file )
+			{
+				writeResults( file, results );
+			}
+			else
+			{
+				std::cout << "Couldn't write the benchs results to " << m_options.jsonFile << std::endl;
+			}
+		}
+
+		if ( !m_options.baselineFile.empty() )
+		{
+			std::ifstream file{ m_options.baselineFile };
+
+			if ( file )
+			{
+				result = compareResults( results, readResults( file ), m_options.tolerance );
+			}
+			else
+			{
+				std::cout << "Couldn't read the benchs baseline from " << m_options.baselineFile << std::endl;
+				result = 1u;
+			}
+		}
+
 		std::cout << "*********************************************************************************************" << std::endl;
+		return result;
 	}
 
 	void BenchManager::BenchsSummary()
@@ -118,6 +268,100 @@ namespace Testing
 		return errCount;
 	}
 
+	void BenchManager::writeResults( std::ostream & stream, std::vector< BenchResult > const & results )
+	{
+		stream << "{\n\t\"benchmarks\": [";
+
+		for ( auto it = results.begin(); it != results.end(); ++it )
+		{
+			stream << ( it == results.begin() ? "\n" : ",\n" );
+			stream << "\t\t{ \"case\": \"" << doEscape( it->caseName ) << "\""
+				<< ", \"name\": \"" << doEscape( it->name ) << "\""
+				<< ", \"iterations\": " << it->iterations
+				<< ", \"total\": " << it->total
+				<< ", \"mean\": " << it->mean
+				<< ", \"stddev\": " << it->stddev
+				<< ", \"min\": " << it->min
+				<< ", \"max\": " << it->max
+				<< ", \"p50\": " << it->p50
+				<< ", \"p95\": " << it->p95
+				<< ", \"p99\": " << it->p99
+				<< " }";
+		}
+
+		stream << "\n\t]\n}\n";
+	}
+
+	std::vector< BenchResult > BenchManager::readResults( std::istream & stream )
+	{
+		// Reads the results written by writeResults, one per line.
+		std::vector< BenchResult > result;
+		std::string line;
+
+		while ( std::getline( stream, line ) )
+		{
+			BenchResult bench{};
+
+			if ( doFindString( line, "case", bench.caseName )
+				&& doFindString( line, "name", bench.name )
+				&& doFindNumber( line, "p50", bench.p50 ) )
+			{
+				doFindNumber( line, "iterations", bench.iterations );
+				doFindNumber( line, "total", bench.total );
+				doFindNumber( line, "mean", bench.mean );
+				doFindNumber( line, "stddev", bench.stddev );
+				doFindNumber( line, "min", bench.min );
+				doFindNumber( line, "max", bench.max );
+				doFindNumber( line, "p95", bench.p95 );
+				doFindNumber( line, "p99", bench.p99 );
+				result.push_back( bench );
+			}
+		}
+
+		return result;
+	}
+
+	uint32_t BenchManager::compareResults( std::vector< BenchResult > const & results
+		, std::vector< BenchResult > const & baseline
+		, double tolerance )
+	{
+		uint32_t result = 0u;
+		std::cout << std::endl;
+		std::cout << "Baseline comparison (p50, tolerance " << tolerance << "%)" << std::endl;
+
+		for ( auto & bench : results )
+		{
+			auto it = std::find_if( baseline.begin()
+				, baseline.end()
+				, [&bench]( BenchResult const & lookup )
+				{
+					return lookup.caseName == bench.caseName
+						&& lookup.name == bench.name;
+				} );
+			std::cout << "*	" << bench.caseName << " - " << bench.name << ": " << bench.p50 << "ms";
+
+			if ( it == baseline.end() || it->p50 <= 0.0 )
+			{
+				std::cout << ", no baseline" << std::endl;
+			}
+			else
+			{
+				auto change = 100.0 * ( bench.p50 - it->p50 ) / it->p50;
+				std::cout << ", baseline " << it->p50 << "ms (" << ( change >= 0.0 ? "+" : "" ) << change << "%)";
+
+				if ( change > tolerance )
+				{
+					std::cout << ", REGRESSION";
+					++result;
+				}
+
+				std::cout << std::endl;
+			}
+		}
+
+		return result;
+	}
+
 	//*************************************************************************************************
 
 	bool registerType( BenchCaseUPtr p_bench )
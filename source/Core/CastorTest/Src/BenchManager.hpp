@@ -6,6 +6,25 @@
 
 namespace Testing
 {
+	///
+	/// \struct BenchOptions
+	///
+	/// The benchmarks options, read from the command line by BenchManager::parseArguments.
+	///
+	struct BenchOptions
+	{
+		//! --warmup N: the unmeasured calls count for every bench (-1 keeps the benchs values).
+		int64_t warmups{ -1 };
+		//! --iterations N: the measured calls count for every bench (-1 keeps the benchs values).
+		int64_t iterations{ -1 };
+		//! --json FILE: the file receiving the benchs results.
+		std::string jsonFile;
+		//! --baseline FILE: a results file, previously written with --json, the results are compared to.
+		std::string baselineFile;
+		//! --tolerance PERCENT: the allowed p50 increase, relative to the baseline.
+		double tolerance{ 10.0 };
+	};
+
 	class BenchManager
 	{
 	public:
@@ -13,13 +32,31 @@ namespace Testing
 		~BenchManager();
 		static void registerType( BenchCaseUPtr p_bench );
 		static void registerType( TestCaseUPtr p_case );
-		static void ExecuteBenchs();
+		///
+		/// Reads the options from the command line, the remaining numeric argument is the benchmarks loops count, returned.
+		///
+		static int parseArguments( int argc, char const * const argv[] );
+		static BenchOptions const & getOptions();
+		///
+		/// Runs the benchs, writes the results and compares them to the baseline, as requested by the options.
+		/// Returns the number of regressions.
+		///
+		static uint32_t ExecuteBenchs();
 		static void BenchsSummary();
 		static uint32_t ExecuteTests();
+		static void writeResults( std::ostream & stream, std::vector< BenchResult > const & results );
+		static std::vector< BenchResult > readResults( std::istream & stream );
+		///
+		/// Returns the number of results whose p50 exceeds the baseline's one by more than tolerance percents.
+		///
+		static uint32_t compareResults( std::vector< BenchResult > const & results
+			, std::vector< BenchResult > const & baseline
+			, double tolerance );
 
 	private:
 		static std::vector< BenchCaseUPtr > m_benchs;
 		static std::vector< TestCaseUPtr > m_cases;
+		static BenchOptions m_options;
 	};
 
 	bool registerType( BenchCaseUPtr p_bench );
@@ -29,7 +66,7 @@ namespace Testing
 		p_return = ::Testing::BenchManager::ExecuteTests();\
 		for( int i = 0; i < p_iMax; ++i )\
 		{\
-			::Testing::BenchManager::ExecuteBenchs();\
+			p_return += int( ::Testing::BenchManager::ExecuteBenchs() );\
 		}\
 		if( p_iMax > 1 )\
 		{\
@@ -1,10 +1,62 @@
 #include "Benchmark.hpp"
+#include "BenchManager.hpp"
 
 namespace Testing
 {
+	namespace
+	{
+		double doGetMilliseconds( std::chrono::nanoseconds const & time )
+		{
+			return double( time.count() ) / 1000000.0;
+		}
+
+		double doGetPercentile( std::vector< std::chrono::nanoseconds > const & sorted
+			, double percentile )
+		{
+			auto rank = size_t( std::ceil( percentile * double( sorted.size() ) ) );
+			return doGetMilliseconds( sorted[std::min( sorted.size(), std::max< size_t >( 1u, rank ) ) - 1u] );
+		}
+	}
+
+	BenchResult computeBenchResult( std::string const & caseName
+		, std::string const & name
+		, std::vector< std::chrono::nanoseconds > samples )
+	{
+		BenchResult result{ caseName, name, uint64_t( samples.size() ) };
+
+		if ( !samples.empty() )
+		{
+			std::sort( samples.begin(), samples.end() );
+			std::chrono::nanoseconds total{};
+
+			for ( auto & sample : samples )
+			{
+				total += sample;
+			}
+
+			result.total = doGetMilliseconds( total );
+			result.mean = result.total / double( samples.size() );
+			double variance = 0.0;
+
+			for ( auto & sample : samples )
+			{
+				auto delta = doGetMilliseconds( sample ) - result.mean;
+				variance += delta * delta;
+			}
+
+			result.stddev = std::sqrt( variance / double( samples.size() ) );
+			result.min = doGetMilliseconds( samples.front() );
+			result.max = doGetMilliseconds( samples.back() );
+			result.p50 = doGetPercentile( samples, 0.50 );
+			result.p95 = doGetPercentile( samples, 0.95 );
+			result.p99 = doGetPercentile( samples, 0.99 );
+		}
+
+		return result;
+	}
+
 	BenchCase::BenchCase( std::string const & p_name )
 		: m_name( p_name )
-		, m_totalExecutions( 0 )
 	{
 	}
 
@@ -12,38 +64,60 @@ namespace Testing
 	{
 	}
 
-	void BenchCase::doBench( std::string p_name, CallbackBench p_bench, uint64_t p_ui64Calls )
+	void BenchCase::doBench( std::string p_name, CallbackBench p_bench, uint64_t p_ui64Calls, uint64_t warmups )
 	{
 		std::stringstream benchSep;
 		benchSep.width( BENCH_TITLE_WIDTH );
 		benchSep.fill( '*' );
 		benchSep << '*';
+		auto & options = BenchManager::getOptions();
+
+		if ( options.iterations > 0 )
+		{
+			p_ui64Calls = uint64_t( options.iterations );
+		}
+
+		if ( options.warmups >= 0 )
+		{
+			warmups = uint64_t( options.warmups );
+		}
 
 		try
 		{
-			m_cumulativeTimes = std::chrono::nanoseconds{};
-			m_totalExecutions = 0;
+			for ( uint64_t i = 0; i < warmups; i++ )
+			{
+				p_bench();
+			}
+
+			m_samples.clear();
+			m_samples.reserve( size_t( p_ui64Calls ) );
 
 			for ( uint64_t i = 0; i < p_ui64Calls; i++ )
 			{
 				m_saved = clock::now();
 				p_bench();
-				m_cumulativeTimes += std::chrono::duration_cast< std::chrono::nanoseconds >( clock::now() - m_saved );
-				m_totalExecutions++;
+				m_samples.push_back( std::chrono::duration_cast< std::chrono::nanoseconds >( clock::now() - m_saved ) );
 			}
 
+			auto result = computeBenchResult( m_name, p_name, m_samples );
+			m_results.push_back( result );
 			std::stringstream stream;
 			stream.precision( 4 );
 			stream << "*	" << p_name << " global results :" << std::endl;
 			stream << "*		- Executed " << p_ui64Calls << " times" << std::endl;
-			stream << "*		- Total time : " << std::chrono::duration_cast< std::chrono::milliseconds >( m_cumulativeTimes ).count() / 1000.0 << "s" << std::endl;
-			stream << "*		- Average time : " << std::chrono::duration_cast< std::chrono::milliseconds >( m_cumulativeTimes / m_totalExecutions ).count() << "ms" << std::endl;
+			stream << "*		- Total time : " << result.total / 1000.0 << "s" << std::endl;
+			stream << "*		- Average time : " << result.mean << "ms" << std::endl;
+			stream << "*		- Percentiles : p50 " << result.p50 << "ms, p95 " << result.p95 << "ms, p99 " << result.p99 << "ms" << std::endl;
+			stream << "*		- Standard deviation : " << result.stddev << "ms" << std::endl;
 			stream << benchSep.rdbuf() << std::endl;
 			m_summary += stream.str();
+			std::cout.precision( 4 );
 			std::cout << "*	Bench ended for: " << p_name.c_str() << std::endl;
 			std::cout << "*		- Executed " << p_ui64Calls << " times" << std::endl;
-			std::cout << "*		- Total time : " << std::chrono::duration_cast< std::chrono::milliseconds >( m_cumulativeTimes ).count() / 1000.0 << "s" << std::endl;
-			std::cout << "*		- Average time : " << std::chrono::duration_cast< std::chrono::milliseconds >( m_cumulativeTimes / m_totalExecutions ).count() << "ms" << std::endl;
+			std::cout << "*		- Total time : " << result.total / 1000.0 << "s" << std::endl;
+			std::cout << "*		- Average time : " << result.mean << "ms" << std::endl;
+			std::cout << "*		- Percentiles : p50 " << result.p50 << "ms, p95 " << result.p95 << "ms, p99 " << result.p99 << "ms" << std::endl;
+			std::cout << "*		- Standard deviation : " << result.stddev << "ms" << std::endl;
 			std::cout << benchSep.str() << std::endl;
 		}
 		catch ( ... )
@@ -28,6 +28,34 @@ namespace Testing
 		}
 	}
 
+	///
+	/// \struct BenchResult
+	///
+	/// The statistics of one bench, the times are in milliseconds.
+	///
+	struct BenchResult
+	{
+		std::string caseName;
+		std::string name;
+		uint64_t iterations;
+		double total;
+		double mean;
+		double stddev;
+		double min;
+		double max;
+		double p50;
+		double p95;
+		double p99;
+	};
+	///
+	/// \func computeBenchResult
+	///
+	/// Computes the statistics of the given samples, the percentiles use the nearest rank method.
+	///
+	BenchResult computeBenchResult( std::string const & caseName
+		, std::string const & name
+		, std::vector< std::chrono::nanoseconds > samples );
+
 	class BenchCase
 	{
 		typedef std::function< void() > CallbackBench;
@@ -36,21 +64,33 @@ namespace Testing
 		explicit BenchCase( std::string const & p_name );
 		virtual ~BenchCase();
 		virtual void Execute() = 0;
+		inline std::string const & getName()const
+		{
+			return m_name;
+		}
 		inline std::string const & getSummary()const
 		{
 			return m_summary;
 		}
+		inline std::vector< BenchResult > const & getResults()const
+		{
+			return m_results;
+		}
 
 	protected:
-		void doBench( std::string p_name, CallbackBench p_bench, uint64_t p_ui64Calls );
+		///
+		/// p_ui64Calls measured calls are run after warmups unmeasured ones, --iterations and --warmup override them.
+		///
+		void doBench( std::string p_name, CallbackBench p_bench, uint64_t p_ui64Calls, uint64_t warmups = 0u );
 
 	private:
+		friend class BenchManager;
 		using clock = std::chrono::high_resolution_clock;
 		clock::time_point m_saved;
 		std::string m_name;
-		std::chrono::nanoseconds m_cumulativeTimes;
-		uint64_t m_totalExecutions;
+		std::vector< std::chrono::nanoseconds > m_samples;
 		std::string m_summary;
+		std::vector< BenchResult > m_results;
 	};
 
 #	define BENCHMARK( Name, Calls ) doBench( #Name, [&](){ Name(); }, Calls )
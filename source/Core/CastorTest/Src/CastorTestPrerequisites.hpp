@@ -35,6 +35,8 @@ namespace Testing
 	class BenchCase;
 	class TestCase;
 	class BenchManager;
+	struct BenchOptions;
+	struct BenchResult;
 
 	using BenchCaseSPtr = std::shared_ptr< BenchCase >;
 	using BenchCaseWPtr = std::weak_ptr< BenchCase >;
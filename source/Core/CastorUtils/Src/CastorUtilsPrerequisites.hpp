@@ -242,11 +242,16 @@ namespace castor
 	class AngleT;
 	template< size_t Size >
 	struct BaseTypeFromSize;
+	class BakedTexture;
 	class BinaryFile;
 	template< class T >
 	class BinaryLoader;
 	template< typename T, typename Key >
 	class Collection;
+	template< typename T >
+	struct Handle;
+	template< typename T >
+	class HandleRegistry;
 	template< uint8_t Dimension >
 	class BoundingContainer;
 	template< typename T, uint32_t Count >
@@ -258,11 +263,13 @@ namespace castor
 	template< typename FlagType
 		, typename BaseType = typename BaseTypeFromSize< sizeof( FlagType ) >::Type >
 	class FlagCombination;
+	class Float4x4;
 	class Font;
 	class FontCache;
 	class Glyph;
 	class Image;
 	class ImageCache;
+	class ImageResampler;
 	class ColourComponent;
 	class HdrColourComponent;
 	template< typename ComponentType >
@@ -281,6 +288,7 @@ namespace castor
 	class Loader;
 	class ILoggerImpl;
 	class Logger;
+	class MappedFile;
 	template< typename T, uint32_t Rows, uint32_t Columns >
 	class Matrix;
 	template< class Owmer >
@@ -315,11 +323,23 @@ namespace castor
 		, class Predicate = std::less< Key > >
 	class Factory;
 	class Path;
+	class VirtualFileSystem;
 	class DynamicLibrary;
 	struct Message;
 	class Logger;
 	class LoggerImpl;
+	class LogSink;
+	class ConsoleLogSink;
+	class FileLogSink;
+	class MemoryLogSink;
 	class ProgramConsole;
+	class Profiler;
+	class ProfileScope;
+	struct ProfileZone;
+	class MemoryTag;
+	class MemoryUsage;
+	class MemoryAccounting;
+	struct MemoryReportEntry;
 
 	/*!
 	\author		Sylvain DOREMUS
@@ -516,6 +536,8 @@ namespace castor
 	DECLARE_SMART_PTR( FileParserContext );
 	DECLARE_SMART_PTR( ParserParameterBase );
 	DECLARE_SMART_PTR( DynamicLibrary );
+	DECLARE_SMART_PTR( LogSink );
+	DECLARE_SMART_PTR( MemoryLogSink );
 
 	DECLARE_VECTOR( uint8_t, Byte );
 	DECLARE_VECTOR( SphericalVertexSPtr, SphericalVertexPtr );
@@ -523,6 +545,7 @@ namespace castor
 	DECLARE_VECTOR( String, String );
 	DECLARE_VECTOR( Path, Path );
 	DECLARE_VECTOR( ParserParameterBaseSPtr, ParserParameter );
+	DECLARE_VECTOR( PxBufferBaseSPtr, PxBufferPtr );
 	DECLARE_MAP( String, uint32_t, UIntStr );
 	DECLARE_MAP( String, uint64_t, UInt64Str );
 	DECLARE_MAP( String, bool, BoolStr );
@@ -546,6 +569,8 @@ namespace castor
 		std::string m_message;
 		//! Tells if the new line character is printed.
 		bool m_newLine;
+		//! The time the message was logged at.
+		std::chrono::system_clock::time_point m_time;
 	};
 	//! The message queue.
 	using MessageQueue = std::deque< Message >;
@@ -1,4 +1,5 @@
 #include "File.hpp"
+#include "VirtualFileSystem.hpp"
 
 #include "Miscellaneous/Utils.hpp"
 
@@ -69,18 +70,51 @@ namespace castor
 			}
 		}
 
-		fileOpen( m_file, string::stringCast< char >( m_fileFullPath ).c_str(), string::stringCast< char >( mode ).c_str() );
+		Path path{ m_fileFullPath };
+		bool const read = !checkFlag( p_mode, OpenMode::eWrite )
+			&& !checkFlag( p_mode, OpenMode::eAppend );
 
-		if ( m_file )
+		if ( read
+			&& !VirtualFileSystem::isOnDisk( m_fileFullPath ) )
 		{
-			m_length = 0;
-			castor::fileSeek( m_file, 0, SEEK_END );
-			m_length = castor::fileTell( m_file );
-			castor::fileSeek( m_file, 0, SEEK_SET );
+			// The file is in a mounted archive, it is read from memory.
+			if ( !VirtualFileSystem::readFile( m_fileFullPath, m_content ) )
+			{
+				CASTOR_EXCEPTION( "Couldn't open file " + string::stringCast< char >( m_fileFullPath ) + " : not found in the mounted archive" );
+			}
+
+			static std::array< uint8_t, 3u > const Utf8Bom{ { 0xEF, 0xBB, 0xBF } };
+
+			if ( !checkFlag( p_mode, OpenMode::eBinary )
+				&& m_content.size() >= Utf8Bom.size()
+				&& std::equal( Utf8Bom.begin(), Utf8Bom.end(), m_content.begin() ) )
+			{
+				m_content.erase( m_content.begin(), m_content.begin() + Utf8Bom.size() );
+			}
+
+			m_inMemory = true;
+			m_length = m_content.size();
 		}
 		else
 		{
-			CASTOR_EXCEPTION( "Couldn't open file " + string::stringCast< char >( m_fileFullPath ) + " : " + string::stringCast< char >( System::getLastErrorText() ) );
+			if ( read )
+			{
+				VirtualFileSystem::resolve( m_fileFullPath, path );
+			}
+
+			fileOpen( m_file, string::stringCast< char >( path ).c_str(), string::stringCast< char >( mode ).c_str() );
+
+			if ( m_file )
+			{
+				m_length = 0;
+				castor::fileSeek( m_file, 0, SEEK_END );
+				m_length = castor::fileTell( m_file );
+				castor::fileSeek( m_file, 0, SEEK_SET );
+			}
+			else
+			{
+				CASTOR_EXCEPTION( "Couldn't open file " + string::stringCast< char >( m_fileFullPath ) + " : " + string::stringCast< char >( System::getLastErrorText() ) );
+			}
 		}
 
 		CHECK_INVARIANTS();
@@ -99,7 +133,35 @@ namespace castor
 		CHECK_INVARIANTS();
 		int iReturn = 0;
 
-		if ( m_file )
+		if ( m_inMemory )
+		{
+			long long position = p_offset;
+
+			switch ( p_origin )
+			{
+			case OffsetMode::eCurrent:
+				position += m_cursor;
+				break;
+
+			case OffsetMode::eEnd:
+				position += m_length;
+				break;
+
+			default:
+				break;
+			}
+
+			if ( position < 0 || uint64_t( position ) > m_length )
+			{
+				iReturn = -1;
+			}
+			else
+			{
+				m_cursor = uint64_t( position );
+				m_endReached = false;
+			}
+		}
+		else if ( m_file )
 		{
 			switch ( p_origin )
 			{
@@ -127,11 +189,16 @@ namespace castor
 	long long File::getLength()
 	{
 		CHECK_INVARIANTS();
-		m_length = 0;
-		long long llPosition = castor::fileTell( m_file );
-		castor::fileSeek( m_file, 0, SEEK_END );
-		m_length = castor::fileTell( m_file );
-		castor::fileSeek( m_file, llPosition, SEEK_SET );
+
+		if ( !m_inMemory )
+		{
+			m_length = 0;
+			long long llPosition = castor::fileTell( m_file );
+			castor::fileSeek( m_file, 0, SEEK_END );
+			m_length = castor::fileTell( m_file );
+			castor::fileSeek( m_file, llPosition, SEEK_SET );
+		}
+
 		CHECK_INVARIANTS();
 		return m_length;
 	}
@@ -140,7 +207,11 @@ namespace castor
 	{
 		bool result = false;
 
-		if ( m_file )
+		if ( m_inMemory )
+		{
+			result = !m_endReached;
+		}
+		else if ( m_file )
 		{
 			if ( ferror( m_file ) == 0 )
 			{
@@ -159,7 +230,11 @@ namespace castor
 		CHECK_INVARIANTS();
 		long long llReturn = 0;
 
-		if ( m_file )
+		if ( m_inMemory )
+		{
+			llReturn = m_cursor;
+		}
+		else if ( m_file )
 		{
 			llReturn = castor::fileTell( m_file );
 		}
@@ -169,7 +244,7 @@ namespace castor
 	}
 
 	BEGIN_INVARIANT_BLOCK( File )
-	CHECK_INVARIANT( m_file );
+	CHECK_INVARIANT( m_file || m_inMemory );
 	END_INVARIANT_BLOCK()
 
 	uint64_t File::doWrite( uint8_t const * p_buffer, uint64_t p_uiSize )
@@ -178,7 +253,7 @@ namespace castor
 		REQUIRE( isOk() && ( checkFlag( m_mode, OpenMode::eWrite ) || checkFlag( m_mode, OpenMode::eAppend ) ) );
 		uint64_t uiReturn = 0;
 
-		if ( isOk() )
+		if ( isOk() && m_file )
 		{
 			uiReturn = fwrite( p_buffer, 1, std::size_t( p_uiSize ), m_file );
 			m_cursor += uiReturn;
@@ -195,7 +270,14 @@ namespace castor
 		REQUIRE( isOk() && checkFlag( m_mode, OpenMode::eRead ) );
 		uint64_t uiReturn = 0;
 
-		if ( isOk() )
+		if ( isOk() && m_inMemory )
+		{
+			uiReturn = std::min( p_uiSize, m_length - m_cursor );
+			std::memcpy( p_buffer, m_content.data() + m_cursor, size_t( uiReturn ) );
+			m_endReached = uiReturn < p_uiSize;
+			m_cursor += uiReturn;
+		}
+		else if ( isOk() )
 		{
 			uint64_t uiPrev = 1;
 
@@ -205,11 +205,13 @@ namespace castor
 		/**
 		 *\~english
 		 *\brief		Opens the file at the given path with the given mode and encoding
+		 *\remarks		In read only modes, the path is looked up in the VirtualFileSystem mounts first.
 		 *\param[in]	p_fileName	The file path
 		 *\param[in]	p_mode		The opening mode, combination of one or more OpenMode
 		 *\param[in]	p_encoding	The file encoding mode
 		 *\~french
 		 *\brief		Ouvre le fichier situé au chemin donné, avec le mode et l'encodage donnés
+		 *\remarks		Dans les modes en lecture seule, le chemin est d'abord recherché dans les montages du VirtualFileSystem.
 		 *\param[in]	p_fileName	Le chemin du fichier
 		 *\param[in]	p_mode		Le mode d'ouverture, combinaison d'un ou plusieurs OpenMode
 		 *\param[in]	p_encoding	Le mode d'encodage du fichier
@@ -273,6 +275,15 @@ namespace castor
 		 *\return		Le répertoire
 		 */
 		CU_API static Path	getUserDirectory();
+		/**
+		 *\~english
+		 *\brief		Gives the current working directory, against which the relative paths are resolved
+		 *\return		The directory
+		 *\~french
+		 *\brief		donne le répertoire de travail courant, depuis lequel les chemins relatifs sont résolus
+		 *\return		Le répertoire
+		 */
+		CU_API static Path	getCurrentDirectory();
 		/**
 		 *\~english
 		 *\brief		Tests directory existence
@@ -431,6 +442,15 @@ namespace castor
 		//!\~english	The total file length.
 		//!\~french		La taille totale du fichier.
 		uint64_t m_length{ 0 };
+		//!\~english	The file content, when the file is read from a mounted archive.
+		//!\~french		Le contenu du fichier, quand le fichier est lu depuis une archive montée.
+		ByteArray m_content;
+		//!\~english	Tells if the file is read from m_content, instead of m_file.
+		//!\~french		Dit si le fichier est lu depuis m_content, au lieu de m_file.
+		bool m_inMemory{ false };
+		//!\~english	Tells if a read has reached the end of m_content.
+		//!\~french		Dit si une lecture a atteint la fin de m_content.
+		bool m_endReached{ false };
 	};
 	IMPLEMENT_CLASS_FLAGS( File, OpenMode )
 	IMPLEMENT_CLASS_FLAGS( File, CreateMode )
@@ -0,0 +1,105 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CASTOR_MAPPED_FILE_H___
+#define ___CASTOR_MAPPED_FILE_H___
+
+#include "Data/Path.hpp"
+#include "Design/NonCopyable.hpp"
+
+namespace castor
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/12/2017
+	\~english
+	\brief		Read only memory mapping of a whole file.
+	\remarks	The pages are loaded by the system on first access, and can be evicted since they are backed by the file.
+	\~french
+	\brief		Projection en mémoire, en lecture seule, d'un fichier entier.
+	\remarks	Les pages sont chargées par le système au premier accès, et peuvent être évincées puisqu'elles sont adossées au fichier.
+	*/
+	class MappedFile
+		: private NonCopyable
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor, maps the file.
+		 *\remarks		On failure, an error is logged and isMapped() returns \p false.
+		 *\param[in]	path	The file path.
+		 *\~french
+		 *\brief		Constructeur, projette le fichier.
+		 *\remarks		En cas d'échec, une erreur est journalisée et isMapped() retourne \p false.
+		 *\param[in]	path	Le chemin du fichier.
+		 */
+		CU_API explicit MappedFile( Path const & path );
+		/**
+		 *\~english
+		 *\brief		Destructor, unmaps the file.
+		 *\~french
+		 *\brief		Destructeur, supprime la projection du fichier.
+		 */
+		CU_API ~MappedFile();
+		/**
+		 *\~english
+		 *\return		\p true if the file is mapped.
+		 *\~french
+		 *\return		\p true si le fichier est projeté.
+		 */
+		inline bool isMapped()const
+		{
+			return m_data != nullptr;
+		}
+		/**
+		 *\~english
+		 *\return		The mapped file content.
+		 *\~french
+		 *\return		Le contenu projeté du fichier.
+		 */
+		inline uint8_t const * getData()const
+		{
+			return m_data;
+		}
+		/**
+		 *\~english
+		 *\return		The mapped file size.
+		 *\~french
+		 *\return		La taille du fichier projeté.
+		 */
+		inline uint64_t getSize()const
+		{
+			return m_size;
+		}
+		/**
+		 *\~english
+		 *\return		The file path.
+		 *\~french
+		 *\return		Le chemin du fichier.
+		 */
+		inline Path const & getPath()const
+		{
+			return m_path;
+		}
+
+	private:
+		//!\~english	The file path.
+		//!\~french		Le chemin du fichier.
+		Path m_path;
+		//!\~english	The mapped content.
+		//!\~french		Le contenu projeté.
+		uint8_t const * m_data{ nullptr };
+		//!\~english	The mapped size.
+		//!\~french		La taille projetée.
+		uint64_t m_size{ 0u };
+		//!\~english	The platform file handle.
+		//!\~french		Le handle de fichier de la plateforme.
+		intptr_t m_file{ -1 };
+		//!\~english	The platform mapping handle, if any.
+		//!\~french		Le handle de projection de la plateforme, s'il y en a un.
+		intptr_t m_mapping{ 0 };
+	};
+}
+
+#endif
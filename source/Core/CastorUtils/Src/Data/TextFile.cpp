@@ -25,22 +25,10 @@ namespace castor
 			xchar cChar;
 			String strLine;
 			bool bContinue = true;
-			int iOrigChar;
 
 			while ( bContinue && uiReturn < p_size )
 			{
-				if ( m_encoding == EncodingMode::eASCII )
-				{
-					iOrigChar = getc( m_file );
-					cChar = string::stringCast< xchar, char >( { char( iOrigChar ), char( 0 ) } )[0];
-				}
-				else
-				{
-					iOrigChar = getwc( m_file );
-					cChar = string::stringCast< xchar, wchar_t >( { wchar_t( iOrigChar ), wchar_t( 0 ) } )[0];
-				}
-
-				bContinue =  ! feof( m_file );
+				bContinue = doReadChar( cChar );
 
 				if ( bContinue )
 				{
@@ -65,7 +53,6 @@ namespace castor
 				}
 
 				uiReturn++;
-				m_cursor++;
 			}
 		}
 
@@ -87,19 +74,7 @@ namespace castor
 
 		if ( isOk() )
 		{
-			int iOrigChar;
-
-			if ( m_encoding == EncodingMode::eASCII )
-			{
-				iOrigChar = getc( m_file );
-				p_toRead = string::stringCast< xchar, char >( { char( iOrigChar ), char( 0 ) } )[0];
-			}
-			else
-			{
-				iOrigChar = getwc( m_file );
-				p_toRead = string::stringCast< xchar, wchar_t >( { wchar_t( iOrigChar ), wchar_t( 0 ) } )[0];
-			}
-
+			doReadChar( p_toRead );
 			uiReturn++;
 		}
 
@@ -168,4 +143,43 @@ namespace castor
 		CHECK_INVARIANTS();
 		return uiReturn;
 	}
+
+	bool TextFile::doReadChar( xchar & p_char )
+	{
+		bool result = false;
+
+		if ( m_inMemory )
+		{
+			// The content is kept as is, the UTF-8 sequences are not decoded.
+			result = m_cursor < m_length;
+
+			if ( result )
+			{
+				p_char = xchar( m_content[size_t( m_cursor )] );
+				++m_cursor;
+			}
+			else
+			{
+				m_endReached = true;
+			}
+		}
+		else
+		{
+			if ( m_encoding == EncodingMode::eASCII )
+			{
+				int iOrigChar = getc( m_file );
+				p_char = string::stringCast< xchar, char >( { char( iOrigChar ), char( 0 ) } )[0];
+			}
+			else
+			{
+				wint_t iOrigChar = getwc( m_file );
+				p_char = string::stringCast< xchar, wchar_t >( { wchar_t( iOrigChar ), wchar_t( 0 ) } )[0];
+			}
+
+			result = !feof( m_file );
+			++m_cursor;
+		}
+
+		return result;
+	}
 }
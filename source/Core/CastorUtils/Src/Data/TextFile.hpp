@@ -133,6 +133,19 @@ namespace castor
 		 *\return		Le nombre d'octets écrits
 		 */
 		CU_API uint64_t print( uint64_t p_uiMaxSize, xchar const * p_pFormat, ... );
+
+	private:
+		/**
+		 *\~english
+		 *\brief		Reads one character, from the file or from the in memory content.
+		 *\param[out]	p_char	Receives the character.
+		 *\return		\p false if the end of the file has been reached.
+		 *\~french
+		 *\brief		Lit un caractère, depuis le fichier ou depuis le contenu en mémoire.
+		 *\param[out]	p_char	Reçoit le caractère.
+		 *\return		\p false si la fin du fichier a été atteinte.
+		 */
+		bool doReadChar( xchar & p_char );
 	};
 	/**
 	 *\~english
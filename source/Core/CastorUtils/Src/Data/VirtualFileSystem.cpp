@@ -0,0 +1,675 @@
+#include "VirtualFileSystem.hpp"
+
+#include "File.hpp"
+#include "Log/Logger.hpp"
+
+#ifdef WIN32
+#	undef HAVE_UNISTD_H
+#endif
+
+#include "MiniZip/unzip.h"
+
+#ifdef WIN32
+#	define USEWIN32IOAPI
+#	include "MiniZip/iowin32.h"
+#endif
+
+#include <mutex>
+#include <set>
+
+namespace castor
+{
+	namespace
+	{
+		static xchar const MountSeparator = cuT( '/' );
+
+		String doGetKey( Path const & p_path )
+		{
+			String result{ p_path };
+			string::replace( result, cuT( '\\' ), MountSeparator );
+
+			while ( result.size() > 1u && result.back() == MountSeparator )
+			{
+				result.pop_back();
+			}
+
+			return result;
+		}
+
+		bool doIsInFolder( String const & p_path, String const & p_folder )
+		{
+			return p_folder.empty()
+				|| ( p_path.size() > p_folder.size()
+					&& p_path[p_folder.size()] == MountSeparator
+					&& p_path.compare( 0u, p_folder.size(), p_folder ) == 0 );
+		}
+
+		String doGetRelative( String const & p_path, String const & p_folder )
+		{
+			return p_folder.empty()
+				? p_path
+				: p_path.substr( p_folder.size() + 1u );
+		}
+
+		bool doReadDiskFile( Path const & p_path, ByteArray & p_content )
+		{
+			std::ifstream file( string::stringCast< char >( p_path ), std::ios::binary );
+			bool result = file.is_open();
+
+			if ( result )
+			{
+				file.seekg( 0, std::ios::end );
+				p_content.resize( size_t( file.tellg() ) );
+				file.seekg( 0, std::ios::beg );
+				result = p_content.empty()
+					|| bool( file.read( reinterpret_cast< char * >( p_content.data() ), std::streamsize( p_content.size() ) ) );
+			}
+
+			return result;
+		}
+
+		bool doWriteDiskFile( Path const & p_path, ByteArray const & p_content )
+		{
+			std::ofstream file( string::stringCast< char >( p_path ), std::ios::binary );
+			bool result = file.is_open();
+
+			if ( result )
+			{
+				result = p_content.empty()
+					|| bool( file.write( reinterpret_cast< char const * >( p_content.data() ), std::streamsize( p_content.size() ) ) );
+			}
+
+			return result;
+		}
+
+		//*****************************************************************************************
+
+		class DirectoryMount
+			: public VirtualFileSystem::Mount
+		{
+		public:
+			explicit DirectoryMount( Path const & p_folder )
+				: m_folder{ p_folder }
+				, m_key{ doGetKey( p_folder ) }
+			{
+			}
+
+			bool fileExists( String const & p_relative )const override
+			{
+				return File::fileExists( doGetPath( p_relative ) );
+			}
+
+			bool directoryExists( String const & p_relative )const override
+			{
+				return File::directoryExists( doGetPath( p_relative ) );
+			}
+
+			void listFiles( String const & p_relative
+				, bool p_recursive
+				, StringArray & p_files )const override
+			{
+				PathArray files;
+				File::listDirectoryFiles( doGetPath( p_relative ), files, p_recursive );
+
+				for ( auto & file : files )
+				{
+					auto key = doGetKey( file );
+
+					if ( doIsInFolder( key, m_key ) )
+					{
+						p_files.push_back( doGetRelative( key, m_key ) );
+					}
+				}
+			}
+
+			bool isOnDisk( String const & p_relative )const override
+			{
+				return true;
+			}
+
+			bool resolve( String const & p_relative
+				, Path & p_path )const override
+			{
+				p_path = doGetPath( p_relative );
+				return true;
+			}
+
+			bool readFile( String const & p_relative
+				, ByteArray & p_content )const override
+			{
+				return doReadDiskFile( doGetPath( p_relative ), p_content );
+			}
+
+		private:
+			Path doGetPath( String const & p_relative )const
+			{
+				return p_relative.empty()
+					? m_folder
+					: m_folder / p_relative;
+			}
+
+		private:
+			Path const m_folder;
+			String const m_key;
+		};
+
+		//*****************************************************************************************
+
+		class ZipMount
+			: public VirtualFileSystem::Mount
+		{
+		private:
+			struct Entry
+			{
+				unz_file_pos m_position;
+				uLong m_compressedSize;
+				uLong m_size;
+				uLong m_crc;
+			};
+
+		public:
+			ZipMount( Path const & p_archive
+				, Path const & p_folder )
+				: m_archive{ p_archive }
+				, m_folder{ p_folder }
+			{
+#ifdef USEWIN32IOAPI
+
+				zlib_filefunc_def ffunc;
+				fill_win32_filefunc( &ffunc );
+				m_unzip = unzOpen2( string::stringCast< char >( p_archive ).c_str(), &ffunc );
+
+#else
+
+				m_unzip = unzOpen( string::stringCast< char >( p_archive ).c_str() );
+
+#endif
+
+				if ( !m_unzip )
+				{
+					CASTOR_EXCEPTION( "Couldn't open archive file " + string::stringCast< char >( p_archive ) );
+				}
+
+				// Only the central directory is read here, the entries are decompressed on demand.
+				m_folders.insert( String{} );
+				auto error = unzGoToFirstFile( m_unzip );
+
+				while ( error == UNZ_OK )
+				{
+					doAddCurrentEntry();
+					error = unzGoToNextFile( m_unzip );
+				}
+			}
+
+			~ZipMount()
+			{
+				unzClose( m_unzip );
+
+				for ( auto & file : m_extractedFiles )
+				{
+					File::deleteFile( file );
+				}
+
+				for ( auto & folder : m_createdFolders )
+				{
+					File::directoryDelete( folder );
+				}
+			}
+
+			bool fileExists( String const & p_relative )const override
+			{
+				return m_entries.find( p_relative ) != m_entries.end();
+			}
+
+			bool directoryExists( String const & p_relative )const override
+			{
+				return m_folders.find( p_relative ) != m_folders.end();
+			}
+
+			void listFiles( String const & p_relative
+				, bool p_recursive
+				, StringArray & p_files )const override
+			{
+				for ( auto & entry : m_entries )
+				{
+					if ( doIsInFolder( entry.first, p_relative )
+						&& ( p_recursive
+							|| doGetRelative( entry.first, p_relative ).find( MountSeparator ) == String::npos ) )
+					{
+						p_files.push_back( entry.first );
+					}
+				}
+			}
+
+			bool isOnDisk( String const & p_relative )const override
+			{
+				return false;
+			}
+
+			bool resolve( String const & p_relative
+				, Path & p_path )const override
+			{
+				// Extracted once, under the mount root, and kept until the archive is unmounted.
+				std::lock_guard< std::mutex > lock( m_extractMutex );
+				p_path = m_folder / p_relative;
+
+				if ( m_extractedFiles.find( p_path ) != m_extractedFiles.end() )
+				{
+					return true;
+				}
+
+				ByteArray content;
+				bool result = readFile( p_relative, content )
+					&& doCreateFolder( p_path.getPath() )
+					&& doWriteDiskFile( p_path, content );
+
+				if ( result )
+				{
+					m_extractedFiles.insert( p_path );
+				}
+				else
+				{
+					Logger::logError( cuT( "ZipMount: couldn't extract " ) + p_relative + cuT( " to " ) + p_path );
+				}
+
+				return result;
+			}
+
+			bool readFile( String const & p_relative
+				, ByteArray & p_content )const override
+			{
+				auto it = m_entries.find( p_relative );
+
+				if ( it == m_entries.end() )
+				{
+					return false;
+				}
+
+				auto const & entry = it->second;
+				int method{ 0 };
+				ByteArray compressed( entry.m_compressedSize );
+
+				if ( !doReadRaw( entry, method, compressed ) )
+				{
+					Logger::logError( cuT( "ZipMount: couldn't read " ) + p_relative + cuT( " from " ) + m_archive );
+					return false;
+				}
+
+				bool result = false;
+				p_content.resize( entry.m_size );
+
+				if ( method == 0 )
+				{
+					p_content = std::move( compressed );
+					result = p_content.size() == entry.m_size;
+				}
+				else if ( method == Z_DEFLATED )
+				{
+					result = doInflate( compressed, p_content );
+				}
+				else
+				{
+					Logger::logError( cuT( "ZipMount: unsupported compression method for " ) + p_relative + cuT( " in " ) + m_archive );
+				}
+
+				if ( result
+					&& crc32( crc32( 0uL, Z_NULL, 0u ), p_content.data(), uInt( p_content.size() ) ) != entry.m_crc )
+				{
+					Logger::logError( cuT( "ZipMount: corrupted entry " ) + p_relative + cuT( " in " ) + m_archive );
+					result = false;
+				}
+
+				return result;
+			}
+
+		private:
+			void doAddCurrentEntry()
+			{
+				std::array< char, 1024u > name;
+				unz_file_info info;
+
+				if ( unzGetCurrentFileInfo( m_unzip, &info, name.data(), uLong( name.size() ), nullptr, 0u, nullptr, 0u ) == UNZ_OK
+					&& info.size_filename > 0u )
+				{
+					String key = string::stringCast< xchar >( name.data()
+						, name.data() + std::min< size_t >( info.size_filename, name.size() - 1u ) );
+					string::replace( key, cuT( '\\' ), MountSeparator );
+					bool const isFolder = key.back() == MountSeparator;
+					key = doGetKey( Path{ key } );
+					auto index = key.find_last_of( MountSeparator );
+
+					while ( index != String::npos && index > 0u )
+					{
+						m_folders.insert( key.substr( 0u, index ) );
+						index = key.find_last_of( MountSeparator, index - 1u );
+					}
+
+					if ( isFolder )
+					{
+						m_folders.insert( key );
+					}
+					else
+					{
+						Entry entry{};
+						unzGetFilePos( m_unzip, &entry.m_position );
+						entry.m_compressedSize = info.compressed_size;
+						entry.m_size = info.uncompressed_size;
+						entry.m_crc = info.crc;
+						m_entries.emplace( key, entry );
+					}
+				}
+			}
+
+			bool doCreateFolder( Path const & p_folder )const
+			{
+				if ( p_folder.empty() || File::directoryExists( p_folder ) )
+				{
+					return true;
+				}
+
+				// Only the outermost created folder is recorded, its deletion removes the whole tree.
+				Path outermost = p_folder;
+
+				while ( !outermost.getPath().empty()
+					&& !File::directoryExists( outermost.getPath() ) )
+				{
+					outermost = outermost.getPath();
+				}
+
+				bool result = File::directoryCreate( p_folder );
+
+				if ( result )
+				{
+					m_createdFolders.push_back( outermost );
+				}
+
+				return result;
+			}
+
+			bool doReadRaw( Entry const & p_entry
+				, int & p_method
+				, ByteArray & p_compressed )const
+			{
+				// The archive handle is shared, it is locked only while reading the compressed data.
+				std::lock_guard< std::mutex > lock( m_mutex );
+				unz_file_pos position = p_entry.m_position;
+				int level{ 0 };
+				bool result = unzGoToFilePos( m_unzip, &position ) == UNZ_OK
+					&& unzOpenCurrentFile2( m_unzip, &p_method, &level, 1 ) == UNZ_OK;
+
+				if ( result )
+				{
+					size_t offset = 0u;
+					int read = 0;
+
+					do
+					{
+						read = unzReadCurrentFile( m_unzip
+							, p_compressed.data() + offset
+							, unsigned( p_compressed.size() - offset ) );
+
+						if ( read > 0 )
+						{
+							offset += size_t( read );
+						}
+					}
+					while ( read > 0 && offset < p_compressed.size() );
+
+					unzCloseCurrentFile( m_unzip );
+					result = read >= 0 && offset == p_compressed.size();
+				}
+
+				return result;
+			}
+
+			bool doInflate( ByteArray const & p_compressed
+				, ByteArray & p_content )const
+			{
+				if ( p_content.empty() )
+				{
+					return true;
+				}
+
+				// Raw deflate stream, the zip local header replaces the zlib one.
+				z_stream stream{};
+				bool result = inflateInit2( &stream, -MAX_WBITS ) == Z_OK;
+
+				if ( result )
+				{
+					stream.next_in = const_cast< Bytef * >( p_compressed.data() );
+					stream.avail_in = uInt( p_compressed.size() );
+					stream.next_out = p_content.data();
+					stream.avail_out = uInt( p_content.size() );
+					result = inflate( &stream, Z_FINISH ) == Z_STREAM_END
+						&& stream.total_out == p_content.size();
+					inflateEnd( &stream );
+				}
+
+				return result;
+			}
+
+		private:
+			Path const m_archive;
+			unzFile m_unzip{ nullptr };
+			mutable std::mutex m_mutex;
+			std::map< String, Entry > m_entries;
+			std::set< String > m_folders;
+			Path const m_folder;
+			mutable std::mutex m_extractMutex;
+			mutable std::set< Path > m_extractedFiles;
+			mutable PathArray m_createdFolders;
+		};
+
+		//*****************************************************************************************
+
+		struct Registry
+		{
+			std::mutex m_mutex;
+			//!\~english	The mounts, sorted by decreasing root length, so the deepest mount is found first.
+			//!\~french		Les montages, triés par longueur de racine décroissante, pour trouver le montage le plus profond en premier.
+			std::vector< std::pair< String, VirtualFileSystem::MountSPtr > > m_mounts;
+		};
+
+		Registry & doGetRegistry()
+		{
+			static Registry registry;
+			return registry;
+		}
+
+		bool doFindMount( Path const & p_path
+			, VirtualFileSystem::MountSPtr & p_mount
+			, String & p_relative )
+		{
+			auto & registry = doGetRegistry();
+			auto key = doGetKey( p_path );
+			std::lock_guard< std::mutex > lock( registry.m_mutex );
+			auto it = std::find_if( registry.m_mounts.begin()
+				, registry.m_mounts.end()
+				, [&key]( std::pair< String, VirtualFileSystem::MountSPtr > const & p_lookup )
+				{
+					return key == p_lookup.first
+						|| doIsInFolder( key, p_lookup.first );
+				} );
+			bool result = it != registry.m_mounts.end();
+
+			if ( result )
+			{
+				p_mount = it->second;
+				p_relative = key == it->first
+					? String{}
+					: doGetRelative( key, it->first );
+			}
+
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
+	VirtualFileSystem::Mount::~Mount()
+	{
+	}
+
+	//*********************************************************************************************
+
+	void VirtualFileSystem::mount( Path const & p_root
+		, MountSPtr p_mount )
+	{
+		REQUIRE( !p_root.empty() && p_mount );
+		auto & registry = doGetRegistry();
+		auto key = doGetKey( p_root );
+		std::lock_guard< std::mutex > lock( registry.m_mutex );
+		auto it = std::find_if( registry.m_mounts.begin()
+			, registry.m_mounts.end()
+			, [&key]( std::pair< String, MountSPtr > const & p_lookup )
+			{
+				return p_lookup.first.size() <= key.size();
+			} );
+
+		if ( it != registry.m_mounts.end() && it->first == key )
+		{
+			it->second = p_mount;
+		}
+		else
+		{
+			registry.m_mounts.emplace( it, key, p_mount );
+		}
+	}
+
+	void VirtualFileSystem::mountDirectory( Path const & p_root
+		, Path const & p_folder )
+	{
+		mount( p_root, std::make_shared< DirectoryMount >( p_folder ) );
+	}
+
+	void VirtualFileSystem::mountArchive( Path const & p_root
+		, Path const & p_archive )
+	{
+		mount( p_root, std::make_shared< ZipMount >( p_archive, p_root ) );
+	}
+
+	void VirtualFileSystem::unmount( Path const & p_root )
+	{
+		auto & registry = doGetRegistry();
+		auto key = doGetKey( p_root );
+		std::lock_guard< std::mutex > lock( registry.m_mutex );
+		auto it = std::find_if( registry.m_mounts.begin()
+			, registry.m_mounts.end()
+			, [&key]( std::pair< String, MountSPtr > const & p_lookup )
+			{
+				return p_lookup.first == key;
+			} );
+
+		if ( it != registry.m_mounts.end() )
+		{
+			registry.m_mounts.erase( it );
+		}
+	}
+
+	bool VirtualFileSystem::isMounted( Path const & p_path )
+	{
+		MountSPtr mount;
+		String relative;
+		return doFindMount( p_path, mount, relative );
+	}
+
+	bool VirtualFileSystem::fileExists( Path const & p_path )
+	{
+		MountSPtr mount;
+		String relative;
+
+		if ( doFindMount( p_path, mount, relative ) )
+		{
+			return mount->fileExists( relative );
+		}
+
+		return File::fileExists( p_path );
+	}
+
+	bool VirtualFileSystem::directoryExists( Path const & p_path )
+	{
+		MountSPtr mount;
+		String relative;
+
+		if ( doFindMount( p_path, mount, relative ) )
+		{
+			return mount->directoryExists( relative );
+		}
+
+		return File::directoryExists( p_path );
+	}
+
+	bool VirtualFileSystem::listDirectoryFiles( Path const & p_folder
+		, PathArray & p_files
+		, bool p_recursive )
+	{
+		MountSPtr mount;
+		String relative;
+
+		if ( doFindMount( p_folder, mount, relative ) )
+		{
+			bool result = mount->directoryExists( relative );
+
+			if ( result )
+			{
+				StringArray files;
+				mount->listFiles( relative, p_recursive, files );
+				auto key = doGetKey( p_folder );
+				Path root{ relative.empty()
+					? key
+					: key.substr( 0u, key.size() - relative.size() - 1u ) };
+
+				for ( auto & file : files )
+				{
+					p_files.push_back( root / file );
+				}
+			}
+
+			return result;
+		}
+
+		return File::listDirectoryFiles( p_folder, p_files, p_recursive );
+	}
+
+	bool VirtualFileSystem::isOnDisk( Path const & p_path )
+	{
+		MountSPtr mount;
+		String relative;
+
+		if ( doFindMount( p_path, mount, relative ) )
+		{
+			return mount->isOnDisk( relative );
+		}
+
+		return true;
+	}
+
+	bool VirtualFileSystem::resolve( Path const & p_path
+		, Path & p_result )
+	{
+		MountSPtr mount;
+		String relative;
+
+		if ( doFindMount( p_path, mount, relative ) )
+		{
+			return mount->resolve( relative, p_result );
+		}
+
+		p_result = p_path;
+		return true;
+	}
+
+	bool VirtualFileSystem::readFile( Path const & p_path
+		, ByteArray & p_content )
+	{
+		MountSPtr mount;
+		String relative;
+
+		if ( doFindMount( p_path, mount, relative ) )
+		{
+			return mount->readFile( relative, p_content );
+		}
+
+		return doReadDiskFile( p_path, p_content );
+	}
+}
@@ -0,0 +1,280 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CASTOR_VIRTUAL_FILE_SYSTEM_H___
+#define ___CASTOR_VIRTUAL_FILE_SYSTEM_H___
+
+#include "Path.hpp"
+
+namespace castor
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		08/01/2018
+	\~english
+	\brief		Read only virtual file system.
+	\remarks	Directories and zip archives are mounted under virtual root paths.
+				<br />A path located under a mount root is served by this mount, other paths are served by the disk,
+				so the paths computed from a mounted file (relative resources) keep on working.
+				<br />File, TextFile and BinaryFile opened for reading go through the virtual file system,
+				as well as the images and fonts loaders.
+				<br />The archive entries are decompressed in memory when they are read: the archive is only locked
+				while reading the compressed data, so independent entries can be decompressed in parallel.
+	\~french
+	\brief		Système de fichiers virtuel en lecture seule.
+	\remarks	Les dossiers et archives zip sont montés sous des chemins racines virtuels.
+				<br />Un chemin situé sous une racine de montage est servi par ce montage, les autres chemins sont servis par le disque,
+				ainsi les chemins calculés depuis un fichier monté (ressources relatives) continuent de fonctionner.
+				<br />File, TextFile et BinaryFile ouverts en lecture passent par le système de fichiers virtuel,
+				ainsi que les chargeurs d'images et de polices.
+				<br />Les entrées d'une archive sont décompressées en mémoire lors de leur lecture : l'archive n'est verrouillée
+				que pendant la lecture des données compressées, ainsi des entrées indépendantes peuvent être décompressées en parallèle.
+	*/
+	class VirtualFileSystem
+	{
+	public:
+		/*!
+		\~english
+		\brief		A mounted files source.
+		\remarks	The relative paths given to a mount use '/' as separator, the mount root being the empty path.
+		\~french
+		\brief		Une source de fichiers montée.
+		\remarks	Les chemins relatifs donnés à un montage utilisent '/' comme séparateur, la racine du montage étant le chemin vide.
+		*/
+		class Mount
+		{
+		public:
+			/**
+			 *\~english
+			 *\brief		Destructor.
+			 *\~french
+			 *\brief		Destructeur.
+			 */
+			CU_API virtual ~Mount();
+			/**
+			 *\~english
+			 *\param[in]	p_relative	The file path, relative to the mount root.
+			 *\return		\p true if the file exists in the mount.
+			 *\~french
+			 *\param[in]	p_relative	Le chemin du fichier, relatif à la racine du montage.
+			 *\return		\p true si le fichier existe dans le montage.
+			 */
+			virtual bool fileExists( String const & p_relative )const = 0;
+			/**
+			 *\~english
+			 *\param[in]	p_relative	The folder path, relative to the mount root.
+			 *\return		\p true if the folder exists in the mount.
+			 *\~french
+			 *\param[in]	p_relative	Le chemin du dossier, relatif à la racine du montage.
+			 *\return		\p true si le dossier existe dans le montage.
+			 */
+			virtual bool directoryExists( String const & p_relative )const = 0;
+			/**
+			 *\~english
+			 *\brief		Lists the files of a folder.
+			 *\param[in]	p_relative	The folder path, relative to the mount root.
+			 *\param[in]	p_recursive	Tells if the subfolders files are listed too.
+			 *\param[out]	p_files		Receives the files paths, relative to the mount root.
+			 *\~french
+			 *\brief		Liste les fichiers d'un dossier.
+			 *\param[in]	p_relative	Le chemin du dossier, relatif à la racine du montage.
+			 *\param[in]	p_recursive	Dit si les fichiers des sous-dossiers sont listés aussi.
+			 *\param[out]	p_files		Reçoit les chemins des fichiers, relatifs à la racine du montage.
+			 */
+			virtual void listFiles( String const & p_relative
+				, bool p_recursive
+				, StringArray & p_files )const = 0;
+			/**
+			 *\~english
+			 *\param[in]	p_relative	The file path, relative to the mount root.
+			 *\return		\p true if the file is directly stored on the disk.
+			 *\~french
+			 *\param[in]	p_relative	Le chemin du fichier, relatif à la racine du montage.
+			 *\return		\p true si le fichier est directement stocké sur le disque.
+			 */
+			virtual bool isOnDisk( String const & p_relative )const = 0;
+			/**
+			 *\~english
+			 *\brief		Retrieves a disk path for a file.
+			 *\remarks		A file which is not stored on the disk is extracted to it, the first time.
+			 *				<br />Must be thread safe.
+			 *\param[in]	p_relative	The file path, relative to the mount root.
+			 *\param[out]	p_path		Receives the disk path.
+			 *\return		\p false if the file doesn't exist or couldn't be extracted.
+			 *\~french
+			 *\brief		Récupère un chemin sur le disque pour un fichier.
+			 *\remarks		Un fichier qui n'est pas stocké sur le disque y est extrait, la première fois.
+			 *				<br />Doit être thread safe.
+			 *\param[in]	p_relative	Le chemin du fichier, relatif à la racine du montage.
+			 *\param[out]	p_path		Reçoit le chemin sur le disque.
+			 *\return		\p false si le fichier n'existe pas ou n'a pas pu être extrait.
+			 */
+			virtual bool resolve( String const & p_relative
+				, Path & p_path )const = 0;
+			/**
+			 *\~english
+			 *\brief		Reads a whole file.
+			 *\remarks		Must be thread safe.
+			 *\param[in]	p_relative	The file path, relative to the mount root.
+			 *\param[out]	p_content	Receives the file content.
+			 *\return		\p false if the file could not be read.
+			 *\~french
+			 *\brief		Lit un fichier entier.
+			 *\remarks		Doit être thread safe.
+			 *\param[in]	p_relative	Le chemin du fichier, relatif à la racine du montage.
+			 *\param[out]	p_content	Reçoit le contenu du fichier.
+			 *\return		\p false si le fichier n'a pas pu être lu.
+			 */
+			virtual bool readFile( String const & p_relative
+				, ByteArray & p_content )const = 0;
+		};
+		using MountSPtr = std::shared_ptr< Mount >;
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Mounts a files source under a virtual root.
+		 *\remarks		Replaces the mount previously registered with the same root.
+		 *\param[in]	p_root	The virtual root path.
+		 *\param[in]	p_mount	The files source.
+		 *\~french
+		 *\brief		Monte une source de fichiers sous une racine virtuelle.
+		 *\remarks		Remplace le montage précédemment enregistré avec la même racine.
+		 *\param[in]	p_root	Le chemin racine virtuel.
+		 *\param[in]	p_mount	La source de fichiers.
+		 */
+		CU_API static void mount( Path const & p_root
+			, MountSPtr p_mount );
+		/**
+		 *\~english
+		 *\brief		Mounts a disk folder under a virtual root.
+		 *\param[in]	p_root		The virtual root path.
+		 *\param[in]	p_folder	The folder path.
+		 *\~french
+		 *\brief		Monte un dossier du disque sous une racine virtuelle.
+		 *\param[in]	p_root		Le chemin racine virtuel.
+		 *\param[in]	p_folder	Le chemin du dossier.
+		 */
+		CU_API static void mountDirectory( Path const & p_root
+			, Path const & p_folder );
+		/**
+		 *\~english
+		 *\brief		Mounts a zip archive under a virtual root.
+		 *\remarks		The archive stays open until it is unmounted.
+		 *				<br />The entries which need a disk path are extracted under the root, and deleted with the mount.
+		 *\param[in]	p_root		The virtual root path.
+		 *\param[in]	p_archive	The archive path.
+		 *\~french
+		 *\brief		Monte une archive zip sous une racine virtuelle.
+		 *\remarks		L'archive reste ouverte jusqu'à son démontage.
+		 *				<br />Les entrées qui ont besoin d'un chemin sur le disque sont extraites sous la racine, et supprimées avec le montage.
+		 *\param[in]	p_root		Le chemin racine virtuel.
+		 *\param[in]	p_archive	Le chemin de l'archive.
+		 */
+		CU_API static void mountArchive( Path const & p_root
+			, Path const & p_archive );
+		/**
+		 *\~english
+		 *\brief		Removes the mount registered with given root.
+		 *\param[in]	p_root	The virtual root path.
+		 *\~french
+		 *\brief		Retire le montage enregistré avec la racine donnée.
+		 *\param[in]	p_root	Le chemin racine virtuel.
+		 */
+		CU_API static void unmount( Path const & p_root );
+		/**
+		 *\~english
+		 *\param[in]	p_path	A path.
+		 *\return		\p true if the path is located under a mount root.
+		 *\~french
+		 *\param[in]	p_path	Un chemin.
+		 *\return		\p true si le chemin est situé sous une racine de montage.
+		 */
+		CU_API static bool isMounted( Path const & p_path );
+		/**
+		 *\~english
+		 *\brief		Tests a file existence, in the mounts or on the disk.
+		 *\param[in]	p_path	The file path.
+		 *\return		\p true if the file exists.
+		 *\~french
+		 *\brief		Teste l'existence d'un fichier, dans les montages ou sur le disque.
+		 *\param[in]	p_path	Le chemin du fichier.
+		 *\return		\p true si le fichier existe.
+		 */
+		CU_API static bool fileExists( Path const & p_path );
+		/**
+		 *\~english
+		 *\brief		Tests a folder existence, in the mounts or on the disk.
+		 *\param[in]	p_path	The folder path.
+		 *\return		\p true if the folder exists.
+		 *\~french
+		 *\brief		Teste l'existence d'un dossier, dans les montages ou sur le disque.
+		 *\param[in]	p_path	Le chemin du dossier.
+		 *\return		\p true si le dossier existe.
+		 */
+		CU_API static bool directoryExists( Path const & p_path );
+		/**
+		 *\~english
+		 *\brief		Lists the files of a folder, in the mounts or on the disk.
+		 *\param[in]	p_folder	The folder path.
+		 *\param[out]	p_files		Receives the files paths.
+		 *\param[in]	p_recursive	Tells if the subfolders files are listed too.
+		 *\return		\p true if the folder has been listed.
+		 *\~french
+		 *\brief		Liste les fichiers d'un dossier, dans les montages ou sur le disque.
+		 *\param[in]	p_folder	Le chemin du dossier.
+		 *\param[out]	p_files		Reçoit les chemins des fichiers.
+		 *\param[in]	p_recursive	Dit si les fichiers des sous-dossiers sont listés aussi.
+		 *\return		\p true si le dossier a été listé.
+		 */
+		CU_API static bool listDirectoryFiles( Path const & p_folder
+			, PathArray & p_files
+			, bool p_recursive = false );
+		/**
+		 *\~english
+		 *\brief		Tells if a file is directly stored on the disk, in which case it is better opened from there than read in memory.
+		 *\param[in]	p_path	The file path.
+		 *\return		\p false if the file is mounted from an archive.
+		 *\~french
+		 *\brief		Dit si un fichier est directement stocké sur le disque, auquel cas il vaut mieux l'ouvrir depuis celui-ci que le lire en mémoire.
+		 *\param[in]	p_path	Le chemin du fichier.
+		 *\return		\p false si le fichier est monté depuis une archive.
+		 */
+		CU_API static bool isOnDisk( Path const & p_path );
+		/**
+		 *\~english
+		 *\brief		Retrieves a disk path for a file.
+		 *\remarks		The files mounted from an archive are extracted, for the libraries which can only open a disk file.
+		 *\param[in]	p_path		The file path.
+		 *\param[out]	p_result	Receives the disk path, \p p_path itself if it is not mounted.
+		 *\return		\p false if the file is mounted but couldn't be found or extracted.
+		 *\~french
+		 *\brief		Récupère un chemin sur le disque pour un fichier.
+		 *\remarks		Les fichiers montés depuis une archive sont extraits, pour les bibliothèques ne pouvant ouvrir qu'un fichier sur le disque.
+		 *\param[in]	p_path		Le chemin du fichier.
+		 *\param[out]	p_result	Reçoit le chemin sur le disque, \p p_path lui-même s'il n'est pas monté.
+		 *\return		\p false si le fichier est monté mais n'a pas pu être trouvé ou extrait.
+		 */
+		CU_API static bool resolve( Path const & p_path
+			, Path & p_result );
+		/**
+		 *\~english
+		 *\brief		Reads a whole file, from the mounts or from the disk.
+		 *\remarks		Thread safe.
+		 *\param[in]	p_path		The file path.
+		 *\param[out]	p_content	Receives the file content.
+		 *\return		\p false if the file could not be read.
+		 *\~french
+		 *\brief		Lit un fichier entier, depuis les montages ou depuis le disque.
+		 *\remarks		Thread safe.
+		 *\param[in]	p_path		Le chemin du fichier.
+		 *\param[out]	p_content	Reçoit le contenu du fichier.
+		 *\return		\p false si le fichier n'a pas pu être lu.
+		 */
+		CU_API static bool readFile( Path const & p_path
+			, ByteArray & p_content );
+	};
+}
+
+#endif
@@ -9,6 +9,10 @@ See LICENSE file in root folder
 #include "Templates.hpp"
 #include "NonCopyable.hpp"
 #include "Exception/Assertion.hpp"
+#include "Handle.hpp"
+
+#include <atomic>
+#include <unordered_map>
 
 namespace castor
 {
@@ -19,9 +23,13 @@ namespace castor
 	\~english
 	\brief		Element collection class
 	\remark		A collection class, allowing you to store named objects, removing, finding or adding them as you wish.
+				<br />The elements are stored in a dense array, indexed by name through a hash map, and can also be referenced through stable handles.
+				<br />The writers modify the collection under its mutex, the readers use an immutable snapshot of it, republished after the modifications, so they don't wait for the writers.
 	\~french
 	\brief		Classe de collection d'éléments
 	\remark		Une classe de collection, permettant de stocker des éléments nommés, les enlever, les rechercher.
+				<br />Les éléments sont stockés dans un tableau dense, indexé par nom via une table de hachage, et peuvent aussi être référencés via des poignées stables.
+				<br />Les écrivains modifient la collection sous son mutex, les lecteurs utilisent un instantané immuable de celle-ci, republié après les modifications, afin de ne pas attendre les écrivains.
 	*/
 	template< typename TObj, typename TKey >
 	class Collection
@@ -29,17 +37,110 @@ namespace castor
 	{
 	public:
 		DECLARE_SMART_PTR( TObj );
-		DECLARE_TPL_MAP( TKey, TObjSPtr, TObjPtr );
-		typedef typename TObjPtrMap::value_type value_type;
+		typedef std::pair< TKey, TObjSPtr > value_type;
+		DECLARE_TPL_VECTOR( value_type, TObjPtr );
 		//!\~english Typedef over the key param type	\~french Typedef sur le type de la clef en paramètre de fonction
 		typedef typename CallTraits< TKey >::const_param_type key_param_type;
+		//!\~english	The index of an invalid slot.
+		//!\~french		L'indice d'un emplacement invalide.
+		static uint32_t constexpr InvalidIndex = ~0u;
+		//!\~english	Stable reference to an element, valid until the element is removed.
+		//!\~french		Référence stable vers un élément, valide jusqu'à ce que l'élément soit enlevé.
+		using Handle = castor::Handle< TObj >;
 
 	private:
-		struct Search
+		struct Slot
 		{
-			TKey m_key;
-			TObjPtrMapConstIt m_result;
+			//!\~english	The position of the element in the dense array, InvalidIndex if the slot is free.
+			//!\~french		La position de l'élément dans le tableau dense, InvalidIndex si l'emplacement est libre.
+			uint32_t position;
+			uint32_t generation;
 		};
+		using Index = std::unordered_map< TKey, uint32_t >;
+
+	public:
+		/*!
+		\~english
+		\brief		Immutable view of the collection's content, at the time it was published.
+		\remarks	The elements it holds stay alive as long as it is used, even if they are removed from the collection meanwhile.
+		\~french
+		\brief		Vue immuable du contenu de la collection, au moment où elle a été publiée.
+		\remarks	Les éléments qu'elle contient restent en vie tant qu'elle est utilisée, même s'ils sont enlevés de la collection entre temps.
+		*/
+		class Snapshot
+		{
+			friend class Collection;
+
+		public:
+			/**
+			 *\~english
+			 *\brief		Looks for an element at the given key.
+			 *\param[in]	key	The key.
+			 *\return		The element, \p nullptr if none.
+			 *\~french
+			 *\brief		Recherche un élément à la clef donnée.
+			 *\param[in]	key	La clef.
+			 *\return		L'élément, \p nullptr s'il n'y en a pas.
+			 */
+			inline TObjSPtr find( key_param_type key )const;
+			/**
+			 *\~english
+			 *\brief		Retrieves the handle of the element associated to the given key.
+			 *\param[in]	key	The key.
+			 *\return		The handle, invalid if there is no such element.
+			 *\~french
+			 *\brief		Récupère la poignée de l'élément associé à la clef donnée.
+			 *\param[in]	key	La clef.
+			 *\return		La poignée, invalide s'il n'y a pas de tel élément.
+			 */
+			inline Handle getHandle( key_param_type key )const;
+			/**
+			 *\~english
+			 *\brief		Looks for the element referenced by the given handle.
+			 *\param[in]	handle	The handle.
+			 *\return		The element, \p nullptr if the handle is not valid anymore.
+			 *\~french
+			 *\brief		Recherche l'élément référencé par la poignée donnée.
+			 *\param[in]	handle	La poignée.
+			 *\return		L'élément, \p nullptr si la poignée n'est plus valide.
+			 */
+			inline TObjSPtr find( Handle const & handle )const;
+			/**
+			 *\~english
+			 *\name Iteration.
+			 *\~french
+			 *\name Itération.
+			 */
+			/**@{*/
+			inline TObjPtrArrayConstIt begin()const
+			{
+				return m_elements.begin();
+			}
+
+			inline TObjPtrArrayConstIt end()const
+			{
+				return m_elements.end();
+			}
+
+			inline std::size_t size()const
+			{
+				return m_elements.size();
+			}
+
+			inline bool empty()const
+			{
+				return m_elements.empty();
+			}
+			/**@}*/
+
+		private:
+			TObjPtrArray m_elements;
+			//!\~english	The slot of each element, by key.
+			//!\~french		L'emplacement de chaque élément, par clef.
+			Index m_index;
+			std::vector< Slot > m_slots;
+		};
+		using SnapshotPtr = std::shared_ptr< Snapshot const >;
 
 	public:
 		/**
@@ -73,12 +174,14 @@ namespace castor
 		/**
 		 *\~english
 		 *\brief		Returns an iterator to the first element of the collection
+		 *\remarks		The collection must be locked while it is iterated, prefer getSnapshot for read only iterations.
 		 *\return		The iterator
 		 *\~french
 		 *\brief		Renvoie un itérateur sur le premier élément de la collection
+		 *\remarks		La collection doit être lockée pendant son parcours, préférer getSnapshot pour les parcours en lecture seule.
 		 *\return		L'itérateur
 		 */
-		inline TObjPtrMapIt begin();
+		inline TObjPtrArrayIt begin();
 		/**
 		 *\~english
 		 *\brief		Returns an constant iterator to the first element of the collection
@@ -87,7 +190,7 @@ namespace castor
 		 *\brief		Renvoie un itérateur constant sur le premier élément de la collection
 		 *\return		L'itérateur
 		 */
-		inline TObjPtrMapConstIt begin()const;
+		inline TObjPtrArrayConstIt begin()const;
 		/**
 		 *\~english
 		 *\brief		Returns an iterator to the after last element of the collection
@@ -96,7 +199,7 @@ namespace castor
 		 *\brief		Renvoie un itérateur sur l'après dernier élément de la collection
 		 *\return		L'itérateur
 		 */
-		inline TObjPtrMapIt end();
+		inline TObjPtrArrayIt end();
 		/**
 		 *\~english
 		 *\brief		Returns an constant iterator to the after last element of the collection
@@ -105,7 +208,7 @@ namespace castor
 		 *\brief		Renvoie un itérateur constant sur l'après dernier élément de la collection
 		 *\return		L'itérateur
 		 */
-		inline TObjPtrMapConstIt end()const;
+		inline TObjPtrArrayConstIt end()const;
 		/**
 		 *\~english
 		 *\return		\p true if the collection is empty.
@@ -167,38 +270,70 @@ namespace castor
 		/**
 		 *\~english
 		 *\brief		Removes the element associated to the given key from the collection
+		 *\remarks		The last element takes the place of the removed one in the dense array.
 		 *\param[in]	p_key	The key
 		 *\return		The associated element, nullptr if none
 		 *\~french
 		 *\brief		Enlève de la collection l'élément associé à la clef donnée
+		 *\remarks		Le dernier élément prend la place de celui enlevé dans le tableau dense.
 		 *\param[in]	p_key	La clef
 		 *\return		L'élément associé, null_ptr sinon
 		 */
 		inline TObjSPtr erase( key_param_type p_key );
-
-	protected:
 		/**
 		 *\~english
-		 *\brief		Initialises last search (empty key, invalid result).
+		 *\brief		Retrieves the handle of the element associated to the given key.
+		 *\param[in]	key	The key.
+		 *\return		The handle, invalid if there is no such element.
+		 *\~french
+		 *\brief		Récupère la poignée de l'élément associé à la clef donnée.
+		 *\param[in]	key	La clef.
+		 *\return		La poignée, invalide s'il n'y a pas de tel élément.
+		 */
+		inline Handle getHandle( key_param_type key )const;
+		/**
+		 *\~english
+		 *\brief		Looks for the element referenced by the given handle.
+		 *\param[in]	handle	The handle.
+		 *\return		The element, \p nullptr if the handle is not valid anymore.
 		 *\~french
-		 *\brief		Initialise la dernière rechercher (clef vide, résultat invalide).
+		 *\brief		Recherche l'élément référencé par la poignée donnée.
+		 *\param[in]	handle	La poignée.
+		 *\return		L'élément, \p nullptr si la poignée n'est plus valide.
 		 */
-		void doInitLast()const;
+		inline TObjSPtr find( Handle const & handle )const;
 		/**
 		 *\~english
-		 *\brief		Updates the last search, performing the lookup in the map.
-		 *\param[in]	p_key	The key to test.
+		 *\brief		Retrieves the latest snapshot of the collection, without waiting for the writers.
+		 *\remarks		If the collection has been modified since the last snapshot, a new one is published, unless a writer currently holds the lock, in which case the previous one is returned.
+		 *\return		The snapshot.
 		 *\~french
-		 *\brief		Met à jour la dernière recherche, en effectuant la recherche dans la map.
-		 *\param[in]	p_key	La clef à tester.
+		 *\brief		Récupère le dernier instantané de la collection, sans attendre les écrivains.
+		 *\remarks		Si la collection a été modifiée depuis le dernier instantané, un nouveau est publié, sauf si un écrivain détient actuellement le verrou, auquel cas le précédent est retourné.
+		 *\return		L'instantané.
 		 */
-		inline void doUpdateLast( key_param_type p_key )const;
+		inline SnapshotPtr getSnapshot()const;
+
+	private:
+		template< typename ResultT, typename FuncT >
+		inline ResultT doLookup( FuncT func )const;
+		inline void doPublish()const;
 
 	private:
-		TObjPtrMap m_objects;
+		//!\~english	The master data, modified under the mutex.
+		//!\~french		Les données maîtresses, modifiées sous le mutex.
+		Snapshot m_master;
+		//!\~english	The slot of each element, in the dense array order.
+		//!\~french		L'emplacement de chaque élément, dans l'ordre du tableau dense.
+		std::vector< uint32_t > m_positionSlots;
+		std::vector< uint32_t > m_freeSlots;
 		mutable std::recursive_mutex m_mutex;
 		mutable bool m_locked;
-		mutable Search m_last;
+		std::atomic< std::size_t > m_size{ 0u };
+		//!\~english	The snapshot given to the readers, and whether it lags behind the master data.
+		//!\~french		L'instantané donné aux lecteurs, et s'il est en retard sur les données maîtresses.
+		mutable SnapshotPtr m_snapshot;
+		mutable std::atomic_bool m_dirty{ false };
 	};
 }
 
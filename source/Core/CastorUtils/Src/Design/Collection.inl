@@ -8,9 +8,65 @@ namespace castor
 		static const xchar * WARNING_COLLECTION_DUPLICATE_OBJECT = cuT( "Collection::create - Duplicate object: " );
 	}
 
+	//*************************************************************************************************
+
+	template< typename TObj, typename TKey >
+	inline typename Collection< TObj, TKey >::TObjSPtr Collection< TObj, TKey >::Snapshot::find( key_param_type key )const
+	{
+		TObjSPtr result;
+		auto it = m_index.find( key );
+
+		if ( it != m_index.end() )
+		{
+			result = m_elements[m_slots[it->second].position].second;
+		}
+
+		return result;
+	}
+
+	template< typename TObj, typename TKey >
+	inline typename Collection< TObj, TKey >::Handle Collection< TObj, TKey >::Snapshot::getHandle( key_param_type key )const
+	{
+		Handle result;
+		auto it = m_index.find( key );
+
+		if ( it != m_index.end() )
+		{
+			result.index = it->second;
+			result.generation = m_slots[it->second].generation;
+		}
+
+		return result;
+	}
+
+	template< typename TObj, typename TKey >
+	inline typename Collection< TObj, TKey >::TObjSPtr Collection< TObj, TKey >::Snapshot::find( Handle const & handle )const
+	{
+		TObjSPtr result;
+
+		if ( handle.index < m_slots.size() )
+		{
+			auto & slot = m_slots[handle.index];
+
+			if ( slot.generation == handle.generation
+				&& slot.position != InvalidIndex )
+			{
+				result = m_elements[slot.position].second;
+			}
+		}
+
+		return result;
+	}
+
+	//*************************************************************************************************
+
+	template< typename TObj, typename TKey >
+	uint32_t constexpr Collection< TObj, TKey >::InvalidIndex;
+
 	template< typename TObj, typename TKey >
 	Collection< TObj, TKey >::Collection()
 		: m_locked( false )
+		, m_snapshot( std::make_shared< Snapshot const >() )
 	{
 	}
 	template< typename TObj, typename TKey >
@@ -30,51 +86,55 @@ namespace castor
 		m_mutex.unlock();
 	}
 	template< typename TObj, typename TKey >
-	inline typename Collection< TObj, TKey >::TObjPtrMapIt Collection< TObj, TKey >::begin()
+	inline typename Collection< TObj, TKey >::TObjPtrArrayIt Collection< TObj, TKey >::begin()
 	{
 		REQUIRE( m_locked );
-		return m_objects.begin();
+		return m_master.m_elements.begin();
 	}
 	template< typename TObj, typename TKey >
-	inline typename Collection< TObj, TKey >::TObjPtrMapConstIt Collection< TObj, TKey >::begin()const
+	inline typename Collection< TObj, TKey >::TObjPtrArrayConstIt Collection< TObj, TKey >::begin()const
 	{
 		REQUIRE( m_locked );
-		return m_objects.begin();
+		return m_master.m_elements.begin();
 	}
 	template< typename TObj, typename TKey >
-	inline typename Collection< TObj, TKey >::TObjPtrMapIt Collection< TObj, TKey >::end()
+	inline typename Collection< TObj, TKey >::TObjPtrArrayIt Collection< TObj, TKey >::end()
 	{
-		return m_objects.end();
+		return m_master.m_elements.end();
 	}
 	template< typename TObj, typename TKey >
-	inline typename Collection< TObj, TKey >::TObjPtrMapConstIt Collection< TObj, TKey >::end()const
+	inline typename Collection< TObj, TKey >::TObjPtrArrayConstIt Collection< TObj, TKey >::end()const
 	{
-		return m_objects.end();
+		return m_master.m_elements.end();
 	}
 	template< typename TObj, typename TKey >
 	inline bool Collection< TObj, TKey >::empty()const
 	{
-		return m_objects.empty();
+		return m_size.load( std::memory_order_acquire ) == 0u;
 	}
 	template< typename TObj, typename TKey >
 	inline void Collection< TObj, TKey >::clear() throw( )
 	{
 		auto lock( makeUniqueLock( m_mutex ) );
-		m_objects.clear();
-		m_last.m_key = std::move( TKey() );
+		m_master.m_elements.clear();
+		m_master.m_index.clear();
+		m_master.m_slots.clear();
+		m_positionSlots.clear();
+		m_freeSlots.clear();
+		m_size.store( 0u, std::memory_order_release );
+		// The empty snapshot is published right away, so the previous one doesn't keep the elements alive.
+		std::atomic_store( &m_snapshot, SnapshotPtr{ std::make_shared< Snapshot const >() } );
+		m_dirty.store( false, std::memory_order_release );
 	}
 	template< typename TObj, typename TKey >
 	inline typename Collection< TObj, TKey >::TObjSPtr Collection< TObj, TKey >::find( key_param_type p_key )const
 	{
-		auto lock( makeUniqueLock( m_mutex ) );
-		TObjSPtr result;
-		doUpdateLast( p_key );
-
-		if ( m_last.m_result != m_objects.end() )
+		auto result = doLookup< TObjSPtr >( [&p_key]( Snapshot const & snapshot )
 		{
-			result = m_last.m_result->second;
-		}
-		else
+			return snapshot.find( p_key );
+		} );
+
+		if ( !result )
 		{
 			Logger::logWarning( details::WARNING_COLLECTION_UNKNOWN_OBJECT + string::toString( p_key ) );
 		}
@@ -84,21 +144,35 @@ namespace castor
 	template< typename TObj, typename TKey >
 	inline std::size_t Collection< TObj, TKey >::size()const
 	{
-		auto lock( makeUniqueLock( m_mutex ) );
-		return m_objects.size();
+		return m_size.load( std::memory_order_acquire );
 	}
 	template< typename TObj, typename TKey >
 	inline bool Collection< TObj, TKey >::insert( key_param_type p_key, TObjSPtr p_element )
 	{
 		auto lock( makeUniqueLock( m_mutex ) );
-		TObjPtrMapIt it = m_objects.find( p_key );
 		bool result = false;
 
-		if ( it == m_objects.end() )
+		if ( m_master.m_index.find( p_key ) == m_master.m_index.end() )
 		{
-			m_last.m_key = std::move( TKey() );
-			m_objects.insert( value_type( p_key, p_element ) );
-			doInitLast();
+			uint32_t slot;
+
+			if ( m_freeSlots.empty() )
+			{
+				slot = uint32_t( m_master.m_slots.size() );
+				m_master.m_slots.push_back( { InvalidIndex, 0u } );
+			}
+			else
+			{
+				slot = m_freeSlots.back();
+				m_freeSlots.pop_back();
+			}
+
+			m_master.m_slots[slot].position = uint32_t( m_master.m_elements.size() );
+			m_master.m_elements.emplace_back( p_key, p_element );
+			m_master.m_index.emplace( p_key, slot );
+			m_positionSlots.push_back( slot );
+			m_size.store( m_master.m_elements.size(), std::memory_order_release );
+			m_dirty.store( true, std::memory_order_release );
 			result = true;
 		}
 		else
@@ -111,41 +185,115 @@ namespace castor
 	template< typename TObj, typename TKey >
 	inline bool Collection< TObj, TKey >::has( key_param_type p_key )const
 	{
-		auto lock( makeUniqueLock( m_mutex ) );
-		doUpdateLast( p_key );
-		return m_last.m_result != m_objects.end();
+		return bool( doLookup< Handle >( [&p_key]( Snapshot const & snapshot )
+		{
+			return snapshot.getHandle( p_key );
+		} ) );
 	}
 	template< typename TObj, typename TKey >
 	inline typename Collection< TObj, TKey >::TObjSPtr Collection< TObj, TKey >::erase( key_param_type p_key )
 	{
 		auto lock( makeUniqueLock( m_mutex ) );
 		TObjSPtr ret;
-		TObjPtrMapIt ifind = m_objects.find( p_key );
+		auto it = m_master.m_index.find( p_key );
 
-		if ( ifind != m_objects.end() )
+		if ( it != m_master.m_index.end() )
 		{
-			doInitLast();
-			ret = ifind->second;
-			m_objects.erase( p_key );
+			auto slot = it->second;
+			auto position = m_master.m_slots[slot].position;
+			ret = m_master.m_elements[position].second;
+
+			// Swap and pop, the last element takes the removed one's place.
+			auto last = uint32_t( m_master.m_elements.size() - 1u );
+
+			if ( position != last )
+			{
+				m_master.m_elements[position] = std::move( m_master.m_elements[last] );
+				m_positionSlots[position] = m_positionSlots[last];
+				m_master.m_slots[m_positionSlots[position]].position = position;
+			}
+
+			m_master.m_elements.pop_back();
+			m_positionSlots.pop_back();
+			m_master.m_slots[slot].position = InvalidIndex;
+			++m_master.m_slots[slot].generation;
+			m_freeSlots.push_back( slot );
+			m_master.m_index.erase( it );
+			m_size.store( m_master.m_elements.size(), std::memory_order_release );
+			m_dirty.store( true, std::memory_order_release );
 		}
 
 		return ret;
 	}
-
 	template< typename TObj, typename TKey >
-	void Collection< TObj, TKey >::doInitLast()const
+	inline typename Collection< TObj, TKey >::Handle Collection< TObj, TKey >::getHandle( key_param_type key )const
 	{
-		m_last.m_key = std::move( TKey() );
-		m_last.m_result = m_objects.end();
+		return doLookup< Handle >( [&key]( Snapshot const & snapshot )
+		{
+			return snapshot.getHandle( key );
+		} );
+	}
+	template< typename TObj, typename TKey >
+	inline typename Collection< TObj, TKey >::TObjSPtr Collection< TObj, TKey >::find( Handle const & handle )const
+	{
+		return doLookup< TObjSPtr >( [&handle]( Snapshot const & snapshot )
+		{
+			return snapshot.find( handle );
+		} );
 	}
+	template< typename TObj, typename TKey >
+	inline typename Collection< TObj, TKey >::SnapshotPtr Collection< TObj, TKey >::getSnapshot()const
+	{
+		if ( m_dirty.load( std::memory_order_acquire ) )
+		{
+			std::unique_lock< std::recursive_mutex > lock{ m_mutex, std::try_to_lock };
+
+			if ( lock.owns_lock() )
+			{
+				doPublish();
+			}
+		}
 
+		return std::atomic_load( &m_snapshot );
+	}
 	template< typename TObj, typename TKey >
-	void Collection< TObj, TKey >::doUpdateLast( key_param_type p_key )const
+	template< typename ResultT, typename FuncT >
+	inline ResultT Collection< TObj, TKey >::doLookup( FuncT func )const
 	{
-		if ( m_last.m_key != p_key )
+		ResultT result{};
+
+		if ( !m_dirty.load( std::memory_order_acquire ) )
+		{
+			result = func( *std::atomic_load( &m_snapshot ) );
+		}
+		else
 		{
-			m_last.m_key = p_key;
-			m_last.m_result = m_objects.find( p_key );
+			// The snapshot is late, the master data is used if it is available.
+			// Otherwise the snapshot is used, unless the object isn't in it yet.
+			std::unique_lock< std::recursive_mutex > lock{ m_mutex, std::try_to_lock };
+
+			if ( !lock.owns_lock() )
+			{
+				result = func( *std::atomic_load( &m_snapshot ) );
+
+				if ( !result )
+				{
+					lock.lock();
+				}
+			}
+
+			if ( lock.owns_lock() )
+			{
+				result = func( m_master );
+			}
 		}
+
+		return result;
+	}
+	template< typename TObj, typename TKey >
+	inline void Collection< TObj, TKey >::doPublish()const
+	{
+		std::atomic_store( &m_snapshot, SnapshotPtr{ std::make_shared< Snapshot const >( m_master ) } );
+		m_dirty.store( false, std::memory_order_release );
 	}
 }
@@ -0,0 +1,63 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CASTOR_HANDLE_H___
+#define ___CASTOR_HANDLE_H___
+
+#include "CastorUtilsPrerequisites.hpp"
+
+namespace castor
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/01/2018
+	\~english
+	\brief		Generational handle, a non owning reference to an object stored in a slot.
+	\remarks	The generation tells apart the successive objects using the same slot, so a handle to a destroyed object is detected instead of reaching its successor.
+	\~french
+	\brief		Poignée générationnelle, une référence non possédante vers un objet stocké dans un emplacement.
+	\remarks	La génération permet de distinguer les objets successifs utilisant le même emplacement, ainsi une poignée vers un objet détruit est détectée au lieu d'atteindre son successeur.
+	*/
+	template< typename T >
+	struct Handle
+	{
+		//!\~english	The index of an invalid slot.
+		//!\~french		L'indice d'un emplacement invalide.
+		static uint32_t constexpr InvalidIndex = ~0u;
+		//!\~english	The slot index.
+		//!\~french		L'indice de l'emplacement.
+		uint32_t index{ InvalidIndex };
+		//!\~english	The slot generation, when the handle was given.
+		//!\~french		La génération de l'emplacement, au moment où la poignée a été donnée.
+		uint32_t generation{ 0u };
+		/**
+		 *\~english
+		 *\return		\p false for a default constructed handle.
+		 *\~french
+		 *\return		\p false pour une poignée construite par défaut.
+		 */
+		explicit operator bool()const
+		{
+			return index != InvalidIndex;
+		}
+	};
+
+	template< typename T >
+	uint32_t constexpr Handle< T >::InvalidIndex;
+
+	template< typename T >
+	inline bool operator==( Handle< T > const & lhs, Handle< T > const & rhs )
+	{
+		return lhs.index == rhs.index
+			&& lhs.generation == rhs.generation;
+	}
+
+	template< typename T >
+	inline bool operator!=( Handle< T > const & lhs, Handle< T > const & rhs )
+	{
+		return !( lhs == rhs );
+	}
+}
+
+#endif
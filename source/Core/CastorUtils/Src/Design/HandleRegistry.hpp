@@ -0,0 +1,210 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CASTOR_HANDLE_REGISTRY_H___
+#define ___CASTOR_HANDLE_REGISTRY_H___
+
+#include "Handle.hpp"
+#include "Exception/Exception.hpp"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace castor
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/01/2018
+	\~english
+	\brief		Gives generational handles to objects it doesn't own, and resolves them.
+	\remarks	The objects register themselves when they are created, and unregister when they are destroyed.
+				<br />The slots are stored in fixed size chunks, which are never moved, so the resolution only performs atomic loads, without locking nor touching any reference count.
+	\~french
+	\brief		Donne des poignées générationnelles à des objets qu'il ne possède pas, et les résout.
+	\remarks	Les objets s'enregistrent lors de leur création, et se désenregistrent lors de leur destruction.
+				<br />Les emplacements sont stockés dans des blocs de taille fixe, qui ne sont jamais déplacés, ainsi la résolution n'effectue que des lectures atomiques, sans verrou ni compteur de références.
+	*/
+	template< typename T >
+	class HandleRegistry
+	{
+	public:
+		using HandleType = Handle< T >;
+		//!\~english	The number of slots per chunk.
+		//!\~french		Le nombre d'emplacements par bloc.
+		static uint32_t constexpr ChunkSize = 1024u;
+		//!\~english	The maximum number of chunks.
+		//!\~french		Le nombre maximal de blocs.
+		static uint32_t constexpr MaxChunks = 4096u;
+
+	private:
+		struct Slot
+		{
+			std::atomic< T * > object{ nullptr };
+			std::atomic< uint32_t > generation{ 0u };
+		};
+		using Chunk = std::array< Slot, ChunkSize >;
+
+	public:
+		HandleRegistry( HandleRegistry const & ) = delete;
+		HandleRegistry & operator=( HandleRegistry const & ) = delete;
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\~french
+		 *\brief		Constructeur.
+		 */
+		HandleRegistry()
+			: m_chunks( MaxChunks )
+		{
+		}
+		/**
+		 *\~english
+		 *\brief		Destructor.
+		 *\~french
+		 *\brief		Destructeur.
+		 */
+		~HandleRegistry()
+		{
+			for ( auto & chunk : m_chunks )
+			{
+				delete chunk.load( std::memory_order_relaxed );
+			}
+		}
+		/**
+		 *\~english
+		 *\brief		Registers an object.
+		 *\param[in]	object	The object.
+		 *\return		The handle to the object.
+		 *\~french
+		 *\brief		Enregistre un objet.
+		 *\param[in]	object	L'objet.
+		 *\return		La poignée vers l'objet.
+		 */
+		inline HandleType add( T & object )
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			HandleType result;
+
+			if ( m_free.empty() )
+			{
+				result.index = m_size;
+
+				if ( m_size % ChunkSize == 0u )
+				{
+					if ( m_size / ChunkSize >= MaxChunks )
+					{
+						CASTOR_EXCEPTION( "HandleRegistry - Too many objects" );
+					}
+
+					m_chunks[m_size / ChunkSize].store( new Chunk, std::memory_order_release );
+				}
+
+				++m_size;
+			}
+			else
+			{
+				result.index = m_free.back();
+				m_free.pop_back();
+			}
+
+			auto & slot = doGetSlot( result.index );
+			result.generation = slot.generation.load( std::memory_order_relaxed );
+			slot.object.store( &object, std::memory_order_release );
+			m_count.fetch_add( 1u, std::memory_order_relaxed );
+			return result;
+		}
+		/**
+		 *\~english
+		 *\brief		Unregisters an object, its handles become invalid.
+		 *\param[in]	handle	The object's handle.
+		 *\~french
+		 *\brief		Désenregistre un objet, ses poignées deviennent invalides.
+		 *\param[in]	handle	La poignée de l'objet.
+		 */
+		inline void remove( HandleType const & handle )
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+
+			if ( handle.index < m_size )
+			{
+				auto & slot = doGetSlot( handle.index );
+
+				if ( slot.generation.load( std::memory_order_relaxed ) == handle.generation )
+				{
+					// The generation is changed before the object is cleared, see resolve.
+					slot.generation.store( handle.generation + 1u, std::memory_order_release );
+					slot.object.store( nullptr, std::memory_order_release );
+					m_free.push_back( handle.index );
+					m_count.fetch_sub( 1u, std::memory_order_relaxed );
+				}
+			}
+		}
+		/**
+		 *\~english
+		 *\brief		Retrieves the object referenced by a handle, from any thread.
+		 *\param[in]	handle	The handle.
+		 *\return		The object, \p nullptr if it has been unregistered.
+		 *\~french
+		 *\brief		Récupère l'objet référencé par une poignée, depuis n'importe quel thread.
+		 *\param[in]	handle	La poignée.
+		 *\return		L'objet, \p nullptr s'il a été désenregistré.
+		 */
+		inline T * resolve( HandleType const & handle )const
+		{
+			T * result = nullptr;
+
+			if ( handle.index < MaxChunks * ChunkSize )
+			{
+				auto chunk = m_chunks[handle.index / ChunkSize].load( std::memory_order_acquire );
+
+				if ( chunk )
+				{
+					// The object is read first: if it belongs to a successor, the generation read afterwards is the new one.
+					auto & slot = ( *chunk )[handle.index % ChunkSize];
+					auto object = slot.object.load( std::memory_order_acquire );
+
+					if ( slot.generation.load( std::memory_order_acquire ) == handle.generation )
+					{
+						result = object;
+					}
+				}
+			}
+
+			return result;
+		}
+		/**
+		 *\~english
+		 *\return		The registered objects count.
+		 *\~french
+		 *\return		Le nombre d'objets enregistrés.
+		 */
+		inline uint32_t getCount()const
+		{
+			return m_count.load( std::memory_order_relaxed );
+		}
+
+	private:
+		inline Slot & doGetSlot( uint32_t index )
+		{
+			return ( *m_chunks[index / ChunkSize].load( std::memory_order_relaxed ) )[index % ChunkSize];
+		}
+
+	private:
+		std::mutex m_mutex;
+		std::vector< std::atomic< Chunk * > > m_chunks;
+		std::vector< uint32_t > m_free;
+		uint32_t m_size{ 0u };
+		std::atomic< uint32_t > m_count{ 0u };
+	};
+
+	template< typename T >
+	uint32_t constexpr HandleRegistry< T >::ChunkSize;
+
+	template< typename T >
+	uint32_t constexpr HandleRegistry< T >::MaxChunks;
+}
+
+#endif
@@ -71,18 +71,9 @@ namespace castor
 	bool FileParser::parseFile( Path const & path
 		, String const & content )
 	{
-		bool result = false;
 		bool bNextIsOpenBrace = false;
 		bool bCommented = false;
-		doInitialiseParser( path );
-		auto save = 0ull;
-
-		if ( m_context->m_sections.empty() )
-		{
-			m_context->m_sections.push_back( m_rootSectionId );
-		}
-
-		std::swap( m_context->m_line, save );
+		auto save = doBeginParse( path );
 		bool bReuse = false;
 		String strLine;
 		String strLine2;
@@ -172,6 +163,7 @@ namespace castor
 								{
 									if ( strLine != cuT( "{" ) )
 									{
+										doRecord( Script::Action::Type::eBlockEnd );
 										bNextIsOpenBrace = doParseScriptBlockEnd();
 										bReuse = true;
 									}
@@ -220,26 +212,127 @@ namespace castor
 			}
 		}
 
-		if ( m_context->m_sections.empty() || m_context->m_sections.back() != m_rootSectionId )
+		return doEndParse( save );
+	}
+
+	bool FileParser::replay( Path const & path
+		, Script const & script )
+	{
+		m_ignoreLevel = 0;
+		m_ignored = false;
+		bool recording = false;
+		std::swap( recording, m_recording );
+		Logger::logInfo( cuT( "FileParser : Replaying file [" ) + path.getFileName( true ) + cuT( "]." ) );
+		auto save = doBeginParse( path );
+		bool result = true;
+
+		// The directives are resolved once, the actions then only index them.
+		std::vector< ParserFunctionAndParams const * > parsers;
+		parsers.reserve( script.directives.size() );
+
+		for ( auto & directive : script.directives )
 		{
-			if ( m_context.use_count() == 1 )
-			{
-				parseError( cuT( "Unexpected end of file" ) );
-			}
-			else
+			ParserFunctionAndParams const * parser = nullptr;
+			auto sectionIt = m_parsers.find( directive.section );
+
+			if ( sectionIt != m_parsers.end() )
 			{
-				doValidate();
-				result = true;
+				auto it = sectionIt->second.find( directive.name );
+
+				if ( it != sectionIt->second.end() )
+				{
+					parser = &it->second;
+				}
 			}
+
+			parsers.push_back( parser );
 		}
-		else
+
+		for ( auto it = script.actions.begin(); result && it != script.actions.end(); ++it )
 		{
-			doValidate();
-			result = true;
+			auto & action = *it;
+			m_context->m_line = action.line;
+
+			switch ( action.type )
+			{
+			case Script::Action::Type::eInvoke:
+				result = action.directive < parsers.size()
+					&& parsers[action.directive];
+
+				if ( result )
+				{
+					m_context->m_functionName = script.directives[action.directive].name;
+					result = !m_context->m_sections.empty()
+						&& m_context->m_sections.back() == script.directives[action.directive].section;
+				}
+
+				if ( result )
+				{
+					if ( !action.valid )
+					{
+						parseError( cuT( "Directive <" ) + m_context->m_functionName + cuT( "> has missing parameters" ) );
+					}
+
+					doInvokeFunction( *parsers[action.directive], action.params, action.valid );
+				}
+				else
+				{
+					parseError( cuT( "Recorded directive doesn't match the registered parsers" ) );
+				}
+				break;
+
+			case Script::Action::Type::eDiscard:
+				m_context->m_functionName = string::split( action.text, cuT( " \t" ), 1, false )[0];
+
+				if ( !doDiscardParser( action.text ) )
+				{
+					ignore();
+				}
+				break;
+
+			case Script::Action::Type::eDelegate:
+				doDelegateParser( action.text );
+				break;
+
+			case Script::Action::Type::eEnterBlock:
+				doEnterBlock();
+				break;
+
+			case Script::Action::Type::eLeaveBlock:
+				m_context->m_functionName = cuT( "}" );
+				doLeaveBlock();
+				break;
+
+			case Script::Action::Type::eBlockEnd:
+				doParseScriptBlockEnd();
+				break;
+
+			default:
+				parseError( cuT( "Unknown recorded action" ) );
+				result = false;
+				break;
+			}
 		}
 
-		std::swap( m_context->m_line, save );
-		doCleanupParser();
+		result = doEndParse( save ) && result;
+		std::swap( recording, m_recording );
+		Logger::logInfo( cuT( "FileParser : Finished replaying file [" ) + path.getFileName( true ) + cuT( "]." ) );
+		return result;
+	}
+
+	void FileParser::startRecording()
+	{
+		m_recording = true;
+		m_script = Script{};
+		m_recordedDirectives.clear();
+	}
+
+	FileParser::Script FileParser::stopRecording()
+	{
+		Script result;
+		std::swap( result, m_script );
+		m_recording = false;
+		m_recordedDirectives.clear();
 		return result;
 	}
 
@@ -379,6 +472,11 @@ namespace castor
 			}
 			else
 			{
+				if ( auto action = doRecord( Script::Action::Type::eDelegate ) )
+				{
+					action->text = p_line;
+				}
+
 				result = doDelegateParser( p_line );
 			}
 		}
@@ -419,6 +517,11 @@ namespace castor
 		{
 			if ( iter == p_parsers.end() )
 			{
+				if ( auto action = doRecord( Script::Action::Type::eDiscard ) )
+				{
+					action->text = p_line;
+				}
+
 				if ( !doDiscardParser( p_line ) )
 				{
 					ignore();
@@ -434,27 +537,16 @@ namespace castor
 				}
 
 				ParserParameterArray filled;
+				bool valid = checkParams( strParameters, iter->second.m_params, filled );
 
-				if ( !checkParams( strParameters, iter->second.m_params, filled ) )
+				if ( auto action = doRecord( Script::Action::Type::eInvoke ) )
 				{
-					bool ignored = true;
-					std::swap( ignored, m_ignored );
-
-					try
-					{
-						result = iter->second.m_function( this, filled );
-					}
-					catch ( Exception & p_exc )
-					{
-						parseError( p_exc.getFullDescription() );
-					}
-
-					std::swap( ignored, m_ignored );
-				}
-				else
-				{
-					result = iter->second.m_function( this, filled );
+					action->directive = doGetDirectiveIndex( m_context->m_sections.back(), iter->first );
+					action->valid = valid;
+					action->params = filled;
 				}
+
+				result = doInvokeFunction( iter->second, filled, valid );
 			}
 		}
 
@@ -463,6 +555,8 @@ namespace castor
 
 	void FileParser::doEnterBlock()
 	{
+		doRecord( Script::Action::Type::eEnterBlock );
+
 		if ( m_ignored )
 		{
 			m_ignoreLevel++;
@@ -471,6 +565,8 @@ namespace castor
 
 	void FileParser::doLeaveBlock()
 	{
+		doRecord( Script::Action::Type::eLeaveBlock );
+
 		if ( doIsInIgnoredBlock() )
 		{
 			m_ignoreLevel--;
@@ -516,4 +612,103 @@ namespace castor
 
 		return sections.str();
 	}
+
+	unsigned long long FileParser::doBeginParse( Path const & path )
+	{
+		doInitialiseParser( path );
+		auto save = 0ull;
+
+		if ( m_context->m_sections.empty() )
+		{
+			m_context->m_sections.push_back( m_rootSectionId );
+		}
+
+		std::swap( m_context->m_line, save );
+		return save;
+	}
+
+	bool FileParser::doEndParse( unsigned long long savedLine )
+	{
+		bool result = false;
+
+		if ( m_context->m_sections.empty() || m_context->m_sections.back() != m_rootSectionId )
+		{
+			if ( m_context.use_count() == 1 )
+			{
+				parseError( cuT( "Unexpected end of file" ) );
+			}
+			else
+			{
+				doValidate();
+				result = true;
+			}
+		}
+		else
+		{
+			doValidate();
+			result = true;
+		}
+
+		std::swap( m_context->m_line, savedLine );
+		doCleanupParser();
+		return result;
+	}
+
+	bool FileParser::doInvokeFunction( ParserFunctionAndParams const & parser
+		, ParserParameterArray const & params
+		, bool valid )
+	{
+		bool result = false;
+
+		if ( !valid )
+		{
+			bool ignored = true;
+			std::swap( ignored, m_ignored );
+
+			try
+			{
+				result = parser.m_function( this, params );
+			}
+			catch ( Exception & p_exc )
+			{
+				parseError( p_exc.getFullDescription() );
+			}
+
+			std::swap( ignored, m_ignored );
+		}
+		else
+		{
+			result = parser.m_function( this, params );
+		}
+
+		return result;
+	}
+
+	FileParser::Script::Action * FileParser::doRecord( Script::Action::Type type )
+	{
+		Script::Action * result = nullptr;
+
+		if ( m_recording )
+		{
+			m_script.actions.push_back( Script::Action{ type, uint32_t( m_context->m_line ), 0u, true, String{}, ParserParameterArray{} } );
+			result = &m_script.actions.back();
+		}
+
+		return result;
+	}
+
+	uint32_t FileParser::doGetDirectiveIndex( uint32_t section
+		, String const & name )
+	{
+		auto it = m_recordedDirectives.find( std::make_pair( section, name ) );
+
+		if ( it == m_recordedDirectives.end() )
+		{
+			it = m_recordedDirectives.emplace( std::make_pair( section, name )
+				, uint32_t( m_script.directives.size() ) ).first;
+			m_script.directives.push_back( Script::Directive{ section, name } );
+		}
+
+		return it->second;
+	}
 }
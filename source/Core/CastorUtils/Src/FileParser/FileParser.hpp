@@ -177,6 +177,86 @@ namespace castor
 #endif
 
 		typedef std::map< uint32_t, AttributeParserMap > AttributeParsersBySection;
+		/*!
+		\~english
+		\brief		The actions performed while parsing a file, recorded so that they can be replayed without text parsing.
+		\remarks	Only the parsed values are kept: the replay invokes the same parsers, with the same parameters,
+					in the same order, hence produces the same result as the text parsing.
+		\~french
+		\brief		Les actions effectuées lors de l'analyse d'un fichier, enregistrées afin de pouvoir être rejouées sans analyse de texte.
+		\remarks	Seules les valeurs analysées sont gardées : le rejeu invoque les mêmes analyseurs, avec les mêmes paramètres,
+					dans le même ordre, et produit donc le même résultat que l'analyse du texte.
+		*/
+		struct Script
+		{
+			/*!
+			\~english
+			\brief		A directive, identified by its section and its name.
+			\~french
+			\brief		Une directive, identifiée par sa section et son nom.
+			*/
+			struct Directive
+			{
+				uint32_t section;
+				String name;
+			};
+			/*!
+			\~english
+			\brief		A parsing action.
+			\~french
+			\brief		Une action d'analyse.
+			*/
+			struct Action
+			{
+				enum class Type
+					: uint8_t
+				{
+					//!\~english	A directive parser is invoked.
+					//!\~french		Un analyseur de directive est invoqué.
+					eInvoke,
+					//!\~english	No parser has been found for the line.
+					//!\~french		Aucun analyseur n'a été trouvé pour la ligne.
+					eDiscard,
+					//!\~english	The line has been delegated, out of any section.
+					//!\~french		La ligne a été déléguée, hors de toute section.
+					eDelegate,
+					//!\~english	A block is opened.
+					//!\~french		Un bloc est ouvert.
+					eEnterBlock,
+					//!\~english	A block is closed.
+					//!\~french		Un bloc est fermé.
+					eLeaveBlock,
+					//!\~english	A block ends without having been opened (no brace after the directive).
+					//!\~french		Un bloc se termine sans avoir été ouvert (pas d'accolade après la directive).
+					eBlockEnd,
+					CASTOR_SCOPED_ENUM_BOUNDS( eInvoke )
+				};
+				//!\~english	The action type.
+				//!\~french		Le type d'action.
+				Type type;
+				//!\~english	The line number, in the parsed file.
+				//!\~french		Le numéro de ligne, dans le fichier analysé.
+				uint32_t line;
+				//!\~english	eInvoke: the index of the directive, in Script::directives.
+				//!\~french		eInvoke : l'indice de la directive, dans Script::directives.
+				uint32_t directive;
+				//!\~english	eInvoke: tells if the expected parameters were all given.
+				//!\~french		eInvoke : dit si les paramètres attendus ont tous été donnés.
+				bool valid;
+				//!\~english	eDiscard, eDelegate: the line.
+				//!\~french		eDiscard, eDelegate : la ligne.
+				String text;
+				//!\~english	eInvoke: the parsed parameters.
+				//!\~french		eInvoke : les paramètres analysés.
+				ParserParameterArray params;
+			};
+			//!\~english	The invoked directives, each one listed once.
+			//!\~french		Les directives invoquées, chacune listée une fois.
+			std::vector< Directive > directives;
+			//!\~english	The actions, in parsing order.
+			//!\~french		Les actions, dans l'ordre d'analyse.
+			std::vector< Action > actions;
+		};
 
 	public:
 		/**
@@ -219,6 +299,35 @@ namespace castor
 		 *\return		\p true si tout s'est bien passé.
 		 */
 		CU_API bool parseFile( Path const & path, String const & content );
+		/**
+		 *\~english
+		 *\brief		Replays a recorded script, invoking the parsers without any text parsing.
+		 *\param[in]	path	The path of the file the script was recorded from.
+		 *\param[in]	script	The script.
+		 *\return		\p true if OK.
+		 *\~french
+		 *\brief		Rejoue un script enregistré, en invoquant les analyseurs sans aucune analyse de texte.
+		 *\param[in]	path	Le chemin du fichier depuis lequel le script a été enregistré.
+		 *\param[in]	script	Le script.
+		 *\return		\p true si tout s'est bien passé.
+		 */
+		CU_API bool replay( Path const & path, Script const & script );
+		/**
+		 *\~english
+		 *\brief		Starts recording the actions of the following parseFile calls.
+		 *\~french
+		 *\brief		Démarre l'enregistrement des actions des appels suivants à parseFile.
+		 */
+		CU_API void startRecording();
+		/**
+		 *\~english
+		 *\brief		Stops the recording.
+		 *\return		The script recorded since the call to startRecording.
+		 *\~french
+		 *\brief		Arrête l'enregistrement.
+		 *\return		Le script enregistré depuis l'appel à startRecording.
+		 */
+		CU_API Script stopRecording();
 		/**
 		 *\~english
 		 *\brief		Logs an error in the log file.
@@ -369,10 +478,21 @@ namespace castor
 		void doLeaveBlock();
 		bool doIsInIgnoredBlock();
 		String doGetSectionsStack();
+		unsigned long long doBeginParse( Path const & path );
+		bool doEndParse( unsigned long long savedLine );
+		bool doInvokeFunction( ParserFunctionAndParams const & parser
+			, ParserParameterArray const & params
+			, bool valid );
+		Script::Action * doRecord( Script::Action::Type type );
+		uint32_t doGetDirectiveIndex( uint32_t section
+			, String const & name );
 
 	private:
 		uint32_t m_rootSectionId;
 		int m_ignoreLevel;
+		bool m_recording{ false };
+		Script m_script;
+		std::map< std::pair< uint32_t, String >, uint32_t > m_recordedDirectives;
 
 	protected:
 		//!\~english The map holding the parsers, sorted by section	\~french La map de parseurs, triés par section
@@ -0,0 +1,210 @@
+#include "BakedTexture.hpp"
+
+#include "DxtCompression.hpp"
+#include "PixelBufferBase.hpp"
+
+#include "Data/BinaryFile.hpp"
+#include "Data/Endianness.hpp"
+#include "Exception/Exception.hpp"
+
+namespace castor
+{
+	namespace
+	{
+		static uint8_t const Magic[8]{ 'C', '3', 'D', 'T', 'E', 'X', 0x1A, '\n' };
+		static uint32_t const Version = 1u;
+		static uint32_t const SrgbFlag = 0x00000001u;
+		static uint64_t const HeaderSize = sizeof( Magic ) + 6u * sizeof( uint32_t );
+		static uint64_t const LevelSize = 2u * sizeof( uint32_t ) + 2u * sizeof( uint64_t );
+		static uint64_t const LevelAlign = 16u;
+
+		template< typename T >
+		void doWrite( ByteArray & buffer, uint64_t & offset, T value )
+		{
+			if ( isBigEndian() )
+			{
+				switchEndianness( value );
+			}
+
+			std::memcpy( &buffer[offset], &value, sizeof( T ) );
+			offset += sizeof( T );
+		}
+
+		template< typename T >
+		T doRead( uint8_t const * data, uint64_t & offset )
+		{
+			T result;
+			std::memcpy( &result, data + offset, sizeof( T ) );
+			offset += sizeof( T );
+
+			if ( isBigEndian() )
+			{
+				switchEndianness( result );
+			}
+
+			return result;
+		}
+
+		uint64_t doAlign( uint64_t offset )
+		{
+			return ( offset + LevelAlign - 1u ) & ~( LevelAlign - 1u );
+		}
+
+		bool doIsBakeable( PixelFormat format )
+		{
+			return format == PixelFormat::eA8R8G8B8
+				|| PF::isDxtFormat( format );
+		}
+
+		uint32_t doGetLevelSize( PixelFormat format, Size const & size )
+		{
+			return PF::isDxtFormat( format )
+				? PF::getDxtSize( format, size )
+				: size.getWidth() * size.getHeight() * PF::getBytesPerPixel( format );
+		}
+	}
+
+	String const BakedTexture::Extension = cuT( "ctex" );
+
+	BakedTexture::BakedTexture( Path const & path )
+		: m_file{ path }
+	{
+		if ( !m_file.isMapped() )
+		{
+			CASTOR_EXCEPTION( "Couldn't map baked texture file " + string::stringCast< char >( path ) );
+		}
+
+		auto data = m_file.getData();
+		auto fileSize = m_file.getSize();
+
+		if ( fileSize < HeaderSize
+			|| std::memcmp( data, Magic, sizeof( Magic ) ) )
+		{
+			CASTOR_EXCEPTION( "Not a baked texture file: " + string::stringCast< char >( path ) );
+		}
+
+		uint64_t offset = sizeof( Magic );
+		auto version = doRead< uint32_t >( data, offset );
+		auto format = doRead< uint32_t >( data, offset );
+		auto width = doRead< uint32_t >( data, offset );
+		auto height = doRead< uint32_t >( data, offset );
+		auto levels = doRead< uint32_t >( data, offset );
+		auto flags = doRead< uint32_t >( data, offset );
+
+		if ( version != Version )
+		{
+			CASTOR_EXCEPTION( "Unsupported baked texture version in " + string::stringCast< char >( path ) );
+		}
+
+		m_format = PixelFormat( format );
+
+		if ( !doIsBakeable( m_format )
+			|| !width
+			|| !height
+			|| !levels
+			|| levels > 32u
+			|| HeaderSize + levels * LevelSize > fileSize )
+		{
+			CASTOR_EXCEPTION( "Corrupted baked texture header in " + string::stringCast< char >( path ) );
+		}
+
+		m_srgb = ( flags & SrgbFlag ) == SrgbFlag;
+		Size expected{ width, height };
+
+		for ( uint32_t i = 0u; i < levels; ++i )
+		{
+			Size size{ doRead< uint32_t >( data, offset ), doRead< uint32_t >( data, offset ) };
+			auto levelOffset = doRead< uint64_t >( data, offset );
+			auto levelSize = doRead< uint64_t >( data, offset );
+
+			if ( size != expected
+				|| levelSize != doGetLevelSize( m_format, size )
+				|| levelOffset > fileSize
+				|| levelSize > fileSize - levelOffset )
+			{
+				CASTOR_EXCEPTION( "Corrupted baked texture level in " + string::stringCast< char >( path ) );
+			}
+
+			m_levels.push_back( { size, data + levelOffset, uint32_t( levelSize ) } );
+			expected = Size{ std::max( 1u, size.getWidth() / 2u ), std::max( 1u, size.getHeight() / 2u ) };
+		}
+	}
+
+	ByteArray BakedTexture::bake( PxBufferBase const & source
+		, Options const & options )
+	{
+		if ( !doIsBakeable( options.m_format ) )
+		{
+			CASTOR_EXCEPTION( "Unsupported baked texture format " + string::stringCast< char >( PF::getFormatName( options.m_format ) ) );
+		}
+
+		if ( PF::isCompressed( source.format() ) )
+		{
+			CASTOR_EXCEPTION( "Can't bake an already compressed buffer" );
+		}
+
+		// Compute the mip chain, filtered in linear space.
+		auto rgba = PxBufferBase::create( source.dimensions()
+			, PixelFormat::eA8R8G8B8
+			, source.constPtr()
+			, source.format() );
+		ImageResampler resampler;
+		auto levels = resampler.generateMipmaps( *rgba
+			, ImageResampler::Options{ options.m_filter, options.m_srgb }
+			, options.m_mipmaps ? ~( 0u ) : 1u );
+
+		// Lay the container out.
+		std::vector< Size > sizes;
+		std::vector< uint64_t > offsets;
+		Size size = source.dimensions();
+		uint64_t total = doAlign( HeaderSize + levels.size() * LevelSize );
+
+		for ( auto & level : levels )
+		{
+			sizes.push_back( size );
+			offsets.push_back( total );
+			total = doAlign( total + doGetLevelSize( options.m_format, size ) );
+			size = Size{ std::max( 1u, size.getWidth() / 2u ), std::max( 1u, size.getHeight() / 2u ) };
+		}
+
+		ByteArray result( total, 0u );
+		uint64_t offset = 0u;
+		std::memcpy( result.data(), Magic, sizeof( Magic ) );
+		offset += sizeof( Magic );
+		doWrite( result, offset, Version );
+		doWrite( result, offset, uint32_t( options.m_format ) );
+		doWrite( result, offset, source.dimensions().getWidth() );
+		doWrite( result, offset, source.dimensions().getHeight() );
+		doWrite( result, offset, uint32_t( levels.size() ) );
+		doWrite( result, offset, options.m_srgb ? SrgbFlag : 0u );
+
+		for ( size_t i = 0u; i < levels.size(); ++i )
+		{
+			doWrite( result, offset, sizes[i].getWidth() );
+			doWrite( result, offset, sizes[i].getHeight() );
+			doWrite( result, offset, offsets[i] );
+			doWrite( result, offset, uint64_t( doGetLevelSize( options.m_format, sizes[i] ) ) );
+
+			if ( PF::isDxtFormat( options.m_format ) )
+			{
+				PF::compressDxt( options.m_format, sizes[i], levels[i]->constPtr(), &result[offsets[i]] );
+			}
+			else
+			{
+				std::memcpy( &result[offsets[i]], levels[i]->constPtr(), levels[i]->size() );
+			}
+		}
+
+		return result;
+	}
+
+	bool BakedTexture::bake( PxBufferBase const & source
+		, Options const & options
+		, Path const & path )
+	{
+		auto content = bake( source, options );
+		BinaryFile file{ path, File::OpenMode::eWrite };
+		return file.isOk()
+			&& file.writeArray( content.data(), content.size() ) == content.size();
+	}
+}
@@ -0,0 +1,189 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_BakedTexture_H___
+#define ___CU_BakedTexture_H___
+
+#include "Data/MappedFile.hpp"
+#include "Graphics/ImageResampler.hpp"
+#include "Graphics/PixelFormat.hpp"
+#include "Graphics/Size.hpp"
+
+namespace castor
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/12/2017
+	\~english
+	\brief		GPU ready texture container, holding every mip level, possibly block compressed.
+	\remarks	The file is memory mapped, the levels are read directly from the mapping, without decoding.
+				<br />The container is little endian: a header, a levels table, then each level's data, aligned on 16 bytes.
+	\~french
+	\brief		Conteneur de texture prête pour le GPU, contenant tous les niveaux de mip, éventuellement compressés par blocs.
+	\remarks	Le fichier est projeté en mémoire, les niveaux sont lus directement depuis la projection, sans décodage.
+				<br />Le conteneur est little endian : un en-tête, une table des niveaux, puis les données de chaque niveau, alignées sur 16 octets.
+	*/
+	class BakedTexture
+		: private NonCopyable
+	{
+	public:
+		/*!
+		\~english
+		\brief		The baking options.
+		\~french
+		\brief		Les options de préparation.
+		*/
+		struct Options
+		{
+			//!\~english	The baked format: PixelFormat::eA8R8G8B8, PixelFormat::eDXTC1, PixelFormat::eDXTC3 or PixelFormat::eDXTC5.
+			//!\~french		Le format préparé : PixelFormat::eA8R8G8B8, PixelFormat::eDXTC1, PixelFormat::eDXTC3 ou PixelFormat::eDXTC5.
+			PixelFormat m_format{ PixelFormat::eA8R8G8B8 };
+			//!\~english	Tells if the whole mip chain is generated.
+			//!\~french		Dit si toute la chaîne de mips est générée.
+			bool m_mipmaps{ true };
+			//!\~english	The mips filter, a box filter by default, like the mips generated at runtime.
+			//!\~french		Le filtre des mips, un filtre boîte par défaut, comme les mips générés à l'exécution.
+			ResampleFilter m_filter{ ResampleFilter::eBox };
+			//!\~english	Tells if the colours are sRGB encoded, the mips are then filtered in linear space.
+			//!\~french		Dit si les couleurs sont encodées en sRGB, les mips sont alors filtrés dans l'espace linéaire.
+			bool m_srgb{ true };
+		};
+		/*!
+		\~english
+		\brief		A mip level, pointing into the mapped file.
+		\~french
+		\brief		Un niveau de mip, pointant dans le fichier projeté.
+		*/
+		struct Level
+		{
+			//!\~english	The level dimensions.
+			//!\~french		Les dimensions du niveau.
+			Size m_dimensions;
+			//!\~english	The level data.
+			//!\~french		Les données du niveau.
+			uint8_t const * m_data;
+			//!\~english	The level data size, in bytes.
+			//!\~french		La taille des données du niveau, en octets.
+			uint32_t m_size;
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor, maps the file and validates its content.
+		 *\remarks		Throws an exception if the file can't be mapped or is not a valid container.
+		 *\param[in]	path	The file path.
+		 *\~french
+		 *\brief		Constructeur, projette le fichier et valide son contenu.
+		 *\remarks		Lance une exception si le fichier ne peut pas être projeté ou n'est pas un conteneur valide.
+		 *\param[in]	path	Le chemin du fichier.
+		 */
+		CU_API explicit BakedTexture( Path const & path );
+		/**
+		 *\~english
+		 *\brief		Bakes a pixel buffer into a container.
+		 *\param[in]	source	The source pixels, in any uncompressed format.
+		 *\param[in]	options	The baking options.
+		 *\return		The container content.
+		 *\~french
+		 *\brief		Prépare un tampon de pixels dans un conteneur.
+		 *\param[in]	source	Les pixels source, dans n'importe quel format non compressé.
+		 *\param[in]	options	Les options de préparation.
+		 *\return		Le contenu du conteneur.
+		 */
+		CU_API static ByteArray bake( PxBufferBase const & source
+			, Options const & options );
+		/**
+		 *\~english
+		 *\brief		Bakes a pixel buffer into a container file.
+		 *\param[in]	source	The source pixels, in any uncompressed format.
+		 *\param[in]	options	The baking options.
+		 *\param[in]	path	The container file path.
+		 *\return		\p false if the file couldn't be written.
+		 *\~french
+		 *\brief		Prépare un tampon de pixels dans un fichier conteneur.
+		 *\param[in]	source	Les pixels source, dans n'importe quel format non compressé.
+		 *\param[in]	options	Les options de préparation.
+		 *\param[in]	path	Le chemin du fichier conteneur.
+		 *\return		\p false si le fichier n'a pas pu être écrit.
+		 */
+		CU_API static bool bake( PxBufferBase const & source
+			, Options const & options
+			, Path const & path );
+		/**
+		 *\~english
+		 *\param[in]	index	The level index.
+		 *\return		The wanted mip level.
+		 *\~french
+		 *\param[in]	index	L'indice du niveau.
+		 *\return		Le niveau de mip voulu.
+		 */
+		inline Level const & getLevel( uint32_t index )const
+		{
+			REQUIRE( index < m_levels.size() );
+			return m_levels[index];
+		}
+		/**
+		 *\~english
+		 *\return		The mip levels count.
+		 *\~french
+		 *\return		Le nombre de niveaux de mip.
+		 */
+		inline uint32_t getLevelsCount()const
+		{
+			return uint32_t( m_levels.size() );
+		}
+		/**
+		 *\~english
+		 *\return		The pixel format.
+		 *\~french
+		 *\return		Le format des pixels.
+		 */
+		inline PixelFormat getFormat()const
+		{
+			return m_format;
+		}
+		/**
+		 *\~english
+		 *\return		The first level dimensions.
+		 *\~french
+		 *\return		Les dimensions du premier niveau.
+		 */
+		inline Size const & getDimensions()const
+		{
+			return m_levels[0].m_dimensions;
+		}
+		/**
+		 *\~english
+		 *\return		\p true if the colours are sRGB encoded.
+		 *\~french
+		 *\return		\p true si les couleurs sont encodées en sRGB.
+		 */
+		inline bool isSrgb()const
+		{
+			return m_srgb;
+		}
+
+	public:
+		//!\~english	The container files extension.
+		//!\~french		L'extension des fichiers conteneurs.
+		CU_API static String const Extension;
+
+	private:
+		//!\~english	The mapped file.
+		//!\~french		Le fichier projeté.
+		MappedFile m_file;
+		//!\~english	The pixel format.
+		//!\~french		Le format des pixels.
+		PixelFormat m_format;
+		//!\~english	Tells if the colours are sRGB encoded.
+		//!\~french		Dit si les couleurs sont encodées en sRGB.
+		bool m_srgb{ false };
+		//!\~english	The mip levels.
+		//!\~french		Les niveaux de mip.
+		std::vector< Level > m_levels;
+	};
+}
+
+#endif
@@ -1,6 +1,6 @@
 #include "BoundingBox.hpp"
 
-#include <Design/ArrayView.hpp>
+#include "Math/MathBatch.hpp"
 
 namespace castor
 {
@@ -61,41 +61,9 @@ namespace castor
 
 	BoundingBox BoundingBox::getAxisAligned( Matrix4x4r const & transformations )const
 	{
-		auto min = getMin();
-		auto max = getMax();
-		Point3r corners[8]
-		{
-			min,
-			max,
-			Point3r{ min[0], max[1], min[2] },
-			Point3r{ max[0], max[1], min[2] },
-			Point3r{ max[0], min[1], min[2] },
-			Point3r{ min[0], max[1], max[2] },
-			Point3r{ min[0], min[1], max[2] },
-			Point3r{ max[0], min[1], max[2] }
-		};
-
-		// Express object box in axis aligned coordinates.
-		for ( auto & corner : corners )
-		{
-			corner = transformations * corner;
-		}
-
-		// Retrieve axis aligned box boundaries.
-		min = corners[0];
-		max = corners[0];
-		for ( auto & corner : makeArrayView( corners + 1, corners + 8 ) )
-		{
-			min[0] = std::min( corner[0], min[0] );
-			min[1] = std::min( corner[1], min[1] );
-			min[2] = std::min( corner[2], min[2] );
-
-			max[0] = std::max( corner[0], max[0] );
-			max[1] = std::max( corner[1], max[1] );
-			max[2] = std::max( corner[2], max[2] );
-		}
-
-		return BoundingBox{ min, max };
+		BoundingBox result;
+		batch::transformBoxes( transformations, this, &result, 1u );
+		return result;
 	}
 
 	Point3r BoundingBox::getPositiveVertex( Point3r const & normal )const
@@ -0,0 +1,416 @@
+#include "DxtCompression.hpp"
+
+#include "PixelFormat.hpp"
+
+namespace castor
+{
+	namespace PF
+	{
+		namespace
+		{
+			using Block = std::array< std::array< uint8_t, 4u >, 16u >;
+
+			uint32_t doGetBlockSize( PixelFormat format )
+			{
+				return format == PixelFormat::eDXTC1
+					? 8u
+					: 16u;
+			}
+
+			void doReadBlock( Size const & size
+				, uint8_t const * src
+				, uint32_t bx
+				, uint32_t by
+				, Block & block )
+			{
+				// Texels beyond the image are clamped to its last row/column.
+				for ( uint32_t y = 0u; y < 4u; ++y )
+				{
+					auto sy = std::min( by * 4u + y, size.getHeight() - 1u );
+
+					for ( uint32_t x = 0u; x < 4u; ++x )
+					{
+						auto sx = std::min( bx * 4u + x, size.getWidth() - 1u );
+						auto texel = src + ( sy * size.getWidth() + sx ) * 4u;
+						std::memcpy( block[y * 4u + x].data(), texel, 4u );
+					}
+				}
+			}
+
+			void doWriteBlock( Size const & size
+				, Block const & block
+				, uint32_t bx
+				, uint32_t by
+				, uint8_t * dst )
+			{
+				for ( uint32_t y = 0u; y < 4u && by * 4u + y < size.getHeight(); ++y )
+				{
+					for ( uint32_t x = 0u; x < 4u && bx * 4u + x < size.getWidth(); ++x )
+					{
+						auto texel = dst + ( ( by * 4u + y ) * size.getWidth() + bx * 4u + x ) * 4u;
+						std::memcpy( texel, block[y * 4u + x].data(), 4u );
+					}
+				}
+			}
+
+			uint16_t doPack565( int r, int g, int b )
+			{
+				return uint16_t( ( ( r >> 3 ) << 11 ) | ( ( g >> 2 ) << 5 ) | ( b >> 3 ) );
+			}
+
+			std::array< int, 3u > doUnpack565( uint16_t colour )
+			{
+				int r = ( colour >> 11 ) & 0x1F;
+				int g = ( colour >> 5 ) & 0x3F;
+				int b = colour & 0x1F;
+				return
+				{
+					( r << 3 ) | ( r >> 2 ),
+					( g << 2 ) | ( g >> 4 ),
+					( b << 3 ) | ( b >> 2 ),
+				};
+			}
+
+			std::array< std::array< int, 3u >, 4u > doGetPalette( uint16_t c0, uint16_t c1 )
+			{
+				std::array< std::array< int, 3u >, 4u > result;
+				result[0] = doUnpack565( c0 );
+				result[1] = doUnpack565( c1 );
+
+				for ( size_t i = 0u; i < 3u; ++i )
+				{
+					result[2][i] = ( 2 * result[0][i] + result[1][i] ) / 3;
+					result[3][i] = ( result[0][i] + 2 * result[1][i] ) / 3;
+				}
+
+				return result;
+			}
+
+			void doEncodeColour( Block const & block, uint8_t * dst )
+			{
+				std::array< int, 3u > min{ 255, 255, 255 };
+				std::array< int, 3u > max{ 0, 0, 0 };
+				std::array< int, 3u > centre{ 0, 0, 0 };
+
+				for ( auto & texel : block )
+				{
+					for ( size_t i = 0u; i < 3u; ++i )
+					{
+						min[i] = std::min( min[i], int( texel[i] ) );
+						max[i] = std::max( max[i], int( texel[i] ) );
+						centre[i] += texel[i];
+					}
+				}
+
+				// Inset the bounding box by 1/16th of its extent, to reduce the quantisation error of the endpoints.
+				for ( size_t i = 0u; i < 3u; ++i )
+				{
+					int inset = ( max[i] - min[i] ) >> 4;
+					min[i] = std::min( min[i] + inset, 255 );
+					max[i] = std::max( max[i] - inset, 0 );
+					centre[i] /= 16;
+				}
+
+				// Select the box diagonal following the red and blue covariances to green.
+				int covRG = 0;
+				int covBG = 0;
+
+				for ( auto & texel : block )
+				{
+					int g = texel[1] - centre[1];
+					covRG += ( texel[0] - centre[0] ) * g;
+					covBG += ( texel[2] - centre[2] ) * g;
+				}
+
+				if ( covRG < 0 )
+				{
+					std::swap( min[0], max[0] );
+				}
+
+				if ( covBG < 0 )
+				{
+					std::swap( min[2], max[2] );
+				}
+
+				uint16_t c0 = doPack565( max[0], max[1], max[2] );
+				uint16_t c1 = doPack565( min[0], min[1], min[2] );
+				uint32_t indices = 0u;
+
+				if ( c0 < c1 )
+				{
+					std::swap( c0, c1 );
+				}
+
+				if ( c0 != c1 )
+				{
+					// c0 > c1 selects the four colours mode.
+					auto palette = doGetPalette( c0, c1 );
+
+					for ( uint32_t t = 0u; t < 16u; ++t )
+					{
+						uint32_t best = 0u;
+						int bestError = std::numeric_limits< int >::max();
+
+						for ( uint32_t p = 0u; p < 4u; ++p )
+						{
+							int error = 0;
+
+							for ( size_t i = 0u; i < 3u; ++i )
+							{
+								int diff = palette[p][i] - int( block[t][i] );
+								error += diff * diff;
+							}
+
+							if ( error < bestError )
+							{
+								bestError = error;
+								best = p;
+							}
+						}
+
+						indices |= best << ( t * 2u );
+					}
+				}
+
+				dst[0] = uint8_t( c0 & 0xFF );
+				dst[1] = uint8_t( c0 >> 8 );
+				dst[2] = uint8_t( c1 & 0xFF );
+				dst[3] = uint8_t( c1 >> 8 );
+				dst[4] = uint8_t( indices & 0xFF );
+				dst[5] = uint8_t( ( indices >> 8 ) & 0xFF );
+				dst[6] = uint8_t( ( indices >> 16 ) & 0xFF );
+				dst[7] = uint8_t( indices >> 24 );
+			}
+
+			void doDecodeColour( uint8_t const * src, bool dxt1, Block & block )
+			{
+				uint16_t c0 = uint16_t( src[0] | ( src[1] << 8 ) );
+				uint16_t c1 = uint16_t( src[2] | ( src[3] << 8 ) );
+				uint32_t indices = uint32_t( src[4] ) | ( uint32_t( src[5] ) << 8 ) | ( uint32_t( src[6] ) << 16 ) | ( uint32_t( src[7] ) << 24 );
+				auto palette = doGetPalette( c0, c1 );
+				std::array< uint8_t, 4u > alphas{ 255u, 255u, 255u, 255u };
+
+				if ( dxt1 && c0 <= c1 )
+				{
+					// Three colours mode, the last one being transparent black.
+					for ( size_t i = 0u; i < 3u; ++i )
+					{
+						palette[2][i] = ( palette[0][i] + palette[1][i] ) / 2;
+						palette[3][i] = 0;
+					}
+
+					alphas[3] = 0u;
+				}
+
+				for ( uint32_t t = 0u; t < 16u; ++t )
+				{
+					auto index = ( indices >> ( t * 2u ) ) & 0x03;
+					block[t][0] = uint8_t( palette[index][0] );
+					block[t][1] = uint8_t( palette[index][1] );
+					block[t][2] = uint8_t( palette[index][2] );
+					block[t][3] = alphas[index];
+				}
+			}
+
+			void doEncodeExplicitAlpha( Block const & block, uint8_t * dst )
+			{
+				for ( uint32_t t = 0u; t < 16u; t += 2u )
+				{
+					auto a0 = uint8_t( ( block[t][3] * 15u + 127u ) / 255u );
+					auto a1 = uint8_t( ( block[t + 1][3] * 15u + 127u ) / 255u );
+					dst[t / 2u] = uint8_t( a0 | ( a1 << 4 ) );
+				}
+			}
+
+			void doDecodeExplicitAlpha( uint8_t const * src, Block & block )
+			{
+				for ( uint32_t t = 0u; t < 16u; t += 2u )
+				{
+					block[t][3] = uint8_t( ( src[t / 2u] & 0x0F ) * 17u );
+					block[t + 1][3] = uint8_t( ( src[t / 2u] >> 4 ) * 17u );
+				}
+			}
+
+			std::array< int, 8u > doGetAlphaPalette( int a0, int a1 )
+			{
+				std::array< int, 8u > result;
+				result[0] = a0;
+				result[1] = a1;
+
+				if ( a0 > a1 )
+				{
+					for ( int i = 2; i < 8; ++i )
+					{
+						result[i] = ( ( 8 - i ) * a0 + ( i - 1 ) * a1 ) / 7;
+					}
+				}
+				else
+				{
+					for ( int i = 2; i < 6; ++i )
+					{
+						result[i] = ( ( 6 - i ) * a0 + ( i - 1 ) * a1 ) / 5;
+					}
+
+					result[6] = 0;
+					result[7] = 255;
+				}
+
+				return result;
+			}
+
+			void doEncodeInterpolatedAlpha( Block const & block, uint8_t * dst )
+			{
+				int a0 = 0;
+				int a1 = 255;
+
+				for ( auto & texel : block )
+				{
+					a0 = std::max( a0, int( texel[3] ) );
+					a1 = std::min( a1, int( texel[3] ) );
+				}
+
+				uint64_t indices = 0u;
+
+				if ( a0 != a1 )
+				{
+					// a0 > a1 selects the eight alphas mode.
+					auto palette = doGetAlphaPalette( a0, a1 );
+
+					for ( uint32_t t = 0u; t < 16u; ++t )
+					{
+						uint64_t best = 0u;
+						int bestError = std::numeric_limits< int >::max();
+
+						for ( uint32_t p = 0u; p < 8u; ++p )
+						{
+							int error = std::abs( palette[p] - int( block[t][3] ) );
+
+							if ( error < bestError )
+							{
+								bestError = error;
+								best = p;
+							}
+						}
+
+						indices |= best << ( t * 3u );
+					}
+				}
+
+				dst[0] = uint8_t( a0 );
+				dst[1] = uint8_t( a1 );
+
+				for ( uint32_t i = 0u; i < 6u; ++i )
+				{
+					dst[2u + i] = uint8_t( ( indices >> ( i * 8u ) ) & 0xFF );
+				}
+			}
+
+			void doDecodeInterpolatedAlpha( uint8_t const * src, Block & block )
+			{
+				auto palette = doGetAlphaPalette( src[0], src[1] );
+				uint64_t indices = 0u;
+
+				for ( uint32_t i = 0u; i < 6u; ++i )
+				{
+					indices |= uint64_t( src[2u + i] ) << ( i * 8u );
+				}
+
+				for ( uint32_t t = 0u; t < 16u; ++t )
+				{
+					block[t][3] = uint8_t( palette[( indices >> ( t * 3u ) ) & 0x07] );
+				}
+			}
+		}
+
+		bool isDxtFormat( PixelFormat format )
+		{
+			return format == PixelFormat::eDXTC1
+				|| format == PixelFormat::eDXTC3
+				|| format == PixelFormat::eDXTC5;
+		}
+
+		uint32_t getDxtSize( PixelFormat format
+			, Size const & size )
+		{
+			REQUIRE( isDxtFormat( format ) );
+			return ( ( size.getWidth() + 3u ) / 4u )
+				* ( ( size.getHeight() + 3u ) / 4u )
+				* doGetBlockSize( format );
+		}
+
+		void compressDxt( PixelFormat format
+			, Size const & size
+			, uint8_t const * src
+			, uint8_t * dst )
+		{
+			REQUIRE( isDxtFormat( format ) );
+			uint32_t blocksX = ( size.getWidth() + 3u ) / 4u;
+			uint32_t blocksY = ( size.getHeight() + 3u ) / 4u;
+			Block block;
+
+			for ( uint32_t by = 0u; by < blocksY; ++by )
+			{
+				for ( uint32_t bx = 0u; bx < blocksX; ++bx )
+				{
+					doReadBlock( size, src, bx, by, block );
+
+					switch ( format )
+					{
+					case PixelFormat::eDXTC3:
+						doEncodeExplicitAlpha( block, dst );
+						dst += 8u;
+						break;
+
+					case PixelFormat::eDXTC5:
+						doEncodeInterpolatedAlpha( block, dst );
+						dst += 8u;
+						break;
+
+					default:
+						break;
+					}
+
+					doEncodeColour( block, dst );
+					dst += 8u;
+				}
+			}
+		}
+
+		void decompressDxt( PixelFormat format
+			, Size const & size
+			, uint8_t const * src
+			, uint8_t * dst )
+		{
+			REQUIRE( isDxtFormat( format ) );
+			uint32_t blocksX = ( size.getWidth() + 3u ) / 4u;
+			uint32_t blocksY = ( size.getHeight() + 3u ) / 4u;
+			Block block;
+
+			for ( uint32_t by = 0u; by < blocksY; ++by )
+			{
+				for ( uint32_t bx = 0u; bx < blocksX; ++bx )
+				{
+					switch ( format )
+					{
+					case PixelFormat::eDXTC3:
+						doDecodeColour( src + 8u, false, block );
+						doDecodeExplicitAlpha( src, block );
+						break;
+
+					case PixelFormat::eDXTC5:
+						doDecodeColour( src + 8u, false, block );
+						doDecodeInterpolatedAlpha( src, block );
+						break;
+
+					default:
+						doDecodeColour( src, true, block );
+						break;
+					}
+
+					doWriteBlock( size, block, bx, by, dst );
+					src += doGetBlockSize( format );
+				}
+			}
+		}
+	}
+}
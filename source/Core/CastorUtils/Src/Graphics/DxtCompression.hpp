@@ -0,0 +1,79 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_DxtCompression_H___
+#define ___CU_DxtCompression_H___
+
+#include "CastorUtilsPrerequisites.hpp"
+
+#include "Graphics/Size.hpp"
+
+namespace castor
+{
+	namespace PF
+	{
+		/**
+		 *\~english
+		 *\brief		Tells if the format is one of the DXTC formats.
+		 *\param[in]	format	The pixel format.
+		 *\~french
+		 *\brief		Dit si le format est l'un des formats DXTC.
+		 *\param[in]	format	Le format des pixels.
+		 */
+		CU_API bool isDxtFormat( PixelFormat format );
+		/**
+		 *\~english
+		 *\brief		Computes the size of an image compressed in the given DXTC format.
+		 *\param[in]	format	The DXTC format.
+		 *\param[in]	size	The image dimensions.
+		 *\return		The size in bytes, the dimensions being rounded up to whole 4x4 blocks.
+		 *\~french
+		 *\brief		Calcule la taille d'une image compressée dans le format DXTC donné.
+		 *\param[in]	format	Le format DXTC.
+		 *\param[in]	size	Les dimensions de l'image.
+		 *\return		La taille en octets, les dimensions étant arrondies à des blocs 4x4 entiers.
+		 */
+		CU_API uint32_t getDxtSize( PixelFormat format
+			, Size const & size );
+		/**
+		 *\~english
+		 *\brief		Compresses an image into DXT1, DXT3 or DXT5 blocks.
+		 *\remarks		The colour endpoints are taken from the inset bounding box of each block, DXT1 blocks are always opaque.
+		 *\param[in]	format	The DXTC format.
+		 *\param[in]	size	The image dimensions.
+		 *\param[in]	src		The source pixels, in PixelFormat::eA8R8G8B8.
+		 *\param[out]	dst		Receives the blocks, must hold getDxtSize( format, size ) bytes.
+		 *\~french
+		 *\brief		Compresse une image en blocs DXT1, DXT3 ou DXT5.
+		 *\remarks		Les extrémités de couleur sont prises dans la boîte englobante réduite de chaque bloc, les blocs DXT1 sont toujours opaques.
+		 *\param[in]	format	Le format DXTC.
+		 *\param[in]	size	Les dimensions de l'image.
+		 *\param[in]	src		Les pixels source, en PixelFormat::eA8R8G8B8.
+		 *\param[out]	dst		Reçoit les blocs, doit pouvoir contenir getDxtSize( format, size ) octets.
+		 */
+		CU_API void compressDxt( PixelFormat format
+			, Size const & size
+			, uint8_t const * src
+			, uint8_t * dst );
+		/**
+		 *\~english
+		 *\brief		Decompresses DXT1, DXT3 or DXT5 blocks.
+		 *\param[in]	format	The DXTC format.
+		 *\param[in]	size	The image dimensions.
+		 *\param[in]	src		The blocks.
+		 *\param[out]	dst		Receives the pixels, in PixelFormat::eA8R8G8B8.
+		 *\~french
+		 *\brief		Décompresse des blocs DXT1, DXT3 ou DXT5.
+		 *\param[in]	format	Le format DXTC.
+		 *\param[in]	size	Les dimensions de l'image.
+		 *\param[in]	src		Les blocs.
+		 *\param[out]	dst		Reçoit les pixels, en PixelFormat::eA8R8G8B8.
+		 */
+		CU_API void decompressDxt( PixelFormat format
+			, Size const & size
+			, uint8_t const * src
+			, uint8_t * dst );
+	}
+}
+
+#endif
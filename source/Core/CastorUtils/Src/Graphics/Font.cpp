@@ -1,6 +1,8 @@
 #include "Font.hpp"
 #include "Image.hpp"
 
+#include "Data/VirtualFileSystem.hpp"
+
 #include <ft2build.h>
 
 FT_BEGIN_HEADER
@@ -121,7 +123,24 @@ namespace castor
 			void initialise()override
 			{
 				CHECK_FT_ERR( FT_Init_FreeType, &m_library );
-				CHECK_FT_ERR( FT_New_Face, m_library, string::stringCast< char >( m_path ).c_str(), 0, &m_face );
+				Path path;
+
+				if ( VirtualFileSystem::isOnDisk( m_path )
+					&& VirtualFileSystem::resolve( m_path, path ) )
+				{
+					CHECK_FT_ERR( FT_New_Face, m_library, string::stringCast< char >( path ).c_str(), 0, &m_face );
+				}
+				else
+				{
+					// The font is in a mounted archive, FreeType reads it from memory, which must outlive the face.
+					if ( !VirtualFileSystem::readFile( m_path, m_content ) )
+					{
+						CASTOR_EXCEPTION( "Couldn't read the font file " + string::stringCast< char >( m_path ) );
+					}
+
+					CHECK_FT_ERR( FT_New_Memory_Face, m_library, m_content.data(), FT_Long( m_content.size() ), 0, &m_face );
+				}
+
 				CHECK_FT_ERR( FT_Select_Charmap, m_face, FT_ENCODING_UNICODE );
 				CHECK_FT_ERR( FT_Set_Pixel_Sizes, m_face, 0, m_height );
 			}
@@ -132,6 +151,19 @@ namespace castor
 				CHECK_FT_ERR( FT_Done_FreeType, m_library );
 				m_library = nullptr;
 				m_face = nullptr;
+				m_content.clear();
+			}
+
+			Size getMaxSize()override
+			{
+				if ( !m_face )
+				{
+					return Size{};
+				}
+
+				auto const & metrics = m_face->size->metrics;
+				return Size{ uint32_t( metrics.max_advance >> 6 )
+					, uint32_t( ( metrics.ascender - metrics.descender ) >> 6 ) };
 			}
 
 			Glyph loadGlyph( char32_t p_c32 )override
@@ -189,6 +221,7 @@ namespace castor
 			uint32_t const m_height;
 			FT_Library m_library{};
 			FT_Face m_face{};
+			ByteArray m_content;
 		};
 	}
 
@@ -256,24 +289,12 @@ namespace castor
 				}
 
 				p_font.setFaceName( p_pathFile.getFileName() );
-				p_font.getGlyphLoader().initialise();
-				uint8_t const min = std::numeric_limits< uint8_t >::lowest();
-				uint8_t const max = std::numeric_limits< uint8_t >::max();
-				uint32_t maxHeight = 0;
-				uint32_t maxWidth = 0;
-
-				// We load the glyphs
-				for ( uint8_t c = min; c < max; c++ )
-				{
-					char tmp[] { char( c ), 0, 0, 0 };
-					Glyph const & glyph = p_font.doLoadGlyph( string::utf8::toUtf8( tmp ) );
-					maxHeight = std::max< int >( maxHeight, glyph.getSize().getHeight() );
-					maxWidth = std::max< int >( maxWidth, glyph.getAdvance() );
-				}
+				p_font.doInitialiseGlyphLoader();
 
-				p_font.getGlyphLoader().cleanup();
-				p_font.setMaxHeight( maxHeight );
-				p_font.setMaxWidth( maxWidth );
+				// The glyphs are loaded on demand, only the face metrics are needed here.
+				Size const maxSize = p_font.getGlyphLoader().getMaxSize();
+				p_font.setMaxHeight( maxSize.getHeight() );
+				p_font.setMaxWidth( maxSize.getWidth() );
 				result = true;
 			}
 			catch ( std::runtime_error & p_exc )
@@ -310,32 +331,49 @@ namespace castor
 
 	Font::~Font()
 	{
+		doCleanupGlyphLoader();
+	}
+
+	void Font::setGlyphLoader( std::unique_ptr< SFontImpl > && p_loader )
+	{
+		doCleanupGlyphLoader();
+		m_glyphLoader = std::move( p_loader );
 	}
 
 	void Font::loadGlyph( char32_t p_char )
 	{
-		m_glyphLoader->initialise();
+		doInitialiseGlyphLoader();
 		doLoadGlyph( p_char );
-		m_glyphLoader->cleanup();
 	}
 
 	Glyph const & Font::doLoadGlyph( char32_t p_char )
 	{
-		auto it = std::find_if( m_loadedGlyphs.begin(), m_loadedGlyphs.end(), [p_char]( Glyph const & p_glyph )
-		{
-			return p_glyph.getCharacter() == p_char;
-		} );
+		auto it = m_glyphsIndices.find( p_char );
 
-		if ( it == m_loadedGlyphs.end() )
+		if ( it == m_glyphsIndices.end() )
 		{
 			m_loadedGlyphs.push_back( m_glyphLoader->loadGlyph( p_char ) );
+			it = m_glyphsIndices.emplace( p_char, m_loadedGlyphs.size() - 1u ).first;
+		}
 
-			it = std::find_if( m_loadedGlyphs.begin(), m_loadedGlyphs.end(), [p_char]( Glyph const & p_glyph )
-			{
-				return p_glyph.getCharacter() == p_char;
-			} );
+		return m_loadedGlyphs[it->second];
+	}
+
+	void Font::doInitialiseGlyphLoader()
+	{
+		if ( !m_glyphLoaderInitialised )
+		{
+			m_glyphLoader->initialise();
+			m_glyphLoaderInitialised = true;
 		}
+	}
 
-		return *it;
+	void Font::doCleanupGlyphLoader()
+	{
+		if ( m_glyphLoaderInitialised )
+		{
+			m_glyphLoader->cleanup();
+			m_glyphLoaderInitialised = false;
+		}
 	}
 }
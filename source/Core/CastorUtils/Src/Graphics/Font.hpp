@@ -142,6 +142,13 @@ namespace castor
 			 *\return		Le glyphe.
 			 */
 			virtual Glyph loadGlyph( char32_t p_char ) = 0;
+			/**
+			 *\~english
+			 *\return		The maximum glyph dimensions, from the face metrics (the line height and the maximum advance).
+			 *\~french
+			 *\return		Les dimensions maximales des glyphes, depuis les métriques de la police (la hauteur de ligne et l'avance maximale).
+			 */
+			virtual Size getMaxSize() = 0;
 		};
 
 		DECLARE_VECTOR( Glyph, Glyph );
@@ -181,9 +188,11 @@ namespace castor
 		/**
 		 *\~english
 		 *\brief		Loads wanted glyph.
+		 *\remarks		The glyphs are rasterised on first use, the glyph loader stays initialised until the font is destroyed.
 		 *\param[in]	p_char	The character.
 		 *\~french
 		 *\brief		Charge le glyphe voulu.
+		 *\remarks		Les glyphes sont rastérisés à leur première utilisation, le chargeur de glyphes reste initialisé jusqu'à la destruction de la police.
 		 *\param[in]	p_char	Le caractère.
 		 */
 		CU_API void loadGlyph( char32_t p_char );
@@ -199,12 +208,7 @@ namespace castor
 		 */
 		inline bool hasGlyphAt( char32_t p_char )const
 		{
-			return m_loadedGlyphs.end() != std::find_if( m_loadedGlyphs.begin()
-				, m_loadedGlyphs.end()
-				, [p_char]( Glyph const & p_glyph )
-				{
-					return p_glyph.getCharacter() == p_char;
-				} );
+			return m_glyphsIndices.end() != m_glyphsIndices.find( p_char );
 		}
 		/**
 		 *\~english
@@ -218,19 +222,14 @@ namespace castor
 		 */
 		inline Glyph const & getGlyphAt( char32_t p_char )const
 		{
-			auto it = std::find_if( m_loadedGlyphs.begin()
-				, m_loadedGlyphs.end()
-				, [p_char]( Glyph const & p_glyph )
-				{
-					return p_glyph.getCharacter() == p_char;
-				} );
+			auto it = m_glyphsIndices.find( p_char );
 
-			if ( it == m_loadedGlyphs.end() )
+			if ( it == m_glyphsIndices.end() )
 			{
 				throw std::range_error( "Font subscript out of range" );
 			}
 
-			return *it;
+			return m_loadedGlyphs[it->second];
 		}
 		/**
 		 *\~english
@@ -244,19 +243,14 @@ namespace castor
 		 */
 		inline Glyph & getGlyphAt( char32_t p_char )
 		{
-			auto it = std::find_if( m_loadedGlyphs.begin()
-				, m_loadedGlyphs.end()
-				, [p_char]( Glyph const & p_glyph )
-				{
-					return p_glyph.getCharacter() == p_char;
-				} );
+			auto it = m_glyphsIndices.find( p_char );
 
-			if ( it == m_loadedGlyphs.end() )
+			if ( it == m_glyphsIndices.end() )
 			{
 				throw std::range_error( "Font subscript out of range" );
 			}
 
-			return *it;
+			return m_loadedGlyphs[it->second];
 		}
 		/**
 		 *\~english
@@ -271,13 +265,7 @@ namespace castor
 		inline Glyph const & operator[]( char32_t p_char )const
 		{
 			ENSURE( hasGlyphAt( p_char ) );
-
-			return *std::find_if( m_loadedGlyphs.begin()
-				, m_loadedGlyphs.end()
-				, [p_char]( Glyph const & p_glyph )
-				{
-					return p_glyph.getCharacter() == p_char;
-				} );
+			return m_loadedGlyphs[m_glyphsIndices.find( p_char )->second];
 		}
 		/**
 		 *\~english
@@ -292,13 +280,7 @@ namespace castor
 		inline Glyph & operator[]( char32_t p_char )
 		{
 			ENSURE( hasGlyphAt( p_char ) );
-
-			return *std::find_if( m_loadedGlyphs.begin()
-				, m_loadedGlyphs.end()
-				, [p_char]( Glyph const & p_glyph )
-				{
-					return p_glyph.getCharacter() == p_char;
-				} );
+			return m_loadedGlyphs[m_glyphsIndices.find( p_char )->second];
 		}
 		/**
 		 *\~english
@@ -368,10 +350,7 @@ namespace castor
 		 *\brief		Définit le chargeur de glyphes
 		 *\param[in]	p_loader	La valeur
 		 */
-		inline void setGlyphLoader( std::unique_ptr< SFontImpl > && p_loader )
-		{
-			m_glyphLoader = std::move( p_loader );
-		}
+		CU_API void setGlyphLoader( std::unique_ptr< SFontImpl > && p_loader );
 		/**
 		 *\~english
 		 *\brief		Tells if the font has a glyph loader
@@ -493,6 +472,20 @@ namespace castor
 		 *\return		Le glyphe.
 		 */
 		Glyph const & doLoadGlyph( char32_t p_char );
+		/**
+		 *\~english
+		 *\brief		Initialises the glyph loader, if not already done.
+		 *\~french
+		 *\brief		Initialise le chargeur de glyphes, si ce n'est pas déjà fait.
+		 */
+		void doInitialiseGlyphLoader();
+		/**
+		 *\~english
+		 *\brief		Cleans the glyph loader up, if it is initialised.
+		 *\~french
+		 *\brief		Nettoie le chargeur de glyphes, s'il est initialisé.
+		 */
+		void doCleanupGlyphLoader();
 
 	private:
 		//!\~english The height of the font	\~french La hauteur de la police
@@ -501,6 +494,8 @@ namespace castor
 		Path m_pathFile;
 		//!\~english The array of loaded glyphs	\~french Le tableau de glyphes chargées
 		GlyphArray m_loadedGlyphs;
+		//!\~english The index of each loaded glyph in m_loadedGlyphs	\~french L'indice de chaque glyphe chargée dans m_loadedGlyphs
+		std::map< char32_t, size_t > m_glyphsIndices;
 		//!\~english The max height of the glyphs	\~french La hauteur maximale des glyphes
 		int m_maxHeight;
 		//!\~english The max top of the glyphs	\~french La position haute maximale des glyphes
@@ -511,6 +506,8 @@ namespace castor
 		String m_faceName;
 		//!\~english The glyph loader	\~french Le chargeur de glyphes
 		std::unique_ptr< SFontImpl > m_glyphLoader;
+		//!\~english Tells if the glyph loader is initialised	\~french Dit si le chargeur de glyphes est initialisé
+		bool m_glyphLoaderInitialised{ false };
 	};
 }
 
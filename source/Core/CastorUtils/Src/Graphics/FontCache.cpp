@@ -1,6 +1,7 @@
 #include "FontCache.hpp"
 
 #include "Font.hpp"
+#include "Data/VirtualFileSystem.hpp"
 #include "Log/Logger.hpp"
 
 #if defined( CreateFont )
@@ -31,7 +32,7 @@ namespace castor
 		String name = p_path.getFileName() + cuT( "." ) + p_path.getExtension();
 		FontSPtr result;
 
-		if ( File::fileExists( p_path ) )
+		if ( VirtualFileSystem::fileExists( p_path ) )
 		{
 			result = std::make_shared< Font >( p_name, p_height, p_path );
 		}
@@ -66,7 +67,7 @@ namespace castor
 		{
 			String name = p_path.getFileName() + cuT( "." ) + p_path.getExtension();
 
-			if ( File::fileExists( p_path ) )
+			if ( VirtualFileSystem::fileExists( p_path ) )
 			{
 				result = std::make_shared< Font >( p_name, p_height, p_path );
 				Logger::logDebug( StringStream() << INFO_CACHE_CREATED_OBJECT << cuT( "Font: " ) << p_name );
@@ -82,6 +82,29 @@ namespace castor
 	CHECK_INVARIANT( m_buffer->count() > 0 );
 	END_INVARIANT_BLOCK()
 
+	Image & Image::resample( Size const & p_size )
+	{
+		ImageResampler resampler{ 1u };
+		return resample( p_size, resampler, ImageResampler::Options{} );
+	}
+
+	Image & Image::resample( Size const & p_size
+		, ImageResampler & p_resampler
+		, ImageResampler::Options const & p_options )
+	{
+		CHECK_INVARIANTS();
+
+		// Compressed and depth images are left untouched.
+		if ( p_size != getDimensions()
+			&& ImageResampler::isResamplable( getPixelFormat() ) )
+		{
+			m_buffer = p_resampler.resample( *m_buffer, p_size, p_options );
+		}
+
+		CHECK_INVARIANTS();
+		return *this;
+	}
+
 	Image & Image::fill( RgbColour const & p_clrColour )
 	{
 		CHECK_INVARIANTS();
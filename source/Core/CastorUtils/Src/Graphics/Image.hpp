@@ -8,6 +8,7 @@ See LICENSE file in root folder
 #include "Data/BinaryLoader.hpp"
 #include "Data/BinaryWriter.hpp"
 #include "Colour.hpp"
+#include "ImageResampler.hpp"
 #include "PixelBuffer.hpp"
 
 namespace castor
@@ -233,14 +234,33 @@ namespace castor
 		/**
 		 *\~english
 		 *\brief		Resizes the image to the given resolution
+		 *\remarks		Uses a single threaded ImageResampler, with a Kaiser filter.
 		 *\param[in]	size	The new resolution
 		 *\return		A reference to the image
 		 *\~french
 		 *\brief		Redimensionne l'image à la résolution donnée
+		 *\remarks		Utilise un ImageResampler mono thread, avec un filtre de Kaiser.
 		 *\param[in]	size	La nouvelle résolution
 		 *\return		La référence de l'image
 		 */
 		CU_API Image & resample( Size const & size );
+		/**
+		 *\~english
+		 *\brief		Resizes the image to the given resolution
+		 *\param[in]	size		The new resolution
+		 *\param[in]	resampler	The resampler
+		 *\param[in]	options		The resampling options
+		 *\return		A reference to the image
+		 *\~french
+		 *\brief		Redimensionne l'image à la résolution donnée
+		 *\param[in]	size		La nouvelle résolution
+		 *\param[in]	resampler	Le rééchantillonneur
+		 *\param[in]	options		Les options de rééchantillonnage
+		 *\return		La référence de l'image
+		 */
+		CU_API Image & resample( Size const & size
+			, ImageResampler & resampler
+			, ImageResampler::Options const & options );
 		/**
 		 *\~english
 		 *\brief		Fills all image pixels with the given colour
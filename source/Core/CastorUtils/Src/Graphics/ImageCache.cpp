@@ -2,6 +2,8 @@
 
 #include "Image.hpp"
 
+#include "Data/VirtualFileSystem.hpp"
+
 #if defined( CreateFont )
 #	undef CreateFont
 #endif
@@ -27,36 +29,47 @@ namespace castor
 
 	ImageSPtr ImageCache::add( String const & p_name, Path const & p_path )
 	{
-		auto lock = makeUniqueLock( *this );
 		ImageSPtr result;
 
-		if ( Collection< Image, String >::has( p_name ) )
 		{
-			result = Collection< Image, String >::find( p_name );
+			auto lock = makeUniqueLock( *this );
 
-			if ( !result->getBuffer() )
-			{
-				Image::BinaryLoader()( *result, p_path );
-			}
-			else
+			if ( Collection< Image, String >::has( p_name ) )
 			{
-				castor::Logger::logWarning( castor::StringStream() << WARNING_CACHE_DUPLICATE_OBJECT << cuT( "Image: " ) << p_name );
+				result = Collection< Image, String >::find( p_name );
+
+				if ( !result->getBuffer() )
+				{
+					Image::BinaryLoader()( *result, p_path );
+				}
+				else
+				{
+					castor::Logger::logWarning( castor::StringStream() << WARNING_CACHE_DUPLICATE_OBJECT << cuT( "Image: " ) << p_name );
+				}
+
+				return result;
 			}
 		}
-		else
+
+		if ( !VirtualFileSystem::fileExists( p_path ) )
 		{
-			String name = p_path.getFileName() + cuT( "." ) + p_path.getExtension();
+			CASTOR_EXCEPTION( "Can't create the image [" + string::stringCast< char >( p_name ) + "], invalid path: " + string::stringCast< char >( p_path ) );
+		}
 
-			if ( File::fileExists( p_path ) )
-			{
-				result = std::make_shared< Image >( p_name, p_path );
-				Collection< Image, String >::insert( p_name, result );
-				castor::Logger::logDebug( castor::StringStream() << INFO_CACHE_CREATED_OBJECT << cuT( "Image: " ) << p_name );
-			}
-			else
-			{
-				CASTOR_EXCEPTION( "Can't create the image [" + string::stringCast< char >( p_name ) + "], invalid path: " + string::stringCast< char >( p_path ) );
-			}
+		// The image is decoded out of the lock, so different images can be decoded in parallel.
+		auto image = std::make_shared< Image >( p_name, p_path );
+		auto lock = makeUniqueLock( *this );
+
+		if ( Collection< Image, String >::has( p_name ) )
+		{
+			// Decoded by another thread in the meantime.
+			result = Collection< Image, String >::find( p_name );
+		}
+		else
+		{
+			result = image;
+			Collection< Image, String >::insert( p_name, result );
+			castor::Logger::logDebug( castor::StringStream() << INFO_CACHE_CREATED_OBJECT << cuT( "Image: " ) << p_name );
 		}
 
 		return result;
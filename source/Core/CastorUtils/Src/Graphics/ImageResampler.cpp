@@ -0,0 +1,487 @@
+#include "ImageResampler.hpp"
+
+#include "PixelBufferBase.hpp"
+
+#include "Exception/Exception.hpp"
+#include "Math/Angle.hpp"
+
+#include <thread>
+
+#if CASTOR_USE_SSE2
+#	include <xmmintrin.h>
+#endif
+
+namespace castor
+{
+	namespace
+	{
+		// Under this rows count, the jobs dispatch costs more than the filtering itself.
+		uint32_t constexpr MinRowsPerJob = 16u;
+		// Kaiser window radius, in texels of the filtered image, and shape parameter.
+		float constexpr KaiserRadius = 3.0f;
+		float constexpr KaiserAlpha = 4.0f;
+
+		/**
+		 *\~english
+		 *\brief		The source texels contributing to each destination texel, along one axis.
+		 *\~french
+		 *\brief		Les texels source contribuant à chaque texel destination, selon un axe.
+		 */
+		struct Contributions
+		{
+			std::vector< uint32_t > m_first;
+			std::vector< uint32_t > m_count;
+			std::vector< uint32_t > m_offset;
+			std::vector< float > m_weights;
+		};
+
+		bool doIsFloatFormat( PixelFormat format )
+		{
+			switch ( format )
+			{
+			case PixelFormat::eL16F32F:
+			case PixelFormat::eL32F:
+			case PixelFormat::eAL16F32F:
+			case PixelFormat::eAL32F:
+			case PixelFormat::eRGB16F:
+			case PixelFormat::eRGBA16F:
+			case PixelFormat::eRGB16F32F:
+			case PixelFormat::eRGBA16F32F:
+			case PixelFormat::eRGB32F:
+			case PixelFormat::eRGBA32F:
+				return true;
+
+			default:
+				return false;
+			}
+		}
+
+		bool doIsSrgbFormat( PixelFormat format )
+		{
+			return format == PixelFormat::eR8G8B8_SRGB
+				|| format == PixelFormat::eB8G8R8_SRGB
+				|| format == PixelFormat::eA8R8G8B8_SRGB
+				|| format == PixelFormat::eA8B8G8R8_SRGB;
+		}
+
+		float doSrgbToLinear( float value )
+		{
+			return value <= 0.04045f
+				? value / 12.92f
+				: std::pow( ( value + 0.055f ) / 1.055f, 2.4f );
+		}
+
+		float doLinearToSrgb( float value )
+		{
+			return value <= 0.0031308f
+				? value * 12.92f
+				: 1.055f * std::pow( value, 1.0f / 2.4f ) - 0.055f;
+		}
+
+		double doBesselI0( double value )
+		{
+			// Power series, converges quickly for the alpha values used here.
+			double result = 1.0;
+			double term = 1.0;
+			double half = value * 0.5;
+
+			for ( uint32_t k = 1u; k < 32u && term > result * 1.0e-12; ++k )
+			{
+				term *= ( half / k ) * ( half / k );
+				result += term;
+			}
+
+			return result;
+		}
+
+		float doKaiser( float value )
+		{
+			static double const norm = 1.0 / doBesselI0( KaiserAlpha );
+			auto t = value / KaiserRadius;
+
+			if ( std::abs( t ) >= 1.0f )
+			{
+				return 0.0f;
+			}
+
+			auto x = float( Angle::Pi ) * value;
+			auto sinc = std::abs( value ) < 1.0e-5f
+				? 1.0f
+				: std::sin( x ) / x;
+			return sinc * float( doBesselI0( KaiserAlpha * std::sqrt( 1.0f - t * t ) ) * norm );
+		}
+
+		Contributions doGetContributions( uint32_t srcSize
+			, uint32_t dstSize
+			, ResampleFilter filter )
+		{
+			Contributions result;
+			result.m_first.reserve( dstSize );
+			result.m_count.reserve( dstSize );
+			result.m_offset.reserve( dstSize );
+			auto scale = float( srcSize ) / float( dstSize );
+			// When minifying, the filter is stretched to cover all the source texels of a destination texel.
+			auto stretch = std::max( 1.0f, scale );
+			auto support = filter == ResampleFilter::eBox
+				? 0.5f * stretch
+				: KaiserRadius * stretch;
+
+			for ( uint32_t d = 0u; d < dstSize; ++d )
+			{
+				auto centre = ( float( d ) + 0.5f ) * scale;
+				auto first = uint32_t( std::max( 0, int32_t( std::floor( centre - support ) ) ) );
+				auto last = uint32_t( std::min( int32_t( srcSize ), int32_t( std::ceil( centre + support ) ) ) );
+				auto offset = uint32_t( result.m_weights.size() );
+				float total = 0.0f;
+
+				for ( uint32_t s = first; s < last; ++s )
+				{
+					float weight;
+
+					if ( filter == ResampleFilter::eBox )
+					{
+						// Overlap of the source texel with the destination texel footprint.
+						weight = std::max( 0.0f, std::min( float( s + 1u ), centre + support ) - std::max( float( s ), centre - support ) );
+					}
+					else
+					{
+						weight = doKaiser( ( float( s ) + 0.5f - centre ) / stretch );
+					}
+
+					result.m_weights.push_back( weight );
+					total += weight;
+				}
+
+				// The texels beyond the image borders are dropped, the remaining weights are normalised.
+				if ( std::abs( total ) < std::numeric_limits< float >::epsilon() )
+				{
+					result.m_weights.resize( offset );
+					first = std::min( uint32_t( centre ), srcSize - 1u );
+					last = first + 1u;
+					result.m_weights.push_back( 1.0f );
+				}
+				else
+				{
+					for ( auto i = offset; i < result.m_weights.size(); ++i )
+					{
+						result.m_weights[i] /= total;
+					}
+				}
+
+				result.m_first.push_back( first );
+				result.m_count.push_back( last - first );
+				result.m_offset.push_back( offset );
+			}
+
+			return result;
+		}
+
+#if CASTOR_USE_SSE2
+
+		inline void doAccumulate( float * acc, float const * src, float weight )
+		{
+			_mm_storeu_ps( acc, _mm_add_ps( _mm_loadu_ps( acc ), _mm_mul_ps( _mm_loadu_ps( src ), _mm_set1_ps( weight ) ) ) );
+		}
+
+#else
+
+		inline void doAccumulate( float * acc, float const * src, float weight )
+		{
+			acc[0] += src[0] * weight;
+			acc[1] += src[1] * weight;
+			acc[2] += src[2] * weight;
+			acc[3] += src[3] * weight;
+		}
+
+#endif
+	}
+
+	//*********************************************************************************************
+
+	/*!
+	\~english
+	\brief		A linear RGBA32F image.
+	\~french
+	\brief		Une image RGBA32F linéaire.
+	*/
+	struct ImageResampler::Level
+	{
+		Size m_size;
+		std::vector< float > m_texels;
+	};
+
+	//*********************************************************************************************
+
+	ImageResampler::ImageResampler( uint32_t threadsCount )
+	{
+		if ( !threadsCount )
+		{
+			threadsCount = std::thread::hardware_concurrency();
+		}
+
+		if ( threadsCount > 1u )
+		{
+			m_pool = std::make_unique< ThreadPool >( threadsCount );
+		}
+	}
+
+	ImageResampler::~ImageResampler()
+	{
+	}
+
+	PxBufferBaseSPtr ImageResampler::resample( PxBufferBase const & source
+		, Size const & size
+		, Options const & options )
+	{
+		if ( !isResamplable( source.format() ) )
+		{
+			CASTOR_EXCEPTION( "Unsupported resampling format " + string::stringCast< char >( PF::getFormatName( source.format() ) ) );
+		}
+
+		if ( !size.getWidth() || !size.getHeight() )
+		{
+			CASTOR_EXCEPTION( "Can't resample an image to an empty size" );
+		}
+
+		if ( size == source.dimensions() )
+		{
+			return source.clone();
+		}
+
+		auto srgb = options.m_srgb || doIsSrgbFormat( source.format() );
+		auto linear = doLinearise( source, srgb );
+		return doDelinearise( doResample( linear, size, options.m_filter )
+			, source.format()
+			, srgb );
+	}
+
+	PxBufferPtrArray ImageResampler::generateMipmaps( PxBufferBase const & source
+		, Options const & options
+		, uint32_t levels )
+	{
+		if ( !isResamplable( source.format() ) )
+		{
+			CASTOR_EXCEPTION( "Unsupported mipmaps format " + string::stringCast< char >( PF::getFormatName( source.format() ) ) );
+		}
+
+		levels = std::max( 1u, std::min( levels, getMipmapsCount( source.dimensions() ) ) );
+		auto srgb = options.m_srgb || doIsSrgbFormat( source.format() );
+		PxBufferPtrArray result;
+		result.reserve( levels );
+		result.push_back( source.clone() );
+
+		if ( levels > 1u )
+		{
+			auto level = doLinearise( source, srgb );
+
+			for ( uint32_t i = 1u; i < levels; ++i )
+			{
+				Size size{ std::max( 1u, level.m_size.getWidth() / 2u )
+					, std::max( 1u, level.m_size.getHeight() / 2u ) };
+				level = doResample( level, size, options.m_filter );
+				result.push_back( doDelinearise( level, source.format(), srgb ) );
+			}
+		}
+
+		return result;
+	}
+
+	uint32_t ImageResampler::getMipmapsCount( Size const & size )
+	{
+		uint32_t result = 1u;
+		auto dimension = std::max( size.getWidth(), size.getHeight() );
+
+		while ( dimension > 1u )
+		{
+			dimension /= 2u;
+			++result;
+		}
+
+		return result;
+	}
+
+	bool ImageResampler::isResamplable( PixelFormat format )
+	{
+		switch ( format )
+		{
+		case PixelFormat::eD16:
+		case PixelFormat::eD24:
+		case PixelFormat::eD24S8:
+		case PixelFormat::eD32:
+		case PixelFormat::eD32F:
+		case PixelFormat::eD32FS8:
+		case PixelFormat::eS1:
+		case PixelFormat::eS8:
+			return false;
+
+		default:
+			return !PF::isCompressed( format );
+		}
+	}
+
+	ImageResampler::Level ImageResampler::doLinearise( PxBufferBase const & source
+		, bool srgb )
+	{
+		auto rgba = PxBufferBase::create( source.dimensions()
+			, PixelFormat::eRGBA32F
+			, source.constPtr()
+			, source.format() );
+		Level result{ source.dimensions(), std::vector< float >( source.count() * 4u ) };
+		std::memcpy( result.m_texels.data(), rgba->constPtr(), rgba->size() );
+
+		if ( srgb )
+		{
+			// The sRGB formats are 8 bits per channel, a table covers all their values.
+			std::array< float, 256u > table;
+
+			for ( size_t i = 0u; i < table.size(); ++i )
+			{
+				table[i] = doSrgbToLinear( float( i ) / 255.0f );
+			}
+
+			bool useTable = !doIsFloatFormat( source.format() );
+			auto width = result.m_size.getWidth();
+			doParallelRows( result.m_size.getHeight(), [&result, &table, useTable, width]( uint32_t begin, uint32_t end )
+			{
+				auto it = result.m_texels.begin() + begin * width * 4u;
+				auto itEnd = result.m_texels.begin() + end * width * 4u;
+
+				while ( it != itEnd )
+				{
+					for ( uint32_t c = 0u; c < 3u; ++c, ++it )
+					{
+						*it = useTable
+							? table[uint32_t( std::max( 0.0f, std::min( 1.0f, *it ) ) * 255.0f + 0.5f )]
+							: doSrgbToLinear( *it );
+					}
+
+					// Alpha is always linear.
+					++it;
+				}
+			} );
+		}
+
+		return result;
+	}
+
+	PxBufferBaseSPtr ImageResampler::doDelinearise( Level const & level
+		, PixelFormat format
+		, bool srgb )
+	{
+		// The Kaiser negative lobes can overshoot, fixed point formats are clamped and rounded,
+		// the conversion to bytes truncates.
+		auto isFloat = doIsFloatFormat( format );
+		auto upper = isFloat
+			? std::numeric_limits< float >::max()
+			: 1.0f;
+		auto bias = isFloat
+			? 0.0f
+			: 0.5f / 255.0f;
+		auto width = level.m_size.getWidth();
+		std::vector< float > texels( level.m_texels.size() );
+		doParallelRows( level.m_size.getHeight(), [&level, &texels, srgb, upper, bias, width]( uint32_t begin, uint32_t end )
+		{
+			auto src = level.m_texels.data() + begin * width * 4u;
+			auto dst = texels.data() + begin * width * 4u;
+			auto dstEnd = texels.data() + end * width * 4u;
+
+			while ( dst != dstEnd )
+			{
+				for ( uint32_t c = 0u; c < 3u; ++c )
+				{
+					auto value = std::max( 0.0f, *src++ );
+					*dst++ = std::min( upper, ( srgb ? doLinearToSrgb( value ) : value ) + bias );
+				}
+
+				*dst++ = std::min( 1.0f, std::max( 0.0f, *src++ ) + bias );
+			}
+		} );
+		return PxBufferBase::create( level.m_size
+			, format
+			, reinterpret_cast< uint8_t const * >( texels.data() )
+			, PixelFormat::eRGBA32F );
+	}
+
+	ImageResampler::Level ImageResampler::doResample( Level const & source
+		, Size const & size
+		, ResampleFilter filter )
+	{
+		auto srcWidth = source.m_size.getWidth();
+		auto srcHeight = source.m_size.getHeight();
+		auto dstWidth = size.getWidth();
+		auto dstHeight = size.getHeight();
+		auto horizontal = doGetContributions( srcWidth, dstWidth, filter );
+		auto vertical = doGetContributions( srcHeight, dstHeight, filter );
+
+		// Horizontal pass first, the vertical one then works on the reduced width.
+		std::vector< float > intermediate( srcHeight * dstWidth * 4u, 0.0f );
+		doParallelRows( srcHeight, [&source, &horizontal, &intermediate, srcWidth, dstWidth]( uint32_t begin, uint32_t end )
+		{
+			for ( uint32_t y = begin; y < end; ++y )
+			{
+				auto srcRow = source.m_texels.data() + y * srcWidth * 4u;
+				auto dst = intermediate.data() + y * dstWidth * 4u;
+
+				for ( uint32_t x = 0u; x < dstWidth; ++x, dst += 4u )
+				{
+					auto src = srcRow + horizontal.m_first[x] * 4u;
+					auto weights = horizontal.m_weights.data() + horizontal.m_offset[x];
+
+					for ( uint32_t i = 0u; i < horizontal.m_count[x]; ++i, src += 4u )
+					{
+						doAccumulate( dst, src, weights[i] );
+					}
+				}
+			}
+		} );
+
+		Level result{ size, std::vector< float >( dstHeight * dstWidth * 4u, 0.0f ) };
+		doParallelRows( dstHeight, [&result, &vertical, &intermediate, dstWidth]( uint32_t begin, uint32_t end )
+		{
+			for ( uint32_t y = begin; y < end; ++y )
+			{
+				auto dstRow = result.m_texels.data() + y * dstWidth * 4u;
+				auto weights = vertical.m_weights.data() + vertical.m_offset[y];
+
+				// Whole rows are accumulated, to keep the reads contiguous.
+				for ( uint32_t i = 0u; i < vertical.m_count[y]; ++i )
+				{
+					auto src = intermediate.data() + ( vertical.m_first[y] + i ) * dstWidth * 4u;
+					auto dst = dstRow;
+
+					for ( uint32_t x = 0u; x < dstWidth; ++x, src += 4u, dst += 4u )
+					{
+						doAccumulate( dst, src, weights[i] );
+					}
+				}
+			}
+		} );
+
+		return result;
+	}
+
+	void ImageResampler::doParallelRows( uint32_t rows
+		, std::function< void( uint32_t, uint32_t ) > const & function )
+	{
+		if ( m_pool && rows >= 2u * MinRowsPerJob )
+		{
+			auto jobs = std::min( uint32_t( m_pool->getCount() ), rows / MinRowsPerJob );
+			auto perJob = ( rows + jobs - 1u ) / jobs;
+
+			for ( uint32_t begin = 0u; begin < rows; begin += perJob )
+			{
+				auto end = std::min( rows, begin + perJob );
+				m_pool->pushJob( [&function, begin, end]()
+				{
+					function( begin, end );
+				} );
+			}
+
+			m_pool->waitAll( Milliseconds( 0xFFFFFFFF ) );
+		}
+		else
+		{
+			function( 0u, rows );
+		}
+	}
+}
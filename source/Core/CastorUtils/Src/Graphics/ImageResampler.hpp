@@ -0,0 +1,165 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_ImageResampler_H___
+#define ___CU_ImageResampler_H___
+
+#include "CastorUtilsPrerequisites.hpp"
+
+#include "Graphics/Size.hpp"
+#include "Multithreading/ThreadPool.hpp"
+
+namespace castor
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		21/12/2017
+	\~english
+	\brief		The filters available to the image resampler.
+	\~french
+	\brief		Les filtres disponibles pour le rééchantillonneur d'images.
+	*/
+	enum class ResampleFilter
+		: uint8_t
+	{
+		//!\~english	Box filter, averages the covered source texels.
+		//!\~french		Filtre boîte, moyenne les texels source couverts.
+		eBox,
+		//!\~english	Kaiser windowed sinc filter, sharper, with less aliasing.
+		//!\~french		Filtre sinc fenêtré par Kaiser, plus net, avec moins d'aliasing.
+		eKaiser,
+		CASTOR_SCOPED_ENUM_BOUNDS( eBox )
+	};
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		21/12/2017
+	\~english
+	\brief		CPU image resampling and mip chain generation.
+	\remarks	Works on every uncompressed colour pixel format: the pixels are converted to linear RGBA32F,
+				filtered by separable passes, then converted back to the source format.
+				<br />The rows are split between the threads of an internal pool, each texel is processed as a 4 floats vector.
+	\~french
+	\brief		Rééchantillonnage d'images et génération de chaînes de mips sur le CPU.
+	\remarks	Fonctionne avec tous les formats de pixels couleur non compressés : les pixels sont convertis en RGBA32F linéaire,
+				filtrés par passes séparables, puis reconvertis dans le format source.
+				<br />Les lignes sont réparties entre les threads d'un pool interne, chaque texel est traité comme un vecteur de 4 flottants.
+	*/
+	class ImageResampler
+		: private NonCopyable
+	{
+	public:
+		/*!
+		\~english
+		\brief		The resampling options.
+		\~french
+		\brief		Les options de rééchantillonnage.
+		*/
+		struct Options
+		{
+			//!\~english	The filter.
+			//!\~french		Le filtre.
+			ResampleFilter m_filter{ ResampleFilter::eKaiser };
+			//!\~english	Tells if the colours are sRGB encoded, they are then filtered in linear space.
+			//!				Always true for the *_SRGB formats.
+			//!\~french		Dit si les couleurs sont encodées en sRGB, elles sont alors filtrées dans l'espace linéaire.
+			//!				Toujours vrai pour les formats *_SRGB.
+			bool m_srgb{ false };
+		};
+
+	private:
+		struct Level;
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	threadsCount	The number of threads used to filter the rows, 0 to use the hardware concurrency.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	threadsCount	Le nombre de threads utilisés pour filtrer les lignes, 0 pour utiliser la concurrence matérielle.
+		 */
+		CU_API explicit ImageResampler( uint32_t threadsCount = 0u );
+		/**
+		 *\~english
+		 *\brief		Destructor.
+		 *\~french
+		 *\brief		Destructeur.
+		 */
+		CU_API ~ImageResampler();
+		/**
+		 *\~english
+		 *\brief		Resamples an image to the given dimensions.
+		 *\param[in]	source	The source pixels.
+		 *\param[in]	size	The wanted dimensions.
+		 *\param[in]	options	The resampling options.
+		 *\return		The resampled pixels, in the source format.
+		 *\~french
+		 *\brief		Rééchantillonne une image aux dimensions données.
+		 *\param[in]	source	Les pixels source.
+		 *\param[in]	size	Les dimensions voulues.
+		 *\param[in]	options	Les options de rééchantillonnage.
+		 *\return		Les pixels rééchantillonnés, dans le format source.
+		 */
+		CU_API PxBufferBaseSPtr resample( PxBufferBase const & source
+			, Size const & size
+			, Options const & options );
+		/**
+		 *\~english
+		 *\brief		Generates the mip chain of an image.
+		 *\remarks		Each level is filtered from the previous one, kept in linear floating point, so the quantisation errors don't accumulate.
+		 *\param[in]	source	The source pixels.
+		 *\param[in]	options	The filtering options.
+		 *\param[in]	levels	The maximum levels count, including the source one.
+		 *\return		The levels, the first one being a copy of the source, all in the source format.
+		 *\~french
+		 *\brief		Génère la chaîne de mips d'une image.
+		 *\remarks		Chaque niveau est filtré depuis le précédent, gardé en flottants linéaires, afin que les erreurs de quantification ne s'accumulent pas.
+		 *\param[in]	source	Les pixels source.
+		 *\param[in]	options	Les options de filtrage.
+		 *\param[in]	levels	Le nombre maximal de niveaux, en comptant celui de la source.
+		 *\return		Les niveaux, le premier étant une copie de la source, tous dans le format source.
+		 */
+		CU_API PxBufferPtrArray generateMipmaps( PxBufferBase const & source
+			, Options const & options
+			, uint32_t levels = ~( 0u ) );
+		/**
+		 *\~english
+		 *\param[in]	size	The image dimensions.
+		 *\return		The full mip chain levels count, down to 1x1.
+		 *\~french
+		 *\param[in]	size	Les dimensions de l'image.
+		 *\return		Le nombre de niveaux de la chaîne de mips complète, jusqu'à 1x1.
+		 */
+		CU_API static uint32_t getMipmapsCount( Size const & size );
+		/**
+		 *\~english
+		 *\param[in]	format	The pixel format.
+		 *\return		\p true if the resampler can process images in this format (uncompressed colour formats).
+		 *\~french
+		 *\param[in]	format	Le format des pixels.
+		 *\return		\p true si le rééchantillonneur peut traiter des images dans ce format (formats couleur non compressés).
+		 */
+		CU_API static bool isResamplable( PixelFormat format );
+
+	private:
+		Level doLinearise( PxBufferBase const & source
+			, bool srgb );
+		PxBufferBaseSPtr doDelinearise( Level const & level
+			, PixelFormat format
+			, bool srgb );
+		Level doResample( Level const & source
+			, Size const & size
+			, ResampleFilter filter );
+		void doParallelRows( uint32_t rows
+			, std::function< void( uint32_t, uint32_t ) > const & function );
+
+	private:
+		//!\~english	The pool used to filter the rows, \p nullptr if single threaded.
+		//!\~french		Le pool utilisé pour filtrer les lignes, \p nullptr si mono thread.
+		std::unique_ptr< ThreadPool > m_pool;
+	};
+}
+
+#endif
@@ -2,10 +2,20 @@
 
 namespace castor
 {
+	namespace
+	{
+		MemoryTag & doGetMemoryTag()
+		{
+			static MemoryTag & tag = MemoryAccounting::getTag( cuT( "Images" ) );
+			return tag;
+		}
+	}
+
 	PxBufferBase::PxBufferBase( Size const & p_size, PixelFormat p_format )
 		: m_pixelFormat( p_format )
 		, m_size( p_size )
 		, m_buffer( 0 )
+		, m_memory( doGetMemoryTag() )
 	{
 	}
 
@@ -13,6 +23,7 @@ namespace castor
 		: m_pixelFormat( p_pixelBuffer.m_pixelFormat )
 		, m_size( p_pixelBuffer.m_size )
 		, m_buffer( 0 )
+		, m_memory( doGetMemoryTag() )
 	{
 	}
 
@@ -32,6 +43,7 @@ namespace castor
 	void PxBufferBase::clear()
 	{
 		m_buffer.clear();
+		m_memory.setCpuSize( m_buffer.capacity() );
 	}
 
 	void PxBufferBase::initialise( uint8_t const * p_buffer, PixelFormat p_bufferFormat )
@@ -39,6 +51,7 @@ namespace castor
 		uint8_t bpp = PF::getBytesPerPixel( format() );
 		uint32_t newSize = count() * bpp;
 		m_buffer.resize( newSize );
+		m_memory.setCpuSize( m_buffer.capacity() );
 
 		if ( p_buffer == nullptr )
 		{
@@ -73,6 +86,8 @@ namespace castor
 		std::swap( m_size, p_pixelBuffer.m_size );
 		std::swap( m_pixelFormat, p_pixelBuffer.m_pixelFormat );
 		std::swap( m_buffer, p_pixelBuffer.m_buffer );
+		m_memory.setCpuSize( m_buffer.capacity() );
+		p_pixelBuffer.m_memory.setCpuSize( p_pixelBuffer.m_buffer.capacity() );
 	}
 
 	void PxBufferBase::flip()
@@ -8,6 +8,8 @@ See LICENSE file in root folder
 #include "Size.hpp"
 #include "Position.hpp"
 
+#include "Miscellaneous/MemoryAccounting.hpp"
+
 namespace castor
 {
 	/*!
@@ -308,6 +310,10 @@ namespace castor
 		Size m_size;
 		//!\~english Buffer data	\~french données du buffer
 		px_array m_buffer;
+
+	private:
+		//!\~english Accounts for the buffer data	\~french Comptabilise les données du buffer
+		MemoryUsage m_memory;
 	};
 }
 
@@ -1,5 +1,6 @@
 #include "PixelFormat.hpp"
 #include "PixelBuffer.hpp"
+#include "PixelFormatKernels.hpp"
 
 namespace castor
 {
@@ -916,6 +917,11 @@ namespace castor
 
 		void convertBuffer( PixelFormat p_eSrcFormat, uint8_t const * p_pSrcBuffer, uint32_t p_uiSrcSize, PixelFormat p_eDstFormat, uint8_t * p_pDstBuffer, uint32_t p_uiDstSize )
 		{
+			if ( convertBufferKernel( getConversionKernel(), p_eSrcFormat, p_pSrcBuffer, p_uiSrcSize, p_eDstFormat, p_pDstBuffer, p_uiDstSize ) )
+			{
+				return;
+			}
+
 			switch ( p_eSrcFormat )
 			{
 			case PixelFormat::eL8:
@@ -19,7 +19,8 @@ namespace castor
 {
 	static inline void halfToFloat( float & target, uint16_t const * source )
 	{
-		uint32_t * xp = ( uint32_t * )&target; // Type pun output as an unsigned 32-bit int
+		uint32_t x{};
+		uint32_t * xp = &x; // Bits of the output, copied into it at the end, to avoid aliasing the float
 		uint16_t h = *source;
 
 		if ( ( h & 0x7FFFu ) == 0 )
@@ -75,12 +76,15 @@ namespace castor
 				*xp = ( xs | xe | xm ); // Combine sign bit, exponent bits, and mantissa bits
 			}
 		}
+
+		std::memcpy( &target, xp, sizeof( float ) );
 	}
 
 	static inline void floatToHalf( uint16_t * target, float source )
 	{
 		uint16_t * hp = target; // Type pun output as an unsigned 16-bit int
-		uint32_t x = *reinterpret_cast< uint32_t * >( &source ); // Type pun input as an unsigned 32-bit int
+		uint32_t x; // Bits of the input, copied to avoid aliasing the float
+		std::memcpy( &x, &source, sizeof( float ) );
 
 		if ( ( x & 0x7FFFFFFFu ) == 0 )
 		{
@@ -0,0 +1,595 @@
+#include "PixelFormatKernels.hpp"
+
+#include "PixelFormat.hpp"
+
+#include "Miscellaneous/CpuInformations.hpp"
+
+#if CASTOR_USE_SSE2
+#	include <emmintrin.h>
+#	include <tmmintrin.h>
+#	include <immintrin.h>
+#endif
+
+#if defined( __GNUC__ ) || defined( __clang__ )
+#	define CU_KernelTarget( name ) __attribute__( ( target( name ) ) )
+#else
+#	define CU_KernelTarget( name )
+#endif
+
+namespace castor
+{
+	namespace PF
+	{
+		namespace
+		{
+#if CASTOR_USE_SSE2
+
+			enum class KernelType
+			{
+				//!\~english	Byte to byte, using shuffles.
+				eShuffle,
+				//!\~english	8 bits channels to RGBA32F.
+				eBytesToFloats,
+				//!\~english	RGBA32F to 8 bits channels.
+				eFloatsToBytes,
+				//!\~english	RGBA16F to RGBA32F.
+				eHalfsToFloats,
+			};
+
+			struct Conversion
+			{
+				PixelFormat m_src;
+				PixelFormat m_dst;
+				KernelType m_type;
+				ConversionKernel m_minimum;
+			};
+
+			struct Shuffle
+			{
+				int8_t m_indices[16];
+				uint8_t m_alpha[16];
+				uint32_t m_pixels;
+			};
+
+			std::array< Conversion, 18u > const Conversions
+			{
+				{
+					{ PixelFormat::eA8R8G8B8, PixelFormat::eA8B8G8R8, KernelType::eShuffle, ConversionKernel::eSSE2 },
+					{ PixelFormat::eA8B8G8R8, PixelFormat::eA8R8G8B8, KernelType::eShuffle, ConversionKernel::eSSE2 },
+					{ PixelFormat::eR8G8B8, PixelFormat::eB8G8R8, KernelType::eShuffle, ConversionKernel::eSSSE3 },
+					{ PixelFormat::eB8G8R8, PixelFormat::eR8G8B8, KernelType::eShuffle, ConversionKernel::eSSSE3 },
+					{ PixelFormat::eR8G8B8, PixelFormat::eA8R8G8B8, KernelType::eShuffle, ConversionKernel::eSSSE3 },
+					{ PixelFormat::eR8G8B8, PixelFormat::eA8B8G8R8, KernelType::eShuffle, ConversionKernel::eSSSE3 },
+					{ PixelFormat::eB8G8R8, PixelFormat::eA8R8G8B8, KernelType::eShuffle, ConversionKernel::eSSSE3 },
+					{ PixelFormat::eB8G8R8, PixelFormat::eA8B8G8R8, KernelType::eShuffle, ConversionKernel::eSSSE3 },
+					{ PixelFormat::eA8R8G8B8, PixelFormat::eR8G8B8, KernelType::eShuffle, ConversionKernel::eSSSE3 },
+					{ PixelFormat::eA8R8G8B8, PixelFormat::eB8G8R8, KernelType::eShuffle, ConversionKernel::eSSSE3 },
+					{ PixelFormat::eA8B8G8R8, PixelFormat::eR8G8B8, KernelType::eShuffle, ConversionKernel::eSSSE3 },
+					{ PixelFormat::eA8B8G8R8, PixelFormat::eB8G8R8, KernelType::eShuffle, ConversionKernel::eSSSE3 },
+					{ PixelFormat::eA8R8G8B8, PixelFormat::eRGBA32F, KernelType::eBytesToFloats, ConversionKernel::eSSE2 },
+					{ PixelFormat::eA8B8G8R8, PixelFormat::eRGBA32F, KernelType::eBytesToFloats, ConversionKernel::eSSE2 },
+					{ PixelFormat::eR8G8B8, PixelFormat::eRGBA32F, KernelType::eBytesToFloats, ConversionKernel::eSSSE3 },
+					{ PixelFormat::eB8G8R8, PixelFormat::eRGBA32F, KernelType::eBytesToFloats, ConversionKernel::eSSSE3 },
+					{ PixelFormat::eRGBA32F, PixelFormat::eA8R8G8B8, KernelType::eFloatsToBytes, ConversionKernel::eSSE2 },
+					{ PixelFormat::eRGBA16F, PixelFormat::eRGBA32F, KernelType::eHalfsToFloats, ConversionKernel::eSSE2 },
+				}
+			};
+
+			bool doIsYmmStateEnabled()
+			{
+#	if defined( _MSC_VER )
+				return ( _xgetbv( 0 ) & 0x06 ) == 0x06;
+#	else
+				uint32_t eax;
+				uint32_t edx;
+				__asm__( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+				return ( eax & 0x06 ) == 0x06;
+#	endif
+			}
+
+			/**
+			 *\~english
+			 *\return		The byte offsets of the red, green, blue and alpha channels in a pixel of the given format, -1 for a missing channel.
+			 *\~french
+			 *\return		Les décalages en octets des composantes rouge, verte, bleue et alpha dans un pixel du format donné, -1 pour une composante absente.
+			 */
+			std::array< int8_t, 4u > doGetLayout( PixelFormat format )
+			{
+				switch ( format )
+				{
+				case PixelFormat::eR8G8B8:
+					return { { 0, 1, 2, -1 } };
+
+				case PixelFormat::eB8G8R8:
+					return { { 2, 1, 0, -1 } };
+
+				case PixelFormat::eA8B8G8R8:
+					return { { 2, 1, 0, 3 } };
+
+				default:
+					return { { 0, 1, 2, 3 } };
+				}
+			}
+
+			/**
+			 *\~english
+			 *\brief		Builds the shuffle converting as many whole pixels as a 16 bytes register can hold, both as source and destination.
+			 *\remarks		The destination channels missing from the source are filled with 0xFF.
+			 *\~french
+			 *\brief		Construit le mélange convertissant autant de pixels entiers qu'un registre de 16 octets peut en contenir, en source comme en destination.
+			 *\remarks		Les composantes de la destination absentes de la source sont remplies avec 0xFF.
+			 */
+			Shuffle doMakeShuffle( PixelFormat srcFormat
+				, PixelFormat dstFormat )
+			{
+				auto srcLayout = doGetLayout( srcFormat );
+				auto dstLayout = doGetLayout( dstFormat );
+				uint32_t srcSize = getBytesPerPixel( srcFormat );
+				uint32_t dstSize = getBytesPerPixel( dstFormat );
+				Shuffle result;
+				std::fill( std::begin( result.m_indices ), std::end( result.m_indices ), int8_t( -128 ) );
+				std::fill( std::begin( result.m_alpha ), std::end( result.m_alpha ), uint8_t( 0x00 ) );
+				result.m_pixels = std::min( 16u / srcSize, 16u / dstSize );
+
+				for ( uint32_t pixel = 0u; pixel < result.m_pixels; ++pixel )
+				{
+					for ( uint32_t channel = 0u; channel < 4u; ++channel )
+					{
+						if ( dstLayout[channel] >= 0 && uint32_t( dstLayout[channel] ) < dstSize )
+						{
+							auto index = pixel * dstSize + dstLayout[channel];
+
+							if ( srcLayout[channel] >= 0 && uint32_t( srcLayout[channel] ) < srcSize )
+							{
+								result.m_indices[index] = int8_t( pixel * srcSize + srcLayout[channel] );
+							}
+							else
+							{
+								result.m_alpha[index] = 0xFF;
+							}
+						}
+					}
+				}
+
+				return result;
+			}
+
+			//*****************************************************************************************
+			// SSE2
+
+			inline __m128i doSwapRedBlueSse2( __m128i value )
+			{
+				auto rb = _mm_and_si128( value, _mm_set1_epi32( 0x00FF00FF ) );
+				rb = _mm_or_si128( _mm_slli_epi32( rb, 16 ), _mm_srli_epi32( rb, 16 ) );
+				return _mm_or_si128( _mm_and_si128( value, _mm_set1_epi32( int32_t( 0xFF00FF00 ) ) ), rb );
+			}
+
+			inline void doStoreFloatsSse2( __m128i rgba, uint8_t * dst )
+			{
+				// Divided rather than multiplied by 1 / 255, like the scalar conversion.
+				auto const zero = _mm_setzero_si128();
+				auto const max = _mm_set1_ps( 255.0f );
+				auto lo = _mm_unpacklo_epi8( rgba, zero );
+				auto hi = _mm_unpackhi_epi8( rgba, zero );
+				auto out = reinterpret_cast< float * >( dst );
+				_mm_storeu_ps( out + 0, _mm_div_ps( _mm_cvtepi32_ps( _mm_unpacklo_epi16( lo, zero ) ), max ) );
+				_mm_storeu_ps( out + 4, _mm_div_ps( _mm_cvtepi32_ps( _mm_unpackhi_epi16( lo, zero ) ), max ) );
+				_mm_storeu_ps( out + 8, _mm_div_ps( _mm_cvtepi32_ps( _mm_unpacklo_epi16( hi, zero ) ), max ) );
+				_mm_storeu_ps( out + 12, _mm_div_ps( _mm_cvtepi32_ps( _mm_unpackhi_epi16( hi, zero ) ), max ) );
+			}
+
+			inline __m128i doLoadBytesSse2( uint8_t const * src )
+			{
+				// Truncation, keeping the low byte, like the scalar uint8_t( value * 255 ).
+				auto const max = _mm_set1_ps( 255.0f );
+				auto const mask = _mm_set1_epi32( 0xFF );
+				auto in = reinterpret_cast< float const * >( src );
+				auto r0 = _mm_and_si128( _mm_cvttps_epi32( _mm_mul_ps( _mm_loadu_ps( in + 0 ), max ) ), mask );
+				auto r1 = _mm_and_si128( _mm_cvttps_epi32( _mm_mul_ps( _mm_loadu_ps( in + 4 ), max ) ), mask );
+				auto r2 = _mm_and_si128( _mm_cvttps_epi32( _mm_mul_ps( _mm_loadu_ps( in + 8 ), max ) ), mask );
+				auto r3 = _mm_and_si128( _mm_cvttps_epi32( _mm_mul_ps( _mm_loadu_ps( in + 12 ), max ) ), mask );
+				return _mm_packus_epi16( _mm_packs_epi32( r0, r1 ), _mm_packs_epi32( r2, r3 ) );
+			}
+
+			inline __m128i doHalfToFloatSse2( __m128i halfs )
+			{
+				// The magnitude is moved to the float exponent and mantissa bits, then rebiased by 2^112,
+				// which also normalises the denormals; infinites and NaNs are patched afterwards.
+				auto sign = _mm_slli_epi32( _mm_and_si128( halfs, _mm_set1_epi32( 0x8000 ) ), 16 );
+				auto magnitude = _mm_and_si128( halfs, _mm_set1_epi32( 0x7FFF ) );
+				auto scaled = _mm_castps_si128( _mm_mul_ps( _mm_castsi128_ps( _mm_slli_epi32( magnitude, 13 ) )
+					, _mm_castsi128_ps( _mm_set1_epi32( 0x77800000 ) ) ) );
+				auto special = _mm_cmpgt_epi32( magnitude, _mm_set1_epi32( 0x7BFF ) );
+				auto nan = _mm_cmpgt_epi32( magnitude, _mm_set1_epi32( 0x7C00 ) );
+				auto result = _mm_or_si128( sign
+					, _mm_or_si128( _mm_andnot_si128( special, scaled )
+						, _mm_and_si128( special, _mm_set1_epi32( 0x7F800000 ) ) ) );
+				return _mm_or_si128( _mm_andnot_si128( nan, result )
+					, _mm_and_si128( nan, _mm_set1_epi32( int32_t( 0xFFC00000 ) ) ) );
+			}
+
+			uint32_t doShuffleSse2( uint8_t const *& src
+				, uint8_t *& dst
+				, uint32_t count )
+			{
+				// Only the red and blue swap between the 32 bits formats is available without SSSE3.
+				uint32_t done = 0u;
+
+				for ( ; count - done >= 4u; done += 4u, src += 16u, dst += 16u )
+				{
+					auto value = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src ) );
+					_mm_storeu_si128( reinterpret_cast< __m128i * >( dst ), doSwapRedBlueSse2( value ) );
+				}
+
+				return done;
+			}
+
+			uint32_t doBytesToFloatsSse2( PixelFormat srcFormat
+				, uint8_t const *& src
+				, uint8_t *& dst
+				, uint32_t count )
+			{
+				bool swap = srcFormat == PixelFormat::eA8B8G8R8;
+				uint32_t done = 0u;
+
+				for ( ; count - done >= 4u; done += 4u, src += 16u, dst += 64u )
+				{
+					auto value = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src ) );
+					doStoreFloatsSse2( swap ? doSwapRedBlueSse2( value ) : value, dst );
+				}
+
+				return done;
+			}
+
+			uint32_t doFloatsToBytesSse2( uint8_t const *& src
+				, uint8_t *& dst
+				, uint32_t count )
+			{
+				uint32_t done = 0u;
+
+				for ( ; count - done >= 4u; done += 4u, src += 64u, dst += 16u )
+				{
+					_mm_storeu_si128( reinterpret_cast< __m128i * >( dst ), doLoadBytesSse2( src ) );
+				}
+
+				return done;
+			}
+
+			uint32_t doHalfsToFloatsSse2( uint8_t const *& src
+				, uint8_t *& dst
+				, uint32_t count )
+			{
+				auto const zero = _mm_setzero_si128();
+				uint32_t done = 0u;
+
+				for ( ; count - done >= 2u; done += 2u, src += 16u, dst += 32u )
+				{
+					auto value = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src ) );
+					_mm_storeu_si128( reinterpret_cast< __m128i * >( dst ) + 0, doHalfToFloatSse2( _mm_unpacklo_epi16( value, zero ) ) );
+					_mm_storeu_si128( reinterpret_cast< __m128i * >( dst ) + 1, doHalfToFloatSse2( _mm_unpackhi_epi16( value, zero ) ) );
+				}
+
+				return done;
+			}
+
+			//*****************************************************************************************
+			// SSSE3
+
+			/**
+			 *\~english
+			 *\brief		Loops while whole 16 bytes loads and stores stay inside the buffers.
+			 *\remarks		A store may write past the converted pixels, those bytes are overwritten by the next iteration or the scalar tail.
+			 *\~french
+			 *\brief		Boucle tant que des lectures et écritures de 16 octets restent dans les tampons.
+			 *\remarks		Une écriture peut déborder des pixels convertis, ces octets sont réécrits par l'itération suivante ou la fin scalaire.
+			 */
+			inline bool doHasRoom( uint32_t remaining
+				, uint32_t pixels
+				, uint32_t srcSize
+				, uint32_t dstSize )
+			{
+				return remaining >= pixels
+					&& remaining * srcSize >= 16u
+					&& remaining * dstSize >= 16u;
+			}
+
+			CU_KernelTarget( "ssse3" )
+			uint32_t doShuffleSsse3( PixelFormat srcFormat
+				, PixelFormat dstFormat
+				, uint8_t const *& src
+				, uint8_t *& dst
+				, uint32_t count )
+			{
+				auto shuffle = doMakeShuffle( srcFormat, dstFormat );
+				auto mask = _mm_loadu_si128( reinterpret_cast< __m128i const * >( shuffle.m_indices ) );
+				auto alpha = _mm_loadu_si128( reinterpret_cast< __m128i const * >( shuffle.m_alpha ) );
+				uint32_t srcStep = shuffle.m_pixels * getBytesPerPixel( srcFormat );
+				uint32_t dstStep = shuffle.m_pixels * getBytesPerPixel( dstFormat );
+				uint32_t done = 0u;
+
+				for ( ; doHasRoom( count - done, shuffle.m_pixels, getBytesPerPixel( srcFormat ), getBytesPerPixel( dstFormat ) )
+					; done += shuffle.m_pixels, src += srcStep, dst += dstStep )
+				{
+					auto value = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src ) );
+					_mm_storeu_si128( reinterpret_cast< __m128i * >( dst ), _mm_or_si128( _mm_shuffle_epi8( value, mask ), alpha ) );
+				}
+
+				return done;
+			}
+
+			CU_KernelTarget( "ssse3" )
+			uint32_t doBytesToFloatsSsse3( PixelFormat srcFormat
+				, uint8_t const *& src
+				, uint8_t *& dst
+				, uint32_t count )
+			{
+				auto shuffle = doMakeShuffle( srcFormat, PixelFormat::eA8R8G8B8 );
+				auto mask = _mm_loadu_si128( reinterpret_cast< __m128i const * >( shuffle.m_indices ) );
+				auto alpha = _mm_loadu_si128( reinterpret_cast< __m128i const * >( shuffle.m_alpha ) );
+				uint32_t srcSize = getBytesPerPixel( srcFormat );
+				uint32_t done = 0u;
+
+				for ( ; doHasRoom( count - done, shuffle.m_pixels, srcSize, 16u )
+					; done += shuffle.m_pixels, src += shuffle.m_pixels * srcSize, dst += shuffle.m_pixels * 16u )
+				{
+					auto value = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src ) );
+					doStoreFloatsSse2( _mm_or_si128( _mm_shuffle_epi8( value, mask ), alpha ), dst );
+				}
+
+				return done;
+			}
+
+			//*****************************************************************************************
+			// AVX2
+
+			CU_KernelTarget( "avx2" )
+			uint32_t doShuffleAvx2( PixelFormat srcFormat
+				, PixelFormat dstFormat
+				, uint8_t const *& src
+				, uint8_t *& dst
+				, uint32_t count )
+			{
+				// Each 128 bits lane converts the same pixels count as the SSSE3 kernel.
+				auto shuffle = doMakeShuffle( srcFormat, dstFormat );
+				auto mask = _mm256_broadcastsi128_si256( _mm_loadu_si128( reinterpret_cast< __m128i const * >( shuffle.m_indices ) ) );
+				auto alpha = _mm256_broadcastsi128_si256( _mm_loadu_si128( reinterpret_cast< __m128i const * >( shuffle.m_alpha ) ) );
+				uint32_t srcSize = getBytesPerPixel( srcFormat );
+				uint32_t dstSize = getBytesPerPixel( dstFormat );
+				uint32_t srcStep = shuffle.m_pixels * srcSize;
+				uint32_t dstStep = shuffle.m_pixels * dstSize;
+				uint32_t done = 0u;
+
+				for ( ; count - done >= 2u * shuffle.m_pixels
+						&& doHasRoom( count - done - shuffle.m_pixels, shuffle.m_pixels, srcSize, dstSize )
+					; done += 2u * shuffle.m_pixels, src += 2u * srcStep, dst += 2u * dstStep )
+				{
+					auto value = _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( reinterpret_cast< __m128i const * >( src ) ) )
+						, _mm_loadu_si128( reinterpret_cast< __m128i const * >( src + srcStep ) )
+						, 1 );
+					value = _mm256_or_si256( _mm256_shuffle_epi8( value, mask ), alpha );
+					_mm_storeu_si128( reinterpret_cast< __m128i * >( dst ), _mm256_castsi256_si128( value ) );
+					_mm_storeu_si128( reinterpret_cast< __m128i * >( dst + dstStep ), _mm256_extracti128_si256( value, 1 ) );
+				}
+
+				return done + doShuffleSsse3( srcFormat, dstFormat, src, dst, count - done );
+			}
+
+			CU_KernelTarget( "avx2" )
+			uint32_t doBytesToFloatsAvx2( PixelFormat srcFormat
+				, uint8_t const *& src
+				, uint8_t *& dst
+				, uint32_t count )
+			{
+				auto shuffle = doMakeShuffle( srcFormat, PixelFormat::eA8R8G8B8 );
+				auto mask = _mm_loadu_si128( reinterpret_cast< __m128i const * >( shuffle.m_indices ) );
+				auto alpha = _mm_loadu_si128( reinterpret_cast< __m128i const * >( shuffle.m_alpha ) );
+				auto const max = _mm256_set1_ps( 255.0f );
+				uint32_t srcSize = getBytesPerPixel( srcFormat );
+				uint32_t done = 0u;
+
+				for ( ; doHasRoom( count - done, shuffle.m_pixels, srcSize, 16u )
+					; done += shuffle.m_pixels, src += shuffle.m_pixels * srcSize, dst += shuffle.m_pixels * 16u )
+				{
+					auto value = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src ) );
+					value = _mm_or_si128( _mm_shuffle_epi8( value, mask ), alpha );
+					auto out = reinterpret_cast< float * >( dst );
+					_mm256_storeu_ps( out + 0, _mm256_div_ps( _mm256_cvtepi32_ps( _mm256_cvtepu8_epi32( value ) ), max ) );
+					_mm256_storeu_ps( out + 8, _mm256_div_ps( _mm256_cvtepi32_ps( _mm256_cvtepu8_epi32( _mm_srli_si128( value, 8 ) ) ), max ) );
+				}
+
+				return done;
+			}
+
+			CU_KernelTarget( "avx2" )
+			uint32_t doFloatsToBytesAvx2( uint8_t const *& src
+				, uint8_t *& dst
+				, uint32_t count )
+			{
+				auto const max = _mm256_set1_ps( 255.0f );
+				auto const mask = _mm256_set1_epi32( 0xFF );
+				// The packs work per lane, this restores the pixels order.
+				auto const order = _mm256_setr_epi32( 0, 4, 1, 5, 2, 6, 3, 7 );
+				uint32_t done = 0u;
+
+				for ( ; count - done >= 8u; done += 8u, src += 128u, dst += 32u )
+				{
+					auto in = reinterpret_cast< float const * >( src );
+					auto r0 = _mm256_and_si256( _mm256_cvttps_epi32( _mm256_mul_ps( _mm256_loadu_ps( in + 0 ), max ) ), mask );
+					auto r1 = _mm256_and_si256( _mm256_cvttps_epi32( _mm256_mul_ps( _mm256_loadu_ps( in + 8 ), max ) ), mask );
+					auto r2 = _mm256_and_si256( _mm256_cvttps_epi32( _mm256_mul_ps( _mm256_loadu_ps( in + 16 ), max ) ), mask );
+					auto r3 = _mm256_and_si256( _mm256_cvttps_epi32( _mm256_mul_ps( _mm256_loadu_ps( in + 24 ), max ) ), mask );
+					auto value = _mm256_packus_epi16( _mm256_packs_epi32( r0, r1 ), _mm256_packs_epi32( r2, r3 ) );
+					_mm256_storeu_si256( reinterpret_cast< __m256i * >( dst ), _mm256_permutevar8x32_epi32( value, order ) );
+				}
+
+				return done + doFloatsToBytesSse2( src, dst, count - done );
+			}
+
+			CU_KernelTarget( "avx2" )
+			uint32_t doHalfsToFloatsAvx2( uint8_t const *& src
+				, uint8_t *& dst
+				, uint32_t count )
+			{
+				auto const signMask = _mm256_set1_epi32( 0x8000 );
+				auto const magnitudeMask = _mm256_set1_epi32( 0x7FFF );
+				auto const bias = _mm256_castsi256_ps( _mm256_set1_epi32( 0x77800000 ) );
+				auto const maxFinite = _mm256_set1_epi32( 0x7BFF );
+				auto const infinite = _mm256_set1_epi32( 0x7C00 );
+				auto const floatInfinite = _mm256_set1_epi32( 0x7F800000 );
+				auto const floatNan = _mm256_set1_epi32( int32_t( 0xFFC00000 ) );
+				uint32_t done = 0u;
+
+				for ( ; count - done >= 2u; done += 2u, src += 16u, dst += 32u )
+				{
+					auto halfs = _mm256_cvtepu16_epi32( _mm_loadu_si128( reinterpret_cast< __m128i const * >( src ) ) );
+					auto sign = _mm256_slli_epi32( _mm256_and_si256( halfs, signMask ), 16 );
+					auto magnitude = _mm256_and_si256( halfs, magnitudeMask );
+					auto scaled = _mm256_castps_si256( _mm256_mul_ps( _mm256_castsi256_ps( _mm256_slli_epi32( magnitude, 13 ) ), bias ) );
+					auto special = _mm256_cmpgt_epi32( magnitude, maxFinite );
+					auto nan = _mm256_cmpgt_epi32( magnitude, infinite );
+					auto result = _mm256_or_si256( sign, _mm256_blendv_epi8( scaled, floatInfinite, special ) );
+					_mm256_storeu_si256( reinterpret_cast< __m256i * >( dst ), _mm256_blendv_epi8( result, floatNan, nan ) );
+				}
+
+				return done;
+			}
+
+			//*****************************************************************************************
+
+			uint32_t doConvert( ConversionKernel kernel
+				, Conversion const & conversion
+				, uint8_t const *& src
+				, uint8_t *& dst
+				, uint32_t count )
+			{
+				uint32_t result = 0u;
+
+				switch ( conversion.m_type )
+				{
+				case KernelType::eShuffle:
+					if ( kernel >= ConversionKernel::eAVX2 )
+					{
+						result = doShuffleAvx2( conversion.m_src, conversion.m_dst, src, dst, count );
+					}
+					else if ( kernel >= ConversionKernel::eSSSE3 )
+					{
+						result = doShuffleSsse3( conversion.m_src, conversion.m_dst, src, dst, count );
+					}
+					else
+					{
+						result = doShuffleSse2( src, dst, count );
+					}
+					break;
+
+				case KernelType::eBytesToFloats:
+					if ( kernel >= ConversionKernel::eAVX2 )
+					{
+						result = doBytesToFloatsAvx2( conversion.m_src, src, dst, count );
+					}
+					else if ( kernel >= ConversionKernel::eSSSE3 )
+					{
+						result = doBytesToFloatsSsse3( conversion.m_src, src, dst, count );
+					}
+					else
+					{
+						result = doBytesToFloatsSse2( conversion.m_src, src, dst, count );
+					}
+					break;
+
+				case KernelType::eFloatsToBytes:
+					if ( kernel >= ConversionKernel::eAVX2 )
+					{
+						result = doFloatsToBytesAvx2( src, dst, count );
+					}
+					else
+					{
+						result = doFloatsToBytesSse2( src, dst, count );
+					}
+					break;
+
+				case KernelType::eHalfsToFloats:
+					if ( kernel >= ConversionKernel::eAVX2 )
+					{
+						result = doHalfsToFloatsAvx2( src, dst, count );
+					}
+					else
+					{
+						result = doHalfsToFloatsSse2( src, dst, count );
+					}
+					break;
+				}
+
+				return result;
+			}
+
+#endif
+		}
+
+		ConversionKernel getConversionKernel()
+		{
+			static ConversionKernel const result = []()
+			{
+				ConversionKernel kernel = ConversionKernel::eScalar;
+#if CASTOR_USE_SSE2
+				CpuInformations cpu;
+
+				if ( cpu.SSE2() )
+				{
+					kernel = ConversionKernel::eSSE2;
+
+					if ( cpu.SSSE3() )
+					{
+						kernel = ConversionKernel::eSSSE3;
+
+						if ( cpu.AVX2() && cpu.OSXSAVE() && doIsYmmStateEnabled() )
+						{
+							kernel = ConversionKernel::eAVX2;
+						}
+					}
+				}
+#endif
+				return kernel;
+			}();
+			return result;
+		}
+
+		bool convertBufferKernel( ConversionKernel kernel
+			, PixelFormat srcFormat
+			, uint8_t const * srcBuffer
+			, uint32_t srcSize
+			, PixelFormat dstFormat
+			, uint8_t * dstBuffer
+			, uint32_t dstSize )
+		{
+			bool result = false;
+#if CASTOR_USE_SSE2
+			kernel = std::min( kernel, getConversionKernel() );
+			auto it = std::find_if( Conversions.begin()
+				, Conversions.end()
+				, [srcFormat, dstFormat]( Conversion const & conversion )
+				{
+					return conversion.m_src == srcFormat
+						&& conversion.m_dst == dstFormat;
+				} );
+
+			if ( it != Conversions.end()
+				&& kernel >= it->m_minimum )
+			{
+				uint32_t count = std::min( srcSize / getBytesPerPixel( srcFormat )
+					, dstSize / getBytesPerPixel( dstFormat ) );
+				uint8_t const * src = srcBuffer;
+				uint8_t * dst = dstBuffer;
+				uint32_t done = doConvert( kernel, *it, src, dst, count );
+
+				for ( ; done < count; ++done )
+				{
+					convertPixel( srcFormat, src, dstFormat, dst );
+				}
+
+				result = true;
+			}
+#endif
+			return result;
+		}
+	}
+}
@@ -0,0 +1,87 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_PixelFormatKernels_H___
+#define ___CU_PixelFormatKernels_H___
+
+#include "CastorUtilsPrerequisites.hpp"
+
+namespace castor
+{
+	/*!
+	\author 	Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/12/2017
+	\~english
+	\brief		The instruction sets available to the pixel buffer conversion kernels.
+	\remarks	Ordered, a level implies the availability of the previous ones.
+	\~french
+	\brief		Les jeux d'instructions disponibles pour les noyaux de conversion de tampons de pixels.
+	\remarks	Ordonnés, un niveau implique la disponibilité des précédents.
+	*/
+	enum class ConversionKernel
+		: uint8_t
+	{
+		//!\~english	Pixel per pixel conversion.
+		//!\~french		Conversion pixel par pixel.
+		eScalar,
+		//!\~english	SSE2 kernels.
+		//!\~french		Noyaux SSE2.
+		eSSE2,
+		//!\~english	SSSE3 kernels (byte shuffles).
+		//!\~french		Noyaux SSSE3 (mélanges d'octets).
+		eSSSE3,
+		//!\~english	AVX2 kernels.
+		//!\~french		Noyaux AVX2.
+		eAVX2,
+		CASTOR_SCOPED_ENUM_BOUNDS( eScalar )
+	};
+
+	namespace PF
+	{
+		/**
+		 *\~english
+		 *\brief		Retrieves the best conversion kernel level supported by both the build and the running CPU.
+		 *\remarks		Computed once, at the first call.
+		 *\~french
+		 *\brief		Récupère le meilleur niveau de noyau de conversion supporté à la fois par la compilation et le CPU.
+		 *\remarks		Calculé une fois, au premier appel.
+		 */
+		CU_API ConversionKernel getConversionKernel();
+		/**
+		 *\~english
+		 *\brief		Converts a buffer using the vectorised kernels.
+		 *\remarks		Uses the best kernel implementing the formats pair, up to the given level (clamped to getConversionKernel()).
+		 *				The pixels left over by the kernel are converted one by one, so the result is bit exact with the scalar conversion.
+		 *\param[in]	kernel		The maximum kernel level.
+		 *\param[in]	srcFormat	The source format.
+		 *\param[in]	srcBuffer	The source buffer.
+		 *\param[in]	srcSize		The source size, in bytes.
+		 *\param[in]	dstFormat	The destination format.
+		 *\param[in]	dstBuffer	The destination buffer.
+		 *\param[in]	dstSize		The destination size, in bytes.
+		 *\return		\p false if no kernel implements the formats pair at that level, the buffer is then left untouched.
+		 *\~french
+		 *\brief		Convertit un tampon en utilisant les noyaux vectorisés.
+		 *\remarks		Utilise le meilleur noyau implémentant la paire de formats, jusqu'au niveau donné (limité à getConversionKernel()).
+		 *				Les pixels laissés par le noyau sont convertis un par un, le résultat est donc identique à la conversion scalaire.
+		 *\param[in]	kernel		Le niveau de noyau maximal.
+		 *\param[in]	srcFormat	Le format source.
+		 *\param[in]	srcBuffer	Le tampon source.
+		 *\param[in]	srcSize		La taille de la source, en octets.
+		 *\param[in]	dstFormat	Le format destination.
+		 *\param[in]	dstBuffer	Le tampon destination.
+		 *\param[in]	dstSize		La taille de la destination, en octets.
+		 *\return		\p false si aucun noyau n'implémente la paire de formats à ce niveau, le tampon n'est alors pas modifié.
+		 */
+		CU_API bool convertBufferKernel( ConversionKernel kernel
+			, PixelFormat srcFormat
+			, uint8_t const * srcBuffer
+			, uint32_t srcSize
+			, PixelFormat dstFormat
+			, uint8_t * dstBuffer
+			, uint32_t dstSize );
+	}
+}
+
+#endif
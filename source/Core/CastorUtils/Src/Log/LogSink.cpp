@@ -0,0 +1,95 @@
+#include "LogSink.hpp"
+
+#include "LoggerConsole.hpp"
+#include "Data/Path.hpp"
+#include "Miscellaneous/StringUtils.hpp"
+
+namespace castor
+{
+	//*********************************************************************************************
+
+	ConsoleLogSink::ConsoleLogSink( bool showConsole )
+		: m_console{ std::make_unique< ProgramConsole >( showConsole ) }
+	{
+	}
+
+	ConsoleLogSink::~ConsoleLogSink()
+	{
+	}
+
+	void ConsoleLogSink::log( LogType type
+		, String const & text
+		, String const & formatted
+		, bool newLine )
+	{
+		m_console->beginLog( type );
+		m_console->print( text, newLine );
+	}
+
+	//*********************************************************************************************
+
+	FileLogSink::FileLogSink( Path const & path )
+		: m_file{ string::stringCast< char >( path ), std::ios::out | std::ios::trunc | std::ios::binary }
+	{
+	}
+
+	void FileLogSink::log( LogType type
+		, String const & text
+		, String const & formatted
+		, bool newLine )
+	{
+		m_file << string::stringCast< char >( formatted );
+
+		if ( newLine )
+		{
+			m_file << '\n';
+		}
+	}
+
+	void FileLogSink::flush()
+	{
+		m_file.flush();
+	}
+
+	//*********************************************************************************************
+
+	MemoryLogSink::MemoryLogSink( size_t capacity )
+		: m_lines( std::max< size_t >( 1u, capacity ) )
+	{
+	}
+
+	void MemoryLogSink::log( LogType type
+		, String const & text
+		, String const & formatted
+		, bool newLine )
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		m_lines[m_next] = formatted;
+		m_next = ( m_next + 1u ) % m_lines.size();
+		m_full = m_full || m_next == 0u;
+	}
+
+	StringArray MemoryLogSink::getLines()const
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		StringArray result;
+
+		if ( m_full )
+		{
+			result.insert( result.end(), m_lines.begin() + m_next, m_lines.end() );
+		}
+
+		result.insert( result.end(), m_lines.begin(), m_lines.begin() + m_next );
+		return result;
+	}
+
+	void MemoryLogSink::dump( std::ostream & stream )const
+	{
+		for ( auto & line : getLines() )
+		{
+			stream << string::stringCast< char >( line ) << "\n";
+		}
+	}
+
+	//*********************************************************************************************
+}
@@ -0,0 +1,183 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_LOG_SINK_H___
+#define ___CU_LOG_SINK_H___
+
+#include "CastorUtilsPrerequisites.hpp"
+
+#include <fstream>
+#include <mutex>
+
+namespace castor
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/01/2018
+	\~english
+	\brief		Receives the log lines, from the logging thread.
+	\~french
+	\brief		Reçoit les lignes de log, depuis le thread de log.
+	*/
+	class LogSink
+	{
+	public:
+		LogSink() = default;
+		virtual ~LogSink() = default;
+		/**
+		 *\~english
+		 *\brief		Receives a log line.
+		 *\param[in]	type		The log type.
+		 *\param[in]	text		The line text.
+		 *\param[in]	formatted	The line, preceded by its timestamp and log type header.
+		 *\param[in]	newLine		Tells if the line ends with a new line.
+		 *\~french
+		 *\brief		Reçoit une ligne de log.
+		 *\param[in]	type		Le type de log.
+		 *\param[in]	text		Le texte de la ligne.
+		 *\param[in]	formatted	La ligne, précédée de son horodatage et de l'en-tête de son type de log.
+		 *\param[in]	newLine		Dit si la ligne se termine par un retour à la ligne.
+		 */
+		virtual void log( LogType type
+			, String const & text
+			, String const & formatted
+			, bool newLine ) = 0;
+		/**
+		 *\~english
+		 *\brief		Called once a batch of lines has been logged.
+		 *\~french
+		 *\brief		Appelée une fois qu'un lot de lignes a été écrit.
+		 */
+		virtual void flush()
+		{
+		}
+	};
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/01/2018
+	\~english
+	\brief		Prints the log lines text in the program console.
+	\~french
+	\brief		Affiche le texte des lignes de log dans la console du programme.
+	*/
+	class ConsoleLogSink
+		: public LogSink
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	showConsole	Tells if the console must be created, if the platform needs it.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	showConsole	Dit si la console doit être créée, si la plateforme en a besoin.
+		 */
+		CU_API explicit ConsoleLogSink( bool showConsole );
+		CU_API ~ConsoleLogSink();
+		/**
+		 *\copydoc		castor::LogSink::log
+		 */
+		CU_API void log( LogType type
+			, String const & text
+			, String const & formatted
+			, bool newLine )override;
+
+	private:
+		std::unique_ptr< ProgramConsole > m_console;
+	};
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/01/2018
+	\~english
+	\brief		Writes the formatted log lines into a file.
+	\remarks	The file is truncated on creation, and stays open until the sink is destroyed.
+	\~french
+	\brief		Ecrit les lignes de log formatées dans un fichier.
+	\remarks	Le fichier est tronqué à la création, et reste ouvert jusqu'à la destruction du puits.
+	*/
+	class FileLogSink
+		: public LogSink
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	path	The file path.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	path	Le chemin du fichier.
+		 */
+		CU_API explicit FileLogSink( Path const & path );
+		/**
+		 *\copydoc		castor::LogSink::log
+		 */
+		CU_API void log( LogType type
+			, String const & text
+			, String const & formatted
+			, bool newLine )override;
+		/**
+		 *\copydoc		castor::LogSink::flush
+		 */
+		CU_API void flush()override;
+
+	private:
+		std::ofstream m_file;
+	};
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/01/2018
+	\~english
+	\brief		Keeps the last formatted log lines in memory, to be dumped when needed (crash reports, for example).
+	\~french
+	\brief		Garde les dernières lignes de log formatées en mémoire, pour pouvoir les écrire quand nécessaire (rapports de crash, par exemple).
+	*/
+	class MemoryLogSink
+		: public LogSink
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	capacity	The maximum lines count.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	capacity	Le nombre maximal de lignes.
+		 */
+		CU_API explicit MemoryLogSink( size_t capacity );
+		/**
+		 *\copydoc		castor::LogSink::log
+		 */
+		CU_API void log( LogType type
+			, String const & text
+			, String const & formatted
+			, bool newLine )override;
+		/**
+		 *\~english
+		 *\return		The kept lines, from the oldest to the newest.
+		 *\~french
+		 *\return		Les lignes gardées, de la plus ancienne à la plus récente.
+		 */
+		CU_API StringArray getLines()const;
+		/**
+		 *\~english
+		 *\brief		Writes the kept lines to the given stream.
+		 *\param[out]	stream	The stream.
+		 *\~french
+		 *\brief		Ecrit les lignes gardées dans le flux donné.
+		 *\param[out]	stream	Le flux.
+		 */
+		CU_API void dump( std::ostream & stream )const;
+
+	private:
+		mutable std::mutex m_mutex;
+		StringArray m_lines;
+		size_t m_next{ 0u };
+		bool m_full{ false };
+	};
+}
+
+#endif
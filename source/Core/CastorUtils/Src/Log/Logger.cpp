@@ -7,6 +7,7 @@
 namespace castor
 {
 	static const std::string ERROR_LOGGER_ALREADY_INITIALISED = "Logger instance already initialised";
+	static size_t const LOGGER_QUEUE_SIZE = 8192u;
 
 	template< typename CharType, typename LogStreambufTraits >
 	class LogStreambuf
@@ -137,6 +138,7 @@ namespace castor
 
 	Logger::Logger()
 		: m_impl( nullptr )
+		, m_queue( LOGGER_QUEUE_SIZE )
 	{
 		auto lock = makeUniqueLock( m_mutex );
 		m_headers[size_t( LogType::eTrace )] = cuT( "***TRACE*** " );
@@ -220,6 +222,26 @@ namespace castor
 		}
 	}
 
+	void Logger::addSink( LogSinkSPtr sink )
+	{
+		getSingleton().doAddSink( sink );
+	}
+
+	void Logger::removeSink( LogSinkSPtr sink )
+	{
+		getSingleton().doRemoveSink( sink );
+	}
+
+	void Logger::flush()
+	{
+		getSingleton().doFlush();
+	}
+
+	uint64_t Logger::getDroppedCount()
+	{
+		return getSingleton().m_dropped;
+	}
+
 	void Logger::logTrace( std::string const & p_msg )
 	{
 		getSingleton().doPushMessage( LogType::eTrace, p_msg );
@@ -491,6 +513,18 @@ namespace castor
 		m_impl->unregisterCallback( p_pCaller );
 	}
 
+	void Logger::doAddSink( LogSinkSPtr sink )
+	{
+		auto lock = makeUniqueLock( m_mutex );
+		m_impl->addSink( sink );
+	}
+
+	void Logger::doRemoveSink( LogSinkSPtr sink )
+	{
+		auto lock = makeUniqueLock( m_mutex );
+		m_impl->removeSink( sink );
+	}
+
 	void Logger::doSetFileName( String const & logFilePath, LogType logLevel )
 	{
 		m_initialised = true;
@@ -510,8 +544,7 @@ namespace castor
 				m_impl->printMessage( logLevel, message, p_newLine );
 			}
 #endif
-			auto lock = makeUniqueLock( m_mutexQueue );
-			m_queue.push_back( { logLevel, message, p_newLine } );
+			doPushMessage( { logLevel, message, p_newLine, std::chrono::system_clock::now() } );
 		}
 	}
 
@@ -525,26 +558,69 @@ namespace castor
 				m_impl->printMessage( logLevel, message, p_newLine );
 			}
 #endif
-			auto lock = makeUniqueLock( m_mutexQueue );
-			m_queue.push_back( { logLevel, string::stringCast< char >( message ), p_newLine } );
+			doPushMessage( { logLevel, string::stringCast< char >( message ), p_newLine, std::chrono::system_clock::now() } );
 		}
 	}
 
-	void Logger::doFlushQueue()
+	void Logger::doPushMessage( Message && message )
 	{
-		if ( !m_queue.empty() )
+		if ( !m_queue.tryPush( std::move( message ) ) )
 		{
-			MessageQueue queue;
+			++m_dropped;
+		}
+		else if ( m_queue.size() >= m_queue.capacity() / 2u )
+		{
+			m_wakeUp.notify_one();
+		}
+	}
 
+	void Logger::doFlush()
+	{
+		if ( m_initialised && !m_stopped )
+		{
+			uint64_t pushed = m_queue.getPushed();
+			m_wakeUp.notify_one();
+			auto lock = makeUniqueLock( m_mutexWakeUp );
+			m_batchLogged.wait( lock, [this, pushed]()
 			{
-				auto lock = makeUniqueLock( m_mutexQueue );
-				std::swap( queue, m_queue );
-			}
+				return m_logged >= pushed || m_stopped;
+			} );
+		}
+	}
+
+	void Logger::doFlushQueue()
+	{
+		// The batch is bounded, so that a spamming producer can't keep the logging thread in this loop.
+		MessageQueue queue;
+		Message message;
+
+		while ( queue.size() < m_queue.capacity()
+			&& m_queue.tryPop( message ) )
+		{
+			queue.push_back( std::move( message ) );
+		}
 
+		auto count = queue.size();
+		uint64_t dropped = m_dropped;
+
+		if ( dropped != m_reportedDrops )
+		{
+			StringStream stream;
+			stream << cuT( "Logger queue full, " ) << ( dropped - m_reportedDrops ) << cuT( " message(s) dropped." );
+			queue.push_back( { LogType::eWarning, string::stringCast< char >( stream.str() ), true, std::chrono::system_clock::now() } );
+			m_reportedDrops = dropped;
+		}
+
+		if ( !queue.empty() )
+		{
 			{
 				auto lock = makeUniqueLock( m_mutex );
 				m_impl->logMessageQueue( queue );
 			}
+
+			m_logged += count;
+			auto lock = makeUniqueLock( m_mutexWakeUp );
+			m_batchLogged.notify_all();
 		}
 	}
 
@@ -561,18 +637,21 @@ namespace castor
 			while ( !m_stopped )
 			{
 				doFlushQueue();
-				std::this_thread::sleep_for( Milliseconds( 100 ) );
+				auto lock = makeUniqueLock( m_mutexWakeUp );
+				m_wakeUp.wait_for( lock, Milliseconds( 10 ) );
 			}
 
 			if ( m_initialised )
 			{
-				doFlushQueue();
+				do
+				{
+					doFlushQueue();
+				}
+				while ( m_queue.size() );
 			}
 
-			{
-				auto lock = makeUniqueLock( m_mutexThreadEnded );
-				m_threadEnded.notify_all();
-			}
+			auto lock = makeUniqueLock( m_mutexWakeUp );
+			m_batchLogged.notify_all();
 		} );
 	}
 
@@ -581,10 +660,7 @@ namespace castor
 		if ( !m_stopped )
 		{
 			m_stopped = true;
-			{
-				auto lock = makeUniqueLock( m_mutexThreadEnded );
-				m_threadEnded.wait( lock );
-			}
+			m_wakeUp.notify_all();
 			m_logThread.join();
 		}
 	}
@@ -5,6 +5,7 @@ See LICENSE file in root folder
 #define ___CU_LOGGER_H___
 
 #include "CastorUtilsPrerequisites.hpp"
+#include "Multithreading/MpscQueue.hpp"
 
 #include <condition_variable>
 #include <mutex>
@@ -90,6 +91,40 @@ namespace castor
 		 *\param[in]	p_eLogType		Le type de log concerné
 		 */
 		CU_API static void setFileName( String const & p_logFilePath, LogType p_eLogType = LogType::eCount );
+		/**
+		 *\~english
+		 *\brief		Adds a sink, receiving every logged line, from the logging thread.
+		 *\param[in]	sink	The sink.
+		 *\~french
+		 *\brief		Ajoute un puits, recevant chaque ligne loggée, depuis le thread de log.
+		 *\param[in]	sink	Le puits.
+		 */
+		CU_API static void addSink( LogSinkSPtr sink );
+		/**
+		 *\~english
+		 *\brief		Removes a sink.
+		 *\param[in]	sink	The sink.
+		 *\~french
+		 *\brief		Retire un puits.
+		 *\param[in]	sink	Le puits.
+		 */
+		CU_API static void removeSink( LogSinkSPtr sink );
+		/**
+		 *\~english
+		 *\brief		Waits for the messages pushed so far to be written.
+		 *\remarks		Returns immediately if no log file has been set yet.
+		 *\~french
+		 *\brief		Attend que les messages ajoutés jusqu'ici soient écrits.
+		 *\remarks		Retourne immédiatement si aucun fichier de log n'a encore été défini.
+		 */
+		CU_API static void flush();
+		/**
+		 *\~english
+		 *\return		The number of messages dropped because the queue was full.
+		 *\~french
+		 *\return		Le nombre de messages abandonnés parce que la file était pleine.
+		 */
+		CU_API static uint64_t getDroppedCount();
 		/**
 		 *\~english
 		 *\brief		Logs a trace message, from a std::string
@@ -515,6 +550,10 @@ namespace castor
 		void doSetFileName( String const & p_logFilePath, LogType p_eLogType = LogType::eCount );
 		void doPushMessage( LogType type, std::string const & message, bool p_newLine = true );
 		void doPushMessage( LogType type, std::wstring const & message, bool p_newLine = true );
+		void doAddSink( LogSinkSPtr sink );
+		void doRemoveSink( LogSinkSPtr sink );
+		void doPushMessage( Message && message );
+		void doFlush();
 		void doInitialiseThread();
 		void doCleanupThread();
 		void doFlushQueue();
@@ -544,20 +583,26 @@ namespace castor
 		LogType m_logLevel;
 		//! The header for each lg line of given log level
 		std::array< String, size_t( LogType::eCount ) > m_headers;
-		//! The message queue
-		MessageQueue m_queue;
-		//! The mutex protecting the message queue
-		std::mutex m_mutexQueue;
+		//! The message queue, filled by any thread, emptied by the logging thread
+		MpscQueue< Message > m_queue;
+		//! The number of messages written by the logging thread
+		std::atomic< uint64_t > m_logged{ 0u };
+		//! The number of messages dropped because the queue was full
+		std::atomic< uint64_t > m_dropped{ 0u };
+		//! The number of dropped messages already reported in the log
+		uint64_t m_reportedDrops{ 0u };
+		//! Event raised to wake the logging thread up
+		std::condition_variable m_wakeUp;
+		//! Event raised when the logging thread has written a batch of messages
+		std::condition_variable m_batchLogged;
+		//! Mutex used with the logging thread events
+		std::mutex m_mutexWakeUp;
 		//! The logging thread
 		std::thread m_logThread;
 		//! Tells if the logger is initialised
 		std::atomic_bool m_initialised;
 		//! Tells if the thread must be stopped
 		std::atomic_bool m_stopped;
-		//! Event raised when the thread is ended
-		std::condition_variable m_threadEnded;
-		//! Mutex used to wait for the thread end
-		std::mutex m_mutexThreadEnded;
 	};
 }
 
@@ -2,7 +2,7 @@
 
 #include "LoggerConsole.hpp"
 #include "Logger.hpp"
-#include "Data/TextFile.hpp"
+#include "Data/Path.hpp"
 #include "Miscellaneous/Utils.hpp"
 
 namespace castor
@@ -10,12 +10,13 @@ namespace castor
 	class LoggerImpl;
 
 	LoggerImpl::LoggerImpl( LogType p_level )
-		: m_console{ std::make_unique< ProgramConsole >( p_level < LogType::eInfo ) }
+		: m_console{ std::make_unique< ConsoleLogSink >( p_level < LogType::eInfo ) }
 	{
 	}
 
 	LoggerImpl::~LoggerImpl()
 	{
+		m_sinks.clear();
 		m_console.reset();
 	}
 
@@ -52,22 +53,47 @@ namespace castor
 	{
 		if ( p_eLogType == LogType::eCount )
 		{
-			for ( auto & path : m_logFilePath )
+			auto file = std::make_shared< FileLogSink >( Path{ p_logFilePath } );
+
+			for ( size_t i = 0u; i < size_t( LogType::eCount ); ++i )
 			{
-				path = p_logFilePath;
+				m_logFilePath[i] = p_logFilePath;
+				m_files[i] = file;
 			}
 		}
 		else
 		{
-			m_logFilePath[size_t( p_eLogType )] = p_logFilePath;
+			auto index = size_t( p_eLogType );
+			auto it = std::find( m_logFilePath.begin(), m_logFilePath.end(), p_logFilePath );
+			m_logFilePath[index] = p_logFilePath;
+
+			if ( it != m_logFilePath.end()
+				&& m_files[size_t( std::distance( m_logFilePath.begin(), it ) )] )
+			{
+				m_files[index] = m_files[size_t( std::distance( m_logFilePath.begin(), it ) )];
+			}
+			else
+			{
+				m_files[index] = std::make_shared< FileLogSink >( Path{ p_logFilePath } );
+			}
+		}
+	}
+
+	void LoggerImpl::addSink( LogSinkSPtr sink )
+	{
+		if ( std::find( m_sinks.begin(), m_sinks.end(), sink ) == m_sinks.end() )
+		{
+			m_sinks.push_back( sink );
 		}
+	}
 
-		FILE * file;
-		castor::fileOpen( file, string::stringCast< char >( p_logFilePath ).c_str(), "w" );
+	void LoggerImpl::removeSink( LogSinkSPtr sink )
+	{
+		auto it = std::find( m_sinks.begin(), m_sinks.end(), sink );
 
-		if ( file )
+		if ( it != m_sinks.end() )
 		{
-			fclose( file );
+			m_sinks.erase( it );
 		}
 	}
 
@@ -83,63 +109,40 @@ namespace castor
 
 	void LoggerImpl::logMessageQueue( MessageQueue const & p_queue )
 	{
-		std::tm dtToday = { 0 };
-		time_t tTime;
-		time( &tTime );
-		castor::getLocaltime( &dtToday, &tTime );
-		char buffer[33] = { 0 };
-		strftime( buffer, 32, "%Y-%m-%d %H:%M:%S", &dtToday );
-		String timeStamp = string::stringCast< xchar >( buffer );
-		StringStream logs[size_t( LogType::eCount )];
-
 		try
 		{
 			for ( auto & message : p_queue )
 			{
-				StringStream & stream = logs[size_t( message.m_type )];
-				String toLog = message.m_message;
+				doUpdateTimestamp( message.m_time );
+				String const & toLog = message.m_message;
+				size_t start = 0u;
+				size_t end = toLog.find( cuT( '\n' ) );
 
-				if ( toLog.find( cuT( '\n' ) ) != String::npos )
+				while ( end != String::npos )
 				{
-					StringArray array = string::split( toLog, cuT( "\n" ), uint32_t( std::count( toLog.begin(), toLog.end(), cuT( '\n' ) ) + 1 ) );
-					auto it = array.begin();
+					doLogLine( toLog.substr( start, end - start ), message.m_type, true );
+					start = end + 1u;
+					end = toLog.find( cuT( '\n' ), start );
+				}
 
-					for ( size_t i = 0; i < array.size() - 1; ++i )
-					{
-						doLogLine( timeStamp, *it, stream, message.m_type, true );
-						++it;
-					}
+				doLogLine( start ? toLog.substr( start ) : toLog, message.m_type, message.m_newLine );
+			}
 
-					doLogLine( timeStamp, *it, stream, message.m_type, message.m_newLine );
-				}
-				else
+			for ( auto & file : m_files )
+			{
+				if ( file )
 				{
-					doLogLine( timeStamp, toLog, stream, message.m_type, message.m_newLine );
+					file->flush();
 				}
 			}
 
-			int i = 0;
-
-			for ( auto const & stream : logs )
+			for ( auto & sink : m_sinks )
 			{
-				String text = stream.str();
-
-				if ( !text.empty() )
-				{
-					try
-					{
-						TextFile file{ Path{ m_logFilePath[i++] }, File::OpenMode::eAppend };
-						file.writeText( text );
-					}
-					catch ( Exception & )
-					{
-					}
-				}
+				sink->flush();
 			}
 		}
 		catch ( std::exception & )
 		{
-			//m_pConsole->print( cuT( "Couldn't open log file : " ) + CStrUtils::toString( exc.what() ), true );
 		}
 	}
 
@@ -166,28 +169,55 @@ namespace castor
 
 	void LoggerImpl::doPrintLine( String const & line, LogType logLevel, bool p_newLine )
 	{
-		m_console->beginLog( logLevel );
-		m_console->print( line, p_newLine );
+		m_console->log( logLevel, line, line, p_newLine );
+	}
+
+	void LoggerImpl::doUpdateTimestamp( std::chrono::system_clock::time_point const & time )
+	{
+		time_t tTime = std::chrono::system_clock::to_time_t( time );
+
+		if ( tTime != m_time || m_timestamp.empty() )
+		{
+			std::tm dtToday = { 0 };
+			castor::getLocaltime( &dtToday, &tTime );
+			char buffer[33] = { 0 };
+			strftime( buffer, 32, "%Y-%m-%d %H:%M:%S", &dtToday );
+			m_timestamp = string::stringCast< xchar >( buffer );
+			m_time = tTime;
+		}
 	}
 
-	void LoggerImpl::doLogLine( String const & timestamp, String const & line, StringStream & stream, LogType logLevel, bool p_newLine )
+	void LoggerImpl::doLogLine( String const & line, LogType logLevel, bool newLine )
 	{
+		m_line.clear();
+		m_line += m_timestamp;
+		m_line += cuT( " - " );
+		m_line += m_headers[size_t( logLevel )];
+		m_line += line;
+
 #if defined( NDEBUG )
-		doPrintLine( line, logLevel, p_newLine );
+		m_console->log( logLevel, line, m_line, newLine );
 #endif
 
 		{
 			std::lock_guard< std::mutex > lock( m_mutexCallbacks );
 
-			if ( !m_mapCallbacks.empty() )
+			for ( auto it : m_mapCallbacks )
 			{
-				for ( auto it : m_mapCallbacks )
-				{
-					it.second( line, logLevel, p_newLine );
-				}
+				it.second( line, logLevel, newLine );
 			}
 		}
 
-		stream << timestamp << cuT( " - " ) << m_headers[size_t( logLevel )] << line << ( p_newLine ? "\n" : "" );
+		auto & file = m_files[size_t( logLevel )];
+
+		if ( file )
+		{
+			file->log( logLevel, line, m_line, newLine );
+		}
+
+		for ( auto & sink : m_sinks )
+		{
+			sink->log( logLevel, line, m_line, newLine );
+		}
 	}
 }
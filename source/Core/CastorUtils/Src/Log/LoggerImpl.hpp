@@ -6,6 +6,7 @@ See LICENSE file in root folder
 
 #include "CastorUtilsPrerequisites.hpp"
 
+#include "LogSink.hpp"
 #include "Miscellaneous/StringUtils.hpp"
 
 #include <mutex>
@@ -88,6 +89,24 @@ namespace castor
 		 *\param[in]	p_logLevel		Le niveau de log. Si LogType::eCount, définit le fichier pour tous les niveaux
 		 */
 		void setFileName( String const & p_logFilePath, LogType p_logLevel );
+		/**
+		 *\~english
+		 *\brief		Adds a sink.
+		 *\param[in]	sink	The sink.
+		 *\~french
+		 *\brief		Ajoute un puits.
+		 *\param[in]	sink	Le puits.
+		 */
+		void addSink( LogSinkSPtr sink );
+		/**
+		 *\~english
+		 *\brief		Removes a sink.
+		 *\param[in]	sink	The sink.
+		 *\~french
+		 *\brief		Retire un puits.
+		 *\param[in]	sink	Le puits.
+		 */
+		void removeSink( LogSinkSPtr sink );
 		/**
 		 *\~english
 		 *\brief		Prints a message to the console
@@ -149,27 +168,44 @@ namespace castor
 		void doPrintLine( String const & p_line, LogType p_logLevel, bool p_newLine );
 		/**
 		 *\~english
-		 *\brief		Logs a line in the given stream
-		 *\param[in]	p_timestamp	The line timestamp
-		 *\param[in]	p_line		The line
-		 *\param[in]	p_stream	The stream
-		 *\param[in]	p_logLevel	The log level
+		 *\brief		Updates the timestamp string, if the given time is in another second than the previous one.
+		 *\param[in]	time	The message time.
 		 *\~french
-		 *\brief		Affiche une ligne de texte dans le flux donné
-		 *\param[in]	p_timestamp	Le timestamp de la ligne
-		 *\param[in]	p_line		La ligne de texte
-		 *\param[in]	p_stream	Le flux
-		 *\param[in]	p_logLevel	Le niveau de log
+		 *\brief		Met à jour la chaîne d'horodatage, si le temps donné est dans une autre seconde que le précédent.
+		 *\param[in]	time	Le temps du message.
+		 */
+		void doUpdateTimestamp( std::chrono::system_clock::time_point const & time );
+		/**
+		 *\~english
+		 *\brief		Formats a line and sends it to the callbacks and the sinks
+		 *\param[in]	line		The line
+		 *\param[in]	logLevel	The log level
+		 *\param[in]	newLine		Tells if the new line character must be added
+		 *\~french
+		 *\brief		Formate une ligne de texte et l'envoie aux callbacks et aux puits
+		 *\param[in]	line		La ligne de texte
+		 *\param[in]	logLevel	Le niveau de log
+		 *\param[in]	newLine		Dit si le caractère de nouvelle ligne doit être ajouté
 		 */
-		void doLogLine( String const & p_timestamp, String const & p_line, StringStream & p_stream, LogType p_logLevel, bool p_newLine );
+		void doLogLine( String const & line, LogType logLevel, bool newLine );
 
 	private:
 		//! The files paths, per log level
 		std::array< String, size_t( LogType::eCount ) > m_logFilePath;
 		//! The headers, per log level
 		std::array< String, size_t( LogType::eCount ) > m_headers;
+		//! The files, per log level, kept open and shared between the levels using the same path
+		std::array< std::shared_ptr< FileLogSink >, size_t( LogType::eCount ) > m_files;
 		//! The console
-		std::unique_ptr< ProgramConsole > m_console;
+		std::unique_ptr< ConsoleLogSink > m_console;
+		//! The user defined sinks
+		std::vector< LogSinkSPtr > m_sinks;
+		//! The time of the current timestamp string, in seconds
+		time_t m_time{ 0 };
+		//! The current timestamp string
+		String m_timestamp;
+		//! The buffer used to format the lines
+		String m_line;
 		//! Registered callbacks
 		LoggerCallbackMap m_mapCallbacks;
 		//! Protects the registered callbacks map
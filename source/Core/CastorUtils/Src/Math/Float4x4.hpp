@@ -0,0 +1,298 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_FLOAT4X4_H___
+#define ___CU_FLOAT4X4_H___
+
+#include "Point.hpp"
+
+namespace castor
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		15/01/2018
+	\~english
+	\brief		Column major 4x4 floats matrix value type.
+	\remarks	Unlike Matrix4x4f, the coefficients are stored inline, so the copies and temporaries don't allocate.
+				<br />The multiplication, inversion and transformations use SSE2 instructions when CASTOR_USE_SSE2 is enabled.
+				<br />The static kernels work on raw column major buffers, so they can be applied to Matrix4x4f data too.
+	\~french
+	\brief		Type valeur de matrice 4x4 de flottants, column major.
+	\remarks	Contrairement à Matrix4x4f, les coefficients sont stockés dans l'objet, les copies et temporaires n'allouent donc pas de mémoire.
+				<br />La multiplication, l'inversion et les transformations utilisent des instructions SSE2 si CASTOR_USE_SSE2 est activé.
+				<br />Les noyaux statiques travaillent sur des tampons column major bruts, ils peuvent donc aussi être appliqués aux données d'une Matrix4x4f.
+	*/
+	class Float4x4
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor, the matrix is initialised to identity.
+		 *\~french
+		 *\brief		Constructeur, la matrice est initialisée à l'identité.
+		 */
+		inline Float4x4();
+		/**
+		 *\~english
+		 *\brief		Constructor, the coefficients are not initialised.
+		 *\~french
+		 *\brief		Constructeur, les coefficients ne sont pas initialisés.
+		 */
+		explicit inline Float4x4( NoInit const & );
+		/**
+		 *\~english
+		 *\brief		Constructor from a column major buffer.
+		 *\param[in]	values	The 16 coefficients.
+		 *\~french
+		 *\brief		Constructeur depuis un tampon column major.
+		 *\param[in]	values	Les 16 coefficients.
+		 */
+		explicit inline Float4x4( float const * values );
+		/**
+		 *\~english
+		 *\brief		Conversion constructor.
+		 *\param[in]	matrix	The matrix.
+		 *\~french
+		 *\brief		Constructeur de conversion.
+		 *\param[in]	matrix	La matrice.
+		 */
+		explicit inline Float4x4( Matrix4x4f const & matrix );
+		/**
+		 *\~english
+		 *\return		The matrix, converted to a Matrix4x4f.
+		 *\~french
+		 *\return		La matrice, convertie en Matrix4x4f.
+		 */
+		inline Matrix4x4f toMatrix()const;
+		/**
+		 *\~english
+		 *\brief		Copies the coefficients into the given matrix.
+		 *\param[out]	matrix	Receives the coefficients.
+		 *\~french
+		 *\brief		Copie les coefficients dans la matrice donnée.
+		 *\param[out]	matrix	Reçoit les coefficients.
+		 */
+		inline void toMatrix( Matrix4x4f & matrix )const;
+		/**
+		 *\~english
+		 *\brief		Multiplication assignment operator.
+		 *\param[in]	rhs	The right hand side operand.
+		 *\return		A reference to this object.
+		 *\~french
+		 *\brief		Opérateur d'affectation par multiplication.
+		 *\param[in]	rhs	L'opérande de droite.
+		 *\return		Une référence sur cet objet.
+		 */
+		inline Float4x4 & operator*=( Float4x4 const & rhs );
+		/**
+		 *\~english
+		 *\return		The inverse of this matrix.
+		 *\~french
+		 *\return		L'inverse de cette matrice.
+		 */
+		inline Float4x4 getInverse()const;
+		/**
+		 *\~english
+		 *\brief		Inverts this matrix.
+		 *\return		A reference to this object.
+		 *\~french
+		 *\brief		Inverse cette matrice.
+		 *\return		Une référence sur cet objet.
+		 */
+		inline Float4x4 & invert();
+		/**
+		 *\~english
+		 *\return		The transposed of this matrix.
+		 *\~french
+		 *\return		La transposée de cette matrice.
+		 */
+		inline Float4x4 getTransposed()const;
+		/**
+		 *\~english
+		 *\brief		Transforms a point (its W component is 1).
+		 *\param[in]	point	The point.
+		 *\return		The transformed point, without perspective division.
+		 *\~french
+		 *\brief		Transforme un point (sa composante W vaut 1).
+		 *\param[in]	point	Le point.
+		 *\return		Le point transformé, sans division de perspective.
+		 */
+		inline Point3f transformPoint( Point3f const & point )const;
+		/**
+		 *\~english
+		 *\brief		Transforms a vector (its W component is 0).
+		 *\param[in]	vector	The vector.
+		 *\return		The transformed vector.
+		 *\~french
+		 *\brief		Transforme un vecteur (sa composante W vaut 0).
+		 *\param[in]	vector	Le vecteur.
+		 *\return		Le vecteur transformé.
+		 */
+		inline Point3f transformVector( Point3f const & vector )const;
+		/**
+		 *\~english
+		 *\brief		Transforms a 4 components vector.
+		 *\param[in]	vector	The vector.
+		 *\return		The transformed vector.
+		 *\~french
+		 *\brief		Transforme un vecteur à 4 composantes.
+		 *\param[in]	vector	Le vecteur.
+		 *\return		Le vecteur transformé.
+		 */
+		inline Point4f transform( Point4f const & vector )const;
+		/**
+		 *\~english
+		 *\brief		Transforms an array of points (their W component is 1).
+		 *\remarks		The source and destination arrays may be the same.
+		 *\param[in]	src		The source points.
+		 *\param[out]	dst		Receives the transformed points.
+		 *\param[in]	count	The points count.
+		 *\~french
+		 *\brief		Transforme un tableau de points (leur composante W vaut 1).
+		 *\remarks		Les tableaux source et destination peuvent être les mêmes.
+		 *\param[in]	src		Les points source.
+		 *\param[out]	dst		Reçoit les points transformés.
+		 *\param[in]	count	Le nombre de points.
+		 */
+		inline void transformPoints( Point3f const * src
+			, Point3f * dst
+			, size_t count )const;
+		/**
+		 *\~english
+		 *\brief		Transforms an array of vectors (their W component is 0).
+		 *\remarks		The source and destination arrays may be the same.
+		 *\param[in]	src		The source vectors.
+		 *\param[out]	dst		Receives the transformed vectors.
+		 *\param[in]	count	The vectors count.
+		 *\~french
+		 *\brief		Transforme un tableau de vecteurs (leur composante W vaut 0).
+		 *\remarks		Les tableaux source et destination peuvent être les mêmes.
+		 *\param[in]	src		Les vecteurs source.
+		 *\param[out]	dst		Reçoit les vecteurs transformés.
+		 *\param[in]	count	Le nombre de vecteurs.
+		 */
+		inline void transformVectors( Point3f const * src
+			, Point3f * dst
+			, size_t count )const;
+		/**
+		 *\~english
+		 *\brief		Array subscript operator.
+		 *\param[in]	index	The column index.
+		 *\return		The column's coefficients.
+		 *\~french
+		 *\brief		Opérateur d'accès de type tableau.
+		 *\param[in]	index	L'index de la colonne.
+		 *\return		Les coefficients de la colonne.
+		 */
+		inline float const * operator[]( uint32_t index )const
+		{
+			return &m_data[index * 4u];
+		}
+		/**
+		 *\~english
+		 *\brief		Array subscript operator.
+		 *\param[in]	index	The column index.
+		 *\return		The column's coefficients.
+		 *\~french
+		 *\brief		Opérateur d'accès de type tableau.
+		 *\param[in]	index	L'index de la colonne.
+		 *\return		Les coefficients de la colonne.
+		 */
+		inline float * operator[]( uint32_t index )
+		{
+			return &m_data[index * 4u];
+		}
+		/**
+		 *\~english
+		 *\return		The coefficients, in column major order.
+		 *\~french
+		 *\return		Les coefficients, dans l'ordre column major.
+		 */
+		inline float const * constPtr()const
+		{
+			return m_data;
+		}
+		/**
+		 *\~english
+		 *\return		The coefficients, in column major order.
+		 *\~french
+		 *\return		Les coefficients, dans l'ordre column major.
+		 */
+		inline float * ptr()
+		{
+			return m_data;
+		}
+		/**
+		 *\~english
+		 *\brief		Multiplies two column major 4x4 matrices.
+		 *\remarks		The result buffer may be one of the operands.
+		 *\param[in]	lhs, rhs	The operands.
+		 *\param[out]	result		Receives the result.
+		 *\~french
+		 *\brief		Multiplie deux matrices 4x4 column major.
+		 *\remarks		Le tampon résultat peut être l'une des opérandes.
+		 *\param[in]	lhs, rhs	Les opérandes.
+		 *\param[out]	result		Reçoit le résultat.
+		 */
+		static inline void multiply( float const * lhs
+			, float const * rhs
+			, float * result );
+		/**
+		 *\~english
+		 *\brief		Inverts a column major 4x4 matrix.
+		 *\remarks		The result buffer may be the source one.
+		 *\param[in]	src		The matrix.
+		 *\param[out]	result	Receives the inverse.
+		 *\~french
+		 *\brief		Inverse une matrice 4x4 column major.
+		 *\remarks		Le tampon résultat peut être le tampon source.
+		 *\param[in]	src		La matrice.
+		 *\param[out]	result	Reçoit l'inverse.
+		 */
+		static inline void invert( float const * src
+			, float * result );
+
+	private:
+		alignas( 16 ) float m_data[16];
+	};
+	/**
+	 *\~english
+	 *\brief		Multiplication operator.
+	 *\param[in]	lhs, rhs	The operands.
+	 *\return		The multiplication result.
+	 *\~french
+	 *\brief		Opérateur de multiplication.
+	 *\param[in]	lhs, rhs	Les opérandes.
+	 *\return		Le résultat de la multiplication.
+	 */
+	inline Float4x4 operator*( Float4x4 const & lhs, Float4x4 const & rhs );
+	/**
+	 *\~english
+	 *\brief		Equality operator.
+	 *\param[in]	lhs, rhs	The operands.
+	 *\return		\p true if the coefficients are equal.
+	 *\~french
+	 *\brief		Opérateur d'égalité.
+	 *\param[in]	lhs, rhs	Les opérandes.
+	 *\return		\p true si les coefficients sont égaux.
+	 */
+	inline bool operator==( Float4x4 const & lhs, Float4x4 const & rhs );
+	/**
+	 *\~english
+	 *\brief		Difference operator.
+	 *\param[in]	lhs, rhs	The operands.
+	 *\return		\p true if at least one coefficient is different.
+	 *\~french
+	 *\brief		Opérateur de différence.
+	 *\param[in]	lhs, rhs	Les opérandes.
+	 *\return		\p true si au moins un coefficient est différent.
+	 */
+	inline bool operator!=( Float4x4 const & lhs, Float4x4 const & rhs );
+}
+
+// The conversions need the complete SquareMatrix type, which itself uses the Float4x4 kernels.
+#include "SquareMatrix.hpp"
+#include "Float4x4.inl"
+
+#endif
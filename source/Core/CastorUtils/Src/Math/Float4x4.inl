@@ -0,0 +1,363 @@
+#if CASTOR_USE_SSE2
+#	include <xmmintrin.h>
+#endif
+
+namespace castor
+{
+	namespace details
+	{
+#if CASTOR_USE_SSE2
+
+		template< int X, int Y, int Z, int W >
+		inline __m128 swizzle( __m128 vec )
+		{
+			return _mm_shuffle_ps( vec, vec, _MM_SHUFFLE( W, Z, Y, X ) );
+		}
+
+		template< int X, int Y, int Z, int W >
+		inline __m128 shuffle( __m128 lhs, __m128 rhs )
+		{
+			return _mm_shuffle_ps( lhs, rhs, _MM_SHUFFLE( W, Z, Y, X ) );
+		}
+
+		// The 2x2 sub matrices are stored as ( m00, m01, m10, m11 ).
+		// A * B
+		inline __m128 mat2Mul( __m128 lhs, __m128 rhs )
+		{
+			return _mm_add_ps( _mm_mul_ps( lhs, swizzle< 0, 3, 0, 3 >( rhs ) )
+				, _mm_mul_ps( swizzle< 1, 0, 3, 2 >( lhs ), swizzle< 2, 1, 2, 1 >( rhs ) ) );
+		}
+
+		// adj(A) * B
+		inline __m128 mat2AdjMul( __m128 lhs, __m128 rhs )
+		{
+			return _mm_sub_ps( _mm_mul_ps( swizzle< 3, 3, 0, 0 >( lhs ), rhs )
+				, _mm_mul_ps( swizzle< 1, 1, 2, 2 >( lhs ), swizzle< 2, 3, 0, 1 >( rhs ) ) );
+		}
+
+		// A * adj(B)
+		inline __m128 mat2MulAdj( __m128 lhs, __m128 rhs )
+		{
+			return _mm_sub_ps( _mm_mul_ps( lhs, swizzle< 3, 0, 3, 0 >( rhs ) )
+				, _mm_mul_ps( swizzle< 1, 0, 3, 2 >( lhs ), swizzle< 2, 1, 2, 1 >( rhs ) ) );
+		}
+
+		inline void transformPoints( float const * matrix
+			, Point3f const * src
+			, Point3f * dst
+			, size_t count
+			, float w )
+		{
+			__m128 const col0 = _mm_loadu_ps( matrix + 0 );
+			__m128 const col1 = _mm_loadu_ps( matrix + 4 );
+			__m128 const col2 = _mm_loadu_ps( matrix + 8 );
+			__m128 const col3 = _mm_mul_ps( _mm_loadu_ps( matrix + 12 ), _mm_set1_ps( w ) );
+			alignas( 16 ) float result[4];
+
+			for ( auto end = src + count; src != end; ++src, ++dst )
+			{
+				auto point = src->constPtr();
+				__m128 value = _mm_add_ps( _mm_add_ps( _mm_mul_ps( col0, _mm_set1_ps( point[0] ) )
+						, _mm_mul_ps( col1, _mm_set1_ps( point[1] ) ) )
+					, _mm_add_ps( _mm_mul_ps( col2, _mm_set1_ps( point[2] ) )
+						, col3 ) );
+				_mm_store_ps( result, value );
+				auto out = dst->ptr();
+				out[0] = result[0];
+				out[1] = result[1];
+				out[2] = result[2];
+			}
+		}
+
+#else
+
+		inline void transformPoints( float const * matrix
+			, Point3f const * src
+			, Point3f * dst
+			, size_t count
+			, float w )
+		{
+			for ( auto end = src + count; src != end; ++src, ++dst )
+			{
+				auto point = src->constPtr();
+				float const x = point[0];
+				float const y = point[1];
+				float const z = point[2];
+				auto out = dst->ptr();
+				out[0] = matrix[0] * x + matrix[4] * y + matrix[8] * z + matrix[12] * w;
+				out[1] = matrix[1] * x + matrix[5] * y + matrix[9] * z + matrix[13] * w;
+				out[2] = matrix[2] * x + matrix[6] * y + matrix[10] * z + matrix[14] * w;
+			}
+		}
+
+#endif
+	}
+
+	//*************************************************************************************************
+
+	Float4x4::Float4x4()
+		: m_data{ 1.0f, 0.0f, 0.0f, 0.0f
+			, 0.0f, 1.0f, 0.0f, 0.0f
+			, 0.0f, 0.0f, 1.0f, 0.0f
+			, 0.0f, 0.0f, 0.0f, 1.0f }
+	{
+	}
+
+	Float4x4::Float4x4( NoInit const & )
+	{
+	}
+
+	Float4x4::Float4x4( float const * values )
+	{
+		std::memcpy( m_data, values, sizeof( m_data ) );
+	}
+
+	Float4x4::Float4x4( Matrix4x4f const & matrix )
+		: Float4x4{ matrix.constPtr() }
+	{
+	}
+
+	Matrix4x4f Float4x4::toMatrix()const
+	{
+		return Matrix4x4f{ m_data };
+	}
+
+	void Float4x4::toMatrix( Matrix4x4f & matrix )const
+	{
+		std::memcpy( matrix.ptr(), m_data, sizeof( m_data ) );
+	}
+
+	Float4x4 & Float4x4::operator*=( Float4x4 const & rhs )
+	{
+		multiply( m_data, rhs.m_data, m_data );
+		return *this;
+	}
+
+	Float4x4 Float4x4::getInverse()const
+	{
+		Float4x4 result{ NoInit{} };
+		invert( m_data, result.m_data );
+		return result;
+	}
+
+	Float4x4 & Float4x4::invert()
+	{
+		invert( m_data, m_data );
+		return *this;
+	}
+
+	Float4x4 Float4x4::getTransposed()const
+	{
+		Float4x4 result{ NoInit{} };
+
+		for ( uint32_t col = 0u; col < 4u; ++col )
+		{
+			for ( uint32_t row = 0u; row < 4u; ++row )
+			{
+				result.m_data[row * 4u + col] = m_data[col * 4u + row];
+			}
+		}
+
+		return result;
+	}
+
+	Point3f Float4x4::transformPoint( Point3f const & point )const
+	{
+		Point3f result;
+		details::transformPoints( m_data, &point, &result, 1u, 1.0f );
+		return result;
+	}
+
+	Point3f Float4x4::transformVector( Point3f const & vector )const
+	{
+		Point3f result;
+		details::transformPoints( m_data, &vector, &result, 1u, 0.0f );
+		return result;
+	}
+
+	Point4f Float4x4::transform( Point4f const & vector )const
+	{
+		float const x = vector[0];
+		float const y = vector[1];
+		float const z = vector[2];
+		float const w = vector[3];
+		return Point4f
+		{
+			m_data[0] * x + m_data[4] * y + m_data[8] * z + m_data[12] * w,
+			m_data[1] * x + m_data[5] * y + m_data[9] * z + m_data[13] * w,
+			m_data[2] * x + m_data[6] * y + m_data[10] * z + m_data[14] * w,
+			m_data[3] * x + m_data[7] * y + m_data[11] * z + m_data[15] * w,
+		};
+	}
+
+	void Float4x4::transformPoints( Point3f const * src
+		, Point3f * dst
+		, size_t count )const
+	{
+		details::transformPoints( m_data, src, dst, count, 1.0f );
+	}
+
+	void Float4x4::transformVectors( Point3f const * src
+		, Point3f * dst
+		, size_t count )const
+	{
+		details::transformPoints( m_data, src, dst, count, 0.0f );
+	}
+
+#if CASTOR_USE_SSE2
+
+	void Float4x4::multiply( float const * lhs
+		, float const * rhs
+		, float * result )
+	{
+		__m128 const col0 = _mm_loadu_ps( lhs + 0 );
+		__m128 const col1 = _mm_loadu_ps( lhs + 4 );
+		__m128 const col2 = _mm_loadu_ps( lhs + 8 );
+		__m128 const col3 = _mm_loadu_ps( lhs + 12 );
+
+		// Each rhs column is read before the matching result column is written, so the operands can be aliased.
+		for ( uint32_t i = 0u; i < 16u; i += 4u )
+		{
+			__m128 value = _mm_add_ps( _mm_add_ps( _mm_mul_ps( col0, _mm_set1_ps( rhs[i + 0] ) )
+					, _mm_mul_ps( col1, _mm_set1_ps( rhs[i + 1] ) ) )
+				, _mm_add_ps( _mm_mul_ps( col2, _mm_set1_ps( rhs[i + 2] ) )
+					, _mm_mul_ps( col3, _mm_set1_ps( rhs[i + 3] ) ) ) );
+			_mm_storeu_ps( result + i, value );
+		}
+	}
+
+	void Float4x4::invert( float const * src
+		, float * result )
+	{
+		// Block matrix inversion, using 2x2 sub matrices.
+		// The algorithm is written for row major matrices, but the inverse of the transposed is the transposed of the inverse,
+		// so it gives the right result for column major ones too.
+		__m128 const col0 = _mm_loadu_ps( src + 0 );
+		__m128 const col1 = _mm_loadu_ps( src + 4 );
+		__m128 const col2 = _mm_loadu_ps( src + 8 );
+		__m128 const col3 = _mm_loadu_ps( src + 12 );
+
+		__m128 const a = _mm_movelh_ps( col0, col1 );
+		__m128 const b = _mm_movehl_ps( col1, col0 );
+		__m128 const c = _mm_movelh_ps( col2, col3 );
+		__m128 const d = _mm_movehl_ps( col3, col2 );
+
+		// ( |A|, |B|, |C|, |D| )
+		__m128 const detSub = _mm_sub_ps( _mm_mul_ps( details::shuffle< 0, 2, 0, 2 >( col0, col2 ), details::shuffle< 1, 3, 1, 3 >( col1, col3 ) )
+			, _mm_mul_ps( details::shuffle< 1, 3, 1, 3 >( col0, col2 ), details::shuffle< 0, 2, 0, 2 >( col1, col3 ) ) );
+		__m128 const detA = details::swizzle< 0, 0, 0, 0 >( detSub );
+		__m128 const detB = details::swizzle< 1, 1, 1, 1 >( detSub );
+		__m128 const detC = details::swizzle< 2, 2, 2, 2 >( detSub );
+		__m128 const detD = details::swizzle< 3, 3, 3, 3 >( detSub );
+
+		__m128 const dc = details::mat2AdjMul( d, c );
+		__m128 const ab = details::mat2AdjMul( a, b );
+		__m128 x = _mm_sub_ps( _mm_mul_ps( detD, a ), details::mat2Mul( b, dc ) );
+		__m128 w = _mm_sub_ps( _mm_mul_ps( detA, d ), details::mat2Mul( c, ab ) );
+		__m128 y = _mm_sub_ps( _mm_mul_ps( detB, c ), details::mat2MulAdj( d, ab ) );
+		__m128 z = _mm_sub_ps( _mm_mul_ps( detC, b ), details::mat2MulAdj( a, dc ) );
+
+		// |M| = |A|*|D| + |B|*|C| - tr( adj(A)B * adj(D)C )
+		__m128 tr = _mm_mul_ps( ab, details::swizzle< 0, 2, 1, 3 >( dc ) );
+		tr = _mm_add_ps( tr, _mm_movehl_ps( tr, tr ) );
+		tr = _mm_add_ss( tr, details::swizzle< 1, 1, 1, 1 >( tr ) );
+		tr = details::swizzle< 0, 0, 0, 0 >( tr );
+		__m128 const detM = _mm_sub_ps( _mm_add_ps( _mm_mul_ps( detA, detD ), _mm_mul_ps( detB, detC ) ), tr );
+		__m128 const rDetM = _mm_div_ps( _mm_setr_ps( 1.0f, -1.0f, -1.0f, 1.0f ), detM );
+
+		x = _mm_mul_ps( x, rDetM );
+		y = _mm_mul_ps( y, rDetM );
+		z = _mm_mul_ps( z, rDetM );
+		w = _mm_mul_ps( w, rDetM );
+
+		_mm_storeu_ps( result + 0, details::shuffle< 3, 1, 3, 1 >( x, y ) );
+		_mm_storeu_ps( result + 4, details::shuffle< 2, 0, 2, 0 >( x, y ) );
+		_mm_storeu_ps( result + 8, details::shuffle< 3, 1, 3, 1 >( z, w ) );
+		_mm_storeu_ps( result + 12, details::shuffle< 2, 0, 2, 0 >( z, w ) );
+	}
+
+#else
+
+	void Float4x4::multiply( float const * lhs
+		, float const * rhs
+		, float * result )
+	{
+		float value[16];
+
+		for ( uint32_t i = 0u; i < 16u; i += 4u )
+		{
+			for ( uint32_t row = 0u; row < 4u; ++row )
+			{
+				value[i + row] = lhs[row] * rhs[i + 0]
+					+ lhs[row + 4] * rhs[i + 1]
+					+ lhs[row + 8] * rhs[i + 2]
+					+ lhs[row + 12] * rhs[i + 3];
+			}
+		}
+
+		std::memcpy( result, value, sizeof( value ) );
+	}
+
+	void Float4x4::invert( float const * src
+		, float * result )
+	{
+		float const * m = src;
+		float const s0 = m[0] * m[5] - m[4] * m[1];
+		float const s1 = m[0] * m[6] - m[4] * m[2];
+		float const s2 = m[0] * m[7] - m[4] * m[3];
+		float const s3 = m[1] * m[6] - m[5] * m[2];
+		float const s4 = m[1] * m[7] - m[5] * m[3];
+		float const s5 = m[2] * m[7] - m[6] * m[3];
+		float const c5 = m[10] * m[15] - m[14] * m[11];
+		float const c4 = m[9] * m[15] - m[13] * m[11];
+		float const c3 = m[9] * m[14] - m[13] * m[10];
+		float const c2 = m[8] * m[15] - m[12] * m[11];
+		float const c1 = m[8] * m[14] - m[12] * m[10];
+		float const c0 = m[8] * m[13] - m[12] * m[9];
+		float const invDet = 1.0f / ( s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0 );
+		float value[16] =
+		{
+			( m[5] * c5 - m[6] * c4 + m[7] * c3 ) * invDet,
+			( -m[1] * c5 + m[2] * c4 - m[3] * c3 ) * invDet,
+			( m[13] * s5 - m[14] * s4 + m[15] * s3 ) * invDet,
+			( -m[9] * s5 + m[10] * s4 - m[11] * s3 ) * invDet,
+
+			( -m[4] * c5 + m[6] * c2 - m[7] * c1 ) * invDet,
+			( m[0] * c5 - m[2] * c2 + m[3] * c1 ) * invDet,
+			( -m[12] * s5 + m[14] * s2 - m[15] * s1 ) * invDet,
+			( m[8] * s5 - m[10] * s2 + m[11] * s1 ) * invDet,
+
+			( m[4] * c4 - m[5] * c2 + m[7] * c0 ) * invDet,
+			( -m[0] * c4 + m[1] * c2 - m[3] * c0 ) * invDet,
+			( m[12] * s4 - m[13] * s2 + m[15] * s0 ) * invDet,
+			( -m[8] * s4 + m[9] * s2 - m[11] * s0 ) * invDet,
+
+			( -m[4] * c3 + m[5] * c1 - m[6] * c0 ) * invDet,
+			( m[0] * c3 - m[1] * c1 + m[2] * c0 ) * invDet,
+			( -m[12] * s3 + m[13] * s1 - m[14] * s0 ) * invDet,
+			( m[8] * s3 - m[9] * s1 + m[10] * s0 ) * invDet,
+		};
+		std::memcpy( result, value, sizeof( value ) );
+	}
+
+#endif
+
+	//*************************************************************************************************
+
+	Float4x4 operator*( Float4x4 const & lhs, Float4x4 const & rhs )
+	{
+		Float4x4 result{ NoInit{} };
+		Float4x4::multiply( lhs.constPtr(), rhs.constPtr(), result.ptr() );
+		return result;
+	}
+
+	bool operator==( Float4x4 const & lhs, Float4x4 const & rhs )
+	{
+		return std::equal( lhs.constPtr(), lhs.constPtr() + 16u, rhs.constPtr() );
+	}
+
+	bool operator!=( Float4x4 const & lhs, Float4x4 const & rhs )
+	{
+		return !( lhs == rhs );
+	}
+}
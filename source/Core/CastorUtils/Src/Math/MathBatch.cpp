@@ -0,0 +1,541 @@
+#include "MathBatch.hpp"
+
+#include "Float4x4.hpp"
+#include "Graphics/BoundingBox.hpp"
+#include "Miscellaneous/CpuInformations.hpp"
+
+#if CASTOR_USE_SSE2 && !CASTOR_USE_DOUBLE
+#	define CU_MathBatchSimd 1
+#	include <emmintrin.h>
+#	include <immintrin.h>
+#else
+#	define CU_MathBatchSimd 0
+#endif
+
+#if defined( __GNUC__ ) || defined( __clang__ )
+#	define CU_KernelTarget( name ) __attribute__( ( target( name ) ) )
+#else
+#	define CU_KernelTarget( name )
+#endif
+
+namespace castor
+{
+	namespace
+	{
+		template< typename T, typename U >
+		T * doGetElement( U * base, size_t stride, size_t index )
+		{
+			using ByteT = typename std::conditional< std::is_const< U >::value, uint8_t const, uint8_t >::type;
+			return reinterpret_cast< T * >( reinterpret_cast< ByteT * >( base ) + index * stride );
+		}
+
+		//*****************************************************************************************
+
+		void doTransformScalar( real const * matrix
+			, real const * src
+			, size_t srcStride
+			, real * dst
+			, size_t dstStride
+			, size_t count
+			, real w )
+		{
+			for ( size_t i = 0u; i < count; ++i )
+			{
+				auto in = doGetElement< real const >( src, srcStride, i );
+				auto out = doGetElement< real >( dst, dstStride, i );
+				real const x = in[0];
+				real const y = in[1];
+				real const z = in[2];
+				out[0] = matrix[0] * x + matrix[4] * y + matrix[8] * z + matrix[12] * w;
+				out[1] = matrix[1] * x + matrix[5] * y + matrix[9] * z + matrix[13] * w;
+				out[2] = matrix[2] * x + matrix[6] * y + matrix[10] * z + matrix[14] * w;
+			}
+		}
+
+		void doTransformScalar( real const * matrix
+			, std::array< real const *, 3u > const & src
+			, std::array< real *, 3u > const & dst
+			, size_t begin
+			, size_t count )
+		{
+			for ( size_t i = begin; i < count; ++i )
+			{
+				real const x = src[0][i];
+				real const y = src[1][i];
+				real const z = src[2][i];
+				dst[0][i] = matrix[0] * x + matrix[4] * y + matrix[8] * z + matrix[12];
+				dst[1][i] = matrix[1] * x + matrix[5] * y + matrix[9] * z + matrix[13];
+				dst[2][i] = matrix[2] * x + matrix[6] * y + matrix[10] * z + matrix[14];
+			}
+		}
+
+		void doMultiplyScalar( real const * lhs
+			, real const * rhs
+			, real * dst )
+		{
+			real result[16];
+
+			for ( uint32_t col = 0u; col < 16u; col += 4u )
+			{
+				for ( uint32_t row = 0u; row < 4u; ++row )
+				{
+					result[col + row] = lhs[row] * rhs[col + 0]
+						+ lhs[row + 4] * rhs[col + 1]
+						+ lhs[row + 8] * rhs[col + 2]
+						+ lhs[row + 12] * rhs[col + 3];
+				}
+			}
+
+			std::memcpy( dst, result, sizeof( result ) );
+		}
+
+		void doTransformBoxScalar( real const * matrix
+			, BoundingBox const & src
+			, BoundingBox & dst )
+		{
+			auto & center = src.getCenter();
+			auto extent = src.getDimensions() / 2.0_r;
+			Point3r min;
+			Point3r max;
+
+			for ( uint32_t i = 0u; i < 3u; ++i )
+			{
+				real const c = matrix[i] * center[0] + matrix[i + 4] * center[1] + matrix[i + 8] * center[2] + matrix[i + 12];
+				real const e = std::abs( matrix[i] ) * extent[0] + std::abs( matrix[i + 4] ) * extent[1] + std::abs( matrix[i + 8] ) * extent[2];
+				min[i] = c - e;
+				max[i] = c + e;
+			}
+
+			dst.load( min, max );
+		}
+
+		void doSquaredDistancesScalar( Point3r const & point
+			, real const * src
+			, size_t srcStride
+			, real * dst
+			, size_t begin
+			, size_t count )
+		{
+			for ( size_t i = begin; i < count; ++i )
+			{
+				auto in = doGetElement< real const >( src, srcStride, i );
+				real const x = in[0] - point[0];
+				real const y = in[1] - point[1];
+				real const z = in[2] - point[2];
+				dst[i] = x * x + y * y + z * z;
+			}
+		}
+
+		void doSquaredDistancesScalar( Point3r const & point
+			, std::array< real const *, 3u > const & src
+			, real * dst
+			, size_t begin
+			, size_t count )
+		{
+			for ( size_t i = begin; i < count; ++i )
+			{
+				real const x = src[0][i] - point[0];
+				real const y = src[1][i] - point[1];
+				real const z = src[2][i] - point[2];
+				dst[i] = x * x + y * y + z * z;
+			}
+		}
+
+		//*****************************************************************************************
+
+#if CU_MathBatchSimd
+
+		bool doIsYmmStateEnabled()
+		{
+#	if defined( _MSC_VER )
+			return ( _xgetbv( 0 ) & 0x06 ) == 0x06;
+#	else
+			uint32_t eax;
+			uint32_t edx;
+			__asm__( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+			return ( eax & 0x06 ) == 0x06;
+#	endif
+		}
+
+		__m128 doLoadPoint( float const * point )
+		{
+			// Points may be packed, so no 4 components load, the 4th float may be out of the buffer.
+			return _mm_setr_ps( point[0], point[1], point[2], 0.0f );
+		}
+
+		void doStorePoint( float * point, __m128 value )
+		{
+			_mm_storel_pi( reinterpret_cast< __m64 * >( point ), value );
+			_mm_store_ss( point + 2, _mm_movehl_ps( value, value ) );
+		}
+
+		void doTransformSse2( float const * matrix
+			, float const * src
+			, size_t srcStride
+			, float * dst
+			, size_t dstStride
+			, size_t count
+			, float w )
+		{
+			__m128 const col0 = _mm_loadu_ps( matrix + 0 );
+			__m128 const col1 = _mm_loadu_ps( matrix + 4 );
+			__m128 const col2 = _mm_loadu_ps( matrix + 8 );
+			__m128 const col3 = _mm_mul_ps( _mm_loadu_ps( matrix + 12 ), _mm_set1_ps( w ) );
+
+			for ( size_t i = 0u; i < count; ++i )
+			{
+				auto in = doGetElement< float const >( src, srcStride, i );
+				__m128 value = _mm_add_ps( _mm_add_ps( _mm_mul_ps( col0, _mm_set1_ps( in[0] ) )
+						, _mm_mul_ps( col1, _mm_set1_ps( in[1] ) ) )
+					, _mm_add_ps( _mm_mul_ps( col2, _mm_set1_ps( in[2] ) )
+						, col3 ) );
+				doStorePoint( doGetElement< float >( dst, dstStride, i ), value );
+			}
+		}
+
+		size_t doTransformSse2( float const * matrix
+			, std::array< float const *, 3u > const & src
+			, std::array< float *, 3u > const & dst
+			, size_t count )
+		{
+			__m128 m[16];
+
+			for ( uint32_t i = 0u; i < 16u; ++i )
+			{
+				m[i] = _mm_set1_ps( matrix[i] );
+			}
+
+			size_t const end = count - count % 4u;
+
+			for ( size_t i = 0u; i < end; i += 4u )
+			{
+				__m128 const x = _mm_loadu_ps( src[0] + i );
+				__m128 const y = _mm_loadu_ps( src[1] + i );
+				__m128 const z = _mm_loadu_ps( src[2] + i );
+				_mm_storeu_ps( dst[0] + i, _mm_add_ps( _mm_add_ps( _mm_mul_ps( m[0], x ), _mm_mul_ps( m[4], y ) ), _mm_add_ps( _mm_mul_ps( m[8], z ), m[12] ) ) );
+				_mm_storeu_ps( dst[1] + i, _mm_add_ps( _mm_add_ps( _mm_mul_ps( m[1], x ), _mm_mul_ps( m[5], y ) ), _mm_add_ps( _mm_mul_ps( m[9], z ), m[13] ) ) );
+				_mm_storeu_ps( dst[2] + i, _mm_add_ps( _mm_add_ps( _mm_mul_ps( m[2], x ), _mm_mul_ps( m[6], y ) ), _mm_add_ps( _mm_mul_ps( m[10], z ), m[14] ) ) );
+			}
+
+			return end;
+		}
+
+		CU_KernelTarget( "avx" )
+		size_t doTransformAvx( float const * matrix
+			, std::array< float const *, 3u > const & src
+			, std::array< float *, 3u > const & dst
+			, size_t count )
+		{
+			__m256 m[16];
+
+			for ( uint32_t i = 0u; i < 16u; ++i )
+			{
+				m[i] = _mm256_set1_ps( matrix[i] );
+			}
+
+			size_t const end = count - count % 8u;
+
+			for ( size_t i = 0u; i < end; i += 8u )
+			{
+				__m256 const x = _mm256_loadu_ps( src[0] + i );
+				__m256 const y = _mm256_loadu_ps( src[1] + i );
+				__m256 const z = _mm256_loadu_ps( src[2] + i );
+				_mm256_storeu_ps( dst[0] + i, _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( m[0], x ), _mm256_mul_ps( m[4], y ) ), _mm256_add_ps( _mm256_mul_ps( m[8], z ), m[12] ) ) );
+				_mm256_storeu_ps( dst[1] + i, _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( m[1], x ), _mm256_mul_ps( m[5], y ) ), _mm256_add_ps( _mm256_mul_ps( m[9], z ), m[13] ) ) );
+				_mm256_storeu_ps( dst[2] + i, _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( m[2], x ), _mm256_mul_ps( m[6], y ) ), _mm256_add_ps( _mm256_mul_ps( m[10], z ), m[14] ) ) );
+			}
+
+			_mm256_zeroupper();
+			return end;
+		}
+
+		void doTransformBoxSse2( float const * matrix
+			, BoundingBox const & src
+			, BoundingBox & dst )
+		{
+			__m128 const absMask = _mm_castsi128_ps( _mm_set1_epi32( 0x7FFFFFFF ) );
+			__m128 const col0 = _mm_loadu_ps( matrix + 0 );
+			__m128 const col1 = _mm_loadu_ps( matrix + 4 );
+			__m128 const col2 = _mm_loadu_ps( matrix + 8 );
+			__m128 const col3 = _mm_loadu_ps( matrix + 12 );
+			auto & center = src.getCenter();
+			auto & dimensions = src.getDimensions();
+			__m128 const c = _mm_add_ps( _mm_add_ps( _mm_mul_ps( col0, _mm_set1_ps( center[0] ) )
+					, _mm_mul_ps( col1, _mm_set1_ps( center[1] ) ) )
+				, _mm_add_ps( _mm_mul_ps( col2, _mm_set1_ps( center[2] ) )
+					, col3 ) );
+			__m128 const e = _mm_mul_ps( _mm_set1_ps( 0.5f )
+				, _mm_add_ps( _mm_add_ps( _mm_mul_ps( _mm_and_ps( col0, absMask ), _mm_set1_ps( dimensions[0] ) )
+						, _mm_mul_ps( _mm_and_ps( col1, absMask ), _mm_set1_ps( dimensions[1] ) ) )
+					, _mm_mul_ps( _mm_and_ps( col2, absMask ), _mm_set1_ps( dimensions[2] ) ) ) );
+			Point3f min;
+			Point3f max;
+			doStorePoint( min.ptr(), _mm_sub_ps( c, e ) );
+			doStorePoint( max.ptr(), _mm_add_ps( c, e ) );
+			dst.load( min, max );
+		}
+
+		size_t doSquaredDistancesSse2( Point3f const & point
+			, float const * src
+			, size_t srcStride
+			, float * dst
+			, size_t count )
+		{
+			__m128 const px = _mm_set1_ps( point[0] );
+			__m128 const py = _mm_set1_ps( point[1] );
+			__m128 const pz = _mm_set1_ps( point[2] );
+			size_t const end = count - count % 4u;
+
+			for ( size_t i = 0u; i < end; i += 4u )
+			{
+				// Gathers 4 points as a structure of arrays.
+				auto p0 = doGetElement< float const >( src, srcStride, i + 0u );
+				auto p1 = doGetElement< float const >( src, srcStride, i + 1u );
+				auto p2 = doGetElement< float const >( src, srcStride, i + 2u );
+				auto p3 = doGetElement< float const >( src, srcStride, i + 3u );
+				__m128 const x = _mm_sub_ps( _mm_setr_ps( p0[0], p1[0], p2[0], p3[0] ), px );
+				__m128 const y = _mm_sub_ps( _mm_setr_ps( p0[1], p1[1], p2[1], p3[1] ), py );
+				__m128 const z = _mm_sub_ps( _mm_setr_ps( p0[2], p1[2], p2[2], p3[2] ), pz );
+				_mm_storeu_ps( dst + i, _mm_add_ps( _mm_add_ps( _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ), _mm_mul_ps( z, z ) ) );
+			}
+
+			return end;
+		}
+
+		size_t doSquaredDistancesSse2( Point3f const & point
+			, std::array< float const *, 3u > const & src
+			, float * dst
+			, size_t count )
+		{
+			__m128 const px = _mm_set1_ps( point[0] );
+			__m128 const py = _mm_set1_ps( point[1] );
+			__m128 const pz = _mm_set1_ps( point[2] );
+			size_t const end = count - count % 4u;
+
+			for ( size_t i = 0u; i < end; i += 4u )
+			{
+				__m128 const x = _mm_sub_ps( _mm_loadu_ps( src[0] + i ), px );
+				__m128 const y = _mm_sub_ps( _mm_loadu_ps( src[1] + i ), py );
+				__m128 const z = _mm_sub_ps( _mm_loadu_ps( src[2] + i ), pz );
+				_mm_storeu_ps( dst + i, _mm_add_ps( _mm_add_ps( _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ), _mm_mul_ps( z, z ) ) );
+			}
+
+			return end;
+		}
+
+		CU_KernelTarget( "avx" )
+		size_t doSquaredDistancesAvx( Point3f const & point
+			, std::array< float const *, 3u > const & src
+			, float * dst
+			, size_t count )
+		{
+			__m256 const px = _mm256_set1_ps( point[0] );
+			__m256 const py = _mm256_set1_ps( point[1] );
+			__m256 const pz = _mm256_set1_ps( point[2] );
+			size_t const end = count - count % 8u;
+
+			for ( size_t i = 0u; i < end; i += 8u )
+			{
+				__m256 const x = _mm256_sub_ps( _mm256_loadu_ps( src[0] + i ), px );
+				__m256 const y = _mm256_sub_ps( _mm256_loadu_ps( src[1] + i ), py );
+				__m256 const z = _mm256_sub_ps( _mm256_loadu_ps( src[2] + i ), pz );
+				_mm256_storeu_ps( dst + i, _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( x, x ), _mm256_mul_ps( y, y ) ), _mm256_mul_ps( z, z ) ) );
+			}
+
+			_mm256_zeroupper();
+			return end;
+		}
+
+#endif
+	}
+
+	namespace batch
+	{
+		MathKernel getMathKernel()
+		{
+			static MathKernel const result = []()
+			{
+				MathKernel kernel = MathKernel::eScalar;
+#if CU_MathBatchSimd
+				CpuInformations cpu;
+
+				if ( cpu.SSE2() )
+				{
+					kernel = MathKernel::eSSE2;
+
+					if ( cpu.AVX() && cpu.OSXSAVE() && doIsYmmStateEnabled() )
+					{
+						kernel = MathKernel::eAVX;
+					}
+				}
+#endif
+				return kernel;
+			}();
+			return result;
+		}
+
+		void transformPoints( Matrix4x4r const & matrix
+			, real const * src
+			, size_t srcStride
+			, real * dst
+			, size_t dstStride
+			, size_t count
+			, MathKernel kernel )
+		{
+			kernel = std::min( kernel, getMathKernel() );
+#if CU_MathBatchSimd
+			if ( kernel >= MathKernel::eSSE2 )
+			{
+				doTransformSse2( matrix.constPtr(), src, srcStride, dst, dstStride, count, 1.0f );
+				return;
+			}
+#endif
+			doTransformScalar( matrix.constPtr(), src, srcStride, dst, dstStride, count, 1.0_r );
+		}
+
+		void transformVectors( Matrix4x4r const & matrix
+			, real const * src
+			, size_t srcStride
+			, real * dst
+			, size_t dstStride
+			, size_t count
+			, MathKernel kernel )
+		{
+			kernel = std::min( kernel, getMathKernel() );
+#if CU_MathBatchSimd
+			if ( kernel >= MathKernel::eSSE2 )
+			{
+				doTransformSse2( matrix.constPtr(), src, srcStride, dst, dstStride, count, 0.0f );
+				return;
+			}
+#endif
+			doTransformScalar( matrix.constPtr(), src, srcStride, dst, dstStride, count, 0.0_r );
+		}
+
+		void transformPoints( Matrix4x4r const & matrix
+			, Point3r const * src
+			, Point3r * dst
+			, size_t count
+			, MathKernel kernel )
+		{
+			if ( count )
+			{
+				transformPoints( matrix
+					, src->constPtr()
+					, sizeof( Point3r )
+					, dst->ptr()
+					, sizeof( Point3r )
+					, count
+					, kernel );
+			}
+		}
+
+		void transformPoints( Matrix4x4r const & matrix
+			, std::array< real const *, 3u > const & src
+			, std::array< real *, 3u > const & dst
+			, size_t count
+			, MathKernel kernel )
+		{
+			kernel = std::min( kernel, getMathKernel() );
+			size_t done = 0u;
+#if CU_MathBatchSimd
+			if ( kernel >= MathKernel::eAVX )
+			{
+				done = doTransformAvx( matrix.constPtr(), src, dst, count );
+			}
+			else if ( kernel >= MathKernel::eSSE2 )
+			{
+				done = doTransformSse2( matrix.constPtr(), src, dst, count );
+			}
+#endif
+			doTransformScalar( matrix.constPtr(), src, dst, done, count );
+		}
+
+		void multiply( Matrix4x4r const * lhs
+			, Matrix4x4r const * rhs
+			, Matrix4x4r * dst
+			, size_t count
+			, MathKernel kernel )
+		{
+			kernel = std::min( kernel, getMathKernel() );
+#if CU_MathBatchSimd
+			if ( kernel >= MathKernel::eSSE2 )
+			{
+				for ( size_t i = 0u; i < count; ++i )
+				{
+					Float4x4::multiply( lhs[i].constPtr(), rhs[i].constPtr(), dst[i].ptr() );
+				}
+
+				return;
+			}
+#endif
+			for ( size_t i = 0u; i < count; ++i )
+			{
+				doMultiplyScalar( lhs[i].constPtr(), rhs[i].constPtr(), dst[i].ptr() );
+			}
+		}
+
+		void transformBoxes( Matrix4x4r const & matrix
+			, BoundingBox const * src
+			, BoundingBox * dst
+			, size_t count
+			, MathKernel kernel )
+		{
+			kernel = std::min( kernel, getMathKernel() );
+#if CU_MathBatchSimd
+			if ( kernel >= MathKernel::eSSE2 )
+			{
+				for ( size_t i = 0u; i < count; ++i )
+				{
+					doTransformBoxSse2( matrix.constPtr(), src[i], dst[i] );
+				}
+
+				return;
+			}
+#endif
+			for ( size_t i = 0u; i < count; ++i )
+			{
+				doTransformBoxScalar( matrix.constPtr(), src[i], dst[i] );
+			}
+		}
+
+		void squaredDistances( Point3r const & point
+			, real const * src
+			, size_t srcStride
+			, real * dst
+			, size_t count
+			, MathKernel kernel )
+		{
+			kernel = std::min( kernel, getMathKernel() );
+			size_t done = 0u;
+#if CU_MathBatchSimd
+			if ( kernel >= MathKernel::eSSE2 )
+			{
+				done = doSquaredDistancesSse2( point, src, srcStride, dst, count );
+			}
+#endif
+			doSquaredDistancesScalar( point, src, srcStride, dst, done, count );
+		}
+
+		void squaredDistances( Point3r const & point
+			, std::array< real const *, 3u > const & src
+			, real * dst
+			, size_t count
+			, MathKernel kernel )
+		{
+			kernel = std::min( kernel, getMathKernel() );
+			size_t done = 0u;
+#if CU_MathBatchSimd
+			if ( kernel >= MathKernel::eAVX )
+			{
+				done = doSquaredDistancesAvx( point, src, dst, count );
+			}
+			else if ( kernel >= MathKernel::eSSE2 )
+			{
+				done = doSquaredDistancesSse2( point, src, dst, count );
+			}
+#endif
+			doSquaredDistancesScalar( point, src, dst, done, count );
+		}
+	}
+}
@@ -0,0 +1,261 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_MathBatch_H___
+#define ___CU_MathBatch_H___
+
+#include "CastorUtilsPrerequisites.hpp"
+
+namespace castor
+{
+	/*!
+	\author 	Sylvain DOREMUS
+	\version	0.10.0
+	\date		17/01/2018
+	\~english
+	\brief		The instruction sets available to the math batch kernels.
+	\remarks	Ordered, a level implies the availability of the previous ones.
+	\~french
+	\brief		Les jeux d'instructions disponibles pour les noyaux de traitement mathématique par lots.
+	\remarks	Ordonnés, un niveau implique la disponibilité des précédents.
+	*/
+	enum class MathKernel
+		: uint8_t
+	{
+		//!\~english	Element per element processing.
+		//!\~french		Traitement élément par élément.
+		eScalar,
+		//!\~english	SSE2 kernels.
+		//!\~french		Noyaux SSE2.
+		eSSE2,
+		//!\~english	AVX kernels (structure of arrays inputs only).
+		//!\~french		Noyaux AVX (entrées en structure de tableaux uniquement).
+		eAVX,
+		CASTOR_SCOPED_ENUM_BOUNDS( eScalar )
+	};
+	/**
+	 *\~english
+	 *\brief		Bulk processing of points, boxes and matrices.
+	 *\remarks		The strided inputs are given as a pointer to the first element's X component, and the distance in bytes between two elements,
+	 *				which allows processing interleaved vertex buffers directly.
+	 *				<br />The structure of arrays inputs are given as one array per component.
+	 *				<br />Each function uses the best kernel available, up to the given level (clamped to getMathKernel()).
+	 *				The SIMD kernels are only used for single precision builds (CASTOR_USE_DOUBLE disabled).
+	 *\~french
+	 *\brief		Traitement par lots de points, boîtes et matrices.
+	 *\remarks		Les entrées avec pas sont données via un pointeur sur la composante X du premier élément, et la distance en octets entre deux éléments,
+	 *				ce qui permet de traiter directement les tampons de sommets entrelacés.
+	 *				<br />Les entrées en structure de tableaux sont données via un tableau par composante.
+	 *				<br />Chaque fonction utilise le meilleur noyau disponible, jusqu'au niveau donné (limité à getMathKernel()).
+	 *				Les noyaux SIMD ne sont utilisés qu'en simple précision (CASTOR_USE_DOUBLE désactivé).
+	 */
+	namespace batch
+	{
+		/**
+		 *\~english
+		 *\brief		Retrieves the best math kernel level supported by both the build and the running CPU.
+		 *\remarks		Computed once, at the first call.
+		 *\~french
+		 *\brief		Récupère le meilleur niveau de noyau mathématique supporté à la fois par la compilation et le CPU.
+		 *\remarks		Calculé une fois, au premier appel.
+		 */
+		CU_API MathKernel getMathKernel();
+		/**
+		 *\~english
+		 *\brief		Transforms strided points (their W component is 1, no perspective division).
+		 *\remarks		The source and destination may be the same.
+		 *\param[in]	matrix		The transformation matrix.
+		 *\param[in]	src			The first source point.
+		 *\param[in]	srcStride	The distance in bytes between two source points.
+		 *\param[out]	dst			Receives the first transformed point.
+		 *\param[in]	dstStride	The distance in bytes between two destination points.
+		 *\param[in]	count		The points count.
+		 *\param[in]	kernel		The maximum kernel level.
+		 *\~french
+		 *\brief		Transforme des points avec pas (leur composante W vaut 1, pas de division de perspective).
+		 *\remarks		La source et la destination peuvent être les mêmes.
+		 *\param[in]	matrix		La matrice de transformation.
+		 *\param[in]	src			Le premier point source.
+		 *\param[in]	srcStride	La distance en octets entre deux points source.
+		 *\param[out]	dst			Reçoit le premier point transformé.
+		 *\param[in]	dstStride	La distance en octets entre deux points destination.
+		 *\param[in]	count		Le nombre de points.
+		 *\param[in]	kernel		Le niveau de noyau maximal.
+		 */
+		CU_API void transformPoints( Matrix4x4r const & matrix
+			, real const * src
+			, size_t srcStride
+			, real * dst
+			, size_t dstStride
+			, size_t count
+			, MathKernel kernel = MathKernel::eMax );
+		/**
+		 *\~english
+		 *\brief		Transforms strided vectors (their W component is 0).
+		 *\remarks		The source and destination may be the same.
+		 *\param[in]	matrix		The transformation matrix.
+		 *\param[in]	src			The first source vector.
+		 *\param[in]	srcStride	The distance in bytes between two source vectors.
+		 *\param[out]	dst			Receives the first transformed vector.
+		 *\param[in]	dstStride	The distance in bytes between two destination vectors.
+		 *\param[in]	count		The vectors count.
+		 *\param[in]	kernel		The maximum kernel level.
+		 *\~french
+		 *\brief		Transforme des vecteurs avec pas (leur composante W vaut 0).
+		 *\remarks		La source et la destination peuvent être les mêmes.
+		 *\param[in]	matrix		La matrice de transformation.
+		 *\param[in]	src			Le premier vecteur source.
+		 *\param[in]	srcStride	La distance en octets entre deux vecteurs source.
+		 *\param[out]	dst			Reçoit le premier vecteur transformé.
+		 *\param[in]	dstStride	La distance en octets entre deux vecteurs destination.
+		 *\param[in]	count		Le nombre de vecteurs.
+		 *\param[in]	kernel		Le niveau de noyau maximal.
+		 */
+		CU_API void transformVectors( Matrix4x4r const & matrix
+			, real const * src
+			, size_t srcStride
+			, real * dst
+			, size_t dstStride
+			, size_t count
+			, MathKernel kernel = MathKernel::eMax );
+		/**
+		 *\~english
+		 *\brief		Transforms an array of points (their W component is 1, no perspective division).
+		 *\remarks		The source and destination may be the same.
+		 *\param[in]	matrix	The transformation matrix.
+		 *\param[in]	src		The source points.
+		 *\param[out]	dst		Receives the transformed points.
+		 *\param[in]	count	The points count.
+		 *\param[in]	kernel	The maximum kernel level.
+		 *\~french
+		 *\brief		Transforme un tableau de points (leur composante W vaut 1, pas de division de perspective).
+		 *\remarks		La source et la destination peuvent être les mêmes.
+		 *\param[in]	matrix	La matrice de transformation.
+		 *\param[in]	src		Les points source.
+		 *\param[out]	dst		Reçoit les points transformés.
+		 *\param[in]	count	Le nombre de points.
+		 *\param[in]	kernel	Le niveau de noyau maximal.
+		 */
+		CU_API void transformPoints( Matrix4x4r const & matrix
+			, Point3r const * src
+			, Point3r * dst
+			, size_t count
+			, MathKernel kernel = MathKernel::eMax );
+		/**
+		 *\~english
+		 *\brief		Transforms points given as a structure of arrays (their W component is 1, no perspective division).
+		 *\remarks		The source and destination arrays may be the same.
+		 *\param[in]	matrix	The transformation matrix.
+		 *\param[in]	src		The source X, Y and Z arrays.
+		 *\param[out]	dst		Receive the transformed X, Y and Z components.
+		 *\param[in]	count	The points count.
+		 *\param[in]	kernel	The maximum kernel level.
+		 *\~french
+		 *\brief		Transforme des points donnés sous forme de structure de tableaux (leur composante W vaut 1, pas de division de perspective).
+		 *\remarks		Les tableaux source et destination peuvent être les mêmes.
+		 *\param[in]	matrix	La matrice de transformation.
+		 *\param[in]	src		Les tableaux source X, Y et Z.
+		 *\param[out]	dst		Reçoivent les composantes X, Y et Z transformées.
+		 *\param[in]	count	Le nombre de points.
+		 *\param[in]	kernel	Le niveau de noyau maximal.
+		 */
+		CU_API void transformPoints( Matrix4x4r const & matrix
+			, std::array< real const *, 3u > const & src
+			, std::array< real *, 3u > const & dst
+			, size_t count
+			, MathKernel kernel = MathKernel::eMax );
+		/**
+		 *\~english
+		 *\brief		Multiplies matrices two by two: dst[i] = lhs[i] * rhs[i].
+		 *\remarks		The destination may be one of the operands arrays.
+		 *\param[in]	lhs, rhs	The operands arrays.
+		 *\param[out]	dst			Receives the results.
+		 *\param[in]	count		The matrices count.
+		 *\param[in]	kernel		The maximum kernel level.
+		 *\~french
+		 *\brief		Multiplie des matrices deux à deux : dst[i] = lhs[i] * rhs[i].
+		 *\remarks		La destination peut être l'un des tableaux d'opérandes.
+		 *\param[in]	lhs, rhs	Les tableaux d'opérandes.
+		 *\param[out]	dst			Reçoit les résultats.
+		 *\param[in]	count		Le nombre de matrices.
+		 *\param[in]	kernel		Le niveau de noyau maximal.
+		 */
+		CU_API void multiply( Matrix4x4r const * lhs
+			, Matrix4x4r const * rhs
+			, Matrix4x4r * dst
+			, size_t count
+			, MathKernel kernel = MathKernel::eMax );
+		/**
+		 *\~english
+		 *\brief		Computes the axis aligned boxes enclosing the transformed boxes.
+		 *\remarks		Uses the box center and extent (J. Arvo's method), instead of transforming the 8 corners.
+		 *				<br />The source and destination may be the same.
+		 *\param[in]	matrix	The transformation matrix.
+		 *\param[in]	src		The source boxes.
+		 *\param[out]	dst		Receives the axis aligned boxes.
+		 *\param[in]	count	The boxes count.
+		 *\param[in]	kernel	The maximum kernel level.
+		 *\~french
+		 *\brief		Calcule les boîtes alignées sur les axes englobant les boîtes transformées.
+		 *\remarks		Utilise le centre et l'étendue de la boîte (méthode de J. Arvo), au lieu de transformer les 8 coins.
+		 *				<br />La source et la destination peuvent être les mêmes.
+		 *\param[in]	matrix	La matrice de transformation.
+		 *\param[in]	src		Les boîtes source.
+		 *\param[out]	dst		Reçoit les boîtes alignées sur les axes.
+		 *\param[in]	count	Le nombre de boîtes.
+		 *\param[in]	kernel	Le niveau de noyau maximal.
+		 */
+		CU_API void transformBoxes( Matrix4x4r const & matrix
+			, BoundingBox const * src
+			, BoundingBox * dst
+			, size_t count
+			, MathKernel kernel = MathKernel::eMax );
+		/**
+		 *\~english
+		 *\brief		Computes the squared distances from strided points to a reference point.
+		 *\param[in]	point		The reference point.
+		 *\param[in]	src			The first point.
+		 *\param[in]	srcStride	The distance in bytes between two points.
+		 *\param[out]	dst			Receives the squared distances.
+		 *\param[in]	count		The points count.
+		 *\param[in]	kernel		The maximum kernel level.
+		 *\~french
+		 *\brief		Calcule les distances au carré entre des points avec pas et un point de référence.
+		 *\param[in]	point		Le point de référence.
+		 *\param[in]	src			Le premier point.
+		 *\param[in]	srcStride	La distance en octets entre deux points.
+		 *\param[out]	dst			Reçoit les distances au carré.
+		 *\param[in]	count		Le nombre de points.
+		 *\param[in]	kernel		Le niveau de noyau maximal.
+		 */
+		CU_API void squaredDistances( Point3r const & point
+			, real const * src
+			, size_t srcStride
+			, real * dst
+			, size_t count
+			, MathKernel kernel = MathKernel::eMax );
+		/**
+		 *\~english
+		 *\brief		Computes the squared distances from points given as a structure of arrays to a reference point.
+		 *\param[in]	point	The reference point.
+		 *\param[in]	src		The X, Y and Z arrays.
+		 *\param[out]	dst		Receives the squared distances.
+		 *\param[in]	count	The points count.
+		 *\param[in]	kernel	The maximum kernel level.
+		 *\~french
+		 *\brief		Calcule les distances au carré entre des points donnés sous forme de structure de tableaux et un point de référence.
+		 *\param[in]	point	Le point de référence.
+		 *\param[in]	src		Les tableaux X, Y et Z.
+		 *\param[out]	dst		Reçoit les distances au carré.
+		 *\param[in]	count	Le nombre de points.
+		 *\param[in]	kernel	Le niveau de noyau maximal.
+		 */
+		CU_API void squaredDistances( Point3r const & point
+			, std::array< real const *, 3u > const & src
+			, real * dst
+			, size_t count
+			, MathKernel kernel = MathKernel::eMax );
+	}
+}
+
+#endif
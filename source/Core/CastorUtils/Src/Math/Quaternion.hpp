@@ -386,6 +386,15 @@ namespace castor
 		 *\param[out]	p_matrix	La matrice à remplir
 		 */
 		inline void toMatrix( Matrix4x4d & p_matrix )const;
+		/**
+		 *\~english
+		 *\brief		Fills a rotation matrix from this Quaternion
+		 *\param[out]	p_matrix	The rotation matrix to fill
+		 *\~french
+		 *\brief		Remplit une matrice de rotation à partir de ce Quaternion
+		 *\param[out]	p_matrix	La matrice à remplir
+		 */
+		inline void toMatrix( Float4x4 & p_matrix )const;
 		/**
 		 *\~english
 		 *\brief		Gives the axis and the angle from this Quaternion
@@ -367,6 +367,41 @@ namespace castor
 		matrix::setRotate( p_matrix, *this );
 	}
 
+	template< typename T >
+	void QuaternionT< T >::toMatrix( Float4x4 & p_matrix )const
+	{
+		float const qxx = float( quat.x * quat.x );
+		float const qyy = float( quat.y * quat.y );
+		float const qzz = float( quat.z * quat.z );
+		float const qxz = float( quat.x * quat.z );
+		float const qxy = float( quat.x * quat.y );
+		float const qyz = float( quat.y * quat.z );
+		float const qwx = float( quat.w * quat.x );
+		float const qwy = float( quat.w * quat.y );
+		float const qwz = float( quat.w * quat.z );
+		float * data = p_matrix.ptr();
+
+		data[0] = 1.0f - 2.0f * ( qyy + qzz );
+		data[1] = 2.0f * ( qxy + qwz );
+		data[2] = 2.0f * ( qxz - qwy );
+		data[3] = 0.0f;
+
+		data[4] = 2.0f * ( qxy - qwz );
+		data[5] = 1.0f - 2.0f * ( qxx + qzz );
+		data[6] = 2.0f * ( qyz + qwx );
+		data[7] = 0.0f;
+
+		data[8] = 2.0f * ( qxz + qwy );
+		data[9] = 2.0f * ( qyz - qwx );
+		data[10] = 1.0f - 2.0f * ( qxx + qyy );
+		data[11] = 0.0f;
+
+		data[12] = 0.0f;
+		data[13] = 0.0f;
+		data[14] = 0.0f;
+		data[15] = 1.0f;
+	}
+
 	template< typename T >
 	void QuaternionT< T >::toAxisAngle( Point3f & p_vector, Angle & p_angle )const
 	{
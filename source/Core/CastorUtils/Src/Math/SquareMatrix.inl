@@ -1,4 +1,4 @@
-﻿#include "Simd.hpp"
+﻿#include "Float4x4.hpp"
 
 namespace castor
 {
@@ -113,55 +113,25 @@ namespace castor
 				result[0][0] = +input[0][0] / determinant;
 			}
 		};
-		template< typename Type, uint32_t Count > struct SqrMtxOperators;
-
 		template<>
-		struct SqrMtxOperators< float, 4 >
+		struct SqrMtxInverter< float, 4 >
 		{
-			static const uint32_t Size = sizeof( float ) * 4;
-
-#if CASTOR_USE_SSE2
-
-			static inline void mul( castor::SquareMatrix< float, 4 > & p_lhs, castor::SquareMatrix< float, 4 > const & p_rhs )
+			static inline void inverse( castor::SquareMatrix< float, 4 > const & input
+				, castor::SquareMatrix< float, 4 > & result )
 			{
-				Matrix4x4f result = Matrix4x4f( NoInit() );
-				Float4 col0{ p_lhs[0].ptr() };		// col0 = p_lhs[0]
-				Float4 col1{ p_lhs[1].ptr() };		// col1 = p_lhs[1]
-				Float4 col2{ p_lhs[2].ptr() };		// col2 = p_lhs[2]
-				Float4 col3{ p_lhs[3].ptr() };		// col3 = p_lhs[3]
-
-				for ( int i = 0; i < 4; ++i )
-				{
-					Float4 colB{ p_rhs[i][0] };		// colB = { p_rhs[i][0], p_rhs[i][0], p_rhs[i][0], p_rhs[i][0] }
-					Float4 colR{ col0 * colB };	// colR = col0 * colB
-					colB = Float4( p_rhs[i][1] );		// colB = { p_rhs[i][1], p_rhs[i][1], p_rhs[i][1], p_rhs[i][1] }
-					colR += col1 * colB;			// colR += col1 * colB
-					colB = Float4( p_rhs[i][2] );		// colB = { p_rhs[i][2], p_rhs[i][2], p_rhs[i][2], p_rhs[i][2] }
-					colR += col2 * colB;			// colR += col2 * colB
-					colB = Float4( p_rhs[i][3] );		// colB = { p_rhs[i][3], p_rhs[i][3], p_rhs[i][3], p_rhs[i][3] }
-					colR += col3 * colB;			// colR += col3 * colB
-					colR.toPtr( result[i].ptr() );
-				}
-
-				p_lhs = result;
+				Float4x4::invert( input.constPtr(), result.ptr() );
 			}
+		};
 
-#else
+		template< typename Type, uint32_t Count > struct SqrMtxOperators;
 
+		template<>
+		struct SqrMtxOperators< float, 4 >
+		{
 			static inline void mul( castor::SquareMatrix< float, 4 > & p_lhs, castor::SquareMatrix< float, 4 > const & p_rhs )
 			{
-				typedef typename Matrix4x4f::row_type row_type;
-				Point4f ptSrcA0( p_lhs[0][0], p_lhs[0][1], p_lhs[0][2], p_lhs[0][3] );
-				Point4f ptSrcA1( p_lhs[1][0], p_lhs[1][1], p_lhs[1][2], p_lhs[1][3] );
-				Point4f ptSrcA2( p_lhs[2][0], p_lhs[2][1], p_lhs[2][2], p_lhs[2][3] );
-				Point4f ptSrcA3( p_lhs[3][0], p_lhs[3][1], p_lhs[3][2], p_lhs[3][3] );
-				std::memcpy( p_lhs[0].ptr(), ( ptSrcA0 * p_rhs[0][0] + ptSrcA1 * p_rhs[0][1] + ptSrcA2 * p_rhs[0][2] + ptSrcA3 * p_rhs[0][3] ).constPtr(), Size );
-				std::memcpy( p_lhs[1].ptr(), ( ptSrcA0 * p_rhs[1][0] + ptSrcA1 * p_rhs[1][1] + ptSrcA2 * p_rhs[1][2] + ptSrcA3 * p_rhs[1][3] ).constPtr(), Size );
-				std::memcpy( p_lhs[2].ptr(), ( ptSrcA0 * p_rhs[2][0] + ptSrcA1 * p_rhs[2][1] + ptSrcA2 * p_rhs[2][2] + ptSrcA3 * p_rhs[2][3] ).constPtr(), Size );
-				std::memcpy( p_lhs[3].ptr(), ( ptSrcA0 * p_rhs[3][0] + ptSrcA1 * p_rhs[3][1] + ptSrcA2 * p_rhs[3][2] + ptSrcA3 * p_rhs[3][3] ).constPtr(), Size );
+				Float4x4::multiply( p_lhs.constPtr(), p_rhs.constPtr(), p_lhs.ptr() );
 			}
-
-#endif
 		};
 
 		template< typename Type >
@@ -0,0 +1,166 @@
+#include "MemoryAccounting.hpp"
+
+#include "Miscellaneous/StringUtils.hpp"
+
+#include <map>
+#include <mutex>
+
+namespace castor
+{
+	namespace
+	{
+		struct TagsRegistry
+		{
+			std::mutex mutex;
+			std::map< String, std::unique_ptr< MemoryTag > > tags;
+		};
+
+		TagsRegistry & doGetRegistry()
+		{
+			// Never destroyed: objects released during the static destruction still reference their tags.
+			static TagsRegistry * registry = new TagsRegistry;
+			return *registry;
+		}
+
+		std::string doEscape( String const & text )
+		{
+			std::string result;
+
+			for ( auto c : string::stringCast< char >( text ) )
+			{
+				if ( c == '"' || c == '\\' )
+				{
+					result += '\\';
+				}
+
+				result += c;
+			}
+
+			return result;
+		}
+	}
+
+	MemoryTag & MemoryAccounting::getTag( String const & name )
+	{
+		auto & registry = doGetRegistry();
+		std::lock_guard< std::mutex > lock{ registry.mutex };
+		auto & tag = registry.tags[name];
+
+		if ( !tag )
+		{
+			tag = std::make_unique< MemoryTag >( name );
+		}
+
+		return *tag;
+	}
+
+	MemoryReport MemoryAccounting::getReport()
+	{
+		auto & registry = doGetRegistry();
+		std::lock_guard< std::mutex > lock{ registry.mutex };
+		MemoryReport result;
+		result.reserve( registry.tags.size() );
+
+		for ( auto & tag : registry.tags )
+		{
+			result.push_back( { tag.first
+				, tag.second->getCpuBytes()
+				, tag.second->getGpuBytes()
+				, tag.second->getObjects()
+				, tag.second->getCpuPeak()
+				, tag.second->getGpuPeak()
+				, tag.second->getCpuBudget()
+				, tag.second->getGpuBudget() } );
+		}
+
+		return result;
+	}
+
+	void MemoryAccounting::setBudget( String const & name
+		, uint64_t cpuBytes
+		, uint64_t gpuBytes )
+	{
+		getTag( name ).setBudget( cpuBytes, gpuBytes );
+	}
+
+	void MemoryAccounting::resetPeaks()
+	{
+		auto & registry = doGetRegistry();
+		std::lock_guard< std::mutex > lock{ registry.mutex };
+
+		for ( auto & tag : registry.tags )
+		{
+			tag.second->resetPeaks();
+		}
+	}
+
+	uint32_t MemoryAccounting::readBudgets( std::istream & stream )
+	{
+		uint32_t result = 0u;
+		std::string line;
+
+		while ( std::getline( stream, line ) )
+		{
+			auto values = string::split( string::stringCast< xchar >( line ), cuT( "," ), 3u, false );
+
+			if ( values.size() == 3u
+				&& values[0].find( cuT( '#' ) ) != 0u )
+			{
+				setBudget( string::trim( values[0] )
+					, string::toULongLong( string::trim( values[1] ) )
+					, string::toULongLong( string::trim( values[2] ) ) );
+				++result;
+			}
+		}
+
+		return result;
+	}
+
+	void MemoryAccounting::writeCsvHeader( std::ostream & stream )
+	{
+		stream << "time_ms,subsystem,cpu_bytes,gpu_bytes,objects,cpu_peak,gpu_peak,cpu_budget,gpu_budget\n";
+	}
+
+	void MemoryAccounting::writeCsv( std::ostream & stream
+		, MemoryReport const & report
+		, Milliseconds const & time )
+	{
+		for ( auto & entry : report )
+		{
+			stream << time.count()
+				<< ",\"" << doEscape( entry.name ) << "\""
+				<< "," << entry.cpuBytes
+				<< "," << entry.gpuBytes
+				<< "," << entry.objects
+				<< "," << entry.cpuPeak
+				<< "," << entry.gpuPeak
+				<< "," << entry.cpuBudget
+				<< "," << entry.gpuBudget
+				<< "\n";
+		}
+	}
+
+	void MemoryAccounting::writeJson( std::ostream & stream
+		, MemoryReport const & report
+		, std::string const & indent )
+	{
+		stream << "[";
+
+		for ( auto it = report.begin(); it != report.end(); ++it )
+		{
+			stream << ( it == report.begin() ? "\n" : ",\n" );
+			stream << indent << "{ \"subsystem\": \"" << doEscape( it->name ) << "\""
+				<< ", \"cpuBytes\": " << it->cpuBytes
+				<< ", \"gpuBytes\": " << it->gpuBytes
+				<< ", \"objects\": " << it->objects
+				<< ", \"cpuPeak\": " << it->cpuPeak
+				<< ", \"gpuPeak\": " << it->gpuPeak
+				<< ", \"cpuBudget\": " << it->cpuBudget
+				<< ", \"gpuBudget\": " << it->gpuBudget
+				<< ", \"overBudget\": " << ( it->isOverBudget() ? "true" : "false" )
+				<< " }";
+		}
+
+		stream << "\n" << indent.substr( 0u, indent.empty() ? 0u : indent.size() - 1u ) << "]";
+	}
+}
@@ -0,0 +1,423 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CASTOR_MEMORY_ACCOUNTING_H___
+#define ___CASTOR_MEMORY_ACCOUNTING_H___
+
+#include "CastorUtilsPrerequisites.hpp"
+
+#include <atomic>
+
+namespace castor
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		19/01/2018
+	\~english
+	\brief		The memory counters of a subsystem.
+	\remarks	Maintained with relaxed atomics, so they can be updated from any thread.
+				<br />The budgets are checked against the peaks, 0 means no budget.
+	\~french
+	\brief		Les compteurs mémoire d'un sous-système.
+	\remarks	Maintenus via des atomiques relâchés, ils peuvent donc être mis à jour depuis n'importe quel thread.
+				<br />Les budgets sont vérifiés par rapport aux pics, 0 signifie pas de budget.
+	*/
+	class MemoryTag
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	name	The subsystem name.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	name	Le nom du sous-système.
+		 */
+		explicit MemoryTag( String const & name )
+			: m_name{ name }
+		{
+		}
+		/**
+		 *\~english
+		 *\brief		Updates the CPU bytes count.
+		 *\param[in]	delta	The bytes count variation.
+		 *\~french
+		 *\brief		Met à jour le nombre d'octets CPU.
+		 *\param[in]	delta	La variation du nombre d'octets.
+		 */
+		inline void addCpuBytes( int64_t delta )
+		{
+			doUpdatePeak( m_cpuPeak, m_cpuBytes.fetch_add( delta, std::memory_order_relaxed ) + delta );
+		}
+		/**
+		 *\~english
+		 *\brief		Updates the GPU bytes count.
+		 *\param[in]	delta	The bytes count variation.
+		 *\~french
+		 *\brief		Met à jour le nombre d'octets GPU.
+		 *\param[in]	delta	La variation du nombre d'octets.
+		 */
+		inline void addGpuBytes( int64_t delta )
+		{
+			doUpdatePeak( m_gpuPeak, m_gpuBytes.fetch_add( delta, std::memory_order_relaxed ) + delta );
+		}
+		/**
+		 *\~english
+		 *\brief		Updates the live objects count.
+		 *\param[in]	delta	The objects count variation.
+		 *\~french
+		 *\brief		Met à jour le nombre d'objets vivants.
+		 *\param[in]	delta	La variation du nombre d'objets.
+		 */
+		inline void addObjects( int64_t delta )
+		{
+			m_objects.fetch_add( delta, std::memory_order_relaxed );
+		}
+		/**
+		 *\~english
+		 *\brief		Sets the budgets.
+		 *\param[in]	cpuBytes, gpuBytes	The CPU and GPU budgets, 0 for none.
+		 *\~french
+		 *\brief		Définit les budgets.
+		 *\param[in]	cpuBytes, gpuBytes	Les budgets CPU et GPU, 0 pour aucun.
+		 */
+		inline void setBudget( uint64_t cpuBytes, uint64_t gpuBytes )
+		{
+			m_cpuBudget.store( cpuBytes, std::memory_order_relaxed );
+			m_gpuBudget.store( gpuBytes, std::memory_order_relaxed );
+		}
+		/**
+		 *\~english
+		 *\brief		Resets the peaks to the current values.
+		 *\~french
+		 *\brief		Réinitialise les pics aux valeurs courantes.
+		 */
+		inline void resetPeaks()
+		{
+			m_cpuPeak.store( m_cpuBytes.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+			m_gpuPeak.store( m_gpuBytes.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+		}
+		/**
+		*name
+		*	Getters.
+		**/
+		/**@{*/
+		inline String const & getName()const
+		{
+			return m_name;
+		}
+
+		inline int64_t getCpuBytes()const
+		{
+			return m_cpuBytes.load( std::memory_order_relaxed );
+		}
+
+		inline int64_t getGpuBytes()const
+		{
+			return m_gpuBytes.load( std::memory_order_relaxed );
+		}
+
+		inline int64_t getObjects()const
+		{
+			return m_objects.load( std::memory_order_relaxed );
+		}
+
+		inline int64_t getCpuPeak()const
+		{
+			return m_cpuPeak.load( std::memory_order_relaxed );
+		}
+
+		inline int64_t getGpuPeak()const
+		{
+			return m_gpuPeak.load( std::memory_order_relaxed );
+		}
+
+		inline uint64_t getCpuBudget()const
+		{
+			return m_cpuBudget.load( std::memory_order_relaxed );
+		}
+
+		inline uint64_t getGpuBudget()const
+		{
+			return m_gpuBudget.load( std::memory_order_relaxed );
+		}
+		/**@}*/
+
+	private:
+		static inline void doUpdatePeak( std::atomic< int64_t > & peak, int64_t value )
+		{
+			auto current = peak.load( std::memory_order_relaxed );
+
+			while ( value > current
+				&& !peak.compare_exchange_weak( current, value, std::memory_order_relaxed ) )
+			{
+			}
+		}
+
+	private:
+		String const m_name;
+		std::atomic< int64_t > m_cpuBytes{ 0 };
+		std::atomic< int64_t > m_gpuBytes{ 0 };
+		std::atomic< int64_t > m_objects{ 0 };
+		std::atomic< int64_t > m_cpuPeak{ 0 };
+		std::atomic< int64_t > m_gpuPeak{ 0 };
+		std::atomic< uint64_t > m_cpuBudget{ 0u };
+		std::atomic< uint64_t > m_gpuBudget{ 0u };
+	};
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		19/01/2018
+	\~english
+	\brief		A snapshot of a subsystem's memory counters.
+	\~french
+	\brief		Un instantané des compteurs mémoire d'un sous-système.
+	*/
+	struct MemoryReportEntry
+	{
+		String name;
+		int64_t cpuBytes;
+		int64_t gpuBytes;
+		int64_t objects;
+		int64_t cpuPeak;
+		int64_t gpuPeak;
+		uint64_t cpuBudget;
+		uint64_t gpuBudget;
+
+		/**
+		 *\~english
+		 *\return		\p true if a peak exceeds its budget.
+		 *\~french
+		 *\return		\p true si un pic dépasse son budget.
+		 */
+		inline bool isOverBudget()const
+		{
+			return ( cpuBudget && uint64_t( std::max( int64_t( 0 ), cpuPeak ) ) > cpuBudget )
+				|| ( gpuBudget && uint64_t( std::max( int64_t( 0 ), gpuPeak ) ) > gpuBudget );
+		}
+	};
+	using MemoryReport = std::vector< MemoryReportEntry >;
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		19/01/2018
+	\~english
+	\brief		Engine wide memory accounting, by subsystem.
+	\remarks	The subsystems are identified by their name, their tag is created on first request and lives until the end of the program.
+				<br />The owners of big allocations account for them through a MemoryUsage member.
+	\~french
+	\brief		Comptabilité mémoire globale, par sous-système.
+	\remarks	Les sous-systèmes sont identifiés par leur nom, leur étiquette est créée à la première demande et vit jusqu'à la fin du programme.
+				<br />Les propriétaires de grosses allocations les comptabilisent via un membre MemoryUsage.
+	*/
+	class MemoryAccounting
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Retrieves a subsystem's tag, creating it if needed.
+		 *\remarks		Takes a lock, so the result should be kept.
+		 *\param[in]	name	The subsystem name.
+		 *\return		The tag.
+		 *\~french
+		 *\brief		Récupère l'étiquette d'un sous-système, en la créant si nécessaire.
+		 *\remarks		Prend un verrou, le résultat devrait donc être conservé.
+		 *\param[in]	name	Le nom du sous-système.
+		 *\return		L'étiquette.
+		 */
+		CU_API static MemoryTag & getTag( String const & name );
+		/**
+		 *\~english
+		 *\return		A snapshot of all the subsystems counters, sorted by name.
+		 *\~french
+		 *\return		Un instantané des compteurs de tous les sous-systèmes, triés par nom.
+		 */
+		CU_API static MemoryReport getReport();
+		/**
+		 *\~english
+		 *\brief		Sets a subsystem's budgets.
+		 *\param[in]	name				The subsystem name.
+		 *\param[in]	cpuBytes, gpuBytes	The CPU and GPU budgets, 0 for none.
+		 *\~french
+		 *\brief		Définit les budgets d'un sous-système.
+		 *\param[in]	name				Le nom du sous-système.
+		 *\param[in]	cpuBytes, gpuBytes	Les budgets CPU et GPU, 0 pour aucun.
+		 */
+		CU_API static void setBudget( String const & name
+			, uint64_t cpuBytes
+			, uint64_t gpuBytes );
+		/**
+		 *\~english
+		 *\brief		Resets all the subsystems peaks to their current values.
+		 *\~french
+		 *\brief		Réinitialise les pics de tous les sous-systèmes à leurs valeurs courantes.
+		 */
+		CU_API static void resetPeaks();
+		/**
+		 *\~english
+		 *\brief		Reads subsystems budgets, as CSV lines \p name,cpuBytes,gpuBytes.
+		 *\remarks		Empty lines and lines starting with '#' are ignored.
+		 *\param[in]	stream	The stream to read.
+		 *\return		The number of budgets read.
+		 *\~french
+		 *\brief		Lit des budgets de sous-systèmes, sous forme de lignes CSV \p nom,octetsCpu,octetsGpu.
+		 *\remarks		Les lignes vides et celles commençant par '#' sont ignorées.
+		 *\param[in]	stream	Le flux à lire.
+		 *\return		Le nombre de budgets lus.
+		 */
+		CU_API static uint32_t readBudgets( std::istream & stream );
+		/**
+		 *\~english
+		 *\brief		Writes the CSV header matching writeCsv.
+		 *\param[out]	stream	Receives the header.
+		 *\~french
+		 *\brief		Ecrit l'en-tête CSV correspondant à writeCsv.
+		 *\param[out]	stream	Reçoit l'en-tête.
+		 */
+		CU_API static void writeCsvHeader( std::ostream & stream );
+		/**
+		 *\~english
+		 *\brief		Writes a report as CSV lines, one per subsystem.
+		 *\param[out]	stream	Receives the lines.
+		 *\param[in]	report	The report.
+		 *\param[in]	time	The report time, written in the first column.
+		 *\~french
+		 *\brief		Ecrit un rapport sous forme de lignes CSV, une par sous-système.
+		 *\param[out]	stream	Reçoit les lignes.
+		 *\param[in]	report	Le rapport.
+		 *\param[in]	time	Le temps du rapport, écrit dans la première colonne.
+		 */
+		CU_API static void writeCsv( std::ostream & stream
+			, MemoryReport const & report
+			, Milliseconds const & time );
+		/**
+		 *\~english
+		 *\brief		Writes a report as a JSON array.
+		 *\param[out]	stream	Receives the JSON.
+		 *\param[in]	report	The report.
+		 *\param[in]	indent	The indentation of the array's elements.
+		 *\~french
+		 *\brief		Ecrit un rapport en tant que tableau JSON.
+		 *\param[out]	stream	Reçoit le JSON.
+		 *\param[in]	report	Le rapport.
+		 *\param[in]	indent	L'indentation des éléments du tableau.
+		 */
+		CU_API static void writeJson( std::ostream & stream
+			, MemoryReport const & report
+			, std::string const & indent = "\t" );
+	};
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		19/01/2018
+	\~english
+	\brief		Accounts for an object's memory, in its subsystem's tag.
+	\remarks	Counts one live object, and the sizes given by its owner, until its destruction.
+				<br />A copy accounts for the same sizes again, a move transfers them.
+	\~french
+	\brief		Comptabilise la mémoire d'un objet, dans l'étiquette de son sous-système.
+	\remarks	Compte un objet vivant, et les tailles données par son propriétaire, jusqu'à sa destruction.
+				<br />Une copie comptabilise à nouveau les mêmes tailles, un déplacement les transfère.
+	*/
+	class MemoryUsage
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	tag	The subsystem's tag.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	tag	L'étiquette du sous-système.
+		 */
+		explicit MemoryUsage( MemoryTag & tag )
+			: m_tag{ &tag }
+		{
+			m_tag->addObjects( 1 );
+		}
+
+		MemoryUsage( MemoryUsage const & rhs )
+			: MemoryUsage{ *rhs.m_tag }
+		{
+			setCpuSize( rhs.m_cpuSize );
+			setGpuSize( rhs.m_gpuSize );
+		}
+
+		MemoryUsage( MemoryUsage && rhs )
+			: m_tag{ rhs.m_tag }
+			, m_cpuSize{ rhs.m_cpuSize }
+			, m_gpuSize{ rhs.m_gpuSize }
+		{
+			m_tag->addObjects( 1 );
+			rhs.m_cpuSize = 0u;
+			rhs.m_gpuSize = 0u;
+		}
+
+		MemoryUsage & operator=( MemoryUsage const & rhs )
+		{
+			setCpuSize( rhs.m_cpuSize );
+			setGpuSize( rhs.m_gpuSize );
+			return *this;
+		}
+
+		MemoryUsage & operator=( MemoryUsage && rhs )
+		{
+			if ( this != &rhs )
+			{
+				setCpuSize( rhs.m_cpuSize );
+				setGpuSize( rhs.m_gpuSize );
+				rhs.setCpuSize( 0u );
+				rhs.setGpuSize( 0u );
+			}
+
+			return *this;
+		}
+
+		~MemoryUsage()
+		{
+			setCpuSize( 0u );
+			setGpuSize( 0u );
+			m_tag->addObjects( -1 );
+		}
+		/**
+		 *\~english
+		 *\brief		Sets the CPU memory owned by the object.
+		 *\param[in]	size	The size, in bytes.
+		 *\~french
+		 *\brief		Définit la mémoire CPU possédée par l'objet.
+		 *\param[in]	size	La taille, en octets.
+		 */
+		inline void setCpuSize( size_t size )
+		{
+			if ( size != m_cpuSize )
+			{
+				m_tag->addCpuBytes( int64_t( size ) - int64_t( m_cpuSize ) );
+				m_cpuSize = size;
+			}
+		}
+		/**
+		 *\~english
+		 *\brief		Sets the GPU memory owned by the object.
+		 *\param[in]	size	The size, in bytes.
+		 *\~french
+		 *\brief		Définit la mémoire GPU possédée par l'objet.
+		 *\param[in]	size	La taille, en octets.
+		 */
+		inline void setGpuSize( size_t size )
+		{
+			if ( size != m_gpuSize )
+			{
+				m_tag->addGpuBytes( int64_t( size ) - int64_t( m_gpuSize ) );
+				m_gpuSize = size;
+			}
+		}
+
+	private:
+		MemoryTag * m_tag;
+		size_t m_cpuSize{ 0u };
+		size_t m_gpuSize{ 0u };
+	};
+}
+
+#endif
@@ -0,0 +1,482 @@
+#include "Profiler.hpp"
+
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+
+namespace castor
+{
+	namespace
+	{
+		using Clock = std::chrono::steady_clock;
+		uint32_t constexpr GpuThread = 0u;
+
+		static_assert( ( Profiler::RingSize & ( Profiler::RingSize - 1u ) ) == 0u
+			, "The ring size must be a power of two" );
+
+		/**
+		 *\~english
+		 *\brief		Single producer, single consumer events ring.
+		 *\remarks		The producer is the owning thread, the consumer is the flushing thread (under the profiler lock).
+		 *\~french
+		 *\brief		Anneau d'évènements à un producteur et un consommateur.
+		 *\remarks		Le producteur est le thread propriétaire, le consommateur est le thread qui vide les tampons (sous le verrou du profileur).
+		 */
+		class ProfileRing
+		{
+		public:
+			explicit ProfileRing( uint32_t thread )
+				: m_thread{ thread }
+				, m_events( Profiler::RingSize )
+			{
+			}
+
+			void push( ProfileEvent const & event )
+			{
+				auto write = m_write.load( std::memory_order_relaxed );
+
+				if ( write - m_read.load( std::memory_order_acquire ) >= Profiler::RingSize )
+				{
+					m_dropped.fetch_add( 1u, std::memory_order_relaxed );
+				}
+				else
+				{
+					m_events[write & ( Profiler::RingSize - 1u )] = event;
+					m_write.store( write + 1u, std::memory_order_release );
+				}
+			}
+
+			template< typename FuncT >
+			void drain( FuncT function )
+			{
+				auto read = m_read.load( std::memory_order_relaxed );
+				auto write = m_write.load( std::memory_order_acquire );
+
+				for ( ; read != write; ++read )
+				{
+					function( m_events[read & ( Profiler::RingSize - 1u )] );
+				}
+
+				m_read.store( read, std::memory_order_release );
+			}
+
+			uint32_t getThread()const
+			{
+				return m_thread;
+			}
+
+			std::atomic< uint64_t > & getDropped()
+			{
+				return m_dropped;
+			}
+
+		private:
+			uint32_t const m_thread;
+			std::vector< ProfileEvent > m_events;
+			std::atomic< uint32_t > m_write{ 0u };
+			std::atomic< uint32_t > m_read{ 0u };
+			std::atomic< uint64_t > m_dropped{ 0u };
+		};
+
+		struct CapturedEvent
+		{
+			ProfileEvent event;
+			uint32_t thread;
+		};
+
+		struct ProfilerState
+		{
+			std::atomic< bool > capturing{ false };
+			std::atomic< int64_t > epoch{ 0 };
+			std::atomic< uint32_t > frameIndex{ 0u };
+			std::atomic< uint32_t > captureIndex{ 0u };
+			std::mutex mutex;
+			std::vector< std::unique_ptr< ProfileRing > > rings;
+			std::map< std::pair< std::string, std::string >, ProfileZone > zones;
+			std::vector< CapturedEvent > events;
+			std::ofstream stream;
+			uint32_t namedThreads{ 0u };
+			bool firstEvent{ true };
+		};
+
+		ProfilerState & doGetState()
+		{
+			static ProfilerState state;
+			return state;
+		}
+
+		thread_local ProfileRing * t_ring = nullptr;
+		thread_local uint32_t t_depth = 0u;
+
+		ProfileRing & doGetRing()
+		{
+			if ( !t_ring )
+			{
+				auto & state = doGetState();
+				std::lock_guard< std::mutex > lock{ state.mutex };
+				// The rings outlive their threads, the GPU track uses the first thread index.
+				state.rings.push_back( std::make_unique< ProfileRing >( uint32_t( state.rings.size() + 1u ) ) );
+				t_ring = state.rings.back().get();
+			}
+
+			return *t_ring;
+		}
+
+		void doEscape( std::ostream & stream, char const * text )
+		{
+			for ( auto it = text; it && *it; ++it )
+			{
+				if ( *it == '"' || *it == '\\' )
+				{
+					stream << '\\' << *it;
+				}
+				else if ( uint8_t( *it ) < 0x20u )
+				{
+					stream << ' ';
+				}
+				else
+				{
+					stream << *it;
+				}
+			}
+		}
+
+		void doWriteTime( std::ostream & stream, uint64_t time )
+		{
+			// Chrome trace times are in microseconds.
+			stream << ( time / 1000u ) << '.' << std::setw( 3 ) << std::setfill( '0' ) << ( time % 1000u ) << std::setfill( ' ' );
+		}
+
+		void doWriteThreadName( std::ostream & stream
+			, uint32_t thread
+			, bool first )
+		{
+			stream << ( first ? "" : ",\n" );
+			stream << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << thread
+				<< R"(,"args":{"name":")";
+
+			if ( thread == GpuThread )
+			{
+				stream << "GPU";
+			}
+			else
+			{
+				stream << "Thread " << thread;
+			}
+
+			stream << R"("}})";
+		}
+
+		void doWriteEvent( std::ostream & stream
+			, CapturedEvent const & captured
+			, bool first )
+		{
+			auto & event = captured.event;
+			stream << ( first ? "" : ",\n" );
+
+			if ( event.type == ProfileEventType::eFrame )
+			{
+				stream << R"({"name":"Frame","cat":"frame","ph":"i","s":"g","ts":)";
+				doWriteTime( stream, event.begin );
+				stream << R"(,"pid":1,"tid":)" << captured.thread
+					<< R"(,"args":{"frame":)" << event.value << "}}";
+			}
+			else
+			{
+				stream << R"({"name":")";
+				doEscape( stream, event.zone->name );
+				stream << R"(","cat":")";
+				doEscape( stream, event.zone->category );
+				stream << R"(","ph":"X","ts":)";
+				doWriteTime( stream, event.begin );
+				stream << R"(,"dur":)";
+				doWriteTime( stream, event.end - event.begin );
+				stream << R"(,"pid":1,"tid":)"
+					<< ( event.type == ProfileEventType::eGpu ? GpuThread : captured.thread )
+					<< "}";
+			}
+		}
+
+		void doPush( ProfileEvent const & event )
+		{
+			doGetRing().push( event );
+		}
+
+		void doFlush( ProfilerState & state )
+		{
+			if ( state.stream.is_open() )
+			{
+				for ( ; state.namedThreads <= state.rings.size(); ++state.namedThreads )
+				{
+					doWriteThreadName( state.stream, state.namedThreads, state.firstEvent );
+					state.firstEvent = false;
+				}
+			}
+
+			for ( auto & ring : state.rings )
+			{
+				ring->drain( [&state, &ring]( ProfileEvent const & event )
+					{
+						// Zones opened before the capture start have an invalid begin time.
+						if ( event.begin > event.end )
+						{
+							return;
+						}
+
+						CapturedEvent captured{ event, ring->getThread() };
+
+						if ( state.stream.is_open() )
+						{
+							doWriteEvent( state.stream, captured, state.firstEvent );
+							state.firstEvent = false;
+						}
+						else
+						{
+							state.events.push_back( captured );
+						}
+					} );
+			}
+
+			if ( state.stream.is_open() )
+			{
+				state.stream.flush();
+			}
+		}
+
+		void doStart( ProfilerState & state )
+		{
+			state.capturing = false;
+
+			for ( auto & ring : state.rings )
+			{
+				ring->drain( []( ProfileEvent const & )
+					{
+					} );
+				ring->getDropped() = 0u;
+			}
+
+			state.events.clear();
+			state.namedThreads = 0u;
+			state.firstEvent = true;
+			state.frameIndex = 0u;
+			state.epoch = std::chrono::duration_cast< Nanoseconds >( Clock::now().time_since_epoch() ).count();
+			++state.captureIndex;
+			state.capturing = true;
+		}
+	}
+
+	//*************************************************************************************************
+
+	void Profiler::start()
+	{
+		auto & state = doGetState();
+		std::lock_guard< std::mutex > lock{ state.mutex };
+
+		if ( state.stream.is_open() )
+		{
+			state.stream << "\n]\n";
+			state.stream.close();
+		}
+
+		doStart( state );
+	}
+
+	bool Profiler::start( Path const & file )
+	{
+		auto & state = doGetState();
+		std::lock_guard< std::mutex > lock{ state.mutex };
+
+		if ( state.stream.is_open() )
+		{
+			state.stream << "\n]\n";
+			state.stream.close();
+		}
+
+		state.stream.open( string::stringCast< char >( file ), std::ios::out | std::ios::trunc );
+
+		if ( !state.stream.is_open() )
+		{
+			state.capturing = false;
+			return false;
+		}
+
+		// JSON array format: the closing bracket is optional, so an interrupted capture stays loadable.
+		state.stream << "[\n";
+		doStart( state );
+		return true;
+	}
+
+	void Profiler::stop()
+	{
+		auto & state = doGetState();
+		std::lock_guard< std::mutex > lock{ state.mutex };
+		state.capturing = false;
+		doFlush( state );
+
+		if ( state.stream.is_open() )
+		{
+			state.stream << "\n]\n";
+			state.stream.close();
+		}
+	}
+
+	bool Profiler::isCapturing()
+	{
+		return doGetState().capturing.load( std::memory_order_relaxed );
+	}
+
+	uint32_t Profiler::getCaptureIndex()
+	{
+		return doGetState().captureIndex.load( std::memory_order_relaxed );
+	}
+
+	void Profiler::flush()
+	{
+		auto & state = doGetState();
+		std::lock_guard< std::mutex > lock{ state.mutex };
+		doFlush( state );
+	}
+
+	void Profiler::markFrame()
+	{
+		auto & state = doGetState();
+
+		if ( state.capturing.load( std::memory_order_relaxed ) )
+		{
+			auto time = getTimestamp();
+			doPush( { nullptr, time, time, state.frameIndex++, ProfileEventType::eFrame } );
+			flush();
+		}
+	}
+
+	uint64_t Profiler::getTimestamp()
+	{
+		auto now = std::chrono::duration_cast< Nanoseconds >( Clock::now().time_since_epoch() ).count();
+		return uint64_t( std::max( int64_t( 0 ), now - doGetState().epoch.load( std::memory_order_relaxed ) ) );
+	}
+
+	ProfileZone const & Profiler::intern( std::string const & name
+		, std::string const & category )
+	{
+		auto & state = doGetState();
+		std::lock_guard< std::mutex > lock{ state.mutex };
+		auto it = state.zones.emplace( std::make_pair( name, category ), ProfileZone{} ).first;
+
+		if ( !it->second.name )
+		{
+			// The map nodes don't move, so the key strings can be referenced.
+			it->second = ProfileZone{ it->first.first.c_str(), it->first.second.c_str(), "", 0u };
+		}
+
+		return it->second;
+	}
+
+	void Profiler::recordCpuSpan( ProfileZone const & zone
+		, uint64_t begin
+		, uint64_t end )
+	{
+		if ( isCapturing() )
+		{
+			doPush( { &zone, begin, end, t_depth, ProfileEventType::eCpu } );
+		}
+	}
+
+	void Profiler::recordGpuSpan( ProfileZone const & zone
+		, uint64_t begin
+		, Nanoseconds duration )
+	{
+		if ( isCapturing() )
+		{
+			doPush( { &zone, begin, begin + uint64_t( duration.count() ), 0u, ProfileEventType::eGpu } );
+		}
+	}
+
+	void Profiler::writeChromeTrace( std::ostream & stream )
+	{
+		auto & state = doGetState();
+		std::lock_guard< std::mutex > lock{ state.mutex };
+		doFlush( state );
+		stream << "{\"traceEvents\":[\n";
+		bool first = true;
+
+		for ( uint32_t thread = 0u; thread <= state.rings.size(); ++thread )
+		{
+			doWriteThreadName( stream, thread, first );
+			first = false;
+		}
+
+		for ( auto & captured : state.events )
+		{
+			doWriteEvent( stream, captured, false );
+		}
+
+		stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+	}
+
+	bool Profiler::writeChromeTrace( Path const & file )
+	{
+		std::ofstream stream{ string::stringCast< char >( file ), std::ios::out | std::ios::trunc };
+
+		if ( stream.is_open() )
+		{
+			writeChromeTrace( stream );
+		}
+
+		return stream.is_open() && stream.good();
+	}
+
+	std::vector< ProfileEvent > Profiler::getEvents()
+	{
+		auto & state = doGetState();
+		std::lock_guard< std::mutex > lock{ state.mutex };
+		std::vector< ProfileEvent > result;
+		result.reserve( state.events.size() );
+
+		for ( auto & captured : state.events )
+		{
+			result.push_back( captured.event );
+		}
+
+		return result;
+	}
+
+	uint64_t Profiler::getDroppedCount()
+	{
+		auto & state = doGetState();
+		std::lock_guard< std::mutex > lock{ state.mutex };
+		uint64_t result = 0u;
+
+		for ( auto & ring : state.rings )
+		{
+			result += ring->getDropped().load( std::memory_order_relaxed );
+		}
+
+		return result;
+	}
+
+	//*************************************************************************************************
+
+	ProfileScope::ProfileScope( ProfileZone const & zone )
+		: m_zone{ nullptr }
+		, m_begin{ 0u }
+	{
+		if ( Profiler::isCapturing() )
+		{
+			m_zone = &zone;
+			++t_depth;
+			m_begin = Profiler::getTimestamp();
+		}
+	}
+
+	ProfileScope::~ProfileScope()
+	{
+		if ( m_zone )
+		{
+			auto end = Profiler::getTimestamp();
+			--t_depth;
+			doPush( { m_zone, m_begin, end, t_depth, ProfileEventType::eCpu } );
+		}
+	}
+}
@@ -0,0 +1,333 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CASTOR_PROFILER_H___
+#define ___CASTOR_PROFILER_H___
+
+#include "CastorUtilsPrerequisites.hpp"
+
+#include "Data/Path.hpp"
+
+namespace castor
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		18/01/2018
+	\~english
+	\brief		A profiled zone description.
+	\remarks	Created once per call site by CASTOR_PROFILE_ZONE, or through Profiler::intern for names computed at runtime.
+				<br />The events only reference it, so recording an event doesn't allocate.
+	\~french
+	\brief		La description d'une zone profilée.
+	\remarks	Créée une fois par site d'appel par CASTOR_PROFILE_ZONE, ou via Profiler::intern pour les noms calculés à l'exécution.
+				<br />Les évènements ne font que la référencer, l'enregistrement d'un évènement n'alloue donc pas de mémoire.
+	*/
+	struct ProfileZone
+	{
+		//!\~english	The zone name.
+		//!\~french		Le nom de la zone.
+		char const * name;
+		//!\~english	The zone category.
+		//!\~french		La catégorie de la zone.
+		char const * category;
+		//!\~english	The source file.
+		//!\~french		Le fichier source.
+		char const * file;
+		//!\~english	The source line.
+		//!\~french		La ligne dans le fichier source.
+		uint32_t line;
+	};
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		18/01/2018
+	\~english
+	\brief		The profiler events types.
+	\~french
+	\brief		Les types d'évènements du profileur.
+	*/
+	enum class ProfileEventType
+		: uint32_t
+	{
+		//!\~english	A CPU zone.
+		//!\~french		Une zone CPU.
+		eCpu,
+		//!\~english	A GPU span.
+		//!\~french		Un intervalle GPU.
+		eGpu,
+		//!\~english	A frame marker.
+		//!\~french		Un marqueur de frame.
+		eFrame,
+		CASTOR_SCOPED_ENUM_BOUNDS( eCpu )
+	};
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		18/01/2018
+	\~english
+	\brief		A recorded profiler event.
+	\remarks	The times are given in nanoseconds, since the capture start.
+	\~french
+	\brief		Un évènement enregistré par le profileur.
+	\remarks	Les temps sont donnés en nanosecondes, depuis le début de la capture.
+	*/
+	struct ProfileEvent
+	{
+		//!\~english	The zone (nullptr for frame markers).
+		//!\~french		La zone (nullptr pour les marqueurs de frame).
+		ProfileZone const * zone;
+		//!\~english	The begin time.
+		//!\~french		Le temps de début.
+		uint64_t begin;
+		//!\~english	The end time.
+		//!\~french		Le temps de fin.
+		uint64_t end;
+		//!\~english	The nesting depth for CPU zones, the frame index for frame markers.
+		//!\~french		La profondeur d'imbrication pour les zones CPU, l'indice de la frame pour les marqueurs de frame.
+		uint32_t value;
+		//!\~english	The event type.
+		//!\~french		Le type d'évènement.
+		ProfileEventType type;
+	};
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		18/01/2018
+	\~english
+	\brief		Hierarchical frame profiler.
+	\remarks	Each thread records its events into its own fixed size ring buffer, without lock nor allocation.
+				<br />The rings are drained by flush (and by markFrame), either into memory, to be written later as a Chrome trace,
+				or directly into a streamed Chrome trace file.
+				<br />When no capture is running, a zone costs a function call and an atomic load.
+				<br />The resulting JSON can be opened in chrome://tracing or ui.perfetto.dev.
+	\~french
+	\brief		Profileur hiérarchique de frames.
+	\remarks	Chaque thread enregistre ses évènements dans son propre tampon circulaire de taille fixe, sans verrou ni allocation.
+				<br />Les tampons sont vidés par flush (et par markFrame), soit en mémoire, pour être écrits plus tard en tant que trace Chrome,
+				soit directement dans un fichier de trace Chrome en flux.
+				<br />Lorsqu'aucune capture n'est en cours, une zone coûte un appel de fonction et une lecture atomique.
+				<br />Le JSON résultant peut être ouvert dans chrome://tracing ou ui.perfetto.dev.
+	*/
+	class Profiler
+	{
+	public:
+		//!\~english	The events count of each thread's ring buffer.
+		//!\~french		Le nombre d'évènements du tampon circulaire de chaque thread.
+		static uint32_t constexpr RingSize = 16384u;
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Starts an in memory capture, the previous capture's events are discarded.
+		 *\~french
+		 *\brief		Démarre une capture en mémoire, les évènements de la capture précédente sont supprimés.
+		 */
+		CU_API static void start();
+		/**
+		 *\~english
+		 *\brief		Starts a capture streamed into a Chrome trace file.
+		 *\remarks		The file is kept loadable even if the capture is not stopped (JSON array format).
+		 *\param[in]	file	The file path.
+		 *\return		\p false if the file couldn't be opened.
+		 *\~french
+		 *\brief		Démarre une capture écrite en flux dans un fichier de trace Chrome.
+		 *\remarks		Le fichier reste lisible même si la capture n'est pas arrêtée (format tableau JSON).
+		 *\param[in]	file	Le chemin du fichier.
+		 *\return		\p false si le fichier n'a pas pu être ouvert.
+		 */
+		CU_API static bool start( Path const & file );
+		/**
+		 *\~english
+		 *\brief		Stops the capture, flushing the pending events.
+		 *\~french
+		 *\brief		Arrête la capture, en vidant les évènements en attente.
+		 */
+		CU_API static void stop();
+		/**
+		 *\~english
+		 *\return		\p true if a capture is running.
+		 *\~french
+		 *\return		\p true si une capture est en cours.
+		 */
+		CU_API static bool isCapturing();
+		/**
+		 *\~english
+		 *\return		The index of the last started capture, 0 if none was started.
+		 *\remarks		Timestamps taken during a capture are only meaningful while this index is unchanged, since each start resets the time origin.
+		 *\~french
+		 *\return		L'indice de la dernière capture démarrée, 0 si aucune ne l'a été.
+		 *\remarks		Les horodatages pris pendant une capture n'ont de sens que tant que cet indice ne change pas, chaque démarrage réinitialisant l'origine des temps.
+		 */
+		CU_API static uint32_t getCaptureIndex();
+		/**
+		 *\~english
+		 *\brief		Drains the threads ring buffers into the capture.
+		 *\~french
+		 *\brief		Vide les tampons circulaires des threads dans la capture.
+		 */
+		CU_API static void flush();
+		/**
+		 *\~english
+		 *\brief		Records a frame marker, and flushes the capture.
+		 *\~french
+		 *\brief		Enregistre un marqueur de frame, et vide les tampons dans la capture.
+		 */
+		CU_API static void markFrame();
+		/**
+		 *\~english
+		 *\return		The current time, in nanoseconds since the capture start.
+		 *\~french
+		 *\return		Le temps courant, en nanosecondes depuis le début de la capture.
+		 */
+		CU_API static uint64_t getTimestamp();
+		/**
+		 *\~english
+		 *\brief		Retrieves a zone for a name computed at runtime.
+		 *\remarks		The zone lives until the end of the program, so call it once and keep the result.
+		 *\param[in]	name		The zone name.
+		 *\param[in]	category	The zone category.
+		 *\return		The zone, the same one for a given name and category.
+		 *\~french
+		 *\brief		Récupère une zone pour un nom calculé à l'exécution.
+		 *\remarks		La zone vit jusqu'à la fin du programme, appelez donc cette fonction une fois et gardez le résultat.
+		 *\param[in]	name		Le nom de la zone.
+		 *\param[in]	category	La catégorie de la zone.
+		 *\return		La zone, la même pour un nom et une catégorie donnés.
+		 */
+		CU_API static ProfileZone const & intern( std::string const & name
+			, std::string const & category );
+		/**
+		 *\~english
+		 *\brief		Records a CPU zone measured by the caller.
+		 *\param[in]	zone		The zone.
+		 *\param[in]	begin, end	The zone times, from getTimestamp.
+		 *\~french
+		 *\brief		Enregistre une zone CPU mesurée par l'appelant.
+		 *\param[in]	zone		La zone.
+		 *\param[in]	begin, end	Les temps de la zone, venant de getTimestamp.
+		 */
+		CU_API static void recordCpuSpan( ProfileZone const & zone
+			, uint64_t begin
+			, uint64_t end );
+		/**
+		 *\~english
+		 *\brief		Records a GPU span.
+		 *\param[in]	zone		The zone.
+		 *\param[in]	begin		The span start, from getTimestamp.
+		 *\param[in]	duration	The span duration.
+		 *\~french
+		 *\brief		Enregistre un intervalle GPU.
+		 *\param[in]	zone		La zone.
+		 *\param[in]	begin		Le début de l'intervalle, venant de getTimestamp.
+		 *\param[in]	duration	La durée de l'intervalle.
+		 */
+		CU_API static void recordGpuSpan( ProfileZone const & zone
+			, uint64_t begin
+			, Nanoseconds duration );
+		/**
+		 *\~english
+		 *\brief		Writes the in memory capture's events as a Chrome trace.
+		 *\remarks		Flushes the threads ring buffers first.
+		 *\param[out]	stream	Receives the JSON.
+		 *\~french
+		 *\brief		Ecrit les évènements de la capture en mémoire en tant que trace Chrome.
+		 *\remarks		Vide d'abord les tampons circulaires des threads.
+		 *\param[out]	stream	Reçoit le JSON.
+		 */
+		CU_API static void writeChromeTrace( std::ostream & stream );
+		/**
+		 *\~english
+		 *\brief		Writes the in memory capture's events as a Chrome trace file.
+		 *\param[in]	file	The file path.
+		 *\return		\p false if the file couldn't be written.
+		 *\~french
+		 *\brief		Ecrit les évènements de la capture en mémoire dans un fichier de trace Chrome.
+		 *\param[in]	file	Le chemin du fichier.
+		 *\return		\p false si le fichier n'a pas pu être écrit.
+		 */
+		CU_API static bool writeChromeTrace( Path const & file );
+		/**
+		 *\~english
+		 *\return		The in memory capture's events, after a flush.
+		 *\~french
+		 *\return		Les évènements de la capture en mémoire, après un vidage.
+		 */
+		CU_API static std::vector< ProfileEvent > getEvents();
+		/**
+		 *\~english
+		 *\return		The events count lost because a ring buffer was full, since the capture start.
+		 *\~french
+		 *\return		Le nombre d'évènements perdus parce qu'un tampon circulaire était plein, depuis le début de la capture.
+		 */
+		CU_API static uint64_t getDroppedCount();
+	};
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		18/01/2018
+	\~english
+	\brief		Records a CPU zone for its lifetime.
+	\remarks	Use it through CASTOR_PROFILE_ZONE.
+	\~french
+	\brief		Enregistre une zone CPU pendant sa durée de vie.
+	\remarks	Utilisez la via CASTOR_PROFILE_ZONE.
+	*/
+	class ProfileScope
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor, opens the zone if a capture is running.
+		 *\param[in]	zone	The zone.
+		 *\~french
+		 *\brief		Constructeur, ouvre la zone si une capture est en cours.
+		 *\param[in]	zone	La zone.
+		 */
+		CU_API explicit ProfileScope( ProfileZone const & zone );
+		/**
+		 *\~english
+		 *\brief		Destructor, closes the zone.
+		 *\~french
+		 *\brief		Destructeur, ferme la zone.
+		 */
+		CU_API ~ProfileScope();
+
+	private:
+		ProfileScope( ProfileScope const & ) = delete;
+		ProfileScope & operator=( ProfileScope const & ) = delete;
+
+	private:
+		ProfileZone const * m_zone;
+		uint64_t m_begin;
+	};
+}
+
+#define CU_ProfileJoin2( a, b ) a##b
+#define CU_ProfileJoin( a, b ) CU_ProfileJoin2( a, b )
+
+#if CASTOR_USE_PROFILER
+//!\~english	Profiles the enclosing block, under the given name (a string literal) and category.
+//!\~french		Profile le bloc englobant, sous le nom (une chaîne littérale) et la catégorie donnés.
+#	define CASTOR_PROFILE_ZONE_CAT( name, cat )\
+	static castor::ProfileZone const CU_ProfileJoin( profileZone, __LINE__ ){ name, cat, __FILE__, uint32_t( __LINE__ ) };\
+	castor::ProfileScope CU_ProfileJoin( profileScope, __LINE__ ){ CU_ProfileJoin( profileZone, __LINE__ ) }
+//!\~english	Records a frame marker.
+//!\~french		Enregistre un marqueur de frame.
+#	define CASTOR_PROFILE_FRAME()\
+	castor::Profiler::markFrame()
+#else
+#	define CASTOR_PROFILE_ZONE_CAT( name, cat )
+#	define CASTOR_PROFILE_FRAME()
+#endif
+
+//!\~english	Profiles the enclosing block, under the given name (a string literal).
+//!\~french		Profile le bloc englobant, sous le nom donné (une chaîne littérale).
+#define CASTOR_PROFILE_ZONE( name )\
+	CASTOR_PROFILE_ZONE_CAT( name, "cpu" )
+//!\~english	Profiles the enclosing function (__FUNCTION__ is an empty string on some compilers, see Macros.hpp).
+//!\~french		Profile la fonction englobante (__FUNCTION__ est une chaîne vide sur certains compilateurs, cf. Macros.hpp).
+#define CASTOR_PROFILE_FUNCTION()\
+	CASTOR_PROFILE_ZONE_CAT( __func__, "cpu" )
+
+#endif
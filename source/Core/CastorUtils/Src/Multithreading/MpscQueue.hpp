@@ -0,0 +1,183 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_MPSC_QUEUE_H___
+#define ___CU_MPSC_QUEUE_H___
+
+#include "CastorUtilsPrerequisites.hpp"
+
+#include <atomic>
+#include <cassert>
+
+namespace castor
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\version	0.10.0
+	\date		20/01/2018
+	\~english
+	\brief		Bounded lock-free queue, with multiple producers and a single consumer.
+	\remarks	Each cell holds a sequence number telling whether it is free for the producers or ready for the consumer.
+				<br />When the queue is full, the push fails instead of blocking or allocating.
+	\~french
+	\brief		File bornée sans verrou, avec plusieurs producteurs et un seul consommateur.
+	\remarks	Chaque cellule contient un numéro de séquence indiquant si elle est libre pour les producteurs ou prête pour le consommateur.
+				<br />Quand la file est pleine, l'ajout échoue au lieu de bloquer ou d'allouer.
+	*/
+	template< typename T >
+	class MpscQueue
+	{
+	private:
+		struct Cell
+		{
+			std::atomic< size_t > sequence;
+			T value;
+		};
+
+	public:
+		MpscQueue( MpscQueue const & ) = delete;
+		MpscQueue & operator=( MpscQueue const & ) = delete;
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	capacity	The queue capacity, must be a power of two.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	capacity	La capacité de la file, doit être une puissance de deux.
+		 */
+		explicit MpscQueue( size_t capacity )
+			: m_cells{ new Cell[capacity] }
+			, m_mask{ capacity - 1u }
+		{
+			assert( capacity >= 2u && ( capacity & m_mask ) == 0u );
+
+			for ( size_t i = 0u; i < capacity; ++i )
+			{
+				m_cells[i].sequence.store( i, std::memory_order_relaxed );
+			}
+		}
+		/**
+		 *\~english
+		 *\brief		Adds a value to the queue, from any thread.
+		 *\param[in]	value	The value.
+		 *\return		\p false if the queue is full, in which case the value is left untouched.
+		 *\~french
+		 *\brief		Ajoute une valeur à la file, depuis n'importe quel thread.
+		 *\param[in]	value	La valeur.
+		 *\return		\p false si la file est pleine, auquel cas la valeur est laissée intacte.
+		 */
+		inline bool tryPush( T && value )
+		{
+			Cell * cell;
+			auto pos = m_enqueuePos.load( std::memory_order_relaxed );
+
+			while ( true )
+			{
+				cell = &m_cells[pos & m_mask];
+				auto sequence = cell->sequence.load( std::memory_order_acquire );
+				auto diff = intptr_t( sequence ) - intptr_t( pos );
+
+				if ( diff == 0 )
+				{
+					if ( m_enqueuePos.compare_exchange_weak( pos, pos + 1u, std::memory_order_relaxed ) )
+					{
+						break;
+					}
+				}
+				else if ( diff < 0 )
+				{
+					return false;
+				}
+				else
+				{
+					pos = m_enqueuePos.load( std::memory_order_relaxed );
+				}
+			}
+
+			cell->value = std::move( value );
+			cell->sequence.store( pos + 1u, std::memory_order_release );
+			return true;
+		}
+		/**
+		 *\~english
+		 *\brief		Removes the oldest value from the queue, from the consumer thread only.
+		 *\param[out]	value	Receives the value.
+		 *\return		\p false if the queue is empty.
+		 *\~french
+		 *\brief		Retire la plus ancienne valeur de la file, depuis le thread consommateur uniquement.
+		 *\param[out]	value	Reçoit la valeur.
+		 *\return		\p false si la file est vide.
+		 */
+		inline bool tryPop( T & value )
+		{
+			auto pos = m_dequeuePos.load( std::memory_order_relaxed );
+			auto & cell = m_cells[pos & m_mask];
+			auto sequence = cell.sequence.load( std::memory_order_acquire );
+
+			if ( intptr_t( sequence ) - intptr_t( pos + 1u ) < 0 )
+			{
+				return false;
+			}
+
+			value = std::move( cell.value );
+			cell.sequence.store( pos + m_mask + 1u, std::memory_order_release );
+			m_dequeuePos.store( pos + 1u, std::memory_order_relaxed );
+			return true;
+		}
+		/**
+		 *\~english
+		 *\return		An approximation of the number of values in the queue.
+		 *\~french
+		 *\return		Une approximation du nombre de valeurs dans la file.
+		 */
+		inline size_t size()const
+		{
+			auto enqueue = m_enqueuePos.load( std::memory_order_relaxed );
+			auto dequeue = m_dequeuePos.load( std::memory_order_relaxed );
+			return enqueue > dequeue
+				? enqueue - dequeue
+				: 0u;
+		}
+		/**
+		 *\~english
+		 *\return		The number of values pushed since the creation of the queue, including the ones still being written.
+		 *\~french
+		 *\return		Le nombre de valeurs ajoutées depuis la création de la file, y compris celles en cours d'écriture.
+		 */
+		inline size_t getPushed()const
+		{
+			return m_enqueuePos.load( std::memory_order_acquire );
+		}
+		/**
+		 *\~english
+		 *\return		The number of values removed since the creation of the queue.
+		 *\~french
+		 *\return		Le nombre de valeurs retirées depuis la création de la file.
+		 */
+		inline size_t getPopped()const
+		{
+			return m_dequeuePos.load( std::memory_order_acquire );
+		}
+		/**
+		 *\~english
+		 *\return		The queue capacity.
+		 *\~french
+		 *\return		La capacité de la file.
+		 */
+		inline size_t capacity()const
+		{
+			return m_mask + 1u;
+		}
+
+	private:
+		std::unique_ptr< Cell[] > m_cells;
+		size_t const m_mask;
+		// The padding keeps the producers and the consumer positions in separate cache lines.
+		char m_pad0[64];
+		std::atomic< size_t > m_enqueuePos{ 0u };
+		char m_pad1[64];
+		std::atomic< size_t > m_dequeuePos{ 0u };
+	};
+}
+
+#endif
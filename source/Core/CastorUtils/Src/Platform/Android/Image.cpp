@@ -146,11 +146,6 @@ namespace castor
 
 	//************************************************************************************************
 
-	Image & Image::resample( Size const & p_size )
-	{
-		return *this;
-	}
-
 	void Image::initialiseImageLib()
 	{
 	}
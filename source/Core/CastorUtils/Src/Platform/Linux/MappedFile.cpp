@@ -0,0 +1,63 @@
+#include "Config/PlatformConfig.hpp"
+
+#if defined( CASTOR_PLATFORM_LINUX )
+
+#include "Data/MappedFile.hpp"
+
+#include "Log/Logger.hpp"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace castor
+{
+	MappedFile::MappedFile( Path const & path )
+		: m_path{ path }
+	{
+		int file = open( string::stringCast< char >( path ).c_str(), O_RDONLY );
+
+		if ( file == -1 )
+		{
+			Logger::logError( StringStream() << cuT( "MappedFile - Couldn't open file " ) << path << cuT( ": " ) << string::stringCast< xchar >( strerror( errno ) ) );
+		}
+		else
+		{
+			struct stat infos;
+
+			if ( fstat( file, &infos ) == 0 && infos.st_size > 0 )
+			{
+				auto data = mmap( nullptr, size_t( infos.st_size ), PROT_READ, MAP_PRIVATE, file, 0 );
+
+				if ( data != MAP_FAILED )
+				{
+					m_data = reinterpret_cast< uint8_t const * >( data );
+					m_size = uint64_t( infos.st_size );
+				}
+				else
+				{
+					Logger::logError( StringStream() << cuT( "MappedFile - Couldn't map file " ) << path << cuT( ": " ) << string::stringCast< xchar >( strerror( errno ) ) );
+				}
+			}
+
+			m_file = file;
+		}
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if ( m_data )
+		{
+			munmap( const_cast< uint8_t * >( m_data ), size_t( m_size ) );
+		}
+
+		if ( m_file != -1 )
+		{
+			close( int( m_file ) );
+		}
+	}
+}
+
+#endif
@@ -207,6 +207,19 @@ namespace castor
 		return pathReturn;
 	}
 
+	Path File::getCurrentDirectory()
+	{
+		Path pathReturn;
+		char path[FILENAME_MAX];
+
+		if ( getCurrentDir( path, sizeof( path ) ) )
+		{
+			pathReturn = Path{ string::stringCast< xchar >( path ) };
+		}
+
+		return pathReturn;
+	}
+
 	bool File::directoryExists( Path const & p_path )
 	{
 		struct _stat status = { 0 };
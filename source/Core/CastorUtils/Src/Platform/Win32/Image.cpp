@@ -3,6 +3,7 @@
 #if defined( CASTOR_PLATFORM_WINDOWS )
 
 #include "Graphics/Image.hpp"
+#include "Data/VirtualFileSystem.hpp"
 #include "Data/Path.hpp"
 #include "Graphics/Rectangle.hpp"
 #include "Log/Logger.hpp"
@@ -105,7 +106,19 @@ namespace castor
 		p_image.m_buffer.reset();
 		PixelFormat ePF = PixelFormat::eR8G8B8;
 		int flags = BMP_DEFAULT;
-		FREE_IMAGE_FORMAT fiFormat = FreeImage_GetFileType( string::stringCast< char >( p_path ).c_str(), 0 );
+		// The images of a mounted archive can only be read through a handle.
+		Path diskPath;
+		bool const onDisk = VirtualFileSystem::isOnDisk( p_path )
+			&& VirtualFileSystem::resolve( p_path, diskPath );
+		BinaryFile file( p_path, uint32_t( File::OpenMode::eRead ) | uint32_t( File::OpenMode::eBinary ) );
+		FreeImageIO fiIo;
+		fiIo.read_proc = ReadProc;
+		fiIo.write_proc = nullptr;
+		fiIo.seek_proc = SeekProc;
+		fiIo.tell_proc = TellProc;
+		FREE_IMAGE_FORMAT fiFormat = onDisk
+			? FreeImage_GetFileType( string::stringCast< char >( diskPath ).c_str(), 0 )
+			: FreeImage_GetFileTypeFromHandle( &fiIo, fi_handle( &file ), 0 );
 
 		if ( fiFormat == FIF_UNKNOWN )
 		{
@@ -121,16 +134,16 @@ namespace castor
 			LOADER_ERROR( "Can't load image : unsupported image format" );
 		}
 
-		auto fiImage = FreeImage_Load( fiFormat, string::stringCast< char >( p_path ).c_str() );
+		FIBITMAP * fiImage = nullptr;
+
+		if ( onDisk )
+		{
+			fiImage = FreeImage_Load( fiFormat, string::stringCast< char >( diskPath ).c_str() );
+		}
 
 		if ( !fiImage )
 		{
-			BinaryFile file( p_path, uint32_t( File::OpenMode::eRead ) | uint32_t( File::OpenMode::eBinary ) );
-			FreeImageIO fiIo;
-			fiIo.read_proc = ReadProc;
-			fiIo.write_proc = nullptr;
-			fiIo.seek_proc = SeekProc;
-			fiIo.tell_proc = TellProc;
+			file.seek( 0 );
 			fiImage = FreeImage_LoadFromHandle( fiFormat, & fiIo, fi_handle( & file ), flags );
 
 			if ( !fiImage )
@@ -360,65 +373,6 @@ namespace castor
 
 	//************************************************************************************************
 
-	Image & Image::resample( Size const & p_size )
-	{
-		Size const & size = getDimensions();
-
-		if ( p_size != size )
-		{
-			FIBITMAP * fiImage = nullptr;
-			int32_t w = int32_t( size.getWidth() );
-			int32_t h = int32_t( size.getHeight() );
-			PixelFormat ePF = getPixelFormat();
-			uint32_t uiBpp = PF::getBytesPerPixel( ePF );
-
-			switch ( ePF )
-			{
-			case PixelFormat::eR8G8B8:
-				fiImage = FreeImage_AllocateT( FIT_BITMAP, w, h, 24 );
-				break;
-
-			case PixelFormat::eA8R8G8B8:
-				fiImage = FreeImage_AllocateT( FIT_BITMAP, w, h, 32 );
-				break;
-			}
-
-			if ( fiImage )
-			{
-#if FREEIMAGE_COLORORDER == FREEIMAGE_COLORORDER_BGR
-
-				SwapComponents( m_buffer->ptr(), m_buffer->format(), w, h );
-
-#endif
-				memcpy( FreeImage_GetBits( fiImage ), m_buffer->constPtr(), m_buffer->size() );
-				uint32_t width = p_size.getWidth();
-				uint32_t height = p_size.getHeight();
-				FREE_IMAGE_COLOR_TYPE type = FreeImage_GetColorType( fiImage );
-				FIBITMAP * pRescaled = FreeImage_Rescale( fiImage, width, height, FILTER_BICUBIC );
-
-				if ( pRescaled )
-				{
-					FreeImage_Unload( fiImage );
-					fiImage = pRescaled;
-					width = FreeImage_GetWidth( fiImage );
-					height = FreeImage_GetHeight( fiImage );
-					uint8_t * pixels = FreeImage_GetBits( fiImage );
-
-#if FREEIMAGE_COLORORDER == FREEIMAGE_COLORORDER_BGR
-
-					SwapComponents( pixels, m_buffer->format(), width, height );
-
-#endif
-					m_buffer = PxBufferBase::create( p_size, ePF, pixels, ePF );
-				}
-
-				FreeImage_Unload( fiImage );
-			}
-		}
-
-		return *this;
-	}
-
 	void Image::initialiseImageLib()
 	{
 		FreeImage_Initialise();
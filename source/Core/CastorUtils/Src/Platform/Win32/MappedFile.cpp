@@ -0,0 +1,76 @@
+#include "Config/PlatformConfig.hpp"
+
+#if defined( CASTOR_PLATFORM_WINDOWS )
+
+#include "Data/MappedFile.hpp"
+
+#include "Log/Logger.hpp"
+#include "Miscellaneous/Utils.hpp"
+
+#include <windows.h>
+
+namespace castor
+{
+	MappedFile::MappedFile( Path const & path )
+		: m_path{ path }
+	{
+		HANDLE file = ::CreateFile( path.c_str()
+			, GENERIC_READ
+			, FILE_SHARE_READ
+			, nullptr
+			, OPEN_EXISTING
+			, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN
+			, nullptr );
+
+		if ( file == INVALID_HANDLE_VALUE )
+		{
+			Logger::logError( StringStream() << cuT( "MappedFile - Couldn't open file " ) << path << cuT( ": " ) << System::getLastErrorText() );
+		}
+		else
+		{
+			LARGE_INTEGER size;
+
+			if ( ::GetFileSizeEx( file, &size ) && size.QuadPart > 0 )
+			{
+				HANDLE mapping = ::CreateFileMapping( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+
+				if ( mapping )
+				{
+					m_data = reinterpret_cast< uint8_t const * >( ::MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) );
+					m_mapping = intptr_t( mapping );
+				}
+
+				if ( m_data )
+				{
+					m_size = uint64_t( size.QuadPart );
+				}
+				else
+				{
+					Logger::logError( StringStream() << cuT( "MappedFile - Couldn't map file " ) << path << cuT( ": " ) << System::getLastErrorText() );
+				}
+			}
+
+			m_file = intptr_t( file );
+		}
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if ( m_data )
+		{
+			::UnmapViewOfFile( m_data );
+		}
+
+		if ( m_mapping )
+		{
+			::CloseHandle( HANDLE( m_mapping ) );
+		}
+
+		if ( m_file != -1 )
+		{
+			::CloseHandle( HANDLE( m_file ) );
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,172 @@
+#include "CastorUtilsBakedTextureTest.hpp"
+
+#include <Data/BinaryFile.hpp>
+#include <Graphics/BakedTexture.hpp>
+#include <Graphics/DxtCompression.hpp>
+#include <Graphics/PixelBufferBase.hpp>
+
+using namespace castor;
+
+namespace
+{
+	PxBufferBaseSPtr doGetGradient( uint32_t width, uint32_t height )
+	{
+		ByteArray pixels( width * height * 4u );
+		auto it = pixels.begin();
+
+		for ( uint32_t y = 0u; y < height; ++y )
+		{
+			for ( uint32_t x = 0u; x < width; ++x )
+			{
+				*it++ = uint8_t( x * 255u / std::max( 1u, width - 1u ) );
+				*it++ = uint8_t( y * 255u / std::max( 1u, height - 1u ) );
+				*it++ = uint8_t( 128u );
+				*it++ = uint8_t( ( x + y ) * 255u / std::max( 1u, width + height - 2u ) );
+			}
+		}
+
+		return PxBufferBase::create( Size{ width, height }
+			, PixelFormat::eA8R8G8B8
+			, pixels.data()
+			, PixelFormat::eA8R8G8B8 );
+	}
+
+	int doGetMaxError( uint8_t const * lhs, uint8_t const * rhs, size_t size, size_t first, size_t count )
+	{
+		int result = 0;
+
+		for ( size_t i = 0u; i < size; i += 4u )
+		{
+			for ( size_t c = first; c < first + count; ++c )
+			{
+				result = std::max( result, std::abs( int( lhs[i + c] ) - int( rhs[i + c] ) ) );
+			}
+		}
+
+		return result;
+	}
+}
+
+namespace Testing
+{
+	CastorUtilsBakedTextureTest::CastorUtilsBakedTextureTest()
+		:	TestCase( "CastorUtilsBakedTextureTest" )
+	{
+	}
+
+	CastorUtilsBakedTextureTest::~CastorUtilsBakedTextureTest()
+	{
+	}
+
+	void CastorUtilsBakedTextureTest::doRegisterTests()
+	{
+		doRegisterTest( "TestDxtRoundTrip", std::bind( &CastorUtilsBakedTextureTest::TestDxtRoundTrip, this ) );
+		doRegisterTest( "TestBakeUncompressed", std::bind( &CastorUtilsBakedTextureTest::TestBakeUncompressed, this ) );
+		doRegisterTest( "TestBakeCompressed", std::bind( &CastorUtilsBakedTextureTest::TestBakeCompressed, this ) );
+		doRegisterTest( "TestInvalidFile", std::bind( &CastorUtilsBakedTextureTest::TestInvalidFile, this ) );
+	}
+
+	void CastorUtilsBakedTextureTest::TestDxtRoundTrip()
+	{
+		// Odd dimensions, so that the last blocks are partial.
+		Size size{ 37u, 21u };
+		auto source = doGetGradient( size.getWidth(), size.getHeight() );
+
+		for ( auto format : { PixelFormat::eDXTC1, PixelFormat::eDXTC3, PixelFormat::eDXTC5 } )
+		{
+			ByteArray blocks( PF::getDxtSize( format, size ) );
+			ByteArray result( source->size() );
+			PF::compressDxt( format, size, source->constPtr(), blocks.data() );
+			PF::decompressDxt( format, size, blocks.data(), result.data() );
+			CT_CHECK( doGetMaxError( source->constPtr(), result.data(), result.size(), 0u, 3u ) <= 24 );
+
+			if ( format == PixelFormat::eDXTC1 )
+			{
+				CT_CHECK( doGetMaxError( source->constPtr(), result.data(), result.size(), 3u, 1u ) == 255 - source->constPtr()[3] );
+			}
+			else
+			{
+				CT_CHECK( doGetMaxError( source->constPtr(), result.data(), result.size(), 3u, 1u ) <= 17 );
+			}
+		}
+	}
+
+	void CastorUtilsBakedTextureTest::TestBakeUncompressed()
+	{
+		Path path{ cuT( "uncompressed." ) + BakedTexture::Extension };
+		auto source = doGetGradient( 16u, 4u );
+		BakedTexture::Options options;
+		options.m_format = PixelFormat::eA8R8G8B8;
+		CT_REQUIRE( BakedTexture::bake( *source, options, path ) );
+
+		{
+			BakedTexture baked{ path };
+			CT_CHECK( baked.getFormat() == PixelFormat::eA8R8G8B8 );
+			CT_CHECK( baked.isSrgb() );
+			// 16x4, 8x2, 4x1, 2x1, 1x1
+			CT_EQUAL( baked.getLevelsCount(), 5u );
+			CT_CHECK( baked.getDimensions() == source->dimensions() );
+			CT_CHECK( baked.getLevel( 2u ).m_dimensions == Size( 4u, 1u ) );
+			CT_CHECK( baked.getLevel( 4u ).m_dimensions == Size( 1u, 1u ) );
+			CT_EQUAL( baked.getLevel( 0u ).m_size, source->size() );
+			CT_CHECK( std::memcmp( baked.getLevel( 0u ).m_data, source->constPtr(), source->size() ) == 0 );
+			// Uniform components stay the same, whatever the filtering space.
+			CT_EQUAL( uint32_t( baked.getLevel( 4u ).m_data[2] ), 128u );
+		}
+
+		File::deleteFile( path );
+	}
+
+	void CastorUtilsBakedTextureTest::TestBakeCompressed()
+	{
+		Path path{ cuT( "compressed." ) + BakedTexture::Extension };
+		auto source = doGetGradient( 30u, 30u );
+		BakedTexture::Options options;
+		options.m_format = PixelFormat::eDXTC5;
+		options.m_srgb = false;
+		CT_REQUIRE( BakedTexture::bake( *source, options, path ) );
+
+		{
+			BakedTexture baked{ path };
+			CT_CHECK( baked.getFormat() == PixelFormat::eDXTC5 );
+			CT_CHECK( !baked.isSrgb() );
+			CT_EQUAL( baked.getLevelsCount(), 5u );
+
+			for ( uint32_t i = 0u; i < baked.getLevelsCount(); ++i )
+			{
+				auto & level = baked.getLevel( i );
+				CT_EQUAL( level.m_size, PF::getDxtSize( PixelFormat::eDXTC5, level.m_dimensions ) );
+				// Levels are aligned, to allow direct uploads.
+				CT_EQUAL( ( level.m_data - baked.getLevel( 0u ).m_data ) % 16, 0 );
+			}
+		}
+
+		File::deleteFile( path );
+	}
+
+	void CastorUtilsBakedTextureTest::TestInvalidFile()
+	{
+		Path path{ cuT( "invalid." ) + BakedTexture::Extension };
+		auto source = doGetGradient( 8u, 8u );
+		auto content = BakedTexture::bake( *source, BakedTexture::Options{} );
+
+		{
+			// Truncated level data.
+			BinaryFile file{ path, File::OpenMode::eWrite };
+			file.writeArray( content.data(), content.size() / 2u );
+		}
+
+		CT_CHECK_THROW( std::make_unique< BakedTexture >( path ) );
+
+		{
+			// Wrong magic.
+			content[0] = 'X';
+			BinaryFile file{ path, File::OpenMode::eWrite };
+			file.writeArray( content.data(), content.size() );
+		}
+
+		CT_CHECK_THROW( std::make_unique< BakedTexture >( path ) );
+		File::deleteFile( path );
+		CT_CHECK_THROW( std::make_unique< BakedTexture >( path ) );
+	}
+}
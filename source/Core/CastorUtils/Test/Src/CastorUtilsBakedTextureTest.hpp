@@ -0,0 +1,27 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_BAKED_TEXTURE_TEST_H___
+#define ___CUT_BAKED_TEXTURE_TEST_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsBakedTextureTest
+		:	public TestCase
+	{
+	public:
+		CastorUtilsBakedTextureTest();
+		virtual ~CastorUtilsBakedTextureTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void TestDxtRoundTrip();
+		void TestBakeUncompressed();
+		void TestBakeCompressed();
+		void TestInvalidFile();
+	};
+}
+
+#endif
@@ -0,0 +1,94 @@
+#include "CastorUtilsBenchStatisticsTest.hpp"
+
+#include <BenchManager.hpp>
+
+#include <sstream>
+
+namespace Testing
+{
+	namespace
+	{
+		BenchResult doMakeResult( std::string const & name
+			, double p50 )
+		{
+			BenchResult result{ "Case", name, 10u };
+			result.p50 = p50;
+			return result;
+		}
+	}
+
+	CastorUtilsBenchStatisticsTest::CastorUtilsBenchStatisticsTest()
+		: TestCase( "CastorUtilsBenchStatisticsTest" )
+	{
+	}
+
+	CastorUtilsBenchStatisticsTest::~CastorUtilsBenchStatisticsTest()
+	{
+	}
+
+	void CastorUtilsBenchStatisticsTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsBenchStatisticsTest::Statistics", std::bind( &CastorUtilsBenchStatisticsTest::Statistics, this ) );
+		doRegisterTest( "CastorUtilsBenchStatisticsTest::ResultsIO", std::bind( &CastorUtilsBenchStatisticsTest::ResultsIO, this ) );
+		doRegisterTest( "CastorUtilsBenchStatisticsTest::Baseline", std::bind( &CastorUtilsBenchStatisticsTest::Baseline, this ) );
+	}
+
+	void CastorUtilsBenchStatisticsTest::Statistics()
+	{
+		std::vector< std::chrono::nanoseconds > samples;
+
+		// 100 samples, from 100ms down to 1ms, to check they get sorted.
+		for ( int64_t i = 100; i > 0; --i )
+		{
+			samples.push_back( std::chrono::milliseconds{ i } );
+		}
+
+		auto result = computeBenchResult( "Case", "Bench", samples );
+		CT_EQUAL( result.iterations, 100u );
+		CT_EQUAL( result.total, 5050.0 );
+		CT_EQUAL( result.mean, 50.5 );
+		CT_EQUAL( result.min, 1.0 );
+		CT_EQUAL( result.max, 100.0 );
+		CT_EQUAL( result.p50, 50.0 );
+		CT_EQUAL( result.p95, 95.0 );
+		CT_EQUAL( result.p99, 99.0 );
+		CT_CHECK( std::abs( result.stddev - 28.866 ) < 0.001 );
+
+		auto single = computeBenchResult( "Case", "Single", { std::chrono::milliseconds{ 3 } } );
+		CT_EQUAL( single.p50, 3.0 );
+		CT_EQUAL( single.p99, 3.0 );
+		CT_EQUAL( single.stddev, 0.0 );
+	}
+
+	void CastorUtilsBenchStatisticsTest::ResultsIO()
+	{
+		std::vector< BenchResult > results;
+		results.push_back( doMakeResult( "Quoted \"bench\"", 1.5 ) );
+		results.push_back( doMakeResult( "Other", 0.25 ) );
+		results.back().p99 = 2.0;
+		std::stringstream stream;
+		BenchManager::writeResults( stream, results );
+		auto read = BenchManager::readResults( stream );
+		CT_REQUIRE( read.size() == 2u );
+		CT_EQUAL( read[0].caseName, "Case" );
+		CT_EQUAL( read[0].name, "Quoted \"bench\"" );
+		CT_EQUAL( read[0].iterations, 10u );
+		CT_EQUAL( read[0].p50, 1.5 );
+		CT_EQUAL( read[1].name, "Other" );
+		CT_EQUAL( read[1].p99, 2.0 );
+	}
+
+	void CastorUtilsBenchStatisticsTest::Baseline()
+	{
+		std::vector< BenchResult > baseline{ doMakeResult( "Stable", 1.0 )
+			, doMakeResult( "Slower", 1.0 )
+			, doMakeResult( "Faster", 1.0 ) };
+		std::vector< BenchResult > results{ doMakeResult( "Stable", 1.05 )
+			, doMakeResult( "Slower", 1.2 )
+			, doMakeResult( "Faster", 0.5 )
+			, doMakeResult( "New", 10.0 ) };
+		CT_EQUAL( BenchManager::compareResults( results, baseline, 10.0 ), 1u );
+		CT_EQUAL( BenchManager::compareResults( results, baseline, 25.0 ), 0u );
+		CT_EQUAL( BenchManager::compareResults( results, {}, 0.0 ), 0u );
+	}
+}
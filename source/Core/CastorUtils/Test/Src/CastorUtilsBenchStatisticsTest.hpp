@@ -0,0 +1,26 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_BenchStatisticsTest_H___
+#define ___CUT_BenchStatisticsTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsBenchStatisticsTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsBenchStatisticsTest();
+		virtual ~CastorUtilsBenchStatisticsTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Statistics();
+		void ResultsIO();
+		void Baseline();
+	};
+}
+
+#endif
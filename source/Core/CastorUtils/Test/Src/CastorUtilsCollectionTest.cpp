@@ -0,0 +1,169 @@
+#include "CastorUtilsCollectionTest.hpp"
+
+#include <Design/Collection.hpp>
+
+#include <thread>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		using IntCollection = Collection< int, String >;
+	}
+
+	CastorUtilsCollectionTest::CastorUtilsCollectionTest()
+		: TestCase( "CastorUtilsCollectionTest" )
+	{
+	}
+
+	CastorUtilsCollectionTest::~CastorUtilsCollectionTest()
+	{
+	}
+
+	void CastorUtilsCollectionTest::doRegisterTests()
+	{
+		doRegisterTest( "Insertion", std::bind( &CastorUtilsCollectionTest::Insertion, this ) );
+		doRegisterTest( "Erasure", std::bind( &CastorUtilsCollectionTest::Erasure, this ) );
+		doRegisterTest( "Handles", std::bind( &CastorUtilsCollectionTest::Handles, this ) );
+		doRegisterTest( "Snapshots", std::bind( &CastorUtilsCollectionTest::Snapshots, this ) );
+		doRegisterTest( "ConcurrentReaders", std::bind( &CastorUtilsCollectionTest::ConcurrentReaders, this ) );
+	}
+
+	void CastorUtilsCollectionTest::Insertion()
+	{
+		IntCollection collection;
+		CT_CHECK( collection.empty() );
+		CT_CHECK( collection.insert( cuT( "a" ), std::make_shared< int >( 1 ) ) );
+		CT_CHECK( collection.insert( cuT( "b" ), std::make_shared< int >( 2 ) ) );
+		CT_CHECK( !collection.insert( cuT( "a" ), std::make_shared< int >( 3 ) ) );
+		CT_EQUAL( collection.size(), size_t( 2u ) );
+		CT_CHECK( collection.has( cuT( "a" ) ) );
+		CT_CHECK( !collection.has( cuT( "c" ) ) );
+		CT_EQUAL( *collection.find( cuT( "a" ) ), 1 );
+		CT_EQUAL( *collection.find( cuT( "b" ) ), 2 );
+	}
+
+	void CastorUtilsCollectionTest::Erasure()
+	{
+		IntCollection collection;
+		collection.insert( cuT( "a" ), std::make_shared< int >( 1 ) );
+		collection.insert( cuT( "b" ), std::make_shared< int >( 2 ) );
+		collection.insert( cuT( "c" ), std::make_shared< int >( 3 ) );
+		auto element = collection.erase( cuT( "a" ) );
+		CT_CHECK( element != nullptr );
+		CT_EQUAL( *element, 1 );
+		CT_CHECK( collection.erase( cuT( "a" ) ) == nullptr );
+		CT_EQUAL( collection.size(), size_t( 2u ) );
+		CT_CHECK( !collection.has( cuT( "a" ) ) );
+		// The last element has been moved to the erased one's place, the index must follow.
+		CT_EQUAL( *collection.find( cuT( "b" ) ), 2 );
+		CT_EQUAL( *collection.find( cuT( "c" ) ), 3 );
+		int sum = 0;
+		collection.lock();
+
+		for ( auto & it : collection )
+		{
+			sum += *it.second;
+		}
+
+		collection.unlock();
+		CT_EQUAL( sum, 5 );
+		collection.clear();
+		CT_CHECK( collection.empty() );
+		CT_CHECK( collection.getSnapshot()->empty() );
+	}
+
+	void CastorUtilsCollectionTest::Handles()
+	{
+		IntCollection collection;
+		collection.insert( cuT( "a" ), std::make_shared< int >( 1 ) );
+		collection.insert( cuT( "b" ), std::make_shared< int >( 2 ) );
+		auto handleA = collection.getHandle( cuT( "a" ) );
+		auto handleB = collection.getHandle( cuT( "b" ) );
+		CT_CHECK( bool( handleA ) );
+		CT_CHECK( !collection.getHandle( cuT( "c" ) ) );
+		CT_EQUAL( *collection.find( handleA ), 1 );
+		CT_EQUAL( *collection.find( handleB ), 2 );
+		collection.erase( cuT( "a" ) );
+		CT_CHECK( collection.find( handleA ) == nullptr );
+		CT_EQUAL( *collection.find( handleB ), 2 );
+		// The freed slot is reused, the old handle must still be invalid.
+		collection.insert( cuT( "c" ), std::make_shared< int >( 3 ) );
+		auto handleC = collection.getHandle( cuT( "c" ) );
+		CT_EQUAL( handleC.index, handleA.index );
+		CT_CHECK( collection.find( handleA ) == nullptr );
+		CT_EQUAL( *collection.find( handleC ), 3 );
+		CT_EQUAL( *collection.getSnapshot()->find( handleC ), 3 );
+	}
+
+	void CastorUtilsCollectionTest::Snapshots()
+	{
+		IntCollection collection;
+		collection.insert( cuT( "a" ), std::make_shared< int >( 1 ) );
+		auto snapshot = collection.getSnapshot();
+		CT_EQUAL( snapshot->size(), size_t( 1u ) );
+		CT_CHECK( snapshot == collection.getSnapshot() );
+		collection.insert( cuT( "b" ), std::make_shared< int >( 2 ) );
+		auto element = collection.erase( cuT( "a" ) );
+		std::weak_ptr< int > weak = element;
+		element.reset();
+		// The previous snapshot is left untouched, and keeps its elements alive.
+		CT_EQUAL( snapshot->size(), size_t( 1u ) );
+		CT_EQUAL( *snapshot->find( cuT( "a" ) ), 1 );
+		CT_CHECK( snapshot->find( cuT( "b" ) ) == nullptr );
+		CT_CHECK( !weak.expired() );
+		auto current = collection.getSnapshot();
+		CT_EQUAL( current->size(), size_t( 1u ) );
+		CT_EQUAL( *current->find( cuT( "b" ) ), 2 );
+		CT_CHECK( current->find( cuT( "a" ) ) == nullptr );
+		snapshot.reset();
+		CT_CHECK( weak.expired() );
+	}
+
+	void CastorUtilsCollectionTest::ConcurrentReaders()
+	{
+		static int constexpr Count = 2000;
+		IntCollection collection;
+		std::atomic_bool done{ false };
+		std::thread writer{ [&collection, &done]()
+		{
+			for ( int i = 0; i < Count; ++i )
+			{
+				collection.insert( string::toString( i ), std::make_shared< int >( i ) );
+			}
+
+			done = true;
+		} };
+		bool consistent = true;
+		size_t previous = 0u;
+
+		while ( !done )
+		{
+			// Each snapshot holds a prefix of the insertions, and grows with time.
+			auto snapshot = collection.getSnapshot();
+			int index = 0;
+
+			for ( auto & it : *snapshot )
+			{
+				consistent &= *it.second == index
+					&& it.first == string::toString( index );
+				++index;
+			}
+
+			consistent &= snapshot->size() >= previous;
+			previous = snapshot->size();
+		}
+
+		writer.join();
+		CT_CHECK( consistent );
+		CT_EQUAL( collection.size(), size_t( Count ) );
+		CT_EQUAL( collection.getSnapshot()->size(), size_t( Count ) );
+
+		for ( int i = 0; i < Count; ++i )
+		{
+			CT_EQUAL( *collection.find( string::toString( i ) ), i );
+		}
+	}
+}
@@ -0,0 +1,28 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsCollectionTest___
+#define ___CUT_CastorUtilsCollectionTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsCollectionTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsCollectionTest();
+		virtual ~CastorUtilsCollectionTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Insertion();
+		void Erasure();
+		void Handles();
+		void Snapshots();
+		void ConcurrentReaders();
+	};
+}
+
+#endif
@@ -0,0 +1,191 @@
+#include "CastorUtilsFileParserTest.hpp"
+
+#include <FileParser/FileParser.hpp>
+#include <FileParser/FileParserContext.hpp>
+
+using namespace castor;
+
+namespace
+{
+	enum class Section
+		: uint32_t
+	{
+		eRoot = MAKE_SECTION_NAME( 'R', 'O', 'O', 'T' ),
+		eItem = MAKE_SECTION_NAME( 'I', 'T', 'E', 'M' ),
+	};
+
+	String const Content
+	{
+		cuT( "// A comment\n" )
+		cuT( "item \"first\"\n" )
+		cuT( "{\n" )
+		cuT( "	value 12\n" )
+		cuT( "	colour 0.5 0.25 1.0 /* inline comment */\n" )
+		cuT( "	unknown 3\n" )
+		cuT( "	value 99\n" )
+		cuT( "	item \"nested\" {\n" )
+		cuT( "		value 4\n" )
+		cuT( "		label some text\n" )
+		cuT( "	}\n" )
+		cuT( "	value\n" )
+		cuT( "}\n" )
+		cuT( "item \"second\"\n" )
+		cuT( "item \"third\"\n" )
+		cuT( "{\n" )
+		cuT( "	value 5 }\n" )
+	};
+
+	class TestParser
+		: public FileParser
+	{
+	public:
+		TestParser()
+			: FileParser{ uint32_t( Section::eRoot ) }
+		{
+		}
+
+		StringArray const & getLog()const
+		{
+			return m_log;
+		}
+
+	private:
+		void doInitialiseParser( Path const & path )override
+		{
+			if ( !m_context )
+			{
+				m_context = std::make_shared< FileParserContext >( path );
+			}
+
+			auto item = [this]( FileParser * parser, ParserParameterArray const & params )
+			{
+				String name;
+				m_log.push_back( cuT( "item " ) + params[0]->get( name ) );
+				parser->getContext()->m_sections.push_back( uint32_t( Section::eItem ) );
+				return true;
+			};
+			m_parsers.clear();
+			addParser( uint32_t( Section::eRoot ), cuT( "item" ), item, { makeParameter< ParameterType::eName >() } );
+			addParser( uint32_t( Section::eItem ), cuT( "item" ), item, { makeParameter< ParameterType::eName >() } );
+			addParser( uint32_t( Section::eItem ), cuT( "value" ), [this]( FileParser * parser, ParserParameterArray const & params )
+				{
+					int32_t value{ -1 };
+
+					if ( !params.empty() )
+					{
+						params[0]->get( value );
+					}
+
+					m_log.push_back( cuT( "value " ) + string::toString( value ) );
+					return false;
+				}, { makeParameter< ParameterType::eInt32 >() } );
+			addParser( uint32_t( Section::eItem ), cuT( "colour" ), [this]( FileParser * parser, ParserParameterArray const & params )
+				{
+					RgbColour value;
+					params[0]->get( value );
+					StringStream stream;
+					auto components = toRGBFloat( value );
+					stream << cuT( "colour " ) << components[0] << cuT( " " ) << components[1] << cuT( " " ) << components[2];
+					m_log.push_back( stream.str() );
+					return false;
+				}, { makeParameter< ParameterType::eRgbColour >() } );
+			addParser( uint32_t( Section::eItem ), cuT( "label" ), [this]( FileParser * parser, ParserParameterArray const & params )
+				{
+					String value;
+					m_log.push_back( cuT( "label " ) + params[0]->get( value ) );
+					return false;
+				}, { makeParameter< ParameterType::eText >() } );
+			addParser( uint32_t( Section::eItem ), cuT( "}" ), [this]( FileParser * parser, ParserParameterArray const & params )
+				{
+					m_log.push_back( cuT( "end" ) );
+					parser->getContext()->m_sections.pop_back();
+					return false;
+				} );
+		}
+
+		void doCleanupParser()override
+		{
+			m_context.reset();
+		}
+
+		bool doDelegateParser( String const & line )override
+		{
+			m_log.push_back( cuT( "delegate " ) + line );
+			return false;
+		}
+
+		bool doDiscardParser( String const & line )override
+		{
+			m_log.push_back( cuT( "discard " ) + line );
+			return false;
+		}
+
+		void doValidate()override
+		{
+			m_log.push_back( cuT( "validate" ) );
+		}
+
+		String doGetSectionName( uint32_t section )override
+		{
+			return section == uint32_t( Section::eItem )
+				? String{ cuT( "item" ) }
+				: String{};
+		}
+
+	private:
+		StringArray m_log;
+	};
+}
+
+namespace Testing
+{
+	CastorUtilsFileParserTest::CastorUtilsFileParserTest()
+		:	TestCase( "CastorUtilsFileParserTest" )
+	{
+	}
+
+	CastorUtilsFileParserTest::~CastorUtilsFileParserTest()
+	{
+	}
+
+	void CastorUtilsFileParserTest::doRegisterTests()
+	{
+		doRegisterTest( "RecordReplay", std::bind( &CastorUtilsFileParserTest::RecordReplay, this ) );
+		doRegisterTest( "ReplayMismatch", std::bind( &CastorUtilsFileParserTest::ReplayMismatch, this ) );
+	}
+
+	void CastorUtilsFileParserTest::RecordReplay()
+	{
+		TestParser source;
+		source.startRecording();
+		CT_CHECK( source.parseFile( Path{ cuT( "test.txt" ) }, Content ) );
+		auto script = source.stopRecording();
+		CT_EQUAL( source.getLog().size(), 14u );
+		CT_EQUAL( source.getLog()[3], String{ cuT( "discard unknown 3" ) } );
+		CT_EQUAL( script.directives.size(), 4u );
+
+		// The recording stops with stopRecording.
+		TestParser other;
+		CT_CHECK( other.parseFile( Path{ cuT( "test.txt" ) }, Content ) );
+		CT_CHECK( other.stopRecording().actions.empty() );
+
+		TestParser replayed;
+		CT_CHECK( replayed.replay( Path{ cuT( "test.txt" ) }, script ) );
+		CT_CHECK( replayed.getLog() == source.getLog() );
+		CT_CHECK( replayed.getLog() == other.getLog() );
+	}
+
+	void CastorUtilsFileParserTest::ReplayMismatch()
+	{
+		TestParser source;
+		source.startRecording();
+		CT_CHECK( source.parseFile( Path{ cuT( "test.txt" ) }, Content ) );
+		auto script = source.stopRecording();
+
+		// A directive invoked from another section than the recorded one stops the replay.
+		script.directives[1].section = uint32_t( Section::eRoot );
+		TestParser replayed;
+		CT_CHECK( !replayed.replay( Path{ cuT( "test.txt" ) }, script ) );
+		CT_CHECK( replayed.getLog().size() < source.getLog().size() );
+	}
+}
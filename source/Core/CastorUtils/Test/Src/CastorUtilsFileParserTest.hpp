@@ -0,0 +1,25 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_FILE_PARSER_TEST___
+#define ___CUT_FILE_PARSER_TEST___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsFileParserTest
+		:	public TestCase
+	{
+	public:
+		CastorUtilsFileParserTest();
+		virtual ~CastorUtilsFileParserTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void RecordReplay();
+		void ReplayMismatch();
+	};
+}
+
+#endif
@@ -0,0 +1,120 @@
+#include "CastorUtilsHandleRegistryTest.hpp"
+
+#include <Design/HandleRegistry.hpp>
+
+#include <thread>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		using IntRegistry = HandleRegistry< int >;
+	}
+
+	CastorUtilsHandleRegistryTest::CastorUtilsHandleRegistryTest()
+		: TestCase( "CastorUtilsHandleRegistryTest" )
+	{
+	}
+
+	CastorUtilsHandleRegistryTest::~CastorUtilsHandleRegistryTest()
+	{
+	}
+
+	void CastorUtilsHandleRegistryTest::doRegisterTests()
+	{
+		doRegisterTest( "Resolution", std::bind( &CastorUtilsHandleRegistryTest::Resolution, this ) );
+		doRegisterTest( "Removal", std::bind( &CastorUtilsHandleRegistryTest::Removal, this ) );
+		doRegisterTest( "ManyObjects", std::bind( &CastorUtilsHandleRegistryTest::ManyObjects, this ) );
+		doRegisterTest( "ConcurrentResolution", std::bind( &CastorUtilsHandleRegistryTest::ConcurrentResolution, this ) );
+	}
+
+	void CastorUtilsHandleRegistryTest::Resolution()
+	{
+		IntRegistry registry;
+		int a{ 1 };
+		int b{ 2 };
+		CT_CHECK( registry.resolve( IntRegistry::HandleType{} ) == nullptr );
+		auto handleA = registry.add( a );
+		auto handleB = registry.add( b );
+		CT_CHECK( bool( handleA ) );
+		CT_CHECK( handleA != handleB );
+		CT_EQUAL( registry.getCount(), 2u );
+		CT_CHECK( registry.resolve( handleA ) == &a );
+		CT_CHECK( registry.resolve( handleB ) == &b );
+	}
+
+	void CastorUtilsHandleRegistryTest::Removal()
+	{
+		IntRegistry registry;
+		int a{ 1 };
+		int b{ 2 };
+		auto handleA = registry.add( a );
+		registry.remove( handleA );
+		CT_EQUAL( registry.getCount(), 0u );
+		CT_CHECK( registry.resolve( handleA ) == nullptr );
+		// The slot is reused, the stale handle must not resolve to the new object.
+		auto handleB = registry.add( b );
+		CT_EQUAL( handleB.index, handleA.index );
+		CT_CHECK( handleB.generation != handleA.generation );
+		CT_CHECK( registry.resolve( handleA ) == nullptr );
+		CT_CHECK( registry.resolve( handleB ) == &b );
+		// Removing through the stale handle has no effect.
+		registry.remove( handleA );
+		CT_CHECK( registry.resolve( handleB ) == &b );
+		CT_EQUAL( registry.getCount(), 1u );
+	}
+
+	void CastorUtilsHandleRegistryTest::ManyObjects()
+	{
+		static uint32_t constexpr Count = IntRegistry::ChunkSize * 3u + 7u;
+		IntRegistry registry;
+		std::vector< int > objects( Count );
+		std::vector< IntRegistry::HandleType > handles;
+
+		for ( auto & object : objects )
+		{
+			handles.push_back( registry.add( object ) );
+		}
+
+		CT_EQUAL( registry.getCount(), Count );
+		bool resolved = true;
+
+		for ( uint32_t i = 0u; i < Count; ++i )
+		{
+			resolved &= registry.resolve( handles[i] ) == &objects[i];
+		}
+
+		CT_CHECK( resolved );
+	}
+
+	void CastorUtilsHandleRegistryTest::ConcurrentResolution()
+	{
+		static int constexpr Count = 2000;
+		IntRegistry registry;
+		int stable{ 0 };
+		auto stableHandle = registry.add( stable );
+		std::atomic_bool done{ false };
+		std::thread writer{ [&registry, &done]()
+		{
+			for ( int i = 0; i < Count; ++i )
+			{
+				int object{ i };
+				registry.remove( registry.add( object ) );
+			}
+
+			done = true;
+		} };
+		bool consistent = true;
+
+		while ( !done )
+		{
+			consistent &= registry.resolve( stableHandle ) == &stable;
+		}
+
+		writer.join();
+		CT_CHECK( consistent );
+		CT_EQUAL( registry.getCount(), 1u );
+	}
+}
@@ -0,0 +1,27 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsHandleRegistryTest___
+#define ___CUT_CastorUtilsHandleRegistryTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsHandleRegistryTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsHandleRegistryTest();
+		virtual ~CastorUtilsHandleRegistryTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Resolution();
+		void Removal();
+		void ManyObjects();
+		void ConcurrentResolution();
+	};
+}
+
+#endif
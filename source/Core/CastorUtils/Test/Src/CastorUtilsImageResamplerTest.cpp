@@ -0,0 +1,243 @@
+#include "CastorUtilsImageResamplerTest.hpp"
+
+#include <Graphics/ImageResampler.hpp>
+#include <Graphics/PixelBufferBase.hpp>
+
+#if defined( CASTOR_USE_FREEIMAGE )
+#	include <FreeImage.h>
+#endif
+
+using namespace castor;
+
+namespace
+{
+	PxBufferBaseSPtr doGetUniform( uint32_t width, uint32_t height, std::array< uint8_t, 4u > const & colour )
+	{
+		ByteArray pixels( width * height * 4u );
+
+		for ( auto it = pixels.begin(); it != pixels.end(); it += 4u )
+		{
+			std::copy( colour.begin(), colour.end(), it );
+		}
+
+		return PxBufferBase::create( Size{ width, height }
+			, PixelFormat::eA8R8G8B8
+			, pixels.data()
+			, PixelFormat::eA8R8G8B8 );
+	}
+
+	PxBufferBaseSPtr doGetNoise( uint32_t width, uint32_t height )
+	{
+		ByteArray pixels( width * height * 4u );
+		uint32_t seed = 0x12345678u;
+
+		for ( auto & pixel : pixels )
+		{
+			seed = seed * 1664525u + 1013904223u;
+			pixel = uint8_t( seed >> 24u );
+		}
+
+		return PxBufferBase::create( Size{ width, height }
+			, PixelFormat::eA8R8G8B8
+			, pixels.data()
+			, PixelFormat::eA8R8G8B8 );
+	}
+}
+
+namespace Testing
+{
+	CastorUtilsImageResamplerTest::CastorUtilsImageResamplerTest()
+		:	TestCase( "CastorUtilsImageResamplerTest" )
+	{
+	}
+
+	CastorUtilsImageResamplerTest::~CastorUtilsImageResamplerTest()
+	{
+	}
+
+	void CastorUtilsImageResamplerTest::doRegisterTests()
+	{
+		doRegisterTest( "TestMipmapsCount", std::bind( &CastorUtilsImageResamplerTest::TestMipmapsCount, this ) );
+		doRegisterTest( "TestUniformColour", std::bind( &CastorUtilsImageResamplerTest::TestUniformColour, this ) );
+		doRegisterTest( "TestBoxAverage", std::bind( &CastorUtilsImageResamplerTest::TestBoxAverage, this ) );
+		doRegisterTest( "TestFloatFormat", std::bind( &CastorUtilsImageResamplerTest::TestFloatFormat, this ) );
+		doRegisterTest( "TestThreadsCount", std::bind( &CastorUtilsImageResamplerTest::TestThreadsCount, this ) );
+	}
+
+	void CastorUtilsImageResamplerTest::TestMipmapsCount()
+	{
+		CT_EQUAL( ImageResampler::getMipmapsCount( Size{ 1u, 1u } ), 1u );
+		CT_EQUAL( ImageResampler::getMipmapsCount( Size{ 256u, 256u } ), 9u );
+		CT_EQUAL( ImageResampler::getMipmapsCount( Size{ 37u, 21u } ), 6u );
+		CT_CHECK( ImageResampler::isResamplable( PixelFormat::eA8R8G8B8 ) );
+		CT_CHECK( ImageResampler::isResamplable( PixelFormat::eRGBA16F ) );
+		CT_CHECK( !ImageResampler::isResamplable( PixelFormat::eDXTC5 ) );
+		CT_CHECK( !ImageResampler::isResamplable( PixelFormat::eD24S8 ) );
+	}
+
+	void CastorUtilsImageResamplerTest::TestUniformColour()
+	{
+		// Odd dimensions, so that the levels sizes are rounded down.
+		std::array< uint8_t, 4u > colour{ { 200u, 10u, 77u, 255u } };
+		auto source = doGetUniform( 37u, 21u, colour );
+		ImageResampler resampler{ 1u };
+
+		for ( auto filter : { ResampleFilter::eBox, ResampleFilter::eKaiser } )
+		{
+			for ( auto srgb : { false, true } )
+			{
+				auto levels = resampler.generateMipmaps( *source, ImageResampler::Options{ filter, srgb } );
+				CT_REQUIRE( levels.size() == 6u );
+				CT_CHECK( levels[1]->dimensions() == Size( 18u, 10u ) );
+				CT_CHECK( levels[5]->dimensions() == Size( 1u, 1u ) );
+
+				for ( auto & level : levels )
+				{
+					CT_CHECK( level->format() == PixelFormat::eA8R8G8B8 );
+					CT_CHECK( std::equal( colour.begin(), colour.end(), level->constPtr() ) );
+					CT_CHECK( std::equal( colour.begin(), colour.end(), level->constPtr() + level->size() - 4u ) );
+				}
+			}
+		}
+
+		auto upsampled = resampler.resample( *source, Size{ 100u, 50u }, ImageResampler::Options{} );
+		CT_CHECK( upsampled->dimensions() == Size( 100u, 50u ) );
+		CT_CHECK( std::equal( colour.begin(), colour.end(), upsampled->constPtr() + 4u * 1234u ) );
+	}
+
+	void CastorUtilsImageResamplerTest::TestBoxAverage()
+	{
+		uint8_t pixels[]
+		{
+			0u, 0u, 0u, 0u,
+			100u, 100u, 100u, 100u,
+			200u, 200u, 200u, 200u,
+			40u, 40u, 40u, 40u,
+		};
+		auto source = PxBufferBase::create( Size{ 2u, 2u }
+			, PixelFormat::eA8R8G8B8
+			, pixels
+			, PixelFormat::eA8R8G8B8 );
+		ImageResampler resampler{ 1u };
+		auto result = resampler.resample( *source, Size{ 1u, 1u }, ImageResampler::Options{ ResampleFilter::eBox, false } );
+
+		for ( uint32_t i = 0u; i < 4u; ++i )
+		{
+			CT_EQUAL( uint32_t( result->constPtr()[i] ), 85u );
+		}
+	}
+
+	void CastorUtilsImageResamplerTest::TestFloatFormat()
+	{
+		// Values above 1 must be kept by floating point formats.
+		float pixels[]{ 0.25f, 0.5f, 1.0f, 2.0f };
+		auto source = PxBufferBase::create( Size{ 4u, 1u }
+			, PixelFormat::eL32F
+			, reinterpret_cast< uint8_t const * >( pixels )
+			, PixelFormat::eL32F );
+		ImageResampler resampler{ 1u };
+		auto levels = resampler.generateMipmaps( *source, ImageResampler::Options{ ResampleFilter::eBox, false } );
+		CT_REQUIRE( levels.size() == 3u );
+		CT_EQUAL( reinterpret_cast< float const * >( levels[1]->constPtr() )[0], 0.375f );
+		CT_EQUAL( reinterpret_cast< float const * >( levels[1]->constPtr() )[1], 1.5f );
+		CT_EQUAL( reinterpret_cast< float const * >( levels[2]->constPtr() )[0], 0.9375f );
+	}
+
+	void CastorUtilsImageResamplerTest::TestThreadsCount()
+	{
+		// The rows split must not change the result.
+		auto source = doGetNoise( 123u, 77u );
+		ImageResampler single{ 1u };
+		ImageResampler multi{ 4u };
+		ImageResampler::Options options;
+		auto lhs = single.generateMipmaps( *source, options );
+		auto rhs = multi.generateMipmaps( *source, options );
+		CT_REQUIRE( lhs.size() == rhs.size() );
+
+		for ( size_t i = 0u; i < lhs.size(); ++i )
+		{
+			CT_REQUIRE( lhs[i]->size() == rhs[i]->size() );
+			CT_CHECK( std::memcmp( lhs[i]->constPtr(), rhs[i]->constPtr(), lhs[i]->size() ) == 0 );
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsImageResamplerBench::CastorUtilsImageResamplerBench()
+		: BenchCase( "CastorUtilsImageResamplerBench" )
+	{
+	}
+
+	CastorUtilsImageResamplerBench::~CastorUtilsImageResamplerBench()
+	{
+	}
+
+	void CastorUtilsImageResamplerBench::Execute()
+	{
+		Size size{ 3840u, 2160u };
+		Size half{ size.getWidth() / 2u, size.getHeight() / 2u };
+		auto source = doGetNoise( size.getWidth(), size.getHeight() );
+		ImageResampler single{ 1u };
+		ImageResampler multi{ 0u };
+		ImageResampler::Options box{ ResampleFilter::eBox, true };
+		ImageResampler::Options kaiser{ ResampleFilter::eKaiser, true };
+
+		doBench( "4K half box, 1 thread", [&]()
+			{
+				doNotOptimizeAway( single.resample( *source, half, box ) );
+			}, 10u );
+		doBench( "4K half Kaiser, 1 thread", [&]()
+			{
+				doNotOptimizeAway( single.resample( *source, half, kaiser ) );
+			}, 10u );
+		doBench( "4K half Kaiser, all threads", [&]()
+			{
+				doNotOptimizeAway( multi.resample( *source, half, kaiser ) );
+			}, 10u );
+		doBench( "4K mip chain Kaiser, all threads", [&]()
+			{
+				doNotOptimizeAway( multi.generateMipmaps( *source, kaiser ) );
+			}, 10u );
+
+#if defined( CASTOR_USE_FREEIMAGE )
+
+		FreeImage_Initialise();
+		auto dib = FreeImage_Allocate( int( size.getWidth() ), int( size.getHeight() ), 32 );
+		std::memcpy( FreeImage_GetBits( dib ), source->constPtr(), source->size() );
+
+		doBench( "4K half FreeImage bicubic", [&]()
+			{
+				auto result = FreeImage_Rescale( dib, int( half.getWidth() ), int( half.getHeight() ), FILTER_BICUBIC );
+				doNotOptimizeAway( result );
+				FreeImage_Unload( result );
+			}, 10u );
+		doBench( "4K mip chain FreeImage bicubic", [&]()
+			{
+				auto level = dib;
+				auto width = size.getWidth();
+				auto height = size.getHeight();
+
+				while ( width > 1u || height > 1u )
+				{
+					width = std::max( 1u, width / 2u );
+					height = std::max( 1u, height / 2u );
+					auto next = FreeImage_Rescale( level, int( width ), int( height ), FILTER_BICUBIC );
+
+					if ( level != dib )
+					{
+						FreeImage_Unload( level );
+					}
+
+					level = next;
+				}
+
+				doNotOptimizeAway( level );
+				FreeImage_Unload( level );
+			}, 10u );
+
+		FreeImage_Unload( dib );
+		FreeImage_DeInitialise();
+
+#endif
+	}
+}
@@ -0,0 +1,37 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_IMAGE_RESAMPLER_TEST_H___
+#define ___CUT_IMAGE_RESAMPLER_TEST_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsImageResamplerTest
+		:	public TestCase
+	{
+	public:
+		CastorUtilsImageResamplerTest();
+		virtual ~CastorUtilsImageResamplerTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void TestMipmapsCount();
+		void TestUniformColour();
+		void TestBoxAverage();
+		void TestFloatFormat();
+		void TestThreadsCount();
+	};
+
+	class CastorUtilsImageResamplerBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsImageResamplerBench();
+		virtual ~CastorUtilsImageResamplerBench();
+		virtual void Execute();
+	};
+}
+
+#endif
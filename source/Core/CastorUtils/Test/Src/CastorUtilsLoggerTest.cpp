@@ -0,0 +1,181 @@
+#include "CastorUtilsLoggerTest.hpp"
+
+#include <Log/Logger.hpp>
+#include <Log/LogSink.hpp>
+#include <Multithreading/MpscQueue.hpp>
+
+#include <sstream>
+#include <thread>
+
+using namespace castor;
+
+namespace Testing
+{
+	//*********************************************************************************************
+
+	CastorUtilsLoggerTest::CastorUtilsLoggerTest()
+		: TestCase( "CastorUtilsLoggerTest" )
+	{
+	}
+
+	CastorUtilsLoggerTest::~CastorUtilsLoggerTest()
+	{
+	}
+
+	void CastorUtilsLoggerTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsLoggerTest::QueueLimits", std::bind( &CastorUtilsLoggerTest::QueueLimits, this ) );
+		doRegisterTest( "CastorUtilsLoggerTest::QueueMultipleProducers", std::bind( &CastorUtilsLoggerTest::QueueMultipleProducers, this ) );
+		doRegisterTest( "CastorUtilsLoggerTest::MemorySink", std::bind( &CastorUtilsLoggerTest::MemorySink, this ) );
+		doRegisterTest( "CastorUtilsLoggerTest::Sinks", std::bind( &CastorUtilsLoggerTest::Sinks, this ) );
+	}
+
+	void CastorUtilsLoggerTest::QueueLimits()
+	{
+		MpscQueue< std::string > queue{ 4u };
+		std::string value;
+		CT_EQUAL( queue.capacity(), 4u );
+		CT_CHECK( !queue.tryPop( value ) );
+
+		for ( uint32_t i = 0u; i < 4u; ++i )
+		{
+			CT_CHECK( queue.tryPush( std::to_string( i ) ) );
+		}
+
+		std::string overflow{ "overflow" };
+		CT_CHECK( !queue.tryPush( std::move( overflow ) ) );
+		CT_EQUAL( overflow, "overflow" );
+		CT_EQUAL( queue.size(), 4u );
+
+		for ( uint32_t i = 0u; i < 4u; ++i )
+		{
+			CT_CHECK( queue.tryPop( value ) );
+			CT_EQUAL( value, std::to_string( i ) );
+		}
+
+		CT_CHECK( !queue.tryPop( value ) );
+		CT_EQUAL( queue.getPushed(), 4u );
+		CT_EQUAL( queue.getPopped(), 4u );
+	}
+
+	void CastorUtilsLoggerTest::QueueMultipleProducers()
+	{
+		uint32_t constexpr ThreadCount = 4u;
+		uint32_t constexpr ValueCount = 10000u;
+		MpscQueue< uint32_t > queue{ 256u };
+		std::vector< std::thread > threads;
+
+		for ( uint32_t i = 0u; i < ThreadCount; ++i )
+		{
+			threads.emplace_back( [&queue, i]()
+			{
+				for ( uint32_t j = 0u; j < ValueCount; ++j )
+				{
+					while ( !queue.tryPush( i * ValueCount + j ) )
+					{
+						std::this_thread::yield();
+					}
+				}
+			} );
+		}
+
+		// Each producer's values must come out in order, and none must be lost.
+		std::vector< uint32_t > next( ThreadCount, 0u );
+		uint32_t received = 0u;
+		bool ordered = true;
+		uint32_t value;
+
+		while ( received < ThreadCount * ValueCount )
+		{
+			if ( queue.tryPop( value ) )
+			{
+				auto thread = value / ValueCount;
+				ordered = ordered && value % ValueCount == next[thread];
+				++next[thread];
+				++received;
+			}
+		}
+
+		for ( auto & thread : threads )
+		{
+			thread.join();
+		}
+
+		CT_CHECK( ordered );
+		CT_CHECK( !queue.tryPop( value ) );
+	}
+
+	void CastorUtilsLoggerTest::MemorySink()
+	{
+		MemoryLogSink sink{ 3u };
+		CT_CHECK( sink.getLines().empty() );
+		sink.log( LogType::eInfo, cuT( "a" ), cuT( "1" ), true );
+		sink.log( LogType::eInfo, cuT( "b" ), cuT( "2" ), true );
+		auto lines = sink.getLines();
+		CT_EQUAL( lines.size(), 2u );
+		CT_EQUAL( lines[0], cuT( "1" ) );
+		sink.log( LogType::eInfo, cuT( "c" ), cuT( "3" ), true );
+		sink.log( LogType::eInfo, cuT( "d" ), cuT( "4" ), true );
+		lines = sink.getLines();
+		CT_EQUAL( lines.size(), 3u );
+		CT_EQUAL( lines[0], cuT( "2" ) );
+		CT_EQUAL( lines[2], cuT( "4" ) );
+		std::stringstream stream;
+		sink.dump( stream );
+		CT_EQUAL( stream.str(), "2\n3\n4\n" );
+	}
+
+	void CastorUtilsLoggerTest::Sinks()
+	{
+		// The sinks receive the lines written after their addition, so the previous ones are flushed first.
+		auto sink = std::make_shared< MemoryLogSink >( 16u );
+		Logger::flush();
+		Logger::addSink( sink );
+		Logger::logWarning( "first\nsecond" );
+		Logger::flush();
+		Logger::removeSink( sink );
+		Logger::logWarning( "ignored" );
+		Logger::flush();
+		auto lines = sink->getLines();
+		CT_REQUIRE( lines.size() == 2u );
+		CT_CHECK( lines[0].find( cuT( " - ***WARNING*** first" ) ) != String::npos );
+		CT_CHECK( lines[1].find( cuT( " - ***WARNING*** second" ) ) != String::npos );
+		CT_EQUAL( Logger::getDroppedCount(), 0u );
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsLoggerBench::CastorUtilsLoggerBench()
+		: BenchCase( "CastorUtilsLoggerBench" )
+	{
+	}
+
+	CastorUtilsLoggerBench::~CastorUtilsLoggerBench()
+	{
+	}
+
+	void CastorUtilsLoggerBench::Execute()
+	{
+		uint32_t constexpr MessageCount = 4096u;
+		std::string const message{ "Couldn't find bone [Bench] in the skeleton" };
+		doBench( "Push only", [&]()
+			{
+				for ( uint32_t i = 0u; i < MessageCount; ++i )
+				{
+					Logger::logWarning( message );
+				}
+			}, 100u );
+		Logger::flush();
+		doBench( "Push and write", [&]()
+			{
+				for ( uint32_t i = 0u; i < MessageCount; ++i )
+				{
+					Logger::logWarning( message );
+				}
+
+				Logger::flush();
+			}, 100u );
+	}
+
+	//*********************************************************************************************
+}
@@ -0,0 +1,36 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_LoggerTest_H___
+#define ___CUT_LoggerTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsLoggerTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsLoggerTest();
+		virtual ~CastorUtilsLoggerTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void QueueLimits();
+		void QueueMultipleProducers();
+		void MemorySink();
+		void Sinks();
+	};
+
+	class CastorUtilsLoggerBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsLoggerBench();
+		virtual ~CastorUtilsLoggerBench();
+		virtual void Execute();
+	};
+}
+
+#endif
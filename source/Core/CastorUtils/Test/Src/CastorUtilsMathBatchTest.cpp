@@ -0,0 +1,395 @@
+#include "CastorUtilsMathBatchTest.hpp"
+
+#include <Math/MathBatch.hpp>
+#include <Math/TransformationMatrix.hpp>
+
+#include <random>
+
+namespace Testing
+{
+	//*********************************************************************************************
+
+	namespace matrix = castor::matrix;
+	namespace batch = castor::batch;
+	using castor::real;
+	using castor::Angle;
+	using castor::BoundingBox;
+	using castor::MathKernel;
+	using castor::Matrix4x4r;
+	using castor::Point3r;
+	using castor::Quaternion;
+
+	//*********************************************************************************************
+
+	namespace
+	{
+		// Counts exercising the SIMD bodies and their scalar tails.
+		std::array< size_t, 5u > const Counts{ { 1u, 3u, 7u, 17u, 1021u } };
+
+		Matrix4x4r doGetTransform()
+		{
+			Matrix4x4r result;
+			matrix::setTransform( result
+				, Point3r{ 1.0, -2.0, 3.0 }
+				, Point3r{ 2.0, 0.5, 1.5 }
+				, Quaternion::fromAxisAngle( castor::point::getNormalised( Point3r{ 1.0, 1.0, 0.0 } ), Angle::fromDegrees( 30.0 ) ) );
+			return result;
+		}
+
+		std::vector< Point3r > doGetRandomPoints( size_t count )
+		{
+			std::vector< Point3r > result( count );
+			std::mt19937 engine{ 42u };
+			std::uniform_real_distribution< real > distribution{ -10.0, 10.0 };
+
+			for ( auto & point : result )
+			{
+				point = Point3r{ distribution( engine ), distribution( engine ), distribution( engine ) };
+			}
+
+			return result;
+		}
+
+		std::array< std::vector< real >, 3u > doSplit( std::vector< Point3r > const & points )
+		{
+			std::array< std::vector< real >, 3u > result;
+
+			for ( uint32_t c = 0u; c < 3u; ++c )
+			{
+				result[c].resize( points.size() );
+
+				for ( size_t i = 0u; i < points.size(); ++i )
+				{
+					result[c][i] = points[i][c];
+				}
+			}
+
+			return result;
+		}
+
+		bool doCompare( real lhs, real rhs )
+		{
+			// The SIMD kernels don't sum in the same order as the scalar ones.
+			return std::abs( lhs - rhs ) <= real( 0.0001 ) * std::max( real( 1 ), std::abs( rhs ) );
+		}
+
+		bool doCompare( Point3r const & lhs, Point3r const & rhs )
+		{
+			return doCompare( lhs[0], rhs[0] )
+				&& doCompare( lhs[1], rhs[1] )
+				&& doCompare( lhs[2], rhs[2] );
+		}
+
+		template< typename T >
+		bool doCompare( std::vector< T > const & lhs, std::vector< T > const & rhs )
+		{
+			bool result = lhs.size() == rhs.size();
+
+			for ( size_t i = 0u; i < lhs.size() && result; ++i )
+			{
+				result = doCompare( lhs[i], rhs[i] );
+			}
+
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsMathBatchTest::CastorUtilsMathBatchTest()
+		: TestCase( "CastorUtilsMathBatchTest" )
+	{
+	}
+
+	CastorUtilsMathBatchTest::~CastorUtilsMathBatchTest()
+	{
+	}
+
+	void CastorUtilsMathBatchTest::doRegisterTests()
+	{
+		doRegisterTest( "TransformPoints", std::bind( &CastorUtilsMathBatchTest::TransformPoints, this ) );
+		doRegisterTest( "TransformPointsSoA", std::bind( &CastorUtilsMathBatchTest::TransformPointsSoA, this ) );
+		doRegisterTest( "MultiplyMatrices", std::bind( &CastorUtilsMathBatchTest::MultiplyMatrices, this ) );
+		doRegisterTest( "TransformBoxes", std::bind( &CastorUtilsMathBatchTest::TransformBoxes, this ) );
+		doRegisterTest( "SquaredDistances", std::bind( &CastorUtilsMathBatchTest::SquaredDistances, this ) );
+	}
+
+	void CastorUtilsMathBatchTest::TransformPoints()
+	{
+		auto transform = doGetTransform();
+
+		for ( auto count : Counts )
+		{
+			auto src = doGetRandomPoints( count );
+			std::vector< Point3r > reference;
+			std::vector< Point3r > vectors;
+
+			for ( auto & point : src )
+			{
+				reference.push_back( transform * point );
+				vectors.push_back( transform * point - transform * Point3r{} );
+			}
+
+			for ( auto kernel = uint32_t( MathKernel::eScalar ); kernel <= uint32_t( batch::getMathKernel() ); ++kernel )
+			{
+				std::vector< Point3r > result( count );
+				batch::transformPoints( transform, src.data(), result.data(), count, MathKernel( kernel ) );
+				CT_CHECK( doCompare( result, reference ) );
+
+				result = src;
+				batch::transformPoints( transform, result.data(), result.data(), count, MathKernel( kernel ) );
+				CT_CHECK( doCompare( result, reference ) );
+
+				result = src;
+				batch::transformVectors( transform
+					, result[0].constPtr()
+					, sizeof( Point3r )
+					, result[0].ptr()
+					, sizeof( Point3r )
+					, count
+					, MathKernel( kernel ) );
+				CT_CHECK( doCompare( result, vectors ) );
+			}
+		}
+	}
+
+	void CastorUtilsMathBatchTest::TransformPointsSoA()
+	{
+		auto transform = doGetTransform();
+
+		for ( auto count : Counts )
+		{
+			auto points = doGetRandomPoints( count );
+			auto src = doSplit( points );
+
+			for ( auto & point : points )
+			{
+				point = transform * point;
+			}
+
+			auto reference = doSplit( points );
+
+			for ( auto kernel = uint32_t( MathKernel::eScalar ); kernel <= uint32_t( batch::getMathKernel() ); ++kernel )
+			{
+				auto result = src;
+				batch::transformPoints( transform
+					, { { result[0].data(), result[1].data(), result[2].data() } }
+					, { { result[0].data(), result[1].data(), result[2].data() } }
+					, count
+					, MathKernel( kernel ) );
+				CT_CHECK( doCompare( result[0], reference[0] ) );
+				CT_CHECK( doCompare( result[1], reference[1] ) );
+				CT_CHECK( doCompare( result[2], reference[2] ) );
+			}
+		}
+	}
+
+	void CastorUtilsMathBatchTest::MultiplyMatrices()
+	{
+		auto points = doGetRandomPoints( 34u );
+		std::vector< Matrix4x4r > lhs;
+		std::vector< Matrix4x4r > rhs;
+
+		for ( size_t i = 0u; i < 17u; ++i )
+		{
+			Matrix4x4r mtx;
+			matrix::setTransform( mtx
+				, points[i]
+				, Point3r{ 1.0, 2.0, 3.0 }
+				, Quaternion::fromAxisAngle( Point3r{ 0.0, 1.0, 0.0 }, Angle::fromDegrees( real( 10 * i ) ) ) );
+			lhs.push_back( mtx );
+			matrix::setTranslate( mtx, points[i + 17u] );
+			rhs.push_back( mtx );
+		}
+
+		for ( auto kernel = uint32_t( MathKernel::eScalar ); kernel <= uint32_t( batch::getMathKernel() ); ++kernel )
+		{
+			auto result = lhs;
+			batch::multiply( result.data(), rhs.data(), result.data(), result.size(), MathKernel( kernel ) );
+
+			for ( size_t i = 0u; i < result.size(); ++i )
+			{
+				auto point = points[i];
+				CT_CHECK( doCompare( result[i] * point, lhs[i] * ( rhs[i] * point ) ) );
+			}
+		}
+	}
+
+	void CastorUtilsMathBatchTest::TransformBoxes()
+	{
+		auto transform = doGetTransform();
+		auto points = doGetRandomPoints( 34u );
+		std::vector< BoundingBox > boxes;
+		std::vector< BoundingBox > reference;
+
+		for ( size_t i = 0u; i < 17u; ++i )
+		{
+			Point3r min{ std::min( points[i][0], points[i + 17][0] )
+				, std::min( points[i][1], points[i + 17][1] )
+				, std::min( points[i][2], points[i + 17][2] ) };
+			Point3r max{ std::max( points[i][0], points[i + 17][0] )
+				, std::max( points[i][1], points[i + 17][1] )
+				, std::max( points[i][2], points[i + 17][2] ) };
+			boxes.emplace_back( min, max );
+
+			// The reference box encloses the 8 transformed corners.
+			Point3r tmin{ std::numeric_limits< real >::max(), std::numeric_limits< real >::max(), std::numeric_limits< real >::max() };
+			Point3r tmax{ std::numeric_limits< real >::lowest(), std::numeric_limits< real >::lowest(), std::numeric_limits< real >::lowest() };
+
+			for ( uint32_t corner = 0u; corner < 8u; ++corner )
+			{
+				auto point = transform * Point3r{ ( corner & 1u ) ? max[0] : min[0]
+					, ( corner & 2u ) ? max[1] : min[1]
+					, ( corner & 4u ) ? max[2] : min[2] };
+
+				for ( uint32_t c = 0u; c < 3u; ++c )
+				{
+					tmin[c] = std::min( tmin[c], point[c] );
+					tmax[c] = std::max( tmax[c], point[c] );
+				}
+			}
+
+			reference.emplace_back( tmin, tmax );
+		}
+
+		for ( auto kernel = uint32_t( MathKernel::eScalar ); kernel <= uint32_t( batch::getMathKernel() ); ++kernel )
+		{
+			auto result = boxes;
+			batch::transformBoxes( transform, result.data(), result.data(), result.size(), MathKernel( kernel ) );
+
+			for ( size_t i = 0u; i < result.size(); ++i )
+			{
+				CT_CHECK( doCompare( result[i].getMin(), reference[i].getMin() ) );
+				CT_CHECK( doCompare( result[i].getMax(), reference[i].getMax() ) );
+			}
+		}
+	}
+
+	void CastorUtilsMathBatchTest::SquaredDistances()
+	{
+		Point3r origin{ 1.0, 2.0, -3.0 };
+
+		for ( auto count : Counts )
+		{
+			auto points = doGetRandomPoints( count );
+			auto soa = doSplit( points );
+			std::vector< real > reference;
+
+			for ( auto & point : points )
+			{
+				reference.push_back( real( castor::point::distanceSquared( point, origin ) ) );
+			}
+
+			for ( auto kernel = uint32_t( MathKernel::eScalar ); kernel <= uint32_t( batch::getMathKernel() ); ++kernel )
+			{
+				std::vector< real > result( count );
+				batch::squaredDistances( origin
+					, points[0].constPtr()
+					, sizeof( Point3r )
+					, result.data()
+					, count
+					, MathKernel( kernel ) );
+				CT_CHECK( doCompare( result, reference ) );
+
+				std::fill( result.begin(), result.end(), real( 0 ) );
+				batch::squaredDistances( origin
+					, { { soa[0].data(), soa[1].data(), soa[2].data() } }
+					, result.data()
+					, count
+					, MathKernel( kernel ) );
+				CT_CHECK( doCompare( result, reference ) );
+			}
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsMathBatchBench::CastorUtilsMathBatchBench()
+		: BenchCase( "CastorUtilsMathBatchBench" )
+		, m_points( doGetRandomPoints( 100000u ) )
+		, m_transformed( m_points.size() )
+		, m_soa( doSplit( m_points ) )
+		, m_distances( m_points.size() )
+		, m_matrix( doGetTransform() )
+	{
+		for ( size_t i = 0u; i + 1u < m_points.size(); i += 2u )
+		{
+			m_boxes.emplace_back( m_points[i], m_points[i] + Point3r{ 1.0, 1.0, 1.0 } );
+		}
+	}
+
+	CastorUtilsMathBatchBench::~CastorUtilsMathBatchBench()
+	{
+	}
+
+	void CastorUtilsMathBatchBench::Execute()
+	{
+		std::vector< BoundingBox > boxes( m_boxes.size() );
+
+		doBench( "100K points, operator*", [&]()
+			{
+				for ( size_t i = 0u; i < m_points.size(); ++i )
+				{
+					m_transformed[i] = m_matrix * m_points[i];
+				}
+
+				doNotOptimizeAway( m_transformed );
+			}, 100u );
+		doBench( "100K points, scalar batch", [&]()
+			{
+				batch::transformPoints( m_matrix, m_points.data(), m_transformed.data(), m_points.size(), MathKernel::eScalar );
+				doNotOptimizeAway( m_transformed );
+			}, 100u );
+		doBench( "100K points, best batch", [&]()
+			{
+				batch::transformPoints( m_matrix, m_points.data(), m_transformed.data(), m_points.size() );
+				doNotOptimizeAway( m_transformed );
+			}, 100u );
+		doBench( "100K SoA points, scalar batch", [&]()
+			{
+				batch::transformPoints( m_matrix
+					, { { m_soa[0].data(), m_soa[1].data(), m_soa[2].data() } }
+					, { { m_soa[0].data(), m_soa[1].data(), m_soa[2].data() } }
+					, m_points.size()
+					, MathKernel::eScalar );
+				doNotOptimizeAway( m_soa );
+			}, 100u );
+		doBench( "100K SoA points, best batch", [&]()
+			{
+				batch::transformPoints( m_matrix
+					, { { m_soa[0].data(), m_soa[1].data(), m_soa[2].data() } }
+					, { { m_soa[0].data(), m_soa[1].data(), m_soa[2].data() } }
+					, m_points.size() );
+				doNotOptimizeAway( m_soa );
+			}, 100u );
+		doBench( "100K distances, scalar batch", [&]()
+			{
+				batch::squaredDistances( m_points[0], m_points[0].constPtr(), sizeof( Point3r ), m_distances.data(), m_points.size(), MathKernel::eScalar );
+				doNotOptimizeAway( m_distances );
+			}, 100u );
+		doBench( "100K distances, best batch", [&]()
+			{
+				batch::squaredDistances( m_points[0], m_points[0].constPtr(), sizeof( Point3r ), m_distances.data(), m_points.size() );
+				doNotOptimizeAway( m_distances );
+			}, 100u );
+		doBench( "50K boxes, getAxisAligned", [&]()
+			{
+				for ( auto & box : m_boxes )
+				{
+					doNotOptimizeAway( box.getAxisAligned( m_matrix ) );
+				}
+			}, 100u );
+		doBench( "50K boxes, scalar batch", [&]()
+			{
+				batch::transformBoxes( m_matrix, m_boxes.data(), boxes.data(), m_boxes.size(), MathKernel::eScalar );
+				doNotOptimizeAway( boxes );
+			}, 100u );
+		doBench( "50K boxes, best batch", [&]()
+			{
+				batch::transformBoxes( m_matrix, m_boxes.data(), boxes.data(), m_boxes.size() );
+				doNotOptimizeAway( boxes );
+			}, 100u );
+	}
+
+	//*********************************************************************************************
+}
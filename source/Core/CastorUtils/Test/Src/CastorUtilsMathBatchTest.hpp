@@ -0,0 +1,47 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_MATH_BATCH_TEST_H___
+#define ___CUT_MATH_BATCH_TEST_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <Graphics/BoundingBox.hpp>
+
+namespace Testing
+{
+	class CastorUtilsMathBatchTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsMathBatchTest();
+		virtual ~CastorUtilsMathBatchTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void TransformPoints();
+		void TransformPointsSoA();
+		void MultiplyMatrices();
+		void TransformBoxes();
+		void SquaredDistances();
+	};
+
+	class CastorUtilsMathBatchBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsMathBatchBench();
+		virtual ~CastorUtilsMathBatchBench();
+		virtual void Execute();
+
+	private:
+		std::vector< castor::Point3r > m_points;
+		std::vector< castor::Point3r > m_transformed;
+		std::array< std::vector< castor::real >, 3u > m_soa;
+		std::vector< castor::real > m_distances;
+		std::vector< castor::BoundingBox > m_boxes;
+		castor::Matrix4x4r m_matrix;
+	};
+}
+
+#endif
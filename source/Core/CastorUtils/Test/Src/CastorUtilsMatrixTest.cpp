@@ -19,6 +19,7 @@ namespace Testing
 	namespace matrix = castor::matrix;
 	using castor::real;
 	using castor::Angle;
+	using castor::Float4x4;
 	using castor::Logger;
 	using castor::Matrix4x4f;
 	using castor::Matrix4x4r;
@@ -49,6 +50,9 @@ namespace Testing
 	void CastorUtilsMatrixTest::doRegisterTests()
 	{
 		doRegisterTest( "MatrixInversion", std::bind( &CastorUtilsMatrixTest::MatrixInversion, this ) );
+		doRegisterTest( "Float4x4Multiplication", std::bind( &CastorUtilsMatrixTest::Float4x4Multiplication, this ) );
+		doRegisterTest( "Float4x4Inversion", std::bind( &CastorUtilsMatrixTest::Float4x4Inversion, this ) );
+		doRegisterTest( "Float4x4Transform", std::bind( &CastorUtilsMatrixTest::Float4x4Transform, this ) );
 
 #if defined( CASTOR_USE_GLM )
 
@@ -80,6 +84,13 @@ namespace Testing
 		return Testing::compare( lhs, rhs );
 	}
 
+	bool CastorUtilsMatrixTest::compare( Point3f const & lhs, Point3f const & rhs )
+	{
+		return TestCase::compare( lhs[0], rhs[0] )
+			&& TestCase::compare( lhs[1], rhs[1] )
+			&& TestCase::compare( lhs[2], rhs[2] );
+	}
+
 #if defined( CASTOR_USE_GLM )
 
 	bool CastorUtilsMatrixTest::compare( Matrix4x4f const & lhs, glm::mat4x4 const & rhs )
@@ -121,6 +132,83 @@ namespace Testing
 		CT_EQUAL( mtxRGBtoYUV, mtxYUVtoRGB.getInverse() );
 	}
 
+	void CastorUtilsMatrixTest::Float4x4Multiplication()
+	{
+		for ( int i = 0; i < 10; ++i )
+		{
+			// The double precision matrices use the generic code path, and serve as reference.
+			Matrix4x4d mtxA;
+			Matrix4x4d mtxB;
+			randomInit( mtxA.ptr(), 16 );
+			randomInit( mtxB.ptr(), 16 );
+			Float4x4 f4x4A{ Matrix4x4f{ mtxA } };
+			Float4x4 f4x4B{ Matrix4x4f{ mtxB } };
+			CT_EQUAL( Matrix4x4f{ mtxA * mtxB }, ( f4x4A * f4x4B ).toMatrix() );
+			CT_EQUAL( Matrix4x4f{ mtxB * mtxA }, ( f4x4B * f4x4A ).toMatrix() );
+			f4x4A *= f4x4A;
+			CT_EQUAL( Matrix4x4f{ mtxA * mtxA }, f4x4A.toMatrix() );
+			Matrix4x4f mtxC{ mtxB };
+			mtxC *= Matrix4x4f{ mtxA };
+			CT_EQUAL( Matrix4x4f{ mtxB * mtxA }, mtxC );
+		}
+	}
+
+	void CastorUtilsMatrixTest::Float4x4Inversion()
+	{
+		for ( int i = 0; i < 10; ++i )
+		{
+			// Adding the identity keeps the random matrices far from singular ones.
+			Matrix4x4d mtx{ 4.0 };
+			Matrix4x4d random;
+			randomInit( random.ptr(), 16 );
+			mtx += random;
+			Float4x4 f4x4{ Matrix4x4f{ mtx } };
+			CT_EQUAL( Matrix4x4f{ mtx.getInverse() }, f4x4.getInverse().toMatrix() );
+			CT_EQUAL( Matrix4x4f{ mtx.getInverse() }, Matrix4x4f{ mtx }.getInverse() );
+			CT_EQUAL( Matrix4x4f{ 1.0f }, ( f4x4 * f4x4.getInverse() ).toMatrix() );
+			f4x4.invert();
+			CT_EQUAL( Matrix4x4f{ mtx.getInverse() }, f4x4.toMatrix() );
+		}
+	}
+
+	void CastorUtilsMatrixTest::Float4x4Transform()
+	{
+		Matrix4x4f mtx;
+		matrix::setTransform( mtx
+			, Point3f{ 1.0f, -2.0f, 3.0f }
+			, Point3f{ 2.0f, 2.0f, 2.0f }
+			, Quaternion::fromAxisAngle( Point3f{ 0.0f, 1.0f, 0.0f }, Angle::fromDegrees( 90.0f ) ) );
+		Float4x4 f4x4{ mtx };
+		std::array< Point3f, 3u > points
+		{
+			Point3f{ 0.0f, 0.0f, 0.0f },
+			Point3f{ 1.0f, 0.0f, 0.0f },
+			Point3f{ 0.0f, 1.0f, 1.0f },
+		};
+
+		auto origin = f4x4.transformPoint( points[0] );
+
+		for ( auto & point : points )
+		{
+			CT_CHECK( compare( matrix::getTransformed( mtx, point ), f4x4.transformPoint( point ) ) );
+			CT_CHECK( compare( f4x4.transformPoint( point ) - origin, f4x4.transformVector( point ) ) );
+		}
+
+		auto transformed = points;
+		f4x4.transformPoints( transformed.data(), transformed.data(), transformed.size() );
+
+		for ( size_t i = 0u; i < points.size(); ++i )
+		{
+			CT_CHECK( compare( f4x4.transformPoint( points[i] ), transformed[i] ) );
+		}
+
+		Float4x4 rotation{ castor::NoInit{} };
+		Quaternion::fromAxisAngle( Point3f{ 0.0f, 0.0f, 1.0f }, Angle::fromDegrees( 45.0f ) ).toMatrix( rotation );
+		Matrix4x4f reference;
+		Quaternion::fromAxisAngle( Point3f{ 0.0f, 0.0f, 1.0f }, Angle::fromDegrees( 45.0f ) ).toMatrix( reference );
+		CT_EQUAL( reference, rotation.toMatrix() );
+	}
+
 #if defined( CASTOR_USE_GLM )
 
 	void CastorUtilsMatrixTest::MatrixInversionComparison()
@@ -268,6 +356,8 @@ namespace Testing
 		m_mtx1glm[3][3] = 1.0f;
 		randomInit( m_mtx2.ptr(), &m_mtx2glm[0][0], 16 );
 #endif
+		m_mtx1f4x4 = Float4x4{ Matrix4x4f{ m_mtx1 } };
+		m_mtx2f4x4 = Float4x4{ Matrix4x4f{ m_mtx2 } };
 	}
 
 	CastorUtilsMatrixBench::~CastorUtilsMatrixBench()
@@ -277,14 +367,17 @@ namespace Testing
 	void CastorUtilsMatrixBench::Execute()
 	{
 		BENCHMARK( MatrixMultiplicationsCastor, NB_TESTS );
+		BENCHMARK( MatrixMultiplicationsFloat4x4, NB_TESTS );
 #if defined( CASTOR_USE_GLM )
 		BENCHMARK( MatrixMultiplicationsGlm, NB_TESTS );
 #endif
 		BENCHMARK( MatrixInversionCastor, NB_TESTS );
+		BENCHMARK( MatrixInversionFloat4x4, NB_TESTS );
 #if defined( CASTOR_USE_GLM )
 		BENCHMARK( MatrixInversionGlm, NB_TESTS );
 #endif
 		BENCHMARK( MatrixCopyCastor, NB_TESTS );
+		BENCHMARK( MatrixCopyFloat4x4, NB_TESTS );
 #if defined( CASTOR_USE_GLM )
 		BENCHMARK( MatrixCopyGlm, NB_TESTS );
 #endif
@@ -305,6 +398,21 @@ namespace Testing
 		doNotOptimizeAway( m_mtx2 = m_mtx1 );
 	}
 
+	void CastorUtilsMatrixBench::MatrixMultiplicationsFloat4x4()
+	{
+		doNotOptimizeAway( m_mtx1f4x4 * m_mtx2f4x4 );
+	}
+
+	void CastorUtilsMatrixBench::MatrixInversionFloat4x4()
+	{
+		doNotOptimizeAway( m_mtx1f4x4.getInverse() );
+	}
+
+	void CastorUtilsMatrixBench::MatrixCopyFloat4x4()
+	{
+		doNotOptimizeAway( m_mtx2f4x4 = m_mtx1f4x4 );
+	}
+
 #if defined( CASTOR_USE_GLM )
 
 	void CastorUtilsMatrixBench::MatrixMultiplicationsGlm()
@@ -4,6 +4,7 @@
 
 #include "CastorUtilsTestPrerequisites.hpp"
 
+#include <Math/Float4x4.hpp>
 #include <Math/SquareMatrix.hpp>
 #if defined( CASTOR_USE_GLM )
 #	include <glm/glm.hpp>
@@ -24,6 +25,7 @@ namespace Testing
 		bool compare( castor::Matrix3x3d const & lhs, castor::Matrix3x3d const & rhs );
 		bool compare( castor::Matrix4x4f const & lhs, castor::Matrix4x4f const & rhs );
 		bool compare( castor::Matrix4x4d const & lhs, castor::Matrix4x4d const & rhs );
+		bool compare( castor::Point3f const & lhs, castor::Point3f const & rhs );
 
 #if defined( CASTOR_USE_GLM )
 
@@ -34,6 +36,9 @@ namespace Testing
 
 	private:
 		void MatrixInversion();
+		void Float4x4Multiplication();
+		void Float4x4Inversion();
+		void Float4x4Transform();
 
 #if defined( CASTOR_USE_GLM )
 
@@ -67,10 +72,15 @@ namespace Testing
 		void MatrixInversionGlm();
 		void MatrixCopyCastor();
 		void MatrixCopyGlm();
+		void MatrixMultiplicationsFloat4x4();
+		void MatrixInversionFloat4x4();
+		void MatrixCopyFloat4x4();
 
 	private:
 		castor::Matrix4x4r m_mtx1;
 		castor::Matrix4x4r m_mtx2;
+		castor::Float4x4 m_mtx1f4x4;
+		castor::Float4x4 m_mtx2f4x4;
 
 #if defined( CASTOR_USE_GLM )
 
@@ -0,0 +1,156 @@
+#include "CastorUtilsMemoryAccountingTest.hpp"
+
+#include <Miscellaneous/MemoryAccounting.hpp>
+
+#include <sstream>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		MemoryReportEntry const * doFind( MemoryReport const & report
+			, String const & name )
+		{
+			auto it = std::find_if( report.begin()
+				, report.end()
+				, [&name]( MemoryReportEntry const & entry )
+				{
+					return entry.name == name;
+				} );
+			return it == report.end()
+				? nullptr
+				: &( *it );
+		}
+	}
+
+	CastorUtilsMemoryAccountingTest::CastorUtilsMemoryAccountingTest()
+		: TestCase( "CastorUtilsMemoryAccountingTest" )
+	{
+	}
+
+	CastorUtilsMemoryAccountingTest::~CastorUtilsMemoryAccountingTest()
+	{
+	}
+
+	void CastorUtilsMemoryAccountingTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsMemoryAccountingTest::Usage", std::bind( &CastorUtilsMemoryAccountingTest::Usage, this ) );
+		doRegisterTest( "CastorUtilsMemoryAccountingTest::CopyMove", std::bind( &CastorUtilsMemoryAccountingTest::CopyMove, this ) );
+		doRegisterTest( "CastorUtilsMemoryAccountingTest::PeaksBudgets", std::bind( &CastorUtilsMemoryAccountingTest::PeaksBudgets, this ) );
+		doRegisterTest( "CastorUtilsMemoryAccountingTest::ReadBudgets", std::bind( &CastorUtilsMemoryAccountingTest::ReadBudgets, this ) );
+		doRegisterTest( "CastorUtilsMemoryAccountingTest::Reports", std::bind( &CastorUtilsMemoryAccountingTest::Reports, this ) );
+	}
+
+	void CastorUtilsMemoryAccountingTest::Usage()
+	{
+		auto & tag = MemoryAccounting::getTag( cuT( "Test usage" ) );
+		CT_CHECK( &tag == &MemoryAccounting::getTag( cuT( "Test usage" ) ) );
+		{
+			MemoryUsage usage1{ tag };
+			MemoryUsage usage2{ tag };
+			CT_EQUAL( tag.getObjects(), 2 );
+			usage1.setCpuSize( 100u );
+			usage2.setCpuSize( 50u );
+			usage2.setGpuSize( 1000u );
+			CT_EQUAL( tag.getCpuBytes(), 150 );
+			CT_EQUAL( tag.getGpuBytes(), 1000 );
+			usage1.setCpuSize( 20u );
+			CT_EQUAL( tag.getCpuBytes(), 70 );
+		}
+		CT_EQUAL( tag.getObjects(), 0 );
+		CT_EQUAL( tag.getCpuBytes(), 0 );
+		CT_EQUAL( tag.getGpuBytes(), 0 );
+	}
+
+	void CastorUtilsMemoryAccountingTest::CopyMove()
+	{
+		auto & tag = MemoryAccounting::getTag( cuT( "Test copy" ) );
+		{
+			MemoryUsage usage1{ tag };
+			usage1.setCpuSize( 100u );
+			MemoryUsage usage2{ usage1 };
+			CT_EQUAL( tag.getObjects(), 2 );
+			CT_EQUAL( tag.getCpuBytes(), 200 );
+			MemoryUsage usage3{ std::move( usage2 ) };
+			CT_EQUAL( tag.getObjects(), 3 );
+			CT_EQUAL( tag.getCpuBytes(), 200 );
+			usage2 = usage3;
+			CT_EQUAL( tag.getCpuBytes(), 300 );
+			usage1 = std::move( usage3 );
+			CT_EQUAL( tag.getCpuBytes(), 200 );
+		}
+		CT_EQUAL( tag.getObjects(), 0 );
+		CT_EQUAL( tag.getCpuBytes(), 0 );
+	}
+
+	void CastorUtilsMemoryAccountingTest::PeaksBudgets()
+	{
+		auto & tag = MemoryAccounting::getTag( cuT( "Test peaks" ) );
+		MemoryAccounting::setBudget( cuT( "Test peaks" ), 1000u, 0u );
+		{
+			MemoryUsage usage{ tag };
+			usage.setCpuSize( 800u );
+			usage.setCpuSize( 200u );
+			CT_EQUAL( tag.getCpuPeak(), 800 );
+			auto entry = doFind( MemoryAccounting::getReport(), cuT( "Test peaks" ) );
+			CT_REQUIRE( entry != nullptr );
+			CT_CHECK( !entry->isOverBudget() );
+			usage.setCpuSize( 1200u );
+		}
+		auto report = MemoryAccounting::getReport();
+		auto entry = doFind( report, cuT( "Test peaks" ) );
+		CT_REQUIRE( entry != nullptr );
+		CT_EQUAL( entry->cpuBytes, 0 );
+		CT_EQUAL( entry->cpuPeak, 1200 );
+		CT_CHECK( entry->isOverBudget() );
+		MemoryAccounting::resetPeaks();
+		CT_EQUAL( tag.getCpuPeak(), 0 );
+		MemoryAccounting::setBudget( cuT( "Test peaks" ), 0u, 0u );
+	}
+
+	void CastorUtilsMemoryAccountingTest::ReadBudgets()
+	{
+		std::stringstream stream;
+		stream << "# subsystem,cpuBytes,gpuBytes\n";
+		stream << "Test budget A,1024,2048\n";
+		stream << "\n";
+		stream << " Test budget B , 0 , 4096\n";
+		stream << "invalid line\n";
+		CT_EQUAL( MemoryAccounting::readBudgets( stream ), 2u );
+		CT_EQUAL( MemoryAccounting::getTag( cuT( "Test budget A" ) ).getCpuBudget(), 1024u );
+		CT_EQUAL( MemoryAccounting::getTag( cuT( "Test budget A" ) ).getGpuBudget(), 2048u );
+		CT_EQUAL( MemoryAccounting::getTag( cuT( "Test budget B" ) ).getCpuBudget(), 0u );
+		CT_EQUAL( MemoryAccounting::getTag( cuT( "Test budget B" ) ).getGpuBudget(), 4096u );
+	}
+
+	void CastorUtilsMemoryAccountingTest::Reports()
+	{
+		auto & tag = MemoryAccounting::getTag( cuT( "Test \"report\"" ) );
+		MemoryUsage usage{ tag };
+		usage.setCpuSize( 10u );
+		usage.setGpuSize( 20u );
+		MemoryReport report{ 1u, MemoryReportEntry{ tag.getName()
+			, tag.getCpuBytes()
+			, tag.getGpuBytes()
+			, tag.getObjects()
+			, tag.getCpuPeak()
+			, tag.getGpuPeak()
+			, tag.getCpuBudget()
+			, tag.getGpuBudget() } };
+
+		std::stringstream csv;
+		MemoryAccounting::writeCsvHeader( csv );
+		MemoryAccounting::writeCsv( csv, report, Milliseconds{ 42 } );
+		CT_EQUAL( csv.str(), std::string{ "time_ms,subsystem,cpu_bytes,gpu_bytes,objects,cpu_peak,gpu_peak,cpu_budget,gpu_budget\n"
+			"42,\"Test \\\"report\\\"\",10,20,1,10,20,0,0\n" } );
+
+		std::stringstream json;
+		MemoryAccounting::writeJson( json, report );
+		CT_EQUAL( json.str(), std::string{ "[\n"
+			"\t{ \"subsystem\": \"Test \\\"report\\\"\", \"cpuBytes\": 10, \"gpuBytes\": 20, \"objects\": 1"
+			", \"cpuPeak\": 10, \"gpuPeak\": 20, \"cpuBudget\": 0, \"gpuBudget\": 0, \"overBudget\": false }\n"
+			"]" } );
+	}
+}
@@ -0,0 +1,28 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_MemoryAccountingTest_H___
+#define ___CUT_MemoryAccountingTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsMemoryAccountingTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsMemoryAccountingTest();
+		virtual ~CastorUtilsMemoryAccountingTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Usage();
+		void CopyMove();
+		void PeaksBudgets();
+		void ReadBudgets();
+		void Reports();
+	};
+}
+
+#endif
@@ -1,6 +1,9 @@
 ﻿#include "CastorUtilsPixelFormatTest.hpp"
 
 #include <Graphics/PixelBuffer.hpp>
+#include <Graphics/PixelFormatKernels.hpp>
+
+#include <random>
 
 using namespace castor;
 
@@ -444,6 +447,44 @@ namespace
 	{
 		BufferConversionChecker< PF >()();
 	}
+
+	std::vector< uint8_t > doGetRandomBuffer( PixelFormat format
+		, uint32_t count )
+	{
+		std::vector< uint8_t > result( count * PF::getBytesPerPixel( format ) );
+		std::mt19937 engine{ 42u };
+
+		if ( format == PixelFormat::eRGBA32F )
+		{
+			// The scalar conversion to 8 bits is only defined for [0, 1] values.
+			std::uniform_real_distribution< float > distribution{ 0.0f, 1.0f };
+			auto buffer = reinterpret_cast< float * >( result.data() );
+
+			for ( uint32_t i = 0u; i < count * 4u; ++i )
+			{
+				buffer[i] = ( i % 7u ) ? distribution( engine ) : 1.0f;
+			}
+		}
+		else
+		{
+			std::uniform_int_distribution< uint32_t > distribution{ 0u, 255u };
+
+			for ( auto & value : result )
+			{
+				value = uint8_t( distribution( engine ) );
+			}
+
+			if ( format == PixelFormat::eRGBA16F )
+			{
+				// Signed zeroes, denormals, largest finite, infinites and NaNs.
+				std::array< uint16_t, 12u > const specials{ { 0x0000, 0x8000, 0x0001, 0x8001, 0x03FF, 0x0400, 0x7BFF, 0x7C00, 0xFC00, 0x7C01, 0xFE00, 0x3C00 } };
+				auto buffer = reinterpret_cast< uint16_t * >( result.data() );
+				std::copy( specials.begin(), specials.begin() + std::min( size_t( count * 4u ), specials.size() ), buffer );
+			}
+		}
+
+		return result;
+	}
 }
 
 namespace Testing
@@ -461,6 +502,7 @@ namespace Testing
 	{
 		doRegisterTest( "TestPixelConversions", std::bind( &CastorUtilsPixelFormatTest::TestPixelConversions, this ) );
 		doRegisterTest( "TestBufferConversions", std::bind( &CastorUtilsPixelFormatTest::TestBufferConversions, this ) );
+		doRegisterTest( "TestBufferKernels", std::bind( &CastorUtilsPixelFormatTest::TestBufferKernels, this ) );
 	}
 
 	void CastorUtilsPixelFormatTest::TestPixelConversions()
@@ -502,4 +544,116 @@ namespace Testing
 		CheckBufferConversions< PixelFormat::eD24S8 >();
 		CheckBufferConversions< PixelFormat::eS8 >();
 	}
+
+	void CastorUtilsPixelFormatTest::TestBufferKernels()
+	{
+		std::vector< std::pair< PixelFormat, PixelFormat > > const pairs
+		{
+			{ PixelFormat::eA8R8G8B8, PixelFormat::eA8B8G8R8 },
+			{ PixelFormat::eA8B8G8R8, PixelFormat::eA8R8G8B8 },
+			{ PixelFormat::eR8G8B8, PixelFormat::eB8G8R8 },
+			{ PixelFormat::eB8G8R8, PixelFormat::eR8G8B8 },
+			{ PixelFormat::eR8G8B8, PixelFormat::eA8R8G8B8 },
+			{ PixelFormat::eR8G8B8, PixelFormat::eA8B8G8R8 },
+			{ PixelFormat::eB8G8R8, PixelFormat::eA8R8G8B8 },
+			{ PixelFormat::eB8G8R8, PixelFormat::eA8B8G8R8 },
+			{ PixelFormat::eA8R8G8B8, PixelFormat::eR8G8B8 },
+			{ PixelFormat::eA8R8G8B8, PixelFormat::eB8G8R8 },
+			{ PixelFormat::eA8B8G8R8, PixelFormat::eR8G8B8 },
+			{ PixelFormat::eA8B8G8R8, PixelFormat::eB8G8R8 },
+			{ PixelFormat::eA8R8G8B8, PixelFormat::eRGBA32F },
+			{ PixelFormat::eA8B8G8R8, PixelFormat::eRGBA32F },
+			{ PixelFormat::eR8G8B8, PixelFormat::eRGBA32F },
+			{ PixelFormat::eB8G8R8, PixelFormat::eRGBA32F },
+			{ PixelFormat::eRGBA32F, PixelFormat::eA8R8G8B8 },
+			{ PixelFormat::eRGBA16F, PixelFormat::eRGBA32F },
+		};
+		// Odd counts, so that the kernels leave pixels to the scalar tail.
+		std::array< uint32_t, 5u > const counts{ { 1u, 3u, 7u, 17u, 1021u } };
+
+		for ( auto & pair : pairs )
+		{
+			for ( auto count : counts )
+			{
+				auto src = doGetRandomBuffer( pair.first, count );
+				std::vector< uint8_t > reference( count * PF::getBytesPerPixel( pair.second ) );
+				uint8_t const * srcPixel = src.data();
+				uint8_t * dstPixel = reference.data();
+
+				for ( uint32_t i = 0u; i < count; ++i )
+				{
+					PF::convertPixel( pair.first, srcPixel, pair.second, dstPixel );
+				}
+
+				for ( auto kernel = uint32_t( ConversionKernel::eSSE2 ); kernel <= uint32_t( PF::getConversionKernel() ); ++kernel )
+				{
+					std::vector< uint8_t > result( reference.size() );
+
+					if ( PF::convertBufferKernel( ConversionKernel( kernel )
+						, pair.first
+						, src.data()
+						, uint32_t( src.size() )
+						, pair.second
+						, result.data()
+						, uint32_t( result.size() ) ) )
+					{
+						CT_CHECK( result == reference );
+					}
+				}
+			}
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsPixelFormatBench::CastorUtilsPixelFormatBench()
+		: BenchCase( "CastorUtilsPixelFormatBench" )
+	{
+	}
+
+	CastorUtilsPixelFormatBench::~CastorUtilsPixelFormatBench()
+	{
+	}
+
+	void CastorUtilsPixelFormatBench::Execute()
+	{
+		doBenchConversion( "4K", 3840u, 2160u, PixelFormat::eR8G8B8, PixelFormat::eA8R8G8B8 );
+		doBenchConversion( "8K", 7680u, 4320u, PixelFormat::eR8G8B8, PixelFormat::eA8R8G8B8 );
+		doBenchConversion( "4K", 3840u, 2160u, PixelFormat::eA8B8G8R8, PixelFormat::eA8R8G8B8 );
+		doBenchConversion( "8K", 7680u, 4320u, PixelFormat::eA8B8G8R8, PixelFormat::eA8R8G8B8 );
+		doBenchConversion( "4K", 3840u, 2160u, PixelFormat::eA8R8G8B8, PixelFormat::eRGBA32F );
+		doBenchConversion( "4K", 3840u, 2160u, PixelFormat::eRGBA16F, PixelFormat::eRGBA32F );
+	}
+
+	void CastorUtilsPixelFormatBench::doBenchConversion( std::string const & name
+		, uint32_t width
+		, uint32_t height
+		, PixelFormat srcFormat
+		, PixelFormat dstFormat )
+	{
+		// Buffers are allocated per bench, an 8K RGBA32F image would take 530 MB.
+		uint32_t count = width * height;
+		std::vector< uint8_t > src( count * PF::getBytesPerPixel( srcFormat ), uint8_t( 0x7F ) );
+		std::vector< uint8_t > dst( count * PF::getBytesPerPixel( dstFormat ) );
+		auto prefix = name + " " + string::stringCast< char >( PF::getFormatName( srcFormat ) ) + " to " + string::stringCast< char >( PF::getFormatName( dstFormat ) );
+		auto scalar = [&]()
+		{
+			uint8_t const * srcPixel = src.data();
+			uint8_t * dstPixel = dst.data();
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				PF::convertPixel( srcFormat, srcPixel, dstFormat, dstPixel );
+			}
+
+			doNotOptimizeAway( dst );
+		};
+		auto vectorised = [&]()
+		{
+			PF::convertBuffer( srcFormat, src.data(), uint32_t( src.size() ), dstFormat, dst.data(), uint32_t( dst.size() ) );
+			doNotOptimizeAway( dst );
+		};
+		doBench( prefix + " scalar", scalar, 10u );
+		doBench( prefix + " kernel", vectorised, 10u );
+	}
 }
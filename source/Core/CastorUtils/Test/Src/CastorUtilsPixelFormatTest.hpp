@@ -19,6 +19,23 @@ namespace Testing
 	private:
 		void TestPixelConversions();
 		void TestBufferConversions();
+		void TestBufferKernels();
+	};
+
+	class CastorUtilsPixelFormatBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsPixelFormatBench();
+		virtual ~CastorUtilsPixelFormatBench();
+		virtual void Execute();
+
+	private:
+		void doBenchConversion( std::string const & name
+			, uint32_t width
+			, uint32_t height
+			, castor::PixelFormat srcFormat
+			, castor::PixelFormat dstFormat );
 	};
 }
 
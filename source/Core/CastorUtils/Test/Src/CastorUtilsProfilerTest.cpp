@@ -0,0 +1,222 @@
+#include "CastorUtilsProfilerTest.hpp"
+
+#include <Miscellaneous/Profiler.hpp>
+
+#include <sstream>
+#include <thread>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		size_t doCount( std::vector< ProfileEvent > const & events
+			, ProfileEventType type )
+		{
+			return size_t( std::count_if( events.begin()
+				, events.end()
+				, [type]( ProfileEvent const & event )
+				{
+					return event.type == type;
+				} ) );
+		}
+
+		ProfileEvent const * doFind( std::vector< ProfileEvent > const & events
+			, std::string const & name )
+		{
+			auto it = std::find_if( events.begin()
+				, events.end()
+				, [&name]( ProfileEvent const & event )
+				{
+					return event.zone && event.zone->name == name;
+				} );
+			return it == events.end()
+				? nullptr
+				: &( *it );
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsProfilerTest::CastorUtilsProfilerTest()
+		: TestCase( "CastorUtilsProfilerTest" )
+	{
+	}
+
+	CastorUtilsProfilerTest::~CastorUtilsProfilerTest()
+	{
+	}
+
+	void CastorUtilsProfilerTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsProfilerTest::NoCapture", std::bind( &CastorUtilsProfilerTest::NoCapture, this ) );
+		doRegisterTest( "CastorUtilsProfilerTest::NestedZones", std::bind( &CastorUtilsProfilerTest::NestedZones, this ) );
+		doRegisterTest( "CastorUtilsProfilerTest::MultipleThreads", std::bind( &CastorUtilsProfilerTest::MultipleThreads, this ) );
+		doRegisterTest( "CastorUtilsProfilerTest::RingOverflow", std::bind( &CastorUtilsProfilerTest::RingOverflow, this ) );
+		doRegisterTest( "CastorUtilsProfilerTest::ChromeTrace", std::bind( &CastorUtilsProfilerTest::ChromeTrace, this ) );
+		doRegisterTest( "CastorUtilsProfilerTest::CaptureIndex", std::bind( &CastorUtilsProfilerTest::CaptureIndex, this ) );
+	}
+
+	void CastorUtilsProfilerTest::NoCapture()
+	{
+		Profiler::start();
+		Profiler::stop();
+		CT_CHECK( !Profiler::isCapturing() );
+		{
+			CASTOR_PROFILE_ZONE( "NoCapture" );
+		}
+		Profiler::flush();
+		CT_CHECK( Profiler::getEvents().empty() );
+	}
+
+	void CastorUtilsProfilerTest::NestedZones()
+	{
+		Profiler::start();
+		CT_CHECK( Profiler::isCapturing() );
+		{
+			CASTOR_PROFILE_ZONE( "Outer" );
+			{
+				CASTOR_PROFILE_ZONE( "Inner" );
+			}
+			auto & zone = Profiler::intern( "Interned", "test" );
+			CT_CHECK( &zone == &Profiler::intern( "Interned", "test" ) );
+			auto begin = Profiler::getTimestamp();
+			Profiler::recordCpuSpan( zone, begin, Profiler::getTimestamp() );
+			Profiler::recordGpuSpan( zone, begin, Nanoseconds{ 1000 } );
+		}
+		Profiler::markFrame();
+		Profiler::stop();
+		auto events = Profiler::getEvents();
+		CT_EQUAL( doCount( events, ProfileEventType::eCpu ), 3u );
+		CT_EQUAL( doCount( events, ProfileEventType::eGpu ), 1u );
+		CT_EQUAL( doCount( events, ProfileEventType::eFrame ), 1u );
+		auto outer = doFind( events, "Outer" );
+		auto inner = doFind( events, "Inner" );
+		CT_REQUIRE( outer && inner );
+		CT_EQUAL( outer->value, 0u );
+		CT_EQUAL( inner->value, 1u );
+		CT_CHECK( outer->begin <= inner->begin );
+		CT_CHECK( inner->end <= outer->end );
+		CT_EQUAL( doFind( events, "Interned" )->value, 1u );
+	}
+
+	void CastorUtilsProfilerTest::MultipleThreads()
+	{
+		uint32_t constexpr ThreadCount = 4u;
+		uint32_t constexpr ZoneCount = 1000u;
+		Profiler::start();
+		std::vector< std::thread > threads;
+
+		for ( uint32_t i = 0u; i < ThreadCount; ++i )
+		{
+			threads.emplace_back( []()
+			{
+				for ( uint32_t j = 0u; j < ZoneCount; ++j )
+				{
+					CASTOR_PROFILE_ZONE( "Worker" );
+				}
+			} );
+		}
+
+		// Flush while the threads produce, to exercise the rings concurrently.
+		for ( uint32_t i = 0u; i < 10u; ++i )
+		{
+			Profiler::flush();
+			std::this_thread::yield();
+		}
+
+		for ( auto & thread : threads )
+		{
+			thread.join();
+		}
+
+		Profiler::stop();
+		CT_EQUAL( doCount( Profiler::getEvents(), ProfileEventType::eCpu ), ThreadCount * ZoneCount );
+		CT_EQUAL( Profiler::getDroppedCount(), 0u );
+	}
+
+	void CastorUtilsProfilerTest::RingOverflow()
+	{
+		uint32_t const ringSize = Profiler::RingSize;
+		Profiler::start();
+
+		for ( uint32_t i = 0u; i < ringSize + 10u; ++i )
+		{
+			CASTOR_PROFILE_ZONE( "Overflow" );
+		}
+
+		CT_EQUAL( Profiler::getDroppedCount(), 10u );
+		Profiler::stop();
+		CT_EQUAL( doCount( Profiler::getEvents(), ProfileEventType::eCpu ), ringSize );
+	}
+
+	void CastorUtilsProfilerTest::ChromeTrace()
+	{
+		Profiler::start();
+		{
+			CASTOR_PROFILE_ZONE_CAT( "Quoted \"zone\"", "test" );
+		}
+		Profiler::markFrame();
+		Profiler::stop();
+		std::stringstream stream;
+		Profiler::writeChromeTrace( stream );
+		auto json = stream.str();
+		CT_CHECK( json.find( "{\"traceEvents\":[" ) == 0u );
+		CT_CHECK( json.find( R"("name":"Quoted \"zone\"","cat":"test","ph":"X")" ) != std::string::npos );
+		CT_CHECK( json.find( R"("name":"Frame","cat":"frame","ph":"i")" ) != std::string::npos );
+		CT_CHECK( json.find( R"("args":{"name":"GPU"})" ) != std::string::npos );
+		CT_CHECK( json.find( "\"displayTimeUnit\":\"ns\"}" ) != std::string::npos );
+	}
+
+	void CastorUtilsProfilerTest::CaptureIndex()
+	{
+		Profiler::start();
+		auto const first = Profiler::getCaptureIndex();
+		CT_CHECK( first != 0u );
+		Profiler::stop();
+		CT_EQUAL( Profiler::getCaptureIndex(), first );
+		Profiler::start();
+		CT_EQUAL( Profiler::getCaptureIndex(), first + 1u );
+		Profiler::stop();
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsProfilerBench::CastorUtilsProfilerBench()
+		: BenchCase( "CastorUtilsProfilerBench" )
+	{
+	}
+
+	CastorUtilsProfilerBench::~CastorUtilsProfilerBench()
+	{
+	}
+
+	void CastorUtilsProfilerBench::Execute()
+	{
+		uint32_t constexpr ZoneCount = Profiler::RingSize / 2u;
+		Profiler::stop();
+		doBench( "Zones, no capture", [&]()
+			{
+				for ( uint32_t i = 0u; i < ZoneCount; ++i )
+				{
+					CASTOR_PROFILE_ZONE( "Bench" );
+				}
+			}, 100u );
+		Profiler::start();
+		doBench( "Zones, capturing", [&]()
+			{
+				for ( uint32_t i = 0u; i < ZoneCount; ++i )
+				{
+					CASTOR_PROFILE_ZONE( "Bench" );
+				}
+
+				Profiler::flush();
+			}, 100u );
+		Profiler::stop();
+		Profiler::start();
+		Profiler::stop();
+	}
+
+	//*********************************************************************************************
+}
@@ -0,0 +1,38 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_ProfilerTest_H___
+#define ___CUT_ProfilerTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsProfilerTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsProfilerTest();
+		virtual ~CastorUtilsProfilerTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void NoCapture();
+		void NestedZones();
+		void MultipleThreads();
+		void RingOverflow();
+		void ChromeTrace();
+		void CaptureIndex();
+	};
+
+	class CastorUtilsProfilerBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsProfilerBench();
+		virtual ~CastorUtilsProfilerBench();
+		virtual void Execute();
+	};
+}
+
+#endif
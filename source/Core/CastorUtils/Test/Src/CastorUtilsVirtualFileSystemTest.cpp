@@ -0,0 +1,214 @@
+#include "CastorUtilsVirtualFileSystemTest.hpp"
+
+#include <Data/BinaryFile.hpp>
+#include <Data/TextFile.hpp>
+#include <Data/VirtualFileSystem.hpp>
+#include <Data/ZipArchive.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+using namespace castor;
+
+namespace
+{
+	Path const Folder{ cuT( "vfs" ) };
+	Path const SubFolder{ Folder / cuT( "sub" ) };
+	Path const BinName{ Folder / cuT( "binFile.bin" ) };
+	Path const TxtName{ SubFolder / cuT( "txtFile.txt" ) };
+	Path const ZipName{ cuT( "vfsFile.zip" ) };
+	String const FirstLine{ cuT( "Coucou, comment allez-vous?" ) };
+	String const SecondLine{ cuT( "Très bien, merci." ) };
+
+	ByteArray doGetBinData()
+	{
+		ByteArray result( 100000u );
+		uint32_t seed = 0x12345678u;
+
+		for ( auto & value : result )
+		{
+			seed = seed * 1664525u + 1013904223u;
+			value = uint8_t( seed >> 28u );
+		}
+
+		return result;
+	}
+
+	bool doCreateFiles()
+	{
+		bool result = ( File::directoryExists( Folder ) || File::directoryCreate( Folder ) )
+			&& ( File::directoryExists( SubFolder ) || File::directoryCreate( SubFolder ) );
+
+		if ( result )
+		{
+			{
+				auto data = doGetBinData();
+				BinaryFile binary( BinName, File::OpenMode::eWrite );
+				binary.writeArray( data.data(), data.size() );
+			}
+			{
+				TextFile text( TxtName, File::OpenMode::eWrite );
+				text.writeText( FirstLine + cuT( "\n" ) + SecondLine + cuT( "\n" ) );
+			}
+			{
+				ZipArchive archive( ZipName, File::OpenMode::eWrite );
+				archive.addFile( BinName );
+				archive.addFile( TxtName );
+				archive.deflate();
+			}
+		}
+
+		return result;
+	}
+
+	void doDeleteFiles()
+	{
+		std::remove( string::stringCast< char >( BinName ).c_str() );
+		std::remove( string::stringCast< char >( TxtName ).c_str() );
+		std::remove( string::stringCast< char >( ZipName ).c_str() );
+		File::directoryDelete( SubFolder );
+		File::directoryDelete( Folder );
+	}
+}
+
+namespace Testing
+{
+	CastorUtilsVirtualFileSystemTest::CastorUtilsVirtualFileSystemTest()
+		:	TestCase( "CastorUtilsVirtualFileSystemTest" )
+	{
+	}
+
+	CastorUtilsVirtualFileSystemTest::~CastorUtilsVirtualFileSystemTest()
+	{
+	}
+
+	void CastorUtilsVirtualFileSystemTest::doRegisterTests()
+	{
+		doRegisterTest( "ArchiveMount", std::bind( &CastorUtilsVirtualFileSystemTest::ArchiveMount, this ) );
+		doRegisterTest( "ArchiveParallelReads", std::bind( &CastorUtilsVirtualFileSystemTest::ArchiveParallelReads, this ) );
+		doRegisterTest( "DirectoryMount", std::bind( &CastorUtilsVirtualFileSystemTest::DirectoryMount, this ) );
+	}
+
+	void CastorUtilsVirtualFileSystemTest::ArchiveMount()
+	{
+		CT_REQUIRE( doCreateFiles() );
+		Path root{ cuT( "mounted" ) };
+		VirtualFileSystem::mountArchive( root, ZipName );
+		CT_CHECK( VirtualFileSystem::isMounted( root / BinName ) );
+		CT_CHECK( VirtualFileSystem::fileExists( root / BinName ) );
+		CT_CHECK( VirtualFileSystem::fileExists( root / TxtName ) );
+		CT_CHECK( VirtualFileSystem::directoryExists( root / SubFolder ) );
+		CT_CHECK( !VirtualFileSystem::fileExists( root / cuT( "missing.txt" ) ) );
+		CT_CHECK( !VirtualFileSystem::isOnDisk( root / BinName ) );
+		Path resolved;
+		CT_CHECK( VirtualFileSystem::resolve( root / BinName, resolved ) );
+		CT_EQUAL( resolved, root / BinName );
+
+		{
+			// The entry has been extracted under the mount root, for the libraries which only open disk files.
+			auto data = doGetBinData();
+			std::ifstream extracted( string::stringCast< char >( resolved ), std::ios::binary );
+			CT_REQUIRE( extracted.is_open() );
+			ByteArray read( data.size() );
+			extracted.read( reinterpret_cast< char * >( read.data() ), std::streamsize( read.size() ) );
+			CT_CHECK( read == data );
+		}
+
+		{
+			PathArray files;
+			CT_CHECK( VirtualFileSystem::listDirectoryFiles( root, files, true ) );
+			CT_EQUAL( files.size(), 2u );
+			files.clear();
+			CT_CHECK( VirtualFileSystem::listDirectoryFiles( root / Folder, files, false ) );
+			CT_EQUAL( files.size(), 1u );
+		}
+		{
+			// Random access in a file read from the archive.
+			auto data = doGetBinData();
+			BinaryFile binary( root / BinName, File::OpenMode::eRead );
+			CT_EQUAL( binary.getLength(), data.size() );
+			ByteArray read( 1000u );
+			CT_CHECK( binary.seek( 50000 ) == 0 );
+			CT_EQUAL( binary.readArray( read.data(), read.size() ), read.size() );
+			CT_CHECK( std::equal( read.begin(), read.end(), data.begin() + 50000 ) );
+			CT_CHECK( binary.seek( -10, File::OffsetMode::eEnd ) == 0 );
+			CT_EQUAL( binary.readArray( read.data(), read.size() ), 10u );
+			CT_CHECK( !binary.isOk() );
+		}
+		{
+			TextFile text( root / TxtName, File::OpenMode::eRead );
+			String line;
+			text.readLine( line, 1024u );
+			CT_EQUAL( line, FirstLine );
+		}
+
+		VirtualFileSystem::unmount( root );
+		CT_CHECK( !VirtualFileSystem::fileExists( root / BinName ) );
+		CT_CHECK( !File::fileExists( resolved ) );
+		CT_CHECK( !File::directoryExists( root ) );
+		doDeleteFiles();
+	}
+
+	void CastorUtilsVirtualFileSystemTest::ArchiveParallelReads()
+	{
+		CT_REQUIRE( doCreateFiles() );
+		Path root{ cuT( "parallel" ) };
+		VirtualFileSystem::mountArchive( root, ZipName );
+		auto data = doGetBinData();
+		std::vector< std::thread > threads;
+		std::atomic_uint failures{ 0u };
+
+		for ( uint32_t i = 0u; i < 4u; ++i )
+		{
+			threads.emplace_back( [&root, &data, &failures]()
+			{
+				for ( uint32_t j = 0u; j < 20u; ++j )
+				{
+					ByteArray content;
+
+					if ( !VirtualFileSystem::readFile( root / BinName, content )
+						|| content != data )
+					{
+						++failures;
+					}
+				}
+			} );
+		}
+
+		for ( auto & thread : threads )
+		{
+			thread.join();
+		}
+
+		CT_EQUAL( failures.load(), 0u );
+		VirtualFileSystem::unmount( root );
+		doDeleteFiles();
+	}
+
+	void CastorUtilsVirtualFileSystemTest::DirectoryMount()
+	{
+		CT_REQUIRE( doCreateFiles() );
+		Path root{ cuT( "directory" ) };
+		VirtualFileSystem::mountDirectory( root, Folder );
+		Path relative = Path{ cuT( "sub" ) } / cuT( "txtFile.txt" );
+		CT_CHECK( VirtualFileSystem::fileExists( root / relative ) );
+		Path resolved;
+		CT_CHECK( VirtualFileSystem::resolve( root / relative, resolved ) );
+		CT_EQUAL( resolved, TxtName );
+
+		{
+			TextFile text( root / relative, File::OpenMode::eRead );
+			String line;
+			text.readLine( line, 1024u );
+			CT_EQUAL( line, FirstLine );
+		}
+
+		// The paths that are not mounted are served by the disk.
+		CT_CHECK( VirtualFileSystem::fileExists( BinName ) );
+		VirtualFileSystem::unmount( root );
+		CT_CHECK( !VirtualFileSystem::fileExists( root / relative ) );
+		doDeleteFiles();
+	}
+}
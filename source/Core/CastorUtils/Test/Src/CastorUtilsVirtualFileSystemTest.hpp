@@ -0,0 +1,26 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_VIRTUAL_FILE_SYSTEM_TEST___
+#define ___CUT_VIRTUAL_FILE_SYSTEM_TEST___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsVirtualFileSystemTest
+		:	public TestCase
+	{
+	public:
+		CastorUtilsVirtualFileSystemTest();
+		virtual ~CastorUtilsVirtualFileSystemTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void ArchiveMount();
+		void ArchiveParallelReads();
+		void DirectoryMount();
+	};
+}
+
+#endif
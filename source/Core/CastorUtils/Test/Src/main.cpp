@@ -6,9 +6,19 @@
 #include "BenchManager.hpp"
 #include "OpenClBench.hpp"
 #include "CastorUtilsArrayViewTest.hpp"
+#include "CastorUtilsBakedTextureTest.hpp"
+#include "CastorUtilsBenchStatisticsTest.hpp"
 #include "CastorUtilsBuddyAllocatorTest.hpp"
+#include "CastorUtilsCollectionTest.hpp"
+#include "CastorUtilsFileParserTest.hpp"
+#include "CastorUtilsHandleRegistryTest.hpp"
+#include "CastorUtilsImageResamplerTest.hpp"
+#include "CastorUtilsLoggerTest.hpp"
+#include "CastorUtilsMathBatchTest.hpp"
 #include "CastorUtilsMatrixTest.hpp"
 #include "CastorUtilsPixelFormatTest.hpp"
+#include "CastorUtilsProfilerTest.hpp"
+#include "CastorUtilsMemoryAccountingTest.hpp"
 #include "CastorUtilsStringTest.hpp"
 #include "CastorUtilsZipTest.hpp"
 #include "CastorUtilsUniqueTest.hpp"
@@ -16,17 +26,13 @@
 #include "CastorUtilsQuaternionTest.hpp"
 #include "CastorUtilsSignalTest.hpp"
 #include "CastorUtilsThreadPoolTest.hpp"
+#include "CastorUtilsVirtualFileSystemTest.hpp"
 #include "CastorUtilsWorkerThreadTest.hpp"
 
 int main( int argc, char const * argv[] )
 {
 	int iReturn = EXIT_SUCCESS;
-	int iCount = 1;
-
-	if ( argc == 2 )
-	{
-		iCount = std::max< int >( 1, atoi( argv[2] ) );
-	}
+	int iCount = Testing::BenchManager::parseArguments( argc, argv );
 
 #if defined( NDEBUG )
 	castor::Logger::initialise( castor::LogType::eInfo );
@@ -38,17 +44,33 @@ int main( int argc, char const * argv[] )
 #if defined( CASTOR_USE_OCL )
 	Testing::registerType( std::make_unique< Testing::OpenCLBench >() );
 #endif
+	Testing::registerType( std::make_unique< Testing::CastorUtilsBenchStatisticsTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsBuddyAllocatorTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsSignalTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsCollectionTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsHandleRegistryTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsWorkerThreadTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsThreadPoolTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsMatrixBench >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsArrayViewTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsUniqueTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsMatrixTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsMathBatchTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsMathBatchBench >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsPixelFormatTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsPixelFormatBench >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsProfilerTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsProfilerBench >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsMemoryAccountingTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsLoggerTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsLoggerBench >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsBakedTextureTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsImageResamplerTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsImageResamplerBench >() );
 	//Testing::registerType( std::make_unique< Testing::CastorUtilsStringTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsZipTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsVirtualFileSystemTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsFileParserTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsObjectsPoolTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsQuaternionTest >() );
 	BENCHLOOP( iCount, iReturn );
@@ -1,6 +1,7 @@
 #include "AssimpImporter.hpp"
 
 #include <Design/ArrayView.hpp>
+#include <Data/VirtualFileSystem.hpp>
 
 #include <Cache/GeometryCache.hpp>
 #include <Cache/MaterialCache.hpp>
@@ -26,6 +27,8 @@
 
 #include <Log/Logger.hpp>
 
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
 #include <assimp/version.h>
 
 using namespace castor3d;
@@ -37,6 +40,117 @@ namespace C3dAssimp
 
 	namespace
 	{
+		/*!
+		\~english
+		\brief		Assimp read only stream over a file read from the virtual file system.
+		\~french
+		\brief		Flux Assimp en lecture seule sur un fichier lu depuis le système de fichiers virtuel.
+		*/
+		class VfsIOStream
+			: public Assimp::IOStream
+		{
+		public:
+			explicit VfsIOStream( ByteArray && content )
+				: m_content{ std::move( content ) }
+			{
+			}
+
+			size_t Read( void * buffer, size_t size, size_t count )override
+			{
+				size_t const available = size
+					? ( m_content.size() - m_cursor ) / size
+					: 0u;
+				count = std::min( count, available );
+				std::memcpy( buffer, m_content.data() + m_cursor, size * count );
+				m_cursor += size * count;
+				return count;
+			}
+
+			size_t Write( void const * buffer, size_t size, size_t count )override
+			{
+				return 0u;
+			}
+
+			aiReturn Seek( size_t offset, aiOrigin origin )override
+			{
+				size_t cursor = offset;
+
+				if ( origin == aiOrigin_CUR )
+				{
+					cursor += m_cursor;
+				}
+				else if ( origin == aiOrigin_END )
+				{
+					cursor = m_content.size() - offset;
+				}
+
+				if ( cursor > m_content.size() )
+				{
+					return aiReturn_FAILURE;
+				}
+
+				m_cursor = cursor;
+				return aiReturn_SUCCESS;
+			}
+
+			size_t Tell()const override
+			{
+				return m_cursor;
+			}
+
+			size_t FileSize()const override
+			{
+				return m_content.size();
+			}
+
+			void Flush()override
+			{
+			}
+
+		private:
+			ByteArray m_content;
+			size_t m_cursor{ 0u };
+		};
+		/*!
+		\~english
+		\brief		Assimp file system reading through the virtual file system, so models can be loaded from mounted archives.
+		\~french
+		\brief		Système de fichiers Assimp lisant via le système de fichiers virtuel, pour charger des modèles depuis des archives montées.
+		*/
+		class VfsIOSystem
+			: public Assimp::IOSystem
+		{
+		public:
+			bool Exists( char const * file )const override
+			{
+				return VirtualFileSystem::fileExists( Path{ string::stringCast< xchar >( file ) } );
+			}
+
+			char getOsSeparator()const override
+			{
+				return '/';
+			}
+
+			Assimp::IOStream * Open( char const * file, char const * mode )override
+			{
+				Assimp::IOStream * result = nullptr;
+				ByteArray content;
+
+				if ( std::string{ mode }.find_first_of( "wa+" ) == std::string::npos
+					&& VirtualFileSystem::readFile( Path{ string::stringCast< xchar >( file ) }, content ) )
+				{
+					result = new VfsIOStream{ std::move( content ) };
+				}
+
+				return result;
+			}
+
+			void Close( Assimp::IOStream * stream )override
+			{
+				delete stream;
+			}
+		};
+
 		aiNodeAnim const * const doFindNodeAnim( const aiAnimation & animation
 			, const String & nodeName )
 		{
@@ -490,6 +604,12 @@ namespace C3dAssimp
 			flags |= aiProcess_CalcTangentSpace;
 		}
 
+		if ( VirtualFileSystem::isMounted( m_fileName ) )
+		{
+			// The importer takes ownership of the handler.
+			importer.SetIOHandler( new VfsIOSystem );
+		}
+
 		// And have it read the given file with some postprocessing
 		aiScene const * aiScene = importer.ReadFile( string::stringCast< char >( m_fileName ), flags );
 
@@ -538,7 +658,7 @@ namespace C3dAssimp
 					{
 						// Workaround to load multiple animations with MD5 models.
 						PathArray files;
-						File::listDirectoryFiles( m_fileName.getPath(), files );
+						VirtualFileSystem::listDirectoryFiles( m_fileName.getPath(), files );
 
 						for ( auto file : files )
 						{
@@ -2,6 +2,7 @@
 
 #include "ObjGroup.hpp"
 
+#include <Data/VirtualFileSystem.hpp>
 #include <Graphics/Colour.hpp>
 #include <Graphics/Image.hpp>
 
@@ -198,17 +199,12 @@ namespace Obj
 
 	void ObjImporter::doReadObjFile( Mesh & mesh )
 	{
-		std::ifstream file( m_fileName.c_str() );
-		file.seekg( 0, std::ios::end );
-		size_t size = size_t( file.tellg() );
-		file.seekg( 0, std::ios::beg );
-		std::string content;
-		content.resize( size + 1 );
-		file.read( &content[0], size );
-		auto lines = std::count( content.begin(), content.end(), '\n' );
+		// The file may come from a mounted archive, hence it is read through the virtual file system.
+		ByteArray content;
+		VirtualFileSystem::readFile( m_fileName, content );
+		auto lines = std::count( content.begin(), content.end(), uint8_t( '\n' ) );
+		std::istringstream file( std::string( content.begin(), content.end() ) );
 		content.clear();
-		file.clear();
-		file.seekg( 0, std::ios::beg );
 		std::string line;
 		std::string mtlfile;
 		uint32_t nf = 0u;
@@ -296,7 +292,7 @@ namespace Obj
 		}
 
 		// Material description file
-		if ( File::fileExists( m_filePath / mtlfile ) )
+		if ( VirtualFileSystem::fileExists( m_filePath / mtlfile ) )
 		{
 			doReadMaterials( mesh, m_filePath / mtlfile );
 		}
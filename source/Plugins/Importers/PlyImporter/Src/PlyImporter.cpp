@@ -23,6 +23,8 @@
 #include <Scene/Scene.hpp>
 #include <Texture/TextureUnit.hpp>
 
+#include <Data/VirtualFileSystem.hpp>
+
 using namespace castor3d;
 using namespace castor;
 
@@ -62,8 +64,10 @@ namespace C3dPly
 		String name = m_fileName.getFileName();
 		String meshName = name.substr( 0, name.find_last_of( '.' ) );
 		String materialName = meshName;
-		std::ifstream isFile;
-		isFile.open( string::stringCast< char >( m_fileName ).c_str(), std::ios::in );
+		// The file may come from a mounted archive, hence it is read through the virtual file system.
+		ByteArray content;
+		VirtualFileSystem::readFile( m_fileName, content );
+		std::istringstream isFile( std::string( content.begin(), content.end() ) );
 		std::string strLine;
 		std::istringstream ssToken;
 		String::size_type stIndex;
@@ -244,7 +248,6 @@ namespace C3dPly
 		}
 
 		submesh->setIndexMapping( mapping );
-		isFile.close();
 		return result;
 	}
 }
@@ -40,6 +40,7 @@ namespace GlRender
 		m_pfnGetTexImage = &glGetTexImage;
 		gl_api::getFunction( m_pfnTexImage3D, cuT( "glTexImage3D" ), cuT( "EXT" ) );
 		gl_api::getFunction( m_pfnTexSubImage3D, cuT( "glTexSubImage3D" ), cuT( "EXT" ) );
+		gl_api::getFunction( m_pfnCompressedTexSubImage2D, cuT( "glCompressedTexSubImage2D" ), cuT( "ARB" ) );
 		gl_api::getFunction( m_pfnGenerateMipmap, cuT( "glGenerateMipmap" ), cuT( "EXT" ) );
 	}
 
@@ -58,6 +59,7 @@ namespace GlRender
 		gl_api::getFunction( m_pfnTextureSubImage1D, cuT( "glTextureSubImage1D" ), cuT( "EXT" ) );
 		gl_api::getFunction( m_pfnTextureSubImage2D, cuT( "glTextureSubImage2D" ), cuT( "EXT" ) );
 		gl_api::getFunction( m_pfnTextureSubImage3D, cuT( "glTextureSubImage3D" ), cuT( "EXT" ) );
+		gl_api::getFunction( m_pfnCompressedTextureSubImage2D, cuT( "glCompressedTextureSubImage2D" ), cuT( "EXT" ) );
 		gl_api::getFunction( m_pfnTextureImage1D, cuT( "glTextureImage1D" ), cuT( "EXT" ) );
 		gl_api::getFunction( m_pfnTextureImage2D, cuT( "glTextureImage2D" ), cuT( "EXT" ) );
 		gl_api::getFunction( m_pfnTextureImage3D, cuT( "glTextureImage3D" ), cuT( "EXT" ) );
@@ -117,6 +117,7 @@ namespace GlRender
 		virtual void TexSubImage2D( GlTextureStorageType p_target, int level, castor::Position const & p_position, castor::Size const & p_size, GlFormat format, GlType type, void const * data )const = 0;
 		virtual void TexSubImage2D( GlTextureStorageType p_target, int level, castor::Rectangle const & p_rect, GlFormat format, GlType type, void const * data )const = 0;
 		virtual void TexSubImage3D( GlTextureStorageType p_target, int level, int xoffset, int yoffset, int zoffset, int width, int height, int depth, GlFormat format, GlType type, void const * data )const = 0;
+		virtual void CompressedTexSubImage2D( GlTextureStorageType p_target, int level, int xoffset, int yoffset, int width, int height, GlInternal format, int imageSize, void const * data )const = 0;
 		virtual void TexImage1D( GlTextureStorageType p_target, int level, GlInternal internalFormat, int width, int border, GlFormat format, GlType type, void const * data )const = 0;
 		virtual void TexImage2D( GlTextureStorageType p_target, int level, GlInternal internalFormat, int width, int height, int border, GlFormat format, GlType type, void const * data )const = 0;
 		virtual void TexImage2D( GlTextureStorageType p_target, int level, GlInternal internalFormat, castor::Size const & p_size, int border, GlFormat format, GlType type, void const * data )const = 0;
@@ -136,6 +137,7 @@ namespace GlRender
 		inline void TexSubImage2D( GlTextureStorageType p_target, int level, castor::Position const & p_position, castor::Size const & p_size, GlFormat format, GlType type, void const * data )const override;
 		inline void TexSubImage2D( GlTextureStorageType p_target, int level, castor::Rectangle const & p_rect, GlFormat format, GlType type, void const * data )const override;
 		inline void TexSubImage3D( GlTextureStorageType p_target, int level, int xoffset, int yoffset, int zoffset, int width, int height, int depth, GlFormat format, GlType type, void const * data )const override;
+		inline void CompressedTexSubImage2D( GlTextureStorageType p_target, int level, int xoffset, int yoffset, int width, int height, GlInternal format, int imageSize, void const * data )const override;
 		inline void TexImage1D( GlTextureStorageType p_target, int level, GlInternal internalFormat, int width, int border, GlFormat format, GlType type, void const * data )const override;
 		inline void TexImage2D( GlTextureStorageType p_target, int level, GlInternal internalFormat, int width, int height, int border, GlFormat format, GlType type, void const * data )const override;
 		inline void TexImage2D( GlTextureStorageType p_target, int level, GlInternal internalFormat, castor::Size const & p_size, int border, GlFormat format, GlType type, void const * data )const override;
@@ -146,6 +148,7 @@ namespace GlRender
 		GlFunction< void, uint32_t, int , int , int , uint32_t , uint32_t , void const * > m_pfnTexSubImage1D;
 		GlFunction< void, uint32_t, int , int , int , int , int , uint32_t , uint32_t , void const * > m_pfnTexSubImage2D;
 		GlFunction< void, uint32_t, int , int , int , int , int , int , int , uint32_t , uint32_t , void const * > m_pfnTexSubImage3D;
+		GlFunction< void, uint32_t, int , int , int , int , int , uint32_t , int , void const * > m_pfnCompressedTexSubImage2D;
 		GlFunction< void, uint32_t, int , int , int , int , uint32_t , uint32_t , void const * > m_pfnTexImage1D;
 		GlFunction< void, uint32_t, int , int , int , int , int , uint32_t , uint32_t , void const * > m_pfnTexImage2D;
 		GlFunction< void, uint32_t, int , int , int , int , int , int , uint32_t , uint32_t , void const * > m_pfnTexImage3D;
@@ -168,6 +171,7 @@ namespace GlRender
 		inline void TexSubImage2D( GlTextureStorageType p_target, int level, castor::Position const & p_position, castor::Size const & p_size, GlFormat format, GlType type, void const * data )const override;
 		inline void TexSubImage2D( GlTextureStorageType p_target, int level, castor::Rectangle const & p_rect, GlFormat format, GlType type, void const * data )const override;
 		inline void TexSubImage3D( GlTextureStorageType p_target, int level, int xoffset, int yoffset, int zoffset, int width, int height, int depth, GlFormat format, GlType type, void const * data )const override;
+		inline void CompressedTexSubImage2D( GlTextureStorageType p_target, int level, int xoffset, int yoffset, int width, int height, GlInternal format, int imageSize, void const * data )const override;
 		inline void TexImage1D( GlTextureStorageType p_target, int level, GlInternal internalFormat, int width, int border, GlFormat format, GlType type, void const * data )const override;
 		inline void TexImage2D( GlTextureStorageType p_target, int level, GlInternal internalFormat, int width, int height, int border, GlFormat format, GlType type, void const * data )const override;
 		inline void TexImage2D( GlTextureStorageType p_target, int level, GlInternal internalFormat, castor::Size const & p_size, int border, GlFormat format, GlType type, void const * data )const override;
@@ -178,6 +182,7 @@ namespace GlRender
 		GlFunction< void, uint32_t, uint32_t , int , int , int , uint32_t , uint32_t , void const * > m_pfnTextureSubImage1D;
 		GlFunction< void, uint32_t, uint32_t , int , int , int , int , int , uint32_t , uint32_t , void const * > m_pfnTextureSubImage2D;
 		GlFunction< void, uint32_t, uint32_t , int , int , int , int , int , int , int , uint32_t , uint32_t , void const * > m_pfnTextureSubImage3D;
+		GlFunction< void, uint32_t, uint32_t , int , int , int , int , int , uint32_t , int , void const * > m_pfnCompressedTextureSubImage2D;
 		GlFunction< void, uint32_t, uint32_t , int , int , int , int , uint32_t , uint32_t , void const * > m_pfnTextureImage1D;
 		GlFunction< void, uint32_t, uint32_t , int , int , int , int , int , uint32_t , uint32_t , void const * > m_pfnTextureImage2D;
 		GlFunction< void, uint32_t, uint32_t , int , int , int , int , int , int , uint32_t , uint32_t , void const * > m_pfnTextureImage3D;
@@ -520,6 +525,7 @@ namespace GlRender
 		inline void TexSubImage2D( GlTextureStorageType p_target, int level, castor::Position const & p_position, castor::Size const & p_size, GlFormat format, GlType type, void const * data )const;
 		inline void TexSubImage2D( GlTextureStorageType p_target, int level, castor::Rectangle const & p_rect, GlFormat format, GlType type, void const * data )const;
 		inline void TexSubImage3D( GlTextureStorageType p_target, int level, int xoffset, int yoffset, int zoffset, int width, int height, int depth, GlFormat format, GlType type, void const * data )const;
+		inline void CompressedTexSubImage2D( GlTextureStorageType p_target, int level, int xoffset, int yoffset, int width, int height, GlInternal format, int imageSize, void const * data )const;
 		inline void TexImage1D( GlTextureStorageType p_target, int level, GlInternal internalFormat, int width, int border, GlFormat format, GlType type, void const * data )const;
 		inline void TexImage2D( GlTextureStorageType p_target, int level, GlInternal internalFormat, int width, int height, int border, GlFormat format, GlType type, void const * data )const;
 		inline void TexImage2D( GlTextureStorageType p_target, int level, GlInternal internalFormat, castor::Size const & p_size, int border, GlFormat format, GlType type, void const * data )const;
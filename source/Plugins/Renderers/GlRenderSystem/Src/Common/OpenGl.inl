@@ -87,6 +87,11 @@ namespace GlRender
 		EXEC_FUNCTION( TexSubImage3D, uint32_t( mode ), level, xoffset, yoffset, zoffset, width, height, depth, uint32_t( format ), uint32_t( type ), data );
 	}
 
+	void TexFunctions::CompressedTexSubImage2D( GlTextureStorageType mode, int level, int xoffset, int yoffset, int width, int height, GlInternal format, int imageSize, void const * data )const
+	{
+		EXEC_FUNCTION( CompressedTexSubImage2D, uint32_t( mode ), level, xoffset, yoffset, width, height, uint32_t( format ), imageSize, data );
+	}
+
 	void TexFunctions::TexImage1D( GlTextureStorageType mode, int level, GlInternal internalFormat, int width, int border, GlFormat format, GlType type, void const * data )const
 	{
 		EXEC_FUNCTION( TexImage1D, uint32_t( mode ), level, int( internalFormat ), width, border, uint32_t( format ), uint32_t( type ), data );
@@ -144,6 +149,11 @@ namespace GlRender
 		EXEC_FUNCTION( TextureSubImage3D, m_uiTexture, uint32_t( mode ), level, xoffset, yoffset, zoffset, width, height, depth, uint32_t( format ), uint32_t( type ), data );
 	}
 
+	void TexFunctionsDSA::CompressedTexSubImage2D( GlTextureStorageType mode, int level, int xoffset, int yoffset, int width, int height, GlInternal format, int imageSize, void const * data )const
+	{
+		EXEC_FUNCTION( CompressedTextureSubImage2D, m_uiTexture, uint32_t( mode ), level, xoffset, yoffset, width, height, uint32_t( format ), imageSize, data );
+	}
+
 	void TexFunctionsDSA::TexImage1D( GlTextureStorageType mode, int level, GlInternal internalFormat, int width, int border, GlFormat format, GlType type, void const * data )const
 	{
 		EXEC_FUNCTION( TextureImage1D, m_uiTexture, uint32_t( mode ), level, int( internalFormat ), width, border, uint32_t( format ), uint32_t( type ), data );
@@ -1136,6 +1146,11 @@ namespace GlRender
 		m_pTexFunctions->TexSubImage3D( mode, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data );
 	}
 
+	void OpenGl::CompressedTexSubImage2D( GlTextureStorageType mode, int level, int xoffset, int yoffset, int width, int height, GlInternal format, int imageSize, void const * data )const
+	{
+		m_pTexFunctions->CompressedTexSubImage2D( mode, level, xoffset, yoffset, width, height, format, imageSize, data );
+	}
+
 	void OpenGl::TexImage1D( GlTextureStorageType mode, int level, GlInternal internalFormat, int width, int border, GlFormat format, GlType type, void const * data )const
 	{
 		m_pTexFunctions->TexImage1D( mode, level, internalFormat, width, border, format, type, data );
@@ -82,7 +82,7 @@ namespace GlRender
 
 		if ( it != m_attaches.end() )
 		{
-			getOpenGl().ReadBuffer( getOpenGl().get( getOpenGl().get( p_eAttach ) ) );
+			getOpenGl().ReadBuffer( GlBufferBinding( uint32_t( getOpenGl().get( getOpenGl().get( p_eAttach ) ) ) + p_index ) );
 		}
 	}
 
@@ -0,0 +1,71 @@
+#include "FrameBuffer/GlReadbackBuffer.hpp"
+
+#include "Common/OpenGl.hpp"
+#include "Render/GlRenderSystem.hpp"
+#include "Texture/GlDownloadPixelBuffer.hpp"
+
+#include <FrameBuffer/FrameBuffer.hpp>
+
+#include <Graphics/PixelBufferBase.hpp>
+
+using namespace castor3d;
+using namespace castor;
+
+namespace GlRender
+{
+	GlReadbackBuffer::GlReadbackBuffer( OpenGl & p_gl
+		, GlRenderSystem & renderSystem
+		, PixelFormat format
+		, Size const & size )
+		: ReadbackBuffer( renderSystem, format, size )
+		, Holder( p_gl )
+	{
+	}
+
+	GlReadbackBuffer::~GlReadbackBuffer()
+	{
+	}
+
+	bool GlReadbackBuffer::doInitialise()
+	{
+		m_buffer = std::make_unique< GlDownloadPixelBuffer >( getOpenGl()
+			, static_cast< GlRenderSystem * >( getRenderSystem() )
+			, uint32_t( PF::getBytesPerPixel( m_format ) * m_size.getWidth() * m_size.getHeight() ) );
+		bool result = m_buffer->create();
+
+		if ( result )
+		{
+			result = m_buffer->initialise();
+		}
+
+		return result;
+	}
+
+	void GlReadbackBuffer::doCleanup()
+	{
+		if ( m_buffer )
+		{
+			m_buffer->destroy();
+			m_buffer.reset();
+		}
+	}
+
+	void GlReadbackBuffer::doReadback( FrameBuffer const & frameBuffer
+		, AttachmentPoint point
+		, uint8_t index )
+	{
+		OpenGl::PixelFmt pxFmt = getOpenGl().get( m_format );
+		frameBuffer.bind( FrameBufferTarget::eRead );
+		frameBuffer.setReadBuffer( point, index );
+		m_buffer->bind();
+		// A pack buffer is bound, so the pixels pointer is an offset into it, and the call doesn't wait for the transfer.
+		getOpenGl().ReadPixels( Position(), m_size, pxFmt.Format, pxFmt.Type, nullptr );
+		m_buffer->unbind();
+		frameBuffer.unbind();
+	}
+
+	void GlReadbackBuffer::doDownload( PxBufferBase & buffer )
+	{
+		m_buffer->download( 0u, buffer.size(), buffer.ptr() );
+	}
+}
@@ -0,0 +1,82 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___GL_READBACK_BUFFER_H___
+#define ___GL_READBACK_BUFFER_H___
+
+#include "GlRenderSystemPrerequisites.hpp"
+
+#include "Common/GlHolder.hpp"
+
+#include <FrameBuffer/ReadbackBuffer.hpp>
+
+namespace GlRender
+{
+	/*!
+	\author		Sylvain DOREMUS
+	\~english
+	\brief		Readback buffer implementation, using a pack pixel buffer.
+	\remarks	glReadPixels into a bound pack buffer returns without waiting for the transfer,
+				which is only waited for when the buffer is mapped.
+	\~french
+	\brief		Implémentation d'un tampon de récupération, utilisant un tampon de pixels de pack.
+	\remarks	glReadPixels dans un tampon de pack lié retourne sans attendre le transfert,
+				qui n'est attendu que lorsque le tampon est mappé.
+	*/
+	class GlReadbackBuffer
+		: public castor3d::ReadbackBuffer
+		, public Holder
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	p_gl			The OpenGL APIs.
+		 *\param[in]	renderSystem	The RenderSystem.
+		 *\param[in]	format			The pixels format.
+		 *\param[in]	size			The pixels dimensions.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	p_gl			Les APIs OpenGL.
+		 *\param[in]	renderSystem	Le RenderSystem.
+		 *\param[in]	format			Le format des pixels.
+		 *\param[in]	size			Les dimensions en pixels.
+		 */
+		GlReadbackBuffer( OpenGl & p_gl
+			, GlRenderSystem & renderSystem
+			, castor::PixelFormat format
+			, castor::Size const & size );
+		/**
+		 *\~english
+		 *\brief		Destructor.
+		 *\~french
+		 *\brief		Destructeur.
+		 */
+		virtual ~GlReadbackBuffer();
+
+	private:
+		/**
+		 *\copydoc		castor3d::ReadbackBuffer::doInitialise
+		 */
+		bool doInitialise()override;
+		/**
+		 *\copydoc		castor3d::ReadbackBuffer::doCleanup
+		 */
+		void doCleanup()override;
+		/**
+		 *\copydoc		castor3d::ReadbackBuffer::doReadback
+		 */
+		void doReadback( castor3d::FrameBuffer const & frameBuffer
+			, castor3d::AttachmentPoint point
+			, uint8_t index )override;
+		/**
+		 *\copydoc		castor3d::ReadbackBuffer::doDownload
+		 */
+		void doDownload( castor::PxBufferBase & buffer )override;
+
+	private:
+		GlDownloadPixelBufferUPtr m_buffer;
+	};
+}
+
+#endif
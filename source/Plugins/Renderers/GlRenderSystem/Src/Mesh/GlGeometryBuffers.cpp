@@ -54,7 +54,7 @@ namespace GlRender
 		else
 		{
 			getOpenGl().DrawArrays( m_glTopology
-				, int( 0u )
+				, int( index )
 				, int( size ) );
 		}
 
@@ -80,7 +80,7 @@ namespace GlRender
 		else
 		{
 			getOpenGl().DrawArraysInstanced( m_glTopology
-				, int( 0u )
+				, int( index )
 				, int( size )
 				, int( count ) );
 		}
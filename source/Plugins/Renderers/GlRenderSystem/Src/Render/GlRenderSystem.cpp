@@ -4,6 +4,7 @@
 #include "Common/OpenGl.hpp"
 #include "FrameBuffer/GlBackBuffers.hpp"
 #include "FrameBuffer/GlFrameBuffer.hpp"
+#include "FrameBuffer/GlReadbackBuffer.hpp"
 #include "Mesh/GlGeometryBuffers.hpp"
 #include "Miscellaneous/GlComputePipeline.hpp"
 #include "Miscellaneous/GlQuery.hpp"
@@ -545,6 +546,12 @@ namespace GlRender
 		return std::make_shared< GlBackBuffers >( getOpenGl(), *getEngine() );
 	}
 
+	ReadbackBufferUPtr GlRenderSystem::createReadbackBuffer( PixelFormat format
+		, Size const & size )
+	{
+		return std::make_unique< GlReadbackBuffer >( getOpenGl(), *this, format, size );
+	}
+
 	GpuQueryUPtr GlRenderSystem::createQuery( QueryType p_type )
 	{
 		return std::make_unique< GlQuery >( *this, p_type );
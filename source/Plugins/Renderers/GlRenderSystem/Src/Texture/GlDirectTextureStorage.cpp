@@ -168,8 +168,15 @@ namespace GlRender
 			break;
 
 		case GlTextureStorageType::e2D:
-			storage.getOpenGl().TexSubImage2D( storage.getGlType(), 0, 0, 0, size.getWidth(), size.getHeight(), format.Format, format.Type, p_image.getBuffer()->constPtr() );
-			GlDebug_Check( m_allocatedSize, size.getWidth() * size.getHeight() * PF::getBytesPerPixel( p_storage.getOwner()->getPixelFormat() ) );
+			if ( p_image.getBaked() )
+			{
+				storage.uploadBaked( *p_image.getBaked() );
+			}
+			else
+			{
+				storage.getOpenGl().TexSubImage2D( storage.getGlType(), 0, 0, 0, size.getWidth(), size.getHeight(), format.Format, format.Type, p_image.getBuffer()->constPtr() );
+				GlDebug_Check( m_allocatedSize, size.getWidth() * size.getHeight() * PF::getBytesPerPixel( p_storage.getOwner()->getPixelFormat() ) );
+			}
 			break;
 
 		case GlTextureStorageType::e2DMS:
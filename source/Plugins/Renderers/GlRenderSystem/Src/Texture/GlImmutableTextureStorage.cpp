@@ -40,7 +40,9 @@ namespace GlRender
 		auto size = p_storage.getOwner()->getDimensions();
 		OpenGl::PixelFmt format = storage.getOpenGl().get( p_storage.getOwner()->getPixelFormat() );
 
-		auto levels = doGetMinLevels( size );
+		auto levels = p_storage.getOwner()->getMipmapCount() == ~( 0u )
+			? doGetMinLevels( size )
+			: int( p_storage.getOwner()->getMipmapCount() );
 
 		switch ( storage.getGlType() )
 		{
@@ -121,7 +123,14 @@ namespace GlRender
 			break;
 
 		case GlTextureStorageType::e2D:
-			storage.getOpenGl().TexSubImage2D( storage.getGlType(), 0, 0, 0, size.getWidth(), size.getHeight(), format.Format, format.Type, p_image.getBuffer()->constPtr() );
+			if ( p_image.getBaked() )
+			{
+				storage.uploadBaked( *p_image.getBaked() );
+			}
+			else
+			{
+				storage.getOpenGl().TexSubImage2D( storage.getGlType(), 0, 0, 0, size.getWidth(), size.getHeight(), format.Format, format.Type, p_image.getBuffer()->constPtr() );
+			}
 			break;
 
 		case GlTextureStorageType::e2DMS:
@@ -65,6 +65,17 @@ namespace GlRender
 		 *\copydoc		castor3d::TextureStorage::Unlock
 		 */
 		void unlock( bool p_modified, uint32_t p_index )override;
+		/**
+		 *\copydoc		castor3d::TextureStorage::uploadRegion
+		 */
+		void uploadRegion( castor::Rectangle const & p_region
+			, castor::PxBufferBase const & p_buffer )override;
+		/**
+		 *\brief		Uploads every mip level of a baked texture, without conversion.
+		 *\remarks		The storage must be a 2D one, with enough levels allocated.
+		 *\param[in]	p_baked	The baked texture.
+		 */
+		void uploadBaked( castor::BakedTexture const & p_baked )const;
 
 		inline GlTextureStorageType getGlType()const
 		{
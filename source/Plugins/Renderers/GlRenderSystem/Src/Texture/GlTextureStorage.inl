@@ -1,5 +1,7 @@
 #include "Common/OpenGl.hpp"
 
+#include <Graphics/BakedTexture.hpp>
+#include <Graphics/DxtCompression.hpp>
 #include <Texture/TextureLayout.hpp>
 
 namespace GlRender
@@ -63,4 +65,49 @@ namespace GlRender
 	{
 		m_impl.unlock( *this, p_modified, p_index );
 	}
+
+	template< typename Traits >
+	void GlTextureStorage< Traits >::uploadRegion( castor::Rectangle const & p_region
+		, castor::PxBufferBase const & p_buffer )
+	{
+		if ( m_glType != GlTextureStorageType::e2D
+			|| castor::PF::isCompressed( p_buffer.format() ) )
+		{
+			castor3d::TextureStorage::uploadRegion( p_region, p_buffer );
+		}
+		else
+		{
+			// Only the region rows are read, directly from the whole image buffer.
+			OpenGl::PixelFmt format = getOpenGl().get( p_buffer.format() );
+			uint32_t const pixelSize = castor::PF::getBytesPerPixel( p_buffer.format() );
+			uint32_t const width = p_buffer.dimensions().getWidth();
+			uint8_t const * data = p_buffer.constPtr() + ( p_region.top() * width + p_region.left() ) * pixelSize;
+			getOpenGl().PixelStore( GlStorageMode::eUnpackRowLength, int( width ) );
+			getOpenGl().PixelStore( GlStorageMode::eUnpackAlignment, 1 );
+			getOpenGl().TexSubImage2D( m_glType, 0, p_region, format.Format, format.Type, data );
+			getOpenGl().PixelStore( GlStorageMode::eUnpackAlignment, 4 );
+			getOpenGl().PixelStore( GlStorageMode::eUnpackRowLength, 0 );
+		}
+	}
+
+	template< typename Traits >
+	void GlTextureStorage< Traits >::uploadBaked( castor::BakedTexture const & p_baked )const
+	{
+		OpenGl::PixelFmt format = getOpenGl().get( p_baked.getFormat() );
+		bool compressed = castor::PF::isDxtFormat( p_baked.getFormat() );
+
+		for ( uint32_t i = 0u; i < p_baked.getLevelsCount(); ++i )
+		{
+			auto & level = p_baked.getLevel( i );
+
+			if ( compressed )
+			{
+				getOpenGl().CompressedTexSubImage2D( m_glType, int( i ), 0, 0, level.m_dimensions.getWidth(), level.m_dimensions.getHeight(), format.Internal, int( level.m_size ), level.m_data );
+			}
+			else
+			{
+				getOpenGl().TexSubImage2D( m_glType, int( i ), 0, 0, level.m_dimensions.getWidth(), level.m_dimensions.getHeight(), format.Format, format.Type, level.m_data );
+			}
+		}
+	}
 }
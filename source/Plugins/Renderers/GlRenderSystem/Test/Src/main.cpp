@@ -369,12 +369,7 @@ namespace
 int main( int argc, char const * argv[] )
 {
 	int result = EXIT_SUCCESS;
-	int count = 1;
-
-	if ( argc == 2 )
-	{
-		count = std::max< int >( 1, atoi( argv[2] ) );
-	}
+	int count = Testing::BenchManager::parseArguments( argc, argv );
 
 	castor::Logger::initialise( castor::LogType::eDebug );
 	castor::Logger::setFileName( castor::File::getExecutableDirectory() / cuT( "GlRenderSystemTests.log" ) );
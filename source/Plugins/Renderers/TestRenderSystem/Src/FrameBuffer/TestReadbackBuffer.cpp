@@ -0,0 +1,39 @@
+#include "FrameBuffer/TestReadbackBuffer.hpp"
+
+#include "Render/TestRenderSystem.hpp"
+
+using namespace castor3d;
+using namespace castor;
+
+namespace TestRender
+{
+	TestReadbackBuffer::TestReadbackBuffer( TestRenderSystem & renderSystem
+		, PixelFormat format
+		, Size const & size )
+		: ReadbackBuffer( renderSystem, format, size )
+	{
+	}
+
+	TestReadbackBuffer::~TestReadbackBuffer()
+	{
+	}
+
+	bool TestReadbackBuffer::doInitialise()
+	{
+		return true;
+	}
+
+	void TestReadbackBuffer::doCleanup()
+	{
+	}
+
+	void TestReadbackBuffer::doReadback( FrameBuffer const & frameBuffer
+		, AttachmentPoint point
+		, uint8_t index )
+	{
+	}
+
+	void TestReadbackBuffer::doDownload( PxBufferBase & buffer )
+	{
+	}
+}
@@ -0,0 +1,60 @@
+/* See LICENSE file in root folder */
+#ifndef ___TRS_READBACK_BUFFER_H___
+#define ___TRS_READBACK_BUFFER_H___
+
+#include "TestRenderSystemPrerequisites.hpp"
+
+#include <FrameBuffer/ReadbackBuffer.hpp>
+
+namespace TestRender
+{
+	class TestReadbackBuffer
+		: public castor3d::ReadbackBuffer
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	renderSystem	The RenderSystem.
+		 *\param[in]	format			The pixels format.
+		 *\param[in]	size			The pixels dimensions.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	renderSystem	Le RenderSystem.
+		 *\param[in]	format			Le format des pixels.
+		 *\param[in]	size			Les dimensions en pixels.
+		 */
+		TestReadbackBuffer( TestRenderSystem & renderSystem
+			, castor::PixelFormat format
+			, castor::Size const & size );
+		/**
+		 *\~english
+		 *\brief		Destructor.
+		 *\~french
+		 *\brief		Destructeur.
+		 */
+		virtual ~TestReadbackBuffer();
+
+	private:
+		/**
+		 *\copydoc		castor3d::ReadbackBuffer::doInitialise
+		 */
+		bool doInitialise()override;
+		/**
+		 *\copydoc		castor3d::ReadbackBuffer::doCleanup
+		 */
+		void doCleanup()override;
+		/**
+		 *\copydoc		castor3d::ReadbackBuffer::doReadback
+		 */
+		void doReadback( castor3d::FrameBuffer const & frameBuffer
+			, castor3d::AttachmentPoint point
+			, uint8_t index )override;
+		/**
+		 *\copydoc		castor3d::ReadbackBuffer::doDownload
+		 */
+		void doDownload( castor::PxBufferBase & buffer )override;
+	};
+}
+
+#endif
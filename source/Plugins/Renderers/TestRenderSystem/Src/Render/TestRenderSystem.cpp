@@ -2,6 +2,7 @@
 
 #include "FrameBuffer/TestBackBuffers.hpp"
 #include "FrameBuffer/TestFrameBuffer.hpp"
+#include "FrameBuffer/TestReadbackBuffer.hpp"
 #include "Mesh/TestBuffer.hpp"
 #include "Mesh/TestGeometryBuffers.hpp"
 #include "Miscellaneous/TestQuery.hpp"
@@ -127,6 +128,12 @@ namespace TestRender
 		return std::make_shared< TestBackBuffers >( *getEngine() );
 	}
 
+	ReadbackBufferUPtr TestRenderSystem::createReadbackBuffer( PixelFormat format
+		, Size const & size )
+	{
+		return std::make_unique< TestReadbackBuffer >( *this, format, size );
+	}
+
 	GpuQueryUPtr TestRenderSystem::createQuery( QueryType p_type )
 	{
 		return std::make_unique< TestQuery >( *this, p_type );
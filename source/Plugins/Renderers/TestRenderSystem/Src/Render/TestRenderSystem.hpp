@@ -101,6 +101,11 @@ namespace TestRender
 		 *\copydoc		castor3d::RenderSystem::createBackBuffers
 		 */
 		castor3d::BackBuffersSPtr createBackBuffers()override;
+		/**
+		 *\copydoc		castor3d::RenderSystem::createReadbackBuffer
+		 */
+		castor3d::ReadbackBufferUPtr createReadbackBuffer( castor::PixelFormat format
+			, castor::Size const & size )override;
 		/**
 		 *\copydoc		castor3d::RenderSystem::createQuery
 		 */
@@ -12,7 +12,9 @@
 
 #include <Graphics/PixelBufferBase.hpp>
 
+#include <Event/Frame/FunctorEvent.hpp>
 #include <Material/Material.hpp>
+#include <Render/FrameCapture.hpp>
 #include <Render/RenderTarget.hpp>
 #include <Render/RenderLoop.hpp>
 #include <Render/RenderWindow.hpp>
@@ -627,6 +629,22 @@ namespace CastorViewer
 
 		if ( result )
 		{
+			// The rendered frames are read back and encoded asynchronously, the recorder being called from the capture's writer thread.
+			auto & engine = *wxGetApp().getCastor();
+			auto target = m_renderPanel->getRenderWindow()->getRenderTarget();
+			auto capture = std::make_shared< FrameCapture >( *engine.getRenderSystem()
+				, target->getPixelFormat()
+				, target->getSize()
+				, [this]( PxBufferBaseSPtr buffer, uint32_t index )
+				{
+					m_recorder.RecordFrame( buffer );
+				} );
+			engine.postEvent( makeFunctorEvent( EventType::ePreRender
+				, [target, capture]()
+				{
+					target->setFrameCapture( capture );
+				} ) );
+
 			if ( CASTOR3D_THREADED )
 			{
 				m_timer = new wxTimer( this, eID_RENDER_TIMER );
@@ -645,19 +663,13 @@ namespace CastorViewer
 	{
 #if defined( GUICOMMON_RECORDS )
 
-		auto & castor = *wxGetApp().getCastor();
-		m_renderPanel->getRenderWindow()->saveFrame();
-		castor.getRenderLoop().renderSyncFrame();
-		auto buffer = m_renderPanel->getRenderWindow()->getSavedFrame();
+		// The render target's frame capture records the frame.
+		wxGetApp().getCastor()->getRenderLoop().renderSyncFrame();
 
-		try
-		{
-			m_recorder.RecordFrame( buffer );
-		}
-		catch ( std::exception & p_exc )
+		if ( !m_recorder.IsRecording() )
 		{
 			doStopRecord();
-			wxMessageBox( wxString( p_exc.what(), wxMBConvLibc() ) );
+			wxMessageBox( _( "Frame encoding failed, the recording has been stopped." ) );
 		}
 
 #endif
@@ -665,6 +677,26 @@ namespace CastorViewer
 
 	void MainFrame::doStopRecord()
 	{
+#if defined( GUICOMMON_RECORDS )
+
+		auto & engine = *wxGetApp().getCastor();
+
+		if ( m_renderPanel
+			&& m_renderPanel->getRenderWindow()
+			&& !engine.isCleaned() )
+		{
+			// Removing the capture flushes its pending frames into the recorder.
+			auto target = m_renderPanel->getRenderWindow()->getRenderTarget();
+			engine.postEvent( makeFunctorEvent( EventType::ePreRender
+				, [target]()
+				{
+					target->setFrameCapture( nullptr );
+				} ) );
+			engine.getRenderLoop().renderSyncFrame();
+		}
+
+#endif
+
 		m_recorder.StopRecord();
 
 #if defined( GUICOMMON_RECORDS )
@@ -725,9 +757,13 @@ namespace CastorViewer
 		{
 			if ( !castor->isCleaned() )
 			{
-				if ( m_renderPanel && m_recorder.IsRecording() && m_recorder.UpdateTime() )
+				if ( m_renderPanel && m_recorder.IsRecording() )
 				{
-					doRecordFrame();
+					// Each rendered frame is captured, so frames are only rendered when one must be recorded.
+					if ( m_recorder.UpdateTime() )
+					{
+						doRecordFrame();
+					}
 				}
 				else if ( !castor->isThreaded() )
 				{
@@ -757,6 +793,11 @@ namespace CastorViewer
 
 	void MainFrame::OnClose( wxCloseEvent & event )
 	{
+		if ( m_recorder.IsRecording() )
+		{
+			doStopRecord();
+		}
+
 		Logger::unregisterCallback( this );
 		m_auiManager.DetachPane( m_sceneTabsContainer );
 		m_auiManager.DetachPane( m_propertiesHolder );
@@ -840,9 +881,11 @@ namespace CastorViewer
 	void MainFrame::OnLoadScene( wxCommandEvent & event )
 	{
 		wxString wildcard = _( "Castor3D scene files" );
-		wildcard << wxT( " (*.cscn;*.zip)|*.cscn;*.zip|" );
+		wildcard << wxT( " (*.cscn;*.cscb;*.zip)|*.cscn;*.cscb;*.zip|" );
 		wildcard << _( "Castor3D scene file" );
 		wildcard << CSCN_WILDCARD;
+		wildcard << _( "Castor3D compiled scene file" );
+		wildcard << CSCB_WILDCARD;
 		wildcard << _( "Zip archive" );
 		wildcard << ZIP_WILDCARD;
 		wildcard << wxT( "|" );
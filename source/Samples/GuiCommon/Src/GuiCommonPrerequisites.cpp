@@ -253,7 +253,9 @@ namespace GuiCommon
 		{
 			Logger::logInfo( cuT( "Loading scene file : " ) + p_fileName );
 
-			if ( p_fileName.getExtension() == cuT( "cscn" ) || p_fileName.getExtension() == cuT( "zip" ) )
+			if ( p_fileName.getExtension() == cuT( "cscn" )
+				|| p_fileName.getExtension() == cuT( "cscb" )
+				|| p_fileName.getExtension() == cuT( "zip" ) )
 			{
 				try
 				{
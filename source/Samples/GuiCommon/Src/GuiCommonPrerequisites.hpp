@@ -327,6 +327,7 @@ namespace GuiCommon
 #define wxCOMBO_NEW	_( "New..." )
 
 	static const wxString CSCN_WILDCARD = wxT( " (*.cscn)|*.cscn|" );
+	static const wxString CSCB_WILDCARD = wxT( " (*.cscb)|*.cscb|" );
 	static const wxString ZIP_WILDCARD = wxT( " (*.zip)|*.zip|" );
 }
 
@@ -29,7 +29,8 @@ namespace GuiCommon
 
 		inline bool StartRecord( castor::Size const & p_size, int p_wantedFPS )
 		{
-			bool result = !IsRecording();
+			auto lock = castor::makeUniqueLock( m_mutex );
+			bool result = !m_impl->IsRecording();
 
 			if ( result )
 			{
@@ -41,22 +42,27 @@ namespace GuiCommon
 
 		inline bool IsRecording()
 		{
+			auto lock = castor::makeUniqueLock( m_mutex );
 			return m_impl->IsRecording();
 		}
 
 		inline bool UpdateTime()
 		{
+			auto lock = castor::makeUniqueLock( m_mutex );
 			return m_impl->UpdateTime();
 		}
 
 		inline bool RecordFrame( castor::PxBufferBaseSPtr p_buffer )
 		{
+			auto lock = castor::makeUniqueLock( m_mutex );
 			return m_impl->RecordFrame( p_buffer );
 		}
 
 		inline void StopRecord()
 		{
-			if ( IsRecording() )
+			auto lock = castor::makeUniqueLock( m_mutex );
+
+			if ( m_impl->IsRecording() )
 			{
 				m_impl->StopRecord();
 			}
@@ -64,6 +70,7 @@ namespace GuiCommon
 
 	private:
 		std::unique_ptr< IRecorderImpl > m_impl;
+		std::mutex m_mutex;
 	};
 }
 
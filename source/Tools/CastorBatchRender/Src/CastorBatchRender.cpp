@@ -0,0 +1,751 @@
+#include "CastorBatchRender.hpp"
+
+#include <Engine.hpp>
+#include <Cache/PluginCache.hpp>
+#include <Event/Frame/FunctorEvent.hpp>
+#include <Render/FrameCapture.hpp>
+#include <Render/RenderLoop.hpp>
+#include <Render/RenderTarget.hpp>
+#include <Render/RenderWindow.hpp>
+#include <Scene/Camera.hpp>
+#include <Scene/SceneFileParser.hpp>
+#include <Scene/SceneNode.hpp>
+#include <Miscellaneous/PlatformWindowHandle.hpp>
+
+#include <Graphics/Image.hpp>
+#include <Miscellaneous/MemoryAccounting.hpp>
+#include <Miscellaneous/PreciseTimer.hpp>
+#include <Miscellaneous/Profiler.hpp>
+
+#include <fstream>
+#include <iomanip>
+
+#undef CreateWindow
+
+using StringArray = std::vector< std::string >;
+
+struct Options
+{
+	castor::Path input;
+	castor::String renderer{ cuT( "opengl" ) };
+	uint32_t frames{ 100u };
+	uint32_t warmup{ 0u };
+	castor::Path output;
+	castor::Path json;
+	castor::Path trace;
+	castor::Path memory;
+	castor::Path budgets;
+	bool orbit{ false };
+};
+
+struct Report
+{
+	castor::Size size;
+	castor::Nanoseconds elapsed{ 0 };
+	uint32_t written{ 0u };
+	std::vector< castor3d::FrameTimings > frames;
+	castor::MemoryReport memory;
+};
+
+void printUsage()
+{
+	std::cout << "Castor Batch Render is a tool that allows you to render scene files (CSCN, CSCB or ZIP) without user interface." << std::endl;
+	std::cout << "It renders a given number of frames, optionally writes them to image files, and reports the frame timings as JSON." << std::endl;
+	std::cout << "Usage:" << std::endl;
+	std::cout << "CastorBatchRender FILE [-r RENDERER] [-f COUNT] [-w COUNT] [-o FOLDER] [-j NAME] [-t NAME] [-m NAME] [-b NAME] [-c]" << std::endl;
+	std::cout << "Options:" << std::endl;
+	std::cout << "  -r RENDERER Allows you to specify the renderer type (opengl, test), defaults to opengl." << std::endl;
+	std::cout << "              The test renderer needs no display, and measures the CPU side only." << std::endl;
+	std::cout << "  -f COUNT    Allows you to specify the number of measured frames, defaults to 100." << std::endl;
+	std::cout << "  -w COUNT    Allows you to specify a number of frames rendered before the measured ones, defaults to 0." << std::endl;
+	std::cout << "  -o FOLDER   Writes the measured frames to PNG files, in the given folder." << std::endl;
+	std::cout << "  -j NAME     Writes the JSON report to the given file, instead of the standard output." << std::endl;
+	std::cout << "  -t NAME     Streams a profiler trace of the measured frames to the given file (Chrome trace format)." << std::endl;
+	std::cout << "  -m NAME     Periodically dumps the memory report to the given file (JSON if its extension is .json, CSV otherwise)." << std::endl;
+	std::cout << "  -b NAME     Reads memory budgets from the given CSV file (lines of subsystem,cpuBytes,gpuBytes)." << std::endl;
+	std::cout << "              Exits with a failure code if a subsystem exceeds its budget." << std::endl;
+	std::cout << "  -c          Orbits the camera around the scene's Y axis, doing a full turn over the measured frames." << std::endl << std::endl;
+}
+
+bool doGetValue( StringArray const & args
+	, std::string const & option
+	, std::string & value )
+{
+	auto it = std::find( args.begin(), args.end(), option );
+	bool result = it != args.end();
+
+	if ( result )
+	{
+		if ( ++it == args.end() )
+		{
+			throw std::invalid_argument{ "Missing parameter for " + option + " option." };
+		}
+
+		value = *it;
+	}
+
+	return result;
+}
+
+bool doParseArgs( int argc
+	, char * argv[]
+	, Options & options )
+{
+	StringArray args{ argv + 1, argv + argc };
+
+	if ( args.empty() )
+	{
+		std::cerr << "Missing scene file parameter." << std::endl << std::endl;
+		printUsage();
+		return false;
+	}
+
+	if ( std::find( args.begin(), args.end(), "-h" ) != args.end()
+		|| std::find( args.begin(), args.end(), "--help" ) != args.end() )
+	{
+		printUsage();
+		return false;
+	}
+
+	options.input = castor::Path{ castor::string::stringCast< xchar >( args[0] ) };
+	options.orbit = std::find( args.begin(), args.end(), "-c" ) != args.end();
+	std::string value;
+
+	try
+	{
+		if ( doGetValue( args, "-r", value ) )
+		{
+			options.renderer = castor::string::stringCast< xchar >( value );
+		}
+
+		if ( doGetValue( args, "-f", value ) )
+		{
+			options.frames = uint32_t( std::max( 1, std::stoi( value ) ) );
+		}
+
+		if ( doGetValue( args, "-w", value ) )
+		{
+			options.warmup = uint32_t( std::max( 0, std::stoi( value ) ) );
+		}
+
+		if ( doGetValue( args, "-o", value ) )
+		{
+			options.output = castor::Path{ castor::string::stringCast< xchar >( value ) };
+		}
+
+		if ( doGetValue( args, "-j", value ) )
+		{
+			options.json = castor::Path{ castor::string::stringCast< xchar >( value ) };
+		}
+
+		if ( doGetValue( args, "-t", value ) )
+		{
+			options.trace = castor::Path{ castor::string::stringCast< xchar >( value ) };
+		}
+
+		if ( doGetValue( args, "-m", value ) )
+		{
+			options.memory = castor::Path{ castor::string::stringCast< xchar >( value ) };
+		}
+
+		if ( doGetValue( args, "-b", value ) )
+		{
+			options.budgets = castor::Path{ castor::string::stringCast< xchar >( value ) };
+		}
+	}
+	catch ( std::exception & exc )
+	{
+		std::cerr << "Invalid arguments: " << exc.what() << std::endl << std::endl;
+		printUsage();
+		return false;
+	}
+
+	return true;
+}
+
+bool doLoadPlugins( castor3d::Engine & engine )
+{
+	castor::PathArray arrayFiles;
+	castor::File::listDirectoryFiles( castor3d::Engine::getPluginsDirectory(), arrayFiles );
+	castor::PathArray arrayKept;
+
+	// Exclude debug plug-in in release builds, and release plug-ins in debug builds
+	for ( auto file : arrayFiles )
+	{
+#if defined( NDEBUG )
+
+		if ( file.find( castor::String( cuT( "d." ) ) + CASTOR_DLL_EXT ) == castor::String::npos )
+#else
+
+		if ( file.find( castor::String( cuT( "d." ) ) + CASTOR_DLL_EXT ) != castor::String::npos )
+
+#endif
+		{
+			arrayKept.push_back( file );
+		}
+	}
+
+	castor::PathArray arrayFailed;
+	castor::PathArray otherPlugins;
+
+	// Since techniques depend on renderers, we load these first
+	for ( auto file : arrayKept )
+	{
+		if ( file.getExtension() == CASTOR_DLL_EXT )
+		{
+			if ( file.find( cuT( "RenderSystem" ) ) != castor::String::npos )
+			{
+				if ( !engine.getPluginCache().loadPlugin( file ) )
+				{
+					arrayFailed.push_back( file );
+				}
+			}
+			else
+			{
+				otherPlugins.push_back( file );
+			}
+		}
+	}
+
+	for ( auto file : otherPlugins )
+	{
+		if ( !engine.getPluginCache().loadPlugin( file ) )
+		{
+			arrayFailed.push_back( file );
+		}
+	}
+
+	return arrayFailed.empty();
+}
+
+bool doInitialiseEngine( castor3d::Engine & engine
+	, castor::String const & renderer )
+{
+	if ( !castor::File::directoryExists( castor3d::Engine::getEngineDirectory() ) )
+	{
+		castor::File::directoryCreate( castor3d::Engine::getEngineDirectory() );
+	}
+
+	if ( !doLoadPlugins( engine ) )
+	{
+		castor::Logger::logWarning( cuT( "Some plug-ins couldn't be loaded." ) );
+	}
+
+	bool result = false;
+
+	if ( engine.loadRenderer( renderer ) )
+	{
+		engine.initialise( 1, false );
+		result = true;
+	}
+	else
+	{
+		std::cerr << "Couldn't load renderer [" << renderer << "]." << std::endl;
+	}
+
+	return result;
+}
+
+//******************************************************************************
+
+// Window handle for the renderers that don't need a native window.
+class NullWindowHandle
+	: public castor3d::IWindowHandle
+{
+public:
+	virtual operator bool()
+	{
+		return true;
+	}
+};
+
+#if defined( CASTOR_PLATFORM_WINDOWS )
+
+// Hidden native window, holding the main rendering context.
+class NativeWindow
+{
+public:
+	explicit NativeWindow( castor::Size const & size )
+	{
+		m_hWnd = ::CreateWindowA( "STATIC"
+			, "CastorBatchRender"
+			, WS_POPUP
+			, 0
+			, 0
+			, int( size.getWidth() )
+			, int( size.getHeight() )
+			, nullptr
+			, nullptr
+			, ::GetModuleHandle( nullptr )
+			, nullptr );
+
+		if ( !m_hWnd )
+		{
+			CASTOR_EXCEPTION( "Couldn't create window" );
+		}
+	}
+
+	~NativeWindow()
+	{
+		::DestroyWindow( m_hWnd );
+	}
+
+	castor3d::IWindowHandleSPtr createHandle()
+	{
+		return std::make_shared< castor3d::IMswWindowHandle >( m_hWnd );
+	}
+
+private:
+	HWND m_hWnd{ nullptr };
+};
+
+#elif defined( CASTOR_PLATFORM_LINUX )
+
+// Hidden native window, holding the main rendering context.
+// The window is never mapped, so any X server will do, Xvfb for instance.
+class NativeWindow
+{
+public:
+	explicit NativeWindow( castor::Size const & size )
+	{
+		m_display = XOpenDisplay( nullptr );
+
+		if ( !m_display )
+		{
+			CASTOR_EXCEPTION( "Couldn't open X Display" );
+		}
+
+		m_window = XCreateSimpleWindow( m_display
+			, RootWindow( m_display, DefaultScreen( m_display ) )
+			, 0
+			, 0
+			, size.getWidth()
+			, size.getHeight()
+			, 0
+			, 0
+			, 0 );
+
+		if ( !m_window )
+		{
+			XCloseDisplay( m_display );
+			CASTOR_EXCEPTION( "Couldn't create X Window" );
+		}
+
+		XStoreName( m_display, m_window, "CastorBatchRender" );
+		XSync( m_display, False );
+	}
+
+	~NativeWindow()
+	{
+		XDestroyWindow( m_display, m_window );
+		XCloseDisplay( m_display );
+	}
+
+	castor3d::IWindowHandleSPtr createHandle()
+	{
+		return std::make_shared< castor3d::IXWindowHandle >( GLXDrawable( m_window ), m_display );
+	}
+
+private:
+	Display * m_display{ nullptr };
+	Window m_window{ 0 };
+};
+
+#endif
+
+//******************************************************************************
+
+class Orbit
+{
+public:
+	Orbit( castor3d::SceneNode & node
+		, uint32_t frames )
+		: m_node{ node }
+		, m_position{ node.getPosition() }
+		, m_orientation{ node.getOrientation() }
+		, m_frames{ frames }
+	{
+	}
+
+	~Orbit()
+	{
+		m_node.setPosition( m_position );
+		m_node.setOrientation( m_orientation );
+	}
+
+	void update( uint32_t frame )
+	{
+		auto rotation = castor::Quaternion::fromAxisAngle( castor::Point3r{ 0, 1, 0 }
+			, castor::Angle::fromDegrees( 360.0 * frame / m_frames ) );
+		castor::Point3r position;
+		rotation.transform( m_position, position );
+		m_node.setPosition( position );
+		m_node.setOrientation( rotation * m_orientation );
+	}
+
+private:
+	castor3d::SceneNode & m_node;
+	castor::Point3r const m_position;
+	castor::Quaternion const m_orientation;
+	uint32_t const m_frames;
+};
+
+//******************************************************************************
+
+castor3d::FrameCaptureSPtr doCreateCapture( castor3d::Engine & engine
+	, castor::Size const & size
+	, castor::Path const & folder )
+{
+	if ( !castor::File::directoryExists( folder ) )
+	{
+		castor::File::directoryCreate( folder );
+	}
+
+	return std::make_shared< castor3d::FrameCapture >( *engine.getRenderSystem()
+		, castor::PixelFormat::eA8R8G8B8
+		, size
+		, [folder]( castor::PxBufferBaseSPtr buffer, uint32_t index )
+		{
+			castor::StringStream name;
+			name << cuT( "Frame_" ) << std::setw( 5 ) << std::setfill( cuT( '0' ) ) << index << cuT( ".png" );
+
+			if ( !castor::Image::BinaryWriter()( castor::Image{ name.str(), *buffer }, folder / name.str() ) )
+			{
+				castor::Logger::logError( cuT( "Couldn't write frame file " ) + name.str() );
+			}
+		} );
+}
+
+bool doRender( castor3d::Engine & engine
+	, castor3d::RenderWindow & window
+	, Options const & options
+	, Report & report )
+{
+	auto target = window.getRenderTarget();
+	auto & loop = engine.getRenderLoop();
+	castor3d::FrameCaptureSPtr capture;
+	std::unique_ptr< Orbit > orbit;
+	report.size = target->getSize();
+
+	if ( options.orbit )
+	{
+		auto camera = window.getCamera();
+
+		if ( camera && camera->getParent() )
+		{
+			orbit = std::make_unique< Orbit >( *camera->getParent(), options.frames );
+		}
+		else
+		{
+			castor::Logger::logWarning( cuT( "The render window has no camera node, the camera won't orbit." ) );
+		}
+	}
+
+	for ( uint32_t i = 0u; i < options.warmup; ++i )
+	{
+		loop.renderSyncFrame();
+	}
+
+	if ( !options.output.empty() )
+	{
+		capture = doCreateCapture( engine, report.size, options.output );
+		engine.postEvent( castor3d::makeFunctorEvent( castor3d::EventType::ePreRender
+			, [target, capture]()
+			{
+				target->setFrameCapture( capture );
+			} ) );
+	}
+
+	if ( !options.trace.empty()
+		&& !castor::Profiler::start( options.trace ) )
+	{
+		castor::Logger::logWarning( cuT( "Couldn't open the trace file " ) + options.trace );
+	}
+
+	if ( !options.memory.empty() )
+	{
+		engine.setMemoryReportFile( options.memory, castor::Milliseconds{ 100 } );
+	}
+
+	loop.collectTimings( true );
+	report.frames.reserve( options.frames );
+	castor::PreciseTimer timer;
+
+	for ( uint32_t i = 0u; i < options.frames; ++i )
+	{
+		if ( orbit )
+		{
+			orbit->update( i );
+		}
+
+		loop.renderSyncFrame();
+		report.frames.push_back( loop.getLastFrameTimings() );
+	}
+
+	report.elapsed = timer.getElapsed();
+	loop.collectTimings( false );
+	castor::Profiler::stop();
+	report.memory = engine.getMemoryReport();
+
+	if ( capture )
+	{
+		// The capture is detached from the rendering thread, which retrieves the pending frames,
+		// the frame rendered here is not captured.
+		engine.postEvent( castor3d::makeFunctorEvent( castor3d::EventType::ePreRender
+			, [target]()
+			{
+				target->setFrameCapture( nullptr );
+			} ) );
+		loop.renderSyncFrame();
+		report.written = capture->getWrittenCount();
+	}
+
+	return report.frames.size() == options.frames;
+}
+
+//******************************************************************************
+
+std::string doEscape( castor::String const & text )
+{
+	std::string result;
+
+	for ( auto c : castor::string::stringCast< char >( text ) )
+	{
+		if ( c == '"' || c == '\\' )
+		{
+			result += '\\';
+		}
+
+		result += c;
+	}
+
+	return result;
+}
+
+double doGetMilliseconds( castor::Nanoseconds const & time )
+{
+	return time.count() / 1000000.0;
+}
+
+std::string doWriteReport( Options const & options
+	, Report const & report )
+{
+	struct PassTimes
+	{
+		castor::Nanoseconds cpu{ 0 };
+		castor::Nanoseconds gpu{ 0 };
+	};
+
+	castor::Nanoseconds total{ 0 };
+	castor::Nanoseconds cpu{ 0 };
+	castor::Nanoseconds gpu{ 0 };
+	std::map< castor::String, PassTimes > passes;
+
+	for ( auto & frame : report.frames )
+	{
+		total += frame.m_totalTime;
+		cpu += frame.m_cpuTime;
+		gpu += frame.m_gpuTime;
+
+		for ( auto & pass : frame.m_passes )
+		{
+			auto & times = passes[pass.m_name];
+			times.cpu += pass.m_cpuTime;
+			times.gpu += pass.m_gpuTime;
+		}
+	}
+
+	auto count = std::max< size_t >( 1u, report.frames.size() );
+	std::stringstream json;
+	json << std::fixed << std::setprecision( 4 );
+	json << "{\n";
+	json << "\t\"scene\": \"" << doEscape( options.input ) << "\",\n";
+	json << "\t\"renderer\": \"" << doEscape( options.renderer ) << "\",\n";
+	json << "\t\"width\": " << report.size.getWidth() << ",\n";
+	json << "\t\"height\": " << report.size.getHeight() << ",\n";
+	json << "\t\"frames\": " << report.frames.size() << ",\n";
+	json << "\t\"writtenFrames\": " << report.written << ",\n";
+	json << "\t\"elapsedMs\": " << doGetMilliseconds( report.elapsed ) << ",\n";
+	json << "\t\"fps\": " << ( report.elapsed.count()
+		? report.frames.size() * 1000.0 / doGetMilliseconds( report.elapsed )
+		: 0.0 ) << ",\n";
+	json << "\t\"average\": {\n";
+	json << "\t\t\"totalMs\": " << doGetMilliseconds( total / count ) << ",\n";
+	json << "\t\t\"cpuMs\": " << doGetMilliseconds( cpu / count ) << ",\n";
+	json << "\t\t\"gpuMs\": " << doGetMilliseconds( gpu / count ) << "\n";
+	json << "\t},\n";
+	json << "\t\"passes\": [";
+	std::string sep = "\n";
+
+	for ( auto & pass : passes )
+	{
+		json << sep << "\t\t{ \"name\": \"" << doEscape( pass.first ) << "\""
+			<< ", \"cpuMs\": " << doGetMilliseconds( pass.second.cpu / count )
+			<< ", \"gpuMs\": " << doGetMilliseconds( pass.second.gpu / count ) << " }";
+		sep = ",\n";
+	}
+
+	json << "\n\t],\n";
+	json << "\t\"memory\": ";
+	castor::MemoryAccounting::writeJson( json, report.memory, "\t\t" );
+	json << ",\n";
+	json << "\t\"frameTimes\": [";
+	sep = "\n";
+
+	for ( auto & frame : report.frames )
+	{
+		json << sep << "\t\t{ \"totalMs\": " << doGetMilliseconds( frame.m_totalTime )
+			<< ", \"cpuMs\": " << doGetMilliseconds( frame.m_cpuTime )
+			<< ", \"gpuMs\": " << doGetMilliseconds( frame.m_gpuTime )
+			<< ", \"drawCalls\": " << frame.m_info.m_drawCalls
+			<< ", \"visibleObjects\": " << frame.m_info.m_visibleObjectsCount
+			<< ", \"visibleFaces\": " << frame.m_info.m_visibleFaceCount << " }";
+		sep = ",\n";
+	}
+
+	json << "\n\t]\n";
+	json << "}\n";
+	return json.str();
+}
+
+//******************************************************************************
+
+int main( int argc, char * argv[] )
+{
+	Options options;
+	int result = EXIT_SUCCESS;
+
+	if ( doParseArgs( argc, argv, options ) )
+	{
+		auto path = options.input;
+
+		if ( !castor::File::fileExists( path ) )
+		{
+			path = castor::File::getExecutableDirectory() / path;
+		}
+
+		if ( !castor::File::fileExists( path ) )
+		{
+			std::cerr << "File [" << path << "] does not exist." << std::endl << std::endl;
+			printUsage();
+			return EXIT_FAILURE;
+		}
+
+#if defined( NDEBUG )
+		castor::Logger::initialise( castor::LogType::eInfo );
+#else
+		castor::Logger::initialise( castor::LogType::eDebug );
+#endif
+
+		if ( !options.budgets.empty() )
+		{
+			std::ifstream budgets{ castor::string::stringCast< char >( options.budgets ) };
+
+			if ( !budgets )
+			{
+				std::cerr << "Couldn't open the budgets file [" << options.budgets << "]." << std::endl;
+				return EXIT_FAILURE;
+			}
+
+			castor::MemoryAccounting::readBudgets( budgets );
+		}
+
+		castor::Logger::setFileName( castor::File::getExecutableDirectory() / cuT( "CastorBatchRender.log" ) );
+		Report report;
+
+		{
+			castor3d::Engine engine;
+
+			if ( doInitialiseEngine( engine, options.renderer ) )
+			{
+				std::unique_ptr< NativeWindow > native;
+				castor3d::IWindowHandleSPtr handle;
+
+				try
+				{
+					castor3d::SceneFileParser parser{ engine };
+
+					if ( parser.parseFile( path ) && parser.getRenderWindow() )
+					{
+						auto window = parser.getRenderWindow();
+						auto size = window->getRenderTarget()->getSize();
+
+						if ( options.renderer == cuT( "test" ) )
+						{
+							handle = std::make_shared< NullWindowHandle >();
+						}
+						else
+						{
+							native = std::make_unique< NativeWindow >( size );
+							handle = native->createHandle();
+						}
+
+						if ( window->initialise( size, castor3d::WindowHandle{ handle } ) )
+						{
+							if ( !doRender( engine, *window, options, report ) )
+							{
+								result = EXIT_FAILURE;
+							}
+						}
+						else
+						{
+							std::cerr << "Couldn't initialise the render window." << std::endl;
+							result = EXIT_FAILURE;
+						}
+
+						engine.cleanup();
+					}
+					else
+					{
+						std::cerr << "Couldn't load scene file [" << path << "], or it has no render window." << std::endl;
+						engine.cleanup();
+						result = EXIT_FAILURE;
+					}
+				}
+				catch ( std::exception & exc )
+				{
+					std::cerr << "Error encountered while rendering file : " << exc.what() << std::endl;
+					engine.cleanup();
+					result = EXIT_FAILURE;
+				}
+			}
+			else
+			{
+				result = EXIT_FAILURE;
+			}
+		}
+
+		castor::Logger::cleanup();
+
+		// The logger redirects the standard output, the report is written once it is released.
+		if ( result == EXIT_SUCCESS )
+		{
+			auto json = doWriteReport( options, report );
+
+			if ( options.json.empty() )
+			{
+				std::cout << json;
+			}
+			else
+			{
+				std::ofstream file{ castor::string::stringCast< char >( options.json ) };
+				file << json;
+			}
+
+			for ( auto & entry : report.memory )
+			{
+				if ( entry.isOverBudget() )
+				{
+					std::cerr << "Memory budget exceeded for " << entry.name
+						<< ": CPU peak " << entry.cpuPeak << "/" << entry.cpuBudget
+						<< ", GPU peak " << entry.gpuPeak << "/" << entry.gpuBudget << std::endl;
+					result = EXIT_FAILURE;
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+//******************************************************************************
@@ -0,0 +1,5 @@
+/* See LICENSE file in root folder */
+#ifndef ___CastorBatchRender_HPP___
+#define ___CastorBatchRender_HPP___
+
+#endif
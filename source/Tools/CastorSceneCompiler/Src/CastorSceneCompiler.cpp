@@ -0,0 +1,230 @@
+#include <Engine.hpp>
+#include <Plugin/RendererPlugin.hpp>
+#include <Scene/SceneFileParser.hpp>
+
+using StringArray = std::vector< std::string >;
+
+struct Options
+{
+	castor::Path input;
+	castor::Path output;
+};
+
+void printUsage()
+{
+	std::cout << "Castor Scene Compiler is a tool that allows you to compile scene files (CSCN or ZIP) to CSCB files." << std::endl;
+	std::cout << "The CSCB files are loaded without any text parsing, and embed the geometry of the imported meshes." << std::endl;
+	std::cout << "Usage:" << std::endl;
+	std::cout << "CastorSceneCompiler FILE [-o NAME]" << std::endl;
+	std::cout << "Options:" << std::endl;
+	std::cout << "  -o NAME     Allows you to specify the output file name." << std::endl;
+	std::cout << "              NAME can omit the extension." << std::endl << std::endl;
+}
+
+bool doParseArgs( int argc
+	, char * argv[]
+	, Options & options )
+{
+	StringArray args{ argv + 1, argv + argc };
+
+	if ( args.empty() )
+	{
+		std::cerr << "Missing scene file parameter." << std::endl << std::endl;
+		printUsage();
+		return false;
+	}
+
+	auto it = std::find( args.begin(), args.end(), "-h" );
+
+	if ( it == args.end() )
+	{
+		it = std::find( args.begin(), args.end(), "--help" );
+	}
+
+	if ( it != args.end() )
+	{
+		args.erase( it );
+		printUsage();
+		return false;
+	}
+
+	it = std::find( args.begin(), args.end(), "-o" );
+	options.input = castor::Path{ castor::string::stringCast< xchar >( args[0] ) };
+
+	if ( it == args.end() )
+	{
+		options.output = options.input.getPath() / ( options.input.getFileName() + cuT( ".cscb" ) );
+	}
+	else if ( ++it == args.end() )
+	{
+		std::cerr << "Missing NAME parameter for -o option." << std::endl << std::endl;
+		printUsage();
+		return false;
+	}
+	else
+	{
+		options.output = castor::Path{ castor::string::stringCast< xchar >( *it ) };
+
+		if ( options.output.getExtension().empty() )
+		{
+			options.output += cuT( ".cscb" );
+		}
+	}
+
+	return true;
+}
+
+bool doLoadRenderer( castor3d::Engine & engine )
+{
+	castor::PathArray arrayFiles;
+	castor::File::listDirectoryFiles( castor3d::Engine::getPluginsDirectory(), arrayFiles );
+	castor::PathArray arrayKept;
+
+	// Exclude debug plug-in in release builds, and release plug-ins in debug builds
+	for ( auto file : arrayFiles )
+	{
+#if defined( NDEBUG )
+
+		if ( file.find( castor::String( cuT( "d." ) ) + CASTOR_DLL_EXT ) == castor::String::npos )
+#else
+
+		if ( file.find( castor::String( cuT( "d." ) ) + CASTOR_DLL_EXT ) != castor::String::npos )
+
+#endif
+		{
+			arrayKept.push_back( file );
+		}
+	}
+
+	castor::PathArray arrayFailed;
+
+	for ( auto file : arrayKept )
+	{
+		if ( file.getExtension() == CASTOR_DLL_EXT )
+		{
+			if ( !engine.getPluginCache().loadPlugin( file ) )
+			{
+				arrayFailed.push_back( file );
+			}
+		}
+	}
+
+	return arrayFailed.empty();
+}
+
+bool doInitialiseEngine( castor3d::Engine & engine )
+{
+	if ( !castor::File::directoryExists( castor3d::Engine::getEngineDirectory() ) )
+	{
+		castor::File::directoryCreate( castor3d::Engine::getEngineDirectory() );
+	}
+
+	doLoadRenderer( engine );
+
+	auto renderers = engine.getPluginCache().getPlugins( castor3d::PluginType::eRenderer );
+	bool result = false;
+
+	if ( renderers.empty() )
+	{
+		std::cerr << "No renderer plug-ins" << std::endl;
+	}
+	else
+	{
+		// The scene is only parsed, the test renderer is enough.
+		auto renderer = std::find_if( renderers.begin()
+			, renderers.end()
+			, []( std::pair< castor::String, castor3d::PluginSPtr > const & pair )
+		{
+			return pair.first.find( "Test" ) != castor::String::npos;
+		} );
+
+		if ( renderer != renderers.end() )
+		{
+			if ( engine.loadRenderer( std::static_pointer_cast< castor3d::RendererPlugin >( renderer->second )->getRendererType() ) )
+			{
+				engine.initialise( 1, false );
+				result = true;
+			}
+			else
+			{
+				std::cerr << "Couldn't load renderer." << std::endl;
+			}
+		}
+		else
+		{
+			std::cerr << "Couldn't load test renderer." << std::endl;
+		}
+	}
+
+	return result;
+}
+
+int main( int argc, char * argv[] )
+{
+	Options options;
+	int result = EXIT_SUCCESS;
+
+	if ( doParseArgs( argc, argv, options ) )
+	{
+		auto path = options.input;
+
+		if ( !castor::File::fileExists( path ) )
+		{
+			path = castor::File::getExecutableDirectory() / path;
+		}
+
+		if ( !castor::File::fileExists( path ) )
+		{
+			std::cerr << "File [" << path << "] does not exist." << std::endl << std::endl;
+			printUsage();
+			return EXIT_FAILURE;
+		}
+
+#if defined( NDEBUG )
+		castor::Logger::initialise( castor::LogType::eInfo );
+#else
+		castor::Logger::initialise( castor::LogType::eDebug );
+#endif
+
+		castor::Logger::setFileName( castor::File::getExecutableDirectory() / cuT( "CastorSceneCompiler.log" ) );
+
+		{
+			castor3d::Engine engine;
+
+			if ( doInitialiseEngine( engine ) )
+			{
+				try
+				{
+					castor3d::SceneFileParser parser{ engine };
+
+					if ( parser.compileFile( path, options.output ) )
+					{
+						std::cout << "Compiled scene file written to [" << options.output << "]." << std::endl;
+					}
+					else
+					{
+						std::cerr << "Couldn't compile scene file [" << path << "]." << std::endl;
+						result = EXIT_FAILURE;
+					}
+				}
+				catch ( std::exception & exc )
+				{
+					std::cerr << "Error encountered while compiling file : " << exc.what() << std::endl;
+					result = EXIT_FAILURE;
+				}
+
+				engine.cleanup();
+			}
+			else
+			{
+				result = EXIT_FAILURE;
+			}
+		}
+
+		castor::Logger::cleanup();
+	}
+
+	return result;
+}
+
+//******************************************************************************
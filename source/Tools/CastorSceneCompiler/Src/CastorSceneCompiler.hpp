@@ -0,0 +1,5 @@
+/* See LICENSE file in root folder */
+#ifndef ___CastorSceneCompiler_HPP___
+#define ___CastorSceneCompiler_HPP___
+
+#endif
@@ -4,13 +4,51 @@
 #include <wx/choicdlg.h>
 #include <wx/filedlg.h>
 #include <wx/filename.h>
+#include <wx/msgdlg.h>
 #include <wx/sizer.h>
 #include <wx/stdpaths.h>
 
+#include <Exception/Exception.hpp>
+#include <Graphics/BakedTexture.hpp>
+#include <Graphics/PixelBufferBase.hpp>
+
 using namespace ImgToIco;
 
 DECLARE_APP( ImgToIcoApp )
 
+namespace
+{
+	castor::PxBufferBaseSPtr doGetBuffer( wxImage const & p_image )
+	{
+		uint32_t l_count = uint32_t( p_image.GetWidth() * p_image.GetHeight() );
+		castor::ByteArray l_rgba( l_count * 4u );
+		uint8_t const * l_rgb = p_image.GetData();
+		uint8_t const * l_alpha = p_image.HasAlpha()
+			? p_image.GetAlpha()
+			: nullptr;
+
+		for ( uint32_t i = 0u; i < l_count; ++i )
+		{
+			l_rgba[i * 4u + 0u] = l_rgb[i * 3u + 0u];
+			l_rgba[i * 4u + 1u] = l_rgb[i * 3u + 1u];
+			l_rgba[i * 4u + 2u] = l_rgb[i * 3u + 2u];
+			l_rgba[i * 4u + 3u] = l_alpha
+				? l_alpha[i]
+				: 255u;
+		}
+
+		return castor::PxBufferBase::create( castor::Size( uint32_t( p_image.GetWidth() ), uint32_t( p_image.GetHeight() ) )
+			, castor::PixelFormat::eA8R8G8B8
+			, l_rgba.data()
+			, castor::PixelFormat::eA8R8G8B8 );
+	}
+
+	castor::Path doGetPath( wxString const & p_path )
+	{
+		return castor::Path{ castor::string::stringCast< castor::xchar >( std::string( p_path.mb_str( wxConvUTF8 ).data() ) ) };
+	}
+}
+
 MainFrame::MainFrame()
 	:	wxFrame( NULL, wxID_ANY, _( "Image To ICO/XPM Converter" ), wxPoint( 0, 0 ), wxSize( 400, 300 ), wxSYSTEM_MENU | wxCLOSE_BOX | wxCAPTION )
 {
@@ -65,7 +103,38 @@ void MainFrame::_onProcess( wxCommandEvent & p_event )
 	wxString l_strExt;
 	l_arrayChoices.push_back( wxT( "ico" ) );
 	l_arrayChoices.push_back( wxT( "xpm" ) );
+	l_arrayChoices.push_back( wxString( castor::BakedTexture::Extension.c_str() ) );
 	l_strExt = wxGetSingleChoice( _( "Select output image format" ), _( "Image format" ), l_arrayChoices );
+	bool l_baked = l_strExt == wxString( castor::BakedTexture::Extension.c_str() );
+	castor::BakedTexture::Options l_options;
+
+	if ( l_baked )
+	{
+		wxArrayString l_arrayFormats;
+		l_arrayFormats.push_back( wxT( "RGBA" ) );
+		l_arrayFormats.push_back( wxT( "DXT1" ) );
+		l_arrayFormats.push_back( wxT( "DXT3" ) );
+		l_arrayFormats.push_back( wxT( "DXT5" ) );
+		static castor::PixelFormat const l_formats[]
+		{
+			castor::PixelFormat::eA8R8G8B8,
+			castor::PixelFormat::eDXTC1,
+			castor::PixelFormat::eDXTC3,
+			castor::PixelFormat::eDXTC5,
+		};
+		int l_index = wxGetSingleChoiceIndex( _( "Select baked texture format" ), _( "Baked texture format" ), l_arrayFormats );
+
+		if ( l_index < 0 )
+		{
+			l_strExt.clear();
+		}
+		else
+		{
+			l_options.m_format = l_formats[l_index];
+			// Data textures (normal maps, ...) must not be filtered as sRGB colours.
+			l_options.m_srgb = wxMessageBox( _( "Are the images sRGB colour textures?" ), _( "Baked texture format" ), wxYES_NO | wxICON_QUESTION ) == wxYES;
+		}
+	}
 
 	if ( !l_strExt.empty() )
 	{
@@ -78,12 +147,28 @@ void MainFrame::_onProcess( wxCommandEvent & p_event )
 
 			if ( l_image.IsOk() )
 			{
-				if ( ( l_image.GetWidth() > 64 || l_image.GetHeight() > 64 ) && l_strExt == wxT( "ico" ) )
+				wxString l_strOutput = l_fileName.GetPath( wxPATH_GET_VOLUME | wxPATH_GET_SEPARATOR ) + l_fileName.GetName() + wxT( "." ) + l_strExt;
+
+				if ( l_baked )
 				{
-					l_image.Rescale( 64, 64, wxIMAGE_QUALITY_HIGH );
+					try
+					{
+						castor::BakedTexture::bake( *doGetBuffer( l_image ), l_options, doGetPath( l_strOutput ) );
+					}
+					catch ( castor::Exception & p_exc )
+					{
+						wxMessageBox( _( "Baking failed: " ) + wxString( p_exc.getFullDescription().c_str(), wxConvUTF8 ) );
+					}
 				}
+				else
+				{
+					if ( ( l_image.GetWidth() > 64 || l_image.GetHeight() > 64 ) && l_strExt == wxT( "ico" ) )
+					{
+						l_image.Rescale( 64, 64, wxIMAGE_QUALITY_HIGH );
+					}
 
-				l_image.SaveFile( l_fileName.GetPath( wxPATH_GET_VOLUME | wxPATH_GET_SEPARATOR ) + l_fileName.GetName() + wxT( "." ) + l_strExt );
+					l_image.SaveFile( l_strOutput );
+				}
 			}
 		}
 